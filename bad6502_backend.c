@@ -24,6 +24,12 @@
 #include <pthread.h>
 #include <SDL.h>
 #include "cpu/bad65C02.h"
+#include "cpu/pace6502.h"
+#include "cpu/trace6502.h"
+#include "cpu/rt6502.h"
+#include "cpu/sync6502.h"
+#include "cpu/ring6502.h"
+#include "cpu/mem6502.h"
 
 #include "6502asm/test.h"
 
@@ -31,8 +37,12 @@
 #include "./vic20/roms/characters.901460-03.h"
 
 #ifdef FAKE
+#include "cpu/fake6502.h"
+
 #define reset65C02 reset6502
-#define step65C02 step6502
+// One bus cycle per step, like the real chip, so the device side sees the
+// same accesses at the same clockticks
+#define step65C02 cycle6502
 #define read65C02 read6502
 #define write65C02 write6502
 #define clockticks65C02 clockticks6502
@@ -44,14 +54,26 @@ volatile extern uint32_t clockticks6502;
 #define ndelay(x) for(int i=0;i<x;i++)asm("nop");
 
 // Memory layout 
-volatile static uint8_t mem[0x10000];
-volatile static uint8_t *page[256];
-volatile static uint8_t page_type[256];
+// Plain memory, the CPU thread publishes it to the video thread every
+// pacer quantum (see cpu/mem6502.h)
+static uint8_t mem[0x10000];
+static uint8_t *page[256];
+static uint8_t page_type[256];
+mem6502_pub_t mem_pub;
 
 // Threads
 pthread_t IOthread, CPUthread, VIDthread;
 
-volatile uint8_t runme = 1;
+atomic_uchar runme = 1;
+
+// Threads wait on state_ev for each other (ready, out of cycles, stopping)
+// and on clock_ev for the CPU to run again when it slept or was held
+sync6502_t state_ev, clock_ev;
+
+static inline int running()
+{
+  return atomic_load_explicit(&runme, memory_order_relaxed);
+}
 
 // install_reset_vector: set target for reset
 inline static void install_reset_vect(unsigned int vect) 
@@ -75,48 +97,105 @@ inline static void install_nmi_vect(unsigned int vect)
 }
 
 // IO Thread (slightly async)
-volatile uint16_t io_mbox[256];
-volatile uint8_t mbox_data[256];
-volatile uint8_t updateIO_ready = 0;
+// Device writes from the CPU thread, in the order and at the clockticks
+// they happened. A full ring stalls the CPU until the IO thread caught up,
+// -DIO_BACKPRESSURE=RING6502_DROP drops the write instead
+#ifndef IO_RING
+#define IO_RING 1024
+#endif
+#ifndef IO_BACKPRESSURE
+#define IO_BACKPRESSURE RING6502_STALL
+#endif
+ring6502_t io_ring;
+atomic_uchar updateIO_ready = 0;
+
+// Stops all threads, signal safe
+void stop()
+{
+  atomic_store(&runme, 0);
+  ring6502_stop(&io_ring);
+  sync6502_signal(&state_ev);
+  sync6502_signal(&clock_ev);
+}
+
+void console_write(ring6502_rec_t *w)
+{
+  if (w->addr == 0xE000) {
+    fprintf(stdout,"%c",w->data);
+  }
+}
 
 void *updateIO()
 {
-  uint8_t box_pos = 0;
-  uint16_t addr;
   uint32_t old_ticks = clockticks65C02;
   dup(1);
   dup(2);
-  updateIO_ready = 1;
-
-  while (runme) {
-    while (clockticks65C02 == old_ticks);
-    if (io_mbox[box_pos]) {
-      addr = io_mbox[box_pos];
-      if (addr == 0xE000) {
-        fprintf(stdout,"%c",mbox_data[box_pos]);
-      }
-      io_mbox[box_pos++] = 0;
-    }
+  atomic_store_explicit(&updateIO_ready, 1, memory_order_release);
+  sync6502_signal(&state_ev);
+
+  while (running()) {
+    // Asleep while the clock stands, it's held or paced
+    sync6502_until(&clock_ev, clockticks65C02 != old_ticks || !running(), SYNC6502_MS);
+    if (clockticks65C02 == old_ticks)
+      continue;
+    ring6502_drain(&io_ring, old_ticks, console_write);
     old_ticks++;
   }
 }
 
-// CPU thread (sync)
-volatile uint32_t run_state=3;
+// CPU thread (sync), run_state is the cycles left to run.
+// Emulated clock, -DPACE_HZ=PACE_PAL or PACE_OFF (unthrottled)
+#ifndef PACE_HZ
+#define PACE_HZ PACE_NTSC
+#endif
+pace6502_t pace;
+rt6502_hist_t step_time;
+_Atomic uint32_t run_state=3;
+
+static inline uint32_t cycles_left()
+{
+  return atomic_load_explicit(&run_state, memory_order_acquire);
+}
+
 void *run6502()
 {
+  uint64_t t;
+  uint32_t left;
+
+  // On its own core in real-time mode, before the bus timing is measured
+  rt6502_enter();
   reset65C02();
 
-  run_state = 0;
-  while (runme) {
-    while(!run_state);
+  atomic_store_explicit(&run_state, 0, memory_order_release);
+  sync6502_signal(&state_ev);
+  sync6502_until(&state_ev, cycles_left() || !running(), 0);
+  pace6502_init(&pace, PACE_HZ, 0, clockticks65C02);
+  while (running()) {
+    // Out of cycles: tell main and sleep until there are more, the I/O
+    // thread sleeps too until the clock runs again
+    if (!(left = atomic_load_explicit(&run_state, memory_order_relaxed))) {
+      mem6502_publish(&mem_pub, clockticks65C02);
+      sync6502_signal(&state_ev);
+      sync6502_until(&state_ev, cycles_left() || !running(), 0);
+      sync6502_signal(&clock_ev);
+      continue;
+    }
+    t = rt6502_now();
     step65C02();
+    rt6502_hist(&step_time, rt6502_now() - t);
 #ifdef FAKE
-    ndelay(800);
 //    extern volatile uint16_t pc;
 //    printf("0x%04x\n",pc);
 #endif
-    run_state--;
+    pace6502(&pace, clockticks65C02);
+    // Synced, maybe after a sleep the I/O thread slept through too. The
+    // memory so far is out for the next frame
+    if (pace.ticks == clockticks65C02) {
+      mem6502_publish(&mem_pub, clockticks65C02);
+      sync6502_signal(&clock_ev);
+    }
+    // Only main sets it, while we're waiting for it
+    atomic_store_explicit(&run_state, left - 1, memory_order_relaxed);
   }
 }
 
@@ -180,6 +259,9 @@ void video_cleanup()
 #define VID_MEMSTART 0x1000
 #define CHAR_ROMSTART 0x8000
 
+// Shows in the first character, that the CPU runs
+static uint8_t vid_heartbeat;
+
 void draw_console_toFB()
 {
   uint16_t g,h,i,j;
@@ -188,7 +270,7 @@ void draw_console_toFB()
   for (g=0; g<23; g++) {
     for (h=0; h<22; h++) {
       //
-      buf = mem[VID_MEMSTART+(22*g)+h];
+      buf = g || h ? mem[VID_MEMSTART+(22*g)+h] : vid_heartbeat;
 
       for (i=0; i<8; i++) {
         c_rom=mem[CHAR_ROMSTART+(8*buf)+i];
@@ -211,31 +293,33 @@ void draw_console_toFB()
 }
 
 // Video thread (mostly async)
-volatile uint32_t vid_state=3;
+atomic_uchar vid_state=3;
 void *videoOut()
 {
-  uint32_t old_ticks = clockticks65C02;
+  uint32_t old_ticks = mem6502_acquire(&mem_pub), ticks;
 
   // Initialize VIDEO Window/Surface
   SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS);
   video_init(window_scale,scale_quality);
 
-  vid_state=0;
-  while(runme) {
+  atomic_store_explicit(&vid_state, 0, memory_order_release);
+  sync6502_signal(&state_ev);
+  while(running()) {
+    uint32_t seq = sync6502_seq(&state_ev);
     SDL_Event ev;
     while( SDL_PollEvent( &ev ) ) {
       switch(ev.type)
       {
         case SDL_QUIT:
         {
-          runme = 0;
+          stop();
 	  break;
         }
 
         case SDL_KEYDOWN:
 	{
 	  if (ev.key.keysym.sym == SDLK_ESCAPE  )
-            runme = 0;
+            stop();
 	}
 
         case SDL_WINDOWEVENT:
@@ -259,11 +343,13 @@ void *videoOut()
 
     }
 
-    if (clockticks65C02 > old_ticks+20000) {
+    // Memory as the CPU thread published it
+    ticks = mem6502_acquire(&mem_pub);
+    if (ticks - old_ticks > 20000) {
       // Do graphics
       //
 
-      mem[VID_MEMSTART]=clockticks65C02&0xff;
+      vid_heartbeat=ticks&0xff;
 
       draw_console_toFB();
 
@@ -274,8 +360,11 @@ void *videoOut()
 
       SDL_RenderPresent(renderer);
 
-      old_ticks = clockticks65C02;
+      old_ticks = ticks;
     }
+    else
+      // Nothing to draw yet, look for events again in a while
+      sync6502_sleep(&state_ev, seq, 5 * SYNC6502_MS);
   }
 
   // Destroy VIDEO Window
@@ -293,8 +382,6 @@ uint8_t read65C02(uint16_t address)
   return mem[address];
 }
 
-uint8_t iobox = 0;
-
 // required function 
 void write65C02(uint16_t address, uint8_t value)
 {
@@ -306,11 +393,8 @@ void write65C02(uint16_t address, uint8_t value)
 
   mem[address]=value;
 
-  if (type == 2) { //Notify HW (thread)
-    mbox_data[iobox]=value;
-    io_mbox[iobox++]=address;
-    io_mbox[iobox]=0;
-  }
+  if (type == 2) //Notify HW (thread)
+    ring6502_put(&io_ring, clockticks65C02, address, value);
 }
 
 uint8_t int_active = 0;
@@ -320,19 +404,48 @@ void sig_handler(int signum){
   if (int_active)
     exit(2);
   int_active=1;
-  runme=0;
+  stop();
 }
 
+#ifndef FAKE
+// SIGUSR1 turns the bus trace on and off
+void trace_handler(int signum){
+  trace6502_enable(!trace6502_on);
+}
+
+// SIGUSR2 has main print the bus cycle profile
+volatile uint8_t profile_req = 0;
+void profile_handler(int signum){
+  profile_req=1;
+}
+#endif
+
 // Main prog
 int main(int argc, char **argv)
 {
   int addr=0;
   long g;
+  uint32_t seq;
 
   signal(SIGINT,sig_handler);
 
+  // Real-time mode, BAD6502_RT=<core> or any other value for the one
+  // rt6502_init() picks. Threads started from here on stay off that core
+  if (getenv("BAD6502_RT")) {
+    char *core = getenv("BAD6502_RT");
+    if (rt6502_init(*core >= '0' && *core <= '9' ? atoi(core) : -1) >= 0)
+      rt6502_prefault(mem, sizeof(mem));
+  }
+
 #ifdef FAKE
   printf("Running in FAKE mode !!!!!!!\n");
+#else
+  // Bus trace to $BAD6502_TRACE, decode it with cpu/trace6502dec
+  if (getenv("BAD6502_TRACE") && trace6502_open(getenv("BAD6502_TRACE"))) {
+    signal(SIGUSR1,trace_handler);
+    printf("Bus trace to %s, kill -USR1 %d starts and stops it\n", getenv("BAD6502_TRACE"), getpid());
+  }
+  signal(SIGUSR2,profile_handler);
 #endif
 
   // Set up pages and memory (1st go: all RAM)
@@ -363,50 +476,69 @@ int main(int argc, char **argv)
   for (g=0; g<test_len; g++)
     mem[0x1000+g]=test[g];
 
+#ifdef FAKE
+  // Let the fake core access RAM and ROM directly, only the I/O page needs
+  // write65C02()
+  for (g=0; g<256; g++)
+    if (page_type[g] != 2)
+      map6502(g, g, page[g], page_type[g] == 1);
+#endif
+
   //Setup threads
+  if (!ring6502_init(&io_ring, IO_RING, IO_BACKPRESSURE, &clock_ev))
+    exit(-1);
   if (pthread_create(&IOthread, NULL, updateIO, NULL)) {
     printf("thread create failed\n");
     exit(-1);
   }
-  while(!updateIO_ready);
+  sync6502_until(&state_ev, atomic_load_explicit(&updateIO_ready, memory_order_acquire), 0);
   printf("IO Thread running\n");
 
   if (pthread_create(&CPUthread, NULL, run6502, NULL)) {
     printf("thread create failed\n");
     exit(-1);
   }
-  while(run_state);
+  sync6502_until(&state_ev, !cycles_left(), 0);
   printf("CPU Thread running\n");
   
   if (pthread_create(&VIDthread, NULL, videoOut, NULL)) {
     printf("thread create failed\n");
     exit(-1);
   }
-  while(vid_state);
+  sync6502_until(&state_ev, !atomic_load_explicit(&vid_state, memory_order_acquire), 0);
   printf("VIDEO Thread running\n");
 
 
   printf("-------- START --------\n");
 
-  // Run 1Million cycles
-  for (g=0; g<1000; g++) {
-    while(run_state);
-    run_state=1000;
-    if (!runme)
+  // Run 1Million cycles, say how fast every second
+  atomic_store_explicit(&run_state, 1000000, memory_order_release);
+  sync6502_signal(&state_ev);
+  for (g=1; ; g++) {
+    seq = sync6502_seq(&state_ev);
+    if (!cycles_left() || !running())
       break;
+    sync6502_sleep(&state_ev, seq, 100 * SYNC6502_MS);
+#ifndef FAKE
+    if (profile_req) {
+      profile_req=0;
+      profile65C02();
+    }
+#endif
+    if (g % 10 == 0)
+      printf("\n%.4f MHz\n", pace6502_mhz(&pace, clockticks65C02));
   }
 
   printf("\n\nExecution stopped.");
+  printf(" Slept %u times (%llu ms), ran late %u, gave up %llu ms %u times\n",
+         pace.sleeps, (unsigned long long)pace.slept / 1000000, pace.late,
+         (unsigned long long)pace.given / 1000000, pace.lost);
 
   //
   // Shutdown
   //
 
-  runme=0;
-  usleep(100);
-  //Unstick threads that are waiting on a clock cycle
-  clockticks65C02++;
-  run_state=1;
+  stop();
 
   printf("Stopping VIDEO thread\n");
   pthread_join(VIDthread,NULL);
@@ -414,6 +546,12 @@ int main(int argc, char **argv)
   pthread_join(IOthread,NULL);
   printf("Stopping CPU thread\n");
   pthread_join(CPUthread,NULL);
+  rt6502_print(&step_time, "step65C02()");
+  ring6502_print(&io_ring, "I/O writes");
+#ifndef FAKE
+  trace6502_close();
+  profile65C02();
+#endif
 
   usleep(100);
   return 0;
@@ -28,6 +28,13 @@
 #include <unistd.h>
 
 #include "bad65C02.h"
+#include "trace6502.h"
+#ifdef GPIO_SIM
+#include "gpiosim.h"
+#endif
+#ifdef BUS_PROFILE
+#include "rt6502.h"
+#endif
 
 #define PAGE_SIZE (4*1024)
 #define BLOCK_SIZE (4*1024)
@@ -38,32 +45,78 @@ void *gpio_map;
 // I/O access
 volatile unsigned *gpio;
 
+// Register access. Straight to the mapped registers, or with -DGPIO_SIM to
+// the simulated ones in gpiosim.c, which have a software 65C02 on the pins
+#ifdef GPIO_SIM
+#define GPIO_RD(r) gpiosim_read(r)
+#define GPIO_WR(r,v) gpiosim_write(r,v)
+#else
+#define GPIO_RD(r) (*(gpio+(r)))
+#define GPIO_WR(r,v) (*(gpio+(r)) = (v))
+#endif
+
 // GPIO setup macros. Always use INP_GPIO(x) before using OUT_GPIO(x) or SET_GPIO_ALT(x,y)
-#define INP_GPIO(g) *(gpio+((g)/10)) &= ~(7<<(((g)%10)*3))
-#define OUT_GPIO(g) *(gpio+((g)/10)) |=  (1<<(((g)%10)*3))
-#define SET_GPIO_ALT(g,a) *(gpio+(((g)/10))) |= (((a)<=3?(a)+4:(a)==4?3:2)<<(((g)%10)*3))
+#define INP_GPIO(g) GPIO_WR((g)/10, GPIO_RD((g)/10) & ~(7<<(((g)%10)*3)))
+#define OUT_GPIO(g) GPIO_WR((g)/10, GPIO_RD((g)/10) |  (1<<(((g)%10)*3)))
+#define SET_GPIO_ALT(g,a) GPIO_WR((g)/10, GPIO_RD((g)/10) | (((a)<=3?(a)+4:(a)==4?3:2)<<(((g)%10)*3)))
 
-#define GPIO_SET *(gpio+7)  // sets   bits which are 1 ignores bits which are 0
-#define GPIO_CLR *(gpio+10) // clears bits which are 1 ignores bits which are 0
+#define GPIO_FSEL0(v) GPIO_WR(0,v) // function of pins 0-9, the data bus is 0-7
+#define GPIO_SET(v) GPIO_WR(7,v)  // sets   bits which are 1 ignores bits which are 0
+#define GPIO_CLR(v) GPIO_WR(10,v) // clears bits which are 1 ignores bits which are 0
 
-#define GET_GPIO(g) (*(gpio+13)&(1<<g)) // 0 if LOW, (1<<g) if HIGH
+#define GET_GPIO(g) (GPIO_RD(13)&(1<<g)) // 0 if LOW, (1<<g) if HIGH
 
-#define GPIO_PULL *(gpio+37) // Pull up/pull down
-#define GPIO_PULLCLK0 *(gpio+38) // Pull up/pull down clock
+#define GPIO_PULL(v) GPIO_WR(37,v) // Pull up/pull down
+#define GPIO_PULLCLK0(v) GPIO_WR(38,v) // Pull up/pull down clock
 
-#define GET_ADDR (*(gpio+13)>>8)&0xFFFF
-#define GET_DATA (*(gpio+13))&0xFF
-#define GET_RW (*(gpio+13))&(1<<24)
-#define GET_ALL_GPIO (*(gpio+13))
+#define GET_ADDR (GPIO_RD(13)>>8)&0xFFFF
+#define GET_DATA (GPIO_RD(13))&0xFF
+#define GET_RW (GPIO_RD(13))&(1<<24)
+#define GET_ALL_GPIO (GPIO_RD(13))
 
 // Local helpers 
 void setup_io();
 void nsleep(int);
 void one_clock();
+static void calibrate();
 
 // ndelay is a define so the compiler can unroll it ;-)
 #define ndelay(x) for(int i=0;i<x;i++)asm("nop");
 
+// Bus timing. Every phase of a bus cycle waits for the W65C02S AC
+// characteristics (3.3V, ns rounded up), scaled by bus_percent, or for half
+// a period of the target clock if that's longer. Counted in ndelay() loops
+// and GPIO accesses, calibrate() measures how long those take.
+#define T_PW  65  // clock low and high time
+#define T_ADS 40  // address and R/W valid after clock low
+#define T_MDS 40  // write data valid after clock high
+#define T_DSR 15  // read data setup before clock low
+
+// Target clock in Hz, 0 = find the fastest stable one with stress65C02()
+#ifndef BUS_CLOCK
+#define BUS_CLOCK 0
+#endif
+
+#define CAL_LOOPS     10000000
+#define CAL_ACCESSES  1000000
+// stress65C02() policy: a step only passes with STRESS_ROUNDS rounds of
+// STRESS_CYCLES in a row. It settles STRESS_MARGIN percentage points above
+// the fastest step that passed, never below STRESS_FLOOR percent of the
+// datasheet timings, and only once STRESS_SOAK rounds in a row pass there.
+// Failing that it backs off 10 points at a time up to STRESS_MAX, and
+// past that it falls back to the datasheet timings, unverified.
+#define STRESS_CYCLES 100000
+#define STRESS_ROUNDS 3
+#define STRESS_SOAK   20
+#define STRESS_MARGIN 20  // percentage points
+#define STRESS_FLOOR  50  // percent
+#define STRESS_MAX    300 // percent
+
+static double loop_ns, access_ns;
+static uint32_t bus_hz = BUS_CLOCK;
+static uint32_t bus_percent = 100;
+static uint32_t delay_addr, delay_read, delay_write;
+
 // Defined elsewehere (hopefully)
 extern uint8_t read65C02(uint16_t address);
 extern void write65C02(uint16_t address, uint8_t value);
@@ -83,8 +136,19 @@ uint8_t sp,a,x,y,status;
 #define _65C02_gpio_data_w 0x249249
 
 volatile uint8_t _65C02irq = 0;
+volatile uint8_t _65C02nmi = 0;
 volatile uint8_t _65C02reset = 0;
 
+// Interrupt lines, one bit per device holding them low, and the level the
+// pins are driven to right now
+volatile uint32_t _65C02irqline = 0;
+volatile uint32_t _65C02nmiline = 0;
+uint8_t _65C02irqlow = 0;
+uint8_t _65C02nmilow = 0;
+
+// The board has no GPIO left for !NMI. Wire it to one and build with
+// -DGPIO_NMI=<pin> to get NMIs, they're dropped otherwise.
+
 void init65C02()
 {
   int g;
@@ -116,39 +180,118 @@ void init65C02()
   // Set GPIO pins 26 to output (!RESET)
   INP_GPIO(26);
   OUT_GPIO(26);
-  GPIO_SET = 1<<26; //release !RESET
+  GPIO_SET(1<<26); //release !RESET
 
   // Set GPIO pins 27 to output (!IRQ)
   INP_GPIO(27);
   OUT_GPIO(27);
-  GPIO_SET = 1<<27; //release !IRQ
+  GPIO_SET(1<<27); //release !IRQ
+
+#ifdef GPIO_NMI
+  // Set the !NMI GPIO to output
+  INP_GPIO(GPIO_NMI);
+  OUT_GPIO(GPIO_NMI);
+  GPIO_SET(1<<GPIO_NMI); //release !NMI
+#endif
  
   proc_init_done = 1; 
+
+  calibrate();
+  if (bus_hz)
+    clock65C02(bus_hz);
+  else
+    stress65C02();
 }
 
 uint32_t bus_data = 0;
 uint32_t bus_rw = 0;
 uint32_t bus_addr = 0;
 
-void step65C02() 
+#ifdef BUS_PROFILE
+// Bus cycle profile: how long each phase of a step65C02() cycle took, and
+// the slowest cycles with where they went. Only the CPU thread writes it,
+// profile65C02() reads it as it is.
+enum { PH_LOW, PH_UPDATE, PH_ADDR, PH_READ, PH_WRITE, PH_DATA, PH_LINES, PH_CYCLE, PHASES };
+static const char *phasename[PHASES] = {
+  "clock low", "update65C02()", "address", "read65C02()", "write65C02()", "data", "lines", "bus cycle"
+};
+static rt6502_hist_t phase[PHASES];
+
+#define SLOWEST 16
+static struct {
+  uint32_t tick;
+  uint16_t addr;
+  uint8_t rw;
+  uint64_t t[PHASES];
+} slowest[SLOWEST];
+static uint64_t slowfloor; // the fastest of them
+
+// Slowest read and write handler per page
+static uint64_t pageread[256], pagewrite[256];
+
+static void __attribute__((noinline)) profiled(uint64_t *t)
 {
-  //TODO: The delays need to be optimized (scoped)
-  //If you think it's odd that we'reading io twice ... it's a pi bug.
+  int n, g;
+
+  for (n=0; n<PHASES; n++)
+    if (t[n] || n == PH_LOW || n == PH_DATA)
+      rt6502_hist(&phase[n], t[n]);
+
+  if (bus_rw && t[PH_READ] > pageread[bus_addr >> 8])
+    pageread[bus_addr >> 8] = t[PH_READ];
+  if (!bus_rw && t[PH_WRITE] > pagewrite[bus_addr >> 8])
+    pagewrite[bus_addr >> 8] = t[PH_WRITE];
+
+  if (t[PH_CYCLE] <= slowfloor)
+    return;
+  for (n=0, g=1; g<SLOWEST; g++)
+    if (slowest[g].t[PH_CYCLE] < slowest[n].t[PH_CYCLE])
+      n = g;
+  slowest[n].tick = clockticks65C02;
+  slowest[n].addr = bus_addr;
+  slowest[n].rw = bus_rw != 0;
+  for (g=0; g<PHASES; g++)
+    slowest[n].t[g] = t[g];
+  for (slowfloor=slowest[0].t[PH_CYCLE], g=1; g<SLOWEST; g++)
+    if (slowest[g].t[PH_CYCLE] < slowfloor)
+      slowfloor = slowest[g].t[PH_CYCLE];
+}
+
+// Time since the last phase boundary goes to phase n
+#define PHASE(n) if (profile) { t1 = rt6502_now(); t[n] += t1 - t0; t0 = t1; }
+#else
+#define PHASE(n)
+#endif
+
+// One bus cycle, inlined into step65C02() and the stress test with their
+// own memory and clock low work. With -DBUS_PROFILE and profile set it
+// times its phases.
+static inline __attribute__((always_inline)) void buscycle(
+    uint8_t (*read)(uint16_t), void (*write)(uint16_t, uint8_t), void (*update)(), int profile)
+{
+  uint32_t bus_all;
+#ifdef BUS_PROFILE
+  uint64_t t[PHASES] = { 0 }, t0 = 0, t1, start = 0;
+
+  if (profile)
+    start = t0 = rt6502_now();
+#endif
 
   // Clock cycle start (clock goes low)
-  GPIO_CLR = 1<<25;
-  GPIO_CLR = 1<<25;
+  GPIO_CLR(1<<25);
 
-  // wait the setup time to read the next addr
-  ndelay(10);
+  // wait the setup time to read the next addr. This used to be done by
+  // reading io twice (a pi bug), the delay includes one access for it.
+  ndelay(delay_addr);
+  PHASE(PH_LOW);
   // STEP callback (in cpu thread)
-  update65C02();
+  update();
+  PHASE(PH_UPDATE);
 
   // Address and RW stable
-  bus_addr = GET_ADDR;
-  bus_addr = GET_ADDR;
-  bus_rw = GET_RW;
-  bus_rw = GET_RW;
+  bus_all = GET_ALL_GPIO;
+  bus_addr = (bus_all>>8)&0xFFFF;
+  bus_rw = bus_all&(1<<24);
 
   // If there's real hardware at this address then dont
   // do anything to drive the data lines, keep reading
@@ -156,43 +299,82 @@ void step65C02()
   //bus_rw = _isHW(&bus_addr,&bus_rw);
 
   // 2nd part of clock cycle (clock goes high)
-  GPIO_SET = 1<<25;
-  GPIO_SET = 1<<25;
-
-  // Set DATA to INP or OUT based on RW
-  *(gpio) = _65C02_gpio_data_r;
-  if (bus_rw) {
-    *(gpio) = _65C02_gpio_data_w;
-  }
+  GPIO_SET(1<<25);
+  PHASE(PH_ADDR);
 
   if (bus_rw) {
     //write to 65C02
-    GPIO_SET=0xFF;
-    GPIO_CLR=~read65C02(bus_addr)&0xFF;
-    ndelay(50);
+    GPIO_FSEL0(_65C02_gpio_data_w);
+    GPIO_SET(0xFF);
+    PHASE(PH_DATA);
+    bus_data = read(bus_addr);
+    PHASE(PH_READ);
+    GPIO_CLR(~bus_data&0xFF);
+    ndelay(delay_read);
+    PHASE(PH_DATA);
   }
   else {
-    ndelay(10);
     //read from 5C02
+    GPIO_FSEL0(_65C02_gpio_data_r);
+    ndelay(delay_write);
     bus_data=GET_DATA;
-    bus_data=GET_DATA;
-    write65C02(bus_addr, bus_data);
+    PHASE(PH_DATA);
+    write(bus_addr, bus_data);
+    PHASE(PH_WRITE);
   }
 
-  // reset HW signal lines
+  // reset HW signal lines, !IRQ and !NMI stay low while a device holds
+  // them. The pins are only written when their level changes
   if (_65C02irq) {
-    GPIO_SET = 1<<27; //release !IRQ
+    _65C02irqlow = 1; //pulled by irq65C02()
     _65C02irq = 0;
   }
+  if ((_65C02irqline != 0) != _65C02irqlow) {
+    _65C02irqlow = !_65C02irqlow;
+    if (_65C02irqlow)
+      GPIO_CLR(1<<27); //set !IRQ
+    else
+      GPIO_SET(1<<27); //release !IRQ
+  }
+
+#ifdef GPIO_NMI
+  if (_65C02nmi) {
+    _65C02nmilow = 1; //pulled by nmi65C02()
+    _65C02nmi = 0;
+  }
+  if ((_65C02nmiline != 0) != _65C02nmilow) {
+    _65C02nmilow = !_65C02nmilow;
+    if (_65C02nmilow)
+      GPIO_CLR(1<<GPIO_NMI); //set !NMI
+    else
+      GPIO_SET(1<<GPIO_NMI); //release !NMI
+  }
+#endif
 
   if (_65C02reset) {
-    GPIO_SET = 1<<26; //release !RESET
+    GPIO_SET(1<<26); //release !RESET
     _65C02reset = 0;
   }
 
   clockticks65C02++;
   pc=bus_addr;
 
+#ifdef BUS_PROFILE
+  if (profile) {
+    PHASE(PH_LINES);
+    t[PH_CYCLE] = t0 - start;
+    profiled(t);
+  }
+#endif
+}
+
+void step65C02() 
+{
+  buscycle(read65C02, write65C02, update65C02, 1);
+  trace6502(clockticks65C02, bus_addr,
+            (bus_rw ? TRACE6502_READ : 0) | (_65C02irqlow ? TRACE6502_IRQ : 0) | (_65C02nmilow ? TRACE6502_NMI : 0),
+            bus_data);
+
 #ifdef DEBUG
 #ifndef DEBUGDELAY
 #define DEBUGDELAY 20000
@@ -212,7 +394,7 @@ void step65C02()
   printf(", ");
 
   if (bus_rw)
-    printf("r <- M=0x%02x", read65C02(bus_addr));
+    printf("r <- M=0x%02x", bus_data);
   else
     printf("w -> D=0x%02x", bus_data);
 
@@ -220,6 +402,248 @@ void step65C02()
 #endif
 }
 
+void profile65C02()
+{
+#ifdef BUS_PROFILE
+  uint64_t slow[256];
+  int n, g, top, order[SLOWEST];
+
+  printf("---- bus cycle profile, %u cycles\n", clockticks65C02);
+  for (n=0; n<PHASES; n++)
+    rt6502_print(&phase[n], phasename[n]);
+
+  // Slowest first
+  for (n=0; n<SLOWEST; n++)
+    order[n] = n;
+  for (n=0; n<SLOWEST; n++)
+    for (g=n+1; g<SLOWEST; g++)
+      if (slowest[order[g]].t[PH_CYCLE] > slowest[order[n]].t[PH_CYCLE]) {
+        top = order[n];
+        order[n] = order[g];
+        order[g] = top;
+      }
+  printf("Slowest cycles (ns):\n");
+  for (n=0; n<SLOWEST; n++) {
+    top = order[n];
+    if (!slowest[top].t[PH_CYCLE])
+      break;
+    printf("  %10u %04X %c %8.0f:", slowest[top].tick, slowest[top].addr, slowest[top].rw ? 'R' : 'W',
+           rt6502_ns(slowest[top].t[PH_CYCLE]));
+    for (g=0; g<PH_CYCLE; g++)
+      if (slowest[top].t[g])
+        printf(" %s %.0f", phasename[g], rt6502_ns(slowest[top].t[g]));
+    printf("\n");
+  }
+
+  // The eight pages with the slowest handlers
+  printf("Slowest handlers per page (ns):\n");
+  for (g=0; g<256; g++)
+    slow[g] = pageread[g] > pagewrite[g] ? pageread[g] : pagewrite[g];
+  for (n=0; n<8; n++) {
+    for (top=0, g=1; g<256; g++)
+      if (slow[g] > slow[top])
+        top = g;
+    if (!slow[top])
+      break;
+    printf("  $%02Xxx  read %8.0f  write %8.0f\n", top,
+           rt6502_ns(pageread[top]), rt6502_ns(pagewrite[top]));
+    slow[top] = 0;
+  }
+#endif
+}
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// How long an ndelay() loop and a GPIO register access take
+static void calibrate()
+{
+  volatile uint32_t cal = CAL_LOOPS;
+  uint32_t n = cal, g;
+  double t;
+
+  t = now();
+  ndelay(n);
+  loop_ns = (now() - t) / n;
+
+  t = now();
+  for (g=0; g<CAL_ACCESSES; g++)
+    (void)GET_ALL_GPIO;
+  access_ns = (now() - t) / CAL_ACCESSES;
+}
+
+static uint32_t loops(double ns)
+{
+  return ns > 0 ? (uint32_t)(ns / loop_ns + 0.999) : 0;
+}
+
+static double maxns(double a, double b, double c)
+{
+  return a > b ? (a > c ? a : c) : (b > c ? b : c);
+}
+
+// Delays for bus_hz and bus_percent, and the clock they should give
+static uint32_t bustiming()
+{
+  double half = bus_hz ? 1e9 / bus_hz / 2 : 0;
+  double scale = bus_percent / 100.0;
+  double low, high;
+
+  // Low: clear clock, delay, read. High, CPU reads: set clock, FSEL, two
+  // data writes, delay. High, CPU writes: set clock, FSEL, delay, read.
+  delay_addr = loops(maxns((T_ADS + access_ns) * scale, T_PW * scale - 2 * access_ns, half - 2 * access_ns));
+  delay_read = loops(maxns(T_DSR * scale, T_PW * scale - 4 * access_ns, half - 4 * access_ns));
+  delay_write = loops(maxns((T_MDS + access_ns) * scale, T_PW * scale - 3 * access_ns, half - 3 * access_ns));
+
+  low = 2 * access_ns + delay_addr * loop_ns;
+  high = delay_read * loop_ns + 4 * access_ns;
+  if (delay_write * loop_ns + 3 * access_ns > high)
+    high = delay_write * loop_ns + 3 * access_ns;
+  return 1e9 / (low + high);
+}
+
+uint32_t clock65C02(uint32_t hz)
+{
+  uint32_t clock;
+
+  bus_hz = hz;
+  bus_percent = 100;
+  clock = bustiming();
+  printf("bad65C02: bus clock %u Hz, delays %u/%u/%u\n", clock, delay_addr, delay_read, delay_write);
+  return clock;
+}
+
+// Stress test program, LDA #n / STA $0200 / JMP $1000 with a new n every
+// time and every write checked. Reads outside of it once the reset vector
+// is read, and writes anywhere else, are errors too.
+static uint8_t stress_value;
+static uint32_t stress_next, stress_checks, stress_errors;
+static int stress_started;
+
+static uint8_t stressread(uint16_t address)
+{
+  static const uint8_t prog[8] = { 0xA9, 0x00, 0x8D, 0x00, 0x02, 0x4C, 0x00, 0x10 };
+
+  if (address == 0xFFFC)
+    return 0x00;
+  if (address == 0xFFFD) {
+    stress_started = 1;
+    return 0x10;
+  }
+  if (address >= 0x1000 && address < 0x1008) {
+    if (address == 0x1001)
+      return stress_value = (stress_next++ * 0x9D) ^ 0x55; //every value, all bits toggling
+    return prog[address - 0x1000];
+  }
+  if (stress_started)
+    stress_errors++;
+  return 0xEA;
+}
+
+static void stresswrite(uint16_t address, uint8_t value)
+{
+  if (address != 0x0200 || value != stress_value)
+    stress_errors++;
+  stress_checks++;
+}
+
+static void stressupdate()
+{
+}
+
+// One round at the current timings, returns the clock if the CPU read
+// back everything it was fed, 0 otherwise
+static uint32_t stressround()
+{
+  uint32_t g;
+  double t;
+
+  stress_checks = stress_errors = stress_started = 0;
+  GPIO_CLR(1<<26); //set !RESET
+  _65C02reset = 1;
+  for (g=0; g<16; g++)
+    buscycle(stressread, stresswrite, stressupdate, 0);
+
+  t = now();
+  for (g=0; g<STRESS_CYCLES; g++)
+    buscycle(stressread, stresswrite, stressupdate, 0);
+  t = now() - t;
+
+  // 9 cycles per loop
+  if (stress_errors || stress_checks < STRESS_CYCLES / 9 - 1)
+    return 0;
+  return STRESS_CYCLES / t * 1e9;
+}
+
+// rounds in a row at the current timings, returns the slowest clock or 0
+// if any of them failed
+static uint32_t stressrounds(int rounds)
+{
+  uint32_t clock, slowest = 0;
+
+  while (rounds--) {
+    if (!(clock = stressround()))
+      return 0;
+    if (!slowest || clock < slowest)
+      slowest = clock;
+  }
+  return slowest;
+}
+
+uint32_t stress65C02()
+{
+  uint32_t clock, best_percent = 0;
+  int passed = 0;
+
+  if (!proc_init_done)
+    init65C02();
+
+  // As fast as the timings allow, then shrink them, down to no delays at
+  // all, until the CPU fails
+  bus_hz = 0;
+  for (bus_percent = 200; ; bus_percent -= 10) {
+    bustiming();
+    clock = stressrounds(STRESS_ROUNDS);
+    printf("bad65C02: stress %3u%% of the datasheet timings, %s %u Hz\n",
+           bus_percent, clock ? "passed at" : "FAILED at", clock);
+    if (!clock)
+      break;
+    passed = 1;
+    best_percent = bus_percent;
+    if (!bus_percent || !(delay_addr | delay_read | delay_write))
+      break;
+  }
+
+  if (!passed) {
+    printf("bad65C02: the bus fails even at 200%% of the datasheet timings\n");
+    best_percent = 200;
+  }
+
+  // Settle with the margin, and back off until a soak there passes
+  bus_percent = best_percent + STRESS_MARGIN;
+  if (bus_percent < STRESS_FLOOR)
+    bus_percent = STRESS_FLOOR;
+  for (; bus_percent <= STRESS_MAX; bus_percent += 10) {
+    bustiming();
+    if ((clock = stressrounds(STRESS_SOAK))) {
+      printf("bad65C02: bus clock %u Hz at %u%% of the datasheet timings, delays %u/%u/%u\n",
+             clock, bus_percent, delay_addr, delay_read, delay_write);
+      return clock;
+    }
+    printf("bad65C02: soak FAILED at %u%% of the datasheet timings\n", bus_percent);
+  }
+
+  bus_percent = 100;
+  bustiming();
+  printf("bad65C02: WARNING: the bus fails at every timing up to %u%%, running UNVERIFIED "
+         "at the datasheet timings, delays %u/%u/%u\n", STRESS_MAX, delay_addr, delay_read, delay_write);
+  return 0;
+}
+
 void exec65C02(uint32_t tickcount)
 {
   uint32_t g;
@@ -237,7 +661,7 @@ void reset65C02()
     init65C02();
 
   // Perform 6502 reset
-  GPIO_CLR = 1<<26; //set !RESET
+  GPIO_CLR(1<<26); //set !RESET
   _65C02reset = 1;
   clockticks65C02 = 0;
 }
@@ -249,15 +673,49 @@ void irq65C02()
 #endif
 
   // Perform 6502 irq
-  GPIO_CLR = 1<<27; //set !IRQ
+  GPIO_CLR(1<<27); //set !IRQ
   _65C02irq=1;
 }
 
+void nmi65C02()
+{
+#ifdef DEBUG
+  printf("NMI65C05\n");
+#endif
+
+#ifdef GPIO_NMI
+  // Perform 6502 nmi
+  GPIO_CLR(1<<GPIO_NMI); //set !NMI
+  _65C02nmi=1;
+#endif
+}
+
+void irqline65C02(uint32_t source, int level)
+{
+  if (level)
+    __atomic_or_fetch(&_65C02irqline, source, __ATOMIC_ACQ_REL);
+  else
+    __atomic_and_fetch(&_65C02irqline, ~source, __ATOMIC_ACQ_REL);
+}
+
+void nmiline65C02(uint32_t source, int level)
+{
+  if (level)
+    __atomic_or_fetch(&_65C02nmiline, source, __ATOMIC_ACQ_REL);
+  else
+    __atomic_and_fetch(&_65C02nmiline, ~source, __ATOMIC_ACQ_REL);
+}
+
 //
 // Set up a memory regions to access GPIO
 //
 void setup_io()
 {
+#ifdef GPIO_SIM
+   gpiosim_init();
+   return;
+#endif
+
    /* open /dev/mem */
    if ((mem_fd = open("/dev/mem", O_RDWR|O_SYNC) ) < 0) {
       printf("can't open /dev/mem \n");
@@ -269,7 +727,7 @@ void setup_io()
       NULL, 
       BLOCK_SIZE,
       PROT_READ|PROT_WRITE,
-      MAP_SHARED,
+      MAP_SHARED|MAP_POPULATE, // no page fault on the first access
       mem_fd,
       GPIO_BASE
    );
@@ -306,10 +764,10 @@ void nsleep(int nanos)
 // one_clock: do one clock cycle (ignore everything)
 void one_clock()
 {
-  GPIO_CLR = 1<<25;
+  GPIO_CLR(1<<25);
   nsleep(500);
 
-  GPIO_SET = 1<<25;
+  GPIO_SET(1<<25);
   nsleep(500);
 }
 
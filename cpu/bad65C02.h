@@ -7,6 +7,35 @@ extern void reset65C02();
 extern void step65C02();
 extern void exec65C02(uint32_t tickcount);
 extern void irq65C02();
+extern void nmi65C02();
+
+// Wired-OR !IRQ and !NMI: every device owns one bit of source and asserts
+// (level = 1) or releases (level = 0) it, from any thread. The line is low
+// while any source holds it, step65C02() drives the pin once per cycle.
+// irq65C02()/nmi65C02() pull it for a single cycle.
+extern void irqline65C02(uint32_t source, int level);
+extern void nmiline65C02(uint32_t source, int level);
+
+// Bus clock. The first reset measures how fast the host runs the delay
+// loops and GPIO accesses and sets the bus up for -DBUS_CLOCK=<Hz>, or by
+// default for the fastest clock stress65C02() finds. clock65C02() asks for
+// another clock (0 = as fast as the datasheet timings allow) and returns
+// the one the bus should get. stress65C02() runs a test program on the CPU
+// that checks every byte it reads back, shrinks the timings until it fails
+// and settles with some margin over the last that passed, once a longer
+// run passes there (see STRESS_MARGIN in bad65C02.c). It returns the
+// measured clock, or 0 when nothing passed and the bus runs unverified at
+// the datasheet timings. Reset the CPU after it.
+extern uint32_t clock65C02(uint32_t hz);
+extern uint32_t stress65C02();
+
+// Bus cycle profile, built with -DBUS_PROFILE: how long each phase of the
+// step65C02() cycles took (clock low, update65C02(), the handlers, ...),
+// the slowest cycles and the pages with the slowest handlers. Call it from
+// any thread but the one running step65C02(), prints nothing without
+// -DBUS_PROFILE.
+extern void profile65C02();
+
 extern volatile uint32_t clockticks65C02;
 
 #endif
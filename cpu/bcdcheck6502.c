@@ -0,0 +1,190 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// bcdcheck6502: decimal mode ADC and SBC of the fake core, exhaustively
+//
+// Built for one variant (-DFAKE6502_NMOS or -DFAKE6502_65C02, the same as
+// the core it's linked with). Every carry in, accumulator and operand goes
+// through ADC and SBC with D set, immediate and absolute, once run by the
+// interpreter (cpu6502_step(), the bcdadc/bcdsbc tables) and once cycle by
+// cycle (cpu6502_cycle(), the micro programs). A, N, V, Z, C and the
+// cycles taken are compared with a plain implementation of the rules in
+// Bruce Clark's "Decimal Mode" tutorial (6502.org, appendix A), invalid
+// BCD operands included:
+//  - NMOS: Z from the binary result, N and V from the high nibble sum
+//    (ADC), every flag from the binary result (SBC). No extra cycle.
+//  - 65C02: N and Z from the decimal result, C and V like NMOS, one
+//    extra cycle.
+//
+// usage: bcdcheck6502
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "fake6502.h"
+
+#if defined(FAKE6502_NMOS)
+#define VARIANT "NMOS"
+#elif defined(FAKE6502_65C02)
+#define VARIANT "65C02"
+#else
+#error "bcdcheck6502 needs -DFAKE6502_NMOS or -DFAKE6502_65C02"
+#endif
+
+#define FLAG_CARRY     0x01
+#define FLAG_ZERO      0x02
+#define FLAG_INTERRUPT 0x04
+#define FLAG_DECIMAL   0x08
+#define FLAG_CONSTANT  0x20
+#define FLAG_OVERFLOW  0x40
+#define FLAG_SIGN      0x80
+#define FLAGS (FLAG_SIGN | FLAG_OVERFLOW | FLAG_ZERO | FLAG_CARRY)
+#define FIXED (FLAG_CONSTANT | FLAG_DECIMAL | FLAG_INTERRUPT) // untouched
+
+#define CODE    0x0200
+#define OPERAND 0x0300
+
+static uint8_t mem[0x10000];
+static uint32_t cases, failed;
+
+static uint8_t rd(void *userdata, uint16_t address)
+{
+  return mem[address];
+}
+
+static void wr(void *userdata, uint16_t address, uint8_t value)
+{
+  mem[address] = value;
+}
+
+// The reference: new A in the low byte, N, V, Z and C in the high byte
+static uint16_t refadc(int a, int b, int c)
+{
+  int lo, sum, hi, p;
+
+  // Sequence 1, the accumulator and C
+  lo = (a & 0x0F) + (b & 0x0F) + c;
+  if (lo >= 0x0A)
+    lo = ((lo + 0x06) & 0x0F) + 0x10;
+  sum = (a & 0xF0) + (b & 0xF0) + lo;
+  if (sum >= 0xA0)
+    sum += 0x60;
+  // Sequence 2, N and V from the signed sum before the high adjustment
+  hi = (int8_t)(a & 0xF0) + (int8_t)(b & 0xF0) + lo;
+
+  p = (sum >= 0x100 ? FLAG_CARRY : 0) | (hi < -128 || hi > 127 ? FLAG_OVERFLOW : 0);
+#ifdef FAKE6502_65C02
+  p |= (sum & 0x80 ? FLAG_SIGN : 0) | ((sum & 0xFF) == 0 ? FLAG_ZERO : 0);
+#else
+  p |= (hi & 0x80 ? FLAG_SIGN : 0) | (((a + b + c) & 0xFF) == 0 ? FLAG_ZERO : 0);
+#endif
+  return (sum & 0xFF) | (p << 8);
+}
+
+static uint16_t refsbc(int a, int b, int c)
+{
+  int lo, diff, bin, p;
+
+  bin = a - b + c - 1;
+  lo = (a & 0x0F) - (b & 0x0F) + c - 1;
+#ifdef FAKE6502_65C02
+  // Sequence 4
+  diff = bin;
+  if (diff < 0)
+    diff -= 0x60;
+  if (lo < 0)
+    diff -= 0x06;
+#else
+  // Sequence 3
+  if (lo < 0)
+    lo = ((lo - 0x06) & 0x0F) - 0x10;
+  diff = (a & 0xF0) - (b & 0xF0) + lo;
+  if (diff < 0)
+    diff -= 0x60;
+#endif
+
+  // C and V from the binary subtraction on both
+  p = (bin >= 0 ? FLAG_CARRY : 0) | ((a ^ b) & (a ^ bin) & 0x80 ? FLAG_OVERFLOW : 0);
+#ifdef FAKE6502_65C02
+  p |= (diff & 0x80 ? FLAG_SIGN : 0) | ((diff & 0xFF) == 0 ? FLAG_ZERO : 0);
+#else
+  p |= (bin & 0x80 ? FLAG_SIGN : 0) | ((bin & 0xFF) == 0 ? FLAG_ZERO : 0);
+#endif
+  return (diff & 0xFF) | (p << 8);
+}
+
+// One instruction at CODE, by the interpreter or cycle by cycle
+static void run(cpu6502_t *c, const char *name, int cycle, uint8_t opcode,
+                int carry, int a, int b, uint16_t expect, uint32_t cycles)
+{
+  uint32_t clk, ins;
+  uint8_t p;
+
+  mem[CODE] = opcode;
+  mem[CODE + 1] = (opcode & 0x0F) == 0x09 ? b : OPERAND & 0xFF;
+  mem[CODE + 2] = OPERAND >> 8;
+  mem[OPERAND] = b;
+  c->pc = CODE;
+  c->a = a;
+  // I set so nothing comes in between, N, V and Z the opposite of what
+  // they should end up as
+  c->status = FIXED | carry | (~expect >> 8 & (FLAG_SIGN | FLAG_OVERFLOW | FLAG_ZERO));
+  clk = c->clockticks;
+  ins = c->instructions;
+  if (cycle)
+    do
+      cpu6502_cycle(c);
+    while (c->instructions == ins);
+  else
+    cpu6502_step(c);
+  cases++;
+
+  p = c->status;
+  if (c->a == (expect & 0xFF) && (p & FLAGS) == expect >> 8 && (p & ~FLAGS) == FIXED &&
+      c->clockticks - clk == cycles && c->pc == CODE + ((opcode & 0x0F) == 0x09 ? 2 : 3))
+    return;
+  if (failed++ < 10)
+    printf("%s %s $%02X C=%d A=%02X op=%02X: got A=%02X P=%02X %u cycles, want A=%02X P=%02X %u cycles\n",
+           name, cycle ? "cycle" : "step", opcode, carry, a, b, c->a, p, c->clockticks - clk,
+           expect & 0xFF, (expect >> 8) | FIXED, cycles);
+}
+
+int main()
+{
+  static const uint8_t adc[] = { 0x69, 0x6D }, sbc[] = { 0xE9, 0xED };
+  cpu6502_t cpu;
+  int cycle, mode, carry, a, b;
+#ifdef FAKE6502_65C02
+  int extra = 1;
+#else
+  int extra = 0;
+#endif
+
+  cpu6502_init(&cpu, rd, wr, NULL);
+  for (cycle=0; cycle<2; cycle++)
+    for (mode=0; mode<2; mode++)
+      for (carry=0; carry<2; carry++)
+        for (a=0; a<256; a++)
+          for (b=0; b<256; b++) {
+            run(&cpu, "ADC", cycle, adc[mode], carry, a, b, refadc(a, b, carry), 2 + mode * 2 + extra);
+            run(&cpu, "SBC", cycle, sbc[mode], carry, a, b, refsbc(a, b, carry), 2 + mode * 2 + extra);
+          }
+
+  printf("bcdcheck6502: %s decimal ADC/SBC, %u cases, %u failed  %s\n",
+         VARIANT, cases, failed, failed ? "FAILED" : "OK");
+  return failed != 0;
+}
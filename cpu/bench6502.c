@@ -0,0 +1,226 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// bench6502: headless CPU core benchmark
+//
+// Boots the VIC-20 KERNAL and BASIC ROMs to READY, types RUN into the
+// keyboard buffer for a small BASIC loop and then times the core for a
+// fixed number of clock ticks. 'make bench' links this against each core.
+// With BENCH_65C02 the core is the bus driver of the board, bad65C02.c,
+// on the simulated GPIO block of gpiosim.c.
+//
+// usage: bench6502 [million ticks]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "../vic20/roms/basic.901486-01.h"
+#include "../vic20/roms/kernal.901486-06.h"
+
+#ifndef BENCH_CORE
+#define BENCH_CORE "fake6502"
+#endif
+
+#define BOOT_TICKS 3000000
+#define CHAR_ROMSTART 0x8000
+
+#ifdef BENCH_65C02
+#include "bad65C02.h"
+#include "gpiosim.h"
+#define reset6502 reset65C02
+#define exec6502 exec65C02
+#define clockticks6502 clockticks65C02
+#define read6502 read65C02
+#define write6502 write65C02
+#define COUNT_TICKS 1000000
+static uint32_t instructions;
+#else
+extern void reset6502();
+extern void exec6502(uint32_t tickcount);
+extern volatile uint32_t clockticks6502;
+extern uint32_t instructions;
+#endif
+#ifdef BENCH_CACHE
+extern int cache6502(uint8_t first, uint8_t last, int enable);
+extern const char *cpu6502_pairname(int n);
+extern uint32_t pairhits6502(int n);
+#endif
+#ifdef BENCH_MAP
+extern void map6502(uint8_t first, uint8_t last, uint8_t *mem, int writable);
+#endif
+#ifdef BENCH_NATIVE
+#include "../vic20/roms_native.h"
+#endif
+
+// Memory layout (same as the VIC-20 backend, minus the I/O)
+static uint8_t mem[0x10000];
+static uint8_t page_type[256];
+
+// 10 A=0:FORI=1TO30000:A=A+I*3:NEXT:GOTO10
+static const uint8_t prog[] = {
+  0x00, 0x00,                                   // line link, fixed up below
+  0x0A, 0x00,                                   // 10
+  'A', 0xB2, '0', ':',                          // A=0:
+  0x81, 'I', 0xB2, '1', 0xA4, '3','0','0','0','0', ':', // FORI=1TO30000:
+  'A', 0xB2, 'A', 0xAA, 'I', 0xAC, '3', ':',    // A=A+I*3:
+  0x82, ':',                                    // NEXT:
+  0x89, '1', '0',                               // GOTO10
+  0x00,
+  0x00, 0x00                                    // end of program
+};
+
+uint8_t read6502(uint16_t address)
+{
+  return mem[address];
+}
+
+void write6502(uint16_t address, uint8_t value)
+{
+  if (page_type[address>>8] == 3) //ROM
+    return;
+  mem[address] = value;
+}
+
+#ifdef BENCH_65C02
+// Nothing to do in the clock low window
+void update65C02()
+{
+}
+
+// The instructions the model ran
+static void simstats(gpiosim_stats_t *s)
+{
+  gpiosim_stats(s);
+  instructions = s->instructions;
+}
+#endif
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t ticks = 100;
+  uint32_t start_ticks, start_ins;
+  uint16_t txttab, link;
+  double t;
+  int g;
+#ifdef BENCH_65C02
+  gpiosim_stats_t s0, s1;
+#endif
+
+  if (argc > 1)
+    ticks = atoi(argv[1]);
+  ticks *= 1000000;
+
+  for (g=0; g<256; g++)
+    page_type[g] = 1; //RAM
+
+  for (g=0; g<0x1000; g++)
+    page_type[(CHAR_ROMSTART+g)>>8] = 3; //ROM, contents don't matter here
+
+  for (g=0; g<basicROM_len; g++) {
+    mem[0xC000+g] = basicROM[g];
+    page_type[(0xC000+g)>>8] = 3; //ROM
+  }
+
+  for (g=0; g<kernalROM_len; g++) {
+    mem[0xE000+g] = kernalROM[g];
+    page_type[(0xE000+g)>>8] = 3; //ROM
+  }
+
+#ifdef BENCH_CACHE
+  // Decode cache on every page, there is no I/O here
+  cache6502(0x00, 0xFF, 1);
+#endif
+#ifdef BENCH_MAP
+  // RAM and ROM straight from mem[], like the backends map them
+  for (g=0; g<256; g++)
+    map6502(g, g, &mem[g << 8], page_type[g] == 1);
+#endif
+#ifdef BENCH_NATIVE
+  // The ROMs translated to C by vic20/rom2c
+  native6502(vic20_native, vic20_nativemap);
+#endif
+
+  // Boot to READY.
+  reset6502();
+  exec6502(BOOT_TICKS);
+
+  // Install the program at TXTTAB and set VARTAB behind it
+  txttab = mem[0x2B] | (mem[0x2C] << 8);
+  for (g=0; g<sizeof(prog); g++)
+    mem[txttab+g] = prog[g];
+  link = txttab + sizeof(prog) - 2;
+  mem[txttab] = link & 0xff;
+  mem[txttab+1] = link >> 8;
+  mem[0x2D] = (link+2) & 0xff;
+  mem[0x2E] = (link+2) >> 8;
+
+  // Type RUN<CR>
+  mem[0x277] = 'R';
+  mem[0x278] = 'U';
+  mem[0x279] = 'N';
+  mem[0x27A] = 0x0D;
+  mem[0xC6] = 4;
+
+#ifdef BENCH_65C02
+  simstats(&s0);
+#endif
+  start_ticks = clockticks6502;
+  start_ins = instructions;
+  t = now();
+  exec6502(ticks);
+  t = now() - t;
+#ifdef BENCH_65C02
+  simstats(&s1);
+#endif
+
+  ticks = clockticks6502 - start_ticks;
+  printf("%-12s %10u ticks %10u instructions %7.3fs %8.2f MHz %8.2f MIPS\n",
+         BENCH_CORE, ticks, instructions - start_ins, t,
+         ticks / t / 1e6, (instructions - start_ins) / t / 1e6);
+
+#ifdef BENCH_65C02
+  // What the driver does per bus cycle
+  printf("  %.2f register reads, %.2f writes per bus cycle, %u model mismatches\n",
+         (double)(s1.reads - s0.reads) / ticks, (double)(s1.writes - s0.writes) / ticks,
+         s1.mismatches);
+  if (gpiosim_count(1)) {
+    exec6502(COUNT_TICKS);
+    gpiosim_count(0);
+    gpiosim_stats(&s1);
+    printf("  %.1f host instructions per bus cycle, the model not included\n",
+           (double)s1.host / COUNT_TICKS);
+  } else
+    printf("  no instruction counter on this host\n");
+#endif
+
+#ifdef BENCH_CACHE
+  // How often each fused pair ran, boot included
+  for (g=0; cpu6502_pairname(g); g++)
+    printf("  %-16s %10u\n", cpu6502_pairname(g), pairhits6502(g));
+#endif
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// defer6502: device work in the slack of the bus cycles, see defer6502.h
+//
+// Everything but defer6502_post() runs on the CPU thread. Posts are picked
+// up in one go by swapping the bits out, from then on the CPU thread keeps
+// them in waiting and takes its time. There are few items, every pass
+// looks at all of them in the order they were added, the first added get
+// the slack first.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "defer6502.h"
+
+void defer6502_init(defer6502_t *d, uint32_t hz, uint32_t clockticks)
+{
+  memset(d, 0, sizeof(*d));
+  // Counter ticks per emulated cycle
+  if (hz)
+    d->period = 1e9 / hz / rt6502_ns(1000000) * 1000000;
+  d->start = clockticks;
+  d->next = clockticks + 0x7fffffff;
+  d->end = rt6502_now();
+}
+
+int defer6502_add(defer6502_t *d, const char *name, defer6502_fn fn, void *arg, uint32_t period, uint32_t maxlag)
+{
+  defer6502_item_t *it;
+
+  if (d->items == DEFER6502_ITEMS)
+    return -1;
+  it = &d->item[d->items];
+  it->name = name;
+  it->fn = fn;
+  it->arg = arg;
+  it->period = period;
+  it->maxlag = maxlag;
+  it->last = d->start;
+  it->due = it->last + period;
+  if (period && (int32_t)(it->due - d->next) < 0)
+    d->next = it->due;
+  return d->items++;
+}
+
+// Posts since the last look become waiting, due from now
+static void collect(defer6502_t *d, uint32_t clockticks)
+{
+  uint32_t fresh = __atomic_exchange_n(&d->posted, 0, __ATOMIC_ACQUIRE), g;
+
+  fresh &= ~d->waiting;
+  for (g=0; g<DEFER6502_ITEMS; g++)
+    if (fresh & (1u << g))
+      d->item[g].due = clockticks;
+  d->waiting |= fresh;
+}
+
+static int ready(defer6502_t *d, int id, uint32_t clockticks)
+{
+  defer6502_item_t *it = &d->item[id];
+
+  return (d->waiting & (1u << id)) || (it->period && (int32_t)(clockticks - it->due) >= 0);
+}
+
+// Runs it, returns the counter ticks it took
+static uint64_t run(defer6502_t *d, int id, uint32_t clockticks, uint64_t now)
+{
+  defer6502_item_t *it = &d->item[id];
+  uint64_t t;
+
+  d->waiting &= ~(1u << id);
+  it->late += clockticks - it->due;
+  it->runs++;
+  if (it->period)
+    it->due = clockticks + it->period;
+  it->fn(it->arg, clockticks - it->last);
+  it->last = clockticks;
+
+  // The estimate is the slowest recent run, it forgets slowly
+  t = rt6502_now() - now;
+  it->cost -= it->cost / 16;
+  if (t > it->cost)
+    it->cost = t;
+  d->credit = d->credit > t ? d->credit - t : 0;
+  d->spent += t;
+  return t;
+}
+
+void defer6502_work(defer6502_t *d, uint32_t clockticks, uint64_t now)
+{
+  int32_t next = 0x7fffffff; // cycles from now, < 0 when overdue
+  defer6502_item_t *it;
+  int g;
+
+  collect(d, clockticks);
+  for (g=0; g<d->items; g++) {
+    it = &d->item[g];
+    if (ready(d, g, clockticks)) {
+      if (clockticks - it->due >= it->maxlag) {
+        it->forced++;
+        now += run(d, g, clockticks, now);
+      }
+      else if (it->cost <= d->credit)
+        now += run(d, g, clockticks, now);
+    }
+    if (it->period && (int32_t)(it->due - clockticks) < next)
+      next = it->due - clockticks;
+  }
+  d->next = clockticks + next;
+  // The work was paid for with slack, the next cycle starts here
+  d->end = now;
+}
+
+void defer6502_flush(defer6502_t *d, int id, uint32_t clockticks)
+{
+  collect(d, clockticks);
+  if (ready(d, id, clockticks)) {
+    d->item[id].flushed++;
+    run(d, id, clockticks, rt6502_now());
+  }
+}
+
+void defer6502_print(defer6502_t *d, const char *what)
+{
+  defer6502_item_t *it;
+  int g;
+
+  if (!d->cycles)
+    return;
+  printf("%s: %llu cycles, slack %.0f ns a cycle, %.1f%% of it spent\n", what,
+         (unsigned long long)d->cycles, rt6502_ns(d->slack) / d->cycles,
+         d->slack ? 100.0 * d->spent / d->slack : 0.0);
+  for (g=0; g<d->items; g++) {
+    it = &d->item[g];
+    printf("  %-12s %10llu runs, %.1f cycles late, cost %.0f ns, forced %llu, flushed %llu\n",
+           it->name, (unsigned long long)it->runs, it->runs ? (double)it->late / it->runs : 0.0,
+           rt6502_ns(it->cost), (unsigned long long)it->forced, (unsigned long long)it->flushed);
+  }
+}
@@ -0,0 +1,92 @@
+#ifndef _DEFER6502_H_
+#define _DEFER6502_H_
+
+#include <stdint.h>
+
+#include "rt6502.h"
+
+// Deferred device work for the clock low window. update65C02() runs while
+// the clock is low, the 65C02 is static and waits as long as it's kept
+// there, but every ns spent in it stretches that bus cycle. At an emulated
+// clock the bus runs faster than it has to, what a cycle has left of its
+// share of the emulated clock (the slack) would otherwise be slept away
+// by the pacer. defer6502_run() measures it and spends it on work items:
+//
+//  - periodic ones, due every period cycles (timer ticks). The function is
+//    told how many cycles it's been, so running late only batches them.
+//  - posted ones, run once after defer6502_post() (from any thread).
+//
+// Slack adds up to a few cycles' worth, an item runs when the estimate of
+// its cost (the slowest recent run) fits. What doesn't fit waits for the
+// next cycle, but never longer than maxlag cycles past due, then it runs
+// anyway. With no emulated clock (hz = 0) there's no slack to speak of
+// and every item runs maxlag cycles late. defer6502_flush() runs an item
+// right away if it's pending, for the handler about to read its results.
+#define DEFER6502_ITEMS 32
+#define DEFER6502_CREDIT 4 // cycles of slack kept at most
+
+// fn(arg, cycles since it last ran)
+typedef void (*defer6502_fn)(void *arg, uint32_t cycles);
+
+typedef struct {
+  const char *name;
+  defer6502_fn fn;
+  void *arg;
+  uint32_t period, maxlag; // cycles, period 0 = posted only
+  uint32_t due, last;      // clockticks
+  uint64_t cost;           // counter ticks
+
+  // statistics
+  uint64_t runs, forced, flushed, late; // late = cycles past due, summed
+} defer6502_item_t;
+
+typedef struct {
+  defer6502_item_t item[DEFER6502_ITEMS];
+  int items;
+  uint32_t posted;  // bit per item, set by defer6502_post()
+  uint32_t waiting; // bit per posted item seen but not run yet
+  uint32_t start;   // clockticks at init
+  uint32_t next;    // clockticks the first periodic item is due
+  uint64_t period;  // counter ticks per emulated cycle
+  uint64_t credit, end;
+
+  // statistics
+  uint64_t cycles, slack, spent;
+} defer6502_t;
+
+// hz = the emulated clock (PACE_HZ), clockticks is where the CPU is now
+extern void defer6502_init(defer6502_t *d, uint32_t hz, uint32_t clockticks);
+// Returns the item's id, -1 when they're used up
+extern int defer6502_add(defer6502_t *d, const char *name, defer6502_fn fn, void *arg, uint32_t period, uint32_t maxlag);
+// Runs id now if it's due or posted
+extern void defer6502_flush(defer6502_t *d, int id, uint32_t clockticks);
+// Prints what ran how often and how late
+extern void defer6502_print(defer6502_t *d, const char *what);
+
+extern void defer6502_work(defer6502_t *d, uint32_t clockticks, uint64_t now);
+
+static inline void defer6502_post(defer6502_t *d, int id)
+{
+  __atomic_fetch_or(&d->posted, 1u << id, __ATOMIC_RELEASE);
+}
+
+// From update65C02(), once a cycle
+static inline void defer6502_run(defer6502_t *d, uint32_t clockticks)
+{
+  uint64_t now = rt6502_now(), rest = now - d->end;
+
+  // The rest of the cycle took rest, whatever is left of the period is
+  // slack. Longer than that (a sleep, being late) gives none
+  d->cycles++;
+  if (rest < d->period) {
+    d->slack += d->period - rest;
+    d->credit += d->period - rest;
+    if (d->credit > DEFER6502_CREDIT * d->period)
+      d->credit = DEFER6502_CREDIT * d->period;
+  }
+  d->end = now;
+  if ((__atomic_load_n(&d->posted, __ATOMIC_RELAXED) | d->waiting) || (int32_t)(clockticks - d->next) >= 0)
+    defer6502_work(d, clockticks, now);
+}
+
+#endif
@@ -102,866 +102,613 @@
  *                                                   *
  *****************************************************/
 
+/* bad6502 notes **************************************
+ * This is a rewrite of the Fake6502 interpreter     *
+ * loop. The interface and the timing are unchanged, *
+ * but instead of two indirect calls per instruction *
+ * through addrtable[]/optable[] every opcode has    *
+ * its addressing mode and operation expanded inline *
+ * in one dispatch loop. GCC builds use computed     *
+ * goto, everything else (or -DNO_COMPUTED_GOTO) a   *
+ * switch.                                           *
+ *                                                   *
+ * All CPU state lives in a cpu6502_t context (see   *
+ * fake6502.h) with its own read/write callbacks and *
+ * userdata pointer, so several CPUs can run in one  *
+ * process. The global Fake6502 API above is a thin  *
+ * wrapper around one context that copies the        *
+ * registers in and out around each call.            *
+ *                                                   *
+ * The registers live in locals while the loop runs  *
+ * and are written back to the context on return.    *
+ * irq6502() and nmi6502() only latch the request,   *
+ * it is serviced at the next instruction boundary.  *
+ *                                                   *
+ * Pages enabled with cache6502()/cpu6502_cache()    *
+ * get a decode cache: the opcode, operand and base  *
+ * cycle count of each instruction are kept per      *
+ * address, so the loop doesn't fetch them through   *
+ * read6502() again. The core's own writes           *
+ * invalidate the entries they hit, anything else    *
+ * that changes code has to call                     *
+ * invalidate6502()/cpu6502_invalidate(). Never      *
+ * cache I/O pages. Common instruction pairs         *
+ * (DEX/BNE, CMP #/BNE, ... see fake6502_pairs.h)    *
+ * found in the decode cache run with one dispatch,  *
+ * cpu6502_pairname() and pairhits tell how often.   *
+ *                                                   *
+ * RAM and ROM pages handed to                       *
+ * map6502()/cpu6502_map() are read (and RAM         *
+ * written) straight through a pointer, only I/O     *
+ * goes through the callbacks.                       *
+ *                                                   *
+ * Built with -DFAKE6502_JIT ('make fakejit') hot    *
+ * blocks on cached pages are translated to x86-64   *
+ * by jit6502.c. Translated code keeps the exact     *
+ * cycle counts and hands I/O accesses, interrupts   *
+ * and anything it doesn't know back to this loop.   *
+ * Only exec6502()/cpu6502_exec() runs blocks,       *
+ * single steps are always interpreted.              *
+ *                                                   *
+ * cycle6502()/cpu6502_cycle() run a single bus      *
+ * cycle instead of a whole instruction, with every  *
+ * read and write (dummy accesses included) the real *
+ * chip does in it, see fake6502_cycle.h. The FAKE   *
+ * backends drive the device side through it, one    *
+ * call per clock like step65C02() on the real chip. *
+ *                                                   *
+ * The CPU variant is picked at compile time with    *
+ * -DFAKE6502_NMOS, -DFAKE6502_65C02 (full WDC       *
+ * instruction set and cycle table) or               *
+ * -DFAKE6502_2A03, the default and what Fake6502    *
+ * always was. The Makefiles build the 65C02 the     *
+ * board carries, FAKECPU= picks another one.        *
+ * 'make lockstep' checks the NMOS and 65C02 decimal *
+ * mode (bcdcheck6502.c) and the 65C02 opcodes and   *
+ * cycles against the datasheet (opcheck6502.c).     *
+ *                                                   *
+ * The macros and tables live in fake6502_ops.h and  *
+ * the opcode list in fake6502_opcodes.h, so         *
+ * vic20/rom2c can translate the VIC-20 ROMs to C    *
+ * with exactly the same code.                       *
+ * native6502()/cpu6502_native() registers such      *
+ * code, the loop hands over whenever pc is on an    *
+ * address it covers and gets control back for       *
+ * everything else.                                  *
+ *                                                   *
+ * The original table-driven core is kept in         *
+ * fake6502_ref.c, 'make bench' runs both of them    *
+ * and 'make lockstep' compares them instruction by  *
+ * instruction.                                      *
+ *                                                   *
+ * Built with -DFAKE6502_NOGLOBAL there is only the  *
+ * context API, none of the global names, for        *
+ * programs that have other 6502 globals (gpiosim.c  *
+ * puts a context behind the simulated GPIO pins of  *
+ * bad65C02.c).                                      *
+ *****************************************************/
+
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+#include <ctype.h>
 
-//6502 defines
-#define UNDOCUMENTED //when this is defined, undocumented opcodes are handled.
-                     //otherwise, they're simply treated as NOPs.
-
-#define NES_CPU      //when this is defined, the binary-coded decimal (BCD)
-                     //status flag is not honored by ADC and SBC. the 2A03
-                     //CPU in the Nintendo Entertainment System does not
-                     //support BCD operation.
-
-#define FLAG_CARRY     0x01
-#define FLAG_ZERO      0x02
-#define FLAG_INTERRUPT 0x04
-#define FLAG_DECIMAL   0x08
-#define FLAG_BREAK     0x10
-#define FLAG_CONSTANT  0x20
-#define FLAG_OVERFLOW  0x40
-#define FLAG_SIGN      0x80
-
-#define BASE_STACK     0x100
-
-#define saveaccum(n) a = (uint8_t)((n) & 0x00FF)
-
-
-//flag modifier macros
-#define setcarry() status |= FLAG_CARRY
-#define clearcarry() status &= (~FLAG_CARRY)
-#define setzero() status |= FLAG_ZERO
-#define clearzero() status &= (~FLAG_ZERO)
-#define setinterrupt() status |= FLAG_INTERRUPT
-#define clearinterrupt() status &= (~FLAG_INTERRUPT)
-#define setdecimal() status |= FLAG_DECIMAL
-#define cleardecimal() status &= (~FLAG_DECIMAL)
-#define setoverflow() status |= FLAG_OVERFLOW
-#define clearoverflow() status &= (~FLAG_OVERFLOW)
-#define setsign() status |= FLAG_SIGN
-#define clearsign() status &= (~FLAG_SIGN)
-
-
-//flag calculation macros
-#define zerocalc(n) {\
-    if ((n) & 0x00FF) clearzero();\
-        else setzero();\
-}
-
-#define signcalc(n) {\
-    if ((n) & 0x0080) setsign();\
-        else clearsign();\
-}
-
-#define carrycalc(n) {\
-    if ((n) & 0xFF00) setcarry();\
-        else clearcarry();\
-}
-
-#define overflowcalc(n, m, o) { /* n = result, m = accumulator, o = memory */ \
-    if (((n) ^ (uint16_t)(m)) & ((n) ^ (o)) & 0x0080) setoverflow();\
-        else clearoverflow();\
-}
-
+#include "fake6502.h"
+#ifdef FAKE6502_JIT
+#include "jit6502.h"
+#endif
 
-//6502 CPU registers
-uint16_t pc;
-uint8_t sp, a, x, y, status;
+#include "fake6502_ops.h"
 
+#if defined(FAKE6502_JIT) && defined(FAKE6502_NOGLOBAL)
+#error "translated blocks call read6502()/write6502(), FAKE6502_JIT needs the global API"
+#endif
 
-//helper variables
-uint32_t instructions = 0; //keep track of total instructions executed
-volatile uint32_t clockticks6502 = 0;
-uint32_t clockgoal6502 = 0;
-uint16_t oldpc, ea, reladdr, value, result;
-uint8_t opcode, oldstatus;
+#if defined(__GNUC__) && !defined(NO_COMPUTED_GOTO)
+#define COMPUTED_GOTO //dispatch through a label table instead of a switch
+#endif
 
-//externally supplied functions
+//externally supplied functions (global API only)
+#ifndef FAKE6502_NOGLOBAL
 extern uint8_t read6502(uint16_t address);
 extern void write6502(uint16_t address, uint8_t value);
+#endif
 
-//a few general functions used by various other functions
-void push16(uint16_t pushval) {
-    write6502(BASE_STACK + sp, (pushval >> 8) & 0xFF);
-    write6502(BASE_STACK + ((sp - 1) & 0xFF), pushval & 0xFF);
-    sp -= 2;
-}
+//fused pairs, numbered from 1 on (0 = none)
+enum {
+    PAIR_NONE,
+#define FUSE(name, op1, mode1, exec1, op2, mode2, exec2) PAIR_##name,
+#include "fake6502_pairs.h"
+#undef FUSE
+    PAIR_END
+};
 
-void push8(uint8_t pushval) {
-    write6502(BASE_STACK + sp--, pushval);
-}
+#if PAIR_END > CPU6502_PAIRS + 1
+#error "fake6502_pairs.h has more pairs than CPU6502_PAIRS"
+#endif
 
-uint16_t pull16() {
-    uint16_t temp16;
-    temp16 = read6502(BASE_STACK + ((sp + 1) & 0xFF)) | ((uint16_t)read6502(BASE_STACK + ((sp + 2) & 0xFF)) << 8);
-    sp += 2;
-    return(temp16);
-}
+static const char *const pairnames[] = {
+#define FUSE(name, op1, mode1, exec1, op2, mode2, exec2) #name,
+#include "fake6502_pairs.h"
+#undef FUSE
+};
 
-uint8_t pull8() {
-    return (read6502(BASE_STACK + ++sp));
+//where the loop dispatches an instruction to, given the one behind it:
+//the fused pair both start, or just the first opcode
+static uint16_t fuse(uint8_t first, uint8_t second) {
+#define FUSE(name, op1, mode1, exec1, op2, mode2, exec2) if (first == op1 && second == op2) return 0xFF + PAIR_##name;
+#include "fake6502_pairs.h"
+#undef FUSE
+    return first;
 }
 
-void reset6502() {
-    pc = (uint16_t)read6502(0xFFFC) | ((uint16_t)read6502(0xFFFD) << 8);
-    a = 0;
-    x = 0;
-    y = 0;
-    sp = 0xFD;
-    status |= FLAG_CONSTANT;
-}
-
-
-static void (*addrtable[256])();
-static void (*optable[256])();
-uint8_t penaltyop, penaltyaddr;
+//dispatch. the fused pairs follow the 256 opcodes
+#ifdef COMPUTED_GOTO
+#define OP(n) op_##n:
+#define PAIROP(name) pair_##name:
+#define DISPATCH(n) goto *optable[n];
+#else
+#define OP(n) case n:
+#define PAIROP(name) case 0xFF + PAIR_##name:
+#define DISPATCH(n) switch (n) {
+#endif
 
-//addressing mode functions, calculates effective addresses
-static void imp() { //implied
-}
+#define NEXT goto next
 
-static void acc() { //accumulator
+//native code and translated blocks the loop hands over to at addr
+#define NATIVEAT(addr) (c->native && (c->nativemap[(addr) >> 3] & (1 << ((addr) & 7))))
+#ifdef FAKE6502_JIT
+#define JITAT(addr) (c->jit && JIT6502_BLOCK(c, addr))
+#define JITHIT(d, addr) {\
+    if (++(d)->hits == JIT6502_THRESHOLD && c->jit)\
+        jit6502_translate(c, addr);\
 }
+#else
+#define JITAT(addr) 0
+#define JITHIT(d, addr)
+#endif
 
-static void imm() { //immediate
-    ea = pc++;
-}
+//the registers go back to the context around calls out of the loop
+#define SAVEREGS {\
+    c->pc = pc;\
+    c->sp = sp;\
+    c->a = a;\
+    c->x = x;\
+    c->y = y;\
+    c->status = GETSTATUS;\
+    c->clockticks = clk;\
+}
+
+#define LOADREGS {\
+    pc = c->pc;\
+    sp = c->sp;\
+    a = c->a;\
+    x = c->x;\
+    y = c->y;\
+    PUTSTATUS(c->status);\
+    clk = c->clockticks;\
+}
+
+
+//writes invalidate every cached instruction that could cover the address.
+//instructions crossing a page boundary are never cached, so it's enough to
+//look at the written page. translated blocks only live on cached pages
+#ifdef FAKE6502_JIT
+#define JITINVALIDATE(addr) JIT6502_INVALIDATE(c, addr)
+#else
+#define JITINVALIDATE(addr)
+#endif
 
-static void zp() { //zero-page
-    ea = (uint16_t)read6502((uint16_t)pc++);
+#define INVALIDATE(addr) {\
+    cpu6502_decoded_t *dpage = c->decoded[(addr) >> 8];\
+    if (dpage) {\
+        uint8_t off = (addr) & 0xFF;\
+        dpage[off].len = 0;\
+        if (off >= 1) dpage[off - 1].len = 0;\
+        if (off >= 2) dpage[off - 2].len = 0;\
+        JITINVALIDATE(addr);\
+    }\
 }
 
-static void zpx() { //zero-page,X
-    ea = ((uint16_t)read6502((uint16_t)pc++) + (uint16_t)x) & 0xFF; //zero-page wraparound
+//mapped pages are accessed directly, everything else through the bus
+static inline uint8_t mapread(cpu6502_t *c, cpu6502_read_t rd, void *ud, uint16_t address) {
+    uint8_t *p = c->readmap[address >> 8];
+    return p ? p[address & 0xFF] : rd(ud, address);
 }
 
-static void zpy() { //zero-page,Y
-    ea = ((uint16_t)read6502((uint16_t)pc++) + (uint16_t)y) & 0xFF; //zero-page wraparound
-}
+#ifndef FAKE6502_NOGLOBAL
+//read6502()/write6502() see clockticks6502 at the end of the instruction
+//and can end the exec6502() it runs in with stop6502()
+static uint8_t stopreq;
 
-static void rel() { //relative for branch ops (8-bit immediate value, sign-extended)
-    reladdr = (uint16_t)read6502(pc++);
-    if (reladdr & 0x80) reladdr |= 0xFF00;
-}
+static inline uint8_t mapreadglobal(cpu6502_t *c, uint16_t address, uint32_t clk, uint32_t *goal) {
+    uint8_t *p = c->readmap[address >> 8];
+    uint8_t value;
 
-static void abso() { //absolute
-    ea = (uint16_t)read6502(pc) | ((uint16_t)read6502(pc+1) << 8);
-    pc += 2;
+    if (p) return p[address & 0xFF];
+    clockticks6502 = clk;
+    value = read6502(address);
+    if (stopreq) *goal = clk;
+    return value;
 }
 
-static void absx() { //absolute,X
-    uint16_t startpage;
-    ea = ((uint16_t)read6502(pc) | ((uint16_t)read6502(pc+1) << 8));
-    startpage = ea & 0xFF00;
-    ea += (uint16_t)x;
-
-    if (startpage != (ea & 0xFF00)) { //one cycle penlty for page-crossing on some opcodes
-        penaltyaddr = 1;
-    }
-
-    pc += 2;
+#define BUSWRITEGLOBAL(addr, val) {\
+    clockticks6502 = clk;\
+    write6502(addr, val);\
+    if (stopreq) goal = clk;\
 }
+#endif
 
-static void absy() { //absolute,Y
-    uint16_t startpage;
-    ea = ((uint16_t)read6502(pc) | ((uint16_t)read6502(pc+1) << 8));
-    startpage = ea & 0xFF00;
-    ea += (uint16_t)y;
-
-    if (startpage != (ea & 0xFF00)) { //one cycle penlty for page-crossing on some opcodes
-        penaltyaddr = 1;
-    }
+#define MAPWRITE(addr, val, bus) {\
+    uint16_t wa = (addr);\
+    uint8_t *wp = c->writemap[wa >> 8];\
+    if (wp) wp[wa & 0xFF] = (uint8_t)(val);\
+        else bus(wa, (uint8_t)(val));\
+    INVALIDATE(wa);\
+}
+
+//the interpreter is instantiated twice, once calling the context callbacks
+//and once calling read6502()/write6502() directly for the global API, so
+//the global wrapper doesn't pay for an extra call on every bus access
+#define INTERPRET interpret
+#define BUSLOCALS \
+    cpu6502_read_t rd = c->read;\
+    cpu6502_write_t wr = c->write;\
+    void *ud = c->userdata;
+#define BUSWRITE(addr, val) wr(ud, addr, val)
+#define RD(addr)       mapread(c, rd, ud, (uint16_t)(addr))
+#define WR(addr, val)  MAPWRITE(addr, val, BUSWRITE)
+#include "fake6502_loop.h"
+#undef INTERPRET
+#undef BUSLOCALS
+#undef BUSWRITE
+#undef RD
+#undef WR
+
+#ifndef FAKE6502_NOGLOBAL
+#define INTERPRET interpretglobal
+#define BUSLOCALS
+#define RD(addr)       mapreadglobal(c, (uint16_t)(addr), clk, &goal)
+#define WR(addr, val)  MAPWRITE(addr, val, BUSWRITEGLOBAL)
+#include "fake6502_loop.h"
+#undef INTERPRET
+#undef BUSLOCALS
+#undef RD
+#undef WR
+#endif
 
-    pc += 2;
-}
 
-static void ind() { //indirect
-    uint16_t eahelp, eahelp2;
-    eahelp = (uint16_t)read6502(pc) | (uint16_t)((uint16_t)read6502(pc+1) << 8);
-    eahelp2 = (eahelp & 0xFF00) | ((eahelp + 1) & 0x00FF); //replicate 6502 page-boundary wraparound bug
-    ea = (uint16_t)read6502(eahelp) | ((uint16_t)read6502(eahelp2) << 8);
-    pc += 2;
-}
+//the tables every context shares are built once, by the first of them to
+//get there. contexts set up on other threads meanwhile wait for it, the
+//acquire makes the tables visible to them
+static void once(uint8_t *state, void (*build)()) {
+    uint8_t idle = 0;
 
-static void indx() { // (indirect,X)
-    uint16_t eahelp;
-    eahelp = (uint16_t)(((uint16_t)read6502(pc++) + (uint16_t)x) & 0xFF); //zero-page wraparound for table pointer
-    ea = (uint16_t)read6502(eahelp & 0x00FF) | ((uint16_t)read6502((eahelp+1) & 0x00FF) << 8);
+    if (__atomic_load_n(state, __ATOMIC_ACQUIRE) == 2) return;
+    if (__atomic_compare_exchange_n(state, &idle, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+        build();
+        __atomic_store_n(state, 2, __ATOMIC_RELEASE);
+    } else
+        while (__atomic_load_n(state, __ATOMIC_ACQUIRE) != 2);
 }
 
-static void indy() { // (indirect),Y
-    uint16_t eahelp, eahelp2, startpage;
-    eahelp = (uint16_t)read6502(pc++);
-    eahelp2 = (eahelp & 0xFF00) | ((eahelp + 1) & 0x00FF); //zero-page wraparound
-    ea = (uint16_t)read6502(eahelp) | ((uint16_t)read6502(eahelp2) << 8);
-    startpage = ea & 0xFF00;
-    ea += (uint16_t)y;
-
-    if (startpage != (ea & 0xFF00)) { //one cycle penlty for page-crossing on some opcodes
-        penaltyaddr = 1;
-    }
-}
 
-static uint16_t getvalue() {
-    if (addrtable[opcode] == acc) return((uint16_t)a);
-        else return((uint16_t)read6502(ea));
-}
+//decimal mode lookup tables, see BCDLOOKUP in fake6502_ops.h. they only
+//depend on the variant, so every context shares them
+#ifndef NES_CPU
+uint16_t bcdadc[2][256][256], bcdsbc[2][256][256];
+static uint8_t bcddone;
 
-static uint16_t getvalue16() {
-    return((uint16_t)read6502(ea) | ((uint16_t)read6502(ea+1) << 8));
-}
+static void bcdbuild() {
+    uint8_t a, status, zres, nres;
+    uint16_t value, result;
+    int carry, av, v;
 
-static void putvalue(uint16_t saveval) {
-    if (addrtable[opcode] == acc) a = (uint8_t)(saveval & 0x00FF);
-        else write6502(ea, (saveval & 0x00FF));
+    for (carry = 0; carry < 2; carry++)
+        for (av = 0; av < 256; av++)
+            for (v = 0; v < 256; v++) {
+                a = av; value = v; status = carry; zres = nres = 0;
+                ADDBCD;
+                bcdadc[carry][av][v] = a | ((GETSTATUS & BCDFLAGMASK) << 8);
+                a = av; value = v; status = carry; zres = nres = 0;
+                SUBBCD;
+                bcdsbc[carry][av][v] = a | ((GETSTATUS & BCDFLAGMASK) << 8);
+            }
 }
 
+#define bcdinit() once(&bcddone, bcdbuild)
+#else
+#define bcdinit()
+#endif
 
-//instruction handler functions
-static void adc() {
-    penaltyop = 1;
-    value = getvalue();
-    result = (uint16_t)a + value + (uint16_t)(status & FLAG_CARRY);
-   
-    carrycalc(result);
-    zerocalc(result);
-    overflowcalc(result, a, value);
-    signcalc(result);
-    
-    #ifndef NES_CPU
-    if (status & FLAG_DECIMAL) {
-        clearcarry();
-        
-        if ((a & 0x0F) > 0x09) {
-            a += 0x06;
-        }
-        if ((a & 0xF0) > 0x90) {
-            a += 0x60;
-            setcarry();
-        }
-        
-        clockticks6502++;
-    }
-    #endif
-   
-    saveaccum(result);
-}
-
-static void and() {
-    penaltyop = 1;
-    value = getvalue();
-    result = (uint16_t)a & value;
-   
-    zerocalc(result);
-    signcalc(result);
-   
-    saveaccum(result);
-}
-
-static void asl() {
-    value = getvalue();
-    result = value << 1;
-
-    carrycalc(result);
-    zerocalc(result);
-    signcalc(result);
-   
-    putvalue(result);
-}
-
-static void bcc() {
-    if ((status & FLAG_CARRY) == 0) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
-    }
-}
-
-static void bcs() {
-    if ((status & FLAG_CARRY) == FLAG_CARRY) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
-    }
-}
 
-static void beq() {
-    if ((status & FLAG_ZERO) == FLAG_ZERO) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
+//cycle stepping
+#include "fake6502_cycle.h"
+
+
+//context API
+void cpu6502_init(cpu6502_t *c, cpu6502_read_t read, cpu6502_write_t write, void *userdata) {
+    c->pc = 0;
+    c->sp = 0xFD;
+    c->a = c->x = c->y = 0;
+    c->status = FLAG_CONSTANT;
+    c->clockticks = c->clockgoal = c->instructions = 0;
+    c->read = read;
+    c->write = write;
+    c->userdata = userdata;
+    c->irqreq = c->nmireq = 0;
+    c->irqline = c->nmiline = 0;
+    c->waiting = 0;
+    for (int page = 0; page < 256; page++) {
+        c->decoded[page] = NULL;
+        c->readmap[page] = c->writemap[page] = NULL;
     }
+    c->jit = NULL;
+    c->native = NULL;
+    c->nativemap = NULL;
+    for (int n = 0; n < CPU6502_PAIRS; n++)
+        c->pairhits[n] = 0;
+    c->mprog = NULL;
+    c->maddr = 0;
+    bcdinit();
+    microinit();
 }
 
-static void bit() {
-    value = getvalue();
-    result = (uint16_t)a & value;
-   
-    zerocalc(result);
-    status = (status & 0x3F) | (uint8_t)(value & 0xC0);
+void cpu6502_reset(cpu6502_t *c) {
+    c->pc = (uint16_t)c->read(c->userdata, 0xFFFC) | ((uint16_t)c->read(c->userdata, 0xFFFD) << 8);
+    c->a = 0;
+    c->x = 0;
+    c->y = 0;
+    c->sp = 0xFD;
+    c->status |= FLAG_CONSTANT;
+    c->irqreq = c->nmireq = 0;
+    c->waiting = 0;
+    c->mprog = NULL;
+    bcdinit();
+    microinit();
 }
 
-static void bmi() {
-    if ((status & FLAG_SIGN) == FLAG_SIGN) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
-    }
+void cpu6502_exec(cpu6502_t *c, uint32_t tickcount) {
+    c->clockgoal += tickcount;
+    while (c->mprog) cpu6502_cycle(c);
+    interpret(c, c->clockgoal);
 }
 
-static void bne() {
-    if ((status & FLAG_ZERO) == 0) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
-    }
+void cpu6502_step(cpu6502_t *c) {
+    if (c->mprog) {
+        while (c->mprog) cpu6502_cycle(c);
+    } else
+        interpret(c, c->clockticks + 1);
+    c->clockgoal = c->clockticks;
 }
 
-static void bpl() {
-    if ((status & FLAG_SIGN) == 0) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
-    }
+void cpu6502_irq(cpu6502_t *c) {
+    c->irqreq = 1;
 }
 
-static void brk() {
-    pc++;
-    push16(pc); //push next instruction address onto stack
-    push8(status | FLAG_BREAK); //push CPU status to stack
-    setinterrupt(); //set interrupt flag
-    pc = (uint16_t)read6502(0xFFFE) | ((uint16_t)read6502(0xFFFF) << 8);
+void cpu6502_nmi(cpu6502_t *c) {
+    c->nmireq = 1;
 }
 
-static void bvc() {
-    if ((status & FLAG_OVERFLOW) == 0) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
-    }
+void cpu6502_irqline(cpu6502_t *c, uint32_t source, int level) {
+    if (level) __atomic_or_fetch(&c->irqline, source, __ATOMIC_ACQ_REL);
+        else __atomic_and_fetch(&c->irqline, ~source, __ATOMIC_ACQ_REL);
 }
 
-static void bvs() {
-    if ((status & FLAG_OVERFLOW) == FLAG_OVERFLOW) {
-        oldpc = pc;
-        pc += reladdr;
-        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clockticks6502 += 2; //check if jump crossed a page boundary
-            else clockticks6502++;
-    }
+void cpu6502_nmiline(cpu6502_t *c, uint32_t source, int level) {
+    //only the first source pulling the line low is an edge
+    if (level) {
+        if (!__atomic_fetch_or(&c->nmiline, source, __ATOMIC_ACQ_REL))
+            __atomic_store_n(&c->nmireq, 1, __ATOMIC_RELEASE);
+    } else
+        __atomic_and_fetch(&c->nmiline, ~source, __ATOMIC_ACQ_REL);
 }
 
-static void clc() {
-    clearcarry();
-}
+int cpu6502_cache(cpu6502_t *c, uint8_t first, uint8_t last, int enable) {
+    int page;
 
-static void cld() {
-    cleardecimal();
-}
+#ifdef FAKE6502_JIT
+    //the translator only works on cached pages, so it comes with the cache
+    if (enable && !c->jit)
+        c->jit = jit6502_create(lentable, ticktable);
+#endif
 
-static void cli() {
-    clearinterrupt();
+    for (page = first; page <= last; page++) {
+        if (enable && !c->decoded[page]) {
+            c->decoded[page] = calloc(256, sizeof(cpu6502_decoded_t));
+            if (!c->decoded[page]) return -1;
+        }
+        if (!enable && c->decoded[page]) {
+#ifdef FAKE6502_JIT
+            jit6502_droppage(c, page);
+#endif
+            free(c->decoded[page]);
+            c->decoded[page] = NULL;
+        }
+    }
+    return 0;
 }
 
-static void clv() {
-    clearoverflow();
+void cpu6502_invalidate(cpu6502_t *c, uint16_t address) {
+    INVALIDATE(address);
 }
 
-static void cmp() {
-    penaltyop = 1;
-    value = getvalue();
-    result = (uint16_t)a - value;
-   
-    if (a >= (uint8_t)(value & 0x00FF)) setcarry();
-        else clearcarry();
-    if (a == (uint8_t)(value & 0x00FF)) setzero();
-        else clearzero();
-    signcalc(result);
+void cpu6502_native(cpu6502_t *c, cpu6502_native_t run, const uint8_t *map) {
+    c->native = map ? run : NULL;
+    c->nativemap = map;
 }
 
-static void cpx() {
-    value = getvalue();
-    result = (uint16_t)x - value;
-   
-    if (x >= (uint8_t)(value & 0x00FF)) setcarry();
-        else clearcarry();
-    if (x == (uint8_t)(value & 0x00FF)) setzero();
-        else clearzero();
-    signcalc(result);
+const char *cpu6502_pairname(int n) {
+    return n >= 0 && n < PAIR_END - 1 ? pairnames[n] : NULL;
 }
 
-static void cpy() {
-    value = getvalue();
-    result = (uint16_t)y - value;
-   
-    if (y >= (uint8_t)(value & 0x00FF)) setcarry();
-        else clearcarry();
-    if (y == (uint8_t)(value & 0x00FF)) setzero();
-        else clearzero();
-    signcalc(result);
-}
+void cpu6502_map(cpu6502_t *c, uint8_t first, uint8_t last, uint8_t *mem, int writable) {
+    int page;
 
-static void dec() {
-    value = getvalue();
-    result = value - 1;
-   
-    zerocalc(result);
-    signcalc(result);
-   
-    putvalue(result);
+    for (page = first; page <= last; page++) {
+        c->readmap[page] = mem ? mem + ((page - first) << 8) : NULL;
+        c->writemap[page] = writable ? c->readmap[page] : NULL;
+    }
 }
 
-static void dex() {
-    x--;
-   
-    zerocalc(x);
-    signcalc(x);
+uint8_t cpu6502_read(cpu6502_t *c, uint16_t address) {
+    if (c->readmap[address >> 8]) return c->readmap[address >> 8][address & 0xFF];
+#ifdef FAKE6502_NOGLOBAL
+    return c->read(c->userdata, address);
+#else
+    return c->read ? c->read(c->userdata, address) : read6502(address);
+#endif
 }
 
-static void dey() {
-    y--;
-   
-    zerocalc(y);
-    signcalc(y);
+void cpu6502_write(cpu6502_t *c, uint16_t address, uint8_t value) {
+    if (c->writemap[address >> 8]) c->writemap[address >> 8][address & 0xFF] = value;
+#ifdef FAKE6502_NOGLOBAL
+        else c->write(c->userdata, address, value);
+#else
+        else if (c->write) c->write(c->userdata, address, value);
+        else write6502(address, value);
+#endif
+    INVALIDATE(address);
 }
 
-static void eor() {
-    penaltyop = 1;
-    value = getvalue();
-    result = (uint16_t)a ^ value;
-   
-    zerocalc(result);
-    signcalc(result);
-   
-    saveaccum(result);
-}
 
-static void inc() {
-    value = getvalue();
-    result = value + 1;
-   
-    zerocalc(result);
-    signcalc(result);
-   
-    putvalue(result);
-}
+#ifndef FAKE6502_NOGLOBAL
+//global API, the registers are copied in and out of one context around
+//each call so code that pokes pc and friends directly keeps working
+uint16_t pc;
+uint8_t sp, a, x, y, status;
 
-static void inx() {
-    x++;
-   
-    zerocalc(x);
-    signcalc(x);
-}
-
-static void iny() {
-    y++;
-   
-    zerocalc(y);
-    signcalc(y);
-}
-
-static void jmp() {
-    pc = ea;
-}
-
-static void jsr() {
-    push16(pc - 1);
-    pc = ea;
-}
-
-static void lda() {
-    penaltyop = 1;
-    value = getvalue();
-    a = (uint8_t)(value & 0x00FF);
-   
-    zerocalc(a);
-    signcalc(a);
-}
-
-static void ldx() {
-    penaltyop = 1;
-    value = getvalue();
-    x = (uint8_t)(value & 0x00FF);
-   
-    zerocalc(x);
-    signcalc(x);
-}
-
-static void ldy() {
-    penaltyop = 1;
-    value = getvalue();
-    y = (uint8_t)(value & 0x00FF);
-   
-    zerocalc(y);
-    signcalc(y);
-}
-
-static void lsr() {
-    value = getvalue();
-    result = value >> 1;
-   
-    if (value & 1) setcarry();
-        else clearcarry();
-    zerocalc(result);
-    signcalc(result);
-   
-    putvalue(result);
-}
-
-static void nop() {
-    switch (opcode) {
-        case 0x1C:
-        case 0x3C:
-        case 0x5C:
-        case 0x7C:
-        case 0xDC:
-        case 0xFC:
-            penaltyop = 1;
-            break;
-    }
-}
+uint32_t instructions = 0; //keep track of total instructions executed
+volatile uint32_t clockticks6502 = 0;
+uint32_t clockgoal6502 = 0;
 
-static void ora() {
-    penaltyop = 1;
-    value = getvalue();
-    result = (uint16_t)a | value;
-   
-    zerocalc(result);
-    signcalc(result);
-   
-    saveaccum(result);
-}
+uint8_t callexternal = 0;
+void (*loopexternal)();
 
-static void pha() {
-    push8(a);
-}
+static cpu6502_t cpu;
 
-static void php() {
-    push8(status | FLAG_BREAK);
+static void load() {
+    cpu.pc = pc;
+    cpu.sp = sp;
+    cpu.a = a;
+    cpu.x = x;
+    cpu.y = y;
+    cpu.status = status;
+    cpu.clockticks = clockticks6502;
+    cpu.clockgoal = clockgoal6502;
+    cpu.instructions = instructions;
 }
 
-static void pla() {
-    a = pull8();
-   
-    zerocalc(a);
-    signcalc(a);
+static void store() {
+    pc = cpu.pc;
+    sp = cpu.sp;
+    a = cpu.a;
+    x = cpu.x;
+    y = cpu.y;
+    status = cpu.status;
+    clockticks6502 = cpu.clockticks;
+    clockgoal6502 = cpu.clockgoal;
+    instructions = cpu.instructions;
 }
 
-static void plp() {
-    status = pull8() | FLAG_CONSTANT;
+void reset6502() {
+    pc = (uint16_t)read6502(0xFFFC) | ((uint16_t)read6502(0xFFFD) << 8);
+    a = 0;
+    x = 0;
+    y = 0;
+    sp = 0xFD;
+    status |= FLAG_CONSTANT;
+    cpu.irqreq = cpu.nmireq = 0;
+    cpu.waiting = 0;
+    cpu.mprog = NULL;
+    bcdinit();
+    microinit();
 }
 
-static void rol() {
-    value = getvalue();
-    result = (value << 1) | (status & FLAG_CARRY);
-   
-    carrycalc(result);
-    zerocalc(result);
-    signcalc(result);
-   
-    putvalue(result);
+void nmi6502() {
+    cpu6502_nmi(&cpu);
 }
 
-static void ror() {
-    value = getvalue();
-    result = (value >> 1) | ((status & FLAG_CARRY) << 7);
-   
-    if (value & 1) setcarry();
-        else clearcarry();
-    zerocalc(result);
-    signcalc(result);
-   
-    putvalue(result);
+void irq6502() {
+    cpu6502_irq(&cpu);
 }
 
-static void rti() {
-    status = pull8();
-    value = pull16();
-    pc = value;
+void irqline6502(uint32_t source, int level) {
+    cpu6502_irqline(&cpu, source, level);
 }
 
-static void rts() {
-    value = pull16();
-    pc = value + 1;
+void nmiline6502(uint32_t source, int level) {
+    cpu6502_nmiline(&cpu, source, level);
 }
 
-static void sbc() {
-    penaltyop = 1;
-    value = getvalue() ^ 0x00FF;
-    result = (uint16_t)a + value + (uint16_t)(status & FLAG_CARRY);
-   
-    carrycalc(result);
-    zerocalc(result);
-    overflowcalc(result, a, value);
-    signcalc(result);
-
-    #ifndef NES_CPU
-    if (status & FLAG_DECIMAL) {
-        clearcarry();
-        
-        a -= 0x66;
-        if ((a & 0x0F) > 0x09) {
-            a += 0x06;
-        }
-        if ((a & 0xF0) > 0x90) {
-            a += 0x60;
-            setcarry();
+void exec6502(uint32_t tickcount) {
+    load();
+    while (cpu.mprog) cpu6502_cycle(&cpu);
+    if (callexternal) { //the hook wants to see every instruction
+        cpu.clockgoal += tickcount;
+        while ((int32_t)(cpu.clockticks - cpu.clockgoal) < 0 && !stopreq) {
+            interpretglobal(&cpu, cpu.clockticks + 1);
+            store();
+            (*loopexternal)();
+            load();
         }
-        
-        clockticks6502++;
+    } else {
+        cpu.clockgoal += tickcount;
+        interpretglobal(&cpu, cpu.clockgoal);
     }
-    #endif
-   
-    saveaccum(result);
-}
-
-static void sec() {
-    setcarry();
-}
-
-static void sed() {
-    setdecimal();
-}
-
-static void sei() {
-    setinterrupt();
-}
-
-static void sta() {
-    putvalue(a);
-}
-
-static void stx() {
-    putvalue(x);
-}
-
-static void sty() {
-    putvalue(y);
+    if (stopreq) { //the rest of the ticks are dropped
+        stopreq = 0;
+        cpu.clockgoal = cpu.clockticks;
+    }
+    store();
 }
 
-static void tax() {
-    x = a;
-   
-    zerocalc(x);
-    signcalc(x);
+void stop6502() {
+    stopreq = 1;
 }
 
-static void tay() {
-    y = a;
-   
-    zerocalc(y);
-    signcalc(y);
-}
+void step6502() {
+    load();
+    if (cpu.mprog) {
+        while (cpu.mprog) cpu6502_cycle(&cpu);
+    } else
+        interpretglobal(&cpu, cpu.clockticks + 1);
+    cpu.clockgoal = cpu.clockticks;
+    stopreq = 0;
+    store();
 
-static void tsx() {
-    x = sp;
-   
-    zerocalc(x);
-    signcalc(x);
+    if (callexternal) (*loopexternal)();
 }
 
-static void txa() {
-    a = x;
-   
-    zerocalc(a);
-    signcalc(a);
-}
+void cycle6502() {
+    load();
+    cpu6502_cycle(&cpu);
+    cpu.clockgoal = cpu.clockticks;
+    stopreq = 0;
+    store();
 
-static void txs() {
-    sp = x;
+    if (callexternal && !cpu.mprog) (*loopexternal)();
 }
 
-static void tya() {
-    a = y;
-   
-    zerocalc(a);
-    signcalc(a);
+int cache6502(uint8_t first, uint8_t last, int enable) {
+    return cpu6502_cache(&cpu, first, last, enable);
 }
 
-//undocumented instructions
-#ifdef UNDOCUMENTED
-    static void lax() {
-        lda();
-        ldx();
-    }
-
-    static void sax() {
-        sta();
-        stx();
-        putvalue(a & x);
-        if (penaltyop && penaltyaddr) clockticks6502--;
-    }
-
-    static void dcp() {
-        dec();
-        cmp();
-        if (penaltyop && penaltyaddr) clockticks6502--;
-    }
-
-    static void isb() {
-        inc();
-        sbc();
-        if (penaltyop && penaltyaddr) clockticks6502--;
-    }
-
-    static void slo() {
-        asl();
-        ora();
-        if (penaltyop && penaltyaddr) clockticks6502--;
-    }
-
-    static void rla() {
-        rol();
-        and();
-        if (penaltyop && penaltyaddr) clockticks6502--;
-    }
-
-    static void sre() {
-        lsr();
-        eor();
-        if (penaltyop && penaltyaddr) clockticks6502--;
-    }
-
-    static void rra() {
-        ror();
-        adc();
-        if (penaltyop && penaltyaddr) clockticks6502--;
-    }
-#else
-    #define lax nop
-    #define sax nop
-    #define dcp nop
-    #define isb nop
-    #define slo nop
-    #define rla nop
-    #define sre nop
-    #define rra nop
-#endif
-
-
-static void (*addrtable[256])() = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */     imp, indx,  imp, indx,   zp,   zp,   zp,   zp,  imp,  imm,  acc,  imm, abso, abso, abso, abso, /* 0 */
-/* 1 */     rel, indy,  imp, indy,  zpx,  zpx,  zpx,  zpx,  imp, absy,  imp, absy, absx, absx, absx, absx, /* 1 */
-/* 2 */    abso, indx,  imp, indx,   zp,   zp,   zp,   zp,  imp,  imm,  acc,  imm, abso, abso, abso, abso, /* 2 */
-/* 3 */     rel, indy,  imp, indy,  zpx,  zpx,  zpx,  zpx,  imp, absy,  imp, absy, absx, absx, absx, absx, /* 3 */
-/* 4 */     imp, indx,  imp, indx,   zp,   zp,   zp,   zp,  imp,  imm,  acc,  imm, abso, abso, abso, abso, /* 4 */
-/* 5 */     rel, indy,  imp, indy,  zpx,  zpx,  zpx,  zpx,  imp, absy,  imp, absy, absx, absx, absx, absx, /* 5 */
-/* 6 */     imp, indx,  imp, indx,   zp,   zp,   zp,   zp,  imp,  imm,  acc,  imm,  ind, abso, abso, abso, /* 6 */
-/* 7 */     rel, indy,  imp, indy,  zpx,  zpx,  zpx,  zpx,  imp, absy,  imp, absy, absx, absx, absx, absx, /* 7 */
-/* 8 */     imm, indx,  imm, indx,   zp,   zp,   zp,   zp,  imp,  imm,  imp,  imm, abso, abso, abso, abso, /* 8 */
-/* 9 */     rel, indy,  imp, indy,  zpx,  zpx,  zpy,  zpy,  imp, absy,  imp, absy, absx, absx, absy, absy, /* 9 */
-/* A */     imm, indx,  imm, indx,   zp,   zp,   zp,   zp,  imp,  imm,  imp,  imm, abso, abso, abso, abso, /* A */
-/* B */     rel, indy,  imp, indy,  zpx,  zpx,  zpy,  zpy,  imp, absy,  imp, absy, absx, absx, absy, absy, /* B */
-/* C */     imm, indx,  imm, indx,   zp,   zp,   zp,   zp,  imp,  imm,  imp,  imm, abso, abso, abso, abso, /* C */
-/* D */     rel, indy,  imp, indy,  zpx,  zpx,  zpx,  zpx,  imp, absy,  imp, absy, absx, absx, absx, absx, /* D */
-/* E */     imm, indx,  imm, indx,   zp,   zp,   zp,   zp,  imp,  imm,  imp,  imm, abso, abso, abso, abso, /* E */
-/* F */     rel, indy,  imp, indy,  zpx,  zpx,  zpx,  zpx,  imp, absy,  imp, absy, absx, absx, absx, absx  /* F */
-};
-
-static void (*optable[256])() = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |      */
-/* 0 */      brk,  ora,  nop,  slo,  nop,  ora,  asl,  slo,  php,  ora,  asl,  nop,  nop,  ora,  asl,  slo, /* 0 */
-/* 1 */      bpl,  ora,  nop,  slo,  nop,  ora,  asl,  slo,  clc,  ora,  nop,  slo,  nop,  ora,  asl,  slo, /* 1 */
-/* 2 */      jsr,  and,  nop,  rla,  bit,  and,  rol,  rla,  plp,  and,  rol,  nop,  bit,  and,  rol,  rla, /* 2 */
-/* 3 */      bmi,  and,  nop,  rla,  nop,  and,  rol,  rla,  sec,  and,  nop,  rla,  nop,  and,  rol,  rla, /* 3 */
-/* 4 */      rti,  eor,  nop,  sre,  nop,  eor,  lsr,  sre,  pha,  eor,  lsr,  nop,  jmp,  eor,  lsr,  sre, /* 4 */
-/* 5 */      bvc,  eor,  nop,  sre,  nop,  eor,  lsr,  sre,  cli,  eor,  nop,  sre,  nop,  eor,  lsr,  sre, /* 5 */
-/* 6 */      rts,  adc,  nop,  rra,  nop,  adc,  ror,  rra,  pla,  adc,  ror,  nop,  jmp,  adc,  ror,  rra, /* 6 */
-/* 7 */      bvs,  adc,  nop,  rra,  nop,  adc,  ror,  rra,  sei,  adc,  nop,  rra,  nop,  adc,  ror,  rra, /* 7 */
-/* 8 */      nop,  sta,  nop,  sax,  sty,  sta,  stx,  sax,  dey,  nop,  txa,  nop,  sty,  sta,  stx,  sax, /* 8 */
-/* 9 */      bcc,  sta,  nop,  nop,  sty,  sta,  stx,  sax,  tya,  sta,  txs,  nop,  nop,  sta,  nop,  nop, /* 9 */
-/* A */      ldy,  lda,  ldx,  lax,  ldy,  lda,  ldx,  lax,  tay,  lda,  tax,  nop,  ldy,  lda,  ldx,  lax, /* A */
-/* B */      bcs,  lda,  nop,  lax,  ldy,  lda,  ldx,  lax,  clv,  lda,  tsx,  lax,  ldy,  lda,  ldx,  lax, /* B */
-/* C */      cpy,  cmp,  nop,  dcp,  cpy,  cmp,  dec,  dcp,  iny,  cmp,  dex,  nop,  cpy,  cmp,  dec,  dcp, /* C */
-/* D */      bne,  cmp,  nop,  dcp,  nop,  cmp,  dec,  dcp,  cld,  cmp,  nop,  dcp,  nop,  cmp,  dec,  dcp, /* D */
-/* E */      cpx,  sbc,  nop,  isb,  cpx,  sbc,  inc,  isb,  inx,  sbc,  nop,  sbc,  cpx,  sbc,  inc,  isb, /* E */
-/* F */      beq,  sbc,  nop,  isb,  nop,  sbc,  inc,  isb,  sed,  sbc,  nop,  isb,  nop,  sbc,  inc,  isb  /* F */
-};
-
-static const uint32_t ticktable[256] = {
-/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
-/* 0 */      7,    6,    2,    8,    3,    3,    5,    5,    3,    2,    2,    2,    4,    4,    6,    6,  /* 0 */
-/* 1 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 1 */
-/* 2 */      6,    6,    2,    8,    3,    3,    5,    5,    4,    2,    2,    2,    4,    4,    6,    6,  /* 2 */
-/* 3 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 3 */
-/* 4 */      6,    6,    2,    8,    3,    3,    5,    5,    3,    2,    2,    2,    3,    4,    6,    6,  /* 4 */
-/* 5 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 5 */
-/* 6 */      6,    6,    2,    8,    3,    3,    5,    5,    4,    2,    2,    2,    5,    4,    6,    6,  /* 6 */
-/* 7 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 7 */
-/* 8 */      2,    6,    2,    6,    3,    3,    3,    3,    2,    2,    2,    2,    4,    4,    4,    4,  /* 8 */
-/* 9 */      2,    6,    2,    6,    4,    4,    4,    4,    2,    5,    2,    5,    5,    5,    5,    5,  /* 9 */
-/* A */      2,    6,    2,    6,    3,    3,    3,    3,    2,    2,    2,    2,    4,    4,    4,    4,  /* A */
-/* B */      2,    5,    2,    5,    4,    4,    4,    4,    2,    4,    2,    4,    4,    4,    4,    4,  /* B */
-/* C */      2,    6,    2,    8,    3,    3,    5,    5,    2,    2,    2,    2,    4,    4,    6,    6,  /* C */
-/* D */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* D */
-/* E */      2,    6,    2,    8,    3,    3,    5,    5,    2,    2,    2,    2,    4,    4,    6,    6,  /* E */
-/* F */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7   /* F */
-};
-
-
-void nmi6502() {
-    push16(pc);
-    push8(status);
-    status |= FLAG_INTERRUPT;
-    pc = (uint16_t)read6502(0xFFFA) | ((uint16_t)read6502(0xFFFB) << 8);
+void invalidate6502(uint16_t address) {
+    cpu6502_invalidate(&cpu, address);
 }
 
-void irq6502() {
-    push16(pc);
-    push8(status);
-    status |= FLAG_INTERRUPT;
-    pc = (uint16_t)read6502(0xFFFE) | ((uint16_t)read6502(0xFFFF) << 8);
+void native6502(cpu6502_native_t run, const uint8_t *map) {
+    cpu6502_native(&cpu, run, map);
 }
 
-uint8_t callexternal = 0;
-void (*loopexternal)();
-
-void exec6502(uint32_t tickcount) {
-    clockgoal6502 += tickcount;
-   
-    while (clockticks6502 < clockgoal6502) {
-        opcode = read6502(pc++);
-        status |= FLAG_CONSTANT;
-
-        penaltyop = 0;
-        penaltyaddr = 0;
-
-        (*addrtable[opcode])();
-        (*optable[opcode])();
-        clockticks6502 += ticktable[opcode];
-        if (penaltyop && penaltyaddr) clockticks6502++;
-
-        instructions++;
-
-        if (callexternal) (*loopexternal)();
-    }
-
+void map6502(uint8_t first, uint8_t last, uint8_t *mem, int writable) {
+    cpu6502_map(&cpu, first, last, mem, writable);
 }
 
-void step6502() {
-    opcode = read6502(pc++);
-    status |= FLAG_CONSTANT;
-
-    penaltyop = 0;
-    penaltyaddr = 0;
-
-    (*addrtable[opcode])();
-    (*optable[opcode])();
-    clockticks6502 += ticktable[opcode];
-    if (penaltyop && penaltyaddr) clockticks6502++;
-    clockgoal6502 = clockticks6502;
-
-    instructions++;
-
-    if (callexternal) (*loopexternal)();
+uint32_t pairhits6502(int n) {
+    return cpu6502_pairname(n) ? cpu.pairhits[n] : 0;
 }
 
 void hookexternal(void *funcptr) {
@@ -970,3 +717,4 @@ void hookexternal(void *funcptr) {
         callexternal = 1;
     } else callexternal = 0;
 }
+#endif
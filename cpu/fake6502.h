@@ -0,0 +1,159 @@
+#ifndef _FAKE6502_H_
+#define _FAKE6502_H_
+
+#include <stdint.h>
+
+// One emulated 6502. All state lives in here, so a process can run as many
+// of them as it likes (one per thread is fine, a single context must only be
+// driven from one thread, apart from cpu6502_irq()/cpu6502_nmi()).
+typedef struct cpu6502 cpu6502_t;
+
+// One pre-decoded instruction of the decode cache
+typedef struct {
+  uint16_t operand;
+  uint16_t dispatch; // opcode, or 0xFF + the fused pair starting here
+  uint8_t opcode;
+  uint8_t len;      // 0 = not decoded (yet)
+  uint8_t cycles;
+  uint8_t hits;     // times taken from the cache, for the translator
+} cpu6502_decoded_t;
+
+typedef uint8_t (*cpu6502_read_t)(void *userdata, uint16_t address);
+typedef void (*cpu6502_write_t)(void *userdata, uint16_t address, uint8_t value);
+
+// Natively compiled 6502 code, see vic20/rom2c.c. Runs from c->pc until
+// goal is reached, an interrupt is pending or pc leaves the code it knows.
+typedef void (*cpu6502_native_t)(cpu6502_t *c, uint32_t goal);
+
+// Instruction pairs the decode cache can fuse, see cpu6502_pairname()
+#define CPU6502_PAIRS 16
+
+struct cpu6502 {
+  // registers
+  uint16_t pc;
+  uint8_t sp, a, x, y, status;
+
+  // running totals of the emulated cycles and instructions
+  volatile uint32_t clockticks;
+  uint32_t clockgoal;
+  uint32_t instructions;
+
+  // bus
+  cpu6502_read_t read;
+  cpu6502_write_t write;
+  void *userdata;
+
+  // pending interrupt requests
+  volatile uint8_t irqreq, nmireq;
+  uint8_t waiting;  // in WAI (65C02)
+
+  // interrupt lines, one bit per device pulling them low, see
+  // cpu6502_irqline()/cpu6502_nmiline()
+  volatile uint32_t irqline, nmiline;
+
+  // decode cache, one array of 256 entries per cached page (NULL = page
+  // is not cached). Only enable it for RAM and ROM pages.
+  cpu6502_decoded_t *decoded[256];
+
+  // translated blocks, only with -DFAKE6502_JIT (NULL otherwise)
+  struct jit6502 *jit;
+
+  // direct memory map, the bytes of each page the core reads/writes itself
+  // (NULL = through the callbacks), see cpu6502_map()
+  uint8_t *readmap[256], *writemap[256];
+
+  // native code and the addresses it covers, one bit per address
+  cpu6502_native_t native;
+  const uint8_t *nativemap;
+
+  // times each fused pair ran as one, in the order of cpu6502_pairname()
+  uint32_t pairhits[CPU6502_PAIRS];
+
+  // cycle stepping, the instruction cpu6502_cycle() is in the middle of
+  // (mprog = NULL between instructions) and its internal latches
+  const uint8_t *mprog;
+  uint8_t mstep, mend, mop, mdata, mfix;
+  uint16_t mea, mbase, mptr, maddr;
+};
+
+// Context API
+extern void cpu6502_init(cpu6502_t *c, cpu6502_read_t read, cpu6502_write_t write, void *userdata);
+extern void cpu6502_reset(cpu6502_t *c);
+extern void cpu6502_exec(cpu6502_t *c, uint32_t tickcount);
+extern void cpu6502_step(cpu6502_t *c);
+extern void cpu6502_irq(cpu6502_t *c);
+extern void cpu6502_nmi(cpu6502_t *c);
+
+// Wired-OR interrupt lines. Every device owns one bit of source and asserts
+// (level = 1) or releases (level = 0) it, from any thread. IRQ is level
+// triggered, it is served at instruction boundaries while any source holds
+// it and I is clear. NMI is edge triggered, the first source pulling the
+// line makes one NMI. cpu6502_irq()/cpu6502_nmi() are a single request
+// each, served regardless of I.
+extern void cpu6502_irqline(cpu6502_t *c, uint32_t source, int level);
+extern void cpu6502_nmiline(cpu6502_t *c, uint32_t source, int level);
+
+// Cycle stepping: runs one bus cycle, with the reads and writes (dummy ones
+// included) the real chip does in it, through the read/write callbacks and
+// the memory map. Never uses the decode cache, translated blocks or native
+// code. Interrupts are taken at the start of an instruction and take 7
+// cycles, like in cpu6502_exec()/cpu6502_step(). Those first finish an
+// instruction started here.
+extern void cpu6502_cycle(cpu6502_t *c);
+
+// Decode cache: cache (enable=1) or stop caching (enable=0) instructions on
+// pages first..last. The core invalidates entries on its own writes, memory
+// changed behind its back must be reported with cpu6502_invalidate().
+extern int cpu6502_cache(cpu6502_t *c, uint8_t first, uint8_t last, int enable);
+extern void cpu6502_invalidate(cpu6502_t *c, uint16_t address);
+
+// Memory map: the core reads pages first..last straight from mem (the byte
+// at address first << 8) and, if writable, also writes them there instead
+// of calling read/write. mem = NULL hands the pages back to the callbacks.
+// Map RAM and ROM (read only, so writes still reach the callback), never
+// I/O. Both ways must see the same memory.
+extern void cpu6502_map(cpu6502_t *c, uint8_t first, uint8_t last, uint8_t *mem, int writable);
+
+// Cached instruction pairs from fake6502_pairs.h run as one. Name of pair n
+// (0, 1, ...), NULL past the last one, c->pairhits[n] counts its runs.
+extern const char *cpu6502_pairname(int n);
+
+// Native code: the loop hands over to run() whenever pc is on an address set
+// in map (8KB, bit (address & 7) of byte address >> 3), NULL turns it off.
+// run() accesses the bus through cpu6502_read()/cpu6502_write().
+extern void cpu6502_native(cpu6502_t *c, cpu6502_native_t run, const uint8_t *map);
+extern uint8_t cpu6502_read(cpu6502_t *c, uint16_t address);
+extern void cpu6502_write(cpu6502_t *c, uint16_t address, uint8_t value);
+
+// Global API (Fake6502 compatible), a wrapper around one context bound to
+// the externally supplied read6502()/write6502(). Left out with
+// -DFAKE6502_NOGLOBAL.
+//
+// read6502()/write6502() called by the interpreter see clockticks6502 at the
+// end of the instruction they belong to, and may call stop6502(): the
+// exec6502() running returns after that instruction, with clockgoal6502 =
+// clockticks6502 (the rest of tickcount is dropped). Neither holds for
+// accesses from native code (blocks only run on cached pages, not on I/O).
+extern void reset6502();
+extern void exec6502(uint32_t tickcount);
+extern void stop6502();
+extern void step6502();
+extern void cycle6502();
+extern void irq6502();
+extern void nmi6502();
+extern void irqline6502(uint32_t source, int level);
+extern void nmiline6502(uint32_t source, int level);
+extern void hookexternal(void *funcptr);
+extern int cache6502(uint8_t first, uint8_t last, int enable);
+extern void invalidate6502(uint16_t address);
+extern void map6502(uint8_t first, uint8_t last, uint8_t *mem, int writable);
+extern void native6502(cpu6502_native_t run, const uint8_t *map);
+extern uint32_t pairhits6502(int n);
+
+extern uint16_t pc;
+extern uint8_t sp, a, x, y, status;
+extern volatile uint32_t clockticks6502;
+extern uint32_t clockgoal6502;
+extern uint32_t instructions;
+
+#endif
@@ -0,0 +1,443 @@
+// Fake6502 cycle stepping, included by fake6502.c after the interpreter
+// loops. cpu6502_cycle() runs one bus cycle of the instruction in progress
+// and puts the same reads and writes on the bus as the real chip, dummy
+// accesses included, in the same order. The operations themselves are the
+// OPCODE() list again, run once their operand is on the data latch.
+//
+// Each opcode gets a micro program at init, one step per bus cycle after
+// the opcode fetch (T1). Steps that only happen sometimes (page fix-up,
+// taken branch, the 65C02 decimal cycle) are dropped by the step in front
+// of them, so an instruction ends on its last bus cycle and the cycle counts
+// are exactly the ones of ticktable and the loop.
+
+//micro steps
+enum {
+    U_IMPOP,        //dummy read of pc, operation (implied, accumulator)
+    U_DUMMYPC,      //dummy read of pc
+    U_IDLE,         //internal cycle, the 65C02 reads the last address again
+    U_IMM,          //read pc++, operation
+    U_ZP,           //ea = read pc++, the zero page address
+    U_ZPX, U_ZPY,   //dummy read while the index is added, in the zero page
+    U_LO,           //ea = read pc++, low byte
+    U_HI,           //ea |= read pc++ << 8
+    U_HIX, U_HIY,   //high byte, then add the index, U_FIX follows
+    U_FIX,          //page fix-up dummy, dropped by U_HIX/U_HIY/U_PTRHIY
+    U_PTR,          //ptr = read pc++, zero page pointer
+    U_INDX,         //dummy read while x is added to ptr
+    U_PTRLO,        //ea = read ptr
+    U_PTRHI,        //ea |= read ptr + 1 << 8 (zero page wraparound)
+    U_PTRHIY,       //same, then add y, U_FIX follows
+    U_IDLEX,        //internal cycle while x is added to ea (JMP (abs,X))
+    U_JMPHI,        //pc = ea | read pc << 8
+    U_JMPLO,        //data = read ea
+    U_JMPIND,       //pc = data | read ea + 1 << 8
+    U_READ,         //data = read ea, operation
+    U_BCD,          //65C02 decimal mode cycle, dropped for binary results
+    U_RMWREAD,      //data = read ea
+    U_RMWDUMMY,     //the 65C02 reads ea again, the NMOS part writes data back
+    U_WRITE,        //operation, write what it stored
+    U_STACK,        //dummy read of the stack
+    U_PULL,         //read the stack, operation
+    U_REL,          //offset = read pc++, operation, drops the branch cycles not taken
+    U_BRTAKEN,      //dummy read of the next instruction's address
+    U_BRFIX,        //dummy read while the high byte of pc is fixed
+    U_JSR,          //pc = ea | read pc << 8
+    U_PUSHPCH, U_PUSHPCL, U_PUSHP,
+    U_PULLP, U_PULLPCL, U_PULLPCH,
+    U_RTS,          //dummy read of the pulled address, pc + 1
+    U_BRK,          //read pc++, the signature byte
+    U_VECLO, U_VECHI
+};
+
+#define MICROMAX 12
+
+static uint8_t microprog[256][MICROMAX], microlen[256], micropenalty[256];
+static const uint8_t microint[] = { U_DUMMYPC, U_PUSHPCH, U_PUSHPCL, U_PUSHP, U_VECLO, U_VECHI };
+
+static const struct {
+    const char *mode, *op;
+} microops[256] = {
+#define OPCODE(n, mode, op) [n] = { #mode, #op },
+#include "fake6502_opcodes.h"
+#undef OPCODE
+};
+
+static int microis(const char *op, const char *const *names) {
+    for (; *names; names++)
+        if (!strncmp(op, *names, strlen(*names)) && !isalnum((unsigned char)op[strlen(*names)]))
+            return 1;
+    return 0;
+}
+
+static uint8_t microdone;
+
+//builds the micro program of every opcode from its mode and operation
+static void microbuild() {
+    static const char *const writes[] = { "STA", "STX", "STY", "STZ", "SAX", NULL };
+    static const char *const rmws[] = { "ASL", "LSR", "ROL", "ROR", "INC", "DEC", "TSB", "TRB", "RMB", "SMB",
+                                        "SLO", "RLA", "SRE", "RRA", "DCP", "ISB", NULL };
+    static const char *const pushes[] = { "PHA", "PHP", "PHX", "PHY", NULL };
+    static const char *const pulls[] = { "PLA", "PLP", "PLX", "PLY", NULL };
+    int n, len, cycles, s;
+    const char *mode, *op;
+    uint8_t *p;
+
+    for (n = 0; n < 256; n++) {
+        mode = microops[n].mode;
+        op = microops[n].op;
+        p = microprog[n];
+        len = 0;
+        micropenalty[n] = strstr(mode, "(1)") != NULL;
+
+        if (!strcmp(op, "BRK")) {
+            p[len++] = U_BRK; p[len++] = U_PUSHPCH; p[len++] = U_PUSHPCL; p[len++] = U_PUSHP;
+            p[len++] = U_VECLO; p[len++] = U_VECHI;
+        } else if (!strcmp(op, "JSR")) {
+            p[len++] = U_LO; p[len++] = U_STACK; p[len++] = U_PUSHPCH; p[len++] = U_PUSHPCL; p[len++] = U_JSR;
+        } else if (!strcmp(op, "RTS")) {
+            p[len++] = U_DUMMYPC; p[len++] = U_STACK; p[len++] = U_PULLPCL; p[len++] = U_PULLPCH; p[len++] = U_RTS;
+        } else if (!strcmp(op, "RTI")) {
+            p[len++] = U_DUMMYPC; p[len++] = U_STACK; p[len++] = U_PULLP; p[len++] = U_PULLPCL; p[len++] = U_PULLPCH;
+        } else if (!strcmp(op, "JMP")) {
+            p[len++] = U_LO;
+            if (!strcmp(mode, "ABSO"))
+                p[len++] = U_JMPHI;
+            else {
+                p[len++] = U_HI;
+                if (!strcmp(mode, "INDABSX")) p[len++] = U_IDLEX;
+#ifdef FAKE6502_65C02
+                else p[len++] = U_IDLE;
+#endif
+                p[len++] = U_JMPLO; p[len++] = U_JMPIND;
+            }
+        } else if (microis(op, pushes)) {
+            p[len++] = U_DUMMYPC; p[len++] = U_WRITE;
+        } else if (microis(op, pulls)) {
+            p[len++] = U_DUMMYPC; p[len++] = U_STACK; p[len++] = U_PULL;
+        } else if (!strcmp(op, "WAI") || !strcmp(op, "STP")) {
+            p[len++] = U_DUMMYPC; p[len++] = U_IMPOP;
+        } else if (!strcmp(mode, "IMP") || !strcmp(mode, "ACC")) {
+            p[len++] = U_IMPOP;
+        } else if (!strcmp(mode, "IMM")) {
+            p[len++] = U_IMM;
+        } else if (!strcmp(mode, "REL")) {
+            p[len++] = U_REL; p[len++] = U_BRTAKEN; p[len++] = U_BRFIX;
+        } else if (!strcmp(mode, "ZPREL")) {
+            p[len++] = U_ZP; p[len++] = U_RMWREAD; p[len++] = U_IDLE;
+            p[len++] = U_REL; p[len++] = U_BRTAKEN; p[len++] = U_BRFIX;
+        } else {
+            //memory operands, the address first
+            if (!strcmp(mode, "ZP")) {
+                p[len++] = U_ZP;
+            } else if (!strcmp(mode, "ZPX")) {
+                p[len++] = U_ZP; p[len++] = U_ZPX;
+            } else if (!strcmp(mode, "ZPY")) {
+                p[len++] = U_ZP; p[len++] = U_ZPY;
+            } else if (!strcmp(mode, "ABSO")) {
+                p[len++] = U_LO; p[len++] = U_HI;
+            } else if (!strncmp(mode, "ABSX", 4)) {
+                p[len++] = U_LO; p[len++] = U_HIX; p[len++] = U_FIX;
+            } else if (!strncmp(mode, "ABSY", 4)) {
+                p[len++] = U_LO; p[len++] = U_HIY; p[len++] = U_FIX;
+            } else if (!strcmp(mode, "INDX")) {
+                p[len++] = U_PTR; p[len++] = U_INDX; p[len++] = U_PTRLO; p[len++] = U_PTRHI;
+            } else if (!strncmp(mode, "INDY", 4)) {
+                p[len++] = U_PTR; p[len++] = U_PTRLO; p[len++] = U_PTRHIY; p[len++] = U_FIX;
+            } else if (!strcmp(mode, "INDZ")) {
+                p[len++] = U_PTR; p[len++] = U_PTRLO; p[len++] = U_PTRHI;
+            }
+
+            //then the data
+            if (microis(op, writes)) {
+                p[len++] = U_WRITE;
+            } else if (microis(op, rmws)) {
+                p[len++] = U_RMWREAD; p[len++] = U_RMWDUMMY; p[len++] = U_WRITE;
+            } else {
+                p[len++] = U_READ;
+            }
+        }
+#ifdef FAKE6502_65C02
+        if (!strncmp(op, "ADC", 3) || !strncmp(op, "SBC", 3))
+            p[len++] = U_BCD;
+#endif
+
+        //the cycles the program takes without the optional steps, the few
+        //NOPs the table has longer get internal cycles. the 65C02's single
+        //cycle NOPs end right after the fetch. any other difference to the
+        //cycle table is a bug in here, cycle stepping would drift from the
+        //loop
+        for (cycles = 1, s = 0; s < len; s++)
+            if (p[s] != U_BCD && p[s] != U_BRTAKEN && p[s] != U_BRFIX && (p[s] != U_FIX || !micropenalty[n]))
+                cycles++;
+        if (cycles > ticktable[n] && lentable[n] == 1 && ticktable[n] == 1) {
+            len = 0;
+            cycles = 1;
+        }
+        for (; cycles < ticktable[n] && len < MICROMAX; cycles++)
+            p[len++] = U_IDLE;
+        if (cycles != ticktable[n]) {
+            fprintf(stderr, "fake6502: opcode %02X (%s %s) takes %d cycles stepped, %d in the table\n",
+                    n, mode, op, cycles, ticktable[n]);
+            abort();
+        }
+        microlen[n] = len;
+    }
+}
+
+#define microinit() once(&microdone, microbuild)
+
+//the operation of opcode on the latched operand. returns the extra cycles
+//it took (branches, 65C02 decimal mode), the instruction is counted when
+//its last cycle is done
+#define RD(addr)       ((void)(addr), c->mdata) //addr for the side effects (++sp)
+#define WR(addr, val)  { c->mea = (uint16_t)(addr); c->mdata = (uint8_t)(val); }
+
+static uint32_t microop(cpu6502_t *c, uint8_t opcode, uint16_t operand) {
+    uint16_t pc = c->pc, ea = c->mea, reladdr, oldpc, value, result;
+    uint8_t sp = c->sp, a = c->a, x = c->x, y = c->y, status, zres, nres;
+    uint32_t clk = 0;
+    int32_t count = 0; //WAI and STP take theirs back
+
+    PUTSTATUS(c->status);
+    reladdr = (operand & 0x80) ? operand | 0xFF00 : operand;
+
+    switch (opcode) {
+#define OPCODE(n, mode, op) case n: op; break;
+#include "fake6502_opcodes.h"
+#undef OPCODE
+    }
+
+    c->pc = pc;
+    c->sp = sp;
+    c->a = a;
+    c->x = x;
+    c->y = y;
+    c->status = GETSTATUS;
+    c->instructions += count;
+    (void)ea; (void)oldpc; (void)value; (void)result;
+    return clk;
+}
+
+#undef RD
+#undef WR
+
+//one bus cycle, the address goes into maddr for the internal cycles
+static inline uint8_t microread(cpu6502_t *c, uint16_t address) {
+    c->maddr = address;
+    return cpu6502_read(c, address);
+}
+
+static inline void microwrite(cpu6502_t *c, uint16_t address, uint8_t value) {
+    c->maddr = address;
+    cpu6502_write(c, address, value);
+}
+
+#ifdef FAKE6502_65C02
+#define MICRODUMMY(nmos) microread(c, c->maddr)
+#else
+#define MICRODUMMY(nmos) microread(c, nmos)
+#endif
+
+void cpu6502_cycle(cpu6502_t *c) {
+    uint16_t t;
+    uint32_t extra;
+
+    c->clockticks++;
+
+    //T1: the opcode fetch, or the first cycle of an interrupt
+    if (!c->mprog) {
+        if (c->nmireq | c->irqreq | (c->irqline && !(c->status & FLAG_INTERRUPT))) {
+            if (c->waiting) {
+                c->waiting = 0;
+                c->pc++;
+            }
+            microread(c, c->pc);
+            if (__atomic_exchange_n(&c->nmireq, 0, __ATOMIC_ACQ_REL)) {
+                c->mea = 0xFFFA;
+            } else {
+                c->irqreq = 0;
+                c->mea = 0xFFFE;
+            }
+            c->mop = 0x00;
+            c->mprog = microint;
+            c->mend = sizeof(microint);
+        } else {
+            c->mop = microread(c, c->pc++);
+            c->mprog = microprog[c->mop];
+            c->mend = microlen[c->mop];
+            c->status |= FLAG_CONSTANT;
+        }
+        c->mstep = 0;
+        if (!c->mend) {
+            microop(c, c->mop, 0);
+            c->instructions++;
+            c->mprog = NULL;
+        }
+        return;
+    }
+
+again:
+    switch (c->mprog[c->mstep++]) {
+    case U_IMPOP:
+        microread(c, c->pc);
+        microop(c, c->mop, 0);
+        break;
+    case U_DUMMYPC:
+        microread(c, c->pc);
+        break;
+    case U_IDLE:
+        MICRODUMMY(c->maddr);
+        break;
+    case U_IMM:
+        c->mdata = microread(c, c->pc++);
+        extra = microop(c, c->mop, c->mdata);
+        if (!extra && c->mstep < c->mend && c->mprog[c->mstep] == U_BCD) c->mend = c->mstep;
+        break;
+    case U_ZP:
+        c->mea = microread(c, c->pc++);
+        break;
+    case U_ZPX:
+        MICRODUMMY(c->mea);
+        c->mea = (c->mea + c->x) & 0xFF;
+        break;
+    case U_ZPY:
+        MICRODUMMY(c->mea);
+        c->mea = (c->mea + c->y) & 0xFF;
+        break;
+    case U_LO:
+        c->mea = microread(c, c->pc++);
+        break;
+    case U_HI:
+        c->mea |= (uint16_t)microread(c, c->pc++) << 8;
+        break;
+    case U_HIX:
+    case U_HIY:
+        c->mbase = c->mea | ((uint16_t)microread(c, c->pc++) << 8);
+        c->mea = c->mbase + (c->mprog[c->mstep - 1] == U_HIX ? c->x : c->y);
+        c->mfix = !micropenalty[c->mop] || ((c->mbase ^ c->mea) & 0xFF00);
+        break;
+    case U_FIX:
+        if (!c->mfix) goto again;
+        MICRODUMMY((c->mbase & 0xFF00) | (c->mea & 0xFF));
+        break;
+    case U_PTR:
+        c->mptr = microread(c, c->pc++);
+        break;
+    case U_INDX:
+        MICRODUMMY(c->mptr);
+        c->mptr = (c->mptr + c->x) & 0xFF;
+        break;
+    case U_PTRLO:
+        c->mea = microread(c, c->mptr);
+        break;
+    case U_PTRHI:
+        c->mea |= (uint16_t)microread(c, (c->mptr + 1) & 0xFF) << 8;
+        break;
+    case U_PTRHIY:
+        c->mbase = c->mea | ((uint16_t)microread(c, (c->mptr + 1) & 0xFF) << 8);
+        c->mea = c->mbase + c->y;
+        c->mfix = !micropenalty[c->mop] || ((c->mbase ^ c->mea) & 0xFF00);
+        break;
+    case U_IDLEX:
+        MICRODUMMY(c->maddr);
+        c->mea += c->x;
+        break;
+    case U_JMPHI:
+        c->pc = c->mea | ((uint16_t)microread(c, c->pc) << 8);
+        break;
+    case U_JMPLO:
+        c->mdata = microread(c, c->mea);
+        break;
+    case U_JMPIND:
+#ifdef FAKE6502_65C02
+        t = c->mea + 1;
+#else
+        t = (c->mea & 0xFF00) | ((c->mea + 1) & 0xFF); //page wraparound bug
+#endif
+        c->pc = c->mdata | ((uint16_t)microread(c, t) << 8);
+        break;
+    case U_READ:
+        c->mdata = microread(c, c->mea);
+        extra = microop(c, c->mop, 0);
+        if (!extra && c->mstep < c->mend && c->mprog[c->mstep] == U_BCD) c->mend = c->mstep;
+        break;
+    case U_BCD:
+        microread(c, c->maddr);
+        break;
+    case U_RMWREAD:
+        c->mdata = microread(c, c->mea);
+        break;
+    case U_RMWDUMMY:
+#ifdef FAKE6502_65C02
+        microread(c, c->mea);
+#else
+        microwrite(c, c->mea, c->mdata);
+#endif
+        break;
+    case U_WRITE:
+        microop(c, c->mop, 0);
+        microwrite(c, c->mea, c->mdata);
+        break;
+    case U_STACK:
+        microread(c, BASE_STACK + c->sp);
+        break;
+    case U_PULL:
+        c->mdata = microread(c, BASE_STACK + ((c->sp + 1) & 0xFF));
+        microop(c, c->mop, 0);
+        break;
+    case U_REL:
+        c->mbase = c->pc + 1;
+        extra = microop(c, c->mop, microread(c, c->pc++));
+        if (extra < 2) c->mend = c->mstep + extra;
+        break;
+    case U_BRTAKEN:
+        MICRODUMMY(c->mbase);
+        break;
+    case U_BRFIX:
+        MICRODUMMY((c->mbase & 0xFF00) | (c->pc & 0xFF));
+        break;
+    case U_JSR:
+        c->pc = c->mea | ((uint16_t)microread(c, c->pc) << 8);
+        break;
+    case U_PUSHPCH:
+        microwrite(c, BASE_STACK + c->sp--, c->pc >> 8);
+        break;
+    case U_PUSHPCL:
+        microwrite(c, BASE_STACK + c->sp--, c->pc & 0xFF);
+        break;
+    case U_PUSHP:
+        microwrite(c, BASE_STACK + c->sp--, c->mprog == microint ? c->status : c->status | FLAG_BREAK);
+        c->status |= FLAG_INTERRUPT;
+#ifdef FAKE6502_65C02
+        c->status &= ~FLAG_DECIMAL;
+#endif
+        break;
+    case U_PULLP:
+        c->status = microread(c, BASE_STACK + ++c->sp);
+        break;
+    case U_PULLPCL:
+        c->mea = microread(c, BASE_STACK + ++c->sp);
+        break;
+    case U_PULLPCH:
+        c->pc = c->mea | ((uint16_t)microread(c, BASE_STACK + ++c->sp) << 8);
+        break;
+    case U_RTS:
+        microread(c, c->pc++);
+        break;
+    case U_BRK:
+        microread(c, c->pc++);
+        c->mea = 0xFFFE;
+        break;
+    case U_VECLO:
+        c->mdata = microread(c, c->mea);
+        break;
+    case U_VECHI:
+        c->pc = c->mdata | ((uint16_t)microread(c, c->mea + 1) << 8);
+        break;
+    }
+
+    if (c->mstep >= c->mend) {
+        if (c->mprog != microint) c->instructions++;
+        c->mprog = NULL;
+    }
+}
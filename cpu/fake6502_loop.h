@@ -0,0 +1,144 @@
+// Fake6502 interpreter loop, included by fake6502.c once per bus flavour.
+// Expects INTERPRET (the function name), BUSLOCALS, RD() and WR().
+
+static void INTERPRET(cpu6502_t *c, uint32_t goal) {
+    uint16_t pc = c->pc;
+    uint8_t sp = c->sp, a = c->a, x = c->x, y = c->y, status, zres, nres;
+    uint32_t clk = c->clockticks;
+    uint32_t count = 0;
+    BUSLOCALS
+    cpu6502_decoded_t *dpage, *d, *prev = NULL;
+    uint16_t operand, ea, reladdr, oldpc, eahelp, eahelp2, value, result;
+    uint8_t opcode, len;
+    uint16_t dispatch;
+    int skip = 0;
+
+    PUTSTATUS(c->status);
+
+#ifdef COMPUTED_GOTO
+#define ROW(h) &&op_0x##h##0, &&op_0x##h##1, &&op_0x##h##2, &&op_0x##h##3,\
+               &&op_0x##h##4, &&op_0x##h##5, &&op_0x##h##6, &&op_0x##h##7,\
+               &&op_0x##h##8, &&op_0x##h##9, &&op_0x##h##A, &&op_0x##h##B,\
+               &&op_0x##h##C, &&op_0x##h##D, &&op_0x##h##E, &&op_0x##h##F
+    static void *const optable[0xFF + PAIR_END] = {
+        ROW(0), ROW(1), ROW(2), ROW(3), ROW(4), ROW(5), ROW(6), ROW(7),
+        ROW(8), ROW(9), ROW(A), ROW(B), ROW(C), ROW(D), ROW(E), ROW(F),
+#define FUSE(name, op1, mode1, exec1, op2, mode2, exec2) &&pair_##name,
+#include "fake6502_pairs.h"
+#undef FUSE
+    };
+#undef ROW
+#endif
+
+next:
+    //clockticks wrap after 2^32 cycles, so compare the distance
+    if ((int32_t)(clk - goal) >= 0) goto done;
+
+    //interrupts take their 7 cycles, like cycle stepping and the chip
+    if (PENDING) {
+        clk += 7;
+        WAKEUP;
+        PUSH16(pc);
+        PUSH8(GETSTATUS);
+        INTERRUPTMASK;
+        if (__atomic_exchange_n(&c->nmireq, 0, __ATOMIC_ACQ_REL)) {
+            pc = RD(0xFFFA) | ((uint16_t)RD(0xFFFB) << 8);
+        } else {
+            c->irqreq = 0;
+            pc = RD(0xFFFE) | ((uint16_t)RD(0xFFFF) << 8);
+        }
+    }
+
+    //hand over to native code or translated blocks when there are any for
+    //pc. one instruction is always interpreted in between, either of them
+    //returning right at its first instruction would spin otherwise
+    if (!skip && NATIVEAT(pc)) {
+        SAVEREGS;
+        c->native(c, goal);
+        LOADREGS;
+        skip = 1;
+        goto next;
+    }
+#ifdef FAKE6502_JIT
+    if (!skip && JITAT(pc)) {
+        SAVEREGS;
+        jit6502_run(c, goal);
+        LOADREGS;
+        skip = 1;
+        goto next;
+    }
+#endif
+    skip = 0;
+
+    //fetch and decode, or take the instruction from the decode cache
+    dpage = c->decoded[pc >> 8];
+    if (dpage && dpage[pc & 0xFF].len) {
+        d = &dpage[pc & 0xFF];
+        opcode = d->opcode;
+        operand = d->operand;
+        len = d->len;
+        dispatch = d->dispatch;
+        clk += d->cycles;
+        JITHIT(d, pc);
+        prev = d;
+    } else {
+        opcode = RD(pc);
+        len = lentable[opcode];
+        operand = 0;
+        if (len > 1) operand = RD(pc + 1);
+        if (len > 2) operand |= (uint16_t)RD(pc + 2) << 8;
+        clk += ticktable[opcode];
+
+        if (dpage && (pc & 0xFF) + len <= 0x100) { //never cache across pages
+            d = &dpage[pc & 0xFF];
+            d->opcode = opcode;
+            d->operand = operand;
+            d->cycles = ticktable[opcode];
+            d->len = len;
+            d->hits = 0;
+
+            //fuse with the instruction behind it, and the one in front of
+            //it (on the same page) with this one
+            d->dispatch = (pc & 0xFF) + len < 0x100 && d[len].len ? fuse(opcode, d[len].opcode) : opcode;
+            if (prev && (pc & 0xFF) && prev + prev->len == d)
+                prev->dispatch = fuse(prev->opcode, opcode);
+            prev = d;
+        } else
+            prev = NULL;
+        dispatch = opcode;
+    }
+    pc += len;
+    status |= FLAG_CONSTANT;
+    count++;
+
+    DISPATCH(dispatch)
+#define OPCODE(n, mode, op) OP(n) mode; op; NEXT;
+#include "fake6502_opcodes.h"
+#undef OPCODE
+
+    //fused pairs, both instructions come from the decode cache. the second
+    //one only runs right away if the loop would have done the same: goal
+    //not reached, no interrupt pending, no native code or block at pc and
+    //not invalidated by the first one. otherwise back to the top
+#define FUSE(name, op1, mode1, exec1, op2, mode2, exec2) PAIROP(name) mode1; exec1;\
+    if ((int32_t)(clk - goal) >= 0 || PENDING || NATIVEAT(pc) || JITAT(pc)) NEXT;\
+    d = &dpage[pc & 0xFF];\
+    if (!d->len || d->opcode != op2) NEXT;\
+    operand = d->operand;\
+    clk += d->cycles;\
+    JITHIT(d, pc);\
+    prev = d;\
+    pc += d->len;\
+    count++;\
+    c->pairhits[PAIR_##name - 1]++;\
+    mode2; exec2; NEXT;
+#include "fake6502_pairs.h"
+#undef FUSE
+#ifndef COMPUTED_GOTO
+    }
+#endif
+
+done:
+    SAVEREGS;
+    c->instructions += count;
+}
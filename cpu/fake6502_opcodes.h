@@ -0,0 +1,520 @@
+// Fake6502 opcode list, one OPCODE(opcode, addressing mode, operation) per
+// opcode with the macros of fake6502_ops.h, for the CPU variant selected
+// there. Expanded by fake6502_loop.h into the dispatch loop and by
+// vic20/rom2c.c into the table it translates from.
+
+#ifdef FAKE6502_65C02
+OPCODE(0x00, IMP,      BRK)
+OPCODE(0x01, INDX,     ORA(MEM))
+OPCODE(0x02, IMM,      NOP)
+OPCODE(0x03, IMP,      NOP)
+OPCODE(0x04, ZP,       TSB)
+OPCODE(0x05, ZP,       ORA(MEM))
+OPCODE(0x06, ZP,       ASL)
+OPCODE(0x07, ZP,       RMB(0))
+OPCODE(0x08, IMP,      PHP)
+OPCODE(0x09, IMM,      ORA(IMMV))
+OPCODE(0x0A, ACC,      ASL_A)
+OPCODE(0x0B, IMP,      NOP)
+OPCODE(0x0C, ABSO,     TSB)
+OPCODE(0x0D, ABSO,     ORA(MEM))
+OPCODE(0x0E, ABSO,     ASL)
+OPCODE(0x0F, ZPREL,    BBR(0))
+OPCODE(0x10, REL,      BPL)
+OPCODE(0x11, INDY(1),  ORA(MEM))
+OPCODE(0x12, INDZ,     ORA(MEM))
+OPCODE(0x13, IMP,      NOP)
+OPCODE(0x14, ZP,       TRB)
+OPCODE(0x15, ZPX,      ORA(MEM))
+OPCODE(0x16, ZPX,      ASL)
+OPCODE(0x17, ZP,       RMB(1))
+OPCODE(0x18, IMP,      CLC)
+OPCODE(0x19, ABSY(1),  ORA(MEM))
+OPCODE(0x1A, ACC,      INC_A)
+OPCODE(0x1B, IMP,      NOP)
+OPCODE(0x1C, ABSO,     TRB)
+OPCODE(0x1D, ABSX(1),  ORA(MEM))
+OPCODE(0x1E, ABSX(1),  ASL)
+OPCODE(0x1F, ZPREL,    BBR(1))
+OPCODE(0x20, ABSO,     JSR)
+OPCODE(0x21, INDX,     AND(MEM))
+OPCODE(0x22, IMM,      NOP)
+OPCODE(0x23, IMP,      NOP)
+OPCODE(0x24, ZP,       BIT(MEM))
+OPCODE(0x25, ZP,       AND(MEM))
+OPCODE(0x26, ZP,       ROL)
+OPCODE(0x27, ZP,       RMB(2))
+OPCODE(0x28, IMP,      PLP)
+OPCODE(0x29, IMM,      AND(IMMV))
+OPCODE(0x2A, ACC,      ROL_A)
+OPCODE(0x2B, IMP,      NOP)
+OPCODE(0x2C, ABSO,     BIT(MEM))
+OPCODE(0x2D, ABSO,     AND(MEM))
+OPCODE(0x2E, ABSO,     ROL)
+OPCODE(0x2F, ZPREL,    BBR(2))
+OPCODE(0x30, REL,      BMI)
+OPCODE(0x31, INDY(1),  AND(MEM))
+OPCODE(0x32, INDZ,     AND(MEM))
+OPCODE(0x33, IMP,      NOP)
+OPCODE(0x34, ZPX,      BIT(MEM))
+OPCODE(0x35, ZPX,      AND(MEM))
+OPCODE(0x36, ZPX,      ROL)
+OPCODE(0x37, ZP,       RMB(3))
+OPCODE(0x38, IMP,      SEC)
+OPCODE(0x39, ABSY(1),  AND(MEM))
+OPCODE(0x3A, ACC,      DEC_A)
+OPCODE(0x3B, IMP,      NOP)
+OPCODE(0x3C, ABSX(1),  BIT(MEM))
+OPCODE(0x3D, ABSX(1),  AND(MEM))
+OPCODE(0x3E, ABSX(1),  ROL)
+OPCODE(0x3F, ZPREL,    BBR(3))
+OPCODE(0x40, IMP,      RTI)
+OPCODE(0x41, INDX,     EOR(MEM))
+OPCODE(0x42, IMM,      NOP)
+OPCODE(0x43, IMP,      NOP)
+OPCODE(0x44, ZP,       NOP)
+OPCODE(0x45, ZP,       EOR(MEM))
+OPCODE(0x46, ZP,       LSR)
+OPCODE(0x47, ZP,       RMB(4))
+OPCODE(0x48, IMP,      PHA)
+OPCODE(0x49, IMM,      EOR(IMMV))
+OPCODE(0x4A, ACC,      LSR_A)
+OPCODE(0x4B, IMP,      NOP)
+OPCODE(0x4C, ABSO,     JMP)
+OPCODE(0x4D, ABSO,     EOR(MEM))
+OPCODE(0x4E, ABSO,     LSR)
+OPCODE(0x4F, ZPREL,    BBR(4))
+OPCODE(0x50, REL,      BVC)
+OPCODE(0x51, INDY(1),  EOR(MEM))
+OPCODE(0x52, INDZ,     EOR(MEM))
+OPCODE(0x53, IMP,      NOP)
+OPCODE(0x54, ZPX,      NOP)
+OPCODE(0x55, ZPX,      EOR(MEM))
+OPCODE(0x56, ZPX,      LSR)
+OPCODE(0x57, ZP,       RMB(5))
+OPCODE(0x58, IMP,      CLI)
+OPCODE(0x59, ABSY(1),  EOR(MEM))
+OPCODE(0x5A, IMP,      PHY)
+OPCODE(0x5B, IMP,      NOP)
+OPCODE(0x5C, ABSO,     NOP)
+OPCODE(0x5D, ABSX(1),  EOR(MEM))
+OPCODE(0x5E, ABSX(1),  LSR)
+OPCODE(0x5F, ZPREL,    BBR(5))
+OPCODE(0x60, IMP,      RTS)
+OPCODE(0x61, INDX,     ADC(MEM))
+OPCODE(0x62, IMM,      NOP)
+OPCODE(0x63, IMP,      NOP)
+OPCODE(0x64, ZP,       STZ)
+OPCODE(0x65, ZP,       ADC(MEM))
+OPCODE(0x66, ZP,       ROR)
+OPCODE(0x67, ZP,       RMB(6))
+OPCODE(0x68, IMP,      PLA)
+OPCODE(0x69, IMM,      ADC(IMMV))
+OPCODE(0x6A, ACC,      ROR_A)
+OPCODE(0x6B, IMP,      NOP)
+OPCODE(0x6C, IND,      JMP)
+OPCODE(0x6D, ABSO,     ADC(MEM))
+OPCODE(0x6E, ABSO,     ROR)
+OPCODE(0x6F, ZPREL,    BBR(6))
+OPCODE(0x70, REL,      BVS)
+OPCODE(0x71, INDY(1),  ADC(MEM))
+OPCODE(0x72, INDZ,     ADC(MEM))
+OPCODE(0x73, IMP,      NOP)
+OPCODE(0x74, ZPX,      STZ)
+OPCODE(0x75, ZPX,      ADC(MEM))
+OPCODE(0x76, ZPX,      ROR)
+OPCODE(0x77, ZP,       RMB(7))
+OPCODE(0x78, IMP,      SEI)
+OPCODE(0x79, ABSY(1),  ADC(MEM))
+OPCODE(0x7A, IMP,      PLY)
+OPCODE(0x7B, IMP,      NOP)
+OPCODE(0x7C, INDABSX,  JMP)
+OPCODE(0x7D, ABSX(1),  ADC(MEM))
+OPCODE(0x7E, ABSX(1),  ROR)
+OPCODE(0x7F, ZPREL,    BBR(7))
+OPCODE(0x80, REL,      BRA)
+OPCODE(0x81, INDX,     STA)
+OPCODE(0x82, IMM,      NOP)
+OPCODE(0x83, IMP,      NOP)
+OPCODE(0x84, ZP,       STY)
+OPCODE(0x85, ZP,       STA)
+OPCODE(0x86, ZP,       STX)
+OPCODE(0x87, ZP,       SMB(0))
+OPCODE(0x88, IMP,      DEY)
+OPCODE(0x89, IMM,      BIT_IMM)
+OPCODE(0x8A, IMP,      TXA)
+OPCODE(0x8B, IMP,      NOP)
+OPCODE(0x8C, ABSO,     STY)
+OPCODE(0x8D, ABSO,     STA)
+OPCODE(0x8E, ABSO,     STX)
+OPCODE(0x8F, ZPREL,    BBS(0))
+OPCODE(0x90, REL,      BCC)
+OPCODE(0x91, INDY(0),  STA)
+OPCODE(0x92, INDZ,     STA)
+OPCODE(0x93, IMP,      NOP)
+OPCODE(0x94, ZPX,      STY)
+OPCODE(0x95, ZPX,      STA)
+OPCODE(0x96, ZPY,      STX)
+OPCODE(0x97, ZP,       SMB(1))
+OPCODE(0x98, IMP,      TYA)
+OPCODE(0x99, ABSY(0),  STA)
+OPCODE(0x9A, IMP,      TXS)
+OPCODE(0x9B, IMP,      NOP)
+OPCODE(0x9C, ABSO,     STZ)
+OPCODE(0x9D, ABSX(0),  STA)
+OPCODE(0x9E, ABSX(0),  STZ)
+OPCODE(0x9F, ZPREL,    BBS(1))
+OPCODE(0xA0, IMM,      LDY(IMMV))
+OPCODE(0xA1, INDX,     LDA(MEM))
+OPCODE(0xA2, IMM,      LDX(IMMV))
+OPCODE(0xA3, IMP,      NOP)
+OPCODE(0xA4, ZP,       LDY(MEM))
+OPCODE(0xA5, ZP,       LDA(MEM))
+OPCODE(0xA6, ZP,       LDX(MEM))
+OPCODE(0xA7, ZP,       SMB(2))
+OPCODE(0xA8, IMP,      TAY)
+OPCODE(0xA9, IMM,      LDA(IMMV))
+OPCODE(0xAA, IMP,      TAX)
+OPCODE(0xAB, IMP,      NOP)
+OPCODE(0xAC, ABSO,     LDY(MEM))
+OPCODE(0xAD, ABSO,     LDA(MEM))
+OPCODE(0xAE, ABSO,     LDX(MEM))
+OPCODE(0xAF, ZPREL,    BBS(2))
+OPCODE(0xB0, REL,      BCS)
+OPCODE(0xB1, INDY(1),  LDA(MEM))
+OPCODE(0xB2, INDZ,     LDA(MEM))
+OPCODE(0xB3, IMP,      NOP)
+OPCODE(0xB4, ZPX,      LDY(MEM))
+OPCODE(0xB5, ZPX,      LDA(MEM))
+OPCODE(0xB6, ZPY,      LDX(MEM))
+OPCODE(0xB7, ZP,       SMB(3))
+OPCODE(0xB8, IMP,      CLV)
+OPCODE(0xB9, ABSY(1),  LDA(MEM))
+OPCODE(0xBA, IMP,      TSX)
+OPCODE(0xBB, IMP,      NOP)
+OPCODE(0xBC, ABSX(1),  LDY(MEM))
+OPCODE(0xBD, ABSX(1),  LDA(MEM))
+OPCODE(0xBE, ABSY(1),  LDX(MEM))
+OPCODE(0xBF, ZPREL,    BBS(3))
+OPCODE(0xC0, IMM,      CPY(IMMV))
+OPCODE(0xC1, INDX,     CMP(MEM))
+OPCODE(0xC2, IMM,      NOP)
+OPCODE(0xC3, IMP,      NOP)
+OPCODE(0xC4, ZP,       CPY(MEM))
+OPCODE(0xC5, ZP,       CMP(MEM))
+OPCODE(0xC6, ZP,       DEC)
+OPCODE(0xC7, ZP,       SMB(4))
+OPCODE(0xC8, IMP,      INY)
+OPCODE(0xC9, IMM,      CMP(IMMV))
+OPCODE(0xCA, IMP,      DEX)
+OPCODE(0xCB, IMP,      WAI)
+OPCODE(0xCC, ABSO,     CPY(MEM))
+OPCODE(0xCD, ABSO,     CMP(MEM))
+OPCODE(0xCE, ABSO,     DEC)
+OPCODE(0xCF, ZPREL,    BBS(4))
+OPCODE(0xD0, REL,      BNE)
+OPCODE(0xD1, INDY(1),  CMP(MEM))
+OPCODE(0xD2, INDZ,     CMP(MEM))
+OPCODE(0xD3, IMP,      NOP)
+OPCODE(0xD4, ZPX,      NOP)
+OPCODE(0xD5, ZPX,      CMP(MEM))
+OPCODE(0xD6, ZPX,      DEC)
+OPCODE(0xD7, ZP,       SMB(5))
+OPCODE(0xD8, IMP,      CLD)
+OPCODE(0xD9, ABSY(1),  CMP(MEM))
+OPCODE(0xDA, IMP,      PHX)
+OPCODE(0xDB, IMP,      STP)
+OPCODE(0xDC, ABSO,     NOP)
+OPCODE(0xDD, ABSX(1),  CMP(MEM))
+OPCODE(0xDE, ABSX(0),  DEC)
+OPCODE(0xDF, ZPREL,    BBS(5))
+OPCODE(0xE0, IMM,      CPX(IMMV))
+OPCODE(0xE1, INDX,     SBC(MEM))
+OPCODE(0xE2, IMM,      NOP)
+OPCODE(0xE3, IMP,      NOP)
+OPCODE(0xE4, ZP,       CPX(MEM))
+OPCODE(0xE5, ZP,       SBC(MEM))
+OPCODE(0xE6, ZP,       INC)
+OPCODE(0xE7, ZP,       SMB(6))
+OPCODE(0xE8, IMP,      INX)
+OPCODE(0xE9, IMM,      SBC(IMMV))
+OPCODE(0xEA, IMP,      NOP)
+OPCODE(0xEB, IMP,      NOP)
+OPCODE(0xEC, ABSO,     CPX(MEM))
+OPCODE(0xED, ABSO,     SBC(MEM))
+OPCODE(0xEE, ABSO,     INC)
+OPCODE(0xEF, ZPREL,    BBS(6))
+OPCODE(0xF0, REL,      BEQ)
+OPCODE(0xF1, INDY(1),  SBC(MEM))
+OPCODE(0xF2, INDZ,     SBC(MEM))
+OPCODE(0xF3, IMP,      NOP)
+OPCODE(0xF4, ZPX,      NOP)
+OPCODE(0xF5, ZPX,      SBC(MEM))
+OPCODE(0xF6, ZPX,      INC)
+OPCODE(0xF7, ZP,       SMB(7))
+OPCODE(0xF8, IMP,      SED)
+OPCODE(0xF9, ABSY(1),  SBC(MEM))
+OPCODE(0xFA, IMP,      PLX)
+OPCODE(0xFB, IMP,      NOP)
+OPCODE(0xFC, ABSO,     NOP)
+OPCODE(0xFD, ABSX(1),  SBC(MEM))
+OPCODE(0xFE, ABSX(0),  INC)
+OPCODE(0xFF, ZPREL,    BBS(7))
+#else
+OPCODE(0x00, IMP,      BRK)
+OPCODE(0x01, INDX,     ORA(MEM))
+OPCODE(0x02, IMP,      NOP)
+OPCODE(0x03, INDX,     SLO)
+OPCODE(0x04, ZP,       NOP)
+OPCODE(0x05, ZP,       ORA(MEM))
+OPCODE(0x06, ZP,       ASL)
+OPCODE(0x07, ZP,       SLO)
+OPCODE(0x08, IMP,      PHP)
+OPCODE(0x09, IMM,      ORA(IMMV))
+OPCODE(0x0A, ACC,      ASL_A)
+OPCODE(0x0B, IMM,      NOP)
+OPCODE(0x0C, ABSO,     NOP)
+OPCODE(0x0D, ABSO,     ORA(MEM))
+OPCODE(0x0E, ABSO,     ASL)
+OPCODE(0x0F, ABSO,     SLO)
+OPCODE(0x10, REL,      BPL)
+OPCODE(0x11, INDY(1),  ORA(MEM))
+OPCODE(0x12, IMP,      NOP)
+OPCODE(0x13, INDY(0),  SLO)
+OPCODE(0x14, ZPX,      NOP)
+OPCODE(0x15, ZPX,      ORA(MEM))
+OPCODE(0x16, ZPX,      ASL)
+OPCODE(0x17, ZPX,      SLO)
+OPCODE(0x18, IMP,      CLC)
+OPCODE(0x19, ABSY(1),  ORA(MEM))
+OPCODE(0x1A, IMP,      NOP)
+OPCODE(0x1B, ABSY(0),  SLO)
+OPCODE(0x1C, ABSX(1),  NOP)
+OPCODE(0x1D, ABSX(1),  ORA(MEM))
+OPCODE(0x1E, ABSX(0),  ASL)
+OPCODE(0x1F, ABSX(0),  SLO)
+OPCODE(0x20, ABSO,     JSR)
+OPCODE(0x21, INDX,     AND(MEM))
+OPCODE(0x22, IMP,      NOP)
+OPCODE(0x23, INDX,     RLA)
+OPCODE(0x24, ZP,       BIT(MEM))
+OPCODE(0x25, ZP,       AND(MEM))
+OPCODE(0x26, ZP,       ROL)
+OPCODE(0x27, ZP,       RLA)
+OPCODE(0x28, IMP,      PLP)
+OPCODE(0x29, IMM,      AND(IMMV))
+OPCODE(0x2A, ACC,      ROL_A)
+OPCODE(0x2B, IMM,      NOP)
+OPCODE(0x2C, ABSO,     BIT(MEM))
+OPCODE(0x2D, ABSO,     AND(MEM))
+OPCODE(0x2E, ABSO,     ROL)
+OPCODE(0x2F, ABSO,     RLA)
+OPCODE(0x30, REL,      BMI)
+OPCODE(0x31, INDY(1),  AND(MEM))
+OPCODE(0x32, IMP,      NOP)
+OPCODE(0x33, INDY(0),  RLA)
+OPCODE(0x34, ZPX,      NOP)
+OPCODE(0x35, ZPX,      AND(MEM))
+OPCODE(0x36, ZPX,      ROL)
+OPCODE(0x37, ZPX,      RLA)
+OPCODE(0x38, IMP,      SEC)
+OPCODE(0x39, ABSY(1),  AND(MEM))
+OPCODE(0x3A, IMP,      NOP)
+OPCODE(0x3B, ABSY(0),  RLA)
+OPCODE(0x3C, ABSX(1),  NOP)
+OPCODE(0x3D, ABSX(1),  AND(MEM))
+OPCODE(0x3E, ABSX(0),  ROL)
+OPCODE(0x3F, ABSX(0),  RLA)
+OPCODE(0x40, IMP,      RTI)
+OPCODE(0x41, INDX,     EOR(MEM))
+OPCODE(0x42, IMP,      NOP)
+OPCODE(0x43, INDX,     SRE)
+OPCODE(0x44, ZP,       NOP)
+OPCODE(0x45, ZP,       EOR(MEM))
+OPCODE(0x46, ZP,       LSR)
+OPCODE(0x47, ZP,       SRE)
+OPCODE(0x48, IMP,      PHA)
+OPCODE(0x49, IMM,      EOR(IMMV))
+OPCODE(0x4A, ACC,      LSR_A)
+OPCODE(0x4B, IMM,      NOP)
+OPCODE(0x4C, ABSO,     JMP)
+OPCODE(0x4D, ABSO,     EOR(MEM))
+OPCODE(0x4E, ABSO,     LSR)
+OPCODE(0x4F, ABSO,     SRE)
+OPCODE(0x50, REL,      BVC)
+OPCODE(0x51, INDY(1),  EOR(MEM))
+OPCODE(0x52, IMP,      NOP)
+OPCODE(0x53, INDY(0),  SRE)
+OPCODE(0x54, ZPX,      NOP)
+OPCODE(0x55, ZPX,      EOR(MEM))
+OPCODE(0x56, ZPX,      LSR)
+OPCODE(0x57, ZPX,      SRE)
+OPCODE(0x58, IMP,      CLI)
+OPCODE(0x59, ABSY(1),  EOR(MEM))
+OPCODE(0x5A, IMP,      NOP)
+OPCODE(0x5B, ABSY(0),  SRE)
+OPCODE(0x5C, ABSX(1),  NOP)
+OPCODE(0x5D, ABSX(1),  EOR(MEM))
+OPCODE(0x5E, ABSX(0),  LSR)
+OPCODE(0x5F, ABSX(0),  SRE)
+OPCODE(0x60, IMP,      RTS)
+OPCODE(0x61, INDX,     ADC(MEM))
+OPCODE(0x62, IMP,      NOP)
+OPCODE(0x63, INDX,     RRA)
+OPCODE(0x64, ZP,       NOP)
+OPCODE(0x65, ZP,       ADC(MEM))
+OPCODE(0x66, ZP,       ROR)
+OPCODE(0x67, ZP,       RRA)
+OPCODE(0x68, IMP,      PLA)
+OPCODE(0x69, IMM,      ADC(IMMV))
+OPCODE(0x6A, ACC,      ROR_A)
+OPCODE(0x6B, IMM,      NOP)
+OPCODE(0x6C, IND,      JMP)
+OPCODE(0x6D, ABSO,     ADC(MEM))
+OPCODE(0x6E, ABSO,     ROR)
+OPCODE(0x6F, ABSO,     RRA)
+OPCODE(0x70, REL,      BVS)
+OPCODE(0x71, INDY(1),  ADC(MEM))
+OPCODE(0x72, IMP,      NOP)
+OPCODE(0x73, INDY(0),  RRA)
+OPCODE(0x74, ZPX,      NOP)
+OPCODE(0x75, ZPX,      ADC(MEM))
+OPCODE(0x76, ZPX,      ROR)
+OPCODE(0x77, ZPX,      RRA)
+OPCODE(0x78, IMP,      SEI)
+OPCODE(0x79, ABSY(1),  ADC(MEM))
+OPCODE(0x7A, IMP,      NOP)
+OPCODE(0x7B, ABSY(0),  RRA)
+OPCODE(0x7C, ABSX(1),  NOP)
+OPCODE(0x7D, ABSX(1),  ADC(MEM))
+OPCODE(0x7E, ABSX(0),  ROR)
+OPCODE(0x7F, ABSX(0),  RRA)
+OPCODE(0x80, IMM,      NOP)
+OPCODE(0x81, INDX,     STA)
+OPCODE(0x82, IMM,      NOP)
+OPCODE(0x83, INDX,     SAX)
+OPCODE(0x84, ZP,       STY)
+OPCODE(0x85, ZP,       STA)
+OPCODE(0x86, ZP,       STX)
+OPCODE(0x87, ZP,       SAX)
+OPCODE(0x88, IMP,      DEY)
+OPCODE(0x89, IMM,      NOP)
+OPCODE(0x8A, IMP,      TXA)
+OPCODE(0x8B, IMM,      NOP)
+OPCODE(0x8C, ABSO,     STY)
+OPCODE(0x8D, ABSO,     STA)
+OPCODE(0x8E, ABSO,     STX)
+OPCODE(0x8F, ABSO,     SAX)
+OPCODE(0x90, REL,      BCC)
+OPCODE(0x91, INDY(0),  STA)
+OPCODE(0x92, IMP,      NOP)
+OPCODE(0x93, INDY(0),  NOP)
+OPCODE(0x94, ZPX,      STY)
+OPCODE(0x95, ZPX,      STA)
+OPCODE(0x96, ZPY,      STX)
+OPCODE(0x97, ZPY,      SAX)
+OPCODE(0x98, IMP,      TYA)
+OPCODE(0x99, ABSY(0),  STA)
+OPCODE(0x9A, IMP,      TXS)
+OPCODE(0x9B, ABSY(0),  NOP)
+OPCODE(0x9C, ABSX(0),  NOP)
+OPCODE(0x9D, ABSX(0),  STA)
+OPCODE(0x9E, ABSY(0),  NOP)
+OPCODE(0x9F, ABSY(0),  NOP)
+OPCODE(0xA0, IMM,      LDY(IMMV))
+OPCODE(0xA1, INDX,     LDA(MEM))
+OPCODE(0xA2, IMM,      LDX(IMMV))
+OPCODE(0xA3, INDX,     LAX(MEM))
+OPCODE(0xA4, ZP,       LDY(MEM))
+OPCODE(0xA5, ZP,       LDA(MEM))
+OPCODE(0xA6, ZP,       LDX(MEM))
+OPCODE(0xA7, ZP,       LAX(MEM))
+OPCODE(0xA8, IMP,      TAY)
+OPCODE(0xA9, IMM,      LDA(IMMV))
+OPCODE(0xAA, IMP,      TAX)
+OPCODE(0xAB, IMM,      NOP)
+OPCODE(0xAC, ABSO,     LDY(MEM))
+OPCODE(0xAD, ABSO,     LDA(MEM))
+OPCODE(0xAE, ABSO,     LDX(MEM))
+OPCODE(0xAF, ABSO,     LAX(MEM))
+OPCODE(0xB0, REL,      BCS)
+OPCODE(0xB1, INDY(1),  LDA(MEM))
+OPCODE(0xB2, IMP,      NOP)
+OPCODE(0xB3, INDY(1),  LAX(MEM))
+OPCODE(0xB4, ZPX,      LDY(MEM))
+OPCODE(0xB5, ZPX,      LDA(MEM))
+OPCODE(0xB6, ZPY,      LDX(MEM))
+OPCODE(0xB7, ZPY,      LAX(MEM))
+OPCODE(0xB8, IMP,      CLV)
+OPCODE(0xB9, ABSY(1),  LDA(MEM))
+OPCODE(0xBA, IMP,      TSX)
+OPCODE(0xBB, ABSY(1),  LAX(MEM))
+OPCODE(0xBC, ABSX(1),  LDY(MEM))
+OPCODE(0xBD, ABSX(1),  LDA(MEM))
+OPCODE(0xBE, ABSY(1),  LDX(MEM))
+OPCODE(0xBF, ABSY(1),  LAX(MEM))
+OPCODE(0xC0, IMM,      CPY(IMMV))
+OPCODE(0xC1, INDX,     CMP(MEM))
+OPCODE(0xC2, IMM,      NOP)
+OPCODE(0xC3, INDX,     DCP)
+OPCODE(0xC4, ZP,       CPY(MEM))
+OPCODE(0xC5, ZP,       CMP(MEM))
+OPCODE(0xC6, ZP,       DEC)
+OPCODE(0xC7, ZP,       DCP)
+OPCODE(0xC8, IMP,      INY)
+OPCODE(0xC9, IMM,      CMP(IMMV))
+OPCODE(0xCA, IMP,      DEX)
+OPCODE(0xCB, IMM,      NOP)
+OPCODE(0xCC, ABSO,     CPY(MEM))
+OPCODE(0xCD, ABSO,     CMP(MEM))
+OPCODE(0xCE, ABSO,     DEC)
+OPCODE(0xCF, ABSO,     DCP)
+OPCODE(0xD0, REL,      BNE)
+OPCODE(0xD1, INDY(1),  CMP(MEM))
+OPCODE(0xD2, IMP,      NOP)
+OPCODE(0xD3, INDY(0),  DCP)
+OPCODE(0xD4, ZPX,      NOP)
+OPCODE(0xD5, ZPX,      CMP(MEM))
+OPCODE(0xD6, ZPX,      DEC)
+OPCODE(0xD7, ZPX,      DCP)
+OPCODE(0xD8, IMP,      CLD)
+OPCODE(0xD9, ABSY(1),  CMP(MEM))
+OPCODE(0xDA, IMP,      NOP)
+OPCODE(0xDB, ABSY(0),  DCP)
+OPCODE(0xDC, ABSX(1),  NOP)
+OPCODE(0xDD, ABSX(1),  CMP(MEM))
+OPCODE(0xDE, ABSX(0),  DEC)
+OPCODE(0xDF, ABSX(0),  DCP)
+OPCODE(0xE0, IMM,      CPX(IMMV))
+OPCODE(0xE1, INDX,     SBC(MEM))
+OPCODE(0xE2, IMM,      NOP)
+OPCODE(0xE3, INDX,     ISB)
+OPCODE(0xE4, ZP,       CPX(MEM))
+OPCODE(0xE5, ZP,       SBC(MEM))
+OPCODE(0xE6, ZP,       INC)
+OPCODE(0xE7, ZP,       ISB)
+OPCODE(0xE8, IMP,      INX)
+OPCODE(0xE9, IMM,      SBC(IMMV))
+OPCODE(0xEA, IMP,      NOP)
+OPCODE(0xEB, IMM,      SBC(IMMV))
+OPCODE(0xEC, ABSO,     CPX(MEM))
+OPCODE(0xED, ABSO,     SBC(MEM))
+OPCODE(0xEE, ABSO,     INC)
+OPCODE(0xEF, ABSO,     ISB)
+OPCODE(0xF0, REL,      BEQ)
+OPCODE(0xF1, INDY(1),  SBC(MEM))
+OPCODE(0xF2, IMP,      NOP)
+OPCODE(0xF3, INDY(0),  ISB)
+OPCODE(0xF4, ZPX,      NOP)
+OPCODE(0xF5, ZPX,      SBC(MEM))
+OPCODE(0xF6, ZPX,      INC)
+OPCODE(0xF7, ZPX,      ISB)
+OPCODE(0xF8, IMP,      SED)
+OPCODE(0xF9, ABSY(1),  SBC(MEM))
+OPCODE(0xFA, IMP,      NOP)
+OPCODE(0xFB, ABSY(0),  ISB)
+OPCODE(0xFC, ABSX(1),  NOP)
+OPCODE(0xFD, ABSX(1),  SBC(MEM))
+OPCODE(0xFE, ABSX(0),  INC)
+OPCODE(0xFF, ABSX(0),  ISB)
+#endif
@@ -0,0 +1,675 @@
+// Fake6502 flag, stack, addressing mode and operation macros plus the
+// per-opcode length and cycle tables. Shared by the interpreter loop and
+// the C generated from ROM images by vic20/rom2c.c, expects RD(), WR() and
+// the locals of fake6502_loop.h (a, x, y, sp, status, zres, nres, clk, ea, ...).
+
+#ifndef _FAKE6502_OPS_H_
+#define _FAKE6502_OPS_H_
+
+#include <stdint.h>
+
+//CPU variant, pick one with -D at compile time. every difference between
+//them is resolved in here and in fake6502_opcodes.h, the loop never checks
+//  FAKE6502_NMOS   NMOS 6502 with decimal mode and the undocumented opcodes
+//  FAKE6502_65C02  WDC 65C02, the chip on the bad6502 board
+//  FAKE6502_2A03   NES 2A03, an NMOS 6502 without decimal mode. this is
+//                  what Fake6502 always was, so it is the default
+#if !defined(FAKE6502_NMOS) && !defined(FAKE6502_65C02) && !defined(FAKE6502_2A03)
+#define FAKE6502_2A03
+#endif
+
+//6502 defines
+#ifndef FAKE6502_65C02
+#define UNDOCUMENTED //when this is defined, undocumented opcodes are handled.
+                     //otherwise, they're simply treated as NOPs.
+#endif
+
+#ifdef FAKE6502_2A03
+#define NES_CPU      //when this is defined, the binary-coded decimal (BCD)
+                     //status flag is not honored by ADC and SBC. the 2A03
+                     //CPU in the Nintendo Entertainment System does not
+                     //support BCD operation.
+#endif
+
+#define FLAG_CARRY     0x01
+#define FLAG_ZERO      0x02
+#define FLAG_INTERRUPT 0x04
+#define FLAG_DECIMAL   0x08
+#define FLAG_BREAK     0x10
+#define FLAG_CONSTANT  0x20
+#define FLAG_OVERFLOW  0x40
+#define FLAG_SIGN      0x80
+
+#define BASE_STACK     0x100
+
+#define saveaccum(n) a = (uint8_t)((n) & 0x00FF)
+
+
+//N and Z are evaluated lazily: the operations only record the byte each
+//of them comes from, Z is set when zres is 0 and N is bit 7 of nres. the
+//N and Z bits of status are stale, GETSTATUS puts them together whenever
+//the whole register is read (PHP, BRK, interrupts, leaving the loop) and
+//PUTSTATUS splits it up again. C and V are kept in status without branches
+#define GETSTATUS ((uint8_t)((status & ~(FLAG_SIGN | FLAG_ZERO)) | (nres & FLAG_SIGN) | (zres ? 0 : FLAG_ZERO)))
+#define PUTSTATUS(s) {\
+    status = (s);\
+    zres = !(status & FLAG_ZERO);\
+    nres = status;\
+}
+
+//flag modifier macros
+#define setcarry() status |= FLAG_CARRY
+#define clearcarry() status &= (~FLAG_CARRY)
+#define setzero() zres = 0
+#define clearzero() zres = 1
+#define setinterrupt() status |= FLAG_INTERRUPT
+#define clearinterrupt() status &= (~FLAG_INTERRUPT)
+#define setdecimal() status |= FLAG_DECIMAL
+#define cleardecimal() status &= (~FLAG_DECIMAL)
+#define setoverflow() status |= FLAG_OVERFLOW
+#define clearoverflow() status &= (~FLAG_OVERFLOW)
+#define setsign() nres = FLAG_SIGN
+#define clearsign() nres = 0
+
+
+//flag calculation macros
+#define zerocalc(n) zres = (uint8_t)(n)
+#define signcalc(n) nres = (uint8_t)(n)
+
+#define carryif(c) status = (status & ~FLAG_CARRY) | ((c) ? FLAG_CARRY : 0)
+#define carrycalc(n) carryif((n) & 0xFF00)
+
+#define overflowcalc(n, m, o) { /* n = result, m = accumulator, o = memory */ \
+    status = (status & ~FLAG_OVERFLOW) | ((((n) ^ (uint16_t)(m)) & ((n) ^ (o)) & 0x0080) >> 1);\
+}
+
+
+//an interrupt is served at the next instruction boundary: a request from
+//cpu6502_irq()/cpu6502_nmi() or an NMI edge, or the IRQ line held low while
+//I is clear
+#define PENDING (c->nmireq | c->irqreq | (c->irqline && !(status & FLAG_INTERRUPT)))
+
+
+//stack helpers, same bus order as push16()/pull16() in the reference core
+#define PUSH16(v) {\
+    WR(BASE_STACK + sp, ((v) >> 8) & 0xFF);\
+    WR(BASE_STACK + ((sp - 1) & 0xFF), (v) & 0xFF);\
+    sp -= 2;\
+}
+
+#define PUSH8(v) WR(BASE_STACK + sp--, (v))
+
+#define PULL16(v) {\
+    v = RD(BASE_STACK + ((sp + 1) & 0xFF)) | ((uint16_t)RD(BASE_STACK + ((sp + 2) & 0xFF)) << 8);\
+    sp += 2;\
+}
+
+#define PULL8() RD(BASE_STACK + ++sp)
+
+
+//addressing modes, these work on the operand fetched (or taken from the
+//decode cache) before dispatch and leave the effective address in ea. the
+//(p) argument of the indexed modes says whether the opcode takes the page
+//crossing penalty
+#define IMP
+#define ACC
+#define IMM
+#define ZP ea = operand
+#define ZPX ea = (operand + x) & 0xFF //zero-page wraparound
+#define ZPY ea = (operand + y) & 0xFF //zero-page wraparound
+#define REL {\
+    reladdr = operand;\
+    if (reladdr & 0x80) reladdr |= 0xFF00;\
+}
+
+#define ABSO ea = operand
+
+#define ABSIDX(i, p) {\
+    ea = operand;\
+    if ((p) && ((ea ^ (ea + (i))) & 0xFF00)) clk++; /*page crossing penalty*/\
+    ea += (i);\
+}
+
+#define ABSX(p) ABSIDX(x, p)
+#define ABSY(p) ABSIDX(y, p)
+
+#ifdef FAKE6502_65C02
+#define IND ea = RD(operand) | ((uint16_t)RD(operand + 1) << 8)
+
+#define INDABSX {\
+    eahelp2 = operand + x;\
+    ea = RD(eahelp2) | ((uint16_t)RD((uint16_t)(eahelp2 + 1)) << 8);\
+}
+
+#define INDZ ea = RD(operand) | ((uint16_t)RD((operand + 1) & 0xFF) << 8) /*zero-page wraparound*/
+
+#define ZPREL {\
+    ea = operand & 0xFF;\
+    reladdr = operand >> 8;\
+    if (reladdr & 0x80) reladdr |= 0xFF00;\
+}
+#else
+#define IND {\
+    eahelp2 = (operand & 0xFF00) | ((operand + 1) & 0x00FF); /*replicate 6502 page-boundary wraparound bug*/\
+    ea = RD(operand) | ((uint16_t)RD(eahelp2) << 8);\
+}
+#endif
+
+#define INDX {\
+    eahelp = (operand + x) & 0xFF; /*zero-page wraparound for table pointer*/\
+    ea = RD(eahelp) | ((uint16_t)RD((eahelp + 1) & 0xFF) << 8);\
+}
+
+#define INDY(p) {\
+    ea = RD(operand) | ((uint16_t)RD((operand + 1) & 0xFF) << 8); /*zero-page wraparound*/\
+    if ((p) && ((ea ^ (ea + y)) & 0xFF00)) clk++; /*page crossing penalty*/\
+    ea += y;\
+}
+
+//operand sources for the read operations
+#define MEM RD(ea)
+#define IMMV ((uint8_t)operand)
+
+
+//operations, on ea or on the accumulator for the _A variants
+//decimal mode. N, V and Z come from the binary result on the NMOS part,
+//the 65C02 sets N and Z from the BCD result and takes an extra cycle
+#ifdef NES_CPU
+#define BCDMODE 0
+#else
+#define BCDMODE (status & FLAG_DECIMAL)
+#endif
+
+#ifdef FAKE6502_65C02
+#define BCDFLAGS {\
+    zerocalc(a);\
+    signcalc(a);\
+}
+#define BCDCYCLE clk++
+#else
+#define BCDFLAGS
+#define BCDCYCLE
+#endif
+
+#define ADDCARRY {\
+    result = (uint16_t)a + value + (uint16_t)(status & FLAG_CARRY);\
+    carrycalc(result);\
+    zerocalc(result);\
+    overflowcalc(result, a, value);\
+    signcalc(result);\
+}
+
+//the decimal arithmetic itself. only used to fill the lookup tables below
+#define ADDBCD {\
+    int bcdlo = (a & 0x0F) + (value & 0x0F) + (status & FLAG_CARRY);\
+    if (bcdlo >= 0x0A) bcdlo = ((bcdlo + 0x06) & 0x0F) + 0x10;\
+    result = (a & 0xF0) + (value & 0xF0) + bcdlo;\
+    zerocalc(a + value + (status & FLAG_CARRY));\
+    signcalc(result);\
+    overflowcalc(result, a, value);\
+    if (result >= 0xA0) result += 0x60;\
+    carrycalc(result);\
+    saveaccum(result);\
+    BCDFLAGS;\
+}
+
+//(value is the inverted operand here, the flags are those of the binary
+//subtraction on both parts)
+#ifdef FAKE6502_65C02
+#define SUBBCD {\
+    int bcdlo = (a & 0x0F) - ((value ^ 0xFF) & 0x0F) + (status & FLAG_CARRY) - 1;\
+    int bcd = a - (value ^ 0xFF) + (status & FLAG_CARRY) - 1;\
+    if (bcd < 0) bcd -= 0x60;\
+    if (bcdlo < 0) bcd -= 0x06;\
+    ADDCARRY;\
+    saveaccum(bcd);\
+    BCDFLAGS;\
+}
+#else
+#define SUBBCD {\
+    int bcdlo = (a & 0x0F) - ((value ^ 0xFF) & 0x0F) + (status & FLAG_CARRY) - 1;\
+    int bcd;\
+    if (bcdlo < 0) bcdlo = ((bcdlo - 0x06) & 0x0F) - 0x10;\
+    bcd = (a & 0xF0) - ((value ^ 0xFF) & 0xF0) + bcdlo;\
+    if (bcd < 0) bcd -= 0x60;\
+    ADDCARRY;\
+    saveaccum(bcd);\
+}
+#endif
+
+//decimal ADC/SBC are looked up, [carry in][a][value] gives the new a in
+//the low byte and N, V, Z and C of the variant in the high byte (SBC is
+//indexed with the inverted operand, like value). the tables live in
+//fake6502.c and are filled by the first cpu6502_init()/reset
+#define BCDFLAGMASK (FLAG_SIGN | FLAG_OVERFLOW | FLAG_ZERO | FLAG_CARRY)
+#ifdef NES_CPU
+#define BCDLOOKUP(table) {}
+#else
+extern uint16_t bcdadc[2][256][256], bcdsbc[2][256][256];
+
+#define BCDLOOKUP(table) {\
+    result = table[status & FLAG_CARRY][a][(uint8_t)value];\
+    a = (uint8_t)result;\
+    status = (status & ~(FLAG_OVERFLOW | FLAG_CARRY)) | ((result >> 8) & (FLAG_OVERFLOW | FLAG_CARRY));\
+    zres = (~result >> 8) & FLAG_ZERO;\
+    nres = result >> 8;\
+    BCDCYCLE;\
+}
+#endif
+
+#define ADC(m) {\
+    value = (m);\
+    if (BCDMODE) BCDLOOKUP(bcdadc)\
+    else {\
+        ADDCARRY;\
+        saveaccum(result);\
+    }\
+}
+
+#define SBC(m) {\
+    value = (m) ^ 0x00FF;\
+    if (BCDMODE) BCDLOOKUP(bcdsbc)\
+    else {\
+        ADDCARRY;\
+        saveaccum(result);\
+    }\
+}
+
+#define LOGIC(op, m) {\
+    result = (uint16_t)a op (m);\
+    zerocalc(result);\
+    signcalc(result);\
+    saveaccum(result);\
+}
+
+#define AND(m) LOGIC(&, m)
+#define ORA(m) LOGIC(|, m)
+#define EOR(m) LOGIC(^, m)
+
+#define COMPARE(r, m) {\
+    value = (m);\
+    result = (uint16_t)(r) - value;\
+    carryif((r) >= (uint8_t)(value & 0x00FF));\
+    zerocalc(result);\
+    signcalc(result);\
+}
+
+#define CMP(m) COMPARE(a, m)
+#define CPX(m) COMPARE(x, m)
+#define CPY(m) COMPARE(y, m)
+
+#define BIT(m) {\
+    value = (m);\
+    result = (uint16_t)a & value;\
+    zerocalc(result);\
+    signcalc(value);\
+    status = (status & ~FLAG_OVERFLOW) | (uint8_t)(value & FLAG_OVERFLOW);\
+}
+
+#define LOAD(r, m) {\
+    r = (m);\
+    zerocalc(r);\
+    signcalc(r);\
+}
+
+#define LDA(m) LOAD(a, m)
+#define LDX(m) LOAD(x, m)
+#define LDY(m) LOAD(y, m)
+
+#define STA WR(ea, a)
+#define STX WR(ea, x)
+#define STY WR(ea, y)
+
+//read-modify-write, (v) is the operand and (put) stores the result
+#define SHL(v, put) {\
+    value = (v);\
+    result = value << 1;\
+    carrycalc(result);\
+    zerocalc(result);\
+    signcalc(result);\
+    put;\
+}
+
+#define SHR(v, put) {\
+    value = (v);\
+    result = value >> 1;\
+    carryif(value & 1);\
+    zerocalc(result);\
+    signcalc(result);\
+    put;\
+}
+
+#define ROTL(v, put) {\
+    value = (v);\
+    result = (value << 1) | (status & FLAG_CARRY);\
+    carrycalc(result);\
+    zerocalc(result);\
+    signcalc(result);\
+    put;\
+}
+
+#define ROTR(v, put) {\
+    value = (v);\
+    result = (value >> 1) | ((status & FLAG_CARRY) << 7);\
+    carryif(value & 1);\
+    zerocalc(result);\
+    signcalc(result);\
+    put;\
+}
+
+#define ASL SHL(RD(ea), WR(ea, result))
+#define LSR SHR(RD(ea), WR(ea, result))
+#define ROL ROTL(RD(ea), WR(ea, result))
+#define ROR ROTR(RD(ea), WR(ea, result))
+#define ASL_A SHL(a, saveaccum(result))
+#define LSR_A SHR(a, saveaccum(result))
+#define ROL_A ROTL(a, saveaccum(result))
+#define ROR_A ROTR(a, saveaccum(result))
+
+#define STEPMEM(d) {\
+    result = RD(ea) + (d);\
+    zerocalc(result);\
+    signcalc(result);\
+    WR(ea, result);\
+}
+
+#define INC STEPMEM(1)
+#define DEC STEPMEM(-1)
+
+#define STEPREG(r, d) {\
+    r += (d);\
+    zerocalc(r);\
+    signcalc(r);\
+}
+
+#define INX STEPREG(x, 1)
+#define INY STEPREG(y, 1)
+#define DEX STEPREG(x, -1)
+#define DEY STEPREG(y, -1)
+
+#define TRANSFER(d, s) {\
+    d = s;\
+    zerocalc(d);\
+    signcalc(d);\
+}
+
+#define TAX TRANSFER(x, a)
+#define TAY TRANSFER(y, a)
+#define TSX TRANSFER(x, sp)
+#define TXA TRANSFER(a, x)
+#define TYA TRANSFER(a, y)
+#define TXS sp = x
+
+#define CLC clearcarry()
+#define CLD cleardecimal()
+#define CLI clearinterrupt()
+#define CLV clearoverflow()
+#define SEC setcarry()
+#define SED setdecimal()
+#define SEI setinterrupt()
+
+#define BRANCH(cond) {\
+    if (cond) {\
+        oldpc = pc;\
+        pc += reladdr;\
+        if ((oldpc & 0xFF00) != (pc & 0xFF00)) clk += 2; /*check if jump crossed a page boundary*/\
+            else clk++;\
+    }\
+}
+
+#define BCC BRANCH((status & FLAG_CARRY) == 0)
+#define BCS BRANCH((status & FLAG_CARRY) == FLAG_CARRY)
+#define BNE BRANCH(zres != 0)
+#define BEQ BRANCH(zres == 0)
+#define BPL BRANCH((nres & FLAG_SIGN) == 0)
+#define BMI BRANCH((nres & FLAG_SIGN) != 0)
+#define BVC BRANCH((status & FLAG_OVERFLOW) == 0)
+#define BVS BRANCH((status & FLAG_OVERFLOW) == FLAG_OVERFLOW)
+
+#define JMP pc = ea
+
+#define JSR {\
+    PUSH16(pc - 1);\
+    pc = ea;\
+}
+
+#define RTS {\
+    PULL16(value);\
+    pc = value + 1;\
+}
+
+#define RTI {\
+    PUTSTATUS(PULL8());\
+    PULL16(value);\
+    pc = value;\
+}
+
+//interrupts and BRK set I, the 65C02 also leaves decimal mode
+#ifdef FAKE6502_65C02
+#define INTERRUPTMASK {\
+    setinterrupt();\
+    cleardecimal();\
+}
+#else
+#define INTERRUPTMASK setinterrupt()
+#endif
+
+#define BRK {\
+    pc++;\
+    PUSH16(pc); /*push next instruction address onto stack*/\
+    PUSH8(GETSTATUS | FLAG_BREAK); /*push CPU status to stack*/\
+    INTERRUPTMASK; /*set interrupt flag*/\
+    pc = RD(0xFFFE) | ((uint16_t)RD(0xFFFF) << 8);\
+}
+
+#define PHA PUSH8(a)
+#define PHP PUSH8(GETSTATUS | FLAG_BREAK)
+#define PLA {\
+    a = PULL8();\
+    zerocalc(a);\
+    signcalc(a);\
+}
+#define PLP PUTSTATUS(PULL8() | FLAG_CONSTANT)
+
+#define NOP
+
+//65C02 additions
+#ifdef FAKE6502_65C02
+#define BRA BRANCH(1)
+#define BBR(b) BRANCH((RD(ea) & (1 << (b))) == 0)
+#define BBS(b) BRANCH((RD(ea) & (1 << (b))) != 0)
+#define RMB(b) WR(ea, RD(ea) & ~(1 << (b)))
+#define SMB(b) WR(ea, RD(ea) | (1 << (b)))
+
+#define STZ WR(ea, 0)
+
+#define TESTBITS(v) {\
+    value = RD(ea);\
+    zerocalc(value & a);\
+    WR(ea, v);\
+}
+
+#define TSB TESTBITS(value | a)
+#define TRB TESTBITS(value & ~a)
+
+#define BIT_IMM zerocalc(IMMV & a)
+
+#define INC_A STEPREG(a, 1)
+#define DEC_A STEPREG(a, -1)
+
+#define PHX PUSH8(x)
+#define PHY PUSH8(y)
+#define PLX {\
+    x = PULL8();\
+    zerocalc(x);\
+    signcalc(x);\
+}
+#define PLY {\
+    y = PULL8();\
+    zerocalc(y);\
+    signcalc(y);\
+}
+
+//WAI stays put until an interrupt is pending, STP until the next reset.
+//serving the interrupt moves pc behind the WAI again (WAKEUP), an IRQ line
+//pulled while I is set just ends the wait
+#define WAI {\
+    if (!(c->nmireq | c->irqreq | c->irqline)) {\
+        pc--;\
+        count--;\
+        c->waiting = 1;\
+    } else\
+        c->waiting = 0;\
+}
+#define STP {\
+    pc--;\
+    count--;\
+}
+
+#define WAKEUP {\
+    if (c->waiting) {\
+        c->waiting = 0;\
+        pc++;\
+    }\
+}
+#else
+#define WAKEUP
+#endif
+
+//undocumented instructions
+#ifdef UNDOCUMENTED
+    #define LAX(m) {\
+        LDA(m);\
+        x = a;\
+        zerocalc(x);\
+        signcalc(x);\
+    }
+
+    #define SAX WR(ea, a & x)
+
+    #define DCP {\
+        DEC;\
+        CMP(MEM);\
+    }
+
+    #define ISB {\
+        INC;\
+        SBC(MEM);\
+    }
+
+    #define SLO {\
+        ASL;\
+        ORA(MEM);\
+    }
+
+    #define RLA {\
+        ROL;\
+        AND(MEM);\
+    }
+
+    #define SRE {\
+        LSR;\
+        EOR(MEM);\
+    }
+
+    #define RRA {\
+        ROR;\
+        ADC(MEM);\
+    }
+#else
+    #define LAX(m) NOP
+    #define SAX NOP
+    #define DCP NOP
+    #define ISB NOP
+    #define SLO NOP
+    #define RLA NOP
+    #define SRE NOP
+    #define RRA NOP
+#endif
+
+
+//instruction length and base cycle count per opcode, used when decoding.
+//cpu/opcheck6502.c holds the 65C02 ones against the datasheet
+#ifdef FAKE6502_65C02
+static const uint8_t lentable[256] = {
+/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
+/* 0 */      1,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* 0 */
+/* 1 */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3,  /* 1 */
+/* 2 */      3,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* 2 */
+/* 3 */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3,  /* 3 */
+/* 4 */      1,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* 4 */
+/* 5 */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3,  /* 5 */
+/* 6 */      1,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* 6 */
+/* 7 */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3,  /* 7 */
+/* 8 */      2,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* 8 */
+/* 9 */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3,  /* 9 */
+/* A */      2,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* A */
+/* B */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3,  /* B */
+/* C */      2,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* C */
+/* D */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3,  /* D */
+/* E */      2,    2,    2,    1,    2,    2,    2,    2,    1,    2,    1,    1,    3,    3,    3,    3,  /* E */
+/* F */      2,    2,    2,    1,    2,    2,    2,    2,    1,    3,    1,    1,    3,    3,    3,    3   /* F */
+};
+
+static const uint8_t ticktable[256] = {
+/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
+/* 0 */      7,    6,    2,    1,    5,    3,    5,    5,    3,    2,    2,    1,    6,    4,    6,    5,  /* 0 */
+/* 1 */      2,    5,    5,    1,    5,    4,    6,    5,    2,    4,    2,    1,    6,    4,    6,    5,  /* 1 */
+/* 2 */      6,    6,    2,    1,    3,    3,    5,    5,    4,    2,    2,    1,    4,    4,    6,    5,  /* 2 */
+/* 3 */      2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    2,    1,    4,    4,    6,    5,  /* 3 */
+/* 4 */      6,    6,    2,    1,    3,    3,    5,    5,    3,    2,    2,    1,    3,    4,    6,    5,  /* 4 */
+/* 5 */      2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    3,    1,    8,    4,    6,    5,  /* 5 */
+/* 6 */      6,    6,    2,    1,    3,    3,    5,    5,    4,    2,    2,    1,    6,    4,    6,    5,  /* 6 */
+/* 7 */      2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    4,    1,    6,    4,    6,    5,  /* 7 */
+/* 8 */      2,    6,    2,    1,    3,    3,    3,    5,    2,    2,    2,    1,    4,    4,    4,    5,  /* 8 */
+/* 9 */      2,    6,    5,    1,    4,    4,    4,    5,    2,    5,    2,    1,    4,    5,    5,    5,  /* 9 */
+/* A */      2,    6,    2,    1,    3,    3,    3,    5,    2,    2,    2,    1,    4,    4,    4,    5,  /* A */
+/* B */      2,    5,    5,    1,    4,    4,    4,    5,    2,    4,    2,    1,    4,    4,    4,    5,  /* B */
+/* C */      2,    6,    2,    1,    3,    3,    5,    5,    2,    2,    2,    3,    4,    4,    6,    5,  /* C */
+/* D */      2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    3,    3,    4,    4,    7,    5,  /* D */
+/* E */      2,    6,    2,    1,    3,    3,    5,    5,    2,    2,    2,    1,    4,    4,    6,    5,  /* E */
+/* F */      2,    5,    5,    1,    4,    4,    6,    5,    2,    4,    4,    1,    4,    4,    7,    5   /* F */
+};
+#else
+static const uint8_t lentable[256] = {
+/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
+/* 0 */      1,    2,    1,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* 0 */
+/* 1 */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3,  /* 1 */
+/* 2 */      3,    2,    1,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* 2 */
+/* 3 */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3,  /* 3 */
+/* 4 */      1,    2,    1,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* 4 */
+/* 5 */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3,  /* 5 */
+/* 6 */      1,    2,    1,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* 6 */
+/* 7 */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3,  /* 7 */
+/* 8 */      2,    2,    2,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* 8 */
+/* 9 */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3,  /* 9 */
+/* A */      2,    2,    2,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* A */
+/* B */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3,  /* B */
+/* C */      2,    2,    2,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* C */
+/* D */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3,  /* D */
+/* E */      2,    2,    2,    2,    2,    2,    2,    2,    1,    2,    1,    2,    3,    3,    3,    3,  /* E */
+/* F */      2,    2,    1,    2,    2,    2,    2,    2,    1,    3,    1,    3,    3,    3,    3,    3   /* F */
+};
+
+static const uint8_t ticktable[256] = {
+/*        |  0  |  1  |  2  |  3  |  4  |  5  |  6  |  7  |  8  |  9  |  A  |  B  |  C  |  D  |  E  |  F  |     */
+/* 0 */      7,    6,    2,    8,    3,    3,    5,    5,    3,    2,    2,    2,    4,    4,    6,    6,  /* 0 */
+/* 1 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 1 */
+/* 2 */      6,    6,    2,    8,    3,    3,    5,    5,    4,    2,    2,    2,    4,    4,    6,    6,  /* 2 */
+/* 3 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 3 */
+/* 4 */      6,    6,    2,    8,    3,    3,    5,    5,    3,    2,    2,    2,    3,    4,    6,    6,  /* 4 */
+/* 5 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 5 */
+/* 6 */      6,    6,    2,    8,    3,    3,    5,    5,    4,    2,    2,    2,    5,    4,    6,    6,  /* 6 */
+/* 7 */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* 7 */
+/* 8 */      2,    6,    2,    6,    3,    3,    3,    3,    2,    2,    2,    2,    4,    4,    4,    4,  /* 8 */
+/* 9 */      2,    6,    2,    6,    4,    4,    4,    4,    2,    5,    2,    5,    5,    5,    5,    5,  /* 9 */
+/* A */      2,    6,    2,    6,    3,    3,    3,    3,    2,    2,    2,    2,    4,    4,    4,    4,  /* A */
+/* B */      2,    5,    2,    5,    4,    4,    4,    4,    2,    4,    2,    4,    4,    4,    4,    4,  /* B */
+/* C */      2,    6,    2,    8,    3,    3,    5,    5,    2,    2,    2,    2,    4,    4,    6,    6,  /* C */
+/* D */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7,  /* D */
+/* E */      2,    6,    2,    8,    3,    3,    5,    5,    2,    2,    2,    2,    4,    4,    6,    6,  /* E */
+/* F */      2,    5,    2,    8,    4,    4,    6,    6,    2,    4,    2,    7,    4,    4,    7,    7   /* F */
+};
+#endif
+
+#endif
@@ -0,0 +1,19 @@
+// Fake6502 fused instruction pairs, one
+// FUSE(name, first opcode, mode, operation, second opcode, mode, operation)
+// per pair, with the macros of fake6502_ops.h. The decode cache marks the
+// first instruction of every pair it finds and fake6502_loop.h runs both
+// with a single dispatch. Keep the list short, the hit counters
+// (cpu6502_t.pairhits) tell which ones pay off. The first instruction must
+// not change pc, the second one can be anything.
+//
+// Room for CPU6502_PAIRS entries, see fake6502.h.
+
+FUSE(DEX_BNE,       0xCA, IMP,     DEX,        0xD0, REL,     BNE)
+FUSE(DEY_BNE,       0x88, IMP,     DEY,        0xD0, REL,     BNE)
+FUSE(INX_BNE,       0xE8, IMP,     INX,        0xD0, REL,     BNE)
+FUSE(INY_BNE,       0xC8, IMP,     INY,        0xD0, REL,     BNE)
+FUSE(CMPI_BNE,      0xC9, IMM,     CMP(IMMV),  0xD0, REL,     BNE)
+FUSE(CMPI_BEQ,      0xC9, IMM,     CMP(IMMV),  0xF0, REL,     BEQ)
+FUSE(LDAIY_STAAY,   0xB1, INDY(1), LDA(MEM),   0x99, ABSY(0), STA)
+FUSE(LDAIY_STAIY,   0xB1, INDY(1), LDA(MEM),   0x91, INDY(0), STA)
+FUSE(LDAZ_STAZ,     0xA5, ZP,      LDA(MEM),   0x85, ZP,      STA)
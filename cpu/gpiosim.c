@@ -0,0 +1,300 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// gpiosim: a simulated GPIO register block for bad65C02.c
+//
+// Built with -DGPIO_SIM, bad65C02.c accesses its GPIO registers through
+// gpiosim_read()/gpiosim_write() instead of the mapped /dev/mem page, so the
+// driver runs unchanged on any Linux box. The pins are wired like the board
+// to a software 65C02 (a fake6502 context) clocked by the CLOCK pin: after
+// the falling edge it puts out address and R/W, in the second half of a
+// write cycle it drives the data pins, and the falling edge that ends a read
+// cycle latches them. !RESET, !IRQ and (with -DGPIO_NMI) !NMI reach it the
+// same way.
+//
+// The model runs every bus cycle twice. Right after the falling edge a
+// scratch copy of its context runs it, to know the address it's going to
+// put out, the real one runs it at the next falling edge with the data that
+// was on the pins by then.
+//
+// Every register access is counted, and with gpiosim_count() the host
+// instructions spent outside of here, the driver's cost per bus cycle.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "fake6502.h"
+#include "gpiosim.h"
+
+// Registers
+#define GPFSEL0 0
+#define GPFSEL5 5
+#define GPSET0  7
+#define GPCLR0  10
+#define GPLEV0  13
+#define REGS    (4*1024/4)
+
+// Pins, as on the board
+#define PIN_RW    24
+#define PIN_CLOCK 25
+#define PIN_RESET 26
+#define PIN_IRQ   27
+
+// The 65C02 takes 7 cycles to come out of reset, the last two read the
+// vector
+#define RESET_CYCLES 7
+
+static uint32_t regs[REGS];
+static uint32_t out;     // output latches, GPSET0/GPCLR0
+static uint32_t outputs; // pins set to output in GPFSEL0-5
+
+// The model and what it puts on the bus in this cycle
+static cpu6502_t cpu, peek;
+static uint16_t busaddr;
+static uint8_t busrw;    // 1 = read
+static uint8_t busdata;  // driven in the second half of a write cycle
+static uint8_t latched;  // data pins at the falling edge that ended a read
+static int speculating, seen;
+static int resetstep;    // RESET_CYCLES = out of reset
+static uint16_t vector;
+
+static gpiosim_stats_t stats;
+
+// Host instruction counter, paused in here while counting
+static int pmu = -1;
+static int counting;
+static uint64_t pmuoverhead; // counted per access, x1000
+static uint32_t counted;     // accesses while counting
+
+#define PAUSE  if (counting) ioctl(pmu, PERF_EVENT_IOC_DISABLE, 0)
+#define RESUME if (counting) ioctl(pmu, PERF_EVENT_IOC_ENABLE, 0)
+
+static uint8_t simread(void *userdata, uint16_t address)
+{
+  if (speculating) {
+    if (!seen) {
+      busaddr = address;
+      busrw = 1;
+      seen = 1;
+    }
+    return 0;
+  }
+  if (address != busaddr || !busrw)
+    stats.mismatches++;
+  return latched;
+}
+
+static void simwrite(void *userdata, uint16_t address, uint8_t value)
+{
+  if (speculating) {
+    if (!seen) {
+      busaddr = address;
+      busrw = 0;
+      busdata = value;
+      seen = 1;
+    }
+    return;
+  }
+  if (address != busaddr || busrw || value != busdata)
+    stats.mismatches++;
+}
+
+// Pin levels: the output latches where the Pi drives them, the model where
+// it does, pulled up everywhere else
+static uint32_t pins()
+{
+  uint32_t model;
+
+  model = ~0x1FFFFFFu | ((uint32_t)busaddr << 8) | ((uint32_t)busrw << PIN_RW);
+  if (!busrw && ((out | ~outputs) & (1<<PIN_CLOCK)))
+    model |= busdata;
+  else
+    model |= 0xFF;
+  return (out & outputs) | (model & ~outputs);
+}
+
+// Start of a bus cycle, put out address and R/W
+static void startcycle()
+{
+  busrw = 1;
+  if (!(pins() & (1<<PIN_RESET))) {
+    resetstep = 0;
+    busaddr = cpu.pc;
+  } else if (resetstep < 2) {
+    busaddr = cpu.pc;
+  } else if (resetstep < 5) {
+    busaddr = 0x100 | cpu.sp--;
+  } else if (resetstep < RESET_CYCLES) {
+    busaddr = resetstep == 5 ? 0xFFFC : 0xFFFD;
+  } else {
+    // Only what the cycle changes, pointers and caches stay NULL in both
+    memcpy(&peek, &cpu, offsetof(cpu6502_t, decoded));
+    memcpy(&peek.mprog, &cpu.mprog, sizeof(cpu6502_t) - offsetof(cpu6502_t, mprog));
+    speculating = 1;
+    seen = 0;
+    cpu6502_cycle(&peek);
+    speculating = 0;
+  }
+}
+
+// End of a bus cycle, with the data that is on the pins now
+static void endcycle(uint8_t data)
+{
+  if (!(pins() & (1<<PIN_RESET)))
+    return;
+  if (resetstep < RESET_CYCLES) {
+    if (resetstep == 5)
+      vector = data;
+    if (resetstep == 6) {
+      cpu.pc = vector | ((uint16_t)data << 8);
+      cpu.status = (cpu.status | 0x24) & ~0x08; //I set, D clear
+      cpu.irqreq = cpu.nmireq = cpu.waiting = 0;
+      cpu.mprog = NULL;
+    }
+    resetstep++;
+    return;
+  }
+  latched = data;
+  cpu6502_cycle(&cpu);
+}
+
+static void falling(uint8_t data)
+{
+  uint32_t level = pins();
+
+  stats.cycles++;
+  endcycle(data);
+
+  // The interrupt lines go in before the next cycle runs on either copy
+  cpu6502_irqline(&cpu, 1, !(level & (1<<PIN_IRQ)));
+#ifdef GPIO_NMI
+  cpu6502_nmiline(&cpu, 1, !(level & (1<<GPIO_NMI)));
+#endif
+  startcycle();
+}
+
+void gpiosim_init()
+{
+  memset(regs, 0, sizeof(regs));
+  out = outputs = 0;
+  cpu6502_init(&cpu, simread, simwrite, NULL);
+  cpu6502_init(&peek, simread, simwrite, NULL);
+  resetstep = 0;
+  busaddr = 0;
+  busrw = 1;
+}
+
+unsigned gpiosim_read(int reg)
+{
+  unsigned value;
+
+  PAUSE;
+  stats.reads++;
+  counted += counting;
+  value = reg == GPLEV0 ? pins() : regs[reg];
+  RESUME;
+  return value;
+}
+
+void gpiosim_write(int reg, unsigned value)
+{
+  uint32_t before, g;
+
+  PAUSE;
+  stats.writes++;
+  counted += counting;
+  before = pins();
+
+  if (reg == GPSET0)
+    out |= value;
+  else if (reg == GPCLR0)
+    out &= ~value;
+  else {
+    regs[reg] = value;
+    if (reg >= GPFSEL0 && reg <= GPFSEL5) {
+      outputs = 0;
+      for (g=0; g<32; g++)
+        if (((regs[g/10] >> ((g%10)*3)) & 7) == 1)
+          outputs |= 1u << g;
+    }
+  }
+
+  if ((before & ~pins()) & (1<<PIN_CLOCK))
+    falling(before & 0xFF);
+  RESUME;
+}
+
+int gpiosim_count(int on)
+{
+  struct perf_event_attr pa;
+  uint64_t value;
+  int g;
+
+  if (pmu < 0) {
+    memset(&pa, 0, sizeof(pa));
+    pa.type = PERF_TYPE_HARDWARE;
+    pa.size = sizeof(pa);
+    pa.config = PERF_COUNT_HW_INSTRUCTIONS;
+    pa.disabled = 1;
+    pa.exclude_kernel = 1;
+    pa.exclude_hv = 1;
+    pmu = syscall(SYS_perf_event_open, &pa, 0, -1, -1, 0);
+    if (pmu < 0)
+      return 0;
+
+    // What pausing and resuming count themselves
+    ioctl(pmu, PERF_EVENT_IOC_RESET, 0);
+    counting = 1;
+    ioctl(pmu, PERF_EVENT_IOC_ENABLE, 0);
+    for (g=0; g<1000; g++) {
+      PAUSE;
+      RESUME;
+    }
+    ioctl(pmu, PERF_EVENT_IOC_DISABLE, 0);
+    counting = 0;
+    if (read(pmu, &value, sizeof(value)) != sizeof(value))
+      return 0;
+    pmuoverhead = value;
+  }
+
+  if (on) {
+    counted = 0;
+    ioctl(pmu, PERF_EVENT_IOC_RESET, 0);
+    counting = 1;
+    ioctl(pmu, PERF_EVENT_IOC_ENABLE, 0);
+  } else if (counting) {
+    ioctl(pmu, PERF_EVENT_IOC_DISABLE, 0);
+    counting = 0;
+    if (read(pmu, &value, sizeof(value)) != sizeof(value))
+      return 0;
+    value -= counted * pmuoverhead / 1000;
+    stats.host += value;
+  }
+  return 1;
+}
+
+void gpiosim_stats(gpiosim_stats_t *s)
+{
+  *s = stats;
+  s->instructions = cpu.instructions;
+}
@@ -0,0 +1,25 @@
+#ifndef _GPIOSIM_H_
+#define _GPIOSIM_H_
+
+#include <stdint.h>
+
+// Simulated GPIO register block with a software 65C02 on the pins, the
+// backend of bad65C02.c built with -DGPIO_SIM, see gpiosim.c
+typedef struct {
+  uint32_t cycles;        // falling edges of CLOCK
+  uint32_t reads, writes; // register accesses
+  uint32_t mismatches;    // cycles the model didn't access the address it put out
+  uint32_t instructions;  // 6502 instructions the model ran
+  uint64_t host;          // host instructions outside the model, while counting
+} gpiosim_stats_t;
+
+extern void gpiosim_init();
+extern unsigned gpiosim_read(int reg);
+extern void gpiosim_write(int reg, unsigned value);
+
+// Count host instructions (on = 1) until called with on = 0, all but the
+// ones spent in here. Returns 0 if the host has no instruction counter.
+extern int gpiosim_count(int on);
+extern void gpiosim_stats(gpiosim_stats_t *s);
+
+#endif
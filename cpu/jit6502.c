@@ -0,0 +1,1078 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// jit6502: translates hot basic blocks of the fake core to x86-64
+//
+// A block is a straight run of instructions on one decode-cached page. The
+// generated code keeps A, X, Y and P in host registers, reads and writes
+// mapped pages (cpu6502_map) directly and everything else through the bus
+// callbacks, and adds the exact cycle count of each instruction (page
+// crossing penalties included) to clockticks. It leaves the block
+//  - at its end, after a branch, JMP, JSR or RTS
+//  - before an indexed or indirect access that hits a page that is not
+//    cached, so I/O is always done by the interpreter on an exact cycle
+//  - right after a write that hit translated code
+// Anything else the translator doesn't know (decimal mode, BRK/RTI/PLP,
+// undocumented opcodes, JMP indirect) ends the block before it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "jit6502.h"
+
+#if defined(__x86_64__)
+#include <sys/mman.h>
+#endif
+
+#define FLAG_CARRY     0x01
+#define FLAG_ZERO      0x02
+#define FLAG_INTERRUPT 0x04
+#define FLAG_DECIMAL   0x08
+#define FLAG_BREAK     0x10
+#define FLAG_CONSTANT  0x20
+#define FLAG_OVERFLOW  0x40
+#define FLAG_SIGN      0x80
+
+#define BASE_STACK     0x100
+
+#define ARENA_SIZE     (4 << 20)
+#define BLOCK_ROOM     (JIT6502_MAXINS * 256) //worst case code size of a block
+#define MAX_BLOCKS     16384
+
+//externally supplied functions (global API only)
+extern uint8_t read6502(uint16_t address);
+extern void write6502(uint16_t address, uint8_t value);
+
+//block bookkeeping
+static void dropblock(struct jit6502 *j, jitpage_t *jp, jitblock_t *b) {
+    int i;
+
+    for (i = b->start & 0xFF; i < (b->start & 0xFF) + b->len; i++)
+        jp->covered[i]--;
+    jp->block[b->start & 0xFF] = NULL;
+    j->invalidated++;
+}
+
+int jit6502_invalidate(cpu6502_t *c, uint16_t address) {
+    struct jit6502 *j = c->jit;
+    jitpage_t *jp = j->pages[address >> 8];
+    int off = address & 0xFF, start, hit = 0;
+    jitblock_t *b;
+
+    if (!jp || !jp->covered[off]) return 0;
+
+    //a block is at most JIT6502_MAXINS * 3 bytes long
+    start = off - JIT6502_MAXINS * 3;
+    if (start < 0) start = 0;
+    for (; start <= off; start++) {
+        b = jp->block[start];
+        if (b && b->len > off - start) {
+            dropblock(j, jp, b);
+            if (jp->fails[start] < 255) jp->fails[start]++;
+            hit = 1;
+        }
+    }
+    return hit;
+}
+
+void jit6502_droppage(cpu6502_t *c, uint8_t page) {
+    struct jit6502 *j = c->jit;
+    int off;
+
+    if (!j || !j->pages[page]) return;
+    for (off = 0; off < 256; off++)
+        if (j->pages[page]->block[off])
+            dropblock(j, j->pages[page], j->pages[page]->block[off]);
+}
+
+//runs blocks until there is none for pc, one could run past the goal, an
+//interrupt is pending or a block hands an instruction to the interpreter
+void jit6502_run(cpu6502_t *c, uint32_t goal) {
+    c->jit->enter(c, goal);
+}
+
+
+#if defined(__x86_64__)
+
+//what the translator knows about each opcode
+enum {
+    K_NONE = 0,
+    K_LDA, K_LDX, K_LDY, K_ADC, K_SBC, K_AND, K_ORA, K_EOR, K_CMP, K_CPX, K_CPY, K_BIT,
+    K_STA, K_STX, K_STY,
+    K_ASL, K_LSR, K_ROL, K_ROR, K_INC, K_DEC,
+    K_INX, K_INY, K_DEX, K_DEY, K_TAX, K_TAY, K_TXA, K_TYA, K_TSX, K_TXS,
+    K_CLC, K_SEC, K_CLI, K_SEI, K_CLV, K_CLD, K_NOP,
+    K_PHA, K_PHP, K_PLA,
+    K_BPL, K_BMI, K_BVC, K_BVS, K_BCC, K_BCS, K_BNE, K_BEQ,
+    K_JMP, K_JSR, K_RTS
+};
+
+enum { M_IMP, M_ACC, M_IMM, M_ZP, M_ZPX, M_ZPY, M_ABS, M_ABSX, M_ABSY, M_INDX, M_INDY, M_REL };
+
+static const struct { uint8_t kind, mode; } optable[256] = {
+    [0xA9] = {K_LDA, M_IMM}, [0xA5] = {K_LDA, M_ZP}, [0xB5] = {K_LDA, M_ZPX}, [0xAD] = {K_LDA, M_ABS},
+    [0xBD] = {K_LDA, M_ABSX}, [0xB9] = {K_LDA, M_ABSY}, [0xA1] = {K_LDA, M_INDX}, [0xB1] = {K_LDA, M_INDY},
+    [0xA2] = {K_LDX, M_IMM}, [0xA6] = {K_LDX, M_ZP}, [0xB6] = {K_LDX, M_ZPY}, [0xAE] = {K_LDX, M_ABS},
+    [0xBE] = {K_LDX, M_ABSY},
+    [0xA0] = {K_LDY, M_IMM}, [0xA4] = {K_LDY, M_ZP}, [0xB4] = {K_LDY, M_ZPX}, [0xAC] = {K_LDY, M_ABS},
+    [0xBC] = {K_LDY, M_ABSX},
+    [0x69] = {K_ADC, M_IMM}, [0x65] = {K_ADC, M_ZP}, [0x75] = {K_ADC, M_ZPX}, [0x6D] = {K_ADC, M_ABS},
+    [0x7D] = {K_ADC, M_ABSX}, [0x79] = {K_ADC, M_ABSY}, [0x61] = {K_ADC, M_INDX}, [0x71] = {K_ADC, M_INDY},
+    [0xE9] = {K_SBC, M_IMM}, [0xE5] = {K_SBC, M_ZP}, [0xF5] = {K_SBC, M_ZPX}, [0xED] = {K_SBC, M_ABS},
+    [0xFD] = {K_SBC, M_ABSX}, [0xF9] = {K_SBC, M_ABSY}, [0xE1] = {K_SBC, M_INDX}, [0xF1] = {K_SBC, M_INDY},
+    [0x29] = {K_AND, M_IMM}, [0x25] = {K_AND, M_ZP}, [0x35] = {K_AND, M_ZPX}, [0x2D] = {K_AND, M_ABS},
+    [0x3D] = {K_AND, M_ABSX}, [0x39] = {K_AND, M_ABSY}, [0x21] = {K_AND, M_INDX}, [0x31] = {K_AND, M_INDY},
+    [0x09] = {K_ORA, M_IMM}, [0x05] = {K_ORA, M_ZP}, [0x15] = {K_ORA, M_ZPX}, [0x0D] = {K_ORA, M_ABS},
+    [0x1D] = {K_ORA, M_ABSX}, [0x19] = {K_ORA, M_ABSY}, [0x01] = {K_ORA, M_INDX}, [0x11] = {K_ORA, M_INDY},
+    [0x49] = {K_EOR, M_IMM}, [0x45] = {K_EOR, M_ZP}, [0x55] = {K_EOR, M_ZPX}, [0x4D] = {K_EOR, M_ABS},
+    [0x5D] = {K_EOR, M_ABSX}, [0x59] = {K_EOR, M_ABSY}, [0x41] = {K_EOR, M_INDX}, [0x51] = {K_EOR, M_INDY},
+    [0xC9] = {K_CMP, M_IMM}, [0xC5] = {K_CMP, M_ZP}, [0xD5] = {K_CMP, M_ZPX}, [0xCD] = {K_CMP, M_ABS},
+    [0xDD] = {K_CMP, M_ABSX}, [0xD9] = {K_CMP, M_ABSY}, [0xC1] = {K_CMP, M_INDX}, [0xD1] = {K_CMP, M_INDY},
+    [0xE0] = {K_CPX, M_IMM}, [0xE4] = {K_CPX, M_ZP}, [0xEC] = {K_CPX, M_ABS},
+    [0xC0] = {K_CPY, M_IMM}, [0xC4] = {K_CPY, M_ZP}, [0xCC] = {K_CPY, M_ABS},
+    [0x24] = {K_BIT, M_ZP}, [0x2C] = {K_BIT, M_ABS},
+    [0x85] = {K_STA, M_ZP}, [0x95] = {K_STA, M_ZPX}, [0x8D] = {K_STA, M_ABS}, [0x9D] = {K_STA, M_ABSX},
+    [0x99] = {K_STA, M_ABSY}, [0x81] = {K_STA, M_INDX}, [0x91] = {K_STA, M_INDY},
+    [0x86] = {K_STX, M_ZP}, [0x96] = {K_STX, M_ZPY}, [0x8E] = {K_STX, M_ABS},
+    [0x84] = {K_STY, M_ZP}, [0x94] = {K_STY, M_ZPX}, [0x8C] = {K_STY, M_ABS},
+    [0x0A] = {K_ASL, M_ACC}, [0x06] = {K_ASL, M_ZP}, [0x16] = {K_ASL, M_ZPX}, [0x0E] = {K_ASL, M_ABS},
+    [0x1E] = {K_ASL, M_ABSX},
+    [0x4A] = {K_LSR, M_ACC}, [0x46] = {K_LSR, M_ZP}, [0x56] = {K_LSR, M_ZPX}, [0x4E] = {K_LSR, M_ABS},
+    [0x5E] = {K_LSR, M_ABSX},
+    [0x2A] = {K_ROL, M_ACC}, [0x26] = {K_ROL, M_ZP}, [0x36] = {K_ROL, M_ZPX}, [0x2E] = {K_ROL, M_ABS},
+    [0x3E] = {K_ROL, M_ABSX},
+    [0x6A] = {K_ROR, M_ACC}, [0x66] = {K_ROR, M_ZP}, [0x76] = {K_ROR, M_ZPX}, [0x6E] = {K_ROR, M_ABS},
+    [0x7E] = {K_ROR, M_ABSX},
+    [0xE6] = {K_INC, M_ZP}, [0xF6] = {K_INC, M_ZPX}, [0xEE] = {K_INC, M_ABS}, [0xFE] = {K_INC, M_ABSX},
+    [0xC6] = {K_DEC, M_ZP}, [0xD6] = {K_DEC, M_ZPX}, [0xCE] = {K_DEC, M_ABS}, [0xDE] = {K_DEC, M_ABSX},
+    [0xE8] = {K_INX, M_IMP}, [0xC8] = {K_INY, M_IMP}, [0xCA] = {K_DEX, M_IMP}, [0x88] = {K_DEY, M_IMP},
+    [0xAA] = {K_TAX, M_IMP}, [0xA8] = {K_TAY, M_IMP}, [0x8A] = {K_TXA, M_IMP}, [0x98] = {K_TYA, M_IMP},
+    [0xBA] = {K_TSX, M_IMP}, [0x9A] = {K_TXS, M_IMP},
+    [0x18] = {K_CLC, M_IMP}, [0x38] = {K_SEC, M_IMP}, [0x58] = {K_CLI, M_IMP}, [0x78] = {K_SEI, M_IMP},
+    [0xB8] = {K_CLV, M_IMP}, [0xD8] = {K_CLD, M_IMP}, [0xEA] = {K_NOP, M_IMP},
+    [0x48] = {K_PHA, M_IMP}, [0x08] = {K_PHP, M_IMP}, [0x68] = {K_PLA, M_IMP},
+    [0x10] = {K_BPL, M_REL}, [0x30] = {K_BMI, M_REL}, [0x50] = {K_BVC, M_REL}, [0x70] = {K_BVS, M_REL},
+    [0x90] = {K_BCC, M_REL}, [0xB0] = {K_BCS, M_REL}, [0xD0] = {K_BNE, M_REL}, [0xF0] = {K_BEQ, M_REL},
+    [0x4C] = {K_JMP, M_ABS}, [0x20] = {K_JSR, M_ABS}, [0x60] = {K_RTS, M_IMP}
+};
+
+//N and Z for every byte value
+static uint8_t nztable[256];
+
+
+//bus helpers called from generated code
+static uint8_t readglobal(void *userdata, uint16_t address) {
+    return read6502(address);
+}
+
+//same as the interpreter's writes (MAPWRITE), returns 1 if translated code
+//was hit
+static int writehelper(cpu6502_t *c, uint16_t address, uint8_t value) {
+    cpu6502_decoded_t *dpage = c->decoded[address >> 8];
+    uint8_t *wp = c->writemap[address >> 8];
+    jitpage_t *jp;
+    uint8_t off = address & 0xFF;
+
+    if (wp) wp[off] = value;
+        else if (c->write) c->write(c->userdata, address, value);
+        else write6502(address, value);
+    if (!dpage) return 0;
+
+    dpage[off].len = 0;
+    if (off >= 1) dpage[off - 1].len = 0;
+    if (off >= 2) dpage[off - 2].len = 0;
+    jp = c->jit->pages[address >> 8];
+    return jp && jp->covered[off] && jit6502_invalidate(c, address);
+}
+
+static uint8_t readbyte(cpu6502_t *c, uint16_t address) {
+    uint8_t *p = c->readmap[address >> 8];
+
+    if (p) return p[address & 0xFF];
+    return c->read ? c->read(c->userdata, address) : read6502(address);
+}
+
+
+//drops every block, the arena is reused from the start
+static void flush(struct jit6502 *j) {
+    int page;
+
+    for (page = 0; page < 256; page++)
+        if (j->pages[page]) {
+            memset(j->pages[page]->block, 0, sizeof(j->pages[page]->block));
+            memset(j->pages[page]->covered, 0, sizeof(j->pages[page]->covered));
+        }
+    j->used = j->base;
+    j->nblocks = 0;
+    j->flushes++;
+}
+
+
+//x86-64 emitter. A, X, Y and P live in r12d..r15d, rbx points to the
+//context, rbp to nztable, [rsp] and [rsp + 4] are scratch and [rsp + 8]
+//holds the goal. blocks jump back to the dispatcher loop when they are
+//done and to its exit when they hand over to the interpreter.
+enum { RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSP = 4, RBP = 5, RSI = 6, RDI = 7 };
+#define RA 12
+#define RX 13
+#define RY 14
+#define RP 15
+
+//two register / register and immediate ALU ops
+enum { MOV = 0x89, ADD = 0x01, OR = 0x09, AND = 0x21, SUB = 0x29, XOR = 0x31, CMP = 0x39, TEST = 0x85 };
+enum { IADD = 0, IOR = 1, IAND = 4, ISUB = 5, IXOR = 6, ICMP = 7 };
+enum { CC_B = 2, CC_AE = 3, CC_E = 4, CC_NE = 5 };
+
+#define OFF(field) ((int32_t)offsetof(cpu6502_t, field))
+
+typedef struct {
+    uint8_t *p;
+    uint8_t *loop, *out;
+    uint64_t readfn, userdata;
+    cpu6502_t *c;
+    int pend;       //cycles of the block so far, added to clockticks on the way out
+} emitter_t;
+
+static void b8(emitter_t *e, uint8_t v) {
+    *e->p++ = v;
+}
+
+static void d32(emitter_t *e, uint32_t v) {
+    memcpy(e->p, &v, 4);
+    e->p += 4;
+}
+
+static void d64(emitter_t *e, uint64_t v) {
+    memcpy(e->p, &v, 8);
+    e->p += 8;
+}
+
+static void rex(emitter_t *e, int w, int r, int b, int force) {
+    uint8_t v = 0x40 | (w << 3) | ((r >> 3) << 2) | (b >> 3);
+    if (v != 0x40 || force) b8(e, v);
+}
+
+static void rr(emitter_t *e, uint8_t op, int dst, int src) {
+    rex(e, 0, src, dst, 0);
+    b8(e, op);
+    b8(e, 0xC0 | ((src & 7) << 3) | (dst & 7));
+}
+
+static void ri(emitter_t *e, int ext, int reg, uint32_t imm) {
+    rex(e, 0, 0, reg, 0);
+    b8(e, 0x81);
+    b8(e, 0xC0 | (ext << 3) | (reg & 7));
+    d32(e, imm);
+}
+
+static void testi(emitter_t *e, int reg, uint32_t imm) {
+    rex(e, 0, 0, reg, 0);
+    b8(e, 0xF7);
+    b8(e, 0xC0 | (reg & 7));
+    d32(e, imm);
+}
+
+static void movi(emitter_t *e, int reg, uint32_t imm) {
+    rex(e, 0, 0, reg, 0);
+    b8(e, 0xB8 + (reg & 7));
+    d32(e, imm);
+}
+
+static void movabs(emitter_t *e, int reg, uint64_t imm) {
+    rex(e, 1, 0, reg, 0);
+    b8(e, 0xB8 + (reg & 7));
+    d64(e, imm);
+}
+
+static void movzx8(emitter_t *e, int dst, int src) {
+    rex(e, 0, dst, src, src >= 4 && src < 8);
+    b8(e, 0x0F);
+    b8(e, 0xB6);
+    b8(e, 0xC0 | ((dst & 7) << 3) | (src & 7));
+}
+
+static void shli(emitter_t *e, int reg, uint8_t n) {
+    rex(e, 0, 0, reg, 0);
+    b8(e, 0xC1);
+    b8(e, 0xE0 | (reg & 7));
+    b8(e, n);
+}
+
+static void shri(emitter_t *e, int reg, uint8_t n) {
+    rex(e, 0, 0, reg, 0);
+    b8(e, 0xC1);
+    b8(e, 0xE8 | (reg & 7));
+    b8(e, n);
+}
+
+//[rbx + disp32] operand
+static void ctx(emitter_t *e, int reg, int32_t disp) {
+    b8(e, 0x80 | ((reg & 7) << 3) | RBX);
+    d32(e, disp);
+}
+
+static void loadb(emitter_t *e, int reg, int32_t disp) {   //movzx r32, byte [rbx + disp]
+    rex(e, 0, reg, RBX, 0);
+    b8(e, 0x0F);
+    b8(e, 0xB6);
+    ctx(e, reg, disp);
+}
+
+static void storeb(emitter_t *e, int32_t disp, int reg) {  //mov byte [rbx + disp], r8
+    rex(e, 0, reg, RBX, reg >= 4 && reg < 8);
+    b8(e, 0x88);
+    ctx(e, reg, disp);
+}
+
+static void storew(emitter_t *e, int32_t disp, int reg) {  //mov word [rbx + disp], r16
+    b8(e, 0x66);
+    rex(e, 0, reg, RBX, 0);
+    b8(e, 0x89);
+    ctx(e, reg, disp);
+}
+
+static void storewi(emitter_t *e, int32_t disp, uint16_t imm) {
+    b8(e, 0x66);
+    b8(e, 0xC7);
+    ctx(e, 0, disp);
+    b8(e, imm & 0xFF);
+    b8(e, imm >> 8);
+}
+
+static void addmi(emitter_t *e, int32_t disp, uint32_t imm) { //add dword [rbx + disp], imm32
+    b8(e, 0x81);
+    ctx(e, 0, disp);
+    d32(e, imm);
+}
+
+static void addbmi(emitter_t *e, int32_t disp, uint8_t imm) { //add byte [rbx + disp], imm8
+    b8(e, 0x80);
+    ctx(e, 0, disp);
+    b8(e, imm);
+}
+
+//scratch slots at [rsp + slot]
+static void slot(emitter_t *e, uint8_t op, int reg, uint8_t at) {
+    rex(e, 0, reg, 0, 0);
+    b8(e, op);
+    b8(e, 0x44 | ((reg & 7) << 3));
+    b8(e, 0x24);
+    b8(e, at);
+}
+#define TOSLOT(e, at, reg)   slot(e, 0x89, reg, at)
+#define FROMSLOT(e, reg, at) slot(e, 0x8B, reg, at)
+#define ORSLOT(e, reg, at)   slot(e, 0x0B, reg, at)
+
+static uint8_t *jcc(emitter_t *e, int cc) {                 //forward, patched by here()
+    b8(e, 0x0F);
+    b8(e, 0x80 | cc);
+    d32(e, 0);
+    return e->p - 4;
+}
+
+static void here(emitter_t *e, uint8_t *fix) {
+    int32_t rel = (int32_t)(e->p - (fix + 4));
+    memcpy(fix, &rel, 4);
+}
+
+static void callabs(emitter_t *e, uint64_t fn) {
+    movabs(e, RAX, fn);
+    b8(e, 0xFF);
+    b8(e, 0xD0);    //call rax
+}
+
+
+static void jmp(emitter_t *e, uint8_t *to) {
+    int32_t rel;
+
+    b8(e, 0xE9);
+    rel = (int32_t)(to - (e->p + 4));
+    d32(e, rel);
+}
+
+//jumps to the block in rdx if it can't run past the goal and nothing is
+//pending (PENDING in fake6502_ops.h), to the dispatcher exit otherwise
+static void enterblock(emitter_t *e) {
+    uint8_t *fix[5], *masked;
+    int i;
+
+    b8(e, 0x48); b8(e, 0x85); b8(e, 0xD2);                   //test rdx, rdx
+    fix[0] = jcc(e, CC_E);
+    b8(e, 0x0F); b8(e, 0xB7); b8(e, 0x8A);                   //movzx ecx, word [rdx + maxcycles]
+    d32(e, offsetof(jitblock_t, maxcycles));
+    b8(e, 0x03); ctx(e, RCX, OFF(clockticks));               //add ecx, [rbx + clockticks]
+    b8(e, 0x2B); b8(e, 0x4C); b8(e, 0x24); b8(e, 0x08);      //sub ecx, [rsp + 8]
+    fix[1] = jcc(e, 0xF);                                    //jg, clockticks wrap
+    testi(e, RP, FLAG_DECIMAL);
+    fix[2] = jcc(e, CC_NE);
+    loadb(e, RCX, OFF(irqreq));
+    b8(e, 0x0A); ctx(e, RCX, OFF(nmireq));                   //or cl, [rbx + nmireq]
+    fix[3] = jcc(e, CC_NE);
+    b8(e, 0x8B); ctx(e, RCX, OFF(irqline));                  //mov ecx, [rbx + irqline]
+    b8(e, 0x85); b8(e, 0xC9);                                //test ecx, ecx
+    masked = jcc(e, CC_E);
+    testi(e, RP, FLAG_INTERRUPT);
+    fix[4] = jcc(e, CC_E);
+    here(e, masked);
+    b8(e, 0xFF); b8(e, 0xA2);                                //jmp [rdx + code]
+    d32(e, offsetof(jitblock_t, code));
+    for (i = 0; i < 5; i++) {
+        int32_t rel = (int32_t)(e->out - (fix[i] + 4));
+        memcpy(fix[i], &rel, 4);
+    }
+}
+
+//exits. n is the number of instructions done, extra any cycles on top of
+//the block's so far
+static void account(emitter_t *e, int n, int extra) {
+    if (e->pend + extra) addmi(e, OFF(clockticks), e->pend + extra);
+    if (n) addmi(e, OFF(instructions), n);
+}
+
+//to a known pc: straight into the block there if the page is cached, each
+//exit gets its own indirect jump, which predicts a lot better than the
+//dispatcher's single one
+static void exitto(emitter_t *e, uint16_t pc, int n, int extra) {
+    struct jit6502 *j = e->c->jit;
+    jitpage_t *jp = j->pages[pc >> 8];
+
+    storewi(e, OFF(pc), pc);
+    account(e, n, extra);
+    if (!jp && e->c->decoded[pc >> 8])
+        jp = j->pages[pc >> 8] = calloc(1, sizeof(jitpage_t));
+    if (!jp) {
+        jmp(e, e->loop);
+        return;
+    }
+    movabs(e, RDX, (uint64_t)(uintptr_t)&jp->block[pc & 0xFF]);
+    b8(e, 0x48); b8(e, 0x8B); b8(e, 0x12);                   //mov rdx, [rdx]
+    enterblock(e);
+}
+
+//pc in ax, through the dispatcher
+static void leave(emitter_t *e, int n) {
+    storew(e, OFF(pc), RAX);
+    account(e, n, 0);
+    jmp(e, e->loop);
+}
+
+//hands the instruction at pc to the interpreter
+static void giveup(emitter_t *e, uint16_t pc, int n) {
+    storewi(e, OFF(pc), pc);
+    account(e, n, 0);
+    jmp(e, e->out);
+}
+
+//the dispatcher: looks up the block for pc and jumps to it as long as it
+//can't run past the goal and nothing is pending, otherwise writes A, X, Y
+//and P back and returns
+static void dispatcher(struct jit6502 *j) {
+    emitter_t e;
+    uint8_t *fix[1];
+
+    e.p = j->arena;
+    e.out = e.p;
+    storeb(&e, OFF(a), RA);
+    storeb(&e, OFF(x), RX);
+    storeb(&e, OFF(y), RY);
+    storeb(&e, OFF(status), RP);
+    b8(&e, 0x48); b8(&e, 0x83); b8(&e, 0xC4); b8(&e, 0x18);  //add rsp, 24
+    b8(&e, 0x41); b8(&e, 0x5F);                              //pop r15
+    b8(&e, 0x41); b8(&e, 0x5E);                              //pop r14
+    b8(&e, 0x41); b8(&e, 0x5D);                              //pop r13
+    b8(&e, 0x41); b8(&e, 0x5C);                              //pop r12
+    b8(&e, 0x5D);                                            //pop rbp
+    b8(&e, 0x5B);                                            //pop rbx
+    b8(&e, 0xC3);                                            //ret
+
+    e.loop = e.p;
+    b8(&e, 0x0F); b8(&e, 0xB7); ctx(&e, RAX, OFF(pc));       //movzx eax, word [rbx + pc]
+    b8(&e, 0x48); b8(&e, 0x8B); ctx(&e, RDX, OFF(jit));      //mov rdx, [rbx + jit]
+    rr(&e, MOV, RCX, RAX);
+    shri(&e, RCX, 8);
+    b8(&e, 0x48); b8(&e, 0x8B); b8(&e, 0x94); b8(&e, 0xCA);  //mov rdx, [rdx + rcx * 8 + pages]
+    d32(&e, offsetof(struct jit6502, pages));
+    b8(&e, 0x48); b8(&e, 0x85); b8(&e, 0xD2);                //test rdx, rdx
+    fix[0] = jcc(&e, CC_E);
+    movzx8(&e, RCX, RAX);
+    b8(&e, 0x48); b8(&e, 0x8B); b8(&e, 0x14); b8(&e, 0xCA);  //mov rdx, [rdx + rcx * 8] (block[])
+    enterblock(&e);
+    here(&e, fix[0]);
+    jmp(&e, e.out);
+
+    j->enter = (void (*)(cpu6502_t *, uint32_t))(void *)e.p;
+    b8(&e, 0x53);                                            //push rbx
+    b8(&e, 0x55);                                            //push rbp
+    b8(&e, 0x41); b8(&e, 0x54);                              //push r12
+    b8(&e, 0x41); b8(&e, 0x55);                              //push r13
+    b8(&e, 0x41); b8(&e, 0x56);                              //push r14
+    b8(&e, 0x41); b8(&e, 0x57);                              //push r15
+    b8(&e, 0x48); b8(&e, 0x83); b8(&e, 0xEC); b8(&e, 0x18);  //sub rsp, 24 (keeps calls aligned)
+    b8(&e, 0x48); b8(&e, 0x89); b8(&e, 0xFB);                //mov rbx, rdi
+    b8(&e, 0x89); b8(&e, 0x74); b8(&e, 0x24); b8(&e, 0x08);  //mov [rsp + 8], esi
+    movabs(&e, RBP, (uint64_t)(uintptr_t)nztable);
+    loadb(&e, RA, OFF(a));
+    loadb(&e, RX, OFF(x));
+    loadb(&e, RY, OFF(y));
+    loadb(&e, RP, OFF(status));
+    ri(&e, IOR, RP, FLAG_CONSTANT);                          //set by every fetch, RTI/PLP may clear it
+    jmp(&e, e.loop);
+
+    j->loop = e.loop;
+    j->out = e.out;
+    j->base = j->used = e.p - j->arena;
+}
+
+//N and Z from eax
+static void nz(emitter_t *e) {
+    ri(e, IAND, RP, (uint8_t)~(FLAG_SIGN | FLAG_ZERO));
+    b8(e, 0x0F); b8(e, 0xB6); b8(e, 0x4C); b8(e, 0x05); b8(e, 0x00); //movzx ecx, byte [rbp + rax]
+    rr(e, OR, RP, RCX);
+}
+
+//bus accesses, the address is in esi. mapped pages are read directly,
+//everything else through the callback
+static void rd(emitter_t *e) {
+    uint8_t *slow, *done;
+
+    rr(e, MOV, RAX, RSI);
+    shri(e, RAX, 8);
+    b8(e, 0x48); b8(e, 0x8B); b8(e, 0x94); b8(e, 0xC3);  //mov rdx, [rbx + rax * 8 + readmap]
+    d32(e, OFF(readmap));
+    b8(e, 0x48); b8(e, 0x85); b8(e, 0xD2);               //test rdx, rdx
+    slow = jcc(e, CC_E);
+    movzx8(e, RCX, RSI);
+    b8(e, 0x0F); b8(e, 0xB6); b8(e, 0x04); b8(e, 0x0A);  //movzx eax, byte [rdx + rcx]
+    b8(e, 0xE9);                                         //jmp done
+    done = e->p;
+    d32(e, 0);
+    here(e, slow);
+    movabs(e, RDI, e->userdata);
+    callabs(e, e->readfn);
+    movzx8(e, RAX, RAX);
+    here(e, done);
+}
+
+//value in edx. gives up after the instruction if the write hit translated code
+static void wr(emitter_t *e, uint16_t next, int n) {
+    uint8_t *fix;
+
+    b8(e, 0x48); b8(e, 0x89); b8(e, 0xDF);               //mov rdi, rbx
+    callabs(e, (uint64_t)(uintptr_t)writehelper);
+    rr(e, TEST, RAX, RAX);
+    fix = jcc(e, CC_E);
+    exitto(e, next, n, 0);
+    here(e, fix);
+}
+
+//side exit before the instruction if esi is not on a cached page
+static void iocheck(emitter_t *e, uint16_t pc, int n) {
+    uint8_t *fix;
+
+    rr(e, MOV, RAX, RSI);
+    shri(e, RAX, 8);
+    b8(e, 0x48); b8(e, 0x8B); b8(e, 0x94); b8(e, 0xC3);  //mov rdx, [rbx + rax * 8 + decoded]
+    d32(e, OFF(decoded));
+    b8(e, 0x48); b8(e, 0x85); b8(e, 0xD2);               //test rdx, rdx
+    fix = jcc(e, CC_NE);
+    giveup(e, pc, n);
+    here(e, fix);
+}
+
+//page crossing penalty, ecx is non-zero if the page was crossed
+static void penalty(emitter_t *e) {
+    b8(e, 0xF7); b8(e, 0xD9);                            //neg ecx
+    b8(e, 0x83); ctx(e, 2, OFF(clockticks)); b8(e, 0);   //adc dword [rbx + clockticks], 0
+}
+
+//0 if an access in mode is known to hit a page that isn't cached
+static int usable(cpu6502_t *c, int mode, uint16_t operand) {
+    switch (mode) {
+    case M_ZP: case M_ZPX: case M_ZPY: case M_INDX: case M_INDY:
+        return c->decoded[0] != NULL;
+    case M_ABS:
+        return c->decoded[operand >> 8] != NULL;
+    }
+    return 1;
+}
+
+//effective address into esi, with the I/O check and page crossing penalty
+static void address(emitter_t *e, int mode, uint16_t operand, int pen, uint16_t pc, int n) {
+    int idx = (mode == M_ZPY || mode == M_ABSY) ? RY : RX;
+
+    switch (mode) {
+    case M_ZP:
+    case M_ABS:
+        movi(e, RSI, operand);
+        break;
+    case M_ZPX:
+    case M_ZPY:
+        rr(e, MOV, RSI, idx);
+        ri(e, IADD, RSI, operand);
+        ri(e, IAND, RSI, 0xFF);
+        break;
+    case M_ABSX:
+    case M_ABSY:
+        rr(e, MOV, RSI, idx);
+        ri(e, IADD, RSI, operand);
+        if (pen) {
+            rr(e, MOV, RCX, RSI);
+            ri(e, IXOR, RCX, operand);
+            ri(e, IAND, RCX, 0xFF00);
+        }
+        ri(e, IAND, RSI, 0xFFFF);
+        iocheck(e, pc, n);
+        if (pen) penalty(e);
+        break;
+    case M_INDX:
+        rr(e, MOV, RSI, RX);
+        ri(e, IADD, RSI, operand);
+        ri(e, IAND, RSI, 0xFF);
+        TOSLOT(e, 0, RSI);
+        rd(e);
+        TOSLOT(e, 4, RAX);
+        FROMSLOT(e, RSI, 0);
+        ri(e, IADD, RSI, 1);
+        ri(e, IAND, RSI, 0xFF);
+        rd(e);
+        shli(e, RAX, 8);
+        ORSLOT(e, RAX, 4);
+        rr(e, MOV, RSI, RAX);
+        iocheck(e, pc, n);
+        break;
+    case M_INDY:
+        movi(e, RSI, operand);
+        rd(e);
+        TOSLOT(e, 4, RAX);
+        movi(e, RSI, (operand + 1) & 0xFF);
+        rd(e);
+        shli(e, RAX, 8);
+        ORSLOT(e, RAX, 4);
+        rr(e, MOV, RSI, RAX);
+        rr(e, ADD, RSI, RY);
+        if (pen) {
+            rr(e, MOV, RCX, RSI);
+            rr(e, XOR, RCX, RAX);
+            ri(e, IAND, RCX, 0xFF00);
+        }
+        ri(e, IAND, RSI, 0xFFFF);
+        iocheck(e, pc, n);
+        if (pen) penalty(e);
+        break;
+    }
+}
+
+//eax = A + eax + C with all flags, result to A
+static void adc(emitter_t *e) {
+    rr(e, MOV, RCX, RP);
+    ri(e, IAND, RCX, FLAG_CARRY);
+    rr(e, ADD, RCX, RAX);
+    rr(e, ADD, RCX, RA);
+    rr(e, MOV, RDX, RA);            //V = (A ^ r) & (m ^ r) & 0x80
+    rr(e, XOR, RDX, RCX);
+    rr(e, XOR, RAX, RCX);
+    rr(e, AND, RAX, RDX);
+    ri(e, IAND, RAX, 0x80);
+    shri(e, RAX, 1);
+    ri(e, IAND, RP, (uint8_t)~(FLAG_OVERFLOW | FLAG_CARRY));
+    rr(e, OR, RP, RAX);
+    rr(e, MOV, RAX, RCX);
+    shri(e, RAX, 8);
+    rr(e, OR, RP, RAX);
+    movzx8(e, RA, RCX);
+    rr(e, MOV, RAX, RA);
+    nz(e);
+}
+
+//compare register r with eax
+static void compare(emitter_t *e, int r) {
+    ri(e, IAND, RP, (uint8_t)~FLAG_CARRY);
+    rr(e, MOV, RCX, r);
+    rr(e, SUB, RCX, RAX);           //borrow if r < m
+    b8(e, 0x0F); b8(e, 0x90 | CC_AE); b8(e, 0xC2);       //setae dl
+    movzx8(e, RDX, RDX);
+    rr(e, OR, RP, RDX);
+    movzx8(e, RAX, RCX);
+    nz(e);
+}
+
+//shifts and rotates of eax, result in eax
+static void shift(emitter_t *e, int kind) {
+    switch (kind) {
+    case K_ASL:
+    case K_ROL:
+        if (kind == K_ROL) {
+            rr(e, MOV, RCX, RP);
+            ri(e, IAND, RCX, FLAG_CARRY);
+        }
+        ri(e, IAND, RP, (uint8_t)~FLAG_CARRY);
+        rr(e, ADD, RAX, RAX);
+        if (kind == K_ROL) rr(e, OR, RAX, RCX);
+        rr(e, MOV, RCX, RAX);
+        shri(e, RCX, 8);
+        rr(e, OR, RP, RCX);
+        movzx8(e, RAX, RAX);
+        break;
+    case K_LSR:
+    case K_ROR:
+        if (kind == K_ROR) {
+            rr(e, MOV, RCX, RP);
+            ri(e, IAND, RCX, FLAG_CARRY);
+            shli(e, RCX, 7);
+        }
+        rr(e, MOV, RDX, RAX);
+        ri(e, IAND, RDX, FLAG_CARRY);
+        ri(e, IAND, RP, (uint8_t)~FLAG_CARRY);
+        rr(e, OR, RP, RDX);
+        shri(e, RAX, 1);
+        if (kind == K_ROR) rr(e, OR, RAX, RCX);
+        break;
+    }
+    nz(e);
+}
+
+//stack address of sp + delta into esi
+static void stackaddr(emitter_t *e, int delta) {
+    loadb(e, RSI, OFF(sp));
+    if (delta) {
+        ri(e, IADD, RSI, (uint32_t)delta);
+        ri(e, IAND, RSI, 0xFF);
+    }
+    ri(e, IADD, RSI, BASE_STACK);
+}
+
+//one instruction. returns 0 if it wasn't translated, 2 if it ends the block
+static int instruction(emitter_t *e, cpu6502_t *c, uint16_t pc, int n, uint8_t opcode,
+                       uint16_t operand, uint16_t next, uint16_t *maxcycles) {
+    int kind = optable[opcode].kind, mode = optable[opcode].mode;
+    int cycles = c->jit->ticktable[opcode], pen = 0, r;
+    uint16_t target;
+
+    if (kind == K_NONE) return 0;
+    if (kind != K_JMP && kind != K_JSR && !usable(c, mode, operand)) return 0;
+    if ((kind == K_PHA || kind == K_PHP || kind == K_PLA || kind == K_JSR || kind == K_RTS) && !c->decoded[1])
+        return 0;
+
+    switch (kind) {
+    case K_LDA: case K_LDX: case K_LDY: case K_ADC: case K_SBC: case K_AND:
+    case K_ORA: case K_EOR: case K_CMP:
+        pen = mode == M_ABSX || mode == M_ABSY || mode == M_INDY;
+        break;
+#ifdef FAKE6502_65C02
+    case K_ASL: case K_LSR: case K_ROL: case K_ROR:
+        pen = mode == M_ABSX; //only the 65C02 skips the fixup cycle here
+        break;
+#endif
+    }
+    *maxcycles += cycles + pen;
+
+    switch (kind) {
+    //reads
+    case K_LDA: case K_LDX: case K_LDY: case K_ADC: case K_SBC: case K_AND:
+    case K_ORA: case K_EOR: case K_CMP: case K_CPX: case K_CPY: case K_BIT:
+        if (mode == M_IMM) {
+            e->pend += cycles;
+            movi(e, RAX, operand & 0xFF);
+        } else {
+            address(e, mode, operand, pen, pc, n);
+            e->pend += cycles;
+            rd(e);
+        }
+        switch (kind) {
+        case K_LDA: case K_LDX: case K_LDY:
+            r = kind == K_LDA ? RA : kind == K_LDX ? RX : RY;
+            rr(e, MOV, r, RAX);
+            nz(e);
+            break;
+        case K_SBC:
+            ri(e, IXOR, RAX, 0xFF);
+            /* fall through */
+        case K_ADC:
+            adc(e);
+            break;
+        case K_AND: case K_ORA: case K_EOR:
+            rr(e, kind == K_AND ? AND : kind == K_ORA ? OR : XOR, RA, RAX);
+            rr(e, MOV, RAX, RA);
+            nz(e);
+            break;
+        case K_CMP: compare(e, RA); break;
+        case K_CPX: compare(e, RX); break;
+        case K_CPY: compare(e, RY); break;
+        case K_BIT:
+            rr(e, MOV, RCX, RAX);
+            rr(e, AND, RCX, RA);
+            ri(e, IAND, RP, (uint8_t)~(FLAG_SIGN | FLAG_OVERFLOW | FLAG_ZERO));
+            ri(e, IAND, RAX, FLAG_SIGN | FLAG_OVERFLOW);
+            rr(e, OR, RP, RAX);
+            rr(e, TEST, RCX, RCX);
+            b8(e, 0x0F); b8(e, 0x90 | CC_E); b8(e, 0xC2);   //sete dl
+            movzx8(e, RDX, RDX);
+            shli(e, RDX, 1);
+            rr(e, OR, RP, RDX);
+            break;
+        }
+        return 1;
+
+    //writes
+    case K_STA: case K_STX: case K_STY:
+        address(e, mode, operand, 0, pc, n);
+        e->pend += cycles;
+        rr(e, MOV, RDX, kind == K_STA ? RA : kind == K_STX ? RX : RY);
+        wr(e, next, n + 1);
+        return 1;
+
+    //read-modify-write
+    case K_ASL: case K_LSR: case K_ROL: case K_ROR: case K_INC: case K_DEC:
+        if (mode == M_ACC) {
+            e->pend += cycles;
+            rr(e, MOV, RAX, RA);
+            shift(e, kind);
+            rr(e, MOV, RA, RAX);
+            return 1;
+        }
+        address(e, mode, operand, pen, pc, n);
+        e->pend += cycles;
+        TOSLOT(e, 0, RSI);
+        rd(e);
+        if (kind == K_INC || kind == K_DEC) {
+            ri(e, kind == K_INC ? IADD : ISUB, RAX, 1);
+            movzx8(e, RAX, RAX);
+            nz(e);
+        } else {
+            shift(e, kind);
+        }
+        FROMSLOT(e, RSI, 0);
+        rr(e, MOV, RDX, RAX);
+        wr(e, next, n + 1);
+        return 1;
+
+    //registers and flags
+    case K_INX: case K_DEX:
+        ri(e, kind == K_INX ? IADD : ISUB, RX, 1);
+        movzx8(e, RX, RX);
+        rr(e, MOV, RAX, RX);
+        break;
+    case K_INY: case K_DEY:
+        ri(e, kind == K_INY ? IADD : ISUB, RY, 1);
+        movzx8(e, RY, RY);
+        rr(e, MOV, RAX, RY);
+        break;
+    case K_TAX: rr(e, MOV, RX, RA); rr(e, MOV, RAX, RA); break;
+    case K_TAY: rr(e, MOV, RY, RA); rr(e, MOV, RAX, RA); break;
+    case K_TXA: rr(e, MOV, RA, RX); rr(e, MOV, RAX, RX); break;
+    case K_TYA: rr(e, MOV, RA, RY); rr(e, MOV, RAX, RY); break;
+    case K_TSX: loadb(e, RX, OFF(sp)); rr(e, MOV, RAX, RX); break;
+    case K_TXS: storeb(e, OFF(sp), RX); break;
+    case K_CLC: ri(e, IAND, RP, (uint8_t)~FLAG_CARRY); break;
+    case K_SEC: ri(e, IOR, RP, FLAG_CARRY); break;
+    case K_CLI: ri(e, IAND, RP, (uint8_t)~FLAG_INTERRUPT); break;
+    case K_SEI: ri(e, IOR, RP, FLAG_INTERRUPT); break;
+    case K_CLV: ri(e, IAND, RP, (uint8_t)~FLAG_OVERFLOW); break;
+    case K_CLD: ri(e, IAND, RP, (uint8_t)~FLAG_DECIMAL); break;
+    case K_NOP: break;
+
+    //stack
+    case K_PHA:
+    case K_PHP:
+        e->pend += cycles;
+        stackaddr(e, 0);
+        addbmi(e, OFF(sp), 0xFF);
+        rr(e, MOV, RDX, kind == K_PHA ? RA : RP);
+        if (kind == K_PHP) ri(e, IOR, RDX, FLAG_BREAK);
+        wr(e, next, n + 1);
+        return 1;
+    case K_PLA:
+        e->pend += cycles;
+        addbmi(e, OFF(sp), 1);
+        stackaddr(e, 0);
+        rd(e);
+        rr(e, MOV, RA, RAX);
+        nz(e);
+        return 1;
+
+    //control flow, these end the block
+    case K_JMP:
+        e->pend += cycles;
+        exitto(e, operand, n + 1, 0);
+        return 2;
+    case K_JSR:
+        e->pend += cycles;
+        stackaddr(e, 0);
+        movi(e, RDX, ((next - 1) >> 8) & 0xFF);
+        b8(e, 0x48); b8(e, 0x89); b8(e, 0xDF);           //mov rdi, rbx
+        callabs(e, (uint64_t)(uintptr_t)writehelper);
+        stackaddr(e, -1);
+        movi(e, RDX, (next - 1) & 0xFF);
+        b8(e, 0x48); b8(e, 0x89); b8(e, 0xDF);
+        callabs(e, (uint64_t)(uintptr_t)writehelper);
+        addbmi(e, OFF(sp), 0xFE);
+        exitto(e, operand, n + 1, 0);
+        return 2;
+    case K_RTS:
+        e->pend += cycles;
+        stackaddr(e, 1);
+        rd(e);
+        TOSLOT(e, 4, RAX);
+        stackaddr(e, 2);
+        rd(e);
+        shli(e, RAX, 8);
+        ORSLOT(e, RAX, 4);
+        ri(e, IADD, RAX, 1);
+        addbmi(e, OFF(sp), 2);
+        leave(e, n + 1);
+        return 2;
+    default: { //branches
+        static const uint8_t flag[] = { FLAG_SIGN, FLAG_OVERFLOW, FLAG_CARRY, FLAG_ZERO };
+        int which = (kind - K_BPL) >> 1, set = (kind - K_BPL) & 1;
+        uint8_t *fix;
+
+        target = next + (uint16_t)(int8_t)operand;
+        *maxcycles += 2;
+        e->pend += cycles;
+        testi(e, RP, flag[which]);
+        fix = jcc(e, set ? CC_E : CC_NE);           //not taken
+        exitto(e, target, n + 1, ((next ^ target) & 0xFF00) ? 2 : 1);
+        here(e, fix);
+        exitto(e, next, n + 1, 0);
+        return 2;
+    }
+    }
+
+    //register and flag ops end up here with the result for N and Z in eax
+    e->pend += cycles;
+    switch (kind) {
+    case K_INX: case K_INY: case K_DEX: case K_DEY: case K_TAX: case K_TAY:
+    case K_TXA: case K_TYA: case K_TSX:
+        nz(e);
+    }
+    return 1;
+}
+
+void jit6502_translate(cpu6502_t *c, uint16_t address) {
+    struct jit6502 *j = c->jit;
+    jitpage_t *jp;
+    jitblock_t *b;
+    emitter_t e;
+    uint8_t *entry, opcode, len;
+    uint16_t pc = address, operand, maxcycles = 0;
+    int n = 0, r = 1, off = address & 0xFF;
+
+    if (!c->decoded[address >> 8]) return;
+    jp = j->pages[address >> 8];
+    if (!jp) {
+        jp = j->pages[address >> 8] = calloc(1, sizeof(jitpage_t));
+        if (!jp) return;
+    }
+    if (jp->block[off] || jp->fails[off] >= JIT6502_MAXFAILS) return;
+
+    if (j->used + BLOCK_ROOM > j->size || j->nblocks == j->maxblocks)
+        flush(j);
+
+    e.p = entry = j->arena + j->used;
+    e.c = c;
+    e.pend = 0;
+    e.loop = j->loop;
+    e.out = j->out;
+    e.readfn = (uint64_t)(uintptr_t)(c->read ? c->read : readglobal);
+    e.userdata = (uint64_t)(uintptr_t)c->userdata;
+
+    while (n < JIT6502_MAXINS && r == 1 && (pc >> 8) == (address >> 8)) {
+        opcode = readbyte(c, pc);
+        len = j->lentable[opcode];
+        if ((pc & 0xFF) + len > 0x100) break;   //blocks never cross pages
+        operand = 0;
+        if (len > 1) operand = readbyte(c, pc + 1);
+        if (len > 2) operand |= (uint16_t)readbyte(c, pc + 2) << 8;
+
+        r = instruction(&e, c, pc, n, opcode, operand, pc + len, &maxcycles);
+        if (!r) break;
+        pc += len;
+        n++;
+    }
+
+    if (!n) {
+        jp->fails[off] = JIT6502_MAXFAILS; //not worth trying again
+        return;
+    }
+    if (r != 2) exitto(&e, pc, n, 0);
+
+    b = &j->blocks[j->nblocks++];
+    b->code = entry;
+    b->start = address;
+    b->len = pc - address;
+    b->maxcycles = maxcycles;
+    jp->block[off] = b;
+    for (; off < (address & 0xFF) + b->len; off++)
+        if (jp->covered[off] < 255) jp->covered[off]++;
+
+    j->used = e.p - j->arena;
+    j->translated++;
+}
+
+struct jit6502 *jit6502_create(const uint8_t *lentable, const uint8_t *ticktable) {
+    struct jit6502 *j = calloc(1, sizeof(struct jit6502));
+    int v;
+
+    if (!j) return NULL;
+    for (v = 0; v < 256; v++)
+        nztable[v] = (v ? 0 : FLAG_ZERO) | (v & FLAG_SIGN);
+
+    j->lentable = lentable;
+    j->ticktable = ticktable;
+    j->size = ARENA_SIZE;
+    j->arena = mmap(NULL, j->size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    j->maxblocks = MAX_BLOCKS;
+    j->blocks = calloc(j->maxblocks, sizeof(jitblock_t));
+    if (j->arena == MAP_FAILED || !j->blocks) {
+        fprintf(stderr, "jit6502: can't allocate code memory, running interpreted\n");
+        if (j->arena != MAP_FAILED) munmap(j->arena, j->size);
+        free(j->blocks);
+        free(j);
+        return NULL;
+    }
+    dispatcher(j);
+    return j;
+}
+
+void jit6502_destroy(struct jit6502 *j) {
+    int page;
+
+    if (!j) return;
+    for (page = 0; page < 256; page++)
+        free(j->pages[page]);
+    munmap(j->arena, j->size);
+    free(j->blocks);
+    free(j);
+}
+
+#else
+
+//no translator for this host, the fake core stays an interpreter
+struct jit6502 *jit6502_create(const uint8_t *lentable, const uint8_t *ticktable) {
+    return NULL;
+}
+
+void jit6502_destroy(struct jit6502 *j) {
+}
+
+void jit6502_translate(cpu6502_t *c, uint16_t address) {
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef _JIT6502_H_
+#define _JIT6502_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fake6502.h"
+
+// x86-64 translator for hot basic blocks of the fake core, built into
+// fake6502.c with -DFAKE6502_JIT ('make fakejit'). Internal to the core.
+//
+// Blocks only live on decode-cached pages and never cross a page. They
+// end at branches, jumps and returns, before any access to a page that
+// is not cached (I/O), and before anything the translator doesn't know,
+// which is then left to the interpreter. Every block keeps exact cycle
+// counts and gives up right after a write into translated code.
+
+#define JIT6502_THRESHOLD 64    // decode cache hits before translating
+#define JIT6502_MAXINS    32    // instructions per block
+#define JIT6502_MAXFAILS  4     // invalidations before an address is left alone
+
+typedef struct {
+  void *code;                   // entered from the dispatcher, never called
+  uint16_t start, len;          // 6502 bytes covered
+  uint16_t maxcycles;           // worst case, including page and branch penalties
+} jitblock_t;
+
+typedef struct {
+  jitblock_t *block[256];       // block starting at each address
+  uint8_t covered[256];         // number of blocks covering each byte
+  uint8_t fails[256];           // invalidations per start address
+} jitpage_t;
+
+struct jit6502 {
+  jitpage_t *pages[256];
+  const uint8_t *lentable, *ticktable;
+
+  // generated code. the dispatcher sits at the start of the arena, blocks
+  // follow from base on and are flushed as a whole when it is full
+  uint8_t *arena;
+  size_t size, base, used;
+  void (*enter)(cpu6502_t *c, uint32_t goal);
+  uint8_t *loop, *out;
+  jitblock_t *blocks;
+  int nblocks, maxblocks;
+
+  // statistics
+  uint32_t translated, invalidated, flushes;
+};
+
+extern struct jit6502 *jit6502_create(const uint8_t *lentable, const uint8_t *ticktable);
+extern void jit6502_destroy(struct jit6502 *j);
+extern void jit6502_translate(cpu6502_t *c, uint16_t address);
+extern void jit6502_run(cpu6502_t *c, uint32_t goal);
+extern int jit6502_invalidate(cpu6502_t *c, uint16_t address);
+extern void jit6502_droppage(cpu6502_t *c, uint8_t page);
+
+// block starting at address, NULL if there is none
+#define JIT6502_BLOCK(c, address) \
+    ((c)->jit->pages[(address) >> 8] ? (c)->jit->pages[(address) >> 8]->block[(address) & 0xFF] : NULL)
+
+// cheap test for the write paths, only calls out if the byte is translated
+#define JIT6502_INVALIDATE(c, address) {\
+    jitpage_t *jp = (c)->jit ? (c)->jit->pages[(address) >> 8] : NULL;\
+    if (jp && jp->covered[(address) & 0xFF]) jit6502_invalidate(c, address);\
+}
+
+#endif
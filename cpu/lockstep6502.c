@@ -0,0 +1,389 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// lockstep6502: runs a candidate core in lockstep with the reference core
+//
+// The reference is the original table-driven Fake6502 (fake6502_ref.c,
+// linked with all its symbols prefixed ref_), the candidate the fake core
+// built as a 2A03 like the reference. Each has its own copy of memory.
+// After every step the registers, cycle and instruction counts and the bus
+// writes of the step are compared, the first mismatch stops the run with
+// both states and the last instructions the reference ran. The reference
+// takes interrupts in no time, the candidate in the chip's 7 cycles, the
+// clocks are compared with those added.
+//
+// Programs:   boot    VIC-20 BASIC and KERNAL to READY, then a BASIC loop
+//             test    6502asm/test.asm
+//             random  random memory, all of it code, new memory and pc
+//                     every 100000 instructions
+// Candidates: fake    the interpreter
+//             cache   with the decode cache (and fused pairs)
+//             map     with the decode cache and the memory map (reads)
+//             cycle   cycle stepping
+//             jit     translated blocks, lockstep6502_jit only
+//             jitmap  translated blocks and the memory map (reads), also
+//                     lockstep6502_jit only
+//
+// A step is one candidate instruction, or with -k the candidate runs that
+// many ticks through exec6502() (which fused pairs and blocks need) and the
+// reference catches up instruction by instruction.
+//
+// -t starts both clocks there instead of at 0, -t 4294000000 has them wrap
+// around 2^32 some 967000 cycles in.
+//
+// usage: lockstep6502 [-p program] [-c candidate] [-n million instructions]
+//                     [-k ticks per step] [-s seed] [-t first clocktick]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "fake6502.h"
+
+#include "../vic20/roms/basic.901486-01.h"
+#include "../vic20/roms/kernal.901486-06.h"
+#include "../6502asm/test.h"
+
+// The reference core, see the Makefile
+extern void ref_reset6502();
+extern void ref_step6502();
+extern void ref_irq6502();
+extern void ref_nmi6502();
+extern uint16_t ref_pc;
+extern uint8_t ref_sp, ref_a, ref_x, ref_y, ref_status;
+extern volatile uint32_t ref_clockticks6502;
+extern uint32_t ref_instructions;
+
+#define BOOT_TICKS  3000000
+#define IRQ_TICKS   17045     // VIA2 jiffy timer
+#define NMI_TICKS   100003    // only for random
+#define RANDOM      100000    // instructions until random starts over
+#define MAXWRITES   65536
+#define TRACE       16
+
+// Memory, one copy per core, and what each page is: 1 RAM, 2 I/O, 3 ROM
+static uint8_t refmem[0x10000], candmem[0x10000];
+static uint8_t page_type[256];
+
+// Writes of the current step
+typedef struct {
+  uint16_t address;
+  uint8_t value;
+} buswrite_t;
+
+static buswrite_t refwrites[MAXWRITES], candwrites[MAXWRITES];
+static int nrefwrites, ncandwrites;
+
+// Last instructions of the reference
+static uint16_t trace[TRACE];
+static int ntrace;
+
+// 10 A=0:FORI=1TO30000:A=A+I*3:NEXT:GOTO10, as in bench6502.c
+static const uint8_t prog[] = {
+  0x00, 0x00,
+  0x0A, 0x00,
+  'A', 0xB2, '0', ':',
+  0x81, 'I', 0xB2, '1', 0xA4, '3','0','0','0','0', ':',
+  'A', 0xB2, 'A', 0xAA, 'I', 0xAC, '3', ':',
+  0x82, ':',
+  0x89, '1', '0',
+  0x00,
+  0x00, 0x00
+};
+
+// Back to back writes to one address count as the last one. Cycle stepped
+// read-modify-write instructions write the old value before the new one,
+// the reference stores A and X before A & X in SAX, the others do neither.
+static void buswrite(uint8_t *mem, buswrite_t *log, int *n, uint16_t address, uint8_t value)
+{
+  if (*n && *n <= MAXWRITES && log[*n-1].address == address)
+    (*n)--;
+  if (*n < MAXWRITES) {
+    log[*n].address = address;
+    log[*n].value = value;
+  }
+  (*n)++;
+  if (page_type[address>>8] == 1)
+    mem[address] = value;
+}
+
+uint8_t ref_read6502(uint16_t address)
+{
+  return refmem[address];
+}
+
+void ref_write6502(uint16_t address, uint8_t value)
+{
+  buswrite(refmem, refwrites, &nrefwrites, address, value);
+}
+
+uint8_t read6502(uint16_t address)
+{
+  return candmem[address];
+}
+
+void write6502(uint16_t address, uint8_t value)
+{
+  buswrite(candmem, candwrites, &ncandwrites, address, value);
+}
+
+// Memory changed behind both cores' backs
+static void poke(uint16_t address, uint8_t value)
+{
+  refmem[address] = value;
+  candmem[address] = value;
+  invalidate6502(address);
+}
+
+// New random memory and pc
+static void randomize()
+{
+  int g;
+
+  for (g=0; g<0x10000; g++)
+    poke(g, rand());
+  pc = ref_pc = rand();
+}
+
+static void load(const char *program, unsigned seed)
+{
+  int g;
+
+  for (g=0; g<256; g++)
+    page_type[g] = 1; //RAM
+
+  if (!strcmp(program, "boot")) {
+    for (g=0; g<basicROM_len; g++)
+      refmem[0xC000+g] = basicROM[g];
+    for (g=0; g<kernalROM_len; g++)
+      refmem[0xE000+g] = kernalROM[g];
+    for (g=0xC0; g<=0xFF; g++)
+      page_type[g] = 3; //ROM
+  } else if (!strcmp(program, "test")) {
+    // Same layout as the top backend, console output at $E000
+    for (g=0; g<test_len; g++)
+      refmem[0x1000+g] = test[g];
+    page_type[0xE0] = 2; //IO
+    page_type[0xFF] = 3; //ROM
+    refmem[0xFFFC] = 0x00;
+    refmem[0xFFFD] = 0x10;
+  } else if (strcmp(program, "random")) {
+    fprintf(stderr, "lockstep6502: unknown program %s\n", program);
+    exit(2);
+  }
+  memcpy(candmem, refmem, sizeof(candmem));
+  srand(seed);
+}
+
+// Install the BASIC loop and type RUN, once the ROMs are at READY.
+static void runbasic()
+{
+  uint16_t txttab, link;
+  int g;
+
+  txttab = refmem[0x2B] | (refmem[0x2C] << 8);
+  for (g=0; g<sizeof(prog); g++)
+    poke(txttab+g, prog[g]);
+  link = txttab + sizeof(prog) - 2;
+  poke(txttab, link & 0xff);
+  poke(txttab+1, link >> 8);
+  poke(0x2D, (link+2) & 0xff);
+  poke(0x2E, (link+2) >> 8);
+  poke(0x277, 'R');
+  poke(0x278, 'U');
+  poke(0x279, 'N');
+  poke(0x27A, 0x0D);
+  poke(0xC6, 4);
+}
+
+static void refstep()
+{
+  trace[ntrace++ % TRACE] = ref_pc;
+  ref_step6502();
+}
+
+static void candstep(const char *candidate, uint32_t ticks)
+{
+  uint32_t done = instructions;
+
+  if (!strcmp(candidate, "cycle")) {
+    do
+      cycle6502();
+    while (instructions == done);
+  } else if (ticks)
+    exec6502(ticks);
+  else
+    step6502();
+}
+
+static void mismatch(const char *what, long step, int ints)
+{
+  int g, n;
+
+  printf("MISMATCH in %s at step %ld (%u instructions)\n", what, step, ref_instructions);
+  printf("  ref:  pc=%04x a=%02x x=%02x y=%02x sp=%02x p=%02x clk=%u\n",
+         ref_pc, ref_a, ref_x, ref_y, ref_sp, ref_status, ref_clockticks6502);
+  printf("  cand: pc=%04x a=%02x x=%02x y=%02x sp=%02x p=%02x clk=%u (%d interrupts at 7 cycles)\n",
+         pc, a, x, y, sp, status, clockticks6502, ints);
+
+  n = nrefwrites > ncandwrites ? nrefwrites : ncandwrites;
+  if (n > MAXWRITES)
+    n = MAXWRITES;
+  for (g=0; g<n; g++) {
+    printf("  write %d: ", g);
+    if (g < nrefwrites)
+      printf("ref %04x=%02x", refwrites[g].address, refwrites[g].value);
+    else
+      printf("ref -------");
+    if (g < ncandwrites)
+      printf("  cand %04x=%02x", candwrites[g].address, candwrites[g].value);
+    else
+      printf("  cand -------");
+    if (g < nrefwrites && g < ncandwrites &&
+        (refwrites[g].address != candwrites[g].address || refwrites[g].value != candwrites[g].value))
+      printf("  <--");
+    printf("\n");
+  }
+
+  printf("  last instructions of the reference:\n");
+  for (g=ntrace>TRACE?ntrace-TRACE:0; g<ntrace; g++) {
+    uint16_t at = trace[g % TRACE];
+    printf("    %04x: %02x %02x %02x\n", at, refmem[at], refmem[(uint16_t)(at+1)], refmem[(uint16_t)(at+2)]);
+  }
+  exit(1);
+}
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+  const char *program = "boot", *candidate = "fake";
+  long count = 10, step;
+  uint32_t ticks = 0, start = 0, next_irq, next_nmi, next_random = RANDOM;
+  unsigned seed = 1;
+  int cycle, booted = 0, ints = 0;
+  double t;
+  int opt, g;
+
+  while ((opt = getopt(argc, argv, "p:c:n:k:s:t:")) != -1) {
+    switch (opt) {
+      case 'p': program = optarg; break;
+      case 'c': candidate = optarg; break;
+      case 'n': count = atol(optarg); break;
+      case 'k': ticks = atoi(optarg); break;
+      case 's': seed = atoi(optarg); break;
+      case 't': start = strtoul(optarg, NULL, 0); break;
+      default:
+        fprintf(stderr, "usage: %s [-p boot|test|random] [-c fake|cache|map|cycle|jit|jitmap] [-n million instructions] [-k ticks per step] [-s seed] [-t first clocktick]\n", argv[0]);
+        return 2;
+    }
+  }
+  count *= 1000000;
+  cycle = !strcmp(candidate, "cycle");
+
+#ifdef FAKE6502_JIT
+  if (strcmp(candidate, "jit") && strcmp(candidate, "jitmap")) {
+    fprintf(stderr, "lockstep6502: this build only runs the jit and jitmap candidates\n");
+    return 2;
+  }
+  if (!ticks)
+    ticks = 100; // blocks only run from exec6502()
+#else
+  if (strcmp(candidate, "fake") && strcmp(candidate, "cache") && strcmp(candidate, "map") && !cycle) {
+    fprintf(stderr, "lockstep6502: unknown candidate %s\n", candidate);
+    return 2;
+  }
+#endif
+  if (cycle && ticks) {
+    fprintf(stderr, "lockstep6502: the cycle candidate steps single instructions\n");
+    return 2;
+  }
+
+  load(program, seed);
+
+  if (strcmp(candidate, "fake") && !cycle)
+    for (g=0; g<256; g++)
+      if (page_type[g] != 2)
+        cache6502(g, g, 1);
+  // Read only, the writes have to reach write6502() to be compared
+  if (!strcmp(candidate, "map") || !strcmp(candidate, "jitmap"))
+    for (g=0; g<256; g++)
+      if (page_type[g] != 2)
+        map6502(g, g, &candmem[g << 8], 0);
+
+  ref_reset6502();
+  reset6502();
+  ref_clockticks6502 = clockticks6502 = clockgoal6502 = start;
+  next_irq = start + IRQ_TICKS;
+  next_nmi = start + NMI_TICKS;
+  if (!strcmp(program, "random"))
+    randomize();
+
+  t = now();
+  for (step=0; ref_instructions < count; step++) {
+    candstep(candidate, ticks);
+    while (ref_instructions < instructions)
+      refstep();
+
+    if (ref_pc != pc || ref_a != a || ref_x != x || ref_y != y || ref_sp != sp || ref_status != status)
+      mismatch("registers", step, ints);
+    if (ref_clockticks6502 + 7 * ints != clockticks6502 || ref_instructions != instructions)
+      mismatch("cycles", step, ints);
+    if (nrefwrites != ncandwrites)
+      mismatch("bus writes", step, ints);
+    for (g=0; g<nrefwrites && g<MAXWRITES; g++)
+      if (refwrites[g].address != candwrites[g].address || refwrites[g].value != candwrites[g].value)
+        mismatch("bus writes", step, ints);
+
+    // Interrupts go in between steps, the reference serves them right away
+    // and the candidate at its next instruction, with the same writes. Like
+    // the VIA's line the IRQ waits for I to be clear, neither core checks.
+    nrefwrites = ncandwrites = 0;
+    if (!strcmp(program, "random") && ref_instructions >= next_random) {
+      randomize();
+      next_random += RANDOM;
+    }
+    if (strcmp(program, "test") && (int32_t)(ref_clockticks6502 - next_irq) >= 0 && !(ref_status & 0x04)) {
+      ref_irq6502();
+      irq6502();
+      ints++;
+      next_irq = ref_clockticks6502 + IRQ_TICKS;
+    } else if (!strcmp(program, "random") && (int32_t)(ref_clockticks6502 - next_nmi) >= 0) {
+      ref_nmi6502();
+      nmi6502();
+      ints++;
+      next_nmi += NMI_TICKS;
+    }
+    if (!strcmp(program, "boot") && !booted && ref_clockticks6502 - start >= BOOT_TICKS) {
+      runbasic();
+      booted = 1;
+    }
+  }
+  t = now() - t;
+
+  printf("%-6s %-6s %10u instructions %10u ticks %6.2f M instructions/s  OK\n",
+         program, candidate, ref_instructions, ref_clockticks6502 - start, ref_instructions / t / 1e6);
+  return 0;
+}
@@ -0,0 +1,38 @@
+#ifndef _MEM6502_H_
+#define _MEM6502_H_
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+// The emulated address space is plain memory. Only the CPU thread writes
+// it, and it's free to keep what it likes in registers in between. Now
+// and then (every pacer quantum in the backends) it publishes: a release
+// fence, then the clockticks it got to. A thread reading the memory (the
+// video thread) first picks the clockticks up and then has an acquire
+// fence. Every write the CPU thread made before that publish is visible
+// to it from then on, later ones may or may not be yet. That's a frame
+// drawn while the CPU goes on, like on the real machine.
+//
+// cpu/memcheck6502.c ('make memcheck') tests exactly that.
+typedef struct {
+  _Alignas(64) _Atomic uint32_t ticks;
+} mem6502_pub_t;
+
+// CPU thread: everything written up to clockticks is out
+static inline void mem6502_publish(mem6502_pub_t *p, uint32_t clockticks)
+{
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&p->ticks, clockticks, memory_order_relaxed);
+}
+
+// Readers: returns the clockticks last published, the memory is at least
+// as far
+static inline uint32_t mem6502_acquire(mem6502_pub_t *p)
+{
+  uint32_t ticks = atomic_load_explicit(&p->ticks, memory_order_relaxed);
+
+  atomic_thread_fence(memory_order_acquire);
+  return ticks;
+}
+
+#endif
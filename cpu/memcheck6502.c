@@ -0,0 +1,196 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// memcheck6502: does a renderer see every write by the end of its frame?
+//
+// The backends' memory model (see mem6502.h), run the way the VIC-20
+// backend runs it. The CPU thread is run6502(): whole instructions of 2
+// to 7 cycles, one store a cycle, pace6502() after each, publishing when
+// the pacer synced (pace.ticks == clockticks) and when it's out of the
+// cycles main hands out, a chunk at a time. The video thread is
+// videoOut(): it picks the clockticks up and draws a frame once they're
+// FRAME cycles on from the last one. The pacer only counts (PACE_OFF).
+//
+// The stores go through a screen sized region, every byte once per pass
+// of REGION cycles, in a different order each pass, with the pass number.
+// From the clockticks it picked up the reader knows which bytes the
+// current pass has already been through and which only the one before,
+// none of them may be older than that, newer is fine. The writer stays at
+// most AHEAD passes ahead of the frame the reader finished, so the pass
+// numbers, a byte each, can't wrap around on it.
+//
+// What it doesn't have is the emulation between the stores: the handlers,
+// the VIAs and SDL are left out, the order and the conditions of the
+// publish and acquire are those of the backend.
+//
+// -u leaves the fences out (a relaxed store and load only). On a weakly
+// ordered core like the Pi's that should turn up stale bytes, on x86 the
+// stores stay in order anyway.
+//
+// usage: memcheck6502 [-n thousand passes] [-u]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+
+#include "mem6502.h"
+#include "pace6502.h"
+
+#define REGION  0x1000 // bytes, and cycles a pass
+#define AHEAD   64     // passes
+#define FRAME   20000  // cycles between frames, as in videoOut()
+#define QUANTUM 1000   // pacer sync, a millisecond at 1 MHz
+#define CHUNK   50000  // most cycles main hands out at a time
+
+static uint8_t mem[0x10000];
+static mem6502_pub_t pub;
+static _Atomic uint32_t frame_done;
+static uint32_t end;
+static int unfenced;
+
+static uint32_t frames, publishes, stale;
+static uint64_t checked;
+
+static void publish(uint32_t clockticks)
+{
+  publishes++;
+  if (unfenced)
+    atomic_store_explicit(&pub.ticks, clockticks, memory_order_relaxed);
+  else
+    mem6502_publish(&pub, clockticks);
+}
+
+static uint32_t acquire()
+{
+  if (unfenced)
+    return atomic_load_explicit(&pub.ticks, memory_order_relaxed);
+  return mem6502_acquire(&pub);
+}
+
+// Where cycle g of a pass stores, odd strides go through all of the region
+static inline uint32_t address(uint32_t pass, uint32_t g)
+{
+  return (g * ((pass * 2 + 1) & (REGION - 1))) & (REGION - 1);
+}
+
+static void *writer(void *arg)
+{
+  pace6502_t pace;
+  uint32_t clockticks = 0, left = 0, n, seed = 1;
+
+  pace6502_init(&pace, PACE_OFF, QUANTUM, clockticks);
+  for (;;) {
+    // Out of cycles: publish, then main hands out more
+    if (!left) {
+      publish(clockticks);
+      if (clockticks == end)
+        break;
+      seed = seed * 1103515245 + 12345;
+      left = 1 + (seed >> 8) % CHUNK;
+      if (left > end - clockticks)
+        left = end - clockticks;
+      continue;
+    }
+    while (clockticks / REGION - atomic_load_explicit(&frame_done, memory_order_relaxed) / REGION > AHEAD)
+      sched_yield();
+    // One instruction
+    seed = seed * 1103515245 + 12345;
+    n = 2 + (seed >> 8) % 6;
+    if (n > left)
+      n = left;
+    left -= n;
+    for (; n; n--, clockticks++)
+      mem[address(clockticks / REGION, clockticks % REGION)] = clockticks / REGION;
+    pace6502(&pace, clockticks);
+    if (pace.ticks == clockticks)
+      publish(clockticks);
+  }
+  return NULL;
+}
+
+// Every store before clockticks has to be there
+static void frame(uint32_t clockticks)
+{
+  uint32_t pass = clockticks / REGION, done = clockticks % REGION, g, a;
+  uint8_t age;
+
+  for (g=0; g<REGION; g++) {
+    if (g >= done && !pass)
+      break;
+    a = address(pass, g);
+    age = (g < done ? pass : pass - 1) - mem[a];
+    if (age && age < 128) {
+      if (!stale)
+        printf("memcheck6502: frame at %u, byte %u is from pass %u, want %u\n",
+               clockticks, a, mem[a], g < done ? pass : pass - 1);
+      stale++;
+    }
+  }
+  checked += REGION;
+  frames++;
+  atomic_store_explicit(&frame_done, clockticks, memory_order_relaxed);
+}
+
+static void *reader(void *arg)
+{
+  uint32_t old_ticks = acquire(), ticks;
+
+  for (;;) {
+    ticks = acquire();
+    if (ticks - old_ticks > FRAME || (ticks == end && ticks != old_ticks)) {
+      frame(ticks);
+      old_ticks = ticks;
+    } else if (ticks == end)
+      break;
+    else
+      sched_yield();
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv)
+{
+  pthread_t w, r;
+  long count = 25;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:u")) != -1) {
+    switch (opt) {
+      case 'n': count = atol(optarg); break;
+      case 'u': unfenced = 1; break;
+      default:
+        fprintf(stderr, "usage: %s [-n thousand passes] [-u]\n", argv[0]);
+        return 2;
+    }
+  }
+  end = count * 1000 * REGION;
+
+  if (pthread_create(&r, NULL, reader, NULL) || pthread_create(&w, NULL, writer, NULL)) {
+    fprintf(stderr, "memcheck6502: thread create failed\n");
+    return 2;
+  }
+  pthread_join(w, NULL);
+  pthread_join(r, NULL);
+
+  printf("memcheck6502: %u cycles, %u publishes, %u frames, %llu bytes checked, %u stale%s  %s\n",
+         end, publishes, frames, (unsigned long long)checked, stale, unfenced ? " (no fences)" : "",
+         stale ? "FAILED" : "OK");
+  return stale != 0;
+}
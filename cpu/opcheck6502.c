@@ -0,0 +1,416 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// opcheck6502: the 65C02 opcodes and cycles of the fake core
+//
+// The original core is no help here, it only knows the 2A03. So, built
+// with -DFAKE6502_65C02 and linked with a core built the same way:
+//  - every opcode once from the same start, with the cycles it should take
+//    there from the WDC datasheet (the table below, written from it and
+//    not from fake6502_ops.h). It's run by the interpreter, the
+//    interpreter with the decode cache and cycle by cycle (the micro
+//    programs), those three have to end up in the same state, and cycle
+//    by cycle every cycle has to be one bus access.
+//  - the 65C02 instructions on their own, BRA, PHX/PHY/PLX/PLY, STZ,
+//    TSB/TRB, RMB/SMB, BBR/BBS, INC A/DEC A, BIT #, (zp), JMP (abs,x) and
+//    JMP (abs) at the end of a page, the page crossing penalties and the
+//    decimal extra cycle, with their results.
+//  - WAI waiting, ended by an IRQ line with I set and by an IRQ taken,
+//    STP staying put, and interrupts taking 7 cycles with every driver.
+// Decimal mode as a whole is bcdcheck6502's.
+//
+// usage: opcheck6502
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdint.h>
+
+#include "fake6502.h"
+
+#ifndef FAKE6502_65C02
+#error "opcheck6502 needs -DFAKE6502_65C02"
+#endif
+
+#define FLAG_CARRY     0x01
+#define FLAG_ZERO      0x02
+#define FLAG_INTERRUPT 0x04
+#define FLAG_DECIMAL   0x08
+#define FLAG_BREAK     0x10
+#define FLAG_CONSTANT  0x20
+#define FLAG_OVERFLOW  0x40
+#define FLAG_SIGN      0x80
+#define FIXED (FLAG_CONSTANT | FLAG_INTERRUPT)
+
+#define CODE 0x0200
+
+enum { STEP, CACHE, CYCLE, DRIVERS };
+static const char *drivers[DRIVERS] = { "step", "cache", "cycle" };
+
+static uint8_t mem[0x10000];
+static uint32_t accesses, cases, failed;
+
+static uint8_t rd(void *userdata, uint16_t address)
+{
+  accesses++;
+  return mem[address];
+}
+
+static void wr(void *userdata, uint16_t address, uint8_t value)
+{
+  accesses++;
+  mem[address] = value;
+}
+
+// Cycles of every opcode from the start in sweep(): A, X and Y zero, the
+// zero page byte $10 zero (and a pointer to $0400 with $11), D clear and
+// the flags such that no conditional branch is taken. That makes BRA and
+// every BBR take their branch, within the page.
+static const uint8_t wdccycles[256] = {
+/*        0 1 2 3 4 5 6 7 8 9 A B C D E F */
+/* 0 */   7,6,2,1,5,3,5,5,3,2,2,1,6,4,6,6,
+/* 1 */   2,5,5,1,5,4,6,5,2,4,2,1,6,4,6,6,
+/* 2 */   6,6,2,1,3,3,5,5,4,2,2,1,4,4,6,6,
+/* 3 */   2,5,5,1,4,4,6,5,2,4,2,1,4,4,6,6,
+/* 4 */   6,6,2,1,3,3,5,5,3,2,2,1,3,4,6,6,
+/* 5 */   2,5,5,1,4,4,6,5,2,4,3,1,8,4,6,6,
+/* 6 */   6,6,2,1,3,3,5,5,4,2,2,1,6,4,6,6,
+/* 7 */   2,5,5,1,4,4,6,5,2,4,4,1,6,4,6,6,
+/* 8 */   3,6,2,1,3,3,3,5,2,2,2,1,4,4,4,5,
+/* 9 */   2,6,5,1,4,4,4,5,2,5,2,1,4,5,5,5,
+/* A */   2,6,2,1,3,3,3,5,2,2,2,1,4,4,4,5,
+/* B */   2,5,5,1,4,4,4,5,2,4,2,1,4,4,4,5,
+/* C */   2,6,2,1,3,3,5,5,2,2,2,3,4,4,6,5,
+/* D */   2,5,5,1,4,4,6,5,2,4,3,3,4,4,7,5,
+/* E */   2,6,2,1,3,3,5,5,2,2,2,1,4,4,6,5,
+/* F */   2,5,5,1,4,4,6,5,2,4,4,1,4,4,7,5
+};
+
+typedef struct {
+  uint16_t addr;
+  uint8_t before, after;
+} cell_t;
+
+typedef struct {
+  const char *name;
+  uint16_t org;
+  uint8_t code[3];
+  uint8_t a, x, y, p, sp;
+  cell_t cell[3];                // addr 0 = unused
+  uint8_t ea, ex, ey, ep, esp;
+  uint16_t epc;
+  uint32_t cycles;
+} check_t;
+
+#define N FLAG_SIGN
+#define V FLAG_OVERFLOW
+#define D FLAG_DECIMAL
+#define Z FLAG_ZERO
+#define C FLAG_CARRY
+#define P FIXED
+
+static const check_t checks[] = {
+  //name                 org     code                a     x     y     p       sp    cells                                            a     x     y     p       sp    pc      cycles
+  { "BRA",               0x0200, { 0x80, 0x10 },       0x00, 0x00, 0x00, P,      0xFF, { },                                             0x00, 0x00, 0x00, P,      0xFF, 0x0212, 3 },
+  { "BRA page cross",    0x0200, { 0x80, 0xF0 },       0x00, 0x00, 0x00, P,      0xFF, { },                                             0x00, 0x00, 0x00, P,      0xFF, 0x01F2, 4 },
+  { "PHX",               0x0200, { 0xDA },             0x00, 0x5A, 0x00, P,      0xFD, { { 0x01FD, 0x00, 0x5A } },                      0x00, 0x5A, 0x00, P,      0xFC, 0x0201, 3 },
+  { "PHY",               0x0200, { 0x5A },             0x00, 0x00, 0xA5, P,      0xFD, { { 0x01FD, 0x00, 0xA5 } },                      0x00, 0x00, 0xA5, P,      0xFC, 0x0201, 3 },
+  { "PLX",               0x0200, { 0xFA },             0x00, 0x00, 0x00, P|Z,    0xFC, { { 0x01FD, 0x80, 0x80 } },                      0x00, 0x80, 0x00, P|N,    0xFD, 0x0201, 4 },
+  { "PLY",               0x0200, { 0x7A },             0x00, 0x00, 0x55, P|N,    0xFC, { { 0x01FD, 0x00, 0x00 } },                      0x00, 0x00, 0x00, P|Z,    0xFD, 0x0201, 4 },
+  { "STZ zp",            0x0200, { 0x64, 0x10 },       0x00, 0x00, 0x00, P,      0xFF, { { 0x0010, 0xFF, 0x00 } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0202, 3 },
+  { "STZ zp,x wrap",     0x0200, { 0x74, 0xF8 },       0x00, 0x10, 0x00, P,      0xFF, { { 0x0008, 0xFF, 0x00 } },                      0x00, 0x10, 0x00, P,      0xFF, 0x0202, 4 },
+  { "STZ abs",           0x0200, { 0x9C, 0x10, 0x03 }, 0x00, 0x00, 0x00, P,      0xFF, { { 0x0310, 0xFF, 0x00 } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0203, 4 },
+  { "STZ abs,x cross",   0x0200, { 0x9E, 0xF0, 0x03 }, 0x00, 0x20, 0x00, P,      0xFF, { { 0x0410, 0xFF, 0x00 } },                      0x00, 0x20, 0x00, P,      0xFF, 0x0203, 5 },
+  { "TSB zp",            0x0200, { 0x04, 0x10 },       0x0F, 0x00, 0x00, P,      0xFF, { { 0x0010, 0xF0, 0xFF } },                      0x0F, 0x00, 0x00, P|Z,    0xFF, 0x0202, 5 },
+  { "TSB abs",           0x0200, { 0x0C, 0x10, 0x03 }, 0x11, 0x00, 0x00, P|Z,    0xFF, { { 0x0310, 0x10, 0x11 } },                      0x11, 0x00, 0x00, P,      0xFF, 0x0203, 6 },
+  { "TRB zp",            0x0200, { 0x14, 0x10 },       0x0F, 0x00, 0x00, P|Z,    0xFF, { { 0x0010, 0xFF, 0xF0 } },                      0x0F, 0x00, 0x00, P,      0xFF, 0x0202, 5 },
+  { "TRB abs",           0x0200, { 0x1C, 0x10, 0x03 }, 0x0F, 0x00, 0x00, P,      0xFF, { { 0x0310, 0xF0, 0xF0 } },                      0x0F, 0x00, 0x00, P|Z,    0xFF, 0x0203, 6 },
+  { "RMB3",              0x0200, { 0x37, 0x10 },       0x00, 0x00, 0x00, P,      0xFF, { { 0x0010, 0xFF, 0xF7 } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0202, 5 },
+  { "SMB5",              0x0200, { 0xD7, 0x10 },       0x00, 0x00, 0x00, P,      0xFF, { { 0x0010, 0x00, 0x20 } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0202, 5 },
+  { "BBR0 taken",        0x0200, { 0x0F, 0x10, 0x05 }, 0x00, 0x00, 0x00, P,      0xFF, { { 0x0010, 0xFE, 0xFE } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0208, 6 },
+  { "BBR0 not taken",    0x0200, { 0x0F, 0x10, 0x05 }, 0x00, 0x00, 0x00, P,      0xFF, { { 0x0010, 0x01, 0x01 } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0203, 5 },
+  { "BBS7 taken",        0x0240, { 0xFF, 0x10, 0xF0 }, 0x00, 0x00, 0x00, P,      0xFF, { { 0x0010, 0x80, 0x80 } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0233, 6 },
+  { "BBS7 not taken",    0x0240, { 0xFF, 0x10, 0xF0 }, 0x00, 0x00, 0x00, P,      0xFF, { { 0x0010, 0x7F, 0x7F } },                      0x00, 0x00, 0x00, P,      0xFF, 0x0243, 5 },
+  { "INC A",             0x0200, { 0x1A },             0xFF, 0x00, 0x00, P|N,    0xFF, { },                                             0x00, 0x00, 0x00, P|Z,    0xFF, 0x0201, 2 },
+  { "DEC A",             0x0200, { 0x3A },             0x00, 0x00, 0x00, P|Z,    0xFF, { },                                             0xFF, 0x00, 0x00, P|N,    0xFF, 0x0201, 2 },
+  { "BIT #",             0x0200, { 0x89, 0x80 },       0x7F, 0x00, 0x00, P|N|V,  0xFF, { },                                             0x7F, 0x00, 0x00, P|N|V|Z,0xFF, 0x0202, 2 },
+  { "LDA (zp)",          0x0200, { 0xB2, 0x10 },       0x00, 0x00, 0x00, P|Z,    0xFF, { { 0x0010, 0x00, 0x00 }, { 0x0011, 0x04, 0x04 }, { 0x0400, 0x42, 0x42 } },
+                                                                                                                                        0x42, 0x00, 0x00, P,      0xFF, 0x0202, 5 },
+  { "STA (zp)",          0x0200, { 0x92, 0x10 },       0x99, 0x00, 0x00, P,      0xFF, { { 0x0010, 0x00, 0x00 }, { 0x0011, 0x04, 0x04 }, { 0x0400, 0x00, 0x99 } },
+                                                                                                                                        0x99, 0x00, 0x00, P,      0xFF, 0x0202, 5 },
+  { "JMP (abs) page end",0x0200, { 0x6C, 0xFF, 0x02 }, 0x00, 0x00, 0x00, P,      0xFF, { { 0x02FF, 0x34, 0x34 }, { 0x0300, 0x12, 0x12 } },
+                                                                                                                                        0x00, 0x00, 0x00, P,      0xFF, 0x1234, 6 },
+  { "JMP (abs,x)",       0x0200, { 0x7C, 0x00, 0x03 }, 0x00, 0x04, 0x00, P,      0xFF, { { 0x0304, 0x78, 0x78 }, { 0x0305, 0x56, 0x56 } },
+                                                                                                                                        0x00, 0x04, 0x00, P,      0xFF, 0x5678, 6 },
+  { "ASL abs,x",         0x0200, { 0x1E, 0x10, 0x03 }, 0x00, 0x01, 0x00, P,      0xFF, { { 0x0311, 0x81, 0x02 } },                      0x00, 0x01, 0x00, P|C,    0xFF, 0x0203, 6 },
+  { "ASL abs,x cross",   0x0200, { 0x1E, 0xF0, 0x03 }, 0x00, 0x20, 0x00, P,      0xFF, { { 0x0410, 0x40, 0x80 } },                      0x00, 0x20, 0x00, P|N,    0xFF, 0x0203, 7 },
+  { "INC abs,x",         0x0200, { 0xFE, 0x10, 0x03 }, 0x00, 0x01, 0x00, P,      0xFF, { { 0x0311, 0x7F, 0x80 } },                      0x00, 0x01, 0x00, P|N,    0xFF, 0x0203, 7 },
+  { "LDA abs,x cross",   0x0200, { 0xBD, 0xF0, 0x03 }, 0x00, 0x20, 0x00, P|Z,    0xFF, { { 0x0410, 0x01, 0x01 } },                      0x01, 0x20, 0x00, P,      0xFF, 0x0203, 5 },
+  { "LDA (zp),y cross",  0x0200, { 0xB1, 0x10 },       0x00, 0x00, 0xFF, P|Z,    0xFF, { { 0x0010, 0x01, 0x01 }, { 0x0011, 0x04, 0x04 }, { 0x0500, 0x05, 0x05 } },
+                                                                                                                                        0x05, 0x00, 0xFF, P,      0xFF, 0x0202, 6 },
+  { "BNE taken cross",   0x02F0, { 0xD0, 0x20 },       0x00, 0x00, 0x00, P,      0xFF, { },                                             0x00, 0x00, 0x00, P,      0xFF, 0x0312, 4 },
+  { "ADC # decimal",     0x0200, { 0x69, 0x01 },       0x09, 0x00, 0x00, P|D|N,  0xFF, { },                                             0x10, 0x00, 0x00, P|D,    0xFF, 0x0202, 3 },
+  { "SBC # decimal",     0x0200, { 0xE9, 0x01 },       0x10, 0x00, 0x00, P|D|C,  0xFF, { },                                             0x09, 0x00, 0x00, P|D|C,  0xFF, 0x0202, 3 },
+  { "ADC abs decimal",   0x0200, { 0x6D, 0x10, 0x03 }, 0x99, 0x00, 0x00, P|D,    0xFF, { { 0x0310, 0x01, 0x01 } },                      0x00, 0x00, 0x00, P|D|Z|C,0xFF, 0x0203, 5 },
+  { "NOP $5C",           0x0200, { 0x5C, 0x10, 0x03 }, 0x00, 0x00, 0x00, P,      0xFF, { },                                             0x00, 0x00, 0x00, P,      0xFF, 0x0203, 8 },
+  { "NOP $03",           0x0200, { 0x03 },             0x00, 0x00, 0x00, P,      0xFF, { },                                             0x00, 0x00, 0x00, P,      0xFF, 0x0201, 1 },
+};
+
+#undef N
+#undef V
+#undef D
+#undef Z
+#undef C
+#undef P
+
+static void fail(const char *name, int driver, const char *fmt, ...)
+{
+  va_list ap;
+
+  if (failed++ >= 20)
+    return;
+  printf("%s (%s): ", name, drivers[driver]);
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+  printf("\n");
+}
+
+static void setup(cpu6502_t *c, int driver)
+{
+  cpu6502_init(c, rd, wr, NULL);
+  if (driver == CACHE)
+    cpu6502_cache(c, 0, 255, 1);
+}
+
+static void teardown(cpu6502_t *c, int driver)
+{
+  if (driver == CACHE)
+    cpu6502_cache(c, 0, 255, 0);
+}
+
+// One instruction (or interrupt) by the driver, returns the cycles it took.
+// Cycle by cycle, every cycle must have been one bus access.
+static uint32_t one(cpu6502_t *c, int driver, const char *name)
+{
+  uint32_t clk = c->clockticks, n;
+
+  accesses = 0;
+  if (driver == CYCLE) {
+    do
+      cpu6502_cycle(c);
+    while (c->mprog);
+  } else
+    cpu6502_step(c);
+  n = c->clockticks - clk;
+  if (driver == CYCLE && accesses != n)
+    fail(name, driver, "%u cycles but %u bus accesses", n, accesses);
+  return n;
+}
+
+// Every opcode from the same start, the drivers have to agree on the cycles
+// (with wdccycles) and everything else
+static void sweep()
+{
+  static uint8_t after[DRIVERS][0x10000];
+  cpu6502_t cpu[DRIVERS];
+  char name[16];
+  uint32_t n;
+  int op, driver;
+
+  for (op=0; op<256; op++) {
+    snprintf(name, sizeof(name), "opcode $%02X", op);
+    for (driver=0; driver<DRIVERS; driver++) {
+      memset(mem, 0, sizeof(mem));
+      mem[CODE] = op;
+      mem[CODE + 1] = 0x10;
+      mem[CODE + 2] = 0x03;
+      mem[0x11] = 0x04;
+      setup(&cpu[driver], driver);
+      cpu[driver].pc = CODE;
+      cpu[driver].sp = 0xFF;
+      cpu[driver].a = cpu[driver].x = cpu[driver].y = 0;
+      // Flags opposite to what each conditional branch wants
+      cpu[driver].status = FIXED | FLAG_SIGN | FLAG_OVERFLOW | FLAG_CARRY | FLAG_ZERO;
+      switch (op) {
+        case 0x30: case 0x70: case 0xB0: case 0xF0:
+          cpu[driver].status &= ~(FLAG_SIGN | FLAG_OVERFLOW | FLAG_CARRY | FLAG_ZERO);
+          break;
+      }
+      n = one(&cpu[driver], driver, name);
+      cases++;
+      if (n != wdccycles[op])
+        fail(name, driver, "%u cycles, want %u", n, wdccycles[op]);
+      memcpy(after[driver], mem, sizeof(mem));
+      teardown(&cpu[driver], driver);
+    }
+    for (driver=1; driver<DRIVERS; driver++) {
+      cpu6502_t *s = &cpu[STEP], *o = &cpu[driver];
+
+      if (o->pc != s->pc || o->sp != s->sp || o->a != s->a || o->x != s->x || o->y != s->y ||
+          o->status != s->status || o->waiting != s->waiting)
+        fail(name, driver, "PC=%04X SP=%02X A=%02X X=%02X Y=%02X P=%02X W=%d, step has "
+             "PC=%04X SP=%02X A=%02X X=%02X Y=%02X P=%02X W=%d",
+             o->pc, o->sp, o->a, o->x, o->y, o->status, o->waiting,
+             s->pc, s->sp, s->a, s->x, s->y, s->status, s->waiting);
+      if (memcmp(after[driver], after[STEP], sizeof(mem)))
+        fail(name, driver, "memory differs from step");
+    }
+  }
+}
+
+static void check(const check_t *t, int driver)
+{
+  cpu6502_t cpu;
+  uint32_t n;
+  int i;
+
+  memset(mem, 0, sizeof(mem));
+  memcpy(&mem[t->org], t->code, sizeof(t->code));
+  for (i=0; i<3; i++)
+    if (t->cell[i].addr)
+      mem[t->cell[i].addr] = t->cell[i].before;
+  setup(&cpu, driver);
+  cpu.pc = t->org;
+  cpu.a = t->a;
+  cpu.x = t->x;
+  cpu.y = t->y;
+  cpu.status = t->p;
+  cpu.sp = t->sp;
+  n = one(&cpu, driver, t->name);
+  cases++;
+
+  if (cpu.pc != t->epc || cpu.a != t->ea || cpu.x != t->ex || cpu.y != t->ey ||
+      cpu.status != t->ep || cpu.sp != t->esp || n != t->cycles)
+    fail(t->name, driver, "PC=%04X A=%02X X=%02X Y=%02X P=%02X SP=%02X %u cycles, want "
+         "PC=%04X A=%02X X=%02X Y=%02X P=%02X SP=%02X %u cycles",
+         cpu.pc, cpu.a, cpu.x, cpu.y, cpu.status, cpu.sp, n,
+         t->epc, t->ea, t->ex, t->ey, t->ep, t->esp, t->cycles);
+  for (i=0; i<3; i++)
+    if (t->cell[i].addr && mem[t->cell[i].addr] != t->cell[i].after)
+      fail(t->name, driver, "$%04X=%02X, want %02X", t->cell[i].addr,
+           mem[t->cell[i].addr], t->cell[i].after);
+  teardown(&cpu, driver);
+}
+
+// WAI, STP and the interrupts, a few instructions each
+static void waits(int driver)
+{
+  cpu6502_t cpu;
+  uint32_t n;
+  int i;
+
+  // WAI with nothing pending stays, an IRQ line pulled with I set ends it
+  // without the interrupt
+  memset(mem, 0, sizeof(mem));
+  mem[CODE] = 0xCB;
+  mem[CODE + 1] = 0xEA;
+  setup(&cpu, driver);
+  cpu.pc = CODE;
+  cpu.sp = 0xFF;
+  cpu.status = FIXED;
+  for (i=0; i<3; i++) {
+    n = one(&cpu, driver, "WAI");
+    cases++;
+    if (cpu.pc != CODE || !cpu.waiting || n != 3)
+      fail("WAI", driver, "PC=%04X waiting=%d %u cycles, want PC=%04X waiting %u cycles",
+           cpu.pc, cpu.waiting, n, CODE, 3);
+  }
+  cpu6502_irqline(&cpu, 1, 1);
+  n = one(&cpu, driver, "WAI, I set");
+  cases++;
+  if (cpu.pc != CODE + 1 || cpu.waiting || cpu.sp != 0xFF || n != 3)
+    fail("WAI, I set", driver, "PC=%04X SP=%02X waiting=%d %u cycles, want PC=%04X SP=FF %u cycles",
+         cpu.pc, cpu.sp, cpu.waiting, n, CODE + 1, 3);
+  teardown(&cpu, driver);
+
+  // With I clear the IRQ is taken, 7 cycles, returning behind the WAI, then
+  // the NOP at the vector
+  memset(mem, 0, sizeof(mem));
+  mem[CODE] = 0xCB;
+  mem[0xFFFE] = 0x00;
+  mem[0xFFFF] = 0x03;
+  mem[0x0300] = 0xEA;
+  setup(&cpu, driver);
+  cpu.pc = CODE;
+  cpu.sp = 0xFF;
+  cpu.status = FLAG_CONSTANT;
+  one(&cpu, driver, "WAI, IRQ");
+  cpu6502_irqline(&cpu, 1, 1);
+  n = one(&cpu, driver, "WAI, IRQ");
+  if (driver == CYCLE)
+    n += one(&cpu, driver, "WAI, IRQ");
+  cases++;
+  if (cpu.pc != 0x0301 || cpu.waiting || cpu.sp != 0xFC || !(cpu.status & FLAG_INTERRUPT) ||
+      mem[0x01FF] != 0x02 || mem[0x01FE] != 0x01 || (mem[0x01FD] & FLAG_BREAK) || n != 7 + 2)
+    fail("WAI, IRQ", driver, "PC=%04X SP=%02X P=%02X pushed %02X%02X %02X, %u cycles, "
+         "want PC=0301 SP=FC I set pushed 0201 B clear, %u cycles",
+         cpu.pc, cpu.sp, cpu.status, mem[0x01FF], mem[0x01FE], mem[0x01FD], n, 7 + 2);
+  teardown(&cpu, driver);
+
+  // An NMI with I set, 7 cycles too
+  memset(mem, 0, sizeof(mem));
+  mem[CODE] = 0xEA;
+  mem[0xFFFA] = 0x00;
+  mem[0xFFFB] = 0x03;
+  mem[0x0300] = 0xEA;
+  setup(&cpu, driver);
+  cpu.pc = CODE;
+  cpu.sp = 0xFF;
+  cpu.status = FIXED;
+  cpu6502_nmi(&cpu);
+  n = one(&cpu, driver, "NMI");
+  if (driver == CYCLE)
+    n += one(&cpu, driver, "NMI");
+  cases++;
+  if (cpu.pc != 0x0301 || cpu.sp != 0xFC || mem[0x01FF] != 0x02 || mem[0x01FE] != 0x00 || n != 7 + 2)
+    fail("NMI", driver, "PC=%04X SP=%02X pushed %02X%02X, %u cycles, want PC=0301 SP=FC pushed 0200, %u cycles",
+         cpu.pc, cpu.sp, mem[0x01FF], mem[0x01FE], n, 7 + 2);
+  teardown(&cpu, driver);
+
+  // STP stays put
+  memset(mem, 0, sizeof(mem));
+  mem[CODE] = 0xDB;
+  mem[CODE + 1] = 0xEA;
+  setup(&cpu, driver);
+  cpu.pc = CODE;
+  cpu.sp = 0xFF;
+  cpu.status = FIXED;
+  for (i=0; i<3; i++) {
+    n = one(&cpu, driver, "STP");
+    cases++;
+    if (cpu.pc != CODE || n != 3)
+      fail("STP", driver, "PC=%04X %u cycles, want PC=%04X %u cycles", cpu.pc, n, CODE, 3);
+  }
+  teardown(&cpu, driver);
+}
+
+int main()
+{
+  int i, driver;
+
+  sweep();
+  for (driver=0; driver<DRIVERS; driver++) {
+    for (i=0; i<(int)(sizeof(checks) / sizeof(checks[0])); i++)
+      check(&checks[i], driver);
+    waits(driver);
+  }
+
+  printf("opcheck6502: 65C02 opcodes and cycles, %u cases, %u failed  %s\n",
+         cases, failed, failed ? "FAILED" : "OK");
+  return failed != 0;
+}
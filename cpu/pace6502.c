@@ -0,0 +1,93 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// pace6502: runs a CPU, real or fake, at the speed of the machine it is in
+//
+// Sleeping is only precise to some 50-100us, so the CPU runs a quantum of
+// cycles (1ms by default) flat out and then sleeps until the wall clock
+// has caught up with it. When the quantum is due is worked out from the
+// start every time, never from the last sync, so the error of one sleep is
+// made good by the next and the long-term rate is exact.
+
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+
+#include "pace6502.h"
+
+static uint64_t now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// ns from the start to cycle n, without overflowing for days of cycles
+static uint64_t due(pace6502_t *p, uint64_t n)
+{
+  return n / p->hz * 1000000000ull + n % p->hz * 1000000000ull / p->hz;
+}
+
+void pace6502_init(pace6502_t *p, uint32_t hz, uint32_t quantum, uint32_t clockticks)
+{
+  p->hz = hz;
+  p->quantum = quantum ? quantum : hz ? hz / 1000 : 1000;
+  p->ticks = clockticks;
+  p->cycles = 0;
+  p->start = now();
+  p->sleeps = p->late = p->lost = 0;
+  p->slept = p->given = 0;
+  p->reportticks = clockticks;
+  p->reportns = p->start;
+}
+
+void pace6502_sync(pace6502_t *p, uint32_t clockticks)
+{
+  struct timespec ts;
+  uint64_t t, at;
+
+  p->cycles += clockticks - p->ticks;
+  p->ticks = clockticks;
+  if (!p->hz)
+    return;
+
+  t = now();
+  at = p->start + due(p, p->cycles);
+  if (at > t) {
+    ts.tv_sec = at / 1000000000ull;
+    ts.tv_nsec = at % 1000000000ull;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+    p->sleeps++;
+    p->slept += at - t;
+  } else if (t - at > PACE_SLACK) {
+    // Too far behind to catch up unnoticed, start over from here
+    p->start += t - at;
+    p->given += t - at;
+    p->lost++;
+  } else
+    p->late++;
+}
+
+double pace6502_mhz(pace6502_t *p, uint32_t clockticks)
+{
+  double t = now(), mhz;
+
+  mhz = (clockticks - p->reportticks) * 1000.0 / (t - p->reportns);
+  p->reportticks = clockticks;
+  p->reportns = t;
+  return mhz;
+}
@@ -0,0 +1,50 @@
+#ifndef _PACE6502_H_
+#define _PACE6502_H_
+
+#include <stdint.h>
+
+// Emulated clocks, in Hz
+#define PACE_NTSC 1022727 // VIC-20 NTSC, 14.31818 MHz / 14
+#define PACE_PAL  1108405 // VIC-20 PAL, 4.433619 MHz * 4 / 16
+#define PACE_OFF  0       // as fast as the host goes
+
+// Keeps a CPU at hz against CLOCK_MONOTONIC. The CPU thread calls
+// pace6502() with its clockticks after every quantum of cycles (or more,
+// whole instructions are fine): ahead of the wall clock it sleeps until the
+// quantum is due, behind it runs on and catches up. Every quantum is due at
+// a fixed offset from the start, so sleeping late or short never adds up.
+// Behind by more than PACE_SLACK it gives the time up (a stalled host, a
+// debugger) instead of racing to make up for it.
+#define PACE_SLACK 50000000 // ns
+
+typedef struct {
+  uint32_t hz, quantum;
+  uint32_t ticks;     // clockticks at the last sync
+  uint64_t cycles;    // since the start
+  uint64_t start;     // CLOCK_MONOTONIC ns, moved on by the time given up
+
+  // statistics
+  uint32_t sleeps, late, lost; // quanta slept for, run late, given up
+  uint64_t slept, given;       // ns
+
+  // pace6502_mhz(), from another thread
+  uint32_t reportticks;
+  double reportns;
+} pace6502_t;
+
+// Start pacing at hz (PACE_OFF only counts), clockticks is where the CPU is
+// now. quantum = 0 syncs once a millisecond.
+extern void pace6502_init(pace6502_t *p, uint32_t hz, uint32_t quantum, uint32_t clockticks);
+
+// Syncs when a quantum is through, cheap otherwise
+extern void pace6502_sync(pace6502_t *p, uint32_t clockticks);
+static inline void pace6502(pace6502_t *p, uint32_t clockticks)
+{
+  if (clockticks - p->ticks >= p->quantum)
+    pace6502_sync(p, clockticks);
+}
+
+// MHz the CPU ran at since the last call (or init)
+extern double pace6502_mhz(pace6502_t *p, uint32_t clockticks);
+
+#endif
@@ -0,0 +1,78 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// ring6502: the slow side of the device write ring, see ring6502.h
+//
+// ring6502_put() only gets here when the ring is full as far as it knows.
+// The bus is stopped in the middle of a write while we wait, so it's kept
+// short: spin on the tail, and every SYNC6502_SPIN rounds make sure the
+// consumer isn't asleep on its event.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "ring6502.h"
+
+int ring6502_init(ring6502_t *r, uint32_t size, int policy, sync6502_t *wake)
+{
+  if (!size || (size & (size - 1)) || !(r->rec = calloc(size, sizeof(ring6502_rec_t)))) {
+    printf("ring6502: no ring of %u records\n", size);
+    return 0;
+  }
+  r->size = size;
+  r->policy = policy;
+  r->wake = wake;
+  atomic_store(&r->head, 0);
+  atomic_store(&r->tail, 0);
+  atomic_store(&r->stop, 0);
+  r->limit = size;
+  r->seen = 0;
+  r->stalls = r->dropped = r->highwater = 0;
+  return 1;
+}
+
+void ring6502_stop(ring6502_t *r)
+{
+  atomic_store(&r->stop, 1);
+}
+
+int ring6502_full(ring6502_t *r, uint32_t head)
+{
+  uint32_t spin;
+
+  if (r->policy == RING6502_STALL) {
+    r->stalls++;
+    for (spin=1; !atomic_load_explicit(&r->stop, memory_order_relaxed); spin++) {
+      r->limit = atomic_load_explicit(&r->tail, memory_order_acquire) + r->size;
+      if (head != r->limit)
+        return 1;
+      if (spin % SYNC6502_SPIN == 0 && r->wake)
+        sync6502_signal(r->wake);
+      else
+        sync6502_relax();
+    }
+  }
+  r->dropped++;
+  return 0;
+}
+
+void ring6502_print(ring6502_t *r, const char *what)
+{
+  printf("%s: %u of %u records used at most, stalled %u times, dropped %u\n", what,
+         r->highwater, r->size, r->stalls, r->dropped);
+}
@@ -0,0 +1,100 @@
+#ifndef _RING6502_H_
+#define _RING6502_H_
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "sync6502.h"
+
+// Device writes from the CPU thread to the I/O thread: a single producer,
+// single consumer ring of (clocktick, address, value). The producer's and
+// the consumer's indexes are on cache lines of their own, each side only
+// looks at the other's when it has used up what it saw last. The consumer
+// takes every record up to a clocktick in one go and gives the slots back
+// with one store.
+//
+// A full ring stalls the CPU thread (RING6502_STALL) until the consumer
+// made room, waking it through the event it might sleep on, or drops the
+// write (RING6502_DROP). Either way it's counted. ring6502_stop() makes
+// stalls drop, for shutting down with the consumer gone.
+#define RING6502_STALL 0
+#define RING6502_DROP  1
+
+#define RING6502_LINE 64
+
+typedef struct {
+  uint32_t tick;  // clockticks when it was written
+  uint16_t addr;
+  uint8_t data;
+} ring6502_rec_t;
+
+typedef struct {
+  // producer
+  _Alignas(RING6502_LINE) _Atomic uint32_t head;
+  uint32_t limit;      // tail as last seen + size
+  uint32_t stalls, dropped;
+
+  // consumer
+  _Alignas(RING6502_LINE) _Atomic uint32_t tail;
+  uint32_t seen;       // head as last seen
+  uint32_t highwater;  // most records waiting
+
+  // read only once set up
+  _Alignas(RING6502_LINE) ring6502_rec_t *rec;
+  uint32_t size;       // a power of 2
+  int policy;
+  sync6502_t *wake;    // the consumer sleeps on it, NULL: it doesn't
+  atomic_uchar stop;
+} ring6502_t;
+
+// Returns 0 when there's no memory
+extern int ring6502_init(ring6502_t *r, uint32_t size, int policy, sync6502_t *wake);
+extern void ring6502_stop(ring6502_t *r);
+// Prints the high water mark, stalls and drops
+extern void ring6502_print(ring6502_t *r, const char *what);
+// Producer, the ring is full. Returns 0 if the write is to be dropped
+extern int ring6502_full(ring6502_t *r, uint32_t head);
+
+// Producer: queues a write, returns 0 if it was dropped
+static inline int ring6502_put(ring6502_t *r, uint32_t tick, uint16_t addr, uint8_t data)
+{
+  uint32_t h = atomic_load_explicit(&r->head, memory_order_relaxed);
+  ring6502_rec_t *rec;
+
+  if (h == r->limit) {
+    r->limit = atomic_load_explicit(&r->tail, memory_order_acquire) + r->size;
+    if (h == r->limit && !ring6502_full(r, h))
+      return 0;
+  }
+  rec = &r->rec[h & (r->size - 1)];
+  rec->tick = tick;
+  rec->addr = addr;
+  rec->data = data;
+  atomic_store_explicit(&r->head, h + 1, memory_order_release);
+  return 1;
+}
+
+// Consumer: calls fn for every record written up to tick (inclusive), in
+// order, and returns how many
+static inline uint32_t ring6502_drain(ring6502_t *r, uint32_t tick, void (*fn)(ring6502_rec_t *))
+{
+  uint32_t t = atomic_load_explicit(&r->tail, memory_order_relaxed), first = t;
+  ring6502_rec_t *rec;
+
+  if (t == r->seen) {
+    r->seen = atomic_load_explicit(&r->head, memory_order_acquire);
+    if (r->seen - t > r->highwater)
+      r->highwater = r->seen - t;
+  }
+  for (; t != r->seen; t++) {
+    rec = &r->rec[t & (r->size - 1)];
+    if ((int32_t)(rec->tick - tick) > 0)
+      break;
+    fn(rec);
+  }
+  if (t != first)
+    atomic_store_explicit(&r->tail, t, memory_order_release);
+  return t - first;
+}
+
+#endif
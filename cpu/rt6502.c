@@ -0,0 +1,177 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// rt6502: real-time mode for the CPU thread, see rt6502.h
+//
+// The 65C02 is clocked by the CPU thread, every time it is preempted or
+// waits for a page fault the clock stops in the middle of a cycle. So it
+// gets a core to itself, where nothing but interrupts can get in its way,
+// and a priority over everything else that might still be scheduled there.
+// The I/O and video threads spin too, they go to the other cores. Memory is
+// locked so neither the CPU thread nor the I/O thread it waits for ever
+// faults.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "rt6502.h"
+
+static int rtcpu = -1;
+
+// First core in the kernel's isolated list, -1 if there's none
+static int isolated()
+{
+  FILE *f = fopen("/sys/devices/system/cpu/isolated", "r");
+  int cpu = -1;
+
+  if (f) {
+    if (fscanf(f, "%d", &cpu) != 1)
+      cpu = -1;
+    fclose(f);
+  }
+  return cpu;
+}
+
+int rt6502_init(int cpu)
+{
+  int ncpu = sysconf(_SC_NPROCESSORS_ONLN), g;
+  long runtime = -1;
+  cpu_set_t set;
+  FILE *f;
+
+  if (ncpu < 2) {
+    printf("rt6502: needs a core for the CPU thread and one for the rest\n");
+    return -1;
+  }
+  if (cpu < 0)
+    cpu = isolated();
+  if (cpu < 0)
+    cpu = ncpu - 1;
+  if (cpu >= ncpu) {
+    printf("rt6502: no core %d\n", cpu);
+    return -1;
+  }
+
+  if (mlockall(MCL_CURRENT | MCL_FUTURE))
+    printf("rt6502: mlockall failed (%s), memory may be paged\n", strerror(errno));
+
+  CPU_ZERO(&set);
+  for (g=0; g<ncpu; g++)
+    if (g != cpu)
+      CPU_SET(g, &set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+    printf("rt6502: can't keep the other threads off core %d\n", cpu);
+    return -1;
+  }
+
+  // With real-time throttling on, a CPU thread that never sleeps (no
+  // pacing) loses the core for a while every second
+  f = fopen("/proc/sys/kernel/sched_rt_runtime_us", "r");
+  if (f) {
+    if (fscanf(f, "%ld", &runtime) != 1)
+      runtime = -1;
+    fclose(f);
+  }
+  if (runtime >= 0)
+    printf("rt6502: real-time throttling is on, sched_rt_runtime_us = %ld\n", runtime);
+
+  rtcpu = cpu;
+  printf("rt6502: CPU thread on core %d%s\n", cpu, cpu == isolated() ? " (isolated)" : "");
+  return cpu;
+}
+
+int rt6502_enter()
+{
+  struct sched_param sp;
+  cpu_set_t set;
+  int err;
+
+  if (rtcpu < 0)
+    return -1;
+
+  CPU_ZERO(&set);
+  CPU_SET(rtcpu, &set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+    printf("rt6502: can't move to core %d\n", rtcpu);
+    return -1;
+  }
+
+  memset(&sp, 0, sizeof(sp));
+  sp.sched_priority = RT6502_PRIO;
+  if ((err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp))) {
+    printf("rt6502: no SCHED_FIFO (%s)\n", strerror(err));
+    return -1;
+  }
+  return 0;
+}
+
+void rt6502_prefault(volatile void *p, size_t len)
+{
+  volatile uint8_t *b = p;
+  size_t page = sysconf(_SC_PAGESIZE), g;
+
+  // A read alone maps the shared zero page, it takes a write to get one's
+  // own
+  for (g=0; g<len; g+=page)
+    b[g] = b[g];
+}
+
+// ns per counter tick, measured against CLOCK_MONOTONIC the first time
+static double tickns()
+{
+  static double ns;
+  struct timespec a, b, d = { 0, 20000000 };
+  uint64_t t0, t1;
+
+  if (ns)
+    return ns;
+  clock_gettime(CLOCK_MONOTONIC, &a);
+  t0 = rt6502_now();
+  while (nanosleep(&d, &d) && errno == EINTR);
+  clock_gettime(CLOCK_MONOTONIC, &b);
+  t1 = rt6502_now();
+  ns = ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec)) / (t1 - t0);
+  return ns;
+}
+
+double rt6502_ns(uint64_t ticks)
+{
+  return ticks * tickns();
+}
+
+void rt6502_print(rt6502_hist_t *h, const char *what)
+{
+  double ns = tickns();
+  int n;
+
+  if (!h->count)
+    return;
+  printf("%s: %llu times, mean %.0f ns, max %.0f ns\n", what, (unsigned long long)h->count,
+         h->sum * ns / h->count, h->max * ns);
+  for (n=0; n<RT6502_BUCKETS; n++)
+    if (h->bucket[n])
+      printf("  %10.0f - %10.0f ns  %10llu\n", n ? (1ull << (n - 1)) * ns : 0,
+             ((1ull << n) - 1) * ns, (unsigned long long)h->bucket[n]);
+}
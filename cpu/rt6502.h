@@ -0,0 +1,72 @@
+#ifndef _RT6502_H_
+#define _RT6502_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+// Real-time mode for the thread that clocks the bus. rt6502_init() locks
+// all memory (present and future) and keeps the calling thread, and every
+// thread it starts from then on, off one core. rt6502_enter() moves the
+// CPU thread onto that core at SCHED_FIFO priority RT6502_PRIO. Best with
+// the core taken away from the scheduler (isolcpus=3 on the kernel command
+// line), it's found in /sys/devices/system/cpu/isolated, the last core
+// otherwise.
+#define RT6502_PRIO 80
+
+// cpu = the core, -1 = pick one. Returns the core, -1 on errors.
+extern int rt6502_init(int cpu);
+extern int rt6502_enter();
+
+// Touches every page from p to p+len, so none of them faults later
+extern void rt6502_prefault(volatile void *p, size_t len);
+
+// Histogram of how long something took, in log2 buckets of counter ticks:
+// bucket n counts times of 2^(n-1) up to 2^n-1 ticks. The counter is the
+// cheapest one the host has (the ARM generic timer, the TSC), ticks are
+// converted to ns when printed.
+#define RT6502_BUCKETS 48
+
+typedef struct {
+  uint64_t bucket[RT6502_BUCKETS];
+  uint64_t count, sum, max;
+} rt6502_hist_t;
+
+static inline uint64_t rt6502_now()
+{
+#if defined(__aarch64__)
+  uint64_t t;
+  asm volatile("mrs %0, cntvct_el0" : "=r"(t));
+  return t;
+#elif defined(__arm__)
+  uint64_t t;
+  asm volatile("mrrc p15, 1, %Q0, %R0, c14" : "=r"(t));
+  return t;
+#elif defined(__x86_64__) || defined(__i386__)
+  uint32_t lo, hi;
+  asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+  return ((uint64_t)hi << 32) | lo;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+static inline void rt6502_hist(rt6502_hist_t *h, uint64_t ticks)
+{
+  int n = ticks ? 64 - __builtin_clzll(ticks) : 0;
+
+  h->bucket[n < RT6502_BUCKETS ? n : RT6502_BUCKETS - 1]++;
+  h->count++;
+  h->sum += ticks;
+  if (ticks > h->max)
+    h->max = ticks;
+}
+
+// Prints the non-empty buckets, in ns
+extern void rt6502_print(rt6502_hist_t *h, const char *what);
+// Counter ticks in ns
+extern double rt6502_ns(uint64_t ticks);
+
+#endif
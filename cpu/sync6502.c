@@ -0,0 +1,57 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// sync6502: futex backed events, see sync6502.h
+//
+// The kernel only puts a waiter to sleep while seq still holds what it
+// read before it last looked at its condition. A signaller bumps seq and
+// then looks for waiters, a waiter counts itself in and then sleeps. Both
+// are sequentially consistent, so either the signaller sees the waiter and
+// wakes it, or the waiter's futex call sees the new seq and returns.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "sync6502.h"
+
+static long futex(_Atomic uint32_t *addr, int op, uint32_t val, struct timespec *ts)
+{
+  return syscall(SYS_futex, addr, op, val, ts, NULL, 0);
+}
+
+void sync6502_signal(sync6502_t *s)
+{
+  atomic_fetch_add(&s->seq, 1);
+  if (atomic_load(&s->waiters))
+    futex(&s->seq, FUTEX_WAKE_PRIVATE, INT_MAX, NULL);
+}
+
+void sync6502_sleep(sync6502_t *s, uint32_t seq, uint64_t ns)
+{
+  struct timespec ts = { ns / 1000000000, ns % 1000000000 };
+
+  atomic_fetch_add(&s->waiters, 1);
+  // Returns on a wake, a timeout, a signal or when seq moved already,
+  // whoever called looks at the condition again anyway
+  futex(&s->seq, FUTEX_WAIT_PRIVATE, seq, ns ? &ts : NULL);
+  atomic_fetch_sub(&s->waiters, 1);
+}
@@ -0,0 +1,62 @@
+#ifndef _SYNC6502_H_
+#define _SYNC6502_H_
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+// Waiting for the other threads without burning a core. A sync6502_t is
+// an event: sync6502_signal() wakes everyone waiting on it. Whoever waits
+// for a condition looks at it for SYNC6502_SPIN rounds first (cheap, and
+// the answer often comes that quickly), then sleeps on a futex until the
+// event is signalled or ns have passed. The side that makes the condition
+// true signals after it did, a signal with nobody asleep costs an atomic
+// add and a load.
+//
+// Only for the threads off the bus. The CPU thread's wait for a device in
+// lockstep is a bus cycle long, it keeps spinning.
+#define SYNC6502_SPIN 1000
+
+typedef struct {
+  _Atomic uint32_t seq;     // signals so far
+  _Atomic uint32_t waiters; // asleep in the kernel, or about to be
+} sync6502_t;
+
+#define SYNC6502_MS 1000000ull // ns
+
+extern void sync6502_signal(sync6502_t *s);
+// Sleeps until s is signalled after seq was read, at most ns (0: no limit)
+extern void sync6502_sleep(sync6502_t *s, uint32_t seq, uint64_t ns);
+
+static inline uint32_t sync6502_seq(sync6502_t *s)
+{
+  return atomic_load_explicit(&s->seq, memory_order_acquire);
+}
+
+// Tells the core we're spinning
+static inline void sync6502_relax()
+{
+#if defined(__aarch64__) || defined(__arm__)
+  asm volatile("yield");
+#elif defined(__x86_64__) || defined(__i386__)
+  asm volatile("pause");
+#endif
+}
+
+// Waits until cond holds, sleeping on s when spinning didn't get it. The
+// seq is read before cond is looked at again, a signal in between makes
+// the sleep return right away.
+#define sync6502_until(s, cond, ns) do {   \
+    uint32_t _spin, _seq;                  \
+    for (_spin=0; !(cond); _spin++) {      \
+      if (_spin < SYNC6502_SPIN) {         \
+        sync6502_relax();                  \
+        continue;                          \
+      }                                    \
+      _seq = sync6502_seq(s);              \
+      if (cond)                            \
+        break;                             \
+      sync6502_sleep(s, _seq, ns);         \
+    }                                      \
+  } while (0)
+
+#endif
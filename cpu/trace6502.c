@@ -0,0 +1,107 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// trace6502: the drain side of the bus trace ring, see trace6502.h
+//
+// One producer (the CPU thread in trace6502()) and one consumer (the drain
+// thread here), so head and tail each have a single writer and the ring
+// needs no locks. The drain thread writes whatever is between tail and head
+// in at most two pieces, then gives the slots back by moving tail on. With
+// nothing to write it sleeps for a millisecond, the ring holds a lot more.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "trace6502.h"
+
+volatile uint8_t trace6502_on;
+trace6502_rec_t *trace6502_ring;
+uint32_t trace6502_head, trace6502_tail, trace6502_limit = TRACE6502_RING;
+uint32_t trace6502_dropped;
+
+static FILE *out;
+static pthread_t drainthread;
+static volatile uint8_t draining;
+static uint64_t written;
+
+// Writes all there is, returns the number of records
+static uint32_t drain()
+{
+  uint32_t h = __atomic_load_n(&trace6502_head, __ATOMIC_ACQUIRE);
+  uint32_t t = trace6502_tail, n = h - t, first;
+
+  if (!n)
+    return 0;
+  first = TRACE6502_RING - (t & (TRACE6502_RING - 1));
+  if (first > n)
+    first = n;
+  fwrite(&trace6502_ring[t & (TRACE6502_RING - 1)], sizeof(trace6502_rec_t), first, out);
+  fwrite(trace6502_ring, sizeof(trace6502_rec_t), n - first, out);
+  written += n;
+  __atomic_store_n(&trace6502_tail, h, __ATOMIC_RELEASE);
+  return n;
+}
+
+static void *drainer(void *arg)
+{
+  struct timespec ts = { 0, 1000000 };
+
+  while (draining)
+    if (!drain())
+      while (nanosleep(&ts, &ts) && errno == EINTR);
+  drain();
+  return NULL;
+}
+
+int trace6502_open(const char *file)
+{
+  trace6502_ring = malloc(TRACE6502_RING * sizeof(trace6502_rec_t));
+  out = fopen(file, "wb");
+  if (!trace6502_ring || !out) {
+    printf("trace6502: can't trace to %s\n", file);
+    return 0;
+  }
+  fwrite(TRACE6502_MAGIC, 1, 4, out);
+
+  draining = 1;
+  if (pthread_create(&drainthread, NULL, drainer, NULL)) {
+    printf("trace6502: thread create failed\n");
+    fclose(out);
+    return 0;
+  }
+  return 1;
+}
+
+void trace6502_enable(int on)
+{
+  trace6502_on = trace6502_ring && on;
+}
+
+void trace6502_close()
+{
+  if (!draining)
+    return;
+  trace6502_on = 0;
+  draining = 0;
+  pthread_join(drainthread, NULL);
+  fclose(out);
+  printf("trace6502: %llu bus cycles written, %u dropped\n", (unsigned long long)written, trace6502_dropped);
+}
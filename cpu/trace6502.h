@@ -0,0 +1,67 @@
+#ifndef _TRACE6502_H_
+#define _TRACE6502_H_
+
+#include <stdint.h>
+
+// Bus trace. Every traced bus cycle is one record in a ring the CPU thread
+// fills without locks or syscalls, a thread of its own drains it to a file:
+// "B6T1" and the records as they are in memory (little endian). Nothing is
+// recorded until trace6502_open() and while tracing is off, which costs one
+// test per cycle. A full ring drops records rather than stall the bus, the
+// gap shows in the ticks. Decode files with cpu/trace6502dec.
+typedef struct {
+  uint32_t tick;  // clockticks at the end of the cycle
+  uint16_t addr;
+  uint8_t flags;
+  uint8_t data;   // read or written
+} trace6502_rec_t;
+
+#define TRACE6502_READ 0x01 // R/W high
+#define TRACE6502_IRQ  0x02 // !IRQ driven low (for the next cycle)
+#define TRACE6502_NMI  0x04 // !NMI driven low
+
+#define TRACE6502_MAGIC "B6T1"
+
+// Records in the ring, a power of 2 (8MB, some 400ms at 2.5MHz)
+#ifndef TRACE6502_RING
+#define TRACE6502_RING (1<<20)
+#endif
+
+// Starts the drain thread on file, tracing off. Returns 0 on errors.
+extern int trace6502_open(const char *file);
+// Turns tracing on (1) or off (0), signal safe
+extern void trace6502_enable(int on);
+// Turns it off, writes what's left and closes the file
+extern void trace6502_close();
+
+// Ring state, only written by trace6502() and the drain thread
+extern volatile uint8_t trace6502_on;
+extern trace6502_rec_t *trace6502_ring;
+extern uint32_t trace6502_head, trace6502_tail, trace6502_limit;
+extern uint32_t trace6502_dropped;
+
+// Records one bus cycle, from the CPU thread
+static inline void trace6502(uint32_t tick, uint16_t addr, uint8_t flags, uint8_t data)
+{
+  uint32_t h = trace6502_head;
+  trace6502_rec_t *r;
+
+  if (!trace6502_on)
+    return;
+  if (h == trace6502_limit) {
+    // Only look at the drain thread's tail when the last one is used up
+    trace6502_limit = __atomic_load_n(&trace6502_tail, __ATOMIC_ACQUIRE) + TRACE6502_RING;
+    if (h == trace6502_limit) {
+      trace6502_dropped++;
+      return;
+    }
+  }
+  r = &trace6502_ring[h & (TRACE6502_RING - 1)];
+  r->tick = tick;
+  r->addr = addr;
+  r->flags = flags;
+  r->data = data;
+  __atomic_store_n(&trace6502_head, h + 1, __ATOMIC_RELEASE);
+}
+
+#endif
@@ -0,0 +1,394 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// trace6502dec: prints a bus trace written by trace6502.c
+//
+// By default one line per instruction, disassembled, with the bus cycles
+// it took besides its opcode and operand fetches. The board has no SYNC
+// pin, so the opcode fetches are worked out from the trace: an instruction
+// takes at least its base cycles (ticktable of cpu/fake6502_ops.h) and the
+// next opcode is read from the address behind it, or from where it jumps
+// to, found in its operand or in the bytes it pulled or the vector it read.
+// An interrupt is a fetch that is dropped: the same address read twice,
+// three pushes and a vector. Until the trace is followed, which takes
+// TRIAL instructions in a row that fit, and after it stops fitting (cycles
+// missing from the trace, a reset) the records are printed as they are.
+//
+// usage: trace6502dec [-r] file
+//   -r  print every bus cycle, don't disassemble
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "fake6502_ops.h"
+#include "trace6502.h"
+
+// Mode and operation of each opcode, as written in the opcode list
+static const struct {
+  const char *mode, *op;
+} optable[256] = {
+#define OPCODE(n, mode, op) [n] = { #mode, #op },
+#include "fake6502_opcodes.h"
+#undef OPCODE
+};
+
+// Instructions that have to fit before the trace counts as followed
+#define TRIAL 8
+
+// Cycles an instruction may take over its base cycles: page crossings,
+// taken branches, decimal mode
+#define EXTRA 3
+
+// Branches to look ahead of, where one could have gone either way
+#define DEPTH 2
+
+static trace6502_rec_t *rec;
+static size_t nrec;
+
+static uint32_t instructions, interrupts, lost, missing;
+
+static int isread(size_t i, uint16_t addr)
+{
+  return i < nrec && (rec[i].flags & TRACE6502_READ) && rec[i].addr == addr;
+}
+
+static int ispush(size_t i)
+{
+  return i < nrec && !(rec[i].flags & TRACE6502_READ) && (rec[i].addr & 0xFF00) == 0x100;
+}
+
+// Records from..to are one cycle after the other
+static int contiguous(size_t from, size_t to)
+{
+  return to < nrec && rec[to].tick - rec[from].tick == to - from;
+}
+
+// Interrupt (or BRK) sequence at i: the dropped fetch and the one after it,
+// pc and status pushed, vector read
+static int isinterrupt(size_t i)
+{
+  uint16_t v;
+
+  if (i + 6 >= nrec)
+    return 0;
+  v = rec[i + 5].addr;
+  return ispush(i + 2) && ispush(i + 3) && ispush(i + 4) &&
+         v >= 0xFFFA && !(v & 1) && isread(i + 5, v) && isread(i + 6, v + 1);
+}
+
+static uint16_t word(size_t i)
+{
+  return rec[i].data | (rec[i + 1].data << 8);
+}
+
+// Record of byte n of the instruction at i, JSR reads its last one after
+// pushing pc
+static size_t byte(size_t i, int n)
+{
+  return rec[i].data == 0x20 && n == 2 ? i + 5 : i + n;
+}
+
+static size_t follow(size_t i, uint16_t pc, uint16_t *next, int depth);
+
+// n instructions from i, fetched from pc, fit (or all that are left)
+static int fitsfrom(size_t i, uint16_t pc, int n, int depth)
+{
+  while (n--) {
+    if (!(i = follow(i, pc, &pc, depth)))
+      return 0;
+    if (i >= nrec)
+      return 1;
+  }
+  return 1;
+}
+
+// First read of addr in records from..to
+static size_t find(size_t from, size_t to, uint16_t addr)
+{
+  for (; from<=to; from++)
+    if (isread(from, addr))
+      return from;
+  return 0;
+}
+
+// Follows the instruction or interrupt fetched from pc at record i. Returns
+// the record of the next opcode fetch and its address in *next, 0 if the
+// trace doesn't fit. Where a branch might have gone either way, whichever
+// way the next instructions fit is taken, looking depth branches deep.
+static size_t follow(size_t i, uint16_t pc, uint16_t *next, int depth)
+{
+  uint8_t op, len;
+  uint16_t target, fallthrough;
+  size_t j, k, taken;
+  int n;
+
+  if (!isread(i, pc))
+    return 0;
+  if (isinterrupt(i)) {
+    if (!contiguous(i, i + 7))
+      return 0;
+    *next = word(i + 5);
+    return i + 7;
+  }
+
+  op = rec[i].data;
+  len = lentable[op];
+  for (n=1; n<len; n++)
+    if (!isread(byte(i, n), pc + n))
+      return 0;
+  fallthrough = pc + len;
+  j = i + ticktable[op];
+
+  switch (op) {
+  case 0x4C: // JMP abs
+    fallthrough = word(i + 1);
+    k = find(j, j, fallthrough);
+    break;
+  case 0x20: // JSR
+    fallthrough = rec[i + 1].data | (rec[i + 5].data << 8);
+    k = find(j, j, fallthrough);
+    break;
+  case 0x6C: // JMP (abs)
+  case 0x7C: // JMP (abs,X)
+    fallthrough = word(j - 2);
+    k = find(j, j, fallthrough);
+    break;
+  case 0x60: // RTS
+    fallthrough = word(i + 3) + 1;
+    k = find(j, j, fallthrough);
+    break;
+  case 0x40: // RTI
+    fallthrough = word(i + 4);
+    k = find(j, j, fallthrough);
+    break;
+  case 0xCB: // WAI, reads pc+1 until an interrupt
+    for (k=j; k<nrec && !isread(k, fallthrough); k++);
+    while (isread(k + 1, fallthrough) && !isinterrupt(k))
+      k++;
+    break;
+  case 0x00: // BRK, has to look like an interrupt
+  case 0xDB: // STP
+    return 0;
+  default:
+    if (!strcmp(optable[op].mode, "REL") || !strcmp(optable[op].mode, "ZPREL")) {
+      // Not taken it's fetching the next instruction right away, taken it
+      // reads something first, maybe the same address
+      target = fallthrough + (int8_t)rec[byte(i, len - 1)].data;
+      k = find(j, j, fallthrough);
+      taken = find(j + 1, j + EXTRA - 1, target);
+      if (taken && (!k || !depth || fitsfrom(taken, target, TRIAL, depth - 1) ||
+                    !fitsfrom(k, fallthrough, TRIAL, depth - 1))) {
+        k = taken;
+        fallthrough = target;
+      }
+    } else
+      k = find(j, j + EXTRA, fallthrough);
+  }
+
+  if (!k || !contiguous(i, k))
+    return 0;
+  *next = fallthrough;
+  return k;
+}
+
+// TRIAL instructions from i fit
+static int fits(size_t i)
+{
+  return fitsfrom(i, rec[i].addr, TRIAL, DEPTH);
+}
+
+// Cycles the trace dropped before record i
+static void gap(size_t i)
+{
+  if (i && rec[i].tick != rec[i - 1].tick + 1) {
+    printf("---- %u cycles missing\n", rec[i].tick - rec[i - 1].tick - 1);
+    missing += rec[i].tick - rec[i - 1].tick - 1;
+  }
+}
+
+static void printrec(size_t i)
+{
+  gap(i);
+  printf("%10u  %04X  %c %02X%s%s\n", rec[i].tick, rec[i].addr,
+         rec[i].flags & TRACE6502_READ ? 'R' : 'W', rec[i].data,
+         rec[i].flags & TRACE6502_IRQ ? "  !IRQ" : "", rec[i].flags & TRACE6502_NMI ? "  !NMI" : "");
+}
+
+// Mnemonic of opcode op, the operation up to its arguments, bit numbers kept
+static void mnemonic(uint8_t op, char *buf)
+{
+  const char *s = optable[op].op;
+  int n = 0;
+
+  while (s[n] >= 'A' && s[n] <= 'Z' && n < 3) {
+    buf[n] = s[n];
+    n++;
+  }
+  if (s[n] == '(' && s[n + 1] >= '0' && s[n + 1] <= '7') {
+    buf[n] = s[n + 1];
+    n++;
+  }
+  buf[n] = 0;
+}
+
+static void disassemble(size_t i, uint16_t pc, char *buf)
+{
+  const char *m = optable[rec[i].data].mode;
+  char name[8];
+  uint8_t b1 = rec[i + 1].data;
+  uint16_t w = b1 | (rec[byte(i, 2)].data << 8);
+  int n;
+
+  mnemonic(rec[i].data, name);
+  n = sprintf(buf, "%s", name);
+
+  if (!strcmp(m, "ACC"))
+    sprintf(buf + n, " A");
+  else if (!strcmp(m, "IMM"))
+    sprintf(buf + n, " #$%02X", b1);
+  else if (!strcmp(m, "ZP"))
+    sprintf(buf + n, " $%02X", b1);
+  else if (!strcmp(m, "ZPX"))
+    sprintf(buf + n, " $%02X,X", b1);
+  else if (!strcmp(m, "ZPY"))
+    sprintf(buf + n, " $%02X,Y", b1);
+  else if (!strcmp(m, "REL"))
+    sprintf(buf + n, " $%04X", (uint16_t)(pc + 2 + (int8_t)b1));
+  else if (!strcmp(m, "ABSO"))
+    sprintf(buf + n, " $%04X", w);
+  else if (!strncmp(m, "ABSX", 4))
+    sprintf(buf + n, " $%04X,X", w);
+  else if (!strncmp(m, "ABSY", 4))
+    sprintf(buf + n, " $%04X,Y", w);
+  else if (!strcmp(m, "IND"))
+    sprintf(buf + n, " ($%04X)", w);
+  else if (!strcmp(m, "INDABSX"))
+    sprintf(buf + n, " ($%04X,X)", w);
+  else if (!strcmp(m, "INDZ"))
+    sprintf(buf + n, " ($%02X)", b1);
+  else if (!strcmp(m, "INDX"))
+    sprintf(buf + n, " ($%02X,X)", b1);
+  else if (!strncmp(m, "INDY", 4))
+    sprintf(buf + n, " ($%02X),Y", b1);
+  else if (!strcmp(m, "ZPREL"))
+    sprintf(buf + n, " $%02X,$%04X", b1, (uint16_t)(pc + 3 + (int8_t)rec[i + 2].data));
+}
+
+// One line for the instruction or interrupt at i, the cycles up to k
+static void printinstr(size_t i, size_t k, uint16_t pc)
+{
+  char bytes[16], text[32];
+  size_t len, g;
+  int n = 0;
+
+  if (isinterrupt(i)) {
+    len = 1;
+    interrupts++;
+    if (rec[i].data == 0x00 && rec[i + 1].addr == pc + 1)
+      strcpy(text, "BRK");
+    else
+      sprintf(text, "%s", rec[i + 5].addr == 0xFFFA ? "-- NMI --" : "-- IRQ --");
+  } else {
+    len = lentable[rec[i].data];
+    instructions++;
+    disassemble(i, pc, text);
+  }
+  for (g=0; g<len; g++)
+    n += sprintf(bytes + n, "%02X ", rec[byte(i, g)].data);
+
+  gap(i);
+  printf("%10u  %04X  %-9s %-14s", rec[i].tick, pc, bytes, text);
+  for (g=i+1; g<k; g++)
+    if (g >= i + len && g != byte(i, len - 1))
+      printf(" %c%04X=%02X", rec[g].flags & TRACE6502_READ ? 'R' : 'W', rec[g].addr, rec[g].data);
+  if (rec[i].flags & TRACE6502_IRQ)
+    printf("  !IRQ");
+  if (rec[i].flags & TRACE6502_NMI)
+    printf("  !NMI");
+  printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  int raw = 0, opt;
+  char magic[4];
+  FILE *f;
+  long size;
+  size_t i, k;
+  uint16_t pc = 0, next;
+  int synced = 0;
+
+  while ((opt = getopt(argc, argv, "r")) != -1) {
+    if (opt == 'r')
+      raw = 1;
+    else {
+      printf("usage: trace6502dec [-r] file\n");
+      return 1;
+    }
+  }
+  if (optind >= argc || !(f = fopen(argv[optind], "rb"))) {
+    printf("usage: trace6502dec [-r] file\n");
+    return 1;
+  }
+  if (fread(magic, 1, 4, f) != 4 || memcmp(magic, TRACE6502_MAGIC, 4)) {
+    printf("%s: not a bus trace\n", argv[optind]);
+    return 1;
+  }
+  fseek(f, 0, SEEK_END);
+  size = ftell(f) - 4;
+  fseek(f, 4, SEEK_SET);
+  rec = malloc(size + 16);
+  nrec = fread(rec, sizeof(trace6502_rec_t), size / sizeof(trace6502_rec_t), f);
+  fclose(f);
+
+  for (i=0; i<nrec; ) {
+    if (raw) {
+      printrec(i++);
+      continue;
+    }
+    if (!synced && (rec[i].flags & TRACE6502_READ) && fits(i)) {
+      synced = 1;
+      pc = rec[i].addr;
+    }
+    if (!synced) {
+      printrec(i++);
+      continue;
+    }
+    if (!(k = follow(i, pc, &next, DEPTH))) {
+      // Not at the end, where the trace just stops in an instruction
+      if (nrec - i > 2 * TRIAL) {
+        printf("---- lost track at $%04X\n", pc);
+        lost++;
+      }
+      synced = 0;
+      continue;
+    }
+    printinstr(i, k, pc);
+    i = k;
+    pc = next;
+  }
+
+  if (!raw)
+    printf("%zu bus cycles, %u instructions, %u interrupts, lost track %u times\n",
+           nrec, instructions, interrupts, lost);
+  if (missing)
+    printf("%u cycles missing\n", missing);
+  return 0;
+}
@@ -24,6 +24,13 @@
 #include <pthread.h>
 #include <SDL.h>
 #include "cpu/bad65C02.h"
+#include "cpu/pace6502.h"
+#include "cpu/trace6502.h"
+#include "cpu/rt6502.h"
+#include "cpu/sync6502.h"
+#include "cpu/ring6502.h"
+#include "cpu/defer6502.h"
+#include "cpu/mem6502.h"
 
 #include "via6522_1.h"
 #include "via6522_2.h"
@@ -35,23 +42,46 @@
 #include "./roms/kernal.901486-06.h"
 
 #ifdef FAKE
+#include "cpu/fake6502.h"
+
 #define reset65C02 reset6502
+// One bus cycle per step, like the real chip, so the device side sees the
+// same accesses at the same clockticks. Native code only runs whole
+// instructions
+#ifdef ROMS_NATIVE
 #define step65C02 step6502
+#else
+#define step65C02 cycle6502
+#endif
+// -DCOOP runs whole quanta through exec6502() instead, so the decode cache,
+// fused pairs and translated blocks ('make fakejit') pay off. The VIAs only
+// look at the clock when they're accessed, and an access ends the quantum
+#if defined(COOP) && !defined(ROMS_NATIVE)
+#define COOP_EXEC
+#endif
 #define read65C02 read6502
 #define write65C02 write6502
 #define irq65C02 irq6502
+#define nmi65C02 nmi6502
+#define irqline65C02 irqline6502
+#define nmiline65C02 nmiline6502
 #define clockticks65C02 clockticks6502
 
-volatile extern uint32_t clockticks6502;
+#ifdef ROMS_NATIVE
+#include "roms_native.h"
+#endif
 #endif
 
 // ndelay is a define so the compiler can unroll it ;-)
 #define ndelay(x) for(int i=0;i<x;i++)asm("nop");
 
 // Memory layout 
-volatile static uint8_t mem[0x10000];
-volatile static uint8_t *page[256];
-volatile static uint8_t page_type[256];
+// Plain memory, the CPU thread publishes it to the video thread every
+// pacer quantum (see cpu/mem6502.h)
+static uint8_t mem[0x10000];
+static uint8_t *page[256];
+static uint8_t page_type[256];
+mem6502_pub_t mem_pub;
 
 // The keyboard (matrix)
 volatile uint8_t kbd_matrix[8] = {0,0,0,0,0,0,0,0};
@@ -59,7 +89,16 @@ volatile uint8_t kbd_matrix[8] = {0,0,0,0,0,0,0,0};
 // Threads
 pthread_t IOthread, CPUthread, VIDthread;
 
-volatile uint8_t runme = 1;
+atomic_uchar runme = 1;
+
+// Threads wait on state_ev for each other (ready, out of cycles, stopping)
+// and on clock_ev for the CPU to run again when it slept or was held
+sync6502_t state_ev, clock_ev;
+
+static inline int running()
+{
+  return atomic_load_explicit(&runme, memory_order_relaxed);
+}
 
 // install_reset_vector: set target for reset
 inline static void install_reset_vect(unsigned int vect) 
@@ -83,95 +122,343 @@ inline static void install_nmi_vect(unsigned int vect)
 }
 
 // IO Thread (slightly async)
-volatile uint16_t io_mbox[256];
-volatile uint8_t mbox_data[256];
-volatile uint8_t updateIO_ready = 0;
-volatile uint32_t io_ticks;
+// Device writes from the CPU thread, in the order and at the clockticks
+// they happened. A full ring stalls the CPU until the IO thread caught up,
+// -DIO_BACKPRESSURE=RING6502_DROP drops the write instead
+#ifndef IO_RING
+#define IO_RING 1024
+#endif
+#ifndef IO_BACKPRESSURE
+#define IO_BACKPRESSURE RING6502_STALL
+#endif
+ring6502_t io_ring;
+atomic_uchar updateIO_ready = 0;
+
+// Bounded lag (without -DASYNCIO): the CPU runs up to IO_QUANTUM cycles
+// ahead of the IO thread, but never past the cycle a VIA timer runs out
+// in, so the interrupt comes when it should. The IO thread says how far
+// that is in io_limit, the CPU only looks again once it got there. A CPU
+// access to the VIAs waits until the IO thread is up to date, and until
+// it said again how far to go after it. IO_QUANTUM 0 is lockstep.
+#ifndef IO_QUANTUM
+#define IO_QUANTUM 0
+#endif
+_Atomic uint32_t io_ticks, io_limit;
 
-void *updateIO()
+// Stops all threads, signal safe
+void stop()
 {
-  uint8_t box_pos = 0;
-  uint16_t addr;
-  uint8_t data;
-  uint8_t io_page;
-  uint8_t row;
-  uint8_t last_row;
+  atomic_store(&runme, 0);
+  ring6502_stop(&io_ring);
+  sync6502_signal(&state_ev);
+  sync6502_signal(&clock_ev);
+}
+
+// Interrupt line sources, VIA1 drives !NMI and VIA2 !IRQ
+#define INT_VIA1 0x01
+#define INT_VIA2 0x02
+
+// Set the keyboard, the columns of the rows VIA2 port B pulls low
+void kbd_refresh()
+{
+  static uint8_t last_row;
+  uint8_t row = ~via2_PB();
   uint8_t kbd_data;
+
+  if (row != last_row) {
+    kbd_data = 0x00;
+    for (int g=0;g<8;g++) {
+      if (row & (1<<g)){
+        kbd_data |= kbd_matrix[g];
+      }
+    }
+    via2_setPA(~kbd_data);
+    last_row=row;
+  }
+}
+
+// do HW ticks, the interrupt lines only change with the VIA outputs
+void via_ticks(int cycles)
+{
+  static uint8_t via1_int = 0, via2_int = 0;
+  uint8_t level;
+
+  level = via1_tick(cycles) != 0;
+  if (level != via1_int) {
+    nmiline65C02(INT_VIA1, level);
+    via1_int = level;
+  }
+  level = via2_tick(cycles) != 0;
+  if (level != via2_int) {
+    irqline65C02(INT_VIA2, level);
+    via2_int = level;
+  }
+}
+
+void via_write(ring6502_rec_t *w)
+{
+  switch(w->addr>>4) {
+    case 0x911: 
+      via1_writeReg(w->addr-0x9110,w->data);
+      break;
+    case 0x912:
+      via2_writeReg(w->addr-0x9120,w->data);
+      break;
+  }
+}
+
+void *updateIO()
+{
+  uint32_t ticks = clockticks65C02, clk;
+  int next;
   dup(1);
   dup(2);
-  updateIO_ready = 1;
-  io_ticks = clockticks65C02;
+  atomic_store_explicit(&io_limit, ticks, memory_order_release);
+  atomic_store_explicit(&io_ticks, ticks, memory_order_release);
+  atomic_store_explicit(&updateIO_ready, 1, memory_order_release);
+  sync6502_signal(&state_ev);
+
+  while (running()) {
+    // Just stop and wait here if the clock is not moving and we're up to
+    // date, asleep when it's held or paced
+    sync6502_until(&clock_ev, clockticks65C02 != ticks || !running(), SYNC6502_MS);
+    clk = clockticks65C02;
+
+    // Every cycle up to the clock, with the writes of each in between
+    for (; ticks != clk; ticks++) {
+      ring6502_drain(&io_ring, ticks, via_write);
+
+      kbd_refresh();
+      via_ticks(1);
+    }
 
-  while (runme) {
-    // Just stop and wait here if the clock is not moving and we're up to date
-    while (clockticks65C02 == io_ticks);
+    // The CPU waiting for us goes on once it sees this, and what we did
+    next = via1_cyclesToEvent();
+    if (via2_cyclesToEvent() < next)
+      next = via2_cyclesToEvent();
+    atomic_store_explicit(&io_limit, ticks + (next - 1 < IO_QUANTUM ? next - 1 : IO_QUANTUM), memory_order_release);
+    atomic_store_explicit(&io_ticks, ticks, memory_order_release);
+  }
+}
 
-    if (io_mbox[box_pos]) {
-      addr = io_mbox[box_pos];
-      data = mbox_data[box_pos];
-      io_page = addr >> 8;
+#if !defined(ASYNCIO) && !defined(DEFER_IO) && !defined(COOP)
+// The CPU side of the bounded lag, io_limit as it saw it last
+uint32_t cpu_limit;
+uint64_t io_syncs, io_accesses, io_waits, io_lagsum;
+uint32_t io_lagmax;
 
-      switch(addr>>4) {
-        case 0x911: 
-          via1_writeReg(addr-0x9110,data);
-	  break;
-	case 0x912:
-          via2_writeReg(addr-0x9120,data);
-          break;
-      }
+// Waits until io (io_ticks or io_limit) got to clk
+static void io_wait(_Atomic uint32_t *io, uint32_t clk)
+{
+  uint32_t spin, lag = clk - atomic_load_explicit(&io_ticks, memory_order_relaxed);
 
-      io_mbox[box_pos++] = 0;
-    }
+  io_lagsum += lag;
+  if (lag > io_lagmax)
+    io_lagmax = lag;
+  if ((int32_t)(clk - atomic_load_explicit(io, memory_order_acquire)) <= 0)
+    return;
 
-    // Set the keyboard
-    row = ~via2_PB();
-    if (row != last_row) {
-      kbd_data = 0x00;
-      for (int g=0;g<8;g++) {
-        if (row & (1<<g)){
-          kbd_data |= kbd_matrix[g];
-        }
-      }
-      via2_setPA(~kbd_data);
-      last_row=row;
-    }
+  // Spin for the I/O thread. Should it have gone to sleep on the clock
+  // meanwhile, wake it
+  io_waits++;
+  for (spin=1; (int32_t)(clk - atomic_load_explicit(io, memory_order_acquire)) > 0 && running(); spin++)
+    if (spin % SYNC6502_SPIN == 0)
+      sync6502_signal(&clock_ev);
+    else
+      sync6502_relax();
+}
 
-    // do HW ticks
-    if (via1_tick(1)) {
-      printf("IRQ!\n");
-      irq65C02();
-    }
-    if (via2_tick(1)) {
-      printf("IRQ!\n");
-      irq65C02();
-    }
+// From the VIA handlers
+static inline void io_catchup()
+{
+  io_accesses++;
+  io_wait(&io_ticks, clockticks65C02);
+  cpu_limit = clockticks65C02;
+}
+#elif defined(COOP)
+// -DCOOP: a single thread. The CPU runs until the next thing the VIAs
+// would do by themselves, at most COOP_QUANTUM cycles, then they catch up
+// in one go. Every COOP_FRAME cycles the same thread draws the screen and
+// looks at the SDL events. A CPU access to the VIAs brings them up to
+// date first, and ends the quantum after it
+#ifndef COOP_QUANTUM
+#define COOP_QUANTUM 1000
+#endif
+#ifndef COOP_FRAME
+#define COOP_FRAME 20000
+#endif
+uint32_t via_clk, coop_next, frame_next;
+uint64_t coop_quanta, coop_frames, coop_video;
 
-    io_ticks++;
+static inline void io_catchup()
+{
+  if (clockticks65C02 != via_clk) {
+    via_ticks(clockticks65C02 - via_clk);
+    via_clk = clockticks65C02;
   }
+  coop_next = clockticks65C02;
+#ifdef COOP_EXEC
+  stop6502();
+#endif
+}
+#else
+static inline void io_catchup() {}
+#endif
+
+#ifdef DEFER_IO
+// -DDEFER_IO: no I/O thread, the VIAs run on the CPU thread in the slack
+// of its bus cycles (see cpu/defer6502.h). They tick every cycle there's
+// time for, at least every DEFER_LAG cycles, which is as late as an
+// interrupt can be. The handlers bring them up to date before they touch
+// a register, key presses and port B writes post a keyboard refresh.
+#ifndef DEFER_LAG
+#define DEFER_LAG 16
+#endif
+defer6502_t io_work;
+int via_item, kbd_item;
+
+// Runs the deferred work, bad65C02.c calls it in the clock low phase of
+// every bus cycle, run6502() between the fake core's steps
+void update65C02();
+
+void via_work(void *arg, uint32_t cycles)
+{
+  via_ticks(cycles);
+}
+
+void kbd_work(void *arg, uint32_t cycles)
+{
+  kbd_refresh();
 }
+#endif
+
+// CPU thread (sync), run_state is the cycles left to run.
+// Emulated clock, -DPACE_HZ=PACE_PAL or PACE_OFF (unthrottled)
+#ifndef PACE_HZ
+#define PACE_HZ PACE_NTSC
+#endif
+pace6502_t pace;
+rt6502_hist_t step_time;
+_Atomic uint32_t run_state=3;
+
+static inline uint32_t cycles_left()
+{
+  return atomic_load_explicit(&run_state, memory_order_acquire);
+}
+
+#ifdef COOP
+void video_start();
+void video_poll();
+void video_frame();
+void video_cleanup();
+
+// The rest of the machine, when the CPU got to coop_next
+static void coop_run()
+{
+  uint64_t t;
+  int next;
+
+  coop_quanta++;
+  io_catchup();
+  if ((int32_t)(clockticks65C02 - frame_next) >= 0) {
+    t = rt6502_now();
+    video_poll();
+    video_frame();
+    coop_video += rt6502_now() - t;
+    coop_frames++;
+    frame_next = clockticks65C02 + COOP_FRAME;
+  }
+
+  next = via1_cyclesToEvent();
+  if (via2_cyclesToEvent() < next)
+    next = via2_cyclesToEvent();
+  coop_next = clockticks65C02 + (next < COOP_QUANTUM ? next : COOP_QUANTUM);
+}
+#endif
 
-// CPU thread (sync)
-volatile uint32_t run_state=3;
 void *run6502()
 {
+  uint64_t t;
+  uint32_t left;
+#ifdef COOP_EXEC
+  uint32_t n, clk;
+#endif
+
+  // On its own core in real-time mode, before the bus timing is measured
+  rt6502_enter();
+#ifdef COOP
+  video_start();
+#endif
   reset65C02();
 
-  run_state = 0;
-  while (runme) {
-    while(!run_state);
+  atomic_store_explicit(&run_state, 0, memory_order_release);
+  sync6502_signal(&state_ev);
+  sync6502_until(&state_ev, cycles_left() || !running(), 0);
+  pace6502_init(&pace, PACE_HZ, 0, clockticks65C02);
+#ifdef DEFER_IO
+  defer6502_init(&io_work, PACE_HZ, clockticks65C02);
+  via_item = defer6502_add(&io_work, "VIA ticks", via_work, NULL, 1, DEFER_LAG);
+  kbd_item = defer6502_add(&io_work, "keyboard", kbd_work, NULL, 0, DEFER_LAG);
+#endif
+#ifdef COOP
+  via_clk = coop_next = frame_next = clockticks65C02;
+#endif
+  while (running()) {
+    // Out of cycles: tell main and sleep until there are more, the I/O
+    // thread sleeps too until the clock runs again
+    if (!(left = atomic_load_explicit(&run_state, memory_order_relaxed))) {
+      mem6502_publish(&mem_pub, clockticks65C02);
+      sync6502_signal(&state_ev);
+      sync6502_until(&state_ev, cycles_left() || !running(), 0);
+      sync6502_signal(&clock_ev);
+      continue;
+    }
+    t = rt6502_now();
+#ifdef COOP_EXEC
+    // Up to the next event, at most the cycles left
+    clk = clockticks65C02;
+    n = (int32_t)(coop_next - clk) > 0 ? coop_next - clk : 1;
+    if (n > left)
+      n = left;
+    clockgoal6502 = clk;
+    exec6502(n);
+#else
     step65C02();
-
-
-#ifdef FAKE
-    ndelay(800);
-    extern volatile uint16_t pc;
-    printf("clk: %ld  IO: %ld PC: 0x%04x\n", clockticks65C02, io_ticks, pc);
 #endif
-#ifndef ASYNCIO
-    while (io_ticks != clockticks65C02);
+    rt6502_hist(&step_time, rt6502_now() - t);
+#if defined(DEFER_IO) && defined(FAKE)
+    // The fake core has no clock low phase, its slack is between the steps
+    update65C02();
+#endif
+#if !defined(ASYNCIO) && !defined(DEFER_IO) && !defined(COOP)
+    if ((int32_t)(clockticks65C02 - cpu_limit) > 0) {
+      io_syncs++;
+      io_wait(&io_limit, clockticks65C02);
+      cpu_limit = atomic_load_explicit(&io_limit, memory_order_acquire);
+    }
+#endif
+#ifdef COOP
+    if ((int32_t)(clockticks65C02 - coop_next) >= 0)
+      coop_run();
+#endif
+    pace6502(&pace, clockticks65C02);
+    // Synced, maybe after a sleep the I/O thread slept through too. The
+    // memory so far is out for the next frame
+    if (pace.ticks == clockticks65C02) {
+      mem6502_publish(&mem_pub, clockticks65C02);
+      sync6502_signal(&clock_ev);
+    }
+    // Only main sets it, while we're waiting for it
+#ifdef COOP_EXEC
+    n = clockticks65C02 - clk;
+    atomic_store_explicit(&run_state, n < left ? left - n : 0, memory_order_relaxed);
+#else
+    atomic_store_explicit(&run_state, left - 1, memory_order_relaxed);
 #endif
-    run_state--;
   }
+#ifdef COOP
+  video_cleanup();
+#endif
 }
 
 
@@ -273,6 +560,11 @@ void set_key_to_matrix(uint8_t key)
   uint8_t bit = key & 0xF;
 
   kbd_matrix[row]|=(1<<bit);
+#ifdef DEFER_IO
+  defer6502_post(&io_work, kbd_item);
+#elif defined(COOP)
+  kbd_refresh();
+#endif
 
 //  printf("Setting bit %i in row %i\n",bit,row);
 }
@@ -283,26 +575,30 @@ void clear_key_to_matrix(uint8_t key)
   uint8_t bit = key & 0xF;
 
   kbd_matrix[row]&=~(1<<bit);
+#ifdef DEFER_IO
+  defer6502_post(&io_work, kbd_item);
+#elif defined(COOP)
+  kbd_refresh();
+#endif
 }
 
-volatile uint32_t vid_state=3;
-void *videoOut()
+// Initialize VIDEO Window/Surface
+void video_start()
 {
-  uint32_t old_ticks = clockticks65C02;
-
-  // Initialize VIDEO Window/Surface
   SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS);
   video_init(window_scale,scale_quality);
+}
 
-  vid_state=0;
-  while(runme) {
+// Keys and window events
+void video_poll()
+{
     SDL_Event ev;
     while( SDL_PollEvent( &ev ) ) {
       switch(ev.type)
       {
         case SDL_QUIT:
         {
-          runme = 0;
+          stop();
 	  break;
         }
 
@@ -313,7 +609,13 @@ void *videoOut()
 
 //	  printf("%i -> %s\n",ev.key.keysym.sym,SDL_GetKeyName(ev.key.keysym.sym));
 	  if (ev.key.keysym.sym == SDLK_ESCAPE  )
-            runme = 0;
+            stop();
+
+	  // RESTORE isn't in the matrix, it pulls VIA1 CA1 low
+	  if (ev.key.keysym.sym == SDLK_PAGEUP) {
+	    via1_setCA1(0);
+	    break;
+	  }
 	  
 	  set_key_to_matrix(get_kbd_key(ev.key.keysym.sym));
 	  break;
@@ -322,6 +624,10 @@ void *videoOut()
         case SDL_KEYUP:
 	{
 //	  printf("%i XX %s\n",ev.key.keysym.sym,SDL_GetKeyName(ev.key.keysym.sym));
+	  if (ev.key.keysym.sym == SDLK_PAGEUP) {
+	    via1_setCA1(1);
+	    break;
+	  }
 	  clear_key_to_matrix(get_kbd_key(ev.key.keysym.sym));
 	  break;
 	}
@@ -348,10 +654,11 @@ void *videoOut()
       }
 
     }
+}
 
-    if (clockticks65C02 > old_ticks+20000) {
-      // Do graphics
-      //
+// Do graphics
+void video_frame()
+{
 
 //      mem[VID_MEMSTART]=clockticks65C02&0xff;
 
@@ -363,9 +670,30 @@ void *videoOut()
       SDL_RenderCopy(renderer, sdlTexture, NULL, NULL);
 
       SDL_RenderPresent(renderer);
+}
+
+atomic_uchar vid_state=3;
+void *videoOut()
+{
+  uint32_t old_ticks = mem6502_acquire(&mem_pub), ticks;
+
+  video_start();
 
-      old_ticks = clockticks65C02;
+  atomic_store_explicit(&vid_state, 0, memory_order_release);
+  sync6502_signal(&state_ev);
+  while(running()) {
+    uint32_t seq = sync6502_seq(&state_ev);
+
+    video_poll();
+    // Memory as the CPU thread published it
+    ticks = mem6502_acquire(&mem_pub);
+    if (ticks - old_ticks > 20000) {
+      video_frame();
+      old_ticks = ticks;
     }
+    else
+      // Nothing to draw yet, look for events again in a while
+      sync6502_sleep(&state_ev, seq, 5 * SYNC6502_MS);
   }
 
   // Destroy VIDEO Window
@@ -376,9 +704,13 @@ void *videoOut()
 
 
 
-void update65C02() //Currently unused
+void update65C02() //Unused without -DDEFER_IO
 {
   // Be quick in here. this function should take 120ns constantly
+#ifdef DEFER_IO
+  // or as long as there's slack for
+  defer6502_run(&io_work, clockticks65C02);
+#endif
 }
 
 uint8_t m_page;
@@ -391,6 +723,12 @@ uint8_t read65C02(uint16_t address)
   type = page_type[m_page];
 
   if (type == 2) { 
+     io_catchup();
+#ifdef DEFER_IO
+     // Timers and port A as they are now
+     defer6502_flush(&io_work, via_item, clockticks65C02);
+     defer6502_flush(&io_work, kbd_item, clockticks65C02);
+#endif
      switch(address>>4) {
       case 0x911: 
         return via1_readReg(address-0x9110);
@@ -406,7 +744,6 @@ uint8_t read65C02(uint16_t address)
 }
 
 // required function 
-uint8_t iobox = 0;
 void write65C02(uint16_t address, uint8_t value)
 {
   m_page = address>>8;
@@ -418,9 +755,28 @@ void write65C02(uint16_t address, uint8_t value)
   mem[address]=value;
 
   if (type == 2) { //Notify HW (thread)
-    mbox_data[iobox]=value;
-    io_mbox[iobox++]=address;
-    io_mbox[iobox]=0;
+    io_catchup();
+#if defined(DEFER_IO) || defined(COOP)
+    // or write the register right here, after the ticks up to now
+#ifdef DEFER_IO
+    defer6502_flush(&io_work, via_item, clockticks65C02);
+#endif
+    switch(address>>4) {
+      case 0x911:
+        via1_writeReg(address-0x9110,value);
+        break;
+      case 0x912:
+        via2_writeReg(address-0x9120,value);
+#ifdef DEFER_IO
+        defer6502_post(&io_work, kbd_item);
+#else
+        kbd_refresh();
+#endif
+        break;
+    }
+#else
+    ring6502_put(&io_ring, clockticks65C02, address, value);
+#endif
   }
 }
 
@@ -430,7 +786,7 @@ void sig_handler(int signum){
   if (int_active)
     exit(2);
   int_active=1;
-  runme=0;
+  stop();
   printf("\nCAUGHT SIGINT press again to kill\n");
 }
 
@@ -439,18 +795,48 @@ void reset_all() {
   reset65C02();
   via1_reset();
   via2_reset();
+  via1_setCA1(1); // RESTORE released
 }
 
+#ifndef FAKE
+// SIGUSR1 turns the bus trace on and off
+void trace_handler(int signum){
+  trace6502_enable(!trace6502_on);
+}
+
+// SIGUSR2 has main print the bus cycle profile
+volatile uint8_t profile_req = 0;
+void profile_handler(int signum){
+  profile_req=1;
+}
+#endif
+
 // Main prog
 int main(int argc, char **argv)
 {
   int addr=0;
   long g;
+  uint32_t seq;
 
   signal(SIGINT,sig_handler);
 
+  // Real-time mode, BAD6502_RT=<core> or any other value for the one
+  // rt6502_init() picks. Threads started from here on stay off that core
+  if (getenv("BAD6502_RT")) {
+    char *core = getenv("BAD6502_RT");
+    if (rt6502_init(*core >= '0' && *core <= '9' ? atoi(core) : -1) >= 0)
+      rt6502_prefault(mem, sizeof(mem));
+  }
+
 #ifdef FAKE
   printf("Running in FAKE mode !!!!!!!\n");
+#else
+  // Bus trace to $BAD6502_TRACE, decode it with cpu/trace6502dec
+  if (getenv("BAD6502_TRACE") && trace6502_open(getenv("BAD6502_TRACE"))) {
+    signal(SIGUSR1,trace_handler);
+    printf("Bus trace to %s, kill -USR1 %d starts and stops it\n", getenv("BAD6502_TRACE"), getpid());
+  }
+  signal(SIGUSR2,profile_handler);
 #endif
 
   //Setup memory layout
@@ -480,59 +866,116 @@ int main(int argc, char **argv)
   //Setup IO memory
   page_type[(0x9100)>>8] = 2; // VIA6522#1 and #2
 
+#ifdef FAKE
+  // Let the fake core cache decoded instructions on RAM/ROM pages,
+  // nothing but the CPU writes to mem[] once we're running
+  for (g=0; g<256; g++)
+    if (page_type[g] != 2)
+      cache6502(g, g, 1);
+
+  // and access RAM and ROM directly, only the VIAs need read65C02() and
+  // write65C02(). ROM is mapped read only, its writes are dropped there
+  for (g=0; g<256; g++)
+    if (page_type[g] != 2)
+      map6502(g, g, page[g], page_type[g] == 1);
+
+#ifdef ROMS_NATIVE
+  // Run BASIC and the KERNAL as native code ('make fakeaot')
+  native6502(vic20_native, vic20_nativemap);
+#endif
+#endif
+
   //Init all simulated hardware
   reset_all();
 
   //Setup threads
+#if !defined(DEFER_IO) && !defined(COOP)
+  if (!ring6502_init(&io_ring, IO_RING, IO_BACKPRESSURE, &clock_ev))
+    exit(-1);
   if (pthread_create(&IOthread, NULL, updateIO, NULL)) {
     printf("thread create failed\n");
     exit(-1);
   }
-  while(!updateIO_ready);
+  sync6502_until(&state_ev, atomic_load_explicit(&updateIO_ready, memory_order_acquire), 0);
   printf("IO Thread running\n");
+#endif
 
   if (pthread_create(&CPUthread, NULL, run6502, NULL)) {
     printf("thread create failed\n");
     exit(-1);
   }
-  while(run_state);
+  sync6502_until(&state_ev, !cycles_left(), 0);
   printf("CPU Thread running\n");
   
+#ifndef COOP
   if (pthread_create(&VIDthread, NULL, videoOut, NULL)) {
     printf("thread create failed\n");
     exit(-1);
   }
-  while(vid_state);
+  sync6502_until(&state_ev, !atomic_load_explicit(&vid_state, memory_order_acquire), 0);
   printf("VIDEO Thread running\n");
+#endif
 
   printf("-------- START --------\n");
 
-  // Run 1Million cycles
-  for (g=0; g<100000; g++) {
-    while(run_state);
-    run_state=1000;
-    if (!runme)
+  // Run 100Million cycles, say how fast every second
+  atomic_store_explicit(&run_state, 100000000, memory_order_release);
+  sync6502_signal(&state_ev);
+  for (g=1; ; g++) {
+    seq = sync6502_seq(&state_ev);
+    if (!cycles_left() || !running())
       break;
+    sync6502_sleep(&state_ev, seq, 100 * SYNC6502_MS);
+#ifndef FAKE
+    if (profile_req) {
+      profile_req=0;
+      profile65C02();
+    }
+#endif
+    if (g % 10 == 0)
+      printf("\n%.4f MHz\n", pace6502_mhz(&pace, clockticks65C02));
   }
 
   printf("\n\nExecution stopped.");
+  printf(" Slept %u times (%llu ms), ran late %u, gave up %llu ms %u times\n",
+         pace.sleeps, (unsigned long long)pace.slept / 1000000, pace.late,
+         (unsigned long long)pace.given / 1000000, pace.lost);
 
   //
   // Shutdown
   //
 
-  runme=0;
-  usleep(100);
-  //Unstick threads that are waiting on a clock cycle
-  clockticks65C02++;
-  run_state=1;
+  stop();
 
+#ifndef COOP
   printf("Stopping VIDEO thread\n");
   pthread_join(VIDthread,NULL);
+#endif
+#if !defined(DEFER_IO) && !defined(COOP)
   printf("Stopping IO thread\n");
   pthread_join(IOthread,NULL);
+#endif
   printf("Stopping CPU thread\n");
   pthread_join(CPUthread,NULL);
+  rt6502_print(&step_time, "step65C02()");
+#ifdef DEFER_IO
+  defer6502_print(&io_work, "Deferred I/O");
+#elif defined(COOP)
+  printf("Cooperative: %llu quanta, %.1f cycles each, %llu frames, %.0f us each\n",
+         (unsigned long long)coop_quanta, coop_quanta ? (double)pace.cycles / coop_quanta : 0.0,
+         (unsigned long long)coop_frames, coop_frames ? rt6502_ns(coop_video) / coop_frames / 1000 : 0.0);
+#else
+  ring6502_print(&io_ring, "I/O writes");
+#endif
+#if !defined(ASYNCIO) && !defined(DEFER_IO) && !defined(COOP)
+  printf("I/O sync, quantum %u: %llu at the limit, %llu VIA accesses, waited %llu times, lag %.1f cycles mean, %u max\n",
+         IO_QUANTUM, (unsigned long long)io_syncs, (unsigned long long)io_accesses, (unsigned long long)io_waits,
+         io_syncs + io_accesses ? (double)io_lagsum / (io_syncs + io_accesses) : 0.0, io_lagmax);
+#endif
+#ifndef FAKE
+  trace6502_close();
+  profile65C02();
+#endif
 
   usleep(100);
   return 0;
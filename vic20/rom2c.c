@@ -0,0 +1,318 @@
+/*  bad6502 A Raspberry Pi-based backend to a 65C02 CPU
+    Copyright (C) 2022  D.Herrendoerfer
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+// rom2c: translates the VIC-20 BASIC and KERNAL ROMs to C for the fake core
+//
+// Follows the code from the 6502 vectors, the KERNAL jump table and the
+// pointer tables of both ROMs and writes one C function with a label per
+// instruction found. Every instruction is expanded with the same addressing
+// mode and operation macros as the interpreter (cpu/fake6502_ops.h and
+// cpu/fake6502_opcodes.h), so timing and flags can't drift apart. Branches,
+// JMP and JSR become gotos, RTS, RTI, BRK and JMP () go through a switch on
+// pc, and pc landing anywhere else (RAM, computed jumps into code that wasn't
+// found) returns to the interpreter.
+//
+// The ROMs never change, so their bytes are compiled in. The result is
+// registered with native6502()/cpu6502_native(), see roms_native.h.
+//
+// usage: rom2c > roms_native.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cpu/fake6502_ops.h"
+
+#include "./roms/basic.901486-01.h"
+#include "./roms/kernal.901486-06.h"
+
+#define ROMSTART 0xC000
+#define ROMSIZE  0x4000
+
+// Mode and operation of each opcode, as written in the opcode list
+static const struct {
+  const char *mode, *op;
+} optable[256] = {
+#define OPCODE(n, mode, op) [n] = { #mode, #op },
+#include "cpu/fake6502_opcodes.h"
+#undef OPCODE
+};
+
+// Pointer tables to start from, besides the KERNAL jump table
+static const struct {
+  uint16_t address;
+  int count, stride, adjust;
+} tables[] = {
+  { 0xFFFA,  3, 2, 0 },   // NMI, RESET, IRQ
+  { 0xC000,  2, 2, 0 },   // BASIC cold and warm start
+  { 0xC00C, 35, 2, 1 },   // BASIC statements, address-1 for RTS
+  { 0xC052, 23, 2, 0 },   // BASIC functions
+  { 0xC081, 10, 3, 1 },   // BASIC operators, address-1 behind the priority
+  { 0xE44F,  6, 2, 0 },   // BASIC RAM vectors ($0300) defaults
+  { 0xFD6D, 16, 2, 0 },   // KERNAL RAM vectors ($0314) defaults
+};
+
+#define JUMPTABLE_FIRST 0xFF8A
+#define JUMPTABLE_LAST  0xFFF3
+
+static uint8_t rom[ROMSIZE];
+static uint8_t code[ROMSIZE];   // an instruction starts here
+static uint16_t work[ROMSIZE];
+static int nwork;
+
+static uint8_t romread(uint16_t address)
+{
+  return rom[address - ROMSTART];
+}
+
+static uint16_t romword(uint16_t address)
+{
+  return romread(address) | (romread(address + 1) << 8);
+}
+
+static int inrom(uint32_t address)
+{
+  return address >= ROMSTART && address < ROMSTART + ROMSIZE;
+}
+
+// Undocumented opcodes, the 65C02's bit branches and WAI/STP are left to
+// the interpreter
+static int documented(uint8_t opcode)
+{
+  static const char *interpreted[] = { "LAX", "SAX", "DCP", "ISB", "SLO", "RLA", "SRE", "RRA",
+                                       "BBR", "BBS", "WAI", "STP" };
+  const char *op = optable[opcode].op;
+  int i;
+
+  for (i=0; i<sizeof(interpreted)/sizeof(interpreted[0]); i++)
+    if (!strncmp(op, interpreted[i], 3))
+      return 0;
+  if (!strcmp(op, "NOP"))
+    return opcode == 0xEA;
+  return opcode != 0xEB; // NMOS SBC #imm alias
+}
+
+static int isbranch(uint8_t opcode)
+{
+  return !strcmp(optable[opcode].mode, "REL");
+}
+
+// Control leaves through pc, to wherever it points at runtime
+static int isdynamic(uint8_t opcode)
+{
+  return opcode == 0x00 || opcode == 0x40 || opcode == 0x60 || opcode == 0x6C || opcode == 0x7C;
+}
+
+static uint16_t operand(uint16_t address)
+{
+  uint8_t len = lentable[romread(address)];
+  uint16_t v = 0;
+
+  if (len > 1) v = romread(address + 1);
+  if (len > 2) v |= romread(address + 2) << 8;
+  return v;
+}
+
+static uint16_t branchtarget(uint16_t address)
+{
+  return address + 2 + (int8_t)romread(address + 1);
+}
+
+static void push(uint32_t address)
+{
+  if (inrom(address) && !code[address - ROMSTART])
+    work[nwork++] = address;
+}
+
+// Recursive traversal with an explicit stack
+static void traverse()
+{
+  uint16_t address;
+  uint8_t opcode, len;
+
+  while (nwork) {
+    address = work[--nwork];
+    if (code[address - ROMSTART])
+      continue;
+    opcode = romread(address);
+    len = lentable[opcode];
+    if (!documented(opcode) || !inrom(address + len - 1))
+      continue;
+    code[address - ROMSTART] = 1;
+
+    if (isbranch(opcode))
+      push(branchtarget(address));
+    if (opcode == 0x4C || opcode == 0x20) // JMP, JSR
+      push(operand(address));
+    if (opcode == 0x6C && inrom(operand(address))) // JMP () through the ROM
+      push(romword(operand(address)));
+    if (opcode != 0x4C && !isdynamic(opcode))
+      push(address + len);
+  }
+}
+
+// Where control goes to when pc is address
+static void jumpto(uint32_t address)
+{
+  if (inrom(address) && code[address - ROMSTART])
+    printf("goto L_%04X;", address);
+  else
+    printf("goto out;");
+}
+
+// The label emitted after the one at address is the one at next
+static int fallsthrough(uint32_t address, uint32_t next)
+{
+  for (address++; address<next; address++)
+    if (code[address - ROMSTART])
+      return 0;
+  return inrom(next) && code[next - ROMSTART];
+}
+
+// Some instruction found uses addressing mode
+static int uses(const char *mode)
+{
+  int i;
+
+  for (i=0; i<ROMSIZE; i++)
+    if (code[i] && !strcmp(optable[rom[i]].mode, mode))
+      return 1;
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  int t, i, count = 0;
+  uint32_t address, next;
+  uint8_t opcode;
+
+  if (basicROM_len + kernalROM_len != ROMSIZE) {
+    fprintf(stderr, "rom2c: unexpected ROM sizes\n");
+    return 1;
+  }
+  memcpy(rom, basicROM, basicROM_len);
+  memcpy(rom + basicROM_len, kernalROM, kernalROM_len);
+
+  for (t=0; t<sizeof(tables)/sizeof(tables[0]); t++)
+    for (i=0; i<tables[t].count; i++)
+      push(romword(tables[t].address + i * tables[t].stride) + tables[t].adjust);
+  for (address=JUMPTABLE_FIRST; address<=JUMPTABLE_LAST; address+=3)
+    push(address);
+  traverse();
+
+  printf("// Generated by vic20/rom2c from the VIC-20 BASIC and KERNAL ROMs, do not edit\n\n");
+  printf("#include <stdint.h>\n\n");
+  printf("#include \"cpu/fake6502.h\"\n");
+  printf("#include \"cpu/fake6502_ops.h\"\n");
+  printf("#include \"roms_native.h\"\n\n");
+
+  printf("static const uint8_t rom[0x%04X] = {", ROMSIZE);
+  for (i=0; i<ROMSIZE; i++)
+    printf("%s0x%02x,", (i & 15) ? "" : "\n  ", rom[i]);
+  printf("\n};\n\n");
+
+  printf("const uint8_t vic20_nativemap[0x2000] = {");
+  for (i=0; i<0x2000; i++) {
+    uint8_t bits = 0;
+    for (t=0; t<8; t++)
+      if (inrom(i * 8 + t) && code[i * 8 + t - ROMSTART])
+        bits |= 1 << t;
+    printf("%s0x%02x,", (i & 15) ? "" : "\n  ", bits);
+  }
+  printf("\n};\n\n");
+
+  printf("//the ROMs are read from the copy above, everything else from the bus\n");
+  printf("static inline uint8_t rd(cpu6502_t *c, uint16_t address) {\n");
+  printf("    return address >= 0x%04X ? rom[address - 0x%04X] : cpu6502_read(c, address);\n", ROMSTART, ROMSTART);
+  printf("}\n\n");
+  printf("#define RD(addr)       rd(c, (uint16_t)(addr))\n");
+  printf("#define WR(addr, val)  cpu6502_write(c, (uint16_t)(addr), (uint8_t)(val))\n\n");
+  printf("//stop at the goal and in front of interrupts, the interpreter serves them\n");
+  printf("#define STEP if ((int32_t)(clk - goal) >= 0 || PENDING) goto out\n");
+  printf("#define FETCH(n, next) {\\\n");
+  printf("    clk += ticktable[n];\\\n");
+  printf("    pc = (next);\\\n");
+  printf("    status |= FLAG_CONSTANT;\\\n");
+  printf("    count++;\\\n");
+  printf("}\n\n");
+
+  printf("void vic20_native(cpu6502_t *c, uint32_t goal) {\n");
+  printf("    uint16_t pc = c->pc;\n");
+  printf("    uint8_t sp = c->sp, a = c->a, x = c->x, y = c->y, status, zres, nres;\n");
+  printf("    uint32_t clk = c->clockticks;\n");
+  printf("    uint32_t count = 0;\n");
+  printf("    uint16_t operand, ea, reladdr, oldpc, value, result;\n");
+  if (uses("INDX"))
+    printf("    uint16_t eahelp;\n");
+#ifdef FAKE6502_65C02
+  if (uses("INDABSX"))
+#else
+  if (uses("IND"))
+#endif
+    printf("    uint16_t eahelp2;\n");
+  printf("\n");
+  printf("    PUTSTATUS(c->status);\n");
+  printf("    goto dispatch;\n\n");
+
+  for (address=ROMSTART; address<ROMSTART+ROMSIZE; address++) {
+    if (!code[address - ROMSTART])
+      continue;
+    opcode = romread(address);
+    next = address + lentable[opcode];
+    count++;
+
+    printf("L_%04X: STEP; FETCH(0x%02X, 0x%04X); ", address, opcode, next & 0xFFFF);
+    printf("operand = 0x%04X; %s; %s; ", operand(address), optable[opcode].mode, optable[opcode].op);
+    if (isdynamic(opcode)) {
+      printf("goto dispatch;\n");
+      continue;
+    }
+    if (isbranch(opcode)) {
+      printf("if (pc != 0x%04X) ", next);
+      jumpto(branchtarget(address));
+      printf(" ");
+    }
+    if (opcode == 0x4C || opcode == 0x20)
+      jumpto(operand(address));
+    else if (!fallsthrough(address, next))
+      jumpto(next);
+    printf("\n");
+  }
+
+  printf("\ndispatch:\n");
+  printf("    switch (pc) {\n");
+  for (address=ROMSTART; address<ROMSTART+ROMSIZE; address++)
+    if (code[address - ROMSTART])
+      printf("    case 0x%04X: goto L_%04X;\n", address, address);
+  printf("    default: goto out;\n");
+  printf("    }\n\n");
+
+  printf("out:\n");
+  printf("    c->pc = pc;\n");
+  printf("    c->sp = sp;\n");
+  printf("    c->a = a;\n");
+  printf("    c->x = x;\n");
+  printf("    c->y = y;\n");
+  printf("    c->status = GETSTATUS;\n");
+  printf("    c->clockticks = clk;\n");
+  printf("    c->instructions += count;\n");
+  printf("}\n");
+
+  fprintf(stderr, "rom2c: %d instructions translated\n", count);
+  return 0;
+}
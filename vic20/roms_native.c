@@ -0,0 +1,14805 @@
+// Generated by vic20/rom2c from the VIC-20 BASIC and KERNAL ROMs, do not edit
+
+#include <stdint.h>
+
+#include "cpu/fake6502.h"
+#include "cpu/fake6502_ops.h"
+#include "roms_native.h"
+
+static const uint8_t rom[0x4000] = {
+  0x78,0xe3,0x67,0xe4,0x43,0x42,0x4d,0x42,0x41,0x53,0x49,0x43,0x30,0xc8,0x41,0xc7,
+  0x1d,0xcd,0xf7,0xc8,0xa4,0xcb,0xbe,0xcb,0x80,0xd0,0x05,0xcc,0xa4,0xc9,0x9f,0xc8,
+  0x70,0xc8,0x27,0xc9,0x1c,0xc8,0x82,0xc8,0xd1,0xc8,0x3a,0xc9,0x2e,0xc8,0x4a,0xc9,
+  0x2c,0xd8,0x64,0xe1,0x52,0xe1,0x61,0xe1,0xb2,0xd3,0x23,0xd8,0x7f,0xca,0x9f,0xca,
+  0x56,0xc8,0x9b,0xc6,0x5d,0xc6,0x85,0xca,0x26,0xe1,0xba,0xe1,0xc3,0xe1,0x7a,0xcb,
+  0x41,0xc6,0x39,0xdc,0xcc,0xdc,0x58,0xdc,0x00,0x00,0x7d,0xd3,0x9e,0xd3,0x71,0xdf,
+  0x94,0xe0,0xea,0xd9,0xed,0xdf,0x61,0xe2,0x68,0xe2,0xb1,0xe2,0x0b,0xe3,0x0d,0xd8,
+  0x7c,0xd7,0x65,0xd4,0xad,0xd7,0x8b,0xd7,0xec,0xd6,0x00,0xd7,0x2c,0xd7,0x37,0xd7,
+  0x79,0x69,0xd8,0x79,0x52,0xd8,0x7b,0x2a,0xda,0x7b,0x11,0xdb,0x7f,0x7a,0xdf,0x50,
+  0xe8,0xcf,0x46,0xe5,0xcf,0x7d,0xb3,0xdf,0x5a,0xd3,0xce,0x64,0x15,0xd0,0x45,0x4e,
+  0xc4,0x46,0x4f,0xd2,0x4e,0x45,0x58,0xd4,0x44,0x41,0x54,0xc1,0x49,0x4e,0x50,0x55,
+  0x54,0xa3,0x49,0x4e,0x50,0x55,0xd4,0x44,0x49,0xcd,0x52,0x45,0x41,0xc4,0x4c,0x45,
+  0xd4,0x47,0x4f,0x54,0xcf,0x52,0x55,0xce,0x49,0xc6,0x52,0x45,0x53,0x54,0x4f,0x52,
+  0xc5,0x47,0x4f,0x53,0x55,0xc2,0x52,0x45,0x54,0x55,0x52,0xce,0x52,0x45,0xcd,0x53,
+  0x54,0x4f,0xd0,0x4f,0xce,0x57,0x41,0x49,0xd4,0x4c,0x4f,0x41,0xc4,0x53,0x41,0x56,
+  0xc5,0x56,0x45,0x52,0x49,0x46,0xd9,0x44,0x45,0xc6,0x50,0x4f,0x4b,0xc5,0x50,0x52,
+  0x49,0x4e,0x54,0xa3,0x50,0x52,0x49,0x4e,0xd4,0x43,0x4f,0x4e,0xd4,0x4c,0x49,0x53,
+  0xd4,0x43,0x4c,0xd2,0x43,0x4d,0xc4,0x53,0x59,0xd3,0x4f,0x50,0x45,0xce,0x43,0x4c,
+  0x4f,0x53,0xc5,0x47,0x45,0xd4,0x4e,0x45,0xd7,0x54,0x41,0x42,0xa8,0x54,0xcf,0x46,
+  0xce,0x53,0x50,0x43,0xa8,0x54,0x48,0x45,0xce,0x4e,0x4f,0xd4,0x53,0x54,0x45,0xd0,
+  0xab,0xad,0xaa,0xaf,0xde,0x41,0x4e,0xc4,0x4f,0xd2,0xbe,0xbd,0xbc,0x53,0x47,0xce,
+  0x49,0x4e,0xd4,0x41,0x42,0xd3,0x55,0x53,0xd2,0x46,0x52,0xc5,0x50,0x4f,0xd3,0x53,
+  0x51,0xd2,0x52,0x4e,0xc4,0x4c,0x4f,0xc7,0x45,0x58,0xd0,0x43,0x4f,0xd3,0x53,0x49,
+  0xce,0x54,0x41,0xce,0x41,0x54,0xce,0x50,0x45,0x45,0xcb,0x4c,0x45,0xce,0x53,0x54,
+  0x52,0xa4,0x56,0x41,0xcc,0x41,0x53,0xc3,0x43,0x48,0x52,0xa4,0x4c,0x45,0x46,0x54,
+  0xa4,0x52,0x49,0x47,0x48,0x54,0xa4,0x4d,0x49,0x44,0xa4,0x47,0xcf,0x00,0x54,0x4f,
+  0x4f,0x20,0x4d,0x41,0x4e,0x59,0x20,0x46,0x49,0x4c,0x45,0xd3,0x46,0x49,0x4c,0x45,
+  0x20,0x4f,0x50,0x45,0xce,0x46,0x49,0x4c,0x45,0x20,0x4e,0x4f,0x54,0x20,0x4f,0x50,
+  0x45,0xce,0x46,0x49,0x4c,0x45,0x20,0x4e,0x4f,0x54,0x20,0x46,0x4f,0x55,0x4e,0xc4,
+  0x44,0x45,0x56,0x49,0x43,0x45,0x20,0x4e,0x4f,0x54,0x20,0x50,0x52,0x45,0x53,0x45,
+  0x4e,0xd4,0x4e,0x4f,0x54,0x20,0x49,0x4e,0x50,0x55,0x54,0x20,0x46,0x49,0x4c,0xc5,
+  0x4e,0x4f,0x54,0x20,0x4f,0x55,0x54,0x50,0x55,0x54,0x20,0x46,0x49,0x4c,0xc5,0x4d,
+  0x49,0x53,0x53,0x49,0x4e,0x47,0x20,0x46,0x49,0x4c,0x45,0x20,0x4e,0x41,0x4d,0xc5,
+  0x49,0x4c,0x4c,0x45,0x47,0x41,0x4c,0x20,0x44,0x45,0x56,0x49,0x43,0x45,0x20,0x4e,
+  0x55,0x4d,0x42,0x45,0xd2,0x4e,0x45,0x58,0x54,0x20,0x57,0x49,0x54,0x48,0x4f,0x55,
+  0x54,0x20,0x46,0x4f,0xd2,0x53,0x59,0x4e,0x54,0x41,0xd8,0x52,0x45,0x54,0x55,0x52,
+  0x4e,0x20,0x57,0x49,0x54,0x48,0x4f,0x55,0x54,0x20,0x47,0x4f,0x53,0x55,0xc2,0x4f,
+  0x55,0x54,0x20,0x4f,0x46,0x20,0x44,0x41,0x54,0xc1,0x49,0x4c,0x4c,0x45,0x47,0x41,
+  0x4c,0x20,0x51,0x55,0x41,0x4e,0x54,0x49,0x54,0xd9,0x4f,0x56,0x45,0x52,0x46,0x4c,
+  0x4f,0xd7,0x4f,0x55,0x54,0x20,0x4f,0x46,0x20,0x4d,0x45,0x4d,0x4f,0x52,0xd9,0x55,
+  0x4e,0x44,0x45,0x46,0x27,0x44,0x20,0x53,0x54,0x41,0x54,0x45,0x4d,0x45,0x4e,0xd4,
+  0x42,0x41,0x44,0x20,0x53,0x55,0x42,0x53,0x43,0x52,0x49,0x50,0xd4,0x52,0x45,0x44,
+  0x49,0x4d,0x27,0x44,0x20,0x41,0x52,0x52,0x41,0xd9,0x44,0x49,0x56,0x49,0x53,0x49,
+  0x4f,0x4e,0x20,0x42,0x59,0x20,0x5a,0x45,0x52,0xcf,0x49,0x4c,0x4c,0x45,0x47,0x41,
+  0x4c,0x20,0x44,0x49,0x52,0x45,0x43,0xd4,0x54,0x59,0x50,0x45,0x20,0x4d,0x49,0x53,
+  0x4d,0x41,0x54,0x43,0xc8,0x53,0x54,0x52,0x49,0x4e,0x47,0x20,0x54,0x4f,0x4f,0x20,
+  0x4c,0x4f,0x4e,0xc7,0x46,0x49,0x4c,0x45,0x20,0x44,0x41,0x54,0xc1,0x46,0x4f,0x52,
+  0x4d,0x55,0x4c,0x41,0x20,0x54,0x4f,0x4f,0x20,0x43,0x4f,0x4d,0x50,0x4c,0x45,0xd8,
+  0x43,0x41,0x4e,0x27,0x54,0x20,0x43,0x4f,0x4e,0x54,0x49,0x4e,0x55,0xc5,0x55,0x4e,
+  0x44,0x45,0x46,0x27,0x44,0x20,0x46,0x55,0x4e,0x43,0x54,0x49,0x4f,0xce,0x56,0x45,
+  0x52,0x49,0x46,0xd9,0x4c,0x4f,0x41,0xc4,0x9e,0xc1,0xac,0xc1,0xb5,0xc1,0xc2,0xc1,
+  0xd0,0xc1,0xe2,0xc1,0xf0,0xc1,0xff,0xc1,0x10,0xc2,0x25,0xc2,0x35,0xc2,0x3b,0xc2,
+  0x4f,0xc2,0x5a,0xc2,0x6a,0xc2,0x72,0xc2,0x7f,0xc2,0x90,0xc2,0x9d,0xc2,0xaa,0xc2,
+  0xba,0xc2,0xc8,0xc2,0xd5,0xc2,0xe4,0xc2,0xed,0xc2,0x00,0xc3,0x0e,0xc3,0x1e,0xc3,
+  0x24,0xc3,0x83,0xc3,0x0d,0x4f,0x4b,0x0d,0x00,0x0d,0x20,0x45,0x52,0x52,0x4f,0x52,
+  0x00,0x20,0x49,0x4e,0x20,0x00,0x0d,0x0a,0x52,0x45,0x41,0x44,0x59,0x2e,0x0d,0x0a,
+  0x00,0x0d,0x0a,0x42,0x52,0x45,0x41,0x4b,0x00,0xa0,0xba,0xe8,0xe8,0xe8,0xe8,0xbd,
+  0x01,0x01,0xc9,0x81,0xd0,0x21,0xa5,0x4a,0xd0,0x0a,0xbd,0x02,0x01,0x85,0x49,0xbd,
+  0x03,0x01,0x85,0x4a,0xdd,0x03,0x01,0xd0,0x07,0xa5,0x49,0xdd,0x02,0x01,0xf0,0x07,
+  0x8a,0x18,0x69,0x12,0xaa,0xd0,0xd8,0x60,0x20,0x08,0xc4,0x85,0x31,0x84,0x32,0x38,
+  0xa5,0x5a,0xe5,0x5f,0x85,0x22,0xa8,0xa5,0x5b,0xe5,0x60,0xaa,0xe8,0x98,0xf0,0x23,
+  0xa5,0x5a,0x38,0xe5,0x22,0x85,0x5a,0xb0,0x03,0xc6,0x5b,0x38,0xa5,0x58,0xe5,0x22,
+  0x85,0x58,0xb0,0x08,0xc6,0x59,0x90,0x04,0xb1,0x5a,0x91,0x58,0x88,0xd0,0xf9,0xb1,
+  0x5a,0x91,0x58,0xc6,0x5b,0xc6,0x59,0xca,0xd0,0xf2,0x60,0x0a,0x69,0x3e,0xb0,0x35,
+  0x85,0x22,0xba,0xe4,0x22,0x90,0x2e,0x60,0xc4,0x34,0x90,0x28,0xd0,0x04,0xc5,0x33,
+  0x90,0x22,0x48,0xa2,0x09,0x98,0x48,0xb5,0x57,0xca,0x10,0xfa,0x20,0x26,0xd5,0xa2,
+  0xf7,0x68,0x95,0x61,0xe8,0x30,0xfa,0x68,0xa8,0x68,0xc4,0x34,0x90,0x06,0xd0,0x05,
+  0xc5,0x33,0xb0,0x01,0x60,0xa2,0x10,0x6c,0x00,0x03,0x8a,0x0a,0xaa,0xbd,0x26,0xc3,
+  0x85,0x22,0xbd,0x27,0xc3,0x85,0x23,0x20,0xcc,0xff,0xa9,0x00,0x85,0x13,0x20,0xd7,
+  0xca,0x20,0x45,0xcb,0xa0,0x00,0xb1,0x22,0x48,0x29,0x7f,0x20,0x47,0xcb,0xc8,0x68,
+  0x10,0xf4,0x20,0x7a,0xc6,0xa9,0x69,0xa0,0xc3,0x20,0x1e,0xcb,0xa4,0x3a,0xc8,0xf0,
+  0x03,0x20,0xc2,0xdd,0xa9,0x76,0xa0,0xc3,0x20,0x1e,0xcb,0xa9,0x80,0x20,0x90,0xff,
+  0x6c,0x02,0x03,0x20,0x60,0xc5,0x86,0x7a,0x84,0x7b,0x20,0x73,0x00,0xaa,0xf0,0xf0,
+  0xa2,0xff,0x86,0x3a,0x90,0x06,0x20,0x79,0xc5,0x4c,0xe1,0xc7,0x20,0x6b,0xc9,0x20,
+  0x79,0xc5,0x84,0x0b,0x20,0x13,0xc6,0x90,0x44,0xa0,0x01,0xb1,0x5f,0x85,0x23,0xa5,
+  0x2d,0x85,0x22,0xa5,0x60,0x85,0x25,0xa5,0x5f,0x88,0xf1,0x5f,0x18,0x65,0x2d,0x85,
+  0x2d,0x85,0x24,0xa5,0x2e,0x69,0xff,0x85,0x2e,0xe5,0x60,0xaa,0x38,0xa5,0x5f,0xe5,
+  0x2d,0xa8,0xb0,0x03,0xe8,0xc6,0x25,0x18,0x65,0x22,0x90,0x03,0xc6,0x23,0x18,0xb1,
+  0x22,0x91,0x24,0xc8,0xd0,0xf9,0xe6,0x23,0xe6,0x25,0xca,0xd0,0xf2,0x20,0x59,0xc6,
+  0x20,0x33,0xc5,0xad,0x00,0x02,0xf0,0x88,0x18,0xa5,0x2d,0x85,0x5a,0x65,0x0b,0x85,
+  0x58,0xa4,0x2e,0x84,0x5b,0x90,0x01,0xc8,0x84,0x59,0x20,0xb8,0xc3,0xa5,0x14,0xa4,
+  0x15,0x8d,0xfe,0x01,0x8c,0xff,0x01,0xa5,0x31,0xa4,0x32,0x85,0x2d,0x84,0x2e,0xa4,
+  0x0b,0x88,0xb9,0xfc,0x01,0x91,0x5f,0x88,0x10,0xf8,0x20,0x59,0xc6,0x20,0x33,0xc5,
+  0x4c,0x80,0xc4,0xa5,0x2b,0xa4,0x2c,0x85,0x22,0x84,0x23,0x18,0xa0,0x01,0xb1,0x22,
+  0xf0,0x1d,0xa0,0x04,0xc8,0xb1,0x22,0xd0,0xfb,0xc8,0x98,0x65,0x22,0xaa,0xa0,0x00,
+  0x91,0x22,0xa5,0x23,0x69,0x00,0xc8,0x91,0x22,0x86,0x22,0x85,0x23,0x90,0xdd,0x60,
+  0xa2,0x00,0x20,0x0f,0xe1,0xc9,0x0d,0xf0,0x0d,0x9d,0x00,0x02,0xe8,0xe0,0x59,0x90,
+  0xf1,0xa2,0x17,0x4c,0x37,0xc4,0x4c,0xca,0xca,0x6c,0x04,0x03,0xa6,0x7a,0xa0,0x04,
+  0x84,0x0f,0xbd,0x00,0x02,0x10,0x07,0xc9,0xff,0xf0,0x3e,0xe8,0xd0,0xf4,0xc9,0x20,
+  0xf0,0x37,0x85,0x08,0xc9,0x22,0xf0,0x56,0x24,0x0f,0x70,0x2d,0xc9,0x3f,0xd0,0x04,
+  0xa9,0x99,0xd0,0x25,0xc9,0x30,0x90,0x04,0xc9,0x3c,0x90,0x1d,0x84,0x71,0xa0,0x00,
+  0x84,0x0b,0x88,0x86,0x7a,0xca,0xc8,0xe8,0xbd,0x00,0x02,0x38,0xf9,0x9e,0xc0,0xf0,
+  0xf5,0xc9,0x80,0xd0,0x30,0x05,0x0b,0xa4,0x71,0xe8,0xc8,0x99,0xfb,0x01,0xb9,0xfb,
+  0x01,0xf0,0x36,0x38,0xe9,0x3a,0xf0,0x04,0xc9,0x49,0xd0,0x02,0x85,0x0f,0x38,0xe9,
+  0x55,0xd0,0x9f,0x85,0x08,0xbd,0x00,0x02,0xf0,0xdf,0xc5,0x08,0xf0,0xdb,0xc8,0x99,
+  0xfb,0x01,0xe8,0xd0,0xf0,0xa6,0x7a,0xe6,0x0b,0xc8,0xb9,0x9d,0xc0,0x10,0xfa,0xb9,
+  0x9e,0xc0,0xd0,0xb4,0xbd,0x00,0x02,0x10,0xbe,0x99,0xfd,0x01,0xc6,0x7b,0xa9,0xff,
+  0x85,0x7a,0x60,0xa5,0x2b,0xa6,0x2c,0xa0,0x01,0x85,0x5f,0x86,0x60,0xb1,0x5f,0xf0,
+  0x1f,0xc8,0xc8,0xa5,0x15,0xd1,0x5f,0x90,0x18,0xf0,0x03,0x88,0xd0,0x09,0xa5,0x14,
+  0x88,0xd1,0x5f,0x90,0x0c,0xf0,0x0a,0x88,0xb1,0x5f,0xaa,0x88,0xb1,0x5f,0xb0,0xd7,
+  0x18,0x60,0xd0,0xfd,0xa9,0x00,0xa8,0x91,0x2b,0xc8,0x91,0x2b,0xa5,0x2b,0x18,0x69,
+  0x02,0x85,0x2d,0xa5,0x2c,0x69,0x00,0x85,0x2e,0x20,0x8e,0xc6,0xa9,0x00,0xd0,0x2d,
+  0x20,0xe7,0xff,0xa5,0x37,0xa4,0x38,0x85,0x33,0x84,0x34,0xa5,0x2d,0xa4,0x2e,0x85,
+  0x2f,0x84,0x30,0x85,0x31,0x84,0x32,0x20,0x1d,0xc8,0xa2,0x19,0x86,0x16,0x68,0xa8,
+  0x68,0xa2,0xfa,0x9a,0x48,0x98,0x48,0xa9,0x00,0x85,0x3e,0x85,0x10,0x60,0x18,0xa5,
+  0x2b,0x69,0xff,0x85,0x7a,0xa5,0x2c,0x69,0xff,0x85,0x7b,0x60,0x90,0x06,0xf0,0x04,
+  0xc9,0xab,0xd0,0xe9,0x20,0x6b,0xc9,0x20,0x13,0xc6,0x20,0x79,0x00,0xf0,0x0c,0xc9,
+  0xab,0xd0,0x8e,0x20,0x73,0x00,0x20,0x6b,0xc9,0xd0,0x86,0x68,0x68,0xa5,0x14,0x05,
+  0x15,0xd0,0x06,0xa9,0xff,0x85,0x14,0x85,0x15,0xa0,0x01,0x84,0x0f,0xb1,0x5f,0xf0,
+  0x43,0x20,0x2c,0xc8,0x20,0xd7,0xca,0xc8,0xb1,0x5f,0xaa,0xc8,0xb1,0x5f,0xc5,0x15,
+  0xd0,0x04,0xe4,0x14,0xf0,0x02,0xb0,0x2c,0x84,0x49,0x20,0xcd,0xdd,0xa9,0x20,0xa4,
+  0x49,0x29,0x7f,0x20,0x47,0xcb,0xc9,0x22,0xd0,0x06,0xa5,0x0f,0x49,0xff,0x85,0x0f,
+  0xc8,0xf0,0x11,0xb1,0x5f,0xd0,0x10,0xa8,0xb1,0x5f,0xaa,0xc8,0xb1,0x5f,0x86,0x5f,
+  0x85,0x60,0xd0,0xb5,0x4c,0x74,0xc4,0x6c,0x06,0x03,0x10,0xd7,0xc9,0xff,0xf0,0xd3,
+  0x24,0x0f,0x30,0xcf,0x38,0xe9,0x7f,0xaa,0x84,0x49,0xa0,0xff,0xca,0xf0,0x08,0xc8,
+  0xb9,0x9e,0xc0,0x10,0xfa,0x30,0xf5,0xc8,0xb9,0x9e,0xc0,0x30,0xb2,0x20,0x47,0xcb,
+  0xd0,0xf5,0xa9,0x80,0x85,0x10,0x20,0xa5,0xc9,0x20,0x8a,0xc3,0xd0,0x05,0x8a,0x69,
+  0x0f,0xaa,0x9a,0x68,0x68,0xa9,0x09,0x20,0xfb,0xc3,0x20,0x06,0xc9,0x18,0x98,0x65,
+  0x7a,0x48,0xa5,0x7b,0x69,0x00,0x48,0xa5,0x3a,0x48,0xa5,0x39,0x48,0xa9,0xa4,0x20,
+  0xff,0xce,0x20,0x8d,0xcd,0x20,0x8a,0xcd,0xa5,0x66,0x09,0x7f,0x25,0x62,0x85,0x62,
+  0xa9,0x8b,0xa0,0xc7,0x85,0x22,0x84,0x23,0x4c,0x43,0xce,0xa9,0xbc,0xa0,0xd9,0x20,
+  0xa2,0xdb,0x20,0x79,0x00,0xc9,0xa9,0xd0,0x06,0x20,0x73,0x00,0x20,0x8a,0xcd,0x20,
+  0x2b,0xdc,0x20,0x38,0xce,0xa5,0x4a,0x48,0xa5,0x49,0x48,0xa9,0x81,0x48,0x20,0x2c,
+  0xc8,0xa5,0x7a,0xa4,0x7b,0xc0,0x02,0xea,0xf0,0x04,0x85,0x3d,0x84,0x3e,0xa0,0x00,
+  0xb1,0x7a,0xd0,0x43,0xa0,0x02,0xb1,0x7a,0x18,0xd0,0x03,0x4c,0x4b,0xc8,0xc8,0xb1,
+  0x7a,0x85,0x39,0xc8,0xb1,0x7a,0x85,0x3a,0x98,0x65,0x7a,0x85,0x7a,0x90,0x02,0xe6,
+  0x7b,0x6c,0x08,0x03,0x20,0x73,0x00,0x20,0xed,0xc7,0x4c,0xae,0xc7,0xf0,0x3c,0xe9,
+  0x80,0x90,0x11,0xc9,0x23,0xb0,0x17,0x0a,0xa8,0xb9,0x0d,0xc0,0x48,0xb9,0x0c,0xc0,
+  0x48,0x4c,0x73,0x00,0x4c,0xa5,0xc9,0xc9,0x3a,0xf0,0xd6,0x4c,0x08,0xcf,0xc9,0x4b,
+  0xd0,0xf9,0x20,0x73,0x00,0xa9,0xa4,0x20,0xff,0xce,0x4c,0xa0,0xc8,0x38,0xa5,0x2b,
+  0xe9,0x01,0xa4,0x2c,0xb0,0x01,0x88,0x85,0x41,0x84,0x42,0x60,0x20,0xe1,0xff,0xb0,
+  0x01,0x18,0xd0,0x3c,0xa5,0x7a,0xa4,0x7b,0xa6,0x3a,0xe8,0xf0,0x0c,0x85,0x3d,0x84,
+  0x3e,0xa5,0x39,0xa4,0x3a,0x85,0x3b,0x84,0x3c,0x68,0x68,0xa9,0x81,0xa0,0xc3,0x90,
+  0x03,0x4c,0x69,0xc4,0x4c,0x74,0xc4,0xd0,0x17,0xa2,0x1a,0xa4,0x3e,0xd0,0x03,0x4c,
+  0x37,0xc4,0xa5,0x3d,0x85,0x7a,0x84,0x7b,0xa5,0x3b,0xa4,0x3c,0x85,0x39,0x84,0x3a,
+  0x60,0x08,0xa9,0x00,0x20,0x90,0xff,0x28,0xd0,0x03,0x4c,0x59,0xc6,0x20,0x60,0xc6,
+  0x4c,0x97,0xc8,0xa9,0x03,0x20,0xfb,0xc3,0xa5,0x7b,0x48,0xa5,0x7a,0x48,0xa5,0x3a,
+  0x48,0xa5,0x39,0x48,0xa9,0x8d,0x48,0x20,0x79,0x00,0x20,0xa0,0xc8,0x4c,0xae,0xc7,
+  0x20,0x6b,0xc9,0x20,0x09,0xc9,0x38,0xa5,0x39,0xe5,0x14,0xa5,0x3a,0xe5,0x15,0xb0,
+  0x0b,0x98,0x38,0x65,0x7a,0xa6,0x7b,0x90,0x07,0xe8,0xb0,0x04,0xa5,0x2b,0xa6,0x2c,
+  0x20,0x17,0xc6,0x90,0x1e,0xa5,0x5f,0xe9,0x01,0x85,0x7a,0xa5,0x60,0xe9,0x00,0x85,
+  0x7b,0x60,0xd0,0xfd,0xa9,0xff,0x85,0x4a,0x20,0x8a,0xc3,0x9a,0xc9,0x8d,0xf0,0x0b,
+  0xa2,0x0c,0x2c,0xa2,0x11,0x4c,0x37,0xc4,0x4c,0x08,0xcf,0x68,0x68,0x85,0x39,0x68,
+  0x85,0x3a,0x68,0x85,0x7a,0x68,0x85,0x7b,0x20,0x06,0xc9,0x98,0x18,0x65,0x7a,0x85,
+  0x7a,0x90,0x02,0xe6,0x7b,0x60,0xa2,0x3a,0x2c,0xa2,0x00,0x86,0x07,0xa0,0x00,0x84,
+  0x08,0xa5,0x08,0xa6,0x07,0x85,0x07,0x86,0x08,0xb1,0x7a,0xf0,0xe8,0xc5,0x08,0xf0,
+  0xe4,0xc8,0xc9,0x22,0xd0,0xf3,0xf0,0xe9,0x20,0x9e,0xcd,0x20,0x79,0x00,0xc9,0x89,
+  0xf0,0x05,0xa9,0xa7,0x20,0xff,0xce,0xa5,0x61,0xd0,0x05,0x20,0x09,0xc9,0xf0,0xbb,
+  0x20,0x79,0x00,0xb0,0x03,0x4c,0xa0,0xc8,0x4c,0xed,0xc7,0x20,0x9e,0xd7,0x48,0xc9,
+  0x8d,0xf0,0x04,0xc9,0x89,0xd0,0x91,0xc6,0x65,0xd0,0x04,0x68,0x4c,0xef,0xc7,0x20,
+  0x73,0x00,0x20,0x6b,0xc9,0xc9,0x2c,0xf0,0xee,0x68,0x60,0xa2,0x00,0x86,0x14,0x86,
+  0x15,0xb0,0xf7,0xe9,0x2f,0x85,0x07,0xa5,0x15,0x85,0x22,0xc9,0x19,0xb0,0xd4,0xa5,
+  0x14,0x0a,0x26,0x22,0x0a,0x26,0x22,0x65,0x14,0x85,0x14,0xa5,0x22,0x65,0x15,0x85,
+  0x15,0x06,0x14,0x26,0x15,0xa5,0x14,0x65,0x07,0x85,0x14,0x90,0x02,0xe6,0x15,0x20,
+  0x73,0x00,0x4c,0x71,0xc9,0x20,0x8b,0xd0,0x85,0x49,0x84,0x4a,0xa9,0xb2,0x20,0xff,
+  0xce,0xa5,0x0e,0x48,0xa5,0x0d,0x48,0x20,0x9e,0xcd,0x68,0x2a,0x20,0x90,0xcd,0xd0,
+  0x18,0x68,0x10,0x12,0x20,0x1b,0xdc,0x20,0xbf,0xd1,0xa0,0x00,0xa5,0x64,0x91,0x49,
+  0xc8,0xa5,0x65,0x91,0x49,0x60,0x4c,0xd0,0xdb,0x68,0xa4,0x4a,0xc0,0xdf,0xd0,0x4c,
+  0x20,0xa6,0xd6,0xc9,0x06,0xd0,0x3d,0xa0,0x00,0x84,0x61,0x84,0x66,0x84,0x71,0x20,
+  0x1d,0xca,0x20,0xe2,0xda,0xe6,0x71,0xa4,0x71,0x20,0x1d,0xca,0x20,0x0c,0xdc,0xaa,
+  0xf0,0x05,0xe8,0x8a,0x20,0xed,0xda,0xa4,0x71,0xc8,0xc0,0x06,0xd0,0xdf,0x20,0xe2,
+  0xda,0x20,0x9b,0xdc,0xa6,0x64,0xa4,0x63,0xa5,0x65,0x4c,0xdb,0xff,0xb1,0x22,0x20,
+  0x80,0x00,0x90,0x03,0x4c,0x48,0xd2,0xe9,0x2f,0x4c,0x7e,0xdd,0xa0,0x02,0xb1,0x64,
+  0xc5,0x34,0x90,0x17,0xd0,0x07,0x88,0xb1,0x64,0xc5,0x33,0x90,0x0e,0xa4,0x65,0xc4,
+  0x2e,0x90,0x08,0xd0,0x0d,0xa5,0x64,0xc5,0x2d,0xb0,0x07,0xa5,0x64,0xa4,0x65,0x4c,
+  0x68,0xca,0xa0,0x00,0xb1,0x64,0x20,0x75,0xd4,0xa5,0x50,0xa4,0x51,0x85,0x6f,0x84,
+  0x70,0x20,0x7a,0xd6,0xa9,0x61,0xa0,0x00,0x85,0x50,0x84,0x51,0x20,0xdb,0xd6,0xa0,
+  0x00,0xb1,0x50,0x91,0x49,0xc8,0xb1,0x50,0x91,0x49,0xc8,0xb1,0x50,0x91,0x49,0x60,
+  0x20,0x86,0xca,0x4c,0xb5,0xcb,0x20,0x9e,0xd7,0xf0,0x05,0xa9,0x2c,0x20,0xff,0xce,
+  0x08,0x86,0x13,0x20,0x15,0xe1,0x28,0x4c,0xa0,0xca,0x20,0x21,0xcb,0x20,0x79,0x00,
+  0xf0,0x35,0xf0,0x43,0xc9,0xa3,0xf0,0x50,0xc9,0xa6,0x18,0xf0,0x4b,0xc9,0x2c,0xf0,
+  0x37,0xc9,0x3b,0xf0,0x5e,0x20,0x9e,0xcd,0x24,0x0d,0x30,0xde,0x20,0xdd,0xdd,0x20,
+  0x87,0xd4,0x20,0x21,0xcb,0x20,0x3b,0xcb,0xd0,0xd3,0xa9,0x00,0x9d,0x00,0x02,0xa2,
+  0xff,0xa0,0x01,0xa5,0x13,0xd0,0x10,0xa9,0x0d,0x20,0x47,0xcb,0x24,0x13,0x10,0x05,
+  0xa9,0x0a,0x20,0x47,0xcb,0x49,0xff,0x60,0x38,0x20,0xf0,0xff,0x98,0x38,0xe9,0x0b,
+  0xb0,0xfc,0x49,0xff,0x69,0x01,0xd0,0x16,0x08,0x38,0x20,0xf0,0xff,0x84,0x09,0x20,
+  0x9b,0xd7,0xc9,0x29,0xd0,0x59,0x28,0x90,0x06,0x8a,0xe5,0x09,0x90,0x05,0xaa,0xe8,
+  0xca,0xd0,0x06,0x20,0x73,0x00,0x4c,0xa2,0xca,0x20,0x3b,0xcb,0xd0,0xf2,0x20,0x87,
+  0xd4,0x20,0xa6,0xd6,0xaa,0xa0,0x00,0xe8,0xca,0xf0,0xbc,0xb1,0x22,0x20,0x47,0xcb,
+  0xc8,0xc9,0x0d,0xd0,0xf3,0x20,0xe5,0xca,0x4c,0x28,0xcb,0xa5,0x13,0xf0,0x03,0xa9,
+  0x20,0x2c,0xa9,0x1d,0x2c,0xa9,0x3f,0x20,0x09,0xe1,0x29,0xff,0x60,0xa5,0x11,0xf0,
+  0x11,0x30,0x04,0xa0,0xff,0xd0,0x04,0xa5,0x3f,0xa4,0x40,0x85,0x39,0x84,0x3a,0x4c,
+  0x08,0xcf,0xa5,0x13,0xf0,0x05,0xa2,0x18,0x4c,0x37,0xc4,0xa9,0x0c,0xa0,0xcd,0x20,
+  0x1e,0xcb,0xa5,0x3d,0xa4,0x3e,0x85,0x7a,0x84,0x7b,0x60,0x20,0xa6,0xd3,0xc9,0x23,
+  0xd0,0x10,0x20,0x73,0x00,0x20,0x9e,0xd7,0xa9,0x2c,0x20,0xff,0xce,0x86,0x13,0x20,
+  0x1b,0xe1,0xa2,0x01,0xa0,0x02,0xa9,0x00,0x8d,0x01,0x02,0xa9,0x40,0x20,0x0f,0xcc,
+  0xa6,0x13,0xd0,0x13,0x60,0x20,0x9e,0xd7,0xa9,0x2c,0x20,0xff,0xce,0x86,0x13,0x20,
+  0x1b,0xe1,0x20,0xce,0xcb,0xa5,0x13,0x20,0xcc,0xff,0xa2,0x00,0x86,0x13,0x60,0xc9,
+  0x22,0xd0,0x0b,0x20,0xbd,0xce,0xa9,0x3b,0x20,0xff,0xce,0x20,0x21,0xcb,0x20,0xa6,
+  0xd3,0xa9,0x2c,0x8d,0xff,0x01,0x20,0xf9,0xcb,0xa5,0x13,0xf0,0x0d,0x20,0xb7,0xff,
+  0x29,0x02,0xf0,0x06,0x20,0xb5,0xcb,0x4c,0xf8,0xc8,0xad,0x00,0x02,0xd0,0x1e,0xa5,
+  0x13,0xd0,0xe3,0x20,0x06,0xc9,0x4c,0xfb,0xc8,0xa5,0x13,0xd0,0x06,0x20,0x45,0xcb,
+  0x20,0x3b,0xcb,0x4c,0x60,0xc5,0xa6,0x41,0xa4,0x42,0xa9,0x98,0x2c,0xa9,0x00,0x85,
+  0x11,0x86,0x43,0x84,0x44,0x20,0x8b,0xd0,0x85,0x49,0x84,0x4a,0xa5,0x7a,0xa4,0x7b,
+  0x85,0x4b,0x84,0x4c,0xa6,0x43,0xa4,0x44,0x86,0x7a,0x84,0x7b,0x20,0x79,0x00,0xd0,
+  0x20,0x24,0x11,0x50,0x0c,0x20,0x21,0xe1,0x8d,0x00,0x02,0xa2,0xff,0xa0,0x01,0xd0,
+  0x0c,0x30,0x75,0xa5,0x13,0xd0,0x03,0x20,0x45,0xcb,0x20,0xf9,0xcb,0x86,0x7a,0x84,
+  0x7b,0x20,0x73,0x00,0x24,0x0d,0x10,0x31,0x24,0x11,0x50,0x09,0xe8,0x86,0x7a,0xa9,
+  0x00,0x85,0x07,0xf0,0x0c,0x85,0x07,0xc9,0x22,0xf0,0x07,0xa9,0x3a,0x85,0x07,0xa9,
+  0x2c,0x18,0x85,0x08,0xa5,0x7a,0xa4,0x7b,0x69,0x00,0x90,0x01,0xc8,0x20,0x8d,0xd4,
+  0x20,0xe2,0xd7,0x20,0xda,0xc9,0x4c,0x91,0xcc,0x20,0xf3,0xdc,0xa5,0x0e,0x20,0xc2,
+  0xc9,0x20,0x79,0x00,0xf0,0x07,0xc9,0x2c,0xf0,0x03,0x4c,0x4d,0xcb,0xa5,0x7a,0xa4,
+  0x7b,0x85,0x43,0x84,0x44,0xa5,0x4b,0xa4,0x4c,0x85,0x7a,0x84,0x7b,0x20,0x79,0x00,
+  0xf0,0x2d,0x20,0xfd,0xce,0x4c,0x15,0xcc,0x20,0x06,0xc9,0xc8,0xaa,0xd0,0x12,0xa2,
+  0x0d,0xc8,0xb1,0x7a,0xf0,0x6c,0xc8,0xb1,0x7a,0x85,0x3f,0xc8,0xb1,0x7a,0xc8,0x85,
+  0x40,0x20,0xfb,0xc8,0x20,0x79,0x00,0xaa,0xe0,0x83,0xd0,0xdc,0x4c,0x51,0xcc,0xa5,
+  0x43,0xa4,0x44,0xa6,0x11,0x10,0x03,0x4c,0x27,0xc8,0xa0,0x00,0xb1,0x43,0xf0,0x0b,
+  0xa5,0x13,0xd0,0x07,0xa9,0xfc,0xa0,0xcc,0x4c,0x1e,0xcb,0x60,0x3f,0x45,0x58,0x54,
+  0x52,0x41,0x20,0x49,0x47,0x4e,0x4f,0x52,0x45,0x44,0x0d,0x00,0x3f,0x52,0x45,0x44,
+  0x4f,0x20,0x46,0x52,0x4f,0x4d,0x20,0x53,0x54,0x41,0x52,0x54,0x0d,0x00,0xd0,0x04,
+  0xa0,0x00,0xf0,0x03,0x20,0x8b,0xd0,0x85,0x49,0x84,0x4a,0x20,0x8a,0xc3,0xf0,0x05,
+  0xa2,0x0a,0x4c,0x37,0xc4,0x9a,0x8a,0x18,0x69,0x04,0x48,0x69,0x06,0x85,0x24,0x68,
+  0xa0,0x01,0x20,0xa2,0xdb,0xba,0xbd,0x09,0x01,0x85,0x66,0xa5,0x49,0xa4,0x4a,0x20,
+  0x67,0xd8,0x20,0xd0,0xdb,0xa0,0x01,0x20,0x5d,0xdc,0xba,0x38,0xfd,0x09,0x01,0xf0,
+  0x17,0xbd,0x0f,0x01,0x85,0x39,0xbd,0x10,0x01,0x85,0x3a,0xbd,0x12,0x01,0x85,0x7a,
+  0xbd,0x11,0x01,0x85,0x7b,0x4c,0xae,0xc7,0x8a,0x69,0x11,0xaa,0x9a,0x20,0x79,0x00,
+  0xc9,0x2c,0xd0,0xf1,0x20,0x73,0x00,0x20,0x24,0xcd,0x20,0x9e,0xcd,0x18,0x24,0x38,
+  0x24,0x0d,0x30,0x03,0xb0,0x03,0x60,0xb0,0xfd,0xa2,0x16,0x4c,0x37,0xc4,0xa6,0x7a,
+  0xd0,0x02,0xc6,0x7b,0xc6,0x7a,0xa2,0x00,0x24,0x48,0x8a,0x48,0xa9,0x01,0x20,0xfb,
+  0xc3,0x20,0x83,0xce,0xa9,0x00,0x85,0x4d,0x20,0x79,0x00,0x38,0xe9,0xb1,0x90,0x17,
+  0xc9,0x03,0xb0,0x13,0xc9,0x01,0x2a,0x49,0x01,0x45,0x4d,0xc5,0x4d,0x90,0x61,0x85,
+  0x4d,0x20,0x73,0x00,0x4c,0xbb,0xcd,0xa6,0x4d,0xd0,0x2c,0xb0,0x7b,0x69,0x07,0x90,
+  0x77,0x65,0x0d,0xd0,0x03,0x4c,0x3d,0xd6,0x69,0xff,0x85,0x22,0x0a,0x65,0x22,0xa8,
+  0x68,0xd9,0x80,0xc0,0xb0,0x67,0x20,0x8d,0xcd,0x48,0x20,0x20,0xce,0x68,0xa4,0x4b,
+  0x10,0x17,0xaa,0xf0,0x56,0xd0,0x5f,0x46,0x0d,0x8a,0x2a,0xa6,0x7a,0xd0,0x02,0xc6,
+  0x7b,0xc6,0x7a,0xa0,0x1b,0x85,0x4d,0xd0,0xd7,0xd9,0x80,0xc0,0xb0,0x48,0x90,0xd9,
+  0xb9,0x82,0xc0,0x48,0xb9,0x81,0xc0,0x48,0x20,0x33,0xce,0xa5,0x4d,0x4c,0xa9,0xcd,
+  0x4c,0x08,0xcf,0xa5,0x66,0xbe,0x80,0xc0,0xa8,0x68,0x85,0x22,0xe6,0x22,0x68,0x85,
+  0x23,0x98,0x48,0x20,0x1b,0xdc,0xa5,0x65,0x48,0xa5,0x64,0x48,0xa5,0x63,0x48,0xa5,
+  0x62,0x48,0xa5,0x61,0x48,0x6c,0x22,0x00,0xa0,0xff,0x68,0xf0,0x23,0xc9,0x64,0xf0,
+  0x03,0x20,0x8d,0xcd,0x84,0x4b,0x68,0x4a,0x85,0x12,0x68,0x85,0x69,0x68,0x85,0x6a,
+  0x68,0x85,0x6b,0x68,0x85,0x6c,0x68,0x85,0x6d,0x68,0x85,0x6e,0x45,0x66,0x85,0x6f,
+  0xa5,0x61,0x60,0x6c,0x0a,0x03,0xa9,0x00,0x85,0x0d,0x20,0x73,0x00,0xb0,0x03,0x4c,
+  0xf3,0xdc,0x20,0x13,0xd1,0x90,0x03,0x4c,0x28,0xcf,0xc9,0xff,0xd0,0x0f,0xa9,0xa8,
+  0xa0,0xce,0x20,0xa2,0xdb,0x4c,0x73,0x00,0x82,0x49,0x0f,0xda,0xa1,0xc9,0x2e,0xf0,
+  0xde,0xc9,0xab,0xf0,0x58,0xc9,0xaa,0xf0,0xd1,0xc9,0x22,0xd0,0x0f,0xa5,0x7a,0xa4,
+  0x7b,0x69,0x00,0x90,0x01,0xc8,0x20,0x87,0xd4,0x4c,0xe2,0xd7,0xc9,0xa8,0xd0,0x13,
+  0xa0,0x18,0xd0,0x3b,0x20,0xbf,0xd1,0xa5,0x65,0x49,0xff,0xa8,0xa5,0x64,0x49,0xff,
+  0x4c,0x91,0xd3,0xc9,0xa5,0xd0,0x03,0x4c,0xf4,0xd3,0xc9,0xb4,0x90,0x03,0x4c,0xa7,
+  0xcf,0x20,0xfa,0xce,0x20,0x9e,0xcd,0xa9,0x29,0x2c,0xa9,0x28,0x2c,0xa9,0x2c,0xa0,
+  0x00,0xd1,0x7a,0xd0,0x03,0x4c,0x73,0x00,0xa2,0x0b,0x4c,0x37,0xc4,0xa0,0x15,0x68,
+  0x68,0x4c,0xfa,0xcd,0x38,0xa5,0x64,0xe9,0x00,0xa5,0x65,0xe9,0xc0,0x90,0x08,0xa9,
+  0x87,0xe5,0x64,0xa9,0xe3,0xe5,0x65,0x60,0x20,0x8b,0xd0,0x85,0x64,0x84,0x65,0xa6,
+  0x45,0xa4,0x46,0xa5,0x0d,0xf0,0x26,0xa9,0x00,0x85,0x70,0x20,0x14,0xcf,0x90,0x1c,
+  0xe0,0x54,0xd0,0x18,0xc0,0xc9,0xd0,0x14,0x20,0x84,0xcf,0x84,0x5e,0x88,0x84,0x71,
+  0xa0,0x06,0x84,0x5d,0xa0,0x24,0x20,0x68,0xde,0x4c,0x6f,0xd4,0x60,0x24,0x0e,0x10,
+  0x0d,0xa0,0x00,0xb1,0x64,0xaa,0xc8,0xb1,0x64,0xa8,0x8a,0x4c,0x91,0xd3,0x20,0x14,
+  0xcf,0x90,0x2d,0xe0,0x54,0xd0,0x1b,0xc0,0x49,0xd0,0x25,0x20,0x84,0xcf,0x98,0xa2,
+  0xa0,0x4c,0x4f,0xdc,0x20,0xde,0xff,0x86,0x64,0x84,0x63,0x85,0x65,0xa0,0x00,0x84,
+  0x62,0x60,0xe0,0x53,0xd0,0x0a,0xc0,0x54,0xd0,0x06,0x20,0xb7,0xff,0x4c,0x3c,0xdc,
+  0xa5,0x64,0xa4,0x65,0x4c,0xa2,0xdb,0x0a,0x48,0xaa,0x20,0x73,0x00,0xe0,0x8f,0x90,
+  0x20,0x20,0xfa,0xce,0x20,0x9e,0xcd,0x20,0xfd,0xce,0x20,0x8f,0xcd,0x68,0xaa,0xa5,
+  0x65,0x48,0xa5,0x64,0x48,0x8a,0x48,0x20,0x9e,0xd7,0x68,0xa8,0x8a,0x48,0x4c,0xd6,
+  0xcf,0x20,0xf1,0xce,0x68,0xa8,0xb9,0xea,0xbf,0x85,0x55,0xb9,0xeb,0xbf,0x85,0x56,
+  0x20,0x54,0x00,0x4c,0x8d,0xcd,0xa0,0xff,0x2c,0xa0,0x00,0x84,0x0b,0x20,0xbf,0xd1,
+  0xa5,0x64,0x45,0x0b,0x85,0x07,0xa5,0x65,0x45,0x0b,0x85,0x08,0x20,0xfc,0xdb,0x20,
+  0xbf,0xd1,0xa5,0x65,0x45,0x0b,0x25,0x08,0x45,0x0b,0xa8,0xa5,0x64,0x45,0x0b,0x25,
+  0x07,0x45,0x0b,0x4c,0x91,0xd3,0x20,0x90,0xcd,0xb0,0x13,0xa5,0x6e,0x09,0x7f,0x25,
+  0x6a,0x85,0x6a,0xa9,0x69,0xa0,0x00,0x20,0x5b,0xdc,0xaa,0x4c,0x61,0xd0,0xa9,0x00,
+  0x85,0x0d,0xc6,0x4d,0x20,0xa6,0xd6,0x85,0x61,0x86,0x62,0x84,0x63,0xa5,0x6c,0xa4,
+  0x6d,0x20,0xaa,0xd6,0x86,0x6c,0x84,0x6d,0xaa,0x38,0xe5,0x61,0xf0,0x08,0xa9,0x01,
+  0x90,0x04,0xa6,0x61,0xa9,0xff,0x85,0x66,0xa0,0xff,0xe8,0xc8,0xca,0xd0,0x07,0xa6,
+  0x66,0x30,0x0f,0x18,0x90,0x0c,0xb1,0x6c,0xd1,0x62,0xf0,0xef,0xa2,0xff,0xb0,0x02,
+  0xa2,0x01,0xe8,0x8a,0x2a,0x25,0x12,0xf0,0x02,0xa9,0xff,0x4c,0x3c,0xdc,0x20,0xfd,
+  0xce,0xaa,0x20,0x90,0xd0,0x20,0x79,0x00,0xd0,0xf4,0x60,0xa2,0x00,0x20,0x79,0x00,
+  0x86,0x0c,0x85,0x45,0x20,0x79,0x00,0x20,0x13,0xd1,0xb0,0x03,0x4c,0x08,0xcf,0xa2,
+  0x00,0x86,0x0d,0x86,0x0e,0x20,0x73,0x00,0x90,0x05,0x20,0x13,0xd1,0x90,0x0b,0xaa,
+  0x20,0x73,0x00,0x90,0xfb,0x20,0x13,0xd1,0xb0,0xf6,0xc9,0x24,0xd0,0x06,0xa9,0xff,
+  0x85,0x0d,0xd0,0x10,0xc9,0x25,0xd0,0x13,0xa5,0x10,0xd0,0xd0,0xa9,0x80,0x85,0x0e,
+  0x05,0x45,0x85,0x45,0x8a,0x09,0x80,0xaa,0x20,0x73,0x00,0x86,0x46,0x38,0x05,0x10,
+  0xe9,0x28,0xd0,0x03,0x4c,0xd1,0xd1,0xa0,0x00,0x84,0x10,0xa5,0x2d,0xa6,0x2e,0x86,
+  0x60,0x85,0x5f,0xe4,0x30,0xd0,0x04,0xc5,0x2f,0xf0,0x22,0xa5,0x45,0xd1,0x5f,0xd0,
+  0x08,0xa5,0x46,0xc8,0xd1,0x5f,0xf0,0x7d,0x88,0x18,0xa5,0x5f,0x69,0x07,0x90,0xe1,
+  0xe8,0xd0,0xdc,0xc9,0x41,0x90,0x05,0xe9,0x5b,0x38,0xe9,0xa5,0x60,0x68,0x48,0xc9,
+  0x2a,0xd0,0x05,0xa9,0x13,0xa0,0xdf,0x60,0xa5,0x45,0xa4,0x46,0xc9,0x54,0xd0,0x0b,
+  0xc0,0xc9,0xf0,0xef,0xc0,0x49,0xd0,0x03,0x4c,0x08,0xcf,0xc9,0x53,0xd0,0x04,0xc0,
+  0x54,0xf0,0xf5,0xa5,0x2f,0xa4,0x30,0x85,0x5f,0x84,0x60,0xa5,0x31,0xa4,0x32,0x85,
+  0x5a,0x84,0x5b,0x18,0x69,0x07,0x90,0x01,0xc8,0x85,0x58,0x84,0x59,0x20,0xb8,0xc3,
+  0xa5,0x58,0xa4,0x59,0xc8,0x85,0x2f,0x84,0x30,0xa0,0x00,0xa5,0x45,0x91,0x5f,0xc8,
+  0xa5,0x46,0x91,0x5f,0xa9,0x00,0xc8,0x91,0x5f,0xc8,0x91,0x5f,0xc8,0x91,0x5f,0xc8,
+  0x91,0x5f,0xc8,0x91,0x5f,0xa5,0x5f,0x18,0x69,0x02,0xa4,0x60,0x90,0x01,0xc8,0x85,
+  0x47,0x84,0x48,0x60,0xa5,0x0b,0x0a,0x69,0x05,0x65,0x5f,0xa4,0x60,0x90,0x01,0xc8,
+  0x85,0x58,0x84,0x59,0x60,0x90,0x80,0x00,0x00,0x00,0x20,0xbf,0xd1,0xa5,0x64,0xa4,
+  0x65,0x60,0x20,0x73,0x00,0x20,0x9e,0xcd,0x20,0x8d,0xcd,0xa5,0x66,0x30,0x0d,0xa5,
+  0x61,0xc9,0x90,0x90,0x09,0xa9,0xa5,0xa0,0xd1,0x20,0x5b,0xdc,0xd0,0x7a,0x4c,0x9b,
+  0xdc,0xa5,0x0c,0x05,0x0e,0x48,0xa5,0x0d,0x48,0xa0,0x00,0x98,0x48,0xa5,0x46,0x48,
+  0xa5,0x45,0x48,0x20,0xb2,0xd1,0x68,0x85,0x45,0x68,0x85,0x46,0x68,0xa8,0xba,0xbd,
+  0x02,0x01,0x48,0xbd,0x01,0x01,0x48,0xa5,0x64,0x9d,0x02,0x01,0xa5,0x65,0x9d,0x01,
+  0x01,0xc8,0x20,0x79,0x00,0xc9,0x2c,0xf0,0xd2,0x84,0x0b,0x20,0xf7,0xce,0x68,0x85,
+  0x0d,0x68,0x85,0x0e,0x29,0x7f,0x85,0x0c,0xa6,0x2f,0xa5,0x30,0x86,0x5f,0x85,0x60,
+  0xc5,0x32,0xd0,0x04,0xe4,0x31,0xf0,0x39,0xa0,0x00,0xb1,0x5f,0xc8,0xc5,0x45,0xd0,
+  0x06,0xa5,0x46,0xd1,0x5f,0xf0,0x16,0xc8,0xb1,0x5f,0x18,0x65,0x5f,0xaa,0xc8,0xb1,
+  0x5f,0x65,0x60,0x90,0xd7,0xa2,0x12,0x2c,0xa2,0x0e,0x4c,0x37,0xc4,0xa2,0x13,0xa5,
+  0x0c,0xd0,0xf7,0x20,0x94,0xd1,0xa5,0x0b,0xa0,0x04,0xd1,0x5f,0xd0,0xe7,0x4c,0xea,
+  0xd2,0x20,0x94,0xd1,0x20,0x08,0xc4,0xa0,0x00,0x84,0x72,0xa2,0x05,0xa5,0x45,0x91,
+  0x5f,0x10,0x01,0xca,0xc8,0xa5,0x46,0x91,0x5f,0x10,0x02,0xca,0xca,0x86,0x71,0xa5,
+  0x0b,0xc8,0xc8,0xc8,0x91,0x5f,0xa2,0x0b,0xa9,0x00,0x24,0x0c,0x50,0x08,0x68,0x18,
+  0x69,0x01,0xaa,0x68,0x69,0x00,0xc8,0x91,0x5f,0xc8,0x8a,0x91,0x5f,0x20,0x4c,0xd3,
+  0x86,0x71,0x85,0x72,0xa4,0x22,0xc6,0x0b,0xd0,0xdc,0x65,0x59,0xb0,0x5d,0x85,0x59,
+  0xa8,0x8a,0x65,0x58,0x90,0x03,0xc8,0xf0,0x52,0x20,0x08,0xc4,0x85,0x31,0x84,0x32,
+  0xa9,0x00,0xe6,0x72,0xa4,0x71,0xf0,0x05,0x88,0x91,0x58,0xd0,0xfb,0xc6,0x59,0xc6,
+  0x72,0xd0,0xf5,0xe6,0x59,0x38,0xa5,0x31,0xe5,0x5f,0xa0,0x02,0x91,0x5f,0xa5,0x32,
+  0xc8,0xe5,0x60,0x91,0x5f,0xa5,0x0c,0xd0,0x62,0xc8,0xb1,0x5f,0x85,0x0b,0xa9,0x00,
+  0x85,0x71,0x85,0x72,0xc8,0x68,0xaa,0x85,0x64,0x68,0x85,0x65,0xd1,0x5f,0x90,0x0e,
+  0xd0,0x06,0xc8,0x8a,0xd1,0x5f,0x90,0x07,0x4c,0x45,0xd2,0x4c,0x35,0xc4,0xc8,0xa5,
+  0x72,0x05,0x71,0x18,0xf0,0x0a,0x20,0x4c,0xd3,0x8a,0x65,0x64,0xaa,0x98,0xa4,0x22,
+  0x65,0x65,0x86,0x71,0xc6,0x0b,0xd0,0xca,0x85,0x72,0xa2,0x05,0xa5,0x45,0x10,0x01,
+  0xca,0xa5,0x46,0x10,0x02,0xca,0xca,0x86,0x28,0xa9,0x00,0x20,0x55,0xd3,0x8a,0x65,
+  0x58,0x85,0x47,0x98,0x65,0x59,0x85,0x48,0xa8,0xa5,0x47,0x60,0x84,0x22,0xb1,0x5f,
+  0x85,0x28,0x88,0xb1,0x5f,0x85,0x29,0xa9,0x10,0x85,0x5d,0xa2,0x00,0xa0,0x00,0x8a,
+  0x0a,0xaa,0x98,0x2a,0xa8,0xb0,0xa4,0x06,0x71,0x26,0x72,0x90,0x0b,0x18,0x8a,0x65,
+  0x28,0xaa,0x98,0x65,0x29,0xa8,0xb0,0x93,0xc6,0x5d,0xd0,0xe3,0x60,0xa5,0x0d,0xf0,
+  0x03,0x20,0xa6,0xd6,0x20,0x26,0xd5,0x38,0xa5,0x33,0xe5,0x31,0xa8,0xa5,0x34,0xe5,
+  0x32,0xa2,0x00,0x86,0x0d,0x85,0x62,0x84,0x63,0xa2,0x90,0x4c,0x44,0xdc,0x38,0x20,
+  0xf0,0xff,0xa9,0x00,0xf0,0xeb,0xa6,0x3a,0xe8,0xd0,0xa0,0xa2,0x15,0x2c,0xa2,0x1b,
+  0x4c,0x37,0xc4,0x20,0xe1,0xd3,0x20,0xa6,0xd3,0x20,0xfa,0xce,0xa9,0x80,0x85,0x10,
+  0x20,0x8b,0xd0,0x20,0x8d,0xcd,0x20,0xf7,0xce,0xa9,0xb2,0x20,0xff,0xce,0x48,0xa5,
+  0x48,0x48,0xa5,0x47,0x48,0xa5,0x7b,0x48,0xa5,0x7a,0x48,0x20,0xf8,0xc8,0x4c,0x4f,
+  0xd4,0xa9,0xa5,0x20,0xff,0xce,0x09,0x80,0x85,0x10,0x20,0x92,0xd0,0x85,0x4e,0x84,
+  0x4f,0x4c,0x8d,0xcd,0x20,0xe1,0xd3,0xa5,0x4f,0x48,0xa5,0x4e,0x48,0x20,0xf1,0xce,
+  0x20,0x8d,0xcd,0x68,0x85,0x4e,0x68,0x85,0x4f,0xa0,0x02,0xb1,0x4e,0x85,0x47,0xaa,
+  0xc8,0xb1,0x4e,0xf0,0x99,0x85,0x48,0xc8,0xb1,0x47,0x48,0x88,0x10,0xfa,0xa4,0x48,
+  0x20,0xd4,0xdb,0xa5,0x7b,0x48,0xa5,0x7a,0x48,0xb1,0x4e,0x85,0x7a,0xc8,0xb1,0x4e,
+  0x85,0x7b,0xa5,0x48,0x48,0xa5,0x47,0x48,0x20,0x8a,0xcd,0x68,0x85,0x4e,0x68,0x85,
+  0x4f,0x20,0x79,0x00,0xf0,0x03,0x4c,0x08,0xcf,0x68,0x85,0x7a,0x68,0x85,0x7b,0xa0,
+  0x00,0x68,0x91,0x4e,0x68,0xc8,0x91,0x4e,0x68,0xc8,0x91,0x4e,0x68,0xc8,0x91,0x4e,
+  0x68,0xc8,0x91,0x4e,0x60,0x20,0x8d,0xcd,0xa0,0x00,0x20,0xdf,0xdd,0x68,0x68,0xa9,
+  0xff,0xa0,0x00,0xf0,0x12,0xa6,0x64,0xa4,0x65,0x86,0x50,0x84,0x51,0x20,0xf4,0xd4,
+  0x86,0x62,0x84,0x63,0x85,0x61,0x60,0xa2,0x22,0x86,0x07,0x86,0x08,0x85,0x6f,0x84,
+  0x70,0x85,0x62,0x84,0x63,0xa0,0xff,0xc8,0xb1,0x6f,0xf0,0x0c,0xc5,0x07,0xf0,0x04,
+  0xc5,0x08,0xd0,0xf3,0xc9,0x22,0xf0,0x01,0x18,0x84,0x61,0x98,0x65,0x6f,0x85,0x71,
+  0xa6,0x70,0x90,0x01,0xe8,0x86,0x72,0xa5,0x70,0xf0,0x04,0xc9,0x02,0xd0,0x0b,0x98,
+  0x20,0x75,0xd4,0xa6,0x6f,0xa4,0x70,0x20,0x88,0xd6,0xa6,0x16,0xe0,0x22,0xd0,0x05,
+  0xa2,0x19,0x4c,0x37,0xc4,0xa5,0x61,0x95,0x00,0xa5,0x62,0x95,0x01,0xa5,0x63,0x95,
+  0x02,0xa0,0x00,0x86,0x64,0x84,0x65,0x84,0x70,0x88,0x84,0x0d,0x86,0x17,0xe8,0xe8,
+  0xe8,0x86,0x16,0x60,0x46,0x0f,0x48,0x49,0xff,0x38,0x65,0x33,0xa4,0x34,0xb0,0x01,
+  0x88,0xc4,0x32,0x90,0x11,0xd0,0x04,0xc5,0x31,0x90,0x0b,0x85,0x33,0x84,0x34,0x85,
+  0x35,0x84,0x36,0xaa,0x68,0x60,0xa2,0x10,0xa5,0x0f,0x30,0xb6,0x20,0x26,0xd5,0xa9,
+  0x80,0x85,0x0f,0x68,0xd0,0xd0,0xa6,0x37,0xa5,0x38,0x86,0x33,0x85,0x34,0xa0,0x00,
+  0x84,0x4f,0x84,0x4e,0xa5,0x31,0xa6,0x32,0x85,0x5f,0x86,0x60,0xa9,0x19,0xa2,0x00,
+  0x85,0x22,0x86,0x23,0xc5,0x16,0xf0,0x05,0x20,0xc7,0xd5,0xf0,0xf7,0xa9,0x07,0x85,
+  0x53,0xa5,0x2d,0xa6,0x2e,0x85,0x22,0x86,0x23,0xe4,0x30,0xd0,0x04,0xc5,0x2f,0xf0,
+  0x05,0x20,0xbd,0xd5,0xf0,0xf3,0x85,0x58,0x86,0x59,0xa9,0x03,0x85,0x53,0xa5,0x58,
+  0xa6,0x59,0xe4,0x32,0xd0,0x07,0xc5,0x31,0xd0,0x03,0x4c,0x06,0xd6,0x85,0x22,0x86,
+  0x23,0xa0,0x00,0xb1,0x22,0xaa,0xc8,0xb1,0x22,0x08,0xc8,0xb1,0x22,0x65,0x58,0x85,
+  0x58,0xc8,0xb1,0x22,0x65,0x59,0x85,0x59,0x28,0x10,0xd3,0x8a,0x30,0xd0,0xc8,0xb1,
+  0x22,0xa0,0x00,0x0a,0x69,0x05,0x65,0x22,0x85,0x22,0x90,0x02,0xe6,0x23,0xa6,0x23,
+  0xe4,0x59,0xd0,0x04,0xc5,0x58,0xf0,0xba,0x20,0xc7,0xd5,0xf0,0xf3,0xb1,0x22,0x30,
+  0x35,0xc8,0xb1,0x22,0x10,0x30,0xc8,0xb1,0x22,0xf0,0x2b,0xc8,0xb1,0x22,0xaa,0xc8,
+  0xb1,0x22,0xc5,0x34,0x90,0x06,0xd0,0x1e,0xe4,0x33,0xb0,0x1a,0xc5,0x60,0x90,0x16,
+  0xd0,0x04,0xe4,0x5f,0x90,0x10,0x86,0x5f,0x85,0x60,0xa5,0x22,0xa6,0x23,0x85,0x4e,
+  0x86,0x4f,0xa5,0x53,0x85,0x55,0xa5,0x53,0x18,0x65,0x22,0x85,0x22,0x90,0x02,0xe6,
+  0x23,0xa6,0x23,0xa0,0x00,0x60,0xa5,0x4f,0x05,0x4e,0xf0,0xf5,0xa5,0x55,0x29,0x04,
+  0x4a,0xa8,0x85,0x55,0xb1,0x4e,0x65,0x5f,0x85,0x5a,0xa5,0x60,0x69,0x00,0x85,0x5b,
+  0xa5,0x33,0xa6,0x34,0x85,0x58,0x86,0x59,0x20,0xbf,0xc3,0xa4,0x55,0xc8,0xa5,0x58,
+  0x91,0x4e,0xaa,0xe6,0x59,0xa5,0x59,0xc8,0x91,0x4e,0x4c,0x2a,0xd5,0xa5,0x65,0x48,
+  0xa5,0x64,0x48,0x20,0x83,0xce,0x20,0x8f,0xcd,0x68,0x85,0x6f,0x68,0x85,0x70,0xa0,
+  0x00,0xb1,0x6f,0x18,0x71,0x64,0x90,0x05,0xa2,0x17,0x4c,0x37,0xc4,0x20,0x75,0xd4,
+  0x20,0x7a,0xd6,0xa5,0x50,0xa4,0x51,0x20,0xaa,0xd6,0x20,0x8c,0xd6,0xa5,0x6f,0xa4,
+  0x70,0x20,0xaa,0xd6,0x20,0xca,0xd4,0x4c,0xb8,0xcd,0xa0,0x00,0xb1,0x6f,0x48,0xc8,
+  0xb1,0x6f,0xaa,0xc8,0xb1,0x6f,0xa8,0x68,0x86,0x22,0x84,0x23,0xa8,0xf0,0x0a,0x48,
+  0x88,0xb1,0x22,0x91,0x35,0x98,0xd0,0xf8,0x68,0x18,0x65,0x35,0x85,0x35,0x90,0x02,
+  0xe6,0x36,0x60,0x20,0x8f,0xcd,0xa5,0x64,0xa4,0x65,0x85,0x22,0x84,0x23,0x20,0xdb,
+  0xd6,0x08,0xa0,0x00,0xb1,0x22,0x48,0xc8,0xb1,0x22,0xaa,0xc8,0xb1,0x22,0xa8,0x68,
+  0x28,0xd0,0x13,0xc4,0x34,0xd0,0x0f,0xe4,0x33,0xd0,0x0b,0x48,0x18,0x65,0x33,0x85,
+  0x33,0x90,0x02,0xe6,0x34,0x68,0x86,0x22,0x84,0x23,0x60,0xc4,0x18,0xd0,0x0c,0xc5,
+  0x17,0xd0,0x08,0x85,0x16,0xe9,0x03,0x85,0x17,0xa0,0x00,0x60,0x20,0xa1,0xd7,0x8a,
+  0x48,0xa9,0x01,0x20,0x7d,0xd4,0x68,0xa0,0x00,0x91,0x62,0x68,0x68,0x4c,0xca,0xd4,
+  0x20,0x61,0xd7,0xd1,0x50,0x98,0x90,0x04,0xb1,0x50,0xaa,0x98,0x48,0x8a,0x48,0x20,
+  0x7d,0xd4,0xa5,0x50,0xa4,0x51,0x20,0xaa,0xd6,0x68,0xa8,0x68,0x18,0x65,0x22,0x85,
+  0x22,0x90,0x02,0xe6,0x23,0x98,0x20,0x8c,0xd6,0x4c,0xca,0xd4,0x20,0x61,0xd7,0x18,
+  0xf1,0x50,0x49,0xff,0x4c,0x06,0xd7,0xa9,0xff,0x85,0x65,0x20,0x79,0x00,0xc9,0x29,
+  0xf0,0x06,0x20,0xfd,0xce,0x20,0x9e,0xd7,0x20,0x61,0xd7,0xf0,0x4b,0xca,0x8a,0x48,
+  0x18,0xa2,0x00,0xf1,0x50,0xb0,0xb6,0x49,0xff,0xc5,0x65,0x90,0xb1,0xa5,0x65,0xb0,
+  0xad,0x20,0xf7,0xce,0x68,0xa8,0x68,0x85,0x55,0x68,0x68,0x68,0xaa,0x68,0x85,0x50,
+  0x68,0x85,0x51,0xa5,0x55,0x48,0x98,0x48,0xa0,0x00,0x8a,0x60,0x20,0x82,0xd7,0x4c,
+  0xa2,0xd3,0x20,0xa3,0xd6,0xa2,0x00,0x86,0x0d,0xa8,0x60,0x20,0x82,0xd7,0xf0,0x08,
+  0xa0,0x00,0xb1,0x22,0xa8,0x4c,0xa2,0xd3,0x4c,0x48,0xd2,0x20,0x73,0x00,0x20,0x8a,
+  0xcd,0x20,0xb8,0xd1,0xa6,0x64,0xd0,0xf0,0xa6,0x65,0x4c,0x79,0x00,0x20,0x82,0xd7,
+  0xd0,0x03,0x4c,0xf7,0xd8,0xa6,0x7a,0xa4,0x7b,0x86,0x71,0x84,0x72,0xa6,0x22,0x86,
+  0x7a,0x18,0x65,0x22,0x85,0x24,0xa6,0x23,0x86,0x7b,0x90,0x01,0xe8,0x86,0x25,0xa0,
+  0x00,0xb1,0x24,0x48,0x98,0x91,0x24,0x20,0x79,0x00,0x20,0xf3,0xdc,0x68,0xa0,0x00,
+  0x91,0x24,0xa6,0x71,0xa4,0x72,0x86,0x7a,0x84,0x7b,0x60,0x20,0x8a,0xcd,0x20,0xf7,
+  0xd7,0x20,0xfd,0xce,0x4c,0x9e,0xd7,0xa5,0x66,0x30,0x9d,0xa5,0x61,0xc9,0x91,0xb0,
+  0x97,0x20,0x9b,0xdc,0xa5,0x64,0xa4,0x65,0x84,0x14,0x85,0x15,0x60,0xa5,0x15,0x48,
+  0xa5,0x14,0x48,0x20,0xf7,0xd7,0xa0,0x00,0xb1,0x14,0xa8,0x68,0x85,0x14,0x68,0x85,
+  0x15,0x4c,0xa2,0xd3,0x20,0xeb,0xd7,0x8a,0xa0,0x00,0x91,0x14,0x60,0x20,0xeb,0xd7,
+  0x86,0x49,0xa2,0x00,0x20,0x79,0x00,0xf0,0x03,0x20,0xf1,0xd7,0x86,0x4a,0xa0,0x00,
+  0xb1,0x14,0x45,0x4a,0x25,0x49,0xf0,0xf8,0x60,0xa9,0x11,0xa0,0xdf,0x4c,0x67,0xd8,
+  0x20,0x8c,0xda,0xa5,0x66,0x49,0xff,0x85,0x66,0x45,0x6e,0x85,0x6f,0xa5,0x61,0x4c,
+  0x6a,0xd8,0x20,0x99,0xd9,0x90,0x3c,0x20,0x8c,0xda,0xd0,0x03,0x4c,0xfc,0xdb,0xa6,
+  0x70,0x86,0x56,0xa2,0x69,0xa5,0x69,0xa8,0xf0,0xce,0x38,0xe5,0x61,0xf0,0x24,0x90,
+  0x12,0x84,0x61,0xa4,0x6e,0x84,0x66,0x49,0xff,0x69,0x00,0xa0,0x00,0x84,0x56,0xa2,
+  0x61,0xd0,0x04,0xa0,0x00,0x84,0x70,0xc9,0xf9,0x30,0xc7,0xa8,0xa5,0x70,0x56,0x01,
+  0x20,0xb0,0xd9,0x24,0x6f,0x10,0x57,0xa0,0x61,0xe0,0x69,0xf0,0x02,0xa0,0x69,0x38,
+  0x49,0xff,0x65,0x56,0x85,0x70,0xb9,0x04,0x00,0xf5,0x04,0x85,0x65,0xb9,0x03,0x00,
+  0xf5,0x03,0x85,0x64,0xb9,0x02,0x00,0xf5,0x02,0x85,0x63,0xb9,0x01,0x00,0xf5,0x01,
+  0x85,0x62,0xb0,0x03,0x20,0x47,0xd9,0xa0,0x00,0x98,0x18,0xa6,0x62,0xd0,0x4a,0xa6,
+  0x63,0x86,0x62,0xa6,0x64,0x86,0x63,0xa6,0x65,0x86,0x64,0xa6,0x70,0x86,0x65,0x84,
+  0x70,0x69,0x08,0xc9,0x20,0xd0,0xe4,0xa9,0x00,0x85,0x61,0x85,0x66,0x60,0x65,0x56,
+  0x85,0x70,0xa5,0x65,0x65,0x6d,0x85,0x65,0xa5,0x64,0x65,0x6c,0x85,0x64,0xa5,0x63,
+  0x65,0x6b,0x85,0x63,0xa5,0x62,0x65,0x6a,0x85,0x62,0x4c,0x36,0xd9,0x69,0x01,0x06,
+  0x70,0x26,0x65,0x26,0x64,0x26,0x63,0x26,0x62,0x10,0xf2,0x38,0xe5,0x61,0xb0,0xc7,
+  0x49,0xff,0x69,0x01,0x85,0x61,0x90,0x0e,0xe6,0x61,0xf0,0x42,0x66,0x62,0x66,0x63,
+  0x66,0x64,0x66,0x65,0x66,0x70,0x60,0xa5,0x66,0x49,0xff,0x85,0x66,0xa5,0x62,0x49,
+  0xff,0x85,0x62,0xa5,0x63,0x49,0xff,0x85,0x63,0xa5,0x64,0x49,0xff,0x85,0x64,0xa5,
+  0x65,0x49,0xff,0x85,0x65,0xa5,0x70,0x49,0xff,0x85,0x70,0xe6,0x70,0xd0,0x0e,0xe6,
+  0x65,0xd0,0x0a,0xe6,0x64,0xd0,0x06,0xe6,0x63,0xd0,0x02,0xe6,0x62,0x60,0xa2,0x0f,
+  0x4c,0x37,0xc4,0xa2,0x25,0xb4,0x04,0x84,0x70,0xb4,0x03,0x94,0x04,0xb4,0x02,0x94,
+  0x03,0xb4,0x01,0x94,0x02,0xa4,0x68,0x94,0x01,0x69,0x08,0x30,0xe8,0xf0,0xe6,0xe9,
+  0x08,0xa8,0xa5,0x70,0xb0,0x14,0x16,0x01,0x90,0x02,0xf6,0x01,0x76,0x01,0x76,0x01,
+  0x76,0x02,0x76,0x03,0x76,0x04,0x6a,0xc8,0xd0,0xec,0x18,0x60,0x81,0x00,0x00,0x00,
+  0x00,0x03,0x7f,0x5e,0x56,0xcb,0x79,0x80,0x13,0x9b,0x0b,0x64,0x80,0x76,0x38,0x93,
+  0x16,0x82,0x38,0xaa,0x3b,0x20,0x80,0x35,0x04,0xf3,0x34,0x81,0x35,0x04,0xf3,0x34,
+  0x80,0x80,0x00,0x00,0x00,0x80,0x31,0x72,0x17,0xf8,0x20,0x2b,0xdc,0xf0,0x02,0x10,
+  0x03,0x4c,0x48,0xd2,0xa5,0x61,0xe9,0x7f,0x48,0xa9,0x80,0x85,0x61,0xa9,0xd6,0xa0,
+  0xd9,0x20,0x67,0xd8,0xa9,0xdb,0xa0,0xd9,0x20,0x0f,0xdb,0xa9,0xbc,0xa0,0xd9,0x20,
+  0x50,0xd8,0xa9,0xc1,0xa0,0xd9,0x20,0x40,0xe0,0xa9,0xe0,0xa0,0xd9,0x20,0x67,0xd8,
+  0x68,0x20,0x7e,0xdd,0xa9,0xe5,0xa0,0xd9,0x20,0x8c,0xda,0xd0,0x03,0x4c,0x8b,0xda,
+  0x20,0xb7,0xda,0xa9,0x00,0x85,0x26,0x85,0x27,0x85,0x28,0x85,0x29,0xa5,0x70,0x20,
+  0x59,0xda,0xa5,0x65,0x20,0x59,0xda,0xa5,0x64,0x20,0x59,0xda,0xa5,0x63,0x20,0x59,
+  0xda,0xa5,0x62,0x20,0x5e,0xda,0x4c,0x8f,0xdb,0xd0,0x03,0x4c,0x83,0xd9,0x4a,0x09,
+  0x80,0xa8,0x90,0x19,0x18,0xa5,0x29,0x65,0x6d,0x85,0x29,0xa5,0x28,0x65,0x6c,0x85,
+  0x28,0xa5,0x27,0x65,0x6b,0x85,0x27,0xa5,0x26,0x65,0x6a,0x85,0x26,0x66,0x26,0x66,
+  0x27,0x66,0x28,0x66,0x29,0x66,0x70,0x98,0x4a,0xd0,0xd6,0x60,0x85,0x22,0x84,0x23,
+  0xa0,0x04,0xb1,0x22,0x85,0x6d,0x88,0xb1,0x22,0x85,0x6c,0x88,0xb1,0x22,0x85,0x6b,
+  0x88,0xb1,0x22,0x85,0x6e,0x45,0x66,0x85,0x6f,0xa5,0x6e,0x09,0x80,0x85,0x6a,0x88,
+  0xb1,0x22,0x85,0x69,0xa5,0x61,0x60,0xa5,0x69,0xf0,0x1f,0x18,0x65,0x61,0x90,0x04,
+  0x30,0x1d,0x18,0x2c,0x10,0x14,0x69,0x80,0x85,0x61,0xd0,0x03,0x4c,0xfb,0xd8,0xa5,
+  0x6f,0x85,0x66,0x60,0xa5,0x66,0x49,0xff,0x30,0x05,0x68,0x68,0x4c,0xf7,0xd8,0x4c,
+  0x7e,0xd9,0x20,0x0c,0xdc,0xaa,0xf0,0x10,0x18,0x69,0x02,0xb0,0xf2,0xa2,0x00,0x86,
+  0x6f,0x20,0x77,0xd8,0xe6,0x61,0xf0,0xe7,0x60,0x84,0x20,0x00,0x00,0x00,0x20,0x0c,
+  0xdc,0xa9,0xf9,0xa0,0xda,0xa2,0x00,0x86,0x6f,0x20,0xa2,0xdb,0x4c,0x12,0xdb,0x20,
+  0x8c,0xda,0xf0,0x76,0x20,0x1b,0xdc,0xa9,0x00,0x38,0xe5,0x61,0x85,0x61,0x20,0xb7,
+  0xda,0xe6,0x61,0xf0,0xba,0xa2,0xfc,0xa9,0x01,0xa4,0x6a,0xc4,0x62,0xd0,0x10,0xa4,
+  0x6b,0xc4,0x63,0xd0,0x0a,0xa4,0x6c,0xc4,0x64,0xd0,0x04,0xa4,0x6d,0xc4,0x65,0x08,
+  0x2a,0x90,0x09,0xe8,0x95,0x29,0xf0,0x32,0x10,0x34,0xa9,0x01,0x28,0xb0,0x0e,0x06,
+  0x6d,0x26,0x6c,0x26,0x6b,0x26,0x6a,0xb0,0xe6,0x30,0xce,0x10,0xe2,0xa8,0xa5,0x6d,
+  0xe5,0x65,0x85,0x6d,0xa5,0x6c,0xe5,0x64,0x85,0x6c,0xa5,0x6b,0xe5,0x63,0x85,0x6b,
+  0xa5,0x6a,0xe5,0x62,0x85,0x6a,0x98,0x4c,0x4f,0xdb,0xa9,0x40,0xd0,0xce,0x0a,0x0a,
+  0x0a,0x0a,0x0a,0x0a,0x85,0x70,0x28,0x4c,0x8f,0xdb,0xa2,0x14,0x4c,0x37,0xc4,0xa5,
+  0x26,0x85,0x62,0xa5,0x27,0x85,0x63,0xa5,0x28,0x85,0x64,0xa5,0x29,0x85,0x65,0x4c,
+  0xd7,0xd8,0x85,0x22,0x84,0x23,0xa0,0x04,0xb1,0x22,0x85,0x65,0x88,0xb1,0x22,0x85,
+  0x64,0x88,0xb1,0x22,0x85,0x63,0x88,0xb1,0x22,0x85,0x66,0x09,0x80,0x85,0x62,0x88,
+  0xb1,0x22,0x85,0x61,0x84,0x70,0x60,0xa2,0x5c,0x2c,0xa2,0x57,0xa0,0x00,0xf0,0x04,
+  0xa6,0x49,0xa4,0x4a,0x20,0x1b,0xdc,0x86,0x22,0x84,0x23,0xa0,0x04,0xa5,0x65,0x91,
+  0x22,0x88,0xa5,0x64,0x91,0x22,0x88,0xa5,0x63,0x91,0x22,0x88,0xa5,0x66,0x09,0x7f,
+  0x25,0x62,0x91,0x22,0x88,0xa5,0x61,0x91,0x22,0x84,0x70,0x60,0xa5,0x6e,0x85,0x66,
+  0xa2,0x05,0xb5,0x68,0x95,0x60,0xca,0xd0,0xf9,0x86,0x70,0x60,0x20,0x1b,0xdc,0xa2,
+  0x06,0xb5,0x60,0x95,0x68,0xca,0xd0,0xf9,0x86,0x70,0x60,0xa5,0x61,0xf0,0xfb,0x06,
+  0x70,0x90,0xf7,0x20,0x6f,0xd9,0xd0,0xf2,0x4c,0x38,0xd9,0xa5,0x61,0xf0,0x09,0xa5,
+  0x66,0x2a,0xa9,0xff,0xb0,0x02,0xa9,0x01,0x60,0x20,0x2b,0xdc,0x85,0x62,0xa9,0x00,
+  0x85,0x63,0xa2,0x88,0xa5,0x62,0x49,0xff,0x2a,0xa9,0x00,0x85,0x65,0x85,0x64,0x86,
+  0x61,0x85,0x70,0x85,0x66,0x4c,0xd2,0xd8,0x46,0x66,0x60,0x85,0x24,0x84,0x25,0xa0,
+  0x00,0xb1,0x24,0xc8,0xaa,0xf0,0xc4,0xb1,0x24,0x45,0x66,0x30,0xc2,0xe4,0x61,0xd0,
+  0x21,0xb1,0x24,0x09,0x80,0xc5,0x62,0xd0,0x19,0xc8,0xb1,0x24,0xc5,0x63,0xd0,0x12,
+  0xc8,0xb1,0x24,0xc5,0x64,0xd0,0x0b,0xc8,0xa9,0x7f,0xc5,0x70,0xb1,0x24,0xe5,0x65,
+  0xf0,0x28,0xa5,0x66,0x90,0x02,0x49,0xff,0x4c,0x31,0xdc,0xa5,0x61,0xf0,0x4a,0x38,
+  0xe9,0xa0,0x24,0x66,0x10,0x09,0xaa,0xa9,0xff,0x85,0x68,0x20,0x4d,0xd9,0x8a,0xa2,
+  0x61,0xc9,0xf9,0x10,0x06,0x20,0x99,0xd9,0x84,0x68,0x60,0xa8,0xa5,0x66,0x29,0x80,
+  0x46,0x62,0x05,0x62,0x85,0x62,0x20,0xb0,0xd9,0x84,0x68,0x60,0xa5,0x61,0xc9,0xa0,
+  0xb0,0x20,0x20,0x9b,0xdc,0x84,0x70,0xa5,0x66,0x84,0x66,0x49,0x80,0x2a,0xa9,0xa0,
+  0x85,0x61,0xa5,0x65,0x85,0x07,0x4c,0xd2,0xd8,0x85,0x62,0x85,0x63,0x85,0x64,0x85,
+  0x65,0xa8,0x60,0xa0,0x00,0xa2,0x0a,0x94,0x5d,0xca,0x10,0xfb,0x90,0x0f,0xc9,0x2d,
+  0xd0,0x04,0x86,0x67,0xf0,0x04,0xc9,0x2b,0xd0,0x05,0x20,0x73,0x00,0x90,0x5b,0xc9,
+  0x2e,0xf0,0x2e,0xc9,0x45,0xd0,0x30,0x20,0x73,0x00,0x90,0x17,0xc9,0xab,0xf0,0x0e,
+  0xc9,0x2d,0xf0,0x0a,0xc9,0xaa,0xf0,0x08,0xc9,0x2b,0xf0,0x04,0xd0,0x07,0x66,0x60,
+  0x20,0x73,0x00,0x90,0x5c,0x24,0x60,0x10,0x0e,0xa9,0x00,0x38,0xe5,0x5e,0x4c,0x49,
+  0xdd,0x66,0x5f,0x24,0x5f,0x50,0xc3,0xa5,0x5e,0x38,0xe5,0x5d,0x85,0x5e,0xf0,0x12,
+  0x10,0x09,0x20,0xfe,0xda,0xe6,0x5e,0xd0,0xf9,0xf0,0x07,0x20,0xe2,0xda,0xc6,0x5e,
+  0xd0,0xf9,0xa5,0x67,0x30,0x01,0x60,0x4c,0xb4,0xdf,0x48,0x24,0x5f,0x10,0x02,0xe6,
+  0x5d,0x20,0xe2,0xda,0x68,0x38,0xe9,0x30,0x20,0x7e,0xdd,0x4c,0x0a,0xdd,0x48,0x20,
+  0x0c,0xdc,0x68,0x20,0x3c,0xdc,0xa5,0x6e,0x45,0x66,0x85,0x6f,0xa6,0x61,0x4c,0x6a,
+  0xd8,0xa5,0x5e,0xc9,0x0a,0x90,0x09,0xa9,0x64,0x24,0x60,0x30,0x11,0x4c,0x7e,0xd9,
+  0x0a,0x0a,0x18,0x65,0x5e,0x0a,0x18,0xa0,0x00,0x71,0x7a,0x38,0xe9,0x30,0x85,0x5e,
+  0x4c,0x30,0xdd,0x9b,0x3e,0xbc,0x1f,0xfd,0x9e,0x6e,0x6b,0x27,0xfd,0x9e,0x6e,0x6b,
+  0x28,0x00,0xa9,0x71,0xa0,0xc3,0x20,0xda,0xdd,0xa5,0x3a,0xa6,0x39,0x85,0x62,0x86,
+  0x63,0xa2,0x90,0x38,0x20,0x49,0xdc,0x20,0xdf,0xdd,0x4c,0x1e,0xcb,0xa0,0x01,0xa9,
+  0x20,0x24,0x66,0x10,0x02,0xa9,0x2d,0x99,0xff,0x00,0x85,0x66,0x84,0x71,0xc8,0xa9,
+  0x30,0xa6,0x61,0xd0,0x03,0x4c,0x04,0xdf,0xa9,0x00,0xe0,0x80,0xf0,0x02,0xb0,0x09,
+  0xa9,0xbd,0xa0,0xdd,0x20,0x28,0xda,0xa9,0xf7,0x85,0x5d,0xa9,0xb8,0xa0,0xdd,0x20,
+  0x5b,0xdc,0xf0,0x1e,0x10,0x12,0xa9,0xb3,0xa0,0xdd,0x20,0x5b,0xdc,0xf0,0x02,0x10,
+  0x0e,0x20,0xe2,0xda,0xc6,0x5d,0xd0,0xee,0x20,0xfe,0xda,0xe6,0x5d,0xd0,0xdc,0x20,
+  0x49,0xd8,0x20,0x9b,0xdc,0xa2,0x01,0xa5,0x5d,0x18,0x69,0x0a,0x30,0x09,0xc9,0x0b,
+  0xb0,0x06,0x69,0xff,0xaa,0xa9,0x02,0x38,0xe9,0x02,0x85,0x5e,0x86,0x5d,0x8a,0xf0,
+  0x02,0x10,0x13,0xa4,0x71,0xa9,0x2e,0xc8,0x99,0xff,0x00,0x8a,0xf0,0x06,0xa9,0x30,
+  0xc8,0x99,0xff,0x00,0x84,0x71,0xa0,0x00,0xa2,0x80,0xa5,0x65,0x18,0x79,0x19,0xdf,
+  0x85,0x65,0xa5,0x64,0x79,0x18,0xdf,0x85,0x64,0xa5,0x63,0x79,0x17,0xdf,0x85,0x63,
+  0xa5,0x62,0x79,0x16,0xdf,0x85,0x62,0xe8,0xb0,0x04,0x10,0xde,0x30,0x02,0x30,0xda,
+  0x8a,0x90,0x04,0x49,0xff,0x69,0x0a,0x69,0x2f,0xc8,0xc8,0xc8,0xc8,0x84,0x47,0xa4,
+  0x71,0xc8,0xaa,0x29,0x7f,0x99,0xff,0x00,0xc6,0x5d,0xd0,0x06,0xa9,0x2e,0xc8,0x99,
+  0xff,0x00,0x84,0x71,0xa4,0x47,0x8a,0x49,0xff,0x29,0x80,0xaa,0xc0,0x24,0xf0,0x04,
+  0xc0,0x3c,0xd0,0xa6,0xa4,0x71,0xb9,0xff,0x00,0x88,0xc9,0x30,0xf0,0xf8,0xc9,0x2e,
+  0xf0,0x01,0xc8,0xa9,0x2b,0xa6,0x5e,0xf0,0x2e,0x10,0x08,0xa9,0x00,0x38,0xe5,0x5e,
+  0xaa,0xa9,0x2d,0x99,0x01,0x01,0xa9,0x45,0x99,0x00,0x01,0x8a,0xa2,0x2f,0x38,0xe8,
+  0xe9,0x0a,0xb0,0xfb,0x69,0x3a,0x99,0x03,0x01,0x8a,0x99,0x02,0x01,0xa9,0x00,0x99,
+  0x04,0x01,0xf0,0x08,0x99,0xff,0x00,0xa9,0x00,0x99,0x00,0x01,0xa9,0x00,0xa0,0x01,
+  0x60,0x80,0x00,0x00,0x00,0x00,0xfa,0x0a,0x1f,0x00,0x00,0x98,0x96,0x80,0xff,0xf0,
+  0xbd,0xc0,0x00,0x01,0x86,0xa0,0xff,0xff,0xd8,0xf0,0x00,0x00,0x03,0xe8,0xff,0xff,
+  0xff,0x9c,0x00,0x00,0x00,0x0a,0xff,0xff,0xff,0xff,0xff,0xdf,0x0a,0x80,0x00,0x03,
+  0x4b,0xc0,0xff,0xff,0x73,0x60,0x00,0x00,0x0e,0x10,0xff,0xff,0xfd,0xa8,0x00,0x00,
+  0x00,0x3c,0xbf,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+  0xaa,0x20,0x0c,0xdc,0xa9,0x11,0xa0,0xdf,0x20,0xa2,0xdb,0xf0,0x70,0xa5,0x69,0xd0,
+  0x03,0x4c,0xf9,0xd8,0xa2,0x4e,0xa0,0x00,0x20,0xd4,0xdb,0xa5,0x6e,0x10,0x0f,0x20,
+  0xcc,0xdc,0xa9,0x4e,0xa0,0x00,0x20,0x5b,0xdc,0xd0,0x03,0x98,0xa4,0x07,0x20,0xfe,
+  0xdb,0x98,0x48,0x20,0xea,0xd9,0xa9,0x4e,0xa0,0x00,0x20,0x28,0xda,0x20,0xed,0xdf,
+  0x68,0x4a,0x90,0x0a,0xa5,0x61,0xf0,0x06,0xa5,0x66,0x49,0xff,0x85,0x66,0x60,0x81,
+  0x38,0xaa,0x3b,0x29,0x07,0x71,0x34,0x58,0x3e,0x56,0x74,0x16,0x7e,0xb3,0x1b,0x77,
+  0x2f,0xee,0xe3,0x85,0x7a,0x1d,0x84,0x1c,0x2a,0x7c,0x63,0x59,0x58,0x0a,0x7e,0x75,
+  0xfd,0xe7,0xc6,0x80,0x31,0x72,0x18,0x10,0x81,0x00,0x00,0x00,0x00,0xa9,0xbf,0xa0,
+  0xdf,0x20,0x28,0xda,0xa5,0x70,0x69,0x50,0x90,0x03,0x20,0x23,0xdc,0x85,0x56,0x20,
+  0x0f,0xdc,0xa5,0x61,0xc9,0x88,0x90,0x03,0x20,0xd4,0xda,0x20,0xcc,0xdc,0xa5,0x07,
+  0x18,0x69,0x81,0xf0,0xf3,0x38,0xe9,0x01,0x48,0xa2,0x05,0xb5,0x69,0xb4,0x61,0x95,
+  0x61,0x94,0x69,0xca,0x10,0xf5,0xa5,0x56,0x85,0x70,0x20,0x53,0xd8,0x20,0xb4,0xdf,
+  0xa9,0xc4,0xa0,0xdf,0x20,0x56,0xe0,0xa9,0x00,0x85,0x6f,0x68,0x20,0xb9,0xda,0x60,
+  0x85,0x71,0x84,0x72,0x20,0xca,0xdb,0xa9,0x57,0x20,0x28,0xda,0x20,0x5a,0xe0,0xa9,
+  0x57,0xa0,0x00,0x4c,0x28,0xda,0x85,0x71,0x84,0x72,0x20,0xc7,0xdb,0xb1,0x71,0x85,
+  0x67,0xa4,0x71,0xc8,0x98,0xd0,0x02,0xe6,0x72,0x85,0x71,0xa4,0x72,0x20,0x28,0xda,
+  0xa5,0x71,0xa4,0x72,0x18,0x69,0x05,0x90,0x01,0xc8,0x85,0x71,0x84,0x72,0x20,0x67,
+  0xd8,0xa9,0x5c,0xa0,0x00,0xc6,0x67,0xd0,0xe4,0x60,0x98,0x35,0x44,0x7a,0x00,0x68,
+  0x28,0xb1,0x46,0x00,0x20,0x2b,0xdc,0x30,0x37,0xd0,0x20,0x20,0xf3,0xff,0x86,0x22,
+  0x84,0x23,0xa0,0x04,0xb1,0x22,0x85,0x62,0xc8,0xb1,0x22,0x85,0x64,0xa0,0x08,0xb1,
+  0x22,0x85,0x63,0xc8,0xb1,0x22,0x85,0x65,0x4c,0xe0,0xe0,0xa9,0x8b,0xa0,0x00,0x20,
+  0xa2,0xdb,0xa9,0x8a,0xa0,0xe0,0x20,0x28,0xda,0xa9,0x8f,0xa0,0xe0,0x20,0x67,0xd8,
+  0xa6,0x65,0xa5,0x62,0x85,0x65,0x86,0x62,0xa6,0x63,0xa5,0x64,0x85,0x63,0x86,0x64,
+  0xa9,0x00,0x85,0x66,0xa5,0x61,0x85,0x70,0xa9,0x80,0x85,0x61,0x20,0xd7,0xd8,0xa2,
+  0x8b,0xa0,0x00,0x4c,0xd4,0xdb,0xc9,0xf0,0xd0,0x07,0x84,0x38,0x86,0x37,0x4c,0x63,
+  0xc6,0xaa,0xd0,0x02,0xa2,0x1e,0x4c,0x37,0xc4,0x20,0xd2,0xff,0xb0,0xe8,0x60,0x20,
+  0xcf,0xff,0xb0,0xe2,0x60,0x20,0xc9,0xff,0xb0,0xdc,0x60,0x20,0xc6,0xff,0xb0,0xd6,
+  0x60,0x20,0xe4,0xff,0xb0,0xd0,0x60,0x20,0x8a,0xcd,0x20,0xf7,0xd7,0xa9,0xe1,0x48,
+  0xa9,0x43,0x48,0xad,0x0f,0x03,0x48,0xad,0x0c,0x03,0xae,0x0d,0x03,0xac,0x0e,0x03,
+  0x28,0x6c,0x14,0x00,0x08,0x8d,0x0c,0x03,0x8e,0x0d,0x03,0x8c,0x0e,0x03,0x68,0x8d,
+  0x0f,0x03,0x60,0x20,0xd1,0xe1,0xa6,0x2d,0xa4,0x2e,0xa9,0x2b,0x20,0xd8,0xff,0xb0,
+  0x95,0x60,0xa9,0x01,0x2c,0xa9,0x00,0x85,0x0a,0x20,0xd1,0xe1,0xa5,0x0a,0xa6,0x2b,
+  0xa4,0x2c,0x20,0xd5,0xff,0xb0,0x57,0xa5,0x0a,0xf0,0x1a,0xa2,0x1c,0x20,0xb7,0xff,
+  0x29,0x10,0xf0,0x03,0x4c,0x37,0xc4,0xa5,0x7a,0xc9,0x02,0xf0,0x07,0xa9,0x64,0xa0,
+  0xc3,0x4c,0x1e,0xcb,0x60,0x20,0xb7,0xff,0x29,0xbf,0xf0,0x05,0xa2,0x1d,0x4c,0x37,
+  0xc4,0xa5,0x7b,0xc9,0x02,0xd0,0x0e,0x86,0x2d,0x84,0x2e,0xa9,0x76,0xa0,0xc3,0x20,
+  0x1e,0xcb,0x4c,0x2a,0xc5,0x20,0x8e,0xc6,0x4c,0x76,0xe4,0x20,0x16,0xe2,0x20,0xc0,
+  0xff,0xb0,0x0b,0x60,0x20,0x16,0xe2,0xa5,0x49,0x20,0xc3,0xff,0x90,0xc6,0x4c,0xf6,
+  0xe0,0xa9,0x00,0x20,0xbd,0xff,0xa2,0x01,0xa0,0x00,0x20,0xba,0xff,0x20,0x03,0xe2,
+  0x20,0x54,0xe2,0x20,0x03,0xe2,0x20,0xfd,0xe1,0xa0,0x00,0x86,0x49,0x20,0xba,0xff,
+  0x20,0x03,0xe2,0x20,0xfd,0xe1,0x8a,0xa8,0xa6,0x49,0x4c,0xba,0xff,0x20,0x0b,0xe2,
+  0x4c,0x9e,0xd7,0x20,0x79,0x00,0xd0,0x02,0x68,0x68,0x60,0x20,0xfd,0xce,0x20,0x79,
+  0x00,0xd0,0xf7,0x4c,0x08,0xcf,0xa9,0x00,0x20,0xbd,0xff,0x20,0x0e,0xe2,0x20,0x9e,
+  0xd7,0x86,0x49,0x8a,0xa2,0x01,0xa0,0x00,0x20,0xba,0xff,0x20,0x03,0xe2,0x20,0xfd,
+  0xe1,0x86,0x4a,0xa0,0x00,0xa5,0x49,0xe0,0x03,0x90,0x01,0x88,0x20,0xba,0xff,0x20,
+  0x03,0xe2,0x20,0xfd,0xe1,0x8a,0xa8,0xa6,0x4a,0xa5,0x49,0x20,0xba,0xff,0x20,0x03,
+  0xe2,0x20,0x0b,0xe2,0x20,0x9e,0xcd,0x20,0xa3,0xd6,0xa6,0x22,0xa4,0x23,0x4c,0xbd,
+  0xff,0xa9,0xdd,0xa0,0xe2,0x20,0x67,0xd8,0x20,0x0c,0xdc,0xa9,0xe2,0xa0,0xe2,0xa6,
+  0x6e,0x20,0x07,0xdb,0x20,0x0c,0xdc,0x20,0xcc,0xdc,0xa9,0x00,0x85,0x6f,0x20,0x53,
+  0xd8,0xa9,0xe7,0xa0,0xe2,0x20,0x50,0xd8,0xa5,0x66,0x48,0x10,0x0d,0x20,0x49,0xd8,
+  0xa5,0x66,0x30,0x09,0xa5,0x12,0x49,0xff,0x85,0x12,0x20,0xb4,0xdf,0xa9,0xe7,0xa0,
+  0xe2,0x20,0x67,0xd8,0x68,0x10,0x03,0x20,0xb4,0xdf,0xa9,0xec,0xa0,0xe2,0x4c,0x40,
+  0xe0,0x20,0xca,0xdb,0xa9,0x00,0x85,0x12,0x20,0x68,0xe2,0xa2,0x4e,0xa0,0x00,0x20,
+  0xf3,0xe0,0xa9,0x57,0xa0,0x00,0x20,0xa2,0xdb,0xa9,0x00,0x85,0x66,0xa5,0x12,0x20,
+  0xd9,0xe2,0xa9,0x4e,0xa0,0x00,0x4c,0x0f,0xdb,0x48,0x4c,0x9a,0xe2,0x81,0x49,0x0f,
+  0xda,0xa2,0x83,0x49,0x0f,0xda,0xa2,0x7f,0x00,0x00,0x00,0x00,0x05,0x84,0xe6,0x1a,
+  0x2d,0x1b,0x86,0x28,0x07,0xfb,0xf8,0x87,0x99,0x68,0x89,0x01,0x87,0x23,0x35,0xdf,
+  0xe1,0x86,0xa5,0x5d,0xe7,0x28,0x83,0x49,0x0f,0xda,0xa2,0xa5,0x66,0x48,0x10,0x03,
+  0x20,0xb4,0xdf,0xa5,0x61,0x48,0xc9,0x81,0x90,0x07,0xa9,0xbc,0xa0,0xd9,0x20,0x0f,
+  0xdb,0xa9,0x3b,0xa0,0xe3,0x20,0x40,0xe0,0x68,0xc9,0x81,0x90,0x07,0xa9,0xdd,0xa0,
+  0xe2,0x20,0x50,0xd8,0x68,0x10,0x03,0x4c,0xb4,0xdf,0x60,0x0b,0x76,0xb3,0x83,0xbd,
+  0xd3,0x79,0x1e,0xf4,0xa6,0xf5,0x7b,0x83,0xfc,0xb0,0x10,0x7c,0x0c,0x1f,0x67,0xca,
+  0x7c,0xde,0x53,0xcb,0xc1,0x7d,0x14,0x64,0x70,0x4c,0x7d,0xb7,0xea,0x51,0x7a,0x7d,
+  0x63,0x30,0x88,0x7e,0x7e,0x92,0x44,0x99,0x3a,0x7e,0x4c,0xcc,0x91,0xc7,0x7f,0xaa,
+  0xaa,0xaa,0x13,0x81,0x00,0x00,0x00,0x00,0x20,0x5b,0xe4,0x20,0xa4,0xe3,0x20,0x04,
+  0xe4,0xa2,0xfb,0x9a,0x4c,0x74,0xc4,0xe6,0x7a,0xd0,0x02,0xe6,0x7b,0xad,0x60,0xea,
+  0xc9,0x3a,0xb0,0x0a,0xc9,0x20,0xf0,0xef,0x38,0xe9,0x30,0x38,0xe9,0xd0,0x60,0x80,
+  0x4f,0xc7,0x52,0x58,0xa9,0x4c,0x85,0x54,0x85,0x00,0xa9,0x48,0xa0,0xd2,0x85,0x01,
+  0x84,0x02,0xa9,0x91,0xa0,0xd3,0x85,0x05,0x84,0x06,0xa9,0xaa,0xa0,0xd1,0x85,0x03,
+  0x84,0x04,0xa2,0x1c,0xbd,0x87,0xe3,0x95,0x73,0xca,0x10,0xf8,0xa9,0x03,0x85,0x53,
+  0xa9,0x00,0x85,0x68,0x85,0x13,0x85,0x18,0xa2,0x01,0x8e,0xfd,0x01,0x8e,0xfc,0x01,
+  0xa2,0x19,0x86,0x16,0x38,0x20,0x9c,0xff,0x86,0x2b,0x84,0x2c,0x38,0x20,0x99,0xff,
+  0x86,0x37,0x84,0x38,0x86,0x33,0x84,0x34,0xa0,0x00,0x98,0x91,0x2b,0xe6,0x2b,0xd0,
+  0x02,0xe6,0x2c,0x60,0xa5,0x2b,0xa4,0x2c,0x20,0x08,0xc4,0xa9,0x36,0xa0,0xe4,0x20,
+  0x1e,0xcb,0xa5,0x37,0x38,0xe5,0x2b,0xaa,0xa5,0x38,0xe5,0x2c,0x20,0xcd,0xdd,0xa9,
+  0x29,0xa0,0xe4,0x20,0x1e,0xcb,0x4c,0x44,0xc6,0x20,0x42,0x59,0x54,0x45,0x53,0x20,
+  0x46,0x52,0x45,0x45,0x0d,0x00,0x93,0x2a,0x2a,0x2a,0x2a,0x20,0x43,0x42,0x4d,0x20,
+  0x42,0x41,0x53,0x49,0x43,0x20,0x56,0x32,0x20,0x2a,0x2a,0x2a,0x2a,0x0d,0x00,0x3a,
+  0xc4,0x83,0xc4,0x7c,0xc5,0x1a,0xc7,0xe4,0xc7,0x86,0xce,0xa2,0x0b,0xbd,0x4f,0xe4,
+  0x9d,0x00,0x03,0xca,0x10,0xf7,0x60,0x20,0xcc,0xff,0xa9,0x00,0x85,0x13,0x20,0x7a,
+  0xc6,0x58,0x4c,0x74,0xc4,0x41,0x20,0x33,0xc5,0x4c,0x77,0xc6,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xad,0x2c,0x91,0x29,0xdf,0x8d,0x2c,0x91,0x60,0xad,0x2c,0x91,0x09,0x20,0x8d,0x2c,
+  0x91,0x60,0xad,0x1f,0x91,0xcd,0x1f,0x91,0xd0,0xf8,0x4a,0x60,0xa6,0xb9,0x4c,0x47,
+  0xf6,0x8a,0xd0,0x08,0xa5,0xc3,0x85,0xae,0xa5,0xc4,0x85,0xaf,0x4c,0x6a,0xf6,0x20,
+  0xe3,0xf8,0x90,0x03,0x68,0xa9,0x00,0x4c,0x9e,0xf3,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xa2,0x10,0xa0,0x91,0x60,0xa2,0x16,0xa0,0x17,0x60,0xb0,0x07,0x86,0xd6,0x84,0xd3,
+  0x20,0x87,0xe5,0xa6,0xd6,0xa4,0xd3,0x60,0x20,0xbb,0xe5,0xad,0x88,0x02,0x29,0xfd,
+  0x0a,0x0a,0x09,0x80,0x8d,0x05,0x90,0xad,0x88,0x02,0x29,0x02,0xf0,0x08,0xa9,0x80,
+  0x0d,0x02,0x90,0x8d,0x02,0x90,0xa9,0x00,0x8d,0x91,0x02,0x85,0xcf,0xa9,0xdc,0x8d,
+  0x8f,0x02,0xa9,0xeb,0x8d,0x90,0x02,0xa9,0x0a,0x8d,0x89,0x02,0x8d,0x8c,0x02,0xa9,
+  0x06,0x8d,0x86,0x02,0xa9,0x04,0x8d,0x8b,0x02,0xa9,0x0c,0x85,0xcd,0x85,0xcc,0xad,
+  0x88,0x02,0x09,0x80,0xa8,0xa9,0x00,0xaa,0x94,0xd9,0x18,0x69,0x16,0x90,0x01,0xc8,
+  0xe8,0xe0,0x18,0xd0,0xf3,0xa9,0xff,0x95,0xd9,0xa2,0x16,0x20,0x8d,0xea,0xca,0x10,
+  0xfa,0xa0,0x00,0x84,0xd3,0x84,0xd6,0xa6,0xd6,0xa5,0xd3,0xb4,0xd9,0x30,0x08,0x18,
+  0x69,0x16,0x85,0xd3,0xca,0x10,0xf4,0xb5,0xd9,0x29,0x03,0x0d,0x88,0x02,0x85,0xd2,
+  0xbd,0xfd,0xed,0x85,0xd1,0xa9,0x15,0xe8,0xb4,0xd9,0x30,0x06,0x18,0x69,0x16,0xe8,
+  0x10,0xf6,0x85,0xd5,0x60,0x20,0xbb,0xe5,0x4c,0x81,0xe5,0xa9,0x03,0x85,0x9a,0xa9,
+  0x00,0x85,0x99,0xa2,0x10,0xbd,0xe3,0xed,0x9d,0xff,0x8f,0xca,0xd0,0xf7,0x60,0xac,
+  0x77,0x02,0xa2,0x00,0xbd,0x78,0x02,0x9d,0x77,0x02,0xe8,0xe4,0xc6,0xd0,0xf5,0xc6,
+  0xc6,0x98,0x58,0x18,0x60,0x20,0x42,0xe7,0xa5,0xc6,0x85,0xcc,0x8d,0x92,0x02,0xf0,
+  0xf7,0x78,0xa5,0xcf,0xf0,0x0c,0xa5,0xce,0xae,0x87,0x02,0xa0,0x00,0x84,0xcf,0x20,
+  0xa1,0xea,0x20,0xcf,0xe5,0xc9,0x83,0xd0,0x10,0xa2,0x09,0x78,0x86,0xc6,0xbd,0xf3,
+  0xed,0x9d,0x76,0x02,0xca,0xd0,0xf7,0xf0,0xcf,0xc9,0x0d,0xd0,0xc8,0xa4,0xd5,0x84,
+  0xd0,0xb1,0xd1,0xc9,0x20,0xd0,0x03,0x88,0xd0,0xf7,0xc8,0x84,0xc8,0xa0,0x00,0x8c,
+  0x92,0x02,0x84,0xd3,0x84,0xd4,0xa5,0xc9,0x30,0x1d,0xa6,0xd6,0x20,0x19,0xe7,0xe4,
+  0xc9,0xd0,0x14,0xd0,0x12,0xa5,0xca,0x85,0xd3,0xc5,0xc8,0x90,0x0a,0xb0,0x42,0x98,
+  0x48,0x8a,0x48,0xa5,0xd0,0xf0,0x91,0xa4,0xd3,0xb1,0xd1,0xea,0xea,0xea,0xea,0xea,
+  0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,
+  0xea,0xea,0x85,0xd7,0x29,0x3f,0x06,0xd7,0x24,0xd7,0x10,0x02,0x09,0x80,0x90,0x04,
+  0xa6,0xd4,0xd0,0x04,0x70,0x02,0x09,0x40,0xe6,0xd3,0x20,0xb8,0xe6,0xc4,0xc8,0xd0,
+  0x17,0xa9,0x00,0x85,0xd0,0xa9,0x0d,0xa6,0x99,0xe0,0x03,0xf0,0x06,0xa6,0x9a,0xe0,
+  0x03,0xf0,0x03,0x20,0x42,0xe7,0xa9,0x0d,0x85,0xd7,0x68,0xaa,0x68,0xa8,0xa5,0xd7,
+  0xc9,0xde,0xd0,0x02,0xa9,0xff,0x18,0x60,0xc9,0x22,0xd0,0x08,0xa5,0xd4,0x49,0x01,
+  0x85,0xd4,0xa9,0x22,0x60,0x09,0x40,0xa6,0xc7,0xf0,0x02,0x09,0x80,0xa6,0xd8,0xf0,
+  0x02,0xc6,0xd8,0xae,0x86,0x02,0x20,0xa1,0xea,0x20,0xea,0xe6,0x68,0xa8,0xa5,0xd8,
+  0xf0,0x02,0x46,0xd4,0x68,0xaa,0x68,0x18,0x58,0x60,0x20,0xfa,0xe8,0xe6,0xd3,0xa5,
+  0xd5,0xc5,0xd3,0xb0,0x37,0xc9,0x57,0xf0,0x2a,0xad,0x92,0x02,0xf0,0x03,0x4c,0xf0,
+  0xe9,0xa6,0xd6,0xe0,0x17,0x90,0x07,0x20,0x75,0xe9,0xc6,0xd6,0xa6,0xd6,0x16,0xd9,
+  0x56,0xd9,0x4c,0x5b,0xed,0x69,0x16,0x85,0xd5,0xb5,0xd9,0x30,0x03,0xca,0xd0,0xf9,
+  0x4c,0x7e,0xea,0xc6,0xd6,0x20,0xc3,0xe8,0xa9,0x00,0x85,0xd3,0x60,0xa6,0xd6,0xd0,
+  0x06,0x86,0xd3,0x68,0x68,0xd0,0xa5,0xca,0x86,0xd6,0x20,0x87,0xe5,0xa4,0xd5,0x84,
+  0xd3,0x60,0x48,0x85,0xd7,0x8a,0x48,0x98,0x48,0xa9,0x00,0x85,0xd0,0xa4,0xd3,0xa5,
+  0xd7,0x10,0x03,0x4c,0x00,0xe8,0xc9,0x0d,0xd0,0x03,0x4c,0xd8,0xe8,0xc9,0x20,0x90,
+  0x10,0xc9,0x60,0x90,0x04,0x29,0xdf,0xd0,0x02,0x29,0x3f,0x20,0xb8,0xe6,0x4c,0xc7,
+  0xe6,0xa6,0xd8,0xf0,0x03,0x4c,0xcb,0xe6,0xc9,0x14,0xd0,0x2e,0x98,0xd0,0x06,0x20,
+  0x2d,0xe7,0x4c,0x9f,0xe7,0x20,0xe8,0xe8,0x88,0x84,0xd3,0x20,0xb2,0xea,0xc8,0xb1,
+  0xd1,0x88,0x91,0xd1,0xc8,0xb1,0xf3,0x88,0x91,0xf3,0xc8,0xc4,0xd5,0xd0,0xef,0xa9,
+  0x20,0x91,0xd1,0xad,0x86,0x02,0x91,0xf3,0x10,0x4d,0xa6,0xd4,0xf0,0x03,0x4c,0xcb,
+  0xe6,0xc9,0x12,0xd0,0x02,0x85,0xc7,0xc9,0x13,0xd0,0x03,0x20,0x81,0xe5,0xc9,0x1d,
+  0xd0,0x17,0xc8,0x20,0xfa,0xe8,0x84,0xd3,0x88,0xc4,0xd5,0x90,0x09,0xc6,0xd6,0x20,
+  0xc3,0xe8,0xa0,0x00,0x84,0xd3,0x4c,0xdc,0xe6,0xc9,0x11,0xd0,0x1d,0x18,0x98,0x69,
+  0x16,0xa8,0xe6,0xd6,0xc5,0xd5,0x90,0xec,0xf0,0xea,0xc6,0xd6,0xe9,0x16,0x90,0x04,
+  0x85,0xd3,0xd0,0xf8,0x20,0xc3,0xe8,0x4c,0xdc,0xe6,0x20,0x12,0xe9,0x4c,0x21,0xed,
+  0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,
+  0xea,0xea,0xea,0xea,0xea,0x29,0x7f,0xc9,0x7f,0xd0,0x02,0xa9,0x5e,0xea,0xea,0xea,
+  0xea,0xea,0xea,0xc9,0x20,0x90,0x03,0x4c,0xc5,0xe6,0xc9,0x0d,0xd0,0x03,0x4c,0xd8,
+  0xe8,0xa6,0xd4,0xd0,0x3f,0xc9,0x14,0xd0,0x37,0xa4,0xd5,0xb1,0xd1,0xc9,0x20,0xd0,
+  0x04,0xc4,0xd3,0xd0,0x07,0xc0,0x57,0xf0,0x24,0x20,0xee,0xe9,0xa4,0xd5,0x20,0xb2,
+  0xea,0x88,0xb1,0xd1,0xc8,0x91,0xd1,0x88,0xb1,0xf3,0xc8,0x91,0xf3,0x88,0xc4,0xd3,
+  0xd0,0xef,0xa9,0x20,0x91,0xd1,0xad,0x86,0x02,0x91,0xf3,0xe6,0xd8,0x4c,0xdc,0xe6,
+  0xa6,0xd8,0xf0,0x05,0x09,0x40,0x4c,0xcb,0xe6,0xc9,0x11,0xd0,0x16,0xa6,0xd6,0xf0,
+  0x37,0xc6,0xd6,0xa5,0xd3,0x38,0xe9,0x16,0x90,0x04,0x85,0xd3,0x10,0x2a,0x20,0x87,
+  0xe5,0xd0,0x25,0xc9,0x12,0xd0,0x04,0xa9,0x00,0x85,0xc7,0xc9,0x1d,0xd0,0x12,0x98,
+  0xf0,0x09,0x20,0xe8,0xe8,0x88,0x84,0xd3,0x4c,0xdc,0xe6,0x20,0x2d,0xe7,0x4c,0xdc,
+  0xe6,0xc9,0x13,0xd0,0x06,0x20,0x5f,0xe5,0x4c,0xdc,0xe6,0x09,0x80,0x20,0x12,0xe9,
+  0x4c,0x30,0xed,0x46,0xc9,0xa6,0xd6,0xe8,0xe0,0x17,0xd0,0x03,0x20,0x75,0xe9,0xb5,
+  0xd9,0x10,0xf4,0x86,0xd6,0x4c,0x87,0xe5,0xa2,0x00,0x86,0xd8,0x86,0xc7,0x86,0xd4,
+  0x86,0xd3,0x20,0xc3,0xe8,0x4c,0xdc,0xe6,0xa2,0x04,0xa9,0x00,0xc5,0xd3,0xf0,0x07,
+  0x18,0x69,0x16,0xca,0xd0,0xf6,0x60,0xc6,0xd6,0x60,0xa2,0x04,0xa9,0x15,0xc5,0xd3,
+  0xf0,0x07,0x18,0x69,0x16,0xca,0xd0,0xf6,0x60,0xa6,0xd6,0xe0,0x17,0xf0,0x02,0xe6,
+  0xd6,0x60,0xa2,0x07,0xdd,0x21,0xe9,0xf0,0x04,0xca,0x10,0xf8,0x60,0x8e,0x86,0x02,
+  0x60,0x90,0x05,0x1c,0x9f,0x9c,0x1e,0x1f,0x9e,0xef,0xa1,0xdf,0xa6,0xe1,0xb1,0xe2,
+  0xb2,0xe3,0xb3,0xe4,0xb4,0xe5,0xb5,0xe6,0xb6,0xe7,0xb7,0xe8,0xb8,0xe9,0xb9,0xfa,
+  0xba,0xfb,0xbb,0xfc,0xbc,0xec,0xbd,0xfe,0xbe,0x84,0xbf,0xf7,0xc0,0xf8,0xdb,0xf9,
+  0xdd,0xea,0xde,0x5e,0xe0,0x5b,0xe1,0x5d,0xe2,0x40,0xb0,0x61,0xb1,0x78,0xdb,0x79,
+  0xdd,0x66,0xb6,0x77,0xc0,0x70,0xf0,0x71,0xf1,0x72,0xf2,0x73,0xf3,0x74,0xf4,0x75,
+  0xf5,0x76,0xf6,0x7d,0xfd,0xa5,0xac,0x48,0xa5,0xad,0x48,0xa5,0xae,0x48,0xa5,0xaf,
+  0x48,0xa2,0xff,0xc6,0xd6,0xc6,0xc9,0xc6,0xf2,0xe8,0x20,0x7e,0xea,0xe0,0x16,0xb0,
+  0x0c,0xbd,0xfe,0xed,0x85,0xac,0xb5,0xda,0x20,0x56,0xea,0x30,0xec,0x20,0x8d,0xea,
+  0xa2,0x00,0xb5,0xd9,0x29,0x7f,0xb4,0xda,0x10,0x02,0x09,0x80,0x95,0xd9,0xe8,0xe0,
+  0x16,0xd0,0xef,0xa5,0xef,0x09,0x80,0x85,0xef,0xa5,0xd9,0x10,0xc4,0xe6,0xd6,0xe6,
+  0xf2,0xa9,0xfb,0x8d,0x20,0x91,0xad,0x21,0x91,0xc9,0xfe,0x08,0xa9,0xf7,0x8d,0x20,
+  0x91,0x28,0xd0,0x0b,0xa0,0x00,0xea,0xca,0xd0,0xfc,0x88,0xd0,0xf9,0x84,0xc6,0xa6,
+  0xd6,0x68,0x85,0xaf,0x68,0x85,0xae,0x68,0x85,0xad,0x68,0x85,0xac,0x60,0xa6,0xd6,
+  0xe8,0xb5,0xd9,0x10,0xfb,0x86,0xf2,0xe0,0x16,0xf0,0x0d,0x90,0x0b,0x20,0x75,0xe9,
+  0xa6,0xf2,0xca,0xc6,0xd6,0x4c,0x0e,0xe7,0xa5,0xac,0x48,0xa5,0xad,0x48,0xa5,0xae,
+  0x48,0xa5,0xaf,0x48,0xa2,0x17,0xca,0x20,0x7e,0xea,0xe4,0xf2,0x90,0x0e,0xf0,0x0c,
+  0xbd,0xfc,0xed,0x85,0xac,0xb5,0xd8,0x20,0x56,0xea,0x30,0xea,0x20,0x8d,0xea,0xa2,
+  0x15,0xe4,0xf2,0x90,0x0f,0xb5,0xda,0x29,0x7f,0xb4,0xd9,0x10,0x02,0x09,0x80,0x95,
+  0xda,0xca,0xd0,0xed,0xa6,0xf2,0x20,0x0e,0xe7,0x68,0x85,0xaf,0x68,0x85,0xae,0x68,
+  0x85,0xad,0x68,0x85,0xac,0x60,0x29,0x03,0x0d,0x88,0x02,0x85,0xad,0x20,0x6e,0xea,
+  0xa0,0x15,0xb1,0xac,0x91,0xd1,0xb1,0xae,0x91,0xf3,0x88,0x10,0xf5,0x60,0x20,0xb2,
+  0xea,0xa5,0xac,0x85,0xae,0xa5,0xad,0x29,0x03,0x09,0x94,0x85,0xaf,0x60,0xbd,0xfd,
+  0xed,0x85,0xd1,0xb5,0xd9,0x29,0x03,0x0d,0x88,0x02,0x85,0xd2,0x60,0xa0,0x15,0x20,
+  0x7e,0xea,0x20,0xb2,0xea,0xa9,0x20,0x91,0xd1,0xa9,0x01,0x91,0xf3,0x88,0x10,0xf5,
+  0x60,0xa8,0xa9,0x02,0x85,0xcd,0x20,0xb2,0xea,0x98,0xa4,0xd3,0x91,0xd1,0x8a,0x91,
+  0xf3,0x60,0xa5,0xd1,0x85,0xf3,0xa5,0xd2,0x29,0x03,0x09,0x94,0x85,0xf4,0x60,0x20,
+  0xea,0xff,0xa5,0xcc,0xd0,0x29,0xc6,0xcd,0xd0,0x25,0xa9,0x14,0x85,0xcd,0xa4,0xd3,
+  0x46,0xcf,0xae,0x87,0x02,0xb1,0xd1,0xb0,0x11,0xe6,0xcf,0x85,0xce,0x20,0xb2,0xea,
+  0xb1,0xf3,0x8d,0x87,0x02,0xae,0x86,0x02,0xa5,0xce,0x49,0x80,0x20,0xaa,0xea,0xad,
+  0x1f,0x91,0x29,0x40,0xf0,0x0b,0xa0,0x00,0x84,0xc0,0xad,0x1c,0x91,0x09,0x02,0xd0,
+  0x09,0xa5,0xc0,0xd0,0x0d,0xad,0x1c,0x91,0x29,0xfd,0x2c,0x1e,0x91,0x70,0x03,0x8d,
+  0x1c,0x91,0x20,0x1e,0xeb,0x2c,0x24,0x91,0x68,0xa8,0x68,0xaa,0x68,0x40,0xa9,0x00,
+  0x8d,0x8d,0x02,0xa0,0x40,0x84,0xcb,0x8d,0x20,0x91,0xae,0x21,0x91,0xe0,0xff,0xf0,
+  0x5e,0xa9,0xfe,0x8d,0x20,0x91,0xa0,0x00,0xa9,0x5e,0x85,0xf5,0xa9,0xec,0x85,0xf6,
+  0xa2,0x08,0xad,0x21,0x91,0xcd,0x21,0x91,0xd0,0xf6,0x4a,0xb0,0x16,0x48,0xb1,0xf5,
+  0xc9,0x05,0xb0,0x0c,0xc9,0x03,0xf0,0x08,0x0d,0x8d,0x02,0x8d,0x8d,0x02,0x10,0x02,
+  0x84,0xcb,0x68,0xc8,0xc0,0x41,0xb0,0x09,0xca,0xd0,0xdf,0x38,0x2e,0x20,0x91,0xd0,
+  0xcf,0x6c,0x8f,0x02,0xa4,0xcb,0xb1,0xf5,0xaa,0xc4,0xc5,0xf0,0x07,0xa0,0x10,0x8c,
+  0x8c,0x02,0xd0,0x36,0x29,0x7f,0x2c,0x8a,0x02,0x30,0x16,0x70,0x49,0xc9,0x7f,0xf0,
+  0x29,0xc9,0x14,0xf0,0x0c,0xc9,0x20,0xf0,0x08,0xc9,0x1d,0xf0,0x04,0xc9,0x11,0xd0,
+  0x35,0xac,0x8c,0x02,0xf0,0x05,0xce,0x8c,0x02,0xd0,0x2b,0xce,0x8b,0x02,0xd0,0x26,
+  0xa0,0x04,0x8c,0x8b,0x02,0xa4,0xc6,0x88,0x10,0x1c,0xa4,0xcb,0x84,0xc5,0xac,0x8d,
+  0x02,0x8c,0x8e,0x02,0xe0,0xff,0xf0,0x0e,0x8a,0xa6,0xc6,0xec,0x89,0x02,0xb0,0x06,
+  0x9d,0x77,0x02,0xe8,0x86,0xc6,0xa9,0xf7,0x8d,0x20,0x91,0x60,0xad,0x8d,0x02,0xc9,
+  0x03,0xd0,0x2c,0xcd,0x8e,0x02,0xf0,0xee,0xad,0x91,0x02,0x30,0x56,0xea,0xea,0xea,
+  0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,
+  0xad,0x05,0x90,0x49,0x02,0x8d,0x05,0x90,0xea,0xea,0xea,0xea,0x4c,0x43,0xec,0x0a,
+  0xc9,0x08,0x90,0x04,0xa9,0x06,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,
+  0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,
+  0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xea,0xaa,0xbd,0x46,0xec,0x85,0xf5,0xbd,0x47,
+  0xec,0x85,0xf6,0x4c,0x74,0xeb,0x5e,0xec,0x9f,0xec,0xe0,0xec,0xa3,0xed,0x5e,0xec,
+  0x9f,0xec,0x69,0xed,0xa3,0xed,0x21,0xed,0x69,0xed,0x69,0xed,0xa3,0xed,0x31,0x33,
+  0x35,0x37,0x39,0x2b,0x5c,0x14,0x5f,0x57,0x52,0x59,0x49,0x50,0x2a,0x0d,0x04,0x41,
+  0x44,0x47,0x4a,0x4c,0x3b,0x1d,0x03,0x01,0x58,0x56,0x4e,0x2c,0x2f,0x11,0x20,0x5a,
+  0x43,0x42,0x4d,0x2e,0x01,0x85,0x02,0x53,0x46,0x48,0x4b,0x3a,0x3d,0x86,0x51,0x45,
+  0x54,0x55,0x4f,0x40,0x5e,0x87,0x32,0x34,0x36,0x38,0x30,0x2d,0x13,0x88,0xff,0x21,
+  0x23,0x25,0x27,0x29,0xdb,0xa9,0x94,0x5f,0xd7,0xd2,0xd9,0xc9,0xd0,0xc0,0x8d,0x04,
+  0xc1,0xc4,0xc7,0xca,0xcc,0x5d,0x9d,0x83,0x01,0xd8,0xd6,0xce,0x3c,0x3f,0x91,0xa0,
+  0xda,0xc3,0xc2,0xcd,0x3e,0x01,0x89,0x02,0xd3,0xc6,0xc8,0xcb,0x5b,0x3d,0x8a,0xd1,
+  0xc5,0xd4,0xd5,0xcf,0xba,0xde,0x8b,0x22,0x24,0x26,0x28,0x30,0xdd,0x93,0x8c,0xff,
+  0x21,0x23,0x25,0x27,0x29,0xa6,0xa8,0x94,0x5f,0xb3,0xb2,0xb7,0xa2,0xaf,0xdf,0x8d,
+  0x04,0xb0,0xac,0xa5,0xb5,0xb6,0x5d,0x9d,0x83,0x01,0xbd,0xbe,0xaa,0x3c,0x3f,0x91,
+  0xa0,0xad,0xbc,0xbf,0xa7,0x3e,0x01,0x89,0x02,0xae,0xbb,0xb4,0xa1,0x5b,0x3d,0x8a,
+  0xab,0xb1,0xa3,0xb8,0xb9,0xa4,0xde,0x8b,0x22,0x24,0x26,0x28,0x30,0xdc,0x93,0x8c,
+  0xff,0xc9,0x0e,0xd0,0x0b,0xa9,0x02,0x0d,0x05,0x90,0x8d,0x05,0x90,0x4c,0xdc,0xe6,
+  0xc9,0x8e,0xd0,0x0b,0xa9,0xfd,0x2d,0x05,0x90,0x8d,0x05,0x90,0x4c,0xdc,0xe6,0xc9,
+  0x08,0xd0,0x0a,0xa9,0x80,0x0d,0x91,0x02,0x8d,0x91,0x02,0x30,0xef,0xc9,0x09,0xd0,
+  0xeb,0xa9,0x7f,0x2d,0x91,0x02,0x8d,0x91,0x02,0x10,0xe1,0xe8,0xb5,0xd9,0x09,0x80,
+  0x95,0xd9,0xca,0xa5,0xd5,0x18,0x4c,0x15,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x04,0xff,0xff,0xff,0xff,0xff,0xe2,0x9d,0x83,0x01,0xff,0xff,0xff,0xff,
+  0xff,0x91,0xa0,0xff,0xff,0xff,0xff,0xee,0x01,0x89,0x02,0xff,0xff,0xff,0xff,0xe1,
+  0xfd,0x8a,0xff,0xff,0xff,0xff,0xff,0xb0,0xe0,0x8b,0xf2,0xf4,0xf6,0xff,0xf0,0xed,
+  0x93,0x8c,0xff,0x90,0x1c,0x9c,0x1f,0x12,0xff,0xff,0xff,0x06,0xff,0x12,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x05,0x9f,0x1e,0x9e,0x92,
+  0xff,0xff,0xff,0xff,0x05,0x19,0x16,0x2e,0x00,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x1b,0x4c,0x4f,0x41,0x44,0x0d,0x52,0x55,0x4e,0x0d,0x00,0x16,0x2c,
+  0x42,0x58,0x6e,0x84,0x9a,0xb0,0xc6,0xdc,0xf2,0x08,0x1e,0x34,0x4a,0x60,0x76,0x8c,
+  0xa2,0xb8,0xce,0xe4,0x09,0x40,0x2c,0x09,0x20,0x20,0x60,0xf1,0x48,0x24,0x94,0x10,
+  0x0a,0x38,0x66,0xa3,0x20,0x49,0xee,0x46,0x94,0x46,0xa3,0x68,0x85,0x95,0x20,0xa0,
+  0xe4,0xc9,0x3f,0xd0,0x03,0x20,0x84,0xef,0xad,0x1f,0x91,0x09,0x80,0x8d,0x1f,0x91,
+  0x20,0x8d,0xef,0x20,0xa0,0xe4,0x20,0x96,0xef,0x78,0x20,0xa0,0xe4,0x20,0xb2,0xe4,
+  0x4a,0xb0,0x61,0x20,0x84,0xef,0x24,0xa3,0x10,0x0c,0x20,0xb2,0xe4,0x4a,0x90,0xfa,
+  0x20,0xb2,0xe4,0x4a,0xb0,0xfa,0x20,0xb2,0xe4,0x4a,0x90,0xfa,0x20,0x8d,0xef,0xa9,
+  0x08,0x85,0xa5,0xad,0x1f,0x91,0xcd,0x1f,0x91,0xd0,0xf8,0x4a,0x4a,0x90,0x38,0x66,
+  0x95,0xb0,0x05,0x20,0xa9,0xe4,0xd0,0x03,0x20,0xa0,0xe4,0x20,0x84,0xef,0xea,0xea,
+  0xea,0xea,0xad,0x2c,0x91,0x29,0xdf,0x09,0x02,0x8d,0x2c,0x91,0xc6,0xa5,0xd0,0xd3,
+  0xa9,0x04,0x8d,0x29,0x91,0xad,0x2d,0x91,0x29,0x20,0xd0,0x0b,0x20,0xb2,0xe4,0x4a,
+  0xb0,0xf3,0x58,0x60,0xa9,0x80,0x2c,0xa9,0x03,0x20,0x6a,0xfe,0x58,0x18,0x90,0x49,
+  0x85,0x95,0x20,0x40,0xee,0xad,0x1f,0x91,0x29,0x7f,0x8d,0x1f,0x91,0x60,0x85,0x95,
+  0x20,0x40,0xee,0x78,0x20,0xa9,0xe4,0x20,0xc5,0xee,0x20,0x84,0xef,0x20,0xb2,0xe4,
+  0xb0,0xfb,0x58,0x60,0x24,0x94,0x30,0x05,0x38,0x66,0x94,0xd0,0x05,0x48,0x20,0x49,
+  0xee,0x68,0x85,0x95,0x18,0x60,0x20,0x8d,0xef,0xad,0x1f,0x91,0x09,0x80,0x8d,0x1f,
+  0x91,0xa9,0x5f,0x2c,0xa9,0x3f,0x20,0x1c,0xee,0x20,0xc5,0xee,0x8a,0xa2,0x0b,0xca,
+  0xd0,0xfd,0xaa,0x20,0x84,0xef,0x4c,0xa0,0xe4,0x78,0xa9,0x00,0x85,0xa5,0x20,0x84,
+  0xef,0x20,0xb2,0xe4,0x90,0xfb,0x20,0xa0,0xe4,0xa9,0x01,0x8d,0x29,0x91,0xad,0x2d,
+  0x91,0x29,0x20,0xd0,0x07,0x20,0xb2,0xe4,0xb0,0xf4,0x90,0x18,0xa5,0xa5,0xf0,0x05,
+  0xa9,0x02,0x4c,0xb9,0xee,0x20,0xa9,0xe4,0x20,0x0c,0xef,0xa9,0x40,0x20,0x6a,0xfe,
+  0xe6,0xa5,0xd0,0xd5,0xa9,0x08,0x85,0xa5,0xad,0x1f,0x91,0xcd,0x1f,0x91,0xd0,0xf8,
+  0x4a,0x90,0xf5,0x4a,0x66,0xa4,0xad,0x1f,0x91,0xcd,0x1f,0x91,0xd0,0xf8,0x4a,0xb0,
+  0xf5,0xc6,0xa5,0xd0,0xe3,0x20,0xa9,0xe4,0xa5,0x90,0xf0,0x03,0x20,0x0c,0xef,0xa5,
+  0xa4,0x58,0x18,0x60,0xad,0x2c,0x91,0x29,0xfd,0x8d,0x2c,0x91,0x60,0xad,0x2c,0x91,
+  0x09,0x02,0x8d,0x2c,0x91,0x60,0xa9,0x04,0x8d,0x29,0x91,0xad,0x2d,0x91,0x29,0x20,
+  0xf0,0xf9,0x60,0xa5,0xb4,0xf0,0x47,0x30,0x3f,0x46,0xb6,0xa2,0x00,0x90,0x01,0xca,
+  0x8a,0x45,0xbd,0x85,0xbd,0xc6,0xb4,0xf0,0x06,0x8a,0x29,0x20,0x85,0xb5,0x60,0xa9,
+  0x20,0x2c,0x94,0x02,0xf0,0x14,0x30,0x1c,0x70,0x14,0xa5,0xbd,0xd0,0x01,0xca,0xc6,
+  0xb4,0xad,0x93,0x02,0x10,0xe3,0xc6,0xb4,0xd0,0xdf,0xe6,0xb4,0xd0,0xf0,0xa5,0xbd,
+  0xf0,0xed,0xd0,0xea,0x70,0xe9,0x50,0xe6,0xe6,0xb4,0xa2,0xff,0xd0,0xcb,0xad,0x94,
+  0x02,0x4a,0x90,0x07,0x2c,0x20,0x91,0x10,0x1d,0x50,0x1e,0xa9,0x00,0x85,0xbd,0x85,
+  0xb5,0xae,0x98,0x02,0x86,0xb4,0xac,0x9d,0x02,0xcc,0x9e,0x02,0xf0,0x13,0xb1,0xf9,
+  0x85,0xb6,0xee,0x9d,0x02,0x60,0xa9,0x40,0x2c,0xa9,0x10,0x0d,0x97,0x02,0x8d,0x97,
+  0x02,0xa9,0x40,0x8d,0x1e,0x91,0x60,0xa2,0x09,0xa9,0x20,0x2c,0x93,0x02,0xf0,0x01,
+  0xca,0x50,0x02,0xca,0xca,0x60,0xa6,0xa9,0xd0,0x2e,0xc6,0xa8,0xf0,0x31,0x30,0x0d,
+  0xa5,0xa7,0x45,0xab,0x85,0xab,0x46,0xa7,0x66,0xaa,0x60,0xc6,0xa8,0xa5,0xa7,0xf0,
+  0x62,0xad,0x93,0x02,0x0a,0xa9,0x01,0x65,0xa8,0xd0,0xef,0xa9,0x90,0x8d,0x1e,0x91,
+  0x85,0xa9,0xa9,0x20,0x8d,0x1e,0x91,0x60,0xa5,0xa7,0xd0,0xef,0x85,0xa9,0x60,0xac,
+  0x9b,0x02,0xc8,0xcc,0x9c,0x02,0xf0,0x2a,0x8c,0x9b,0x02,0x88,0xa5,0xaa,0xae,0x98,
+  0x02,0xe0,0x09,0xf0,0x04,0x4a,0xe8,0xd0,0xf8,0x91,0xf7,0xa9,0x20,0x2c,0x94,0x02,
+  0xf0,0xb9,0x30,0xb6,0xa5,0xa7,0x45,0xab,0xf0,0x03,0x70,0xae,0x2c,0x50,0xab,0xa9,
+  0x01,0x2c,0xa9,0x04,0x2c,0xa9,0x80,0x2c,0xa9,0x02,0x0d,0x97,0x02,0x8d,0x97,0x02,
+  0x4c,0x5b,0xf0,0xa5,0xaa,0xd0,0xf1,0xf0,0xec,0x4c,0x96,0xf7,0x85,0x9a,0xad,0x94,
+  0x02,0x4a,0x90,0x27,0xa9,0x02,0x2c,0x10,0x91,0x10,0x1d,0xd0,0x1e,0xad,0x1e,0x91,
+  0x29,0x30,0xd0,0xf9,0x2c,0x10,0x91,0x70,0xfb,0xad,0x10,0x91,0x09,0x02,0x8d,0x10,
+  0x91,0x2c,0x10,0x91,0x70,0x05,0x30,0xf9,0x20,0x16,0xf0,0x18,0x60,0xac,0x9e,0x02,
+  0xc8,0xcc,0x9d,0x02,0xf0,0xf7,0x8c,0x9e,0x02,0x88,0x91,0xf9,0x2c,0x1e,0x91,0x50,
+  0x01,0x60,0xad,0x99,0x02,0x8d,0x14,0x91,0xad,0x9a,0x02,0x8d,0x15,0x91,0xa9,0xc0,
+  0x8d,0x1e,0x91,0x4c,0xee,0xef,0x85,0x99,0xad,0x94,0x02,0x4a,0x90,0x28,0x29,0x08,
+  0xf0,0x24,0xa9,0x02,0x2c,0x10,0x91,0x10,0xbf,0xf0,0x19,0x2c,0x1e,0x91,0x70,0xfb,
+  0xad,0x10,0x91,0x29,0xfd,0x8d,0x10,0x91,0xad,0x10,0x91,0x29,0x04,0xf0,0xf9,0xa9,
+  0x90,0x8d,0x1e,0x91,0x18,0x60,0xad,0x1e,0x91,0x29,0x30,0xf0,0xf2,0x18,0x60,0xac,
+  0x9c,0x02,0xcc,0x9b,0x02,0xf0,0x06,0xb1,0xf7,0xee,0x9c,0x02,0x60,0xa9,0x00,0x60,
+  0x48,0xad,0x1e,0x91,0xf0,0x0c,0xad,0x1e,0x91,0x29,0x60,0xd0,0xf9,0xa9,0x10,0x8d,
+  0x1e,0x91,0x68,0x60,0x0d,0x49,0x2f,0x4f,0x20,0x45,0x52,0x52,0x4f,0x52,0x20,0xa3,
+  0x0d,0x53,0x45,0x41,0x52,0x43,0x48,0x49,0x4e,0x47,0xa0,0x46,0x4f,0x52,0xa0,0x0d,
+  0x50,0x52,0x45,0x53,0x53,0x20,0x50,0x4c,0x41,0x59,0x20,0x4f,0x4e,0x20,0x54,0x41,
+  0x50,0xc5,0x50,0x52,0x45,0x53,0x53,0x20,0x52,0x45,0x43,0x4f,0x52,0x44,0x20,0x26,
+  0x20,0x50,0x4c,0x41,0x59,0x20,0x4f,0x4e,0x20,0x54,0x41,0x50,0xc5,0x0d,0x4c,0x4f,
+  0x41,0x44,0x49,0x4e,0xc7,0x0d,0x53,0x41,0x56,0x49,0x4e,0x47,0xa0,0x0d,0x56,0x45,
+  0x52,0x49,0x46,0x59,0x49,0x4e,0xc7,0x0d,0x46,0x4f,0x55,0x4e,0x44,0xa0,0x0d,0x4f,
+  0x4b,0x8d,0x24,0x9d,0x10,0x0d,0xb9,0x74,0xf1,0x08,0x29,0x7f,0x20,0xd2,0xff,0xc8,
+  0x28,0x10,0xf3,0x18,0x60,0xa5,0x99,0xd0,0x08,0xa5,0xc6,0xf0,0x6d,0x78,0x4c,0xcf,
+  0xe5,0xc9,0x02,0xd0,0x18,0x84,0x97,0x20,0x4f,0xf1,0xa4,0x97,0x18,0x60,0xa5,0x99,
+  0xd0,0x0b,0xa5,0xd3,0x85,0xca,0xa5,0xd6,0x85,0xc9,0x4c,0x4f,0xe6,0xc9,0x03,0xd0,
+  0x09,0x85,0xd0,0xa5,0xd5,0x85,0xc8,0x4c,0x4f,0xe6,0xb0,0x38,0xc9,0x02,0xf0,0x3f,
+  0x86,0x97,0x20,0x50,0xf2,0xb0,0x16,0x48,0x20,0x50,0xf2,0xb0,0x0d,0xd0,0x05,0xa9,
+  0x40,0x20,0x6a,0xfe,0xc6,0xa6,0xa6,0x97,0x68,0x60,0xaa,0x68,0x8a,0xa6,0x97,0x60,
+  0x20,0x8a,0xf8,0xd0,0x0b,0x20,0xc0,0xf8,0xb0,0x11,0xa9,0x00,0x85,0xa6,0xf0,0xf0,
+  0xb1,0xb2,0x18,0x60,0xa5,0x90,0xf0,0x04,0xa9,0x0d,0x18,0x60,0x4c,0x19,0xef,0x20,
+  0x05,0xf2,0xb0,0x05,0xc9,0x00,0xf0,0xf7,0x18,0x60,0x48,0xa5,0x9a,0xc9,0x03,0xd0,
+  0x04,0x68,0x4c,0x42,0xe7,0x90,0x04,0x68,0x4c,0xe4,0xee,0xc9,0x02,0xf0,0x2a,0x68,
+  0x85,0x9e,0x48,0x8a,0x48,0x98,0x48,0x20,0x8a,0xf8,0xd0,0x0e,0x20,0xe3,0xf8,0xb0,
+  0x0e,0xa9,0x02,0xa0,0x00,0x91,0xb2,0xc8,0x84,0xa6,0xa5,0x9e,0x91,0xb2,0x18,0x68,
+  0xa8,0x68,0xaa,0x68,0x90,0x02,0xa9,0x00,0x60,0x68,0x86,0x97,0x84,0x9e,0x20,0xed,
+  0xf0,0xa6,0x97,0xa4,0x9e,0x18,0x60,0x20,0xcf,0xf3,0xf0,0x03,0x4c,0x84,0xf7,0x20,
+  0xdf,0xf3,0xa5,0xba,0xf0,0x16,0xc9,0x03,0xf0,0x12,0xb0,0x14,0xc9,0x02,0xd0,0x03,
+  0x4c,0x16,0xf1,0xa6,0xb9,0xe0,0x60,0xf0,0x03,0x4c,0x8d,0xf7,0x85,0x99,0x18,0x60,
+  0xaa,0x20,0x14,0xee,0xa5,0xb9,0x10,0x06,0x20,0xd3,0xee,0x4c,0x01,0xf3,0x20,0xce,
+  0xee,0x8a,0x24,0x90,0x10,0xe6,0x4c,0x8a,0xf7,0x20,0xcf,0xf3,0xf0,0x03,0x4c,0x84,
+  0xf7,0x20,0xdf,0xf3,0xa5,0xba,0xd0,0x03,0x4c,0x90,0xf7,0xc9,0x03,0xf0,0x0f,0xb0,
+  0x11,0xc9,0x02,0xd0,0x03,0x4c,0xbc,0xf0,0xa6,0xb9,0xe0,0x60,0xf0,0xea,0x85,0x9a,
+  0x18,0x60,0xaa,0x20,0x17,0xee,0xa5,0xb9,0x10,0x05,0x20,0xc5,0xee,0xd0,0x03,0x20,
+  0xc0,0xee,0x8a,0x24,0x90,0x10,0xe7,0x4c,0x8a,0xf7,0x20,0xd4,0xf3,0xf0,0x02,0x18,
+  0x60,0x20,0xdf,0xf3,0x8a,0x48,0xa5,0xba,0xf0,0x57,0xc9,0x03,0xf0,0x53,0xb0,0x4e,
+  0xc9,0x02,0xd0,0x29,0x68,0x20,0xb2,0xf3,0xa9,0x7d,0x8d,0x1e,0x91,0xa9,0x06,0x8d,
+  0x10,0x91,0xa9,0xee,0x8d,0x1c,0x91,0x20,0x75,0xfe,0xa5,0xf8,0xf0,0x01,0xc8,0xa5,
+  0xfa,0xf0,0x01,0xc8,0xa9,0x00,0x85,0xf8,0x85,0xfa,0x4c,0x3c,0xf5,0xa5,0xb9,0x29,
+  0x0f,0xf0,0x1e,0x20,0x4d,0xf8,0xa9,0x00,0x20,0x90,0xf2,0x4c,0xcf,0xe4,0xb0,0x2e,
+  0xa5,0xb9,0xc9,0x62,0xd0,0x0b,0xa9,0x05,0x20,0xe7,0xf7,0x4c,0xb1,0xf3,0x20,0xda,
+  0xf6,0x68,0xaa,0xc6,0x98,0xe4,0x98,0xf0,0x14,0xa4,0x98,0xb9,0x59,0x02,0x9d,0x59,
+  0x02,0xb9,0x63,0x02,0x9d,0x63,0x02,0xb9,0x6d,0x02,0x9d,0x6d,0x02,0x18,0x60,0xa9,
+  0x00,0x85,0x90,0x8a,0xa6,0x98,0xca,0x30,0x15,0xdd,0x59,0x02,0xd0,0xf8,0x60,0xbd,
+  0x59,0x02,0x85,0xb8,0xbd,0x63,0x02,0x85,0xba,0xbd,0x6d,0x02,0x85,0xb9,0x60,0xa9,
+  0x00,0x85,0x98,0xa2,0x03,0xe4,0x9a,0xb0,0x03,0x20,0x04,0xef,0xe4,0x99,0xb0,0x03,
+  0x20,0xf6,0xee,0x86,0x9a,0xa9,0x00,0x85,0x99,0x60,0xa6,0xb8,0xd0,0x03,0x4c,0x8d,
+  0xf7,0x20,0xcf,0xf3,0xd0,0x03,0x4c,0x81,0xf7,0xa6,0x98,0xe0,0x0a,0x90,0x03,0x4c,
+  0x7e,0xf7,0xe6,0x98,0xa5,0xb8,0x9d,0x59,0x02,0xa5,0xb9,0x09,0x60,0x85,0xb9,0x9d,
+  0x6d,0x02,0xa5,0xba,0x9d,0x63,0x02,0xf0,0x5a,0xc9,0x03,0xf0,0x56,0x90,0x05,0x20,
+  0x95,0xf4,0x90,0x4f,0xc9,0x02,0xd0,0x03,0x4c,0xc7,0xf4,0x20,0x4d,0xf8,0xb0,0x03,
+  0x4c,0x96,0xf7,0xa5,0xb9,0x29,0x0f,0xd0,0x1f,0x20,0x94,0xf8,0xb0,0x36,0x20,0x47,
+  0xf6,0xa5,0xb7,0xf0,0x0a,0x20,0x67,0xf8,0x90,0x18,0xf0,0x28,0x4c,0x87,0xf7,0x20,
+  0xaf,0xf7,0xf0,0x20,0x90,0x0c,0xb0,0xf4,0x20,0xb7,0xf8,0xb0,0x17,0xa9,0x04,0x20,
+  0xe7,0xf7,0xa9,0xbf,0xa4,0xb9,0xc0,0x60,0xf0,0x07,0xa0,0x00,0xa9,0x02,0x91,0xb2,
+  0x98,0x85,0xa6,0x18,0x60,0xa5,0xb9,0x30,0x2c,0xa4,0xb7,0xf0,0x28,0xa5,0xba,0x20,
+  0x17,0xee,0xa5,0xb9,0x09,0xf0,0x20,0xc0,0xee,0xa5,0x90,0x10,0x05,0x68,0x68,0x4c,
+  0x8a,0xf7,0xa5,0xb7,0xf0,0x0c,0xa0,0x00,0xb1,0xbb,0x20,0xe4,0xee,0xc8,0xc4,0xb7,
+  0xd0,0xf6,0x20,0x04,0xef,0x18,0x60,0xa9,0x06,0x8d,0x12,0x91,0x8d,0x10,0x91,0xa9,
+  0xee,0x8d,0x1c,0x91,0xa0,0x00,0x8c,0x97,0x02,0xc4,0xb7,0xf0,0x0a,0xb1,0xbb,0x99,
+  0x93,0x02,0xc8,0xc0,0x04,0xd0,0xf2,0x20,0x27,0xf0,0x8e,0x98,0x02,0xad,0x93,0x02,
+  0x29,0x0f,0xd0,0x00,0x0a,0xaa,0xbd,0x5a,0xff,0x0a,0xa8,0xbd,0x5b,0xff,0x2a,0x48,
+  0x98,0x69,0xc8,0x8d,0x99,0x02,0x68,0x69,0x00,0x8d,0x9a,0x02,0xad,0x94,0x02,0x4a,
+  0x90,0x09,0xad,0x20,0x91,0x0a,0xb0,0x03,0x4c,0x16,0xf0,0xad,0x9b,0x02,0x8d,0x9c,
+  0x02,0xad,0x9e,0x02,0x8d,0x9d,0x02,0x20,0x75,0xfe,0xa5,0xf8,0xd0,0x05,0x88,0x84,
+  0xf8,0x86,0xf7,0xa5,0xfa,0xd0,0x05,0x88,0x84,0xfa,0x86,0xf9,0x38,0xa9,0xf0,0x4c,
+  0x7b,0xfe,0x86,0xc3,0x84,0xc4,0x6c,0x30,0x03,0x85,0x93,0xa9,0x00,0x85,0x90,0xa5,
+  0xba,0xd0,0x03,0x4c,0x96,0xf7,0xc9,0x03,0xf0,0xf9,0x90,0x6e,0xa4,0xb7,0xd0,0x03,
+  0x4c,0x93,0xf7,0x20,0xbc,0xe4,0xa9,0x60,0x85,0xb9,0x20,0x95,0xf4,0xa5,0xba,0x20,
+  0x14,0xee,0xa5,0xb9,0x20,0xce,0xee,0x20,0x19,0xef,0x85,0xae,0xa5,0x90,0x4a,0x4a,
+  0xb0,0x45,0x20,0x19,0xef,0x85,0xaf,0x20,0xc1,0xe4,0xa9,0xfd,0x25,0x90,0x85,0x90,
+  0x20,0xe1,0xff,0xd0,0x03,0x4c,0xcb,0xf6,0x20,0x19,0xef,0xaa,0xa5,0x90,0x4a,0x4a,
+  0xb0,0xe8,0x8a,0xa4,0x93,0xf0,0x0c,0xa0,0x00,0xd1,0xae,0xf0,0x08,0xa9,0x10,0x20,
+  0x6a,0xfe,0x2c,0x91,0xae,0xe6,0xae,0xd0,0x02,0xe6,0xaf,0x24,0x90,0x50,0xcb,0x20,
+  0xf6,0xee,0x20,0xda,0xf6,0x90,0x7a,0x4c,0x87,0xf7,0xc9,0x02,0xd0,0x03,0x4c,0xb9,
+  0xf0,0x20,0x4d,0xf8,0xb0,0x03,0x4c,0x96,0xf7,0x20,0x94,0xf8,0xb0,0x68,0x20,0x47,
+  0xf6,0xa5,0xb7,0xf0,0x09,0x20,0x67,0xf8,0x90,0x0b,0xf0,0x5a,0xb0,0xd9,0x20,0xaf,
+  0xf7,0xf0,0x53,0xb0,0xd2,0xa5,0x90,0x29,0x10,0x38,0xd0,0x4a,0xe0,0x01,0xf0,0x11,
+  0xe0,0x03,0xd0,0xdd,0xa0,0x01,0xb1,0xb2,0x85,0xc3,0xc8,0xb1,0xb2,0x85,0xc4,0xb0,
+  0x04,0xa5,0xb9,0xd0,0xef,0xa0,0x03,0xb1,0xb2,0xa0,0x01,0xf1,0xb2,0xaa,0xa0,0x04,
+  0xb1,0xb2,0xa0,0x02,0xf1,0xb2,0xa8,0x18,0x8a,0x65,0xc3,0x85,0xae,0x98,0x65,0xc4,
+  0x85,0xaf,0xa5,0xc3,0x85,0xc1,0xa5,0xc4,0x85,0xc2,0x20,0x6a,0xf6,0x20,0xc9,0xf8,
+  0x24,0x18,0xa6,0xae,0xa4,0xaf,0x60,0xa5,0x9d,0x10,0x1e,0xa0,0x0c,0x20,0xe6,0xf1,
+  0xa5,0xb7,0xf0,0x15,0xa0,0x17,0x20,0xe6,0xf1,0xa4,0xb7,0xf0,0x0c,0xa0,0x00,0xb1,
+  0xbb,0x20,0xd2,0xff,0xc8,0xc4,0xb7,0xd0,0xf6,0x60,0xa0,0x49,0xa5,0x93,0xf0,0x02,
+  0xa0,0x59,0x4c,0xe2,0xf1,0x86,0xae,0x84,0xaf,0xaa,0xb5,0x00,0x85,0xc1,0xb5,0x01,
+  0x85,0xc2,0x6c,0x32,0x03,0xa5,0xba,0xd0,0x03,0x4c,0x96,0xf7,0xc9,0x03,0xf0,0xf9,
+  0x90,0x5f,0xa9,0x61,0x85,0xb9,0xa4,0xb7,0xd0,0x03,0x4c,0x93,0xf7,0x20,0x95,0xf4,
+  0x20,0x28,0xf7,0xa5,0xba,0x20,0x17,0xee,0xa5,0xb9,0x20,0xc0,0xee,0xa0,0x00,0x20,
+  0xd2,0xfb,0xa5,0xac,0x20,0xe4,0xee,0xa5,0xad,0x20,0xe4,0xee,0x20,0x11,0xfd,0xb0,
+  0x16,0xb1,0xac,0x20,0xe4,0xee,0x20,0xe1,0xff,0xd0,0x07,0x20,0xda,0xf6,0xa9,0x00,
+  0x38,0x60,0x20,0x1b,0xfd,0xd0,0xe5,0x20,0x04,0xef,0x24,0xb9,0x30,0x11,0xa5,0xba,
+  0x20,0x17,0xee,0xa5,0xb9,0x29,0xef,0x09,0xe0,0x20,0xc0,0xee,0x20,0x04,0xef,0x18,
+  0x60,0xc9,0x02,0xd0,0x03,0x4c,0xb9,0xf0,0x20,0x4d,0xf8,0x90,0x8c,0x20,0xb7,0xf8,
+  0xb0,0x25,0x20,0x28,0xf7,0xa2,0x03,0xa5,0xb9,0x29,0x01,0xd0,0x02,0xa2,0x01,0x8a,
+  0x20,0xe7,0xf7,0xb0,0x12,0x20,0xe6,0xf8,0xb0,0x0d,0xa5,0xb9,0x29,0x02,0xf0,0x06,
+  0xa9,0x05,0x20,0xe7,0xf7,0x24,0x18,0x60,0xa5,0x9d,0x10,0xfb,0xa0,0x51,0x20,0xe6,
+  0xf1,0x4c,0x59,0xf6,0xa2,0x00,0xe6,0xa2,0xd0,0x06,0xe6,0xa1,0xd0,0x02,0xe6,0xa0,
+  0x38,0xa5,0xa2,0xe9,0x01,0xa5,0xa1,0xe9,0x1a,0xa5,0xa0,0xe9,0x4f,0x90,0x06,0x86,
+  0xa0,0x86,0xa1,0x86,0xa2,0xad,0x2f,0x91,0xcd,0x2f,0x91,0xd0,0xf8,0x85,0x91,0x60,
+  0x78,0xa5,0xa2,0xa6,0xa1,0xa4,0xa0,0x78,0x85,0xa2,0x86,0xa1,0x84,0xa0,0x58,0x60,
+  0xa5,0x91,0xc9,0xfe,0xd0,0x07,0x08,0x20,0xcc,0xff,0x85,0xc6,0x28,0x60,0xa9,0x01,
+  0x2c,0xa9,0x02,0x2c,0xa9,0x03,0x2c,0xa9,0x04,0x2c,0xa9,0x05,0x2c,0xa9,0x06,0x2c,
+  0xa9,0x07,0x2c,0xa9,0x08,0x2c,0xa9,0x09,0x48,0x20,0xcc,0xff,0xa0,0x00,0x24,0x9d,
+  0x50,0x0a,0x20,0xe6,0xf1,0x68,0x48,0x09,0x30,0x20,0xd2,0xff,0x68,0x38,0x60,0xa5,
+  0x93,0x48,0x20,0xc0,0xf8,0x68,0x85,0x93,0xb0,0x2c,0xa0,0x00,0xb1,0xb2,0xc9,0x05,
+  0xf0,0x24,0xc9,0x01,0xf0,0x08,0xc9,0x03,0xf0,0x04,0xc9,0x04,0xd0,0xe1,0xaa,0x24,
+  0x9d,0x10,0x11,0xa0,0x63,0x20,0xe6,0xf1,0xa0,0x05,0xb1,0xb2,0x20,0xd2,0xff,0xc8,
+  0xc0,0x15,0xd0,0xf6,0x18,0x88,0x60,0x85,0x9e,0x20,0x4d,0xf8,0x90,0x5e,0xa5,0xc2,
+  0x48,0xa5,0xc1,0x48,0xa5,0xaf,0x48,0xa5,0xae,0x48,0xa0,0xbf,0xa9,0x20,0x91,0xb2,
+  0x88,0xd0,0xfb,0xa5,0x9e,0x91,0xb2,0xc8,0xa5,0xc1,0x91,0xb2,0xc8,0xa5,0xc2,0x91,
+  0xb2,0xc8,0xa5,0xae,0x91,0xb2,0xc8,0xa5,0xaf,0x91,0xb2,0xc8,0x84,0x9f,0xa0,0x00,
+  0x84,0x9e,0xa4,0x9e,0xc4,0xb7,0xf0,0x0c,0xb1,0xbb,0xa4,0x9f,0x91,0xb2,0xe6,0x9e,
+  0xe6,0x9f,0xd0,0xee,0x20,0x54,0xf8,0xa9,0x69,0x85,0xab,0x20,0xea,0xf8,0xa8,0x68,
+  0x85,0xae,0x68,0x85,0xaf,0x68,0x85,0xc1,0x68,0x85,0xc2,0x98,0x60,0xa6,0xb2,0xa4,
+  0xb3,0xc0,0x02,0x60,0x20,0x4d,0xf8,0x8a,0x85,0xc1,0x18,0x69,0xc0,0x85,0xae,0x98,
+  0x85,0xc2,0x69,0x00,0x85,0xaf,0x60,0x20,0xaf,0xf7,0xb0,0x1d,0xa0,0x05,0x84,0x9f,
+  0xa0,0x00,0x84,0x9e,0xc4,0xb7,0xf0,0x10,0xb1,0xbb,0xa4,0x9f,0xd1,0xb2,0xd0,0xe7,
+  0xe6,0x9e,0xe6,0x9f,0xa4,0x9e,0xd0,0xec,0x18,0x60,0x20,0x4d,0xf8,0xe6,0xa6,0xa4,
+  0xa6,0xc0,0xc0,0x60,0x20,0xab,0xf8,0xf0,0x1c,0xa0,0x1b,0x20,0xe6,0xf1,0x20,0x4b,
+  0xf9,0x20,0xab,0xf8,0xd0,0xf8,0xa0,0x6a,0x4c,0xe6,0xf1,0xa9,0x40,0x2c,0x1f,0x91,
+  0xd0,0x03,0x2c,0x1f,0x91,0x18,0x60,0x20,0xab,0xf8,0xf0,0xf9,0xa0,0x2e,0xd0,0xdb,
+  0xa9,0x00,0x85,0x90,0x85,0x93,0x20,0x54,0xf8,0x20,0x94,0xf8,0xb0,0x1f,0x78,0xa9,
+  0x00,0x85,0xaa,0x85,0xb4,0x85,0xb0,0x85,0x9e,0x85,0x9f,0x85,0x9c,0xa9,0x82,0xa2,
+  0x0e,0xd0,0x11,0x20,0x54,0xf8,0xa9,0x14,0x85,0xab,0x20,0xb7,0xf8,0xb0,0x68,0x78,
+  0xa9,0xa0,0xa2,0x08,0xa0,0x7f,0x8c,0x2e,0x91,0x8d,0x2e,0x91,0x20,0x60,0xf1,0xad,
+  0x14,0x03,0x8d,0x9f,0x02,0xad,0x15,0x03,0x8d,0xa0,0x02,0x20,0xfb,0xfc,0xa9,0x02,
+  0x85,0xbe,0x20,0xdb,0xfb,0xad,0x1c,0x91,0x29,0xfd,0x09,0x0c,0x8d,0x1c,0x91,0x85,
+  0xc0,0xa2,0xff,0xa0,0xff,0x88,0xd0,0xfd,0xca,0xd0,0xf8,0x8d,0x29,0x91,0x58,0xad,
+  0xa0,0x02,0xcd,0x15,0x03,0x18,0xf0,0x1f,0x20,0x4b,0xf9,0xad,0x2d,0x91,0x29,0x40,
+  0xf0,0xed,0xad,0x14,0x91,0x20,0x34,0xf7,0x4c,0x2f,0xf9,0x20,0xe1,0xff,0x18,0xd0,
+  0x0b,0x20,0xcf,0xfc,0x38,0x68,0x68,0xa9,0x00,0x8d,0xa0,0x02,0x60,0x86,0xb1,0xa5,
+  0xb0,0x0a,0x0a,0x18,0x65,0xb0,0x18,0x65,0xb1,0x85,0xb1,0xa9,0x00,0x24,0xb0,0x30,
+  0x01,0x2a,0x06,0xb1,0x2a,0x06,0xb1,0x2a,0xaa,0xad,0x28,0x91,0xc9,0x15,0x90,0xf9,
+  0x65,0xb1,0x8d,0x24,0x91,0x8a,0x6d,0x29,0x91,0x8d,0x25,0x91,0x58,0x60,0xae,0x29,
+  0x91,0xa0,0xff,0x98,0xed,0x28,0x91,0xec,0x29,0x91,0xd0,0xf2,0x86,0xb1,0xaa,0x8c,
+  0x28,0x91,0x8c,0x29,0x91,0x98,0xe5,0xb1,0x86,0xb1,0x4a,0x66,0xb1,0x4a,0x66,0xb1,
+  0xa5,0xb0,0x18,0x69,0x3c,0x2c,0x21,0x91,0xc5,0xb1,0xb0,0x4a,0xa6,0x9c,0xf0,0x03,
+  0x4c,0xad,0xfa,0xa6,0xa3,0x30,0x1b,0xa2,0x00,0x69,0x30,0x65,0xb0,0xc5,0xb1,0xb0,
+  0x1c,0xe8,0x69,0x26,0x65,0xb0,0xc5,0xb1,0xb0,0x17,0x69,0x2c,0x65,0xb0,0xc5,0xb1,
+  0x90,0x03,0x4c,0x60,0xfa,0xa5,0xb4,0xf0,0x1d,0x85,0xa8,0xd0,0x19,0xe6,0xa9,0xb0,
+  0x02,0xc6,0xa9,0x38,0xe9,0x13,0xe5,0xb1,0x65,0x92,0x85,0x92,0xa5,0xa4,0x49,0x01,
+  0x85,0xa4,0xf0,0x21,0x86,0xd7,0xa5,0xb4,0xf0,0x18,0x2c,0x2d,0x91,0x50,0x13,0xa9,
+  0x00,0x85,0xa4,0xa5,0xa3,0x10,0x30,0x30,0xc9,0xa2,0xa6,0x20,0x5d,0xf9,0xa5,0x9b,
+  0xd0,0xc3,0x4c,0x56,0xff,0xa5,0x92,0xf0,0x07,0x30,0x03,0xc6,0xb0,0x2c,0xe6,0xb0,
+  0xa9,0x00,0x85,0x92,0xe4,0xd7,0xd0,0x0f,0x8a,0xd0,0xaa,0xa5,0xa9,0x30,0xc7,0xc9,
+  0x10,0x90,0xc3,0x85,0x96,0xb0,0xbf,0x8a,0x45,0x9b,0x85,0x9b,0xa5,0xb4,0xf0,0xd2,
+  0xc6,0xa3,0x30,0xc5,0x46,0xd7,0x66,0xbf,0xa2,0xda,0x20,0x5d,0xf9,0x4c,0x56,0xff,
+  0xa5,0x96,0xf0,0x04,0xa5,0xb4,0xf0,0x04,0xa5,0xa3,0x10,0x85,0x46,0xb1,0xa9,0x93,
+  0x38,0xe5,0xb1,0x65,0xb0,0x0a,0xaa,0x20,0x5d,0xf9,0xe6,0x9c,0xa5,0xb4,0xd0,0x11,
+  0xa5,0x96,0xf0,0x26,0x85,0xa8,0xa9,0x00,0x85,0x96,0xa9,0xc0,0x8d,0x2e,0x91,0x85,
+  0xb4,0xa5,0x96,0x85,0xb5,0xf0,0x09,0xa9,0x00,0x85,0xb4,0xa9,0x40,0x8d,0x2e,0x91,
+  0xa5,0xbf,0x85,0xbd,0xa5,0xa8,0x05,0xa9,0x85,0xb6,0x4c,0x56,0xff,0x20,0xdb,0xfb,
+  0x85,0x9c,0xa2,0xda,0x20,0x5d,0xf9,0xa5,0xbe,0xf0,0x02,0x85,0xa7,0xa9,0x0f,0x24,
+  0xaa,0x10,0x17,0xa5,0xb5,0xd0,0x0c,0xa6,0xbe,0xca,0xd0,0x0b,0xa9,0x08,0x20,0x6a,
+  0xfe,0xd0,0x04,0xa9,0x00,0x85,0xaa,0x4c,0x56,0xff,0x70,0x31,0xd0,0x18,0xa5,0xb5,
+  0xd0,0xf5,0xa5,0xb6,0xd0,0xf1,0xa5,0xa7,0x4a,0xa5,0xbd,0x30,0x03,0x90,0x18,0x18,
+  0xb0,0x15,0x29,0x0f,0x85,0xaa,0xc6,0xaa,0xd0,0xdd,0xa9,0x40,0x85,0xaa,0x20,0xd2,
+  0xfb,0xa9,0x00,0x85,0xab,0xf0,0xd0,0xa9,0x80,0x85,0xaa,0xd0,0xca,0xa5,0xb5,0xf0,
+  0x0a,0xa9,0x04,0x20,0x6a,0xfe,0xa9,0x00,0x4c,0x97,0xfb,0x20,0x11,0xfd,0x90,0x03,
+  0x4c,0x95,0xfb,0xa6,0xa7,0xca,0xf0,0x2d,0xa5,0x93,0xf0,0x0c,0xa0,0x00,0xa5,0xbd,
+  0xd1,0xac,0xf0,0x04,0xa9,0x01,0x85,0xb6,0xa5,0xb6,0xf0,0x4b,0xa2,0x3d,0xe4,0x9e,
+  0x90,0x3e,0xa6,0x9e,0xa5,0xad,0x9d,0x01,0x01,0xa5,0xac,0x9d,0x00,0x01,0xe8,0xe8,
+  0x86,0x9e,0x4c,0x87,0xfb,0xa6,0x9f,0xe4,0x9e,0xf0,0x35,0xa5,0xac,0xdd,0x00,0x01,
+  0xd0,0x2e,0xa5,0xad,0xdd,0x01,0x01,0xd0,0x27,0xe6,0x9f,0xe6,0x9f,0xa5,0x93,0xf0,
+  0x0b,0xa5,0xbd,0xa0,0x00,0xd1,0xac,0xf0,0x17,0xc8,0x84,0xb6,0xa5,0xb6,0xf0,0x07,
+  0xa9,0x10,0x20,0x6a,0xfe,0xd0,0x09,0xa5,0x93,0xd0,0x05,0xa8,0xa5,0xbd,0x91,0xac,
+  0x20,0x1b,0xfd,0xd0,0x3a,0xa9,0x80,0x85,0xaa,0xa6,0xbe,0xca,0x30,0x02,0x86,0xbe,
+  0xc6,0xa7,0xf0,0x08,0xa5,0x9e,0xd0,0x27,0x85,0xbe,0xf0,0x23,0x20,0xcf,0xfc,0x20,
+  0xd2,0xfb,0xa0,0x00,0x84,0xab,0xb1,0xac,0x45,0xab,0x85,0xab,0x20,0x1b,0xfd,0x20,
+  0x11,0xfd,0x90,0xf2,0xa5,0xab,0x45,0xbd,0xf0,0x05,0xa9,0x20,0x20,0x6a,0xfe,0x4c,
+  0x56,0xff,0xa5,0xc2,0x85,0xad,0xa5,0xc1,0x85,0xac,0x60,0xa9,0x08,0x85,0xa3,0xa9,
+  0x00,0x85,0xa4,0x85,0xa8,0x85,0x9b,0x85,0xa9,0x60,0xa5,0xbd,0x4a,0xa9,0x60,0x90,
+  0x02,0xa9,0xb0,0xa2,0x00,0x8d,0x28,0x91,0x8e,0x29,0x91,0xad,0x20,0x91,0x49,0x08,
+  0x8d,0x20,0x91,0x29,0x08,0x60,0x38,0x66,0xad,0x30,0x3c,0xa5,0xa8,0xd0,0x12,0xa9,
+  0x10,0xa2,0x01,0x20,0xf5,0xfb,0xd0,0x2f,0xe6,0xa8,0xa5,0xad,0x10,0x29,0x4c,0x95,
+  0xfc,0xa5,0xa9,0xd0,0x09,0x20,0xf1,0xfb,0xd0,0x1d,0xe6,0xa9,0xd0,0x19,0x20,0xea,
+  0xfb,0xd0,0x14,0xa5,0xa4,0x49,0x01,0x85,0xa4,0xf0,0x0f,0xa5,0xbd,0x49,0x01,0x85,
+  0xbd,0x29,0x01,0x45,0x9b,0x85,0x9b,0x4c,0x56,0xff,0x46,0xbd,0xc6,0xa3,0xa5,0xa3,
+  0xf0,0x3a,0x10,0xf3,0x20,0xdb,0xfb,0x58,0xa5,0xa5,0xf0,0x12,0xa2,0x00,0x86,0xd7,
+  0xc6,0xa5,0xa6,0xbe,0xe0,0x02,0xd0,0x02,0x09,0x80,0x85,0xbd,0xd0,0xd9,0x20,0x11,
+  0xfd,0x90,0x0a,0xd0,0x91,0xe6,0xad,0xa5,0xd7,0x85,0xbd,0xb0,0xca,0xa0,0x00,0xb1,
+  0xac,0x85,0xbd,0x45,0xd7,0x85,0xd7,0x20,0x1b,0xfd,0xd0,0xbb,0xa5,0x9b,0x49,0x01,
+  0x85,0xbd,0x4c,0x56,0xff,0xc6,0xbe,0xd0,0x03,0x20,0x08,0xfd,0xa9,0x50,0x85,0xa7,
+  0xa2,0x08,0x78,0x20,0xfb,0xfc,0xd0,0xea,0xa9,0x78,0x20,0xf3,0xfb,0xd0,0xe3,0xc6,
+  0xa7,0xd0,0xdf,0x20,0xdb,0xfb,0xc6,0xab,0x10,0xd8,0xa2,0x0a,0x20,0xfb,0xfc,0x58,
+  0xe6,0xab,0xa5,0xbe,0xf0,0x30,0x20,0xd2,0xfb,0xa2,0x09,0x86,0xa5,0xd0,0x85,0x08,
+  0x78,0x20,0x08,0xfd,0xa9,0x7f,0x8d,0x2e,0x91,0xa9,0xf7,0x8d,0x20,0x91,0xa9,0x40,
+  0x8d,0x2b,0x91,0x20,0x39,0xfe,0xad,0xa0,0x02,0xf0,0x09,0x8d,0x15,0x03,0xad,0x9f,
+  0x02,0x8d,0x14,0x03,0x28,0x60,0x20,0xcf,0xfc,0xf0,0x97,0xbd,0xe9,0xfd,0x8d,0x14,
+  0x03,0xbd,0xea,0xfd,0x8d,0x15,0x03,0x60,0xad,0x1c,0x91,0x09,0x0e,0x8d,0x1c,0x91,
+  0x60,0x38,0xa5,0xac,0xe5,0xae,0xa5,0xad,0xe5,0xaf,0x60,0xe6,0xac,0xd0,0x02,0xe6,
+  0xad,0x60,0xa2,0xff,0x78,0x9a,0xd8,0x20,0x3f,0xfd,0xd0,0x03,0x6c,0x00,0xa0,0x20,
+  0x8d,0xfd,0x20,0x52,0xfd,0x20,0xf9,0xfd,0x20,0x18,0xe5,0x58,0x6c,0x00,0xc0,0xa2,
+  0x05,0xbd,0x4c,0xfd,0xdd,0x03,0xa0,0xd0,0x03,0xca,0xd0,0xf5,0x60,0x41,0x30,0xc3,
+  0xc2,0xcd,0xa2,0x6d,0xa0,0xfd,0x18,0x86,0xc3,0x84,0xc4,0xa0,0x1f,0xb9,0x14,0x03,
+  0xb0,0x02,0xb1,0xc3,0x91,0xc3,0x99,0x14,0x03,0x88,0x10,0xf1,0x60,0xbf,0xea,0xd2,
+  0xfe,0xad,0xfe,0x0a,0xf4,0x4a,0xf3,0xc7,0xf2,0x09,0xf3,0xf3,0xf3,0x0e,0xf2,0x7a,
+  0xf2,0x70,0xf7,0xf5,0xf1,0xef,0xf3,0xd2,0xfe,0x49,0xf5,0x85,0xf6,0xa9,0x00,0xaa,
+  0x95,0x00,0x9d,0x00,0x02,0x9d,0x00,0x03,0xe8,0xd0,0xf5,0xa2,0x3c,0xa0,0x03,0x86,
+  0xb2,0x84,0xb3,0x85,0xc1,0x85,0x97,0x8d,0x81,0x02,0xa8,0xa9,0x04,0x85,0xc2,0xe6,
+  0xc1,0xd0,0x02,0xe6,0xc2,0x20,0x91,0xfe,0xa5,0x97,0xf0,0x22,0xb0,0xf1,0xa4,0xc2,
+  0xa6,0xc1,0xc0,0x20,0x90,0x25,0xc0,0x21,0xb0,0x08,0xa0,0x1e,0x8c,0x88,0x02,0x4c,
+  0x7b,0xfe,0xa9,0x12,0x8d,0x82,0x02,0xa9,0x10,0x8d,0x88,0x02,0xd0,0xf1,0x90,0xcf,
+  0xa5,0xc2,0x8d,0x82,0x02,0x85,0x97,0xc9,0x11,0x90,0xc4,0x20,0xc3,0xe5,0x4c,0xeb,
+  0xfd,0xa8,0xfc,0x0b,0xfc,0xbf,0xea,0x8e,0xf9,0xa9,0x7f,0x8d,0x1e,0x91,0x8d,0x2e,
+  0x91,0xa9,0x40,0x8d,0x2b,0x91,0xa9,0x40,0x8d,0x1b,0x91,0xa9,0xfe,0x8d,0x1c,0x91,
+  0xa9,0xde,0x8d,0x2c,0x91,0xa2,0x00,0x8e,0x12,0x91,0xa2,0xff,0x8e,0x22,0x91,0xa2,
+  0x00,0x8e,0x23,0x91,0xa2,0x80,0x8e,0x13,0x91,0xa2,0x00,0x8e,0x1f,0x91,0x20,0x84,
+  0xef,0xa9,0x82,0x8d,0x1e,0x91,0x20,0x8d,0xef,0xa9,0xc0,0x8d,0x2e,0x91,0xa9,0x89,
+  0x8d,0x24,0x91,0xa9,0x42,0x8d,0x25,0x91,0x60,0x85,0xb7,0x86,0xbb,0x84,0xbc,0x60,
+  0x85,0xb8,0x86,0xba,0x84,0xb9,0x60,0xa5,0xba,0xc9,0x02,0xd0,0x0b,0xad,0x97,0x02,
+  0xa9,0x00,0x8d,0x97,0x02,0x60,0x85,0x9d,0xa5,0x90,0x05,0x90,0x85,0x90,0x60,0x8d,
+  0x85,0x02,0x60,0x90,0x06,0xae,0x83,0x02,0xac,0x84,0x02,0x8e,0x83,0x02,0x8c,0x84,
+  0x02,0x60,0x90,0x06,0xae,0x81,0x02,0xac,0x82,0x02,0x8e,0x81,0x02,0x8c,0x82,0x02,
+  0x60,0xb1,0xc1,0xaa,0xa9,0x55,0x91,0xc1,0xd1,0xc1,0xd0,0x08,0x6a,0x91,0xc1,0xd1,
+  0xc1,0xd0,0x01,0xa9,0x18,0x8a,0x91,0xc1,0x60,0x78,0x6c,0x18,0x03,0x48,0x8a,0x48,
+  0x98,0x48,0xad,0x1d,0x91,0x10,0x48,0x2d,0x1e,0x91,0xaa,0x29,0x02,0xf0,0x1f,0x20,
+  0x3f,0xfd,0xd0,0x03,0x6c,0x02,0xa0,0x2c,0x11,0x91,0x20,0x34,0xf7,0x20,0xe1,0xff,
+  0xd0,0x2d,0x20,0x52,0xfd,0x20,0xf9,0xfd,0x20,0x18,0xe5,0x6c,0x02,0xc0,0xad,0x1e,
+  0x91,0x09,0x80,0x48,0xa9,0x7f,0x8d,0x1e,0x91,0x8a,0x29,0x40,0xf0,0x14,0xa9,0xce,
+  0x05,0xb5,0x8d,0x1c,0x91,0xad,0x14,0x91,0x68,0x8d,0x1e,0x91,0x20,0xa3,0xef,0x4c,
+  0x56,0xff,0x8a,0x29,0x20,0xf0,0x25,0xad,0x10,0x91,0x29,0x01,0x85,0xa7,0xad,0x18,
+  0x91,0xe9,0x16,0x6d,0x99,0x02,0x8d,0x18,0x91,0xad,0x19,0x91,0x6d,0x9a,0x02,0x8d,
+  0x19,0x91,0x68,0x8d,0x1e,0x91,0x20,0x36,0xf0,0x4c,0x56,0xff,0x8a,0x29,0x10,0xf0,
+  0x25,0xad,0x93,0x02,0x29,0x0f,0xd0,0x00,0x0a,0xaa,0xbd,0x5a,0xff,0x8d,0x18,0x91,
+  0xbd,0x5b,0xff,0x8d,0x19,0x91,0xad,0x10,0x91,0x68,0x09,0x20,0x29,0xef,0x8d,0x1e,
+  0x91,0xae,0x98,0x02,0x86,0xa8,0x68,0xa8,0x68,0xaa,0x68,0x40,0x92,0x27,0x40,0x1a,
+  0xc6,0x11,0x74,0x0e,0xee,0x0c,0x45,0x06,0xf1,0x02,0x46,0x01,0xb8,0x00,0x71,0x00,
+  0x2a,0x00,0x48,0x8a,0x48,0x98,0x48,0xba,0xbd,0x04,0x01,0x29,0x10,0xf0,0x03,0x6c,
+  0x16,0x03,0x6c,0x14,0x03,0xff,0xff,0xff,0xff,0xff,0x4c,0x52,0xfd,0x4c,0x57,0xfd,
+  0x4c,0x66,0xfe,0x4c,0xc0,0xee,0x4c,0xce,0xee,0x4c,0x73,0xfe,0x4c,0x82,0xfe,0x4c,
+  0x1e,0xeb,0x4c,0x6f,0xfe,0x4c,0x19,0xef,0x4c,0xe4,0xee,0x4c,0xf6,0xee,0x4c,0x04,
+  0xef,0x4c,0x17,0xee,0x4c,0x14,0xee,0x4c,0x57,0xfe,0x4c,0x50,0xfe,0x4c,0x49,0xfe,
+  0x6c,0x1a,0x03,0x6c,0x1c,0x03,0x6c,0x1e,0x03,0x6c,0x20,0x03,0x6c,0x22,0x03,0x6c,
+  0x24,0x03,0x6c,0x26,0x03,0x4c,0x42,0xf5,0x4c,0x75,0xf6,0x4c,0x67,0xf7,0x4c,0x60,
+  0xf7,0x6c,0x28,0x03,0x6c,0x2a,0x03,0x6c,0x2c,0x03,0x4c,0x34,0xf7,0x4c,0x05,0xe5,
+  0x4c,0x0a,0xe5,0x4c,0x00,0xe5,0xff,0xff,0xff,0xff,0xa9,0xfe,0x22,0xfd,0x72,0xff,
+};
+
+const uint8_t vic20_nativemap[0x2000] = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xfc,0x54,0xa5,0x94,0x4a,0xb7,0xa9,0xd5,0x7a,0xad,0x5a,0x55,0xb5,0xaa,0x5d,
+  0xad,0x55,0xed,0x96,0xb6,0x57,0xb5,0x3c,0xa5,0x54,0x52,0xcb,0xa5,0xd2,0x52,0x29,
+  0x49,0x65,0x55,0x92,0x94,0xaa,0xaa,0xb6,0xaa,0xba,0xb6,0xd5,0x5a,0x2d,0x49,0xab,
+  0xaa,0xa5,0x92,0xaa,0xa6,0x25,0xa9,0x5a,0xb5,0x6e,0xd5,0xaa,0xa5,0xb2,0x4a,0x52,
+  0xa5,0x5a,0x55,0x55,0x55,0x55,0xed,0x99,0xaa,0x4e,0x5a,0xd5,0x2a,0xd5,0xac,0xa6,
+  0x94,0x52,0xad,0xaa,0xae,0x5a,0xab,0x5d,0xd7,0xd6,0xaa,0x52,0xa9,0xaa,0xaa,0xd4,
+  0xfb,0xea,0xaa,0x5a,0x95,0xa4,0x4a,0xba,0xaa,0xaa,0x92,0x5d,0x55,0xa5,0x4a,0x55,
+  0xab,0x5d,0x95,0x54,0xb5,0xb5,0xa9,0x29,0x55,0xd2,0xbe,0xe4,0xd6,0xb6,0x24,0x55,
+  0x55,0x01,0x00,0x00,0x00,0x40,0xaa,0x55,0x55,0xcb,0x5a,0xab,0x92,0xa4,0xaa,0x33,
+  0x93,0x4a,0xa5,0x64,0xd5,0x9a,0x56,0xad,0xaa,0xae,0x92,0xaa,0x54,0x55,0x97,0x25,
+  0x29,0x6d,0xdb,0x24,0xc9,0xaa,0xae,0x56,0xa9,0xaa,0x56,0x59,0x2d,0xb9,0x6d,0xb9,
+  0x6a,0xab,0xaa,0xaa,0x56,0x49,0x95,0x4a,0x29,0xc9,0xaa,0x9a,0xa4,0xae,0xaa,0xaa,
+  0xb6,0xaa,0xaa,0xaa,0x24,0x55,0xda,0x9c,0x96,0x54,0x6b,0x56,0xa9,0xaa,0xa4,0x92,
+  0x9d,0x56,0x52,0xa5,0x94,0x52,0xd5,0xaa,0xaa,0xaa,0x54,0xaa,0x52,0x95,0x6a,0xad,
+  0x49,0x2a,0xcb,0x24,0x55,0xad,0x2a,0x95,0x24,0x95,0xaa,0x52,0xa5,0x73,0x55,0xa7,
+  0xd4,0xd6,0x4b,0x52,0xb2,0x2b,0x2b,0xa9,0xb6,0xb4,0xaa,0xaa,0x54,0xa9,0x54,0x4d,
+  0x25,0xa5,0x54,0x29,0x35,0xa5,0xa4,0xd4,0x4a,0x49,0x4a,0x2a,0x95,0xa4,0x4a,0x2a,
+  0x49,0xb5,0x2a,0x55,0x55,0x95,0x2a,0xa9,0xaa,0xa4,0x52,0xb5,0xaa,0xaa,0x56,0x35,
+  0x49,0x52,0x52,0xa5,0xaa,0x2a,0x25,0xb9,0xd6,0xda,0x92,0x95,0xaa,0x54,0x55,0x09,
+  0x00,0x00,0x00,0x40,0x95,0x4a,0xe5,0xad,0x65,0xaa,0xa4,0x9c,0x52,0x4a,0x29,0x3b,
+  0x95,0xe4,0xd5,0x4a,0x55,0x5f,0x52,0x59,0xd5,0xaa,0x92,0xaa,0x2a,0xb5,0x53,0x66,
+  0xad,0xae,0xaa,0x52,0x99,0x29,0x29,0xd7,0x4e,0xdb,0x36,0xad,0xd2,0x6d,0xdb,0x56,
+  0x4d,0xa5,0xa4,0x54,0x25,0xa0,0xaa,0xaa,0x6a,0x52,0x95,0x5a,0xa9,0x54,0x92,0xb6,
+  0x2a,0xa5,0xb3,0xaa,0xaa,0xa9,0xaa,0x4a,0x55,0x69,0x55,0xb2,0xea,0x4e,0xaa,0xca,
+  0x92,0xaa,0x56,0x25,0x95,0xa7,0x92,0xe4,0xf6,0x7c,0x72,0x4a,0x49,0x2b,0x55,0x95,
+  0x54,0xad,0x4a,0xaa,0xaa,0x4c,0x95,0xaa,0x52,0x57,0x55,0xbd,0x5a,0x55,0xbd,0x4a,
+  0x26,0x2d,0x95,0x94,0x2a,0xa5,0x29,0x55,0x55,0x55,0xb5,0x69,0x95,0xaa,0xaa,0xaa,
+  0x5a,0x57,0xab,0xf6,0xaa,0x55,0x55,0xa9,0xaa,0xaa,0x5a,0x2b,0xb5,0xaa,0xd5,0xb6,
+  0xad,0xd5,0xda,0xaa,0x15,0x00,0x24,0xa9,0xaa,0x52,0x6a,0xbb,0xcd,0xf6,0xcc,0x52,
+  0xa6,0xca,0x56,0x55,0x55,0xb5,0xaa,0xed,0xaa,0xa5,0x4a,0x55,0x92,0xaa,0xba,0xba,
+  0x5e,0xd5,0xdd,0x2e,0x55,0x55,0xd7,0x52,0x55,0xab,0x6a,0x55,0xab,0x56,0xf5,0x56,
+  0x5d,0xc9,0x5a,0x76,0x55,0x55,0xeb,0xca,0x5a,0x5b,0xad,0xaa,0xbf,0xea,0x6e,0xb5,
+  0x92,0xb5,0xaa,0xca,0x54,0x6b,0x49,0x52,0x49,0xca,0xb6,0x4d,0x4a,0xa5,0x92,0x36,
+  0xd9,0xaa,0xab,0x5d,0x69,0x6b,0xb5,0xd9,0x52,0xb6,0x76,0x77,0x37,0xe5,0xaa,0x2a,
+  0xd5,0xaa,0xaa,0x55,0x55,0x5b,0xb5,0xaa,0xa9,0x54,0xa5,0xaa,0xaa,0xd6,0xdb,0x56,
+  0xab,0xaa,0x7a,0x95,0x5a,0x55,0x55,0x55,0x55,0xa9,0xaa,0xaa,0x52,0x55,0x55,0xa5,
+  0xea,0xae,0x56,0xdb,0x5a,0x55,0x55,0xa9,0xd6,0xda,0x55,0x55,0x55,0x55,0x55,0xab,
+  0x6a,0x55,0x57,0x55,0x55,0x69,0xad,0xa5,0x4d,0xb6,0x5a,0x25,0xa9,0xa4,0x92,0xd4,
+  0xdd,0xb5,0x6b,0x57,0x4d,0x55,0xd6,0xdd,0xab,0xba,0x6a,0xad,0xaa,0x9a,0xcb,0x3a,
+  0x69,0xfd,0x54,0xbe,0x6a,0x92,0x95,0x4a,0x25,0xe9,0xab,0xaa,0xf2,0x7e,0xeb,0x9d,
+  0xa4,0x4e,0x35,0x49,0x52,0x25,0xa5,0xaa,0x56,0xb5,0xba,0x64,0x55,0x4d,0x92,0xaa,
+  0x52,0xb5,0x4d,0xdd,0x92,0x35,0x95,0x52,0x55,0x2b,0xa9,0xaa,0xa4,0x94,0xaa,0xad,
+  0xaa,0xaa,0xaa,0x5a,0xa9,0xaa,0x55,0x2a,0x95,0x4a,0x95,0xae,0xaa,0xaa,0xaa,0x6a,
+  0x55,0x55,0x55,0xa5,0xaa,0x5a,0x55,0x55,0xd5,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x6a,
+  0xa9,0xaa,0xaa,0xaa,0x56,0x55,0xd5,0x0d,0x00,0x00,0x00,0x00,0x00,0xa4,0x52,0xab,
+  0x52,0xa9,0x54,0x2a,0x53,0x29,0xa9,0xaa,0x94,0x52,0x4a,0xca,0xb6,0xaa,0xaa,0xaa,
+  0xaa,0x5b,0xd5,0x5a,0xab,0xaa,0xd5,0x5a,0x5d,0x95,0x5a,0x9d,0x64,0xab,0x52,0x41,
+  0xaa,0x92,0x94,0x56,0xaa,0xaa,0xaa,0xaa,0x5b,0xb5,0xaa,0x6a,0x55,0x55,0xd5,0xd4,
+  0xdf,0x94,0xaa,0xaa,0x54,0xb5,0xd6,0xaa,0xd5,0x56,0x95,0xaa,0xd6,0x5a,0xb5,0x5a,
+  0xd5,0x9a,0x6a,0xad,0x4a,0xa9,0x56,0x53,0x55,0xab,0x2a,0xad,0xba,0xaa,0xaa,0x56,
+  0xab,0x55,0x55,0xa9,0xd5,0xca,0x2a,0x5d,0x55,0x5a,0xa5,0x6a,0x55,0xaa,0xae,0x56,
+  0x55,0xa5,0xaa,0x54,0x55,0x55,0xa9,0x5a,0xaa,0x56,0xa5,0x4a,0xd5,0xac,0x72,0xc9,
+  0x4c,0x55,0xaa,0x2a,0xef,0x5a,0x01,0x00,0x54,0xaa,0x9a,0xa4,0xaa,0xd4,0x2a,0x55,
+  0x95,0xaa,0x54,0xa5,0x52,0xa9,0xa4,0x56,0xb5,0xd5,0xaa,0x59,0x53,0x35,0x95,0x4a,
+  0xa5,0x55,0xab,0xbe,0x2e,0xd5,0xd4,0x5a,0x55,0x56,0xad,0x6a,0x4b,0xd9,0x55,0xa6,
+  0x94,0x52,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xa9,
+  0x52,0xa9,0x54,0x5a,0x4e,0x25,0x57,0x55,0x00,0x00,0x00,0x00,0x00,0xa0,0x52,0xa5,
+  0x54,0x49,0x6b,0xab,0x5a,0x25,0x95,0x9a,0x95,0x92,0x4a,0xa5,0xba,0x2a,0xb5,0x56,
+  0xaa,0x02,0x90,0x4a,0x55,0xab,0x5a,0xa9,0x54,0x2a,0x55,0x55,0x55,0x95,0x4a,0x55,
+  0x56,0xd2,0x34,0x4d,0xd3,0xa4,0xcd,0x24,0x03,0x00,0x48,0x95,0xb6,0x52,0xa5,0x2a,
+  0x95,0xaa,0x32,0x55,0xaa,0xaa,0x24,0x49,0x9a,0x52,0x4a,0x25,0x49,0x2a,0xc9,0x25,
+  0x49,0x4f,0x4a,0x49,0x5a,0x49,0xaa,0x9a,0xe4,0x4a,0x92,0x54,0x2a,0xa9,0x92,0x54,
+  0x2a,0x2d,0x55,0xa5,0xb2,0x54,0x52,0xa9,0x54,0xaa,0x54,0x06,0x00,0x00,0x00,0x00,
+  0x00,0x68,0x69,0x55,0x2a,0xab,0xb2,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,
+  0x1a,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x95,0x56,0x55,0x25,0x35,0x35,0x55,0xad,
+  0x5a,0xa9,0xb4,0x95,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xd9,0x54,0x46,0x02,
+  0x00,0x00,0x00,0x00,0x29,0x53,0x26,0x5d,0x56,0x95,0xb4,0x00,0x00,0x00,0x00,0x00,
+  0xb5,0x56,0xa9,0x49,0x97,0x54,0x49,0xa9,0x94,0x92,0x52,0xaa,0xb4,0xad,0xab,0xca,
+  0xaa,0xaa,0xb5,0x4a,0xa9,0xb5,0x15,0xa8,0x2a,0xd9,0x94,0xac,0x3e,0x95,0x56,0xa9,
+  0xa4,0x5a,0xb2,0xaa,0xaa,0xad,0x54,0x95,0xaa,0xaa,0xaf,0xfa,0xff,0xff,0x57,0x55,
+  0x55,0xa5,0xaa,0xaa,0x4a,0x7d,0xd5,0x55,0xb5,0xaa,0x4a,0x72,0xf5,0xa7,0xaa,0x52,
+  0xaa,0x54,0xa5,0x6a,0x29,0xb5,0xba,0xa5,0xee,0xab,0x4a,0xa5,0xaa,0x4a,0x2a,0xb5,
+  0x24,0xcb,0xb6,0xad,0x4a,0x55,0xaa,0x4a,0x4d,0xab,0x54,0xea,0x56,0x55,0x95,0x24,
+  0xff,0xff,0xbf,0xea,0xaf,0x54,0xaa,0xaa,0xaa,0x52,0xb6,0x6d,0x55,0x2a,0x55,0xaa,
+  0x6a,0x55,0xaa,0xaa,0x65,0x49,0x2a,0x29,0xa9,0x95,0x2a,0x55,0x25,0x55,0xdb,0x56,
+  0x6d,0xab,0x96,0x36,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x6d,
+  0xab,0xa6,0x52,0x29,0x55,0xd5,0xaa,0xaa,0x4a,0x5a,0xd6,0xad,0xb6,0x6d,0xab,0x2a,
+  0x2d,0x6d,0xdb,0x54,0xa9,0x94,0xaa,0xaa,0x56,0xb6,0x6d,0x29,0x55,0x6d,0xaa,0x6a,
+  0xaa,0xb4,0xa4,0x6a,0x57,0xd6,0x56,0xd5,0x54,0x55,0xa5,0x2a,0x25,0x95,0x54,0xa5,
+  0x2a,0xa5,0x24,0x7f,0xa9,0xa4,0x4a,0x55,0x25,0x6d,0x55,0x49,0x5d,0x9b,0x02,0x00,
+  0x00,0x80,0xaa,0xaa,0x52,0x4a,0xa5,0x55,0x52,0x4b,0x59,0x09,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xaa,0x24,0x55,0x92,0x2a,0xa9,0x4a,0x5a,0x6d,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xd0,0xb2,0x96,0x5a,0x2a,0x29,0x49,0x26,0x4b,0x65,0x59,0x96,0x4a,0xba,
+  0x4a,0xc9,0xa7,0x52,0x25,0x95,0xdd,0x72,0x25,0x65,0x99,0x24,0x5d,0x6b,0x76,0x52,
+  0x5a,0xb2,0x4d,0x56,0x52,0x4a,0x2a,0x55,0x25,0x29,0x55,0x49,0x5b,0xd2,0x2a,0x95,
+  0x9e,0x32,0x65,0x49,0xad,0xaa,0xab,0xd6,0x52,0xd5,0x52,0x55,0x55,0x55,0x96,0xaa,
+  0x52,0x52,0x65,0x4b,0xca,0x4a,0x7b,0x55,0x55,0xad,0xb2,0x2a,0x95,0xd5,0x4c,0x59,
+  0xea,0x2a,0x55,0xb5,0xb6,0x25,0xa9,0x52,0x56,0x2a,0x95,0x52,0x52,0x39,0x53,0x96,
+  0x26,0x49,0x49,0x59,0x95,0x4a,0x29,0xa9,0x72,0xea,0xa4,0xb2,0x53,0xaa,0x0c,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x96,0xbb,0x6a,
+  0xaa,0x74,0x55,0xa5,0xaa,0x54,0xa5,0xa9,0x52,0xbf,0x29,0x55,0x5d,0x9d,0x54,0xaf,
+  0xa6,0xa9,0xfd,0x94,0xaa,0xd5,0x5f,0x57,0xea,0x94,0x54,0x55,0xa9,0xd2,0x53,0x49,
+  0x56,0x52,0x52,0xa9,0x2a,0x55,0x4f,0xa5,0xac,0xa4,0x73,0x55,0x35,0xa5,0x94,0xd4,
+  0x5a,0xa5,0x4a,0x49,0x55,0x49,0xae,0x4a,0x92,0xe4,0xda,0xd2,0x94,0xd2,0xaa,0x52,
+  0xa9,0x56,0x52,0xaa,0x54,0xaa,0x94,0xaa,0x54,0x49,0xa9,0x52,0x2a,0x95,0x54,0xa9,
+  0x54,0x55,0xbb,0xaa,0x54,0xea,0x54,0x65,0xe5,0x92,0x52,0xaa,0xac,0x24,0x75,0xce,
+  0xcb,0x92,0x65,0x49,0x92,0xd4,0xaa,0xb5,0x54,0xaa,0x4a,0x55,0x49,0xa5,0x94,0xd4,
+  0xa5,0x54,0x29,0xd9,0xad,0xaa,0xac,0xaa,0xa4,0x54,0x52,0x52,0x2a,0x55,0xaa,0x56,
+  0x55,0xad,0xaa,0x6a,0xd5,0x6b,0x55,0x25,0xd7,0x2a,0x55,0xaa,0xb2,0x56,0xa5,0x56,
+  0xa5,0x52,0x55,0x25,0x29,0xa5,0x94,0x92,0x4a,0x4a,0xa7,0x54,0xa9,0x92,0x2b,0x29,
+  0xa5,0xaa,0x29,0x55,0xe5,0x55,0x52,0x55,0xab,0xaa,0x2a,0xa9,0xab,0xd5,0xd5,0x74,
+  0xdb,0xb6,0x6d,0x53,0xe5,0xf2,0x66,0x55,0x55,0xd5,0x2a,0x95,0xf5,0x52,0xdb,0x56,
+  0xab,0xb5,0xd6,0x5a,0x55,0x55,0x95,0xca,0x6d,0xbb,0x9a,0xad,0xd5,0x54,0x55,0x55,
+  0x55,0xa7,0x9a,0x4a,0x52,0x29,0xe5,0x54,0x55,0xd2,0xaa,0xaa,0x4a,0xa5,0x55,0x92,
+  0x24,0x49,0x25,0x95,0x6a,0xcb,0x64,0x49,0x25,0xc9,0xf2,0x12,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xad,0xaa,0x02,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x53,0x4a,0x49,0x4a,0x32,0x48,
+  0x92,0x29,0x57,0xad,0xf6,0x94,0x24,0x99,0x92,0x16,0xd4,0x2a,0x55,0x16,0x00,0x00,
+  0x00,0xa0,0x25,0xab,0xaa,0xac,0x2a,0x55,0x55,0x95,0x94,0x52,0xa5,0x4a,0x00,0x4a,
+  0x4a,0x29,0xa5,0x94,0x52,0x4a,0x4a,0x4a,0x29,0xab,0xd5,0x2a,0x65,0xd5,0x2c,0x49,
+  0x96,0x24,0x5b,0xb5,0x7a,0xe7,0xa7,0xac,0x94,0x24,0x25,0x49,0x5a,0x56,0x25,0x93,
+  0xac,0x54,0x4a,0x92,0x4c,0xb2,0x52,0x27,0x49,0x56,0xd2,0x0f,0x00,0x00,0xfc,0xa9,
+  0x04,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x49,0x92,0x24,0x09,0x00,
+};
+
+//the ROMs are read from the copy above, everything else from the bus
+static inline uint8_t rd(cpu6502_t *c, uint16_t address) {
+    return address >= 0xC000 ? rom[address - 0xC000] : cpu6502_read(c, address);
+}
+
+#define RD(addr)       rd(c, (uint16_t)(addr))
+#define WR(addr, val)  cpu6502_write(c, (uint16_t)(addr), (uint8_t)(val))
+
+//stop at the goal and in front of interrupts, the interpreter serves them
+#define STEP if ((int32_t)(clk - goal) >= 0 || PENDING) goto out
+#define FETCH(n, next) {\
+    clk += ticktable[n];\
+    pc = (next);\
+    status |= FLAG_CONSTANT;\
+    count++;\
+}
+
+void vic20_native(cpu6502_t *c, uint32_t goal) {
+    uint16_t pc = c->pc;
+    uint8_t sp = c->sp, a = c->a, x = c->x, y = c->y, status, zres, nres;
+    uint32_t clk = c->clockticks;
+    uint32_t count = 0;
+    uint16_t operand, ea, reladdr, oldpc, value, result;
+
+    PUTSTATUS(c->status);
+    goto dispatch;
+
+L_C38A: STEP; FETCH(0xBA, 0xC38B); operand = 0x0000; IMP; TSX; 
+L_C38B: STEP; FETCH(0xE8, 0xC38C); operand = 0x0000; IMP; INX; 
+L_C38C: STEP; FETCH(0xE8, 0xC38D); operand = 0x0000; IMP; INX; 
+L_C38D: STEP; FETCH(0xE8, 0xC38E); operand = 0x0000; IMP; INX; 
+L_C38E: STEP; FETCH(0xE8, 0xC38F); operand = 0x0000; IMP; INX; 
+L_C38F: STEP; FETCH(0xBD, 0xC392); operand = 0x0101; ABSX(1); LDA(MEM); 
+L_C392: STEP; FETCH(0xC9, 0xC394); operand = 0x0081; IMM; CMP(IMMV); 
+L_C394: STEP; FETCH(0xD0, 0xC396); operand = 0x0021; REL; BNE; if (pc != 0xC396) goto L_C3B7; 
+L_C396: STEP; FETCH(0xA5, 0xC398); operand = 0x004A; ZP; LDA(MEM); 
+L_C398: STEP; FETCH(0xD0, 0xC39A); operand = 0x000A; REL; BNE; if (pc != 0xC39A) goto L_C3A4; 
+L_C39A: STEP; FETCH(0xBD, 0xC39D); operand = 0x0102; ABSX(1); LDA(MEM); 
+L_C39D: STEP; FETCH(0x85, 0xC39F); operand = 0x0049; ZP; STA; 
+L_C39F: STEP; FETCH(0xBD, 0xC3A2); operand = 0x0103; ABSX(1); LDA(MEM); 
+L_C3A2: STEP; FETCH(0x85, 0xC3A4); operand = 0x004A; ZP; STA; 
+L_C3A4: STEP; FETCH(0xDD, 0xC3A7); operand = 0x0103; ABSX(1); CMP(MEM); 
+L_C3A7: STEP; FETCH(0xD0, 0xC3A9); operand = 0x0007; REL; BNE; if (pc != 0xC3A9) goto L_C3B0; 
+L_C3A9: STEP; FETCH(0xA5, 0xC3AB); operand = 0x0049; ZP; LDA(MEM); 
+L_C3AB: STEP; FETCH(0xDD, 0xC3AE); operand = 0x0102; ABSX(1); CMP(MEM); 
+L_C3AE: STEP; FETCH(0xF0, 0xC3B0); operand = 0x0007; REL; BEQ; if (pc != 0xC3B0) goto L_C3B7; 
+L_C3B0: STEP; FETCH(0x8A, 0xC3B1); operand = 0x0000; IMP; TXA; 
+L_C3B1: STEP; FETCH(0x18, 0xC3B2); operand = 0x0000; IMP; CLC; 
+L_C3B2: STEP; FETCH(0x69, 0xC3B4); operand = 0x0012; IMM; ADC(IMMV); 
+L_C3B4: STEP; FETCH(0xAA, 0xC3B5); operand = 0x0000; IMP; TAX; 
+L_C3B5: STEP; FETCH(0xD0, 0xC3B7); operand = 0x00D8; REL; BNE; if (pc != 0xC3B7) goto L_C38F; 
+L_C3B7: STEP; FETCH(0x60, 0xC3B8); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C3B8: STEP; FETCH(0x20, 0xC3BB); operand = 0xC408; ABSO; JSR; goto L_C408;
+L_C3BB: STEP; FETCH(0x85, 0xC3BD); operand = 0x0031; ZP; STA; 
+L_C3BD: STEP; FETCH(0x84, 0xC3BF); operand = 0x0032; ZP; STY; 
+L_C3BF: STEP; FETCH(0x38, 0xC3C0); operand = 0x0000; IMP; SEC; 
+L_C3C0: STEP; FETCH(0xA5, 0xC3C2); operand = 0x005A; ZP; LDA(MEM); 
+L_C3C2: STEP; FETCH(0xE5, 0xC3C4); operand = 0x005F; ZP; SBC(MEM); 
+L_C3C4: STEP; FETCH(0x85, 0xC3C6); operand = 0x0022; ZP; STA; 
+L_C3C6: STEP; FETCH(0xA8, 0xC3C7); operand = 0x0000; IMP; TAY; 
+L_C3C7: STEP; FETCH(0xA5, 0xC3C9); operand = 0x005B; ZP; LDA(MEM); 
+L_C3C9: STEP; FETCH(0xE5, 0xC3CB); operand = 0x0060; ZP; SBC(MEM); 
+L_C3CB: STEP; FETCH(0xAA, 0xC3CC); operand = 0x0000; IMP; TAX; 
+L_C3CC: STEP; FETCH(0xE8, 0xC3CD); operand = 0x0000; IMP; INX; 
+L_C3CD: STEP; FETCH(0x98, 0xC3CE); operand = 0x0000; IMP; TYA; 
+L_C3CE: STEP; FETCH(0xF0, 0xC3D0); operand = 0x0023; REL; BEQ; if (pc != 0xC3D0) goto L_C3F3; 
+L_C3D0: STEP; FETCH(0xA5, 0xC3D2); operand = 0x005A; ZP; LDA(MEM); 
+L_C3D2: STEP; FETCH(0x38, 0xC3D3); operand = 0x0000; IMP; SEC; 
+L_C3D3: STEP; FETCH(0xE5, 0xC3D5); operand = 0x0022; ZP; SBC(MEM); 
+L_C3D5: STEP; FETCH(0x85, 0xC3D7); operand = 0x005A; ZP; STA; 
+L_C3D7: STEP; FETCH(0xB0, 0xC3D9); operand = 0x0003; REL; BCS; if (pc != 0xC3D9) goto L_C3DC; 
+L_C3D9: STEP; FETCH(0xC6, 0xC3DB); operand = 0x005B; ZP; DEC; 
+L_C3DB: STEP; FETCH(0x38, 0xC3DC); operand = 0x0000; IMP; SEC; 
+L_C3DC: STEP; FETCH(0xA5, 0xC3DE); operand = 0x0058; ZP; LDA(MEM); 
+L_C3DE: STEP; FETCH(0xE5, 0xC3E0); operand = 0x0022; ZP; SBC(MEM); 
+L_C3E0: STEP; FETCH(0x85, 0xC3E2); operand = 0x0058; ZP; STA; 
+L_C3E2: STEP; FETCH(0xB0, 0xC3E4); operand = 0x0008; REL; BCS; if (pc != 0xC3E4) goto L_C3EC; 
+L_C3E4: STEP; FETCH(0xC6, 0xC3E6); operand = 0x0059; ZP; DEC; 
+L_C3E6: STEP; FETCH(0x90, 0xC3E8); operand = 0x0004; REL; BCC; if (pc != 0xC3E8) goto L_C3EC; 
+L_C3E8: STEP; FETCH(0xB1, 0xC3EA); operand = 0x005A; INDY(1); LDA(MEM); 
+L_C3EA: STEP; FETCH(0x91, 0xC3EC); operand = 0x0058; INDY(0); STA; 
+L_C3EC: STEP; FETCH(0x88, 0xC3ED); operand = 0x0000; IMP; DEY; 
+L_C3ED: STEP; FETCH(0xD0, 0xC3EF); operand = 0x00F9; REL; BNE; if (pc != 0xC3EF) goto L_C3E8; 
+L_C3EF: STEP; FETCH(0xB1, 0xC3F1); operand = 0x005A; INDY(1); LDA(MEM); 
+L_C3F1: STEP; FETCH(0x91, 0xC3F3); operand = 0x0058; INDY(0); STA; 
+L_C3F3: STEP; FETCH(0xC6, 0xC3F5); operand = 0x005B; ZP; DEC; 
+L_C3F5: STEP; FETCH(0xC6, 0xC3F7); operand = 0x0059; ZP; DEC; 
+L_C3F7: STEP; FETCH(0xCA, 0xC3F8); operand = 0x0000; IMP; DEX; 
+L_C3F8: STEP; FETCH(0xD0, 0xC3FA); operand = 0x00F2; REL; BNE; if (pc != 0xC3FA) goto L_C3EC; 
+L_C3FA: STEP; FETCH(0x60, 0xC3FB); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C3FB: STEP; FETCH(0x0A, 0xC3FC); operand = 0x0000; ACC; ASL_A; 
+L_C3FC: STEP; FETCH(0x69, 0xC3FE); operand = 0x003E; IMM; ADC(IMMV); 
+L_C3FE: STEP; FETCH(0xB0, 0xC400); operand = 0x0035; REL; BCS; if (pc != 0xC400) goto L_C435; 
+L_C400: STEP; FETCH(0x85, 0xC402); operand = 0x0022; ZP; STA; 
+L_C402: STEP; FETCH(0xBA, 0xC403); operand = 0x0000; IMP; TSX; 
+L_C403: STEP; FETCH(0xE4, 0xC405); operand = 0x0022; ZP; CPX(MEM); 
+L_C405: STEP; FETCH(0x90, 0xC407); operand = 0x002E; REL; BCC; if (pc != 0xC407) goto L_C435; 
+L_C407: STEP; FETCH(0x60, 0xC408); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C408: STEP; FETCH(0xC4, 0xC40A); operand = 0x0034; ZP; CPY(MEM); 
+L_C40A: STEP; FETCH(0x90, 0xC40C); operand = 0x0028; REL; BCC; if (pc != 0xC40C) goto L_C434; 
+L_C40C: STEP; FETCH(0xD0, 0xC40E); operand = 0x0004; REL; BNE; if (pc != 0xC40E) goto L_C412; 
+L_C40E: STEP; FETCH(0xC5, 0xC410); operand = 0x0033; ZP; CMP(MEM); 
+L_C410: STEP; FETCH(0x90, 0xC412); operand = 0x0022; REL; BCC; if (pc != 0xC412) goto L_C434; 
+L_C412: STEP; FETCH(0x48, 0xC413); operand = 0x0000; IMP; PHA; 
+L_C413: STEP; FETCH(0xA2, 0xC415); operand = 0x0009; IMM; LDX(IMMV); 
+L_C415: STEP; FETCH(0x98, 0xC416); operand = 0x0000; IMP; TYA; 
+L_C416: STEP; FETCH(0x48, 0xC417); operand = 0x0000; IMP; PHA; 
+L_C417: STEP; FETCH(0xB5, 0xC419); operand = 0x0057; ZPX; LDA(MEM); 
+L_C419: STEP; FETCH(0xCA, 0xC41A); operand = 0x0000; IMP; DEX; 
+L_C41A: STEP; FETCH(0x10, 0xC41C); operand = 0x00FA; REL; BPL; if (pc != 0xC41C) goto L_C416; 
+L_C41C: STEP; FETCH(0x20, 0xC41F); operand = 0xD526; ABSO; JSR; goto L_D526;
+L_C41F: STEP; FETCH(0xA2, 0xC421); operand = 0x00F7; IMM; LDX(IMMV); 
+L_C421: STEP; FETCH(0x68, 0xC422); operand = 0x0000; IMP; PLA; 
+L_C422: STEP; FETCH(0x95, 0xC424); operand = 0x0061; ZPX; STA; 
+L_C424: STEP; FETCH(0xE8, 0xC425); operand = 0x0000; IMP; INX; 
+L_C425: STEP; FETCH(0x30, 0xC427); operand = 0x00FA; REL; BMI; if (pc != 0xC427) goto L_C421; 
+L_C427: STEP; FETCH(0x68, 0xC428); operand = 0x0000; IMP; PLA; 
+L_C428: STEP; FETCH(0xA8, 0xC429); operand = 0x0000; IMP; TAY; 
+L_C429: STEP; FETCH(0x68, 0xC42A); operand = 0x0000; IMP; PLA; 
+L_C42A: STEP; FETCH(0xC4, 0xC42C); operand = 0x0034; ZP; CPY(MEM); 
+L_C42C: STEP; FETCH(0x90, 0xC42E); operand = 0x0006; REL; BCC; if (pc != 0xC42E) goto L_C434; 
+L_C42E: STEP; FETCH(0xD0, 0xC430); operand = 0x0005; REL; BNE; if (pc != 0xC430) goto L_C435; 
+L_C430: STEP; FETCH(0xC5, 0xC432); operand = 0x0033; ZP; CMP(MEM); 
+L_C432: STEP; FETCH(0xB0, 0xC434); operand = 0x0001; REL; BCS; if (pc != 0xC434) goto L_C435; 
+L_C434: STEP; FETCH(0x60, 0xC435); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C435: STEP; FETCH(0xA2, 0xC437); operand = 0x0010; IMM; LDX(IMMV); 
+L_C437: STEP; FETCH(0x6C, 0xC43A); operand = 0x0300; IND; JMP; goto dispatch;
+L_C43A: STEP; FETCH(0x8A, 0xC43B); operand = 0x0000; IMP; TXA; 
+L_C43B: STEP; FETCH(0x0A, 0xC43C); operand = 0x0000; ACC; ASL_A; 
+L_C43C: STEP; FETCH(0xAA, 0xC43D); operand = 0x0000; IMP; TAX; 
+L_C43D: STEP; FETCH(0xBD, 0xC440); operand = 0xC326; ABSX(1); LDA(MEM); 
+L_C440: STEP; FETCH(0x85, 0xC442); operand = 0x0022; ZP; STA; 
+L_C442: STEP; FETCH(0xBD, 0xC445); operand = 0xC327; ABSX(1); LDA(MEM); 
+L_C445: STEP; FETCH(0x85, 0xC447); operand = 0x0023; ZP; STA; 
+L_C447: STEP; FETCH(0x20, 0xC44A); operand = 0xFFCC; ABSO; JSR; goto L_FFCC;
+L_C44A: STEP; FETCH(0xA9, 0xC44C); operand = 0x0000; IMM; LDA(IMMV); 
+L_C44C: STEP; FETCH(0x85, 0xC44E); operand = 0x0013; ZP; STA; 
+L_C44E: STEP; FETCH(0x20, 0xC451); operand = 0xCAD7; ABSO; JSR; goto L_CAD7;
+L_C451: STEP; FETCH(0x20, 0xC454); operand = 0xCB45; ABSO; JSR; goto L_CB45;
+L_C454: STEP; FETCH(0xA0, 0xC456); operand = 0x0000; IMM; LDY(IMMV); 
+L_C456: STEP; FETCH(0xB1, 0xC458); operand = 0x0022; INDY(1); LDA(MEM); 
+L_C458: STEP; FETCH(0x48, 0xC459); operand = 0x0000; IMP; PHA; 
+L_C459: STEP; FETCH(0x29, 0xC45B); operand = 0x007F; IMM; AND(IMMV); 
+L_C45B: STEP; FETCH(0x20, 0xC45E); operand = 0xCB47; ABSO; JSR; goto L_CB47;
+L_C45E: STEP; FETCH(0xC8, 0xC45F); operand = 0x0000; IMP; INY; 
+L_C45F: STEP; FETCH(0x68, 0xC460); operand = 0x0000; IMP; PLA; 
+L_C460: STEP; FETCH(0x10, 0xC462); operand = 0x00F4; REL; BPL; if (pc != 0xC462) goto L_C456; 
+L_C462: STEP; FETCH(0x20, 0xC465); operand = 0xC67A; ABSO; JSR; goto L_C67A;
+L_C465: STEP; FETCH(0xA9, 0xC467); operand = 0x0069; IMM; LDA(IMMV); 
+L_C467: STEP; FETCH(0xA0, 0xC469); operand = 0x00C3; IMM; LDY(IMMV); 
+L_C469: STEP; FETCH(0x20, 0xC46C); operand = 0xCB1E; ABSO; JSR; goto L_CB1E;
+L_C46C: STEP; FETCH(0xA4, 0xC46E); operand = 0x003A; ZP; LDY(MEM); 
+L_C46E: STEP; FETCH(0xC8, 0xC46F); operand = 0x0000; IMP; INY; 
+L_C46F: STEP; FETCH(0xF0, 0xC471); operand = 0x0003; REL; BEQ; if (pc != 0xC471) goto L_C474; 
+L_C471: STEP; FETCH(0x20, 0xC474); operand = 0xDDC2; ABSO; JSR; goto L_DDC2;
+L_C474: STEP; FETCH(0xA9, 0xC476); operand = 0x0076; IMM; LDA(IMMV); 
+L_C476: STEP; FETCH(0xA0, 0xC478); operand = 0x00C3; IMM; LDY(IMMV); 
+L_C478: STEP; FETCH(0x20, 0xC47B); operand = 0xCB1E; ABSO; JSR; goto L_CB1E;
+L_C47B: STEP; FETCH(0xA9, 0xC47D); operand = 0x0080; IMM; LDA(IMMV); 
+L_C47D: STEP; FETCH(0x20, 0xC480); operand = 0xFF90; ABSO; JSR; goto L_FF90;
+L_C480: STEP; FETCH(0x6C, 0xC483); operand = 0x0302; IND; JMP; goto dispatch;
+L_C483: STEP; FETCH(0x20, 0xC486); operand = 0xC560; ABSO; JSR; goto L_C560;
+L_C486: STEP; FETCH(0x86, 0xC488); operand = 0x007A; ZP; STX; 
+L_C488: STEP; FETCH(0x84, 0xC48A); operand = 0x007B; ZP; STY; 
+L_C48A: STEP; FETCH(0x20, 0xC48D); operand = 0x0073; ABSO; JSR; goto out;
+L_C48D: STEP; FETCH(0xAA, 0xC48E); operand = 0x0000; IMP; TAX; 
+L_C48E: STEP; FETCH(0xF0, 0xC490); operand = 0x00F0; REL; BEQ; if (pc != 0xC490) goto L_C480; 
+L_C490: STEP; FETCH(0xA2, 0xC492); operand = 0x00FF; IMM; LDX(IMMV); 
+L_C492: STEP; FETCH(0x86, 0xC494); operand = 0x003A; ZP; STX; 
+L_C494: STEP; FETCH(0x90, 0xC496); operand = 0x0006; REL; BCC; if (pc != 0xC496) goto L_C49C; 
+L_C496: STEP; FETCH(0x20, 0xC499); operand = 0xC579; ABSO; JSR; goto L_C579;
+L_C499: STEP; FETCH(0x4C, 0xC49C); operand = 0xC7E1; ABSO; JMP; goto L_C7E1;
+L_C49C: STEP; FETCH(0x20, 0xC49F); operand = 0xC96B; ABSO; JSR; goto L_C96B;
+L_C49F: STEP; FETCH(0x20, 0xC4A2); operand = 0xC579; ABSO; JSR; goto L_C579;
+L_C4A2: STEP; FETCH(0x84, 0xC4A4); operand = 0x000B; ZP; STY; 
+L_C4A4: STEP; FETCH(0x20, 0xC4A7); operand = 0xC613; ABSO; JSR; goto L_C613;
+L_C4A7: STEP; FETCH(0x90, 0xC4A9); operand = 0x0044; REL; BCC; if (pc != 0xC4A9) goto L_C4ED; 
+L_C4A9: STEP; FETCH(0xA0, 0xC4AB); operand = 0x0001; IMM; LDY(IMMV); 
+L_C4AB: STEP; FETCH(0xB1, 0xC4AD); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C4AD: STEP; FETCH(0x85, 0xC4AF); operand = 0x0023; ZP; STA; 
+L_C4AF: STEP; FETCH(0xA5, 0xC4B1); operand = 0x002D; ZP; LDA(MEM); 
+L_C4B1: STEP; FETCH(0x85, 0xC4B3); operand = 0x0022; ZP; STA; 
+L_C4B3: STEP; FETCH(0xA5, 0xC4B5); operand = 0x0060; ZP; LDA(MEM); 
+L_C4B5: STEP; FETCH(0x85, 0xC4B7); operand = 0x0025; ZP; STA; 
+L_C4B7: STEP; FETCH(0xA5, 0xC4B9); operand = 0x005F; ZP; LDA(MEM); 
+L_C4B9: STEP; FETCH(0x88, 0xC4BA); operand = 0x0000; IMP; DEY; 
+L_C4BA: STEP; FETCH(0xF1, 0xC4BC); operand = 0x005F; INDY(1); SBC(MEM); 
+L_C4BC: STEP; FETCH(0x18, 0xC4BD); operand = 0x0000; IMP; CLC; 
+L_C4BD: STEP; FETCH(0x65, 0xC4BF); operand = 0x002D; ZP; ADC(MEM); 
+L_C4BF: STEP; FETCH(0x85, 0xC4C1); operand = 0x002D; ZP; STA; 
+L_C4C1: STEP; FETCH(0x85, 0xC4C3); operand = 0x0024; ZP; STA; 
+L_C4C3: STEP; FETCH(0xA5, 0xC4C5); operand = 0x002E; ZP; LDA(MEM); 
+L_C4C5: STEP; FETCH(0x69, 0xC4C7); operand = 0x00FF; IMM; ADC(IMMV); 
+L_C4C7: STEP; FETCH(0x85, 0xC4C9); operand = 0x002E; ZP; STA; 
+L_C4C9: STEP; FETCH(0xE5, 0xC4CB); operand = 0x0060; ZP; SBC(MEM); 
+L_C4CB: STEP; FETCH(0xAA, 0xC4CC); operand = 0x0000; IMP; TAX; 
+L_C4CC: STEP; FETCH(0x38, 0xC4CD); operand = 0x0000; IMP; SEC; 
+L_C4CD: STEP; FETCH(0xA5, 0xC4CF); operand = 0x005F; ZP; LDA(MEM); 
+L_C4CF: STEP; FETCH(0xE5, 0xC4D1); operand = 0x002D; ZP; SBC(MEM); 
+L_C4D1: STEP; FETCH(0xA8, 0xC4D2); operand = 0x0000; IMP; TAY; 
+L_C4D2: STEP; FETCH(0xB0, 0xC4D4); operand = 0x0003; REL; BCS; if (pc != 0xC4D4) goto L_C4D7; 
+L_C4D4: STEP; FETCH(0xE8, 0xC4D5); operand = 0x0000; IMP; INX; 
+L_C4D5: STEP; FETCH(0xC6, 0xC4D7); operand = 0x0025; ZP; DEC; 
+L_C4D7: STEP; FETCH(0x18, 0xC4D8); operand = 0x0000; IMP; CLC; 
+L_C4D8: STEP; FETCH(0x65, 0xC4DA); operand = 0x0022; ZP; ADC(MEM); 
+L_C4DA: STEP; FETCH(0x90, 0xC4DC); operand = 0x0003; REL; BCC; if (pc != 0xC4DC) goto L_C4DF; 
+L_C4DC: STEP; FETCH(0xC6, 0xC4DE); operand = 0x0023; ZP; DEC; 
+L_C4DE: STEP; FETCH(0x18, 0xC4DF); operand = 0x0000; IMP; CLC; 
+L_C4DF: STEP; FETCH(0xB1, 0xC4E1); operand = 0x0022; INDY(1); LDA(MEM); 
+L_C4E1: STEP; FETCH(0x91, 0xC4E3); operand = 0x0024; INDY(0); STA; 
+L_C4E3: STEP; FETCH(0xC8, 0xC4E4); operand = 0x0000; IMP; INY; 
+L_C4E4: STEP; FETCH(0xD0, 0xC4E6); operand = 0x00F9; REL; BNE; if (pc != 0xC4E6) goto L_C4DF; 
+L_C4E6: STEP; FETCH(0xE6, 0xC4E8); operand = 0x0023; ZP; INC; 
+L_C4E8: STEP; FETCH(0xE6, 0xC4EA); operand = 0x0025; ZP; INC; 
+L_C4EA: STEP; FETCH(0xCA, 0xC4EB); operand = 0x0000; IMP; DEX; 
+L_C4EB: STEP; FETCH(0xD0, 0xC4ED); operand = 0x00F2; REL; BNE; if (pc != 0xC4ED) goto L_C4DF; 
+L_C4ED: STEP; FETCH(0x20, 0xC4F0); operand = 0xC659; ABSO; JSR; goto L_C659;
+L_C4F0: STEP; FETCH(0x20, 0xC4F3); operand = 0xC533; ABSO; JSR; goto L_C533;
+L_C4F3: STEP; FETCH(0xAD, 0xC4F6); operand = 0x0200; ABSO; LDA(MEM); 
+L_C4F6: STEP; FETCH(0xF0, 0xC4F8); operand = 0x0088; REL; BEQ; if (pc != 0xC4F8) goto L_C480; 
+L_C4F8: STEP; FETCH(0x18, 0xC4F9); operand = 0x0000; IMP; CLC; 
+L_C4F9: STEP; FETCH(0xA5, 0xC4FB); operand = 0x002D; ZP; LDA(MEM); 
+L_C4FB: STEP; FETCH(0x85, 0xC4FD); operand = 0x005A; ZP; STA; 
+L_C4FD: STEP; FETCH(0x65, 0xC4FF); operand = 0x000B; ZP; ADC(MEM); 
+L_C4FF: STEP; FETCH(0x85, 0xC501); operand = 0x0058; ZP; STA; 
+L_C501: STEP; FETCH(0xA4, 0xC503); operand = 0x002E; ZP; LDY(MEM); 
+L_C503: STEP; FETCH(0x84, 0xC505); operand = 0x005B; ZP; STY; 
+L_C505: STEP; FETCH(0x90, 0xC507); operand = 0x0001; REL; BCC; if (pc != 0xC507) goto L_C508; 
+L_C507: STEP; FETCH(0xC8, 0xC508); operand = 0x0000; IMP; INY; 
+L_C508: STEP; FETCH(0x84, 0xC50A); operand = 0x0059; ZP; STY; 
+L_C50A: STEP; FETCH(0x20, 0xC50D); operand = 0xC3B8; ABSO; JSR; goto L_C3B8;
+L_C50D: STEP; FETCH(0xA5, 0xC50F); operand = 0x0014; ZP; LDA(MEM); 
+L_C50F: STEP; FETCH(0xA4, 0xC511); operand = 0x0015; ZP; LDY(MEM); 
+L_C511: STEP; FETCH(0x8D, 0xC514); operand = 0x01FE; ABSO; STA; 
+L_C514: STEP; FETCH(0x8C, 0xC517); operand = 0x01FF; ABSO; STY; 
+L_C517: STEP; FETCH(0xA5, 0xC519); operand = 0x0031; ZP; LDA(MEM); 
+L_C519: STEP; FETCH(0xA4, 0xC51B); operand = 0x0032; ZP; LDY(MEM); 
+L_C51B: STEP; FETCH(0x85, 0xC51D); operand = 0x002D; ZP; STA; 
+L_C51D: STEP; FETCH(0x84, 0xC51F); operand = 0x002E; ZP; STY; 
+L_C51F: STEP; FETCH(0xA4, 0xC521); operand = 0x000B; ZP; LDY(MEM); 
+L_C521: STEP; FETCH(0x88, 0xC522); operand = 0x0000; IMP; DEY; 
+L_C522: STEP; FETCH(0xB9, 0xC525); operand = 0x01FC; ABSY(1); LDA(MEM); 
+L_C525: STEP; FETCH(0x91, 0xC527); operand = 0x005F; INDY(0); STA; 
+L_C527: STEP; FETCH(0x88, 0xC528); operand = 0x0000; IMP; DEY; 
+L_C528: STEP; FETCH(0x10, 0xC52A); operand = 0x00F8; REL; BPL; if (pc != 0xC52A) goto L_C522; 
+L_C52A: STEP; FETCH(0x20, 0xC52D); operand = 0xC659; ABSO; JSR; goto L_C659;
+L_C52D: STEP; FETCH(0x20, 0xC530); operand = 0xC533; ABSO; JSR; goto L_C533;
+L_C530: STEP; FETCH(0x4C, 0xC533); operand = 0xC480; ABSO; JMP; goto L_C480;
+L_C533: STEP; FETCH(0xA5, 0xC535); operand = 0x002B; ZP; LDA(MEM); 
+L_C535: STEP; FETCH(0xA4, 0xC537); operand = 0x002C; ZP; LDY(MEM); 
+L_C537: STEP; FETCH(0x85, 0xC539); operand = 0x0022; ZP; STA; 
+L_C539: STEP; FETCH(0x84, 0xC53B); operand = 0x0023; ZP; STY; 
+L_C53B: STEP; FETCH(0x18, 0xC53C); operand = 0x0000; IMP; CLC; 
+L_C53C: STEP; FETCH(0xA0, 0xC53E); operand = 0x0001; IMM; LDY(IMMV); 
+L_C53E: STEP; FETCH(0xB1, 0xC540); operand = 0x0022; INDY(1); LDA(MEM); 
+L_C540: STEP; FETCH(0xF0, 0xC542); operand = 0x001D; REL; BEQ; if (pc != 0xC542) goto L_C55F; 
+L_C542: STEP; FETCH(0xA0, 0xC544); operand = 0x0004; IMM; LDY(IMMV); 
+L_C544: STEP; FETCH(0xC8, 0xC545); operand = 0x0000; IMP; INY; 
+L_C545: STEP; FETCH(0xB1, 0xC547); operand = 0x0022; INDY(1); LDA(MEM); 
+L_C547: STEP; FETCH(0xD0, 0xC549); operand = 0x00FB; REL; BNE; if (pc != 0xC549) goto L_C544; 
+L_C549: STEP; FETCH(0xC8, 0xC54A); operand = 0x0000; IMP; INY; 
+L_C54A: STEP; FETCH(0x98, 0xC54B); operand = 0x0000; IMP; TYA; 
+L_C54B: STEP; FETCH(0x65, 0xC54D); operand = 0x0022; ZP; ADC(MEM); 
+L_C54D: STEP; FETCH(0xAA, 0xC54E); operand = 0x0000; IMP; TAX; 
+L_C54E: STEP; FETCH(0xA0, 0xC550); operand = 0x0000; IMM; LDY(IMMV); 
+L_C550: STEP; FETCH(0x91, 0xC552); operand = 0x0022; INDY(0); STA; 
+L_C552: STEP; FETCH(0xA5, 0xC554); operand = 0x0023; ZP; LDA(MEM); 
+L_C554: STEP; FETCH(0x69, 0xC556); operand = 0x0000; IMM; ADC(IMMV); 
+L_C556: STEP; FETCH(0xC8, 0xC557); operand = 0x0000; IMP; INY; 
+L_C557: STEP; FETCH(0x91, 0xC559); operand = 0x0022; INDY(0); STA; 
+L_C559: STEP; FETCH(0x86, 0xC55B); operand = 0x0022; ZP; STX; 
+L_C55B: STEP; FETCH(0x85, 0xC55D); operand = 0x0023; ZP; STA; 
+L_C55D: STEP; FETCH(0x90, 0xC55F); operand = 0x00DD; REL; BCC; if (pc != 0xC55F) goto L_C53C; 
+L_C55F: STEP; FETCH(0x60, 0xC560); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C560: STEP; FETCH(0xA2, 0xC562); operand = 0x0000; IMM; LDX(IMMV); 
+L_C562: STEP; FETCH(0x20, 0xC565); operand = 0xE10F; ABSO; JSR; goto L_E10F;
+L_C565: STEP; FETCH(0xC9, 0xC567); operand = 0x000D; IMM; CMP(IMMV); 
+L_C567: STEP; FETCH(0xF0, 0xC569); operand = 0x000D; REL; BEQ; if (pc != 0xC569) goto L_C576; 
+L_C569: STEP; FETCH(0x9D, 0xC56C); operand = 0x0200; ABSX(0); STA; 
+L_C56C: STEP; FETCH(0xE8, 0xC56D); operand = 0x0000; IMP; INX; 
+L_C56D: STEP; FETCH(0xE0, 0xC56F); operand = 0x0059; IMM; CPX(IMMV); 
+L_C56F: STEP; FETCH(0x90, 0xC571); operand = 0x00F1; REL; BCC; if (pc != 0xC571) goto L_C562; 
+L_C571: STEP; FETCH(0xA2, 0xC573); operand = 0x0017; IMM; LDX(IMMV); 
+L_C573: STEP; FETCH(0x4C, 0xC576); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_C576: STEP; FETCH(0x4C, 0xC579); operand = 0xCACA; ABSO; JMP; goto L_CACA;
+L_C579: STEP; FETCH(0x6C, 0xC57C); operand = 0x0304; IND; JMP; goto dispatch;
+L_C57C: STEP; FETCH(0xA6, 0xC57E); operand = 0x007A; ZP; LDX(MEM); 
+L_C57E: STEP; FETCH(0xA0, 0xC580); operand = 0x0004; IMM; LDY(IMMV); 
+L_C580: STEP; FETCH(0x84, 0xC582); operand = 0x000F; ZP; STY; 
+L_C582: STEP; FETCH(0xBD, 0xC585); operand = 0x0200; ABSX(1); LDA(MEM); 
+L_C585: STEP; FETCH(0x10, 0xC587); operand = 0x0007; REL; BPL; if (pc != 0xC587) goto L_C58E; 
+L_C587: STEP; FETCH(0xC9, 0xC589); operand = 0x00FF; IMM; CMP(IMMV); 
+L_C589: STEP; FETCH(0xF0, 0xC58B); operand = 0x003E; REL; BEQ; if (pc != 0xC58B) goto L_C5C9; 
+L_C58B: STEP; FETCH(0xE8, 0xC58C); operand = 0x0000; IMP; INX; 
+L_C58C: STEP; FETCH(0xD0, 0xC58E); operand = 0x00F4; REL; BNE; if (pc != 0xC58E) goto L_C582; 
+L_C58E: STEP; FETCH(0xC9, 0xC590); operand = 0x0020; IMM; CMP(IMMV); 
+L_C590: STEP; FETCH(0xF0, 0xC592); operand = 0x0037; REL; BEQ; if (pc != 0xC592) goto L_C5C9; 
+L_C592: STEP; FETCH(0x85, 0xC594); operand = 0x0008; ZP; STA; 
+L_C594: STEP; FETCH(0xC9, 0xC596); operand = 0x0022; IMM; CMP(IMMV); 
+L_C596: STEP; FETCH(0xF0, 0xC598); operand = 0x0056; REL; BEQ; if (pc != 0xC598) goto L_C5EE; 
+L_C598: STEP; FETCH(0x24, 0xC59A); operand = 0x000F; ZP; BIT(MEM); 
+L_C59A: STEP; FETCH(0x70, 0xC59C); operand = 0x002D; REL; BVS; if (pc != 0xC59C) goto L_C5C9; 
+L_C59C: STEP; FETCH(0xC9, 0xC59E); operand = 0x003F; IMM; CMP(IMMV); 
+L_C59E: STEP; FETCH(0xD0, 0xC5A0); operand = 0x0004; REL; BNE; if (pc != 0xC5A0) goto L_C5A4; 
+L_C5A0: STEP; FETCH(0xA9, 0xC5A2); operand = 0x0099; IMM; LDA(IMMV); 
+L_C5A2: STEP; FETCH(0xD0, 0xC5A4); operand = 0x0025; REL; BNE; if (pc != 0xC5A4) goto L_C5C9; 
+L_C5A4: STEP; FETCH(0xC9, 0xC5A6); operand = 0x0030; IMM; CMP(IMMV); 
+L_C5A6: STEP; FETCH(0x90, 0xC5A8); operand = 0x0004; REL; BCC; if (pc != 0xC5A8) goto L_C5AC; 
+L_C5A8: STEP; FETCH(0xC9, 0xC5AA); operand = 0x003C; IMM; CMP(IMMV); 
+L_C5AA: STEP; FETCH(0x90, 0xC5AC); operand = 0x001D; REL; BCC; if (pc != 0xC5AC) goto L_C5C9; 
+L_C5AC: STEP; FETCH(0x84, 0xC5AE); operand = 0x0071; ZP; STY; 
+L_C5AE: STEP; FETCH(0xA0, 0xC5B0); operand = 0x0000; IMM; LDY(IMMV); 
+L_C5B0: STEP; FETCH(0x84, 0xC5B2); operand = 0x000B; ZP; STY; 
+L_C5B2: STEP; FETCH(0x88, 0xC5B3); operand = 0x0000; IMP; DEY; 
+L_C5B3: STEP; FETCH(0x86, 0xC5B5); operand = 0x007A; ZP; STX; 
+L_C5B5: STEP; FETCH(0xCA, 0xC5B6); operand = 0x0000; IMP; DEX; 
+L_C5B6: STEP; FETCH(0xC8, 0xC5B7); operand = 0x0000; IMP; INY; 
+L_C5B7: STEP; FETCH(0xE8, 0xC5B8); operand = 0x0000; IMP; INX; 
+L_C5B8: STEP; FETCH(0xBD, 0xC5BB); operand = 0x0200; ABSX(1); LDA(MEM); 
+L_C5BB: STEP; FETCH(0x38, 0xC5BC); operand = 0x0000; IMP; SEC; 
+L_C5BC: STEP; FETCH(0xF9, 0xC5BF); operand = 0xC09E; ABSY(1); SBC(MEM); 
+L_C5BF: STEP; FETCH(0xF0, 0xC5C1); operand = 0x00F5; REL; BEQ; if (pc != 0xC5C1) goto L_C5B6; 
+L_C5C1: STEP; FETCH(0xC9, 0xC5C3); operand = 0x0080; IMM; CMP(IMMV); 
+L_C5C3: STEP; FETCH(0xD0, 0xC5C5); operand = 0x0030; REL; BNE; if (pc != 0xC5C5) goto L_C5F5; 
+L_C5C5: STEP; FETCH(0x05, 0xC5C7); operand = 0x000B; ZP; ORA(MEM); 
+L_C5C7: STEP; FETCH(0xA4, 0xC5C9); operand = 0x0071; ZP; LDY(MEM); 
+L_C5C9: STEP; FETCH(0xE8, 0xC5CA); operand = 0x0000; IMP; INX; 
+L_C5CA: STEP; FETCH(0xC8, 0xC5CB); operand = 0x0000; IMP; INY; 
+L_C5CB: STEP; FETCH(0x99, 0xC5CE); operand = 0x01FB; ABSY(0); STA; 
+L_C5CE: STEP; FETCH(0xB9, 0xC5D1); operand = 0x01FB; ABSY(1); LDA(MEM); 
+L_C5D1: STEP; FETCH(0xF0, 0xC5D3); operand = 0x0036; REL; BEQ; if (pc != 0xC5D3) goto L_C609; 
+L_C5D3: STEP; FETCH(0x38, 0xC5D4); operand = 0x0000; IMP; SEC; 
+L_C5D4: STEP; FETCH(0xE9, 0xC5D6); operand = 0x003A; IMM; SBC(IMMV); 
+L_C5D6: STEP; FETCH(0xF0, 0xC5D8); operand = 0x0004; REL; BEQ; if (pc != 0xC5D8) goto L_C5DC; 
+L_C5D8: STEP; FETCH(0xC9, 0xC5DA); operand = 0x0049; IMM; CMP(IMMV); 
+L_C5DA: STEP; FETCH(0xD0, 0xC5DC); operand = 0x0002; REL; BNE; if (pc != 0xC5DC) goto L_C5DE; 
+L_C5DC: STEP; FETCH(0x85, 0xC5DE); operand = 0x000F; ZP; STA; 
+L_C5DE: STEP; FETCH(0x38, 0xC5DF); operand = 0x0000; IMP; SEC; 
+L_C5DF: STEP; FETCH(0xE9, 0xC5E1); operand = 0x0055; IMM; SBC(IMMV); 
+L_C5E1: STEP; FETCH(0xD0, 0xC5E3); operand = 0x009F; REL; BNE; if (pc != 0xC5E3) goto L_C582; 
+L_C5E3: STEP; FETCH(0x85, 0xC5E5); operand = 0x0008; ZP; STA; 
+L_C5E5: STEP; FETCH(0xBD, 0xC5E8); operand = 0x0200; ABSX(1); LDA(MEM); 
+L_C5E8: STEP; FETCH(0xF0, 0xC5EA); operand = 0x00DF; REL; BEQ; if (pc != 0xC5EA) goto L_C5C9; 
+L_C5EA: STEP; FETCH(0xC5, 0xC5EC); operand = 0x0008; ZP; CMP(MEM); 
+L_C5EC: STEP; FETCH(0xF0, 0xC5EE); operand = 0x00DB; REL; BEQ; if (pc != 0xC5EE) goto L_C5C9; 
+L_C5EE: STEP; FETCH(0xC8, 0xC5EF); operand = 0x0000; IMP; INY; 
+L_C5EF: STEP; FETCH(0x99, 0xC5F2); operand = 0x01FB; ABSY(0); STA; 
+L_C5F2: STEP; FETCH(0xE8, 0xC5F3); operand = 0x0000; IMP; INX; 
+L_C5F3: STEP; FETCH(0xD0, 0xC5F5); operand = 0x00F0; REL; BNE; if (pc != 0xC5F5) goto L_C5E5; 
+L_C5F5: STEP; FETCH(0xA6, 0xC5F7); operand = 0x007A; ZP; LDX(MEM); 
+L_C5F7: STEP; FETCH(0xE6, 0xC5F9); operand = 0x000B; ZP; INC; 
+L_C5F9: STEP; FETCH(0xC8, 0xC5FA); operand = 0x0000; IMP; INY; 
+L_C5FA: STEP; FETCH(0xB9, 0xC5FD); operand = 0xC09D; ABSY(1); LDA(MEM); 
+L_C5FD: STEP; FETCH(0x10, 0xC5FF); operand = 0x00FA; REL; BPL; if (pc != 0xC5FF) goto L_C5F9; 
+L_C5FF: STEP; FETCH(0xB9, 0xC602); operand = 0xC09E; ABSY(1); LDA(MEM); 
+L_C602: STEP; FETCH(0xD0, 0xC604); operand = 0x00B4; REL; BNE; if (pc != 0xC604) goto L_C5B8; 
+L_C604: STEP; FETCH(0xBD, 0xC607); operand = 0x0200; ABSX(1); LDA(MEM); 
+L_C607: STEP; FETCH(0x10, 0xC609); operand = 0x00BE; REL; BPL; if (pc != 0xC609) goto L_C5C7; 
+L_C609: STEP; FETCH(0x99, 0xC60C); operand = 0x01FD; ABSY(0); STA; 
+L_C60C: STEP; FETCH(0xC6, 0xC60E); operand = 0x007B; ZP; DEC; 
+L_C60E: STEP; FETCH(0xA9, 0xC610); operand = 0x00FF; IMM; LDA(IMMV); 
+L_C610: STEP; FETCH(0x85, 0xC612); operand = 0x007A; ZP; STA; 
+L_C612: STEP; FETCH(0x60, 0xC613); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C613: STEP; FETCH(0xA5, 0xC615); operand = 0x002B; ZP; LDA(MEM); 
+L_C615: STEP; FETCH(0xA6, 0xC617); operand = 0x002C; ZP; LDX(MEM); 
+L_C617: STEP; FETCH(0xA0, 0xC619); operand = 0x0001; IMM; LDY(IMMV); 
+L_C619: STEP; FETCH(0x85, 0xC61B); operand = 0x005F; ZP; STA; 
+L_C61B: STEP; FETCH(0x86, 0xC61D); operand = 0x0060; ZP; STX; 
+L_C61D: STEP; FETCH(0xB1, 0xC61F); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C61F: STEP; FETCH(0xF0, 0xC621); operand = 0x001F; REL; BEQ; if (pc != 0xC621) goto L_C640; 
+L_C621: STEP; FETCH(0xC8, 0xC622); operand = 0x0000; IMP; INY; 
+L_C622: STEP; FETCH(0xC8, 0xC623); operand = 0x0000; IMP; INY; 
+L_C623: STEP; FETCH(0xA5, 0xC625); operand = 0x0015; ZP; LDA(MEM); 
+L_C625: STEP; FETCH(0xD1, 0xC627); operand = 0x005F; INDY(1); CMP(MEM); 
+L_C627: STEP; FETCH(0x90, 0xC629); operand = 0x0018; REL; BCC; if (pc != 0xC629) goto L_C641; 
+L_C629: STEP; FETCH(0xF0, 0xC62B); operand = 0x0003; REL; BEQ; if (pc != 0xC62B) goto L_C62E; 
+L_C62B: STEP; FETCH(0x88, 0xC62C); operand = 0x0000; IMP; DEY; 
+L_C62C: STEP; FETCH(0xD0, 0xC62E); operand = 0x0009; REL; BNE; if (pc != 0xC62E) goto L_C637; 
+L_C62E: STEP; FETCH(0xA5, 0xC630); operand = 0x0014; ZP; LDA(MEM); 
+L_C630: STEP; FETCH(0x88, 0xC631); operand = 0x0000; IMP; DEY; 
+L_C631: STEP; FETCH(0xD1, 0xC633); operand = 0x005F; INDY(1); CMP(MEM); 
+L_C633: STEP; FETCH(0x90, 0xC635); operand = 0x000C; REL; BCC; if (pc != 0xC635) goto L_C641; 
+L_C635: STEP; FETCH(0xF0, 0xC637); operand = 0x000A; REL; BEQ; if (pc != 0xC637) goto L_C641; 
+L_C637: STEP; FETCH(0x88, 0xC638); operand = 0x0000; IMP; DEY; 
+L_C638: STEP; FETCH(0xB1, 0xC63A); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C63A: STEP; FETCH(0xAA, 0xC63B); operand = 0x0000; IMP; TAX; 
+L_C63B: STEP; FETCH(0x88, 0xC63C); operand = 0x0000; IMP; DEY; 
+L_C63C: STEP; FETCH(0xB1, 0xC63E); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C63E: STEP; FETCH(0xB0, 0xC640); operand = 0x00D7; REL; BCS; if (pc != 0xC640) goto L_C617; 
+L_C640: STEP; FETCH(0x18, 0xC641); operand = 0x0000; IMP; CLC; 
+L_C641: STEP; FETCH(0x60, 0xC642); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C642: STEP; FETCH(0xD0, 0xC644); operand = 0x00FD; REL; BNE; if (pc != 0xC644) goto L_C641; 
+L_C644: STEP; FETCH(0xA9, 0xC646); operand = 0x0000; IMM; LDA(IMMV); 
+L_C646: STEP; FETCH(0xA8, 0xC647); operand = 0x0000; IMP; TAY; 
+L_C647: STEP; FETCH(0x91, 0xC649); operand = 0x002B; INDY(0); STA; 
+L_C649: STEP; FETCH(0xC8, 0xC64A); operand = 0x0000; IMP; INY; 
+L_C64A: STEP; FETCH(0x91, 0xC64C); operand = 0x002B; INDY(0); STA; 
+L_C64C: STEP; FETCH(0xA5, 0xC64E); operand = 0x002B; ZP; LDA(MEM); 
+L_C64E: STEP; FETCH(0x18, 0xC64F); operand = 0x0000; IMP; CLC; 
+L_C64F: STEP; FETCH(0x69, 0xC651); operand = 0x0002; IMM; ADC(IMMV); 
+L_C651: STEP; FETCH(0x85, 0xC653); operand = 0x002D; ZP; STA; 
+L_C653: STEP; FETCH(0xA5, 0xC655); operand = 0x002C; ZP; LDA(MEM); 
+L_C655: STEP; FETCH(0x69, 0xC657); operand = 0x0000; IMM; ADC(IMMV); 
+L_C657: STEP; FETCH(0x85, 0xC659); operand = 0x002E; ZP; STA; 
+L_C659: STEP; FETCH(0x20, 0xC65C); operand = 0xC68E; ABSO; JSR; goto L_C68E;
+L_C65C: STEP; FETCH(0xA9, 0xC65E); operand = 0x0000; IMM; LDA(IMMV); 
+L_C65E: STEP; FETCH(0xD0, 0xC660); operand = 0x002D; REL; BNE; if (pc != 0xC660) goto L_C68D; 
+L_C660: STEP; FETCH(0x20, 0xC663); operand = 0xFFE7; ABSO; JSR; goto L_FFE7;
+L_C663: STEP; FETCH(0xA5, 0xC665); operand = 0x0037; ZP; LDA(MEM); 
+L_C665: STEP; FETCH(0xA4, 0xC667); operand = 0x0038; ZP; LDY(MEM); 
+L_C667: STEP; FETCH(0x85, 0xC669); operand = 0x0033; ZP; STA; 
+L_C669: STEP; FETCH(0x84, 0xC66B); operand = 0x0034; ZP; STY; 
+L_C66B: STEP; FETCH(0xA5, 0xC66D); operand = 0x002D; ZP; LDA(MEM); 
+L_C66D: STEP; FETCH(0xA4, 0xC66F); operand = 0x002E; ZP; LDY(MEM); 
+L_C66F: STEP; FETCH(0x85, 0xC671); operand = 0x002F; ZP; STA; 
+L_C671: STEP; FETCH(0x84, 0xC673); operand = 0x0030; ZP; STY; 
+L_C673: STEP; FETCH(0x85, 0xC675); operand = 0x0031; ZP; STA; 
+L_C675: STEP; FETCH(0x84, 0xC677); operand = 0x0032; ZP; STY; 
+L_C677: STEP; FETCH(0x20, 0xC67A); operand = 0xC81D; ABSO; JSR; goto L_C81D;
+L_C67A: STEP; FETCH(0xA2, 0xC67C); operand = 0x0019; IMM; LDX(IMMV); 
+L_C67C: STEP; FETCH(0x86, 0xC67E); operand = 0x0016; ZP; STX; 
+L_C67E: STEP; FETCH(0x68, 0xC67F); operand = 0x0000; IMP; PLA; 
+L_C67F: STEP; FETCH(0xA8, 0xC680); operand = 0x0000; IMP; TAY; 
+L_C680: STEP; FETCH(0x68, 0xC681); operand = 0x0000; IMP; PLA; 
+L_C681: STEP; FETCH(0xA2, 0xC683); operand = 0x00FA; IMM; LDX(IMMV); 
+L_C683: STEP; FETCH(0x9A, 0xC684); operand = 0x0000; IMP; TXS; 
+L_C684: STEP; FETCH(0x48, 0xC685); operand = 0x0000; IMP; PHA; 
+L_C685: STEP; FETCH(0x98, 0xC686); operand = 0x0000; IMP; TYA; 
+L_C686: STEP; FETCH(0x48, 0xC687); operand = 0x0000; IMP; PHA; 
+L_C687: STEP; FETCH(0xA9, 0xC689); operand = 0x0000; IMM; LDA(IMMV); 
+L_C689: STEP; FETCH(0x85, 0xC68B); operand = 0x003E; ZP; STA; 
+L_C68B: STEP; FETCH(0x85, 0xC68D); operand = 0x0010; ZP; STA; 
+L_C68D: STEP; FETCH(0x60, 0xC68E); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C68E: STEP; FETCH(0x18, 0xC68F); operand = 0x0000; IMP; CLC; 
+L_C68F: STEP; FETCH(0xA5, 0xC691); operand = 0x002B; ZP; LDA(MEM); 
+L_C691: STEP; FETCH(0x69, 0xC693); operand = 0x00FF; IMM; ADC(IMMV); 
+L_C693: STEP; FETCH(0x85, 0xC695); operand = 0x007A; ZP; STA; 
+L_C695: STEP; FETCH(0xA5, 0xC697); operand = 0x002C; ZP; LDA(MEM); 
+L_C697: STEP; FETCH(0x69, 0xC699); operand = 0x00FF; IMM; ADC(IMMV); 
+L_C699: STEP; FETCH(0x85, 0xC69B); operand = 0x007B; ZP; STA; 
+L_C69B: STEP; FETCH(0x60, 0xC69C); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C69C: STEP; FETCH(0x90, 0xC69E); operand = 0x0006; REL; BCC; if (pc != 0xC69E) goto L_C6A4; 
+L_C69E: STEP; FETCH(0xF0, 0xC6A0); operand = 0x0004; REL; BEQ; if (pc != 0xC6A0) goto L_C6A4; 
+L_C6A0: STEP; FETCH(0xC9, 0xC6A2); operand = 0x00AB; IMM; CMP(IMMV); 
+L_C6A2: STEP; FETCH(0xD0, 0xC6A4); operand = 0x00E9; REL; BNE; if (pc != 0xC6A4) goto L_C68D; 
+L_C6A4: STEP; FETCH(0x20, 0xC6A7); operand = 0xC96B; ABSO; JSR; goto L_C96B;
+L_C6A7: STEP; FETCH(0x20, 0xC6AA); operand = 0xC613; ABSO; JSR; goto L_C613;
+L_C6AA: STEP; FETCH(0x20, 0xC6AD); operand = 0x0079; ABSO; JSR; goto out;
+L_C6AD: STEP; FETCH(0xF0, 0xC6AF); operand = 0x000C; REL; BEQ; if (pc != 0xC6AF) goto L_C6BB; 
+L_C6AF: STEP; FETCH(0xC9, 0xC6B1); operand = 0x00AB; IMM; CMP(IMMV); 
+L_C6B1: STEP; FETCH(0xD0, 0xC6B3); operand = 0x008E; REL; BNE; if (pc != 0xC6B3) goto L_C641; 
+L_C6B3: STEP; FETCH(0x20, 0xC6B6); operand = 0x0073; ABSO; JSR; goto out;
+L_C6B6: STEP; FETCH(0x20, 0xC6B9); operand = 0xC96B; ABSO; JSR; goto L_C96B;
+L_C6B9: STEP; FETCH(0xD0, 0xC6BB); operand = 0x0086; REL; BNE; if (pc != 0xC6BB) goto L_C641; 
+L_C6BB: STEP; FETCH(0x68, 0xC6BC); operand = 0x0000; IMP; PLA; 
+L_C6BC: STEP; FETCH(0x68, 0xC6BD); operand = 0x0000; IMP; PLA; 
+L_C6BD: STEP; FETCH(0xA5, 0xC6BF); operand = 0x0014; ZP; LDA(MEM); 
+L_C6BF: STEP; FETCH(0x05, 0xC6C1); operand = 0x0015; ZP; ORA(MEM); 
+L_C6C1: STEP; FETCH(0xD0, 0xC6C3); operand = 0x0006; REL; BNE; if (pc != 0xC6C3) goto L_C6C9; 
+L_C6C3: STEP; FETCH(0xA9, 0xC6C5); operand = 0x00FF; IMM; LDA(IMMV); 
+L_C6C5: STEP; FETCH(0x85, 0xC6C7); operand = 0x0014; ZP; STA; 
+L_C6C7: STEP; FETCH(0x85, 0xC6C9); operand = 0x0015; ZP; STA; 
+L_C6C9: STEP; FETCH(0xA0, 0xC6CB); operand = 0x0001; IMM; LDY(IMMV); 
+L_C6CB: STEP; FETCH(0x84, 0xC6CD); operand = 0x000F; ZP; STY; 
+L_C6CD: STEP; FETCH(0xB1, 0xC6CF); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C6CF: STEP; FETCH(0xF0, 0xC6D1); operand = 0x0043; REL; BEQ; if (pc != 0xC6D1) goto L_C714; 
+L_C6D1: STEP; FETCH(0x20, 0xC6D4); operand = 0xC82C; ABSO; JSR; goto L_C82C;
+L_C6D4: STEP; FETCH(0x20, 0xC6D7); operand = 0xCAD7; ABSO; JSR; goto L_CAD7;
+L_C6D7: STEP; FETCH(0xC8, 0xC6D8); operand = 0x0000; IMP; INY; 
+L_C6D8: STEP; FETCH(0xB1, 0xC6DA); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C6DA: STEP; FETCH(0xAA, 0xC6DB); operand = 0x0000; IMP; TAX; 
+L_C6DB: STEP; FETCH(0xC8, 0xC6DC); operand = 0x0000; IMP; INY; 
+L_C6DC: STEP; FETCH(0xB1, 0xC6DE); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C6DE: STEP; FETCH(0xC5, 0xC6E0); operand = 0x0015; ZP; CMP(MEM); 
+L_C6E0: STEP; FETCH(0xD0, 0xC6E2); operand = 0x0004; REL; BNE; if (pc != 0xC6E2) goto L_C6E6; 
+L_C6E2: STEP; FETCH(0xE4, 0xC6E4); operand = 0x0014; ZP; CPX(MEM); 
+L_C6E4: STEP; FETCH(0xF0, 0xC6E6); operand = 0x0002; REL; BEQ; if (pc != 0xC6E6) goto L_C6E8; 
+L_C6E6: STEP; FETCH(0xB0, 0xC6E8); operand = 0x002C; REL; BCS; if (pc != 0xC6E8) goto L_C714; 
+L_C6E8: STEP; FETCH(0x84, 0xC6EA); operand = 0x0049; ZP; STY; 
+L_C6EA: STEP; FETCH(0x20, 0xC6ED); operand = 0xDDCD; ABSO; JSR; goto L_DDCD;
+L_C6ED: STEP; FETCH(0xA9, 0xC6EF); operand = 0x0020; IMM; LDA(IMMV); 
+L_C6EF: STEP; FETCH(0xA4, 0xC6F1); operand = 0x0049; ZP; LDY(MEM); 
+L_C6F1: STEP; FETCH(0x29, 0xC6F3); operand = 0x007F; IMM; AND(IMMV); 
+L_C6F3: STEP; FETCH(0x20, 0xC6F6); operand = 0xCB47; ABSO; JSR; goto L_CB47;
+L_C6F6: STEP; FETCH(0xC9, 0xC6F8); operand = 0x0022; IMM; CMP(IMMV); 
+L_C6F8: STEP; FETCH(0xD0, 0xC6FA); operand = 0x0006; REL; BNE; if (pc != 0xC6FA) goto L_C700; 
+L_C6FA: STEP; FETCH(0xA5, 0xC6FC); operand = 0x000F; ZP; LDA(MEM); 
+L_C6FC: STEP; FETCH(0x49, 0xC6FE); operand = 0x00FF; IMM; EOR(IMMV); 
+L_C6FE: STEP; FETCH(0x85, 0xC700); operand = 0x000F; ZP; STA; 
+L_C700: STEP; FETCH(0xC8, 0xC701); operand = 0x0000; IMP; INY; 
+L_C701: STEP; FETCH(0xF0, 0xC703); operand = 0x0011; REL; BEQ; if (pc != 0xC703) goto L_C714; 
+L_C703: STEP; FETCH(0xB1, 0xC705); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C705: STEP; FETCH(0xD0, 0xC707); operand = 0x0010; REL; BNE; if (pc != 0xC707) goto L_C717; 
+L_C707: STEP; FETCH(0xA8, 0xC708); operand = 0x0000; IMP; TAY; 
+L_C708: STEP; FETCH(0xB1, 0xC70A); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C70A: STEP; FETCH(0xAA, 0xC70B); operand = 0x0000; IMP; TAX; 
+L_C70B: STEP; FETCH(0xC8, 0xC70C); operand = 0x0000; IMP; INY; 
+L_C70C: STEP; FETCH(0xB1, 0xC70E); operand = 0x005F; INDY(1); LDA(MEM); 
+L_C70E: STEP; FETCH(0x86, 0xC710); operand = 0x005F; ZP; STX; 
+L_C710: STEP; FETCH(0x85, 0xC712); operand = 0x0060; ZP; STA; 
+L_C712: STEP; FETCH(0xD0, 0xC714); operand = 0x00B5; REL; BNE; if (pc != 0xC714) goto L_C6C9; 
+L_C714: STEP; FETCH(0x4C, 0xC717); operand = 0xC474; ABSO; JMP; goto L_C474;
+L_C717: STEP; FETCH(0x6C, 0xC71A); operand = 0x0306; IND; JMP; goto dispatch;
+L_C71A: STEP; FETCH(0x10, 0xC71C); operand = 0x00D7; REL; BPL; if (pc != 0xC71C) goto L_C6F3; 
+L_C71C: STEP; FETCH(0xC9, 0xC71E); operand = 0x00FF; IMM; CMP(IMMV); 
+L_C71E: STEP; FETCH(0xF0, 0xC720); operand = 0x00D3; REL; BEQ; if (pc != 0xC720) goto L_C6F3; 
+L_C720: STEP; FETCH(0x24, 0xC722); operand = 0x000F; ZP; BIT(MEM); 
+L_C722: STEP; FETCH(0x30, 0xC724); operand = 0x00CF; REL; BMI; if (pc != 0xC724) goto L_C6F3; 
+L_C724: STEP; FETCH(0x38, 0xC725); operand = 0x0000; IMP; SEC; 
+L_C725: STEP; FETCH(0xE9, 0xC727); operand = 0x007F; IMM; SBC(IMMV); 
+L_C727: STEP; FETCH(0xAA, 0xC728); operand = 0x0000; IMP; TAX; 
+L_C728: STEP; FETCH(0x84, 0xC72A); operand = 0x0049; ZP; STY; 
+L_C72A: STEP; FETCH(0xA0, 0xC72C); operand = 0x00FF; IMM; LDY(IMMV); 
+L_C72C: STEP; FETCH(0xCA, 0xC72D); operand = 0x0000; IMP; DEX; 
+L_C72D: STEP; FETCH(0xF0, 0xC72F); operand = 0x0008; REL; BEQ; if (pc != 0xC72F) goto L_C737; 
+L_C72F: STEP; FETCH(0xC8, 0xC730); operand = 0x0000; IMP; INY; 
+L_C730: STEP; FETCH(0xB9, 0xC733); operand = 0xC09E; ABSY(1); LDA(MEM); 
+L_C733: STEP; FETCH(0x10, 0xC735); operand = 0x00FA; REL; BPL; if (pc != 0xC735) goto L_C72F; 
+L_C735: STEP; FETCH(0x30, 0xC737); operand = 0x00F5; REL; BMI; if (pc != 0xC737) goto L_C72C; 
+L_C737: STEP; FETCH(0xC8, 0xC738); operand = 0x0000; IMP; INY; 
+L_C738: STEP; FETCH(0xB9, 0xC73B); operand = 0xC09E; ABSY(1); LDA(MEM); 
+L_C73B: STEP; FETCH(0x30, 0xC73D); operand = 0x00B2; REL; BMI; if (pc != 0xC73D) goto L_C6EF; 
+L_C73D: STEP; FETCH(0x20, 0xC740); operand = 0xCB47; ABSO; JSR; goto L_CB47;
+L_C740: STEP; FETCH(0xD0, 0xC742); operand = 0x00F5; REL; BNE; if (pc != 0xC742) goto L_C737; 
+L_C742: STEP; FETCH(0xA9, 0xC744); operand = 0x0080; IMM; LDA(IMMV); 
+L_C744: STEP; FETCH(0x85, 0xC746); operand = 0x0010; ZP; STA; 
+L_C746: STEP; FETCH(0x20, 0xC749); operand = 0xC9A5; ABSO; JSR; goto L_C9A5;
+L_C749: STEP; FETCH(0x20, 0xC74C); operand = 0xC38A; ABSO; JSR; goto L_C38A;
+L_C74C: STEP; FETCH(0xD0, 0xC74E); operand = 0x0005; REL; BNE; if (pc != 0xC74E) goto L_C753; 
+L_C74E: STEP; FETCH(0x8A, 0xC74F); operand = 0x0000; IMP; TXA; 
+L_C74F: STEP; FETCH(0x69, 0xC751); operand = 0x000F; IMM; ADC(IMMV); 
+L_C751: STEP; FETCH(0xAA, 0xC752); operand = 0x0000; IMP; TAX; 
+L_C752: STEP; FETCH(0x9A, 0xC753); operand = 0x0000; IMP; TXS; 
+L_C753: STEP; FETCH(0x68, 0xC754); operand = 0x0000; IMP; PLA; 
+L_C754: STEP; FETCH(0x68, 0xC755); operand = 0x0000; IMP; PLA; 
+L_C755: STEP; FETCH(0xA9, 0xC757); operand = 0x0009; IMM; LDA(IMMV); 
+L_C757: STEP; FETCH(0x20, 0xC75A); operand = 0xC3FB; ABSO; JSR; goto L_C3FB;
+L_C75A: STEP; FETCH(0x20, 0xC75D); operand = 0xC906; ABSO; JSR; goto L_C906;
+L_C75D: STEP; FETCH(0x18, 0xC75E); operand = 0x0000; IMP; CLC; 
+L_C75E: STEP; FETCH(0x98, 0xC75F); operand = 0x0000; IMP; TYA; 
+L_C75F: STEP; FETCH(0x65, 0xC761); operand = 0x007A; ZP; ADC(MEM); 
+L_C761: STEP; FETCH(0x48, 0xC762); operand = 0x0000; IMP; PHA; 
+L_C762: STEP; FETCH(0xA5, 0xC764); operand = 0x007B; ZP; LDA(MEM); 
+L_C764: STEP; FETCH(0x69, 0xC766); operand = 0x0000; IMM; ADC(IMMV); 
+L_C766: STEP; FETCH(0x48, 0xC767); operand = 0x0000; IMP; PHA; 
+L_C767: STEP; FETCH(0xA5, 0xC769); operand = 0x003A; ZP; LDA(MEM); 
+L_C769: STEP; FETCH(0x48, 0xC76A); operand = 0x0000; IMP; PHA; 
+L_C76A: STEP; FETCH(0xA5, 0xC76C); operand = 0x0039; ZP; LDA(MEM); 
+L_C76C: STEP; FETCH(0x48, 0xC76D); operand = 0x0000; IMP; PHA; 
+L_C76D: STEP; FETCH(0xA9, 0xC76F); operand = 0x00A4; IMM; LDA(IMMV); 
+L_C76F: STEP; FETCH(0x20, 0xC772); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_C772: STEP; FETCH(0x20, 0xC775); operand = 0xCD8D; ABSO; JSR; goto L_CD8D;
+L_C775: STEP; FETCH(0x20, 0xC778); operand = 0xCD8A; ABSO; JSR; goto L_CD8A;
+L_C778: STEP; FETCH(0xA5, 0xC77A); operand = 0x0066; ZP; LDA(MEM); 
+L_C77A: STEP; FETCH(0x09, 0xC77C); operand = 0x007F; IMM; ORA(IMMV); 
+L_C77C: STEP; FETCH(0x25, 0xC77E); operand = 0x0062; ZP; AND(MEM); 
+L_C77E: STEP; FETCH(0x85, 0xC780); operand = 0x0062; ZP; STA; 
+L_C780: STEP; FETCH(0xA9, 0xC782); operand = 0x008B; IMM; LDA(IMMV); 
+L_C782: STEP; FETCH(0xA0, 0xC784); operand = 0x00C7; IMM; LDY(IMMV); 
+L_C784: STEP; FETCH(0x85, 0xC786); operand = 0x0022; ZP; STA; 
+L_C786: STEP; FETCH(0x84, 0xC788); operand = 0x0023; ZP; STY; 
+L_C788: STEP; FETCH(0x4C, 0xC78B); operand = 0xCE43; ABSO; JMP; goto L_CE43;
+L_C7AE: STEP; FETCH(0x20, 0xC7B1); operand = 0xC82C; ABSO; JSR; goto L_C82C;
+L_C7B1: STEP; FETCH(0xA5, 0xC7B3); operand = 0x007A; ZP; LDA(MEM); 
+L_C7B3: STEP; FETCH(0xA4, 0xC7B5); operand = 0x007B; ZP; LDY(MEM); 
+L_C7B5: STEP; FETCH(0xC0, 0xC7B7); operand = 0x0002; IMM; CPY(IMMV); 
+L_C7B7: STEP; FETCH(0xEA, 0xC7B8); operand = 0x0000; IMP; NOP; 
+L_C7B8: STEP; FETCH(0xF0, 0xC7BA); operand = 0x0004; REL; BEQ; if (pc != 0xC7BA) goto L_C7BE; 
+L_C7BA: STEP; FETCH(0x85, 0xC7BC); operand = 0x003D; ZP; STA; 
+L_C7BC: STEP; FETCH(0x84, 0xC7BE); operand = 0x003E; ZP; STY; 
+L_C7BE: STEP; FETCH(0xA0, 0xC7C0); operand = 0x0000; IMM; LDY(IMMV); 
+L_C7C0: STEP; FETCH(0xB1, 0xC7C2); operand = 0x007A; INDY(1); LDA(MEM); 
+L_C7C2: STEP; FETCH(0xD0, 0xC7C4); operand = 0x0043; REL; BNE; if (pc != 0xC7C4) goto L_C807; 
+L_C7C4: STEP; FETCH(0xA0, 0xC7C6); operand = 0x0002; IMM; LDY(IMMV); 
+L_C7C6: STEP; FETCH(0xB1, 0xC7C8); operand = 0x007A; INDY(1); LDA(MEM); 
+L_C7C8: STEP; FETCH(0x18, 0xC7C9); operand = 0x0000; IMP; CLC; 
+L_C7C9: STEP; FETCH(0xD0, 0xC7CB); operand = 0x0003; REL; BNE; if (pc != 0xC7CB) goto L_C7CE; 
+L_C7CB: STEP; FETCH(0x4C, 0xC7CE); operand = 0xC84B; ABSO; JMP; goto L_C84B;
+L_C7CE: STEP; FETCH(0xC8, 0xC7CF); operand = 0x0000; IMP; INY; 
+L_C7CF: STEP; FETCH(0xB1, 0xC7D1); operand = 0x007A; INDY(1); LDA(MEM); 
+L_C7D1: STEP; FETCH(0x85, 0xC7D3); operand = 0x0039; ZP; STA; 
+L_C7D3: STEP; FETCH(0xC8, 0xC7D4); operand = 0x0000; IMP; INY; 
+L_C7D4: STEP; FETCH(0xB1, 0xC7D6); operand = 0x007A; INDY(1); LDA(MEM); 
+L_C7D6: STEP; FETCH(0x85, 0xC7D8); operand = 0x003A; ZP; STA; 
+L_C7D8: STEP; FETCH(0x98, 0xC7D9); operand = 0x0000; IMP; TYA; 
+L_C7D9: STEP; FETCH(0x65, 0xC7DB); operand = 0x007A; ZP; ADC(MEM); 
+L_C7DB: STEP; FETCH(0x85, 0xC7DD); operand = 0x007A; ZP; STA; 
+L_C7DD: STEP; FETCH(0x90, 0xC7DF); operand = 0x0002; REL; BCC; if (pc != 0xC7DF) goto L_C7E1; 
+L_C7DF: STEP; FETCH(0xE6, 0xC7E1); operand = 0x007B; ZP; INC; 
+L_C7E1: STEP; FETCH(0x6C, 0xC7E4); operand = 0x0308; IND; JMP; goto dispatch;
+L_C7E4: STEP; FETCH(0x20, 0xC7E7); operand = 0x0073; ABSO; JSR; goto out;
+L_C7E7: STEP; FETCH(0x20, 0xC7EA); operand = 0xC7ED; ABSO; JSR; goto L_C7ED;
+L_C7EA: STEP; FETCH(0x4C, 0xC7ED); operand = 0xC7AE; ABSO; JMP; goto L_C7AE;
+L_C7ED: STEP; FETCH(0xF0, 0xC7EF); operand = 0x003C; REL; BEQ; if (pc != 0xC7EF) goto L_C82B; 
+L_C7EF: STEP; FETCH(0xE9, 0xC7F1); operand = 0x0080; IMM; SBC(IMMV); 
+L_C7F1: STEP; FETCH(0x90, 0xC7F3); operand = 0x0011; REL; BCC; if (pc != 0xC7F3) goto L_C804; 
+L_C7F3: STEP; FETCH(0xC9, 0xC7F5); operand = 0x0023; IMM; CMP(IMMV); 
+L_C7F5: STEP; FETCH(0xB0, 0xC7F7); operand = 0x0017; REL; BCS; if (pc != 0xC7F7) goto L_C80E; 
+L_C7F7: STEP; FETCH(0x0A, 0xC7F8); operand = 0x0000; ACC; ASL_A; 
+L_C7F8: STEP; FETCH(0xA8, 0xC7F9); operand = 0x0000; IMP; TAY; 
+L_C7F9: STEP; FETCH(0xB9, 0xC7FC); operand = 0xC00D; ABSY(1); LDA(MEM); 
+L_C7FC: STEP; FETCH(0x48, 0xC7FD); operand = 0x0000; IMP; PHA; 
+L_C7FD: STEP; FETCH(0xB9, 0xC800); operand = 0xC00C; ABSY(1); LDA(MEM); 
+L_C800: STEP; FETCH(0x48, 0xC801); operand = 0x0000; IMP; PHA; 
+L_C801: STEP; FETCH(0x4C, 0xC804); operand = 0x0073; ABSO; JMP; goto out;
+L_C804: STEP; FETCH(0x4C, 0xC807); operand = 0xC9A5; ABSO; JMP; goto L_C9A5;
+L_C807: STEP; FETCH(0xC9, 0xC809); operand = 0x003A; IMM; CMP(IMMV); 
+L_C809: STEP; FETCH(0xF0, 0xC80B); operand = 0x00D6; REL; BEQ; if (pc != 0xC80B) goto L_C7E1; 
+L_C80B: STEP; FETCH(0x4C, 0xC80E); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_C80E: STEP; FETCH(0xC9, 0xC810); operand = 0x004B; IMM; CMP(IMMV); 
+L_C810: STEP; FETCH(0xD0, 0xC812); operand = 0x00F9; REL; BNE; if (pc != 0xC812) goto L_C80B; 
+L_C812: STEP; FETCH(0x20, 0xC815); operand = 0x0073; ABSO; JSR; goto out;
+L_C815: STEP; FETCH(0xA9, 0xC817); operand = 0x00A4; IMM; LDA(IMMV); 
+L_C817: STEP; FETCH(0x20, 0xC81A); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_C81A: STEP; FETCH(0x4C, 0xC81D); operand = 0xC8A0; ABSO; JMP; goto L_C8A0;
+L_C81D: STEP; FETCH(0x38, 0xC81E); operand = 0x0000; IMP; SEC; 
+L_C81E: STEP; FETCH(0xA5, 0xC820); operand = 0x002B; ZP; LDA(MEM); 
+L_C820: STEP; FETCH(0xE9, 0xC822); operand = 0x0001; IMM; SBC(IMMV); 
+L_C822: STEP; FETCH(0xA4, 0xC824); operand = 0x002C; ZP; LDY(MEM); 
+L_C824: STEP; FETCH(0xB0, 0xC826); operand = 0x0001; REL; BCS; if (pc != 0xC826) goto L_C827; 
+L_C826: STEP; FETCH(0x88, 0xC827); operand = 0x0000; IMP; DEY; 
+L_C827: STEP; FETCH(0x85, 0xC829); operand = 0x0041; ZP; STA; 
+L_C829: STEP; FETCH(0x84, 0xC82B); operand = 0x0042; ZP; STY; 
+L_C82B: STEP; FETCH(0x60, 0xC82C); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C82C: STEP; FETCH(0x20, 0xC82F); operand = 0xFFE1; ABSO; JSR; goto L_FFE1;
+L_C82F: STEP; FETCH(0xB0, 0xC831); operand = 0x0001; REL; BCS; if (pc != 0xC831) goto L_C832; 
+L_C831: STEP; FETCH(0x18, 0xC832); operand = 0x0000; IMP; CLC; 
+L_C832: STEP; FETCH(0xD0, 0xC834); operand = 0x003C; REL; BNE; if (pc != 0xC834) goto L_C870; 
+L_C834: STEP; FETCH(0xA5, 0xC836); operand = 0x007A; ZP; LDA(MEM); 
+L_C836: STEP; FETCH(0xA4, 0xC838); operand = 0x007B; ZP; LDY(MEM); 
+L_C838: STEP; FETCH(0xA6, 0xC83A); operand = 0x003A; ZP; LDX(MEM); 
+L_C83A: STEP; FETCH(0xE8, 0xC83B); operand = 0x0000; IMP; INX; 
+L_C83B: STEP; FETCH(0xF0, 0xC83D); operand = 0x000C; REL; BEQ; if (pc != 0xC83D) goto L_C849; 
+L_C83D: STEP; FETCH(0x85, 0xC83F); operand = 0x003D; ZP; STA; 
+L_C83F: STEP; FETCH(0x84, 0xC841); operand = 0x003E; ZP; STY; 
+L_C841: STEP; FETCH(0xA5, 0xC843); operand = 0x0039; ZP; LDA(MEM); 
+L_C843: STEP; FETCH(0xA4, 0xC845); operand = 0x003A; ZP; LDY(MEM); 
+L_C845: STEP; FETCH(0x85, 0xC847); operand = 0x003B; ZP; STA; 
+L_C847: STEP; FETCH(0x84, 0xC849); operand = 0x003C; ZP; STY; 
+L_C849: STEP; FETCH(0x68, 0xC84A); operand = 0x0000; IMP; PLA; 
+L_C84A: STEP; FETCH(0x68, 0xC84B); operand = 0x0000; IMP; PLA; 
+L_C84B: STEP; FETCH(0xA9, 0xC84D); operand = 0x0081; IMM; LDA(IMMV); 
+L_C84D: STEP; FETCH(0xA0, 0xC84F); operand = 0x00C3; IMM; LDY(IMMV); 
+L_C84F: STEP; FETCH(0x90, 0xC851); operand = 0x0003; REL; BCC; if (pc != 0xC851) goto L_C854; 
+L_C851: STEP; FETCH(0x4C, 0xC854); operand = 0xC469; ABSO; JMP; goto L_C469;
+L_C854: STEP; FETCH(0x4C, 0xC857); operand = 0xC474; ABSO; JMP; goto L_C474;
+L_C857: STEP; FETCH(0xD0, 0xC859); operand = 0x0017; REL; BNE; if (pc != 0xC859) goto L_C870; 
+L_C859: STEP; FETCH(0xA2, 0xC85B); operand = 0x001A; IMM; LDX(IMMV); 
+L_C85B: STEP; FETCH(0xA4, 0xC85D); operand = 0x003E; ZP; LDY(MEM); 
+L_C85D: STEP; FETCH(0xD0, 0xC85F); operand = 0x0003; REL; BNE; if (pc != 0xC85F) goto L_C862; 
+L_C85F: STEP; FETCH(0x4C, 0xC862); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_C862: STEP; FETCH(0xA5, 0xC864); operand = 0x003D; ZP; LDA(MEM); 
+L_C864: STEP; FETCH(0x85, 0xC866); operand = 0x007A; ZP; STA; 
+L_C866: STEP; FETCH(0x84, 0xC868); operand = 0x007B; ZP; STY; 
+L_C868: STEP; FETCH(0xA5, 0xC86A); operand = 0x003B; ZP; LDA(MEM); 
+L_C86A: STEP; FETCH(0xA4, 0xC86C); operand = 0x003C; ZP; LDY(MEM); 
+L_C86C: STEP; FETCH(0x85, 0xC86E); operand = 0x0039; ZP; STA; 
+L_C86E: STEP; FETCH(0x84, 0xC870); operand = 0x003A; ZP; STY; 
+L_C870: STEP; FETCH(0x60, 0xC871); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C871: STEP; FETCH(0x08, 0xC872); operand = 0x0000; IMP; PHP; 
+L_C872: STEP; FETCH(0xA9, 0xC874); operand = 0x0000; IMM; LDA(IMMV); 
+L_C874: STEP; FETCH(0x20, 0xC877); operand = 0xFF90; ABSO; JSR; goto L_FF90;
+L_C877: STEP; FETCH(0x28, 0xC878); operand = 0x0000; IMP; PLP; 
+L_C878: STEP; FETCH(0xD0, 0xC87A); operand = 0x0003; REL; BNE; if (pc != 0xC87A) goto L_C87D; 
+L_C87A: STEP; FETCH(0x4C, 0xC87D); operand = 0xC659; ABSO; JMP; goto L_C659;
+L_C87D: STEP; FETCH(0x20, 0xC880); operand = 0xC660; ABSO; JSR; goto L_C660;
+L_C880: STEP; FETCH(0x4C, 0xC883); operand = 0xC897; ABSO; JMP; goto L_C897;
+L_C883: STEP; FETCH(0xA9, 0xC885); operand = 0x0003; IMM; LDA(IMMV); 
+L_C885: STEP; FETCH(0x20, 0xC888); operand = 0xC3FB; ABSO; JSR; goto L_C3FB;
+L_C888: STEP; FETCH(0xA5, 0xC88A); operand = 0x007B; ZP; LDA(MEM); 
+L_C88A: STEP; FETCH(0x48, 0xC88B); operand = 0x0000; IMP; PHA; 
+L_C88B: STEP; FETCH(0xA5, 0xC88D); operand = 0x007A; ZP; LDA(MEM); 
+L_C88D: STEP; FETCH(0x48, 0xC88E); operand = 0x0000; IMP; PHA; 
+L_C88E: STEP; FETCH(0xA5, 0xC890); operand = 0x003A; ZP; LDA(MEM); 
+L_C890: STEP; FETCH(0x48, 0xC891); operand = 0x0000; IMP; PHA; 
+L_C891: STEP; FETCH(0xA5, 0xC893); operand = 0x0039; ZP; LDA(MEM); 
+L_C893: STEP; FETCH(0x48, 0xC894); operand = 0x0000; IMP; PHA; 
+L_C894: STEP; FETCH(0xA9, 0xC896); operand = 0x008D; IMM; LDA(IMMV); 
+L_C896: STEP; FETCH(0x48, 0xC897); operand = 0x0000; IMP; PHA; 
+L_C897: STEP; FETCH(0x20, 0xC89A); operand = 0x0079; ABSO; JSR; goto out;
+L_C89A: STEP; FETCH(0x20, 0xC89D); operand = 0xC8A0; ABSO; JSR; goto L_C8A0;
+L_C89D: STEP; FETCH(0x4C, 0xC8A0); operand = 0xC7AE; ABSO; JMP; goto L_C7AE;
+L_C8A0: STEP; FETCH(0x20, 0xC8A3); operand = 0xC96B; ABSO; JSR; goto L_C96B;
+L_C8A3: STEP; FETCH(0x20, 0xC8A6); operand = 0xC909; ABSO; JSR; goto L_C909;
+L_C8A6: STEP; FETCH(0x38, 0xC8A7); operand = 0x0000; IMP; SEC; 
+L_C8A7: STEP; FETCH(0xA5, 0xC8A9); operand = 0x0039; ZP; LDA(MEM); 
+L_C8A9: STEP; FETCH(0xE5, 0xC8AB); operand = 0x0014; ZP; SBC(MEM); 
+L_C8AB: STEP; FETCH(0xA5, 0xC8AD); operand = 0x003A; ZP; LDA(MEM); 
+L_C8AD: STEP; FETCH(0xE5, 0xC8AF); operand = 0x0015; ZP; SBC(MEM); 
+L_C8AF: STEP; FETCH(0xB0, 0xC8B1); operand = 0x000B; REL; BCS; if (pc != 0xC8B1) goto L_C8BC; 
+L_C8B1: STEP; FETCH(0x98, 0xC8B2); operand = 0x0000; IMP; TYA; 
+L_C8B2: STEP; FETCH(0x38, 0xC8B3); operand = 0x0000; IMP; SEC; 
+L_C8B3: STEP; FETCH(0x65, 0xC8B5); operand = 0x007A; ZP; ADC(MEM); 
+L_C8B5: STEP; FETCH(0xA6, 0xC8B7); operand = 0x007B; ZP; LDX(MEM); 
+L_C8B7: STEP; FETCH(0x90, 0xC8B9); operand = 0x0007; REL; BCC; if (pc != 0xC8B9) goto L_C8C0; 
+L_C8B9: STEP; FETCH(0xE8, 0xC8BA); operand = 0x0000; IMP; INX; 
+L_C8BA: STEP; FETCH(0xB0, 0xC8BC); operand = 0x0004; REL; BCS; if (pc != 0xC8BC) goto L_C8C0; 
+L_C8BC: STEP; FETCH(0xA5, 0xC8BE); operand = 0x002B; ZP; LDA(MEM); 
+L_C8BE: STEP; FETCH(0xA6, 0xC8C0); operand = 0x002C; ZP; LDX(MEM); 
+L_C8C0: STEP; FETCH(0x20, 0xC8C3); operand = 0xC617; ABSO; JSR; goto L_C617;
+L_C8C3: STEP; FETCH(0x90, 0xC8C5); operand = 0x001E; REL; BCC; if (pc != 0xC8C5) goto L_C8E3; 
+L_C8C5: STEP; FETCH(0xA5, 0xC8C7); operand = 0x005F; ZP; LDA(MEM); 
+L_C8C7: STEP; FETCH(0xE9, 0xC8C9); operand = 0x0001; IMM; SBC(IMMV); 
+L_C8C9: STEP; FETCH(0x85, 0xC8CB); operand = 0x007A; ZP; STA; 
+L_C8CB: STEP; FETCH(0xA5, 0xC8CD); operand = 0x0060; ZP; LDA(MEM); 
+L_C8CD: STEP; FETCH(0xE9, 0xC8CF); operand = 0x0000; IMM; SBC(IMMV); 
+L_C8CF: STEP; FETCH(0x85, 0xC8D1); operand = 0x007B; ZP; STA; 
+L_C8D1: STEP; FETCH(0x60, 0xC8D2); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C8D2: STEP; FETCH(0xD0, 0xC8D4); operand = 0x00FD; REL; BNE; if (pc != 0xC8D4) goto L_C8D1; 
+L_C8D4: STEP; FETCH(0xA9, 0xC8D6); operand = 0x00FF; IMM; LDA(IMMV); 
+L_C8D6: STEP; FETCH(0x85, 0xC8D8); operand = 0x004A; ZP; STA; 
+L_C8D8: STEP; FETCH(0x20, 0xC8DB); operand = 0xC38A; ABSO; JSR; goto L_C38A;
+L_C8DB: STEP; FETCH(0x9A, 0xC8DC); operand = 0x0000; IMP; TXS; 
+L_C8DC: STEP; FETCH(0xC9, 0xC8DE); operand = 0x008D; IMM; CMP(IMMV); 
+L_C8DE: STEP; FETCH(0xF0, 0xC8E0); operand = 0x000B; REL; BEQ; if (pc != 0xC8E0) goto L_C8EB; 
+L_C8E0: STEP; FETCH(0xA2, 0xC8E2); operand = 0x000C; IMM; LDX(IMMV); 
+L_C8E2: STEP; FETCH(0x2C, 0xC8E5); operand = 0x11A2; ABSO; BIT(MEM); goto L_C8E5;
+L_C8E3: STEP; FETCH(0xA2, 0xC8E5); operand = 0x0011; IMM; LDX(IMMV); 
+L_C8E5: STEP; FETCH(0x4C, 0xC8E8); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_C8E8: STEP; FETCH(0x4C, 0xC8EB); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_C8EB: STEP; FETCH(0x68, 0xC8EC); operand = 0x0000; IMP; PLA; 
+L_C8EC: STEP; FETCH(0x68, 0xC8ED); operand = 0x0000; IMP; PLA; 
+L_C8ED: STEP; FETCH(0x85, 0xC8EF); operand = 0x0039; ZP; STA; 
+L_C8EF: STEP; FETCH(0x68, 0xC8F0); operand = 0x0000; IMP; PLA; 
+L_C8F0: STEP; FETCH(0x85, 0xC8F2); operand = 0x003A; ZP; STA; 
+L_C8F2: STEP; FETCH(0x68, 0xC8F3); operand = 0x0000; IMP; PLA; 
+L_C8F3: STEP; FETCH(0x85, 0xC8F5); operand = 0x007A; ZP; STA; 
+L_C8F5: STEP; FETCH(0x68, 0xC8F6); operand = 0x0000; IMP; PLA; 
+L_C8F6: STEP; FETCH(0x85, 0xC8F8); operand = 0x007B; ZP; STA; 
+L_C8F8: STEP; FETCH(0x20, 0xC8FB); operand = 0xC906; ABSO; JSR; goto L_C906;
+L_C8FB: STEP; FETCH(0x98, 0xC8FC); operand = 0x0000; IMP; TYA; 
+L_C8FC: STEP; FETCH(0x18, 0xC8FD); operand = 0x0000; IMP; CLC; 
+L_C8FD: STEP; FETCH(0x65, 0xC8FF); operand = 0x007A; ZP; ADC(MEM); 
+L_C8FF: STEP; FETCH(0x85, 0xC901); operand = 0x007A; ZP; STA; 
+L_C901: STEP; FETCH(0x90, 0xC903); operand = 0x0002; REL; BCC; if (pc != 0xC903) goto L_C905; 
+L_C903: STEP; FETCH(0xE6, 0xC905); operand = 0x007B; ZP; INC; 
+L_C905: STEP; FETCH(0x60, 0xC906); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C906: STEP; FETCH(0xA2, 0xC908); operand = 0x003A; IMM; LDX(IMMV); 
+L_C908: STEP; FETCH(0x2C, 0xC90B); operand = 0x00A2; ABSO; BIT(MEM); goto L_C90B;
+L_C909: STEP; FETCH(0xA2, 0xC90B); operand = 0x0000; IMM; LDX(IMMV); 
+L_C90B: STEP; FETCH(0x86, 0xC90D); operand = 0x0007; ZP; STX; 
+L_C90D: STEP; FETCH(0xA0, 0xC90F); operand = 0x0000; IMM; LDY(IMMV); 
+L_C90F: STEP; FETCH(0x84, 0xC911); operand = 0x0008; ZP; STY; 
+L_C911: STEP; FETCH(0xA5, 0xC913); operand = 0x0008; ZP; LDA(MEM); 
+L_C913: STEP; FETCH(0xA6, 0xC915); operand = 0x0007; ZP; LDX(MEM); 
+L_C915: STEP; FETCH(0x85, 0xC917); operand = 0x0007; ZP; STA; 
+L_C917: STEP; FETCH(0x86, 0xC919); operand = 0x0008; ZP; STX; 
+L_C919: STEP; FETCH(0xB1, 0xC91B); operand = 0x007A; INDY(1); LDA(MEM); 
+L_C91B: STEP; FETCH(0xF0, 0xC91D); operand = 0x00E8; REL; BEQ; if (pc != 0xC91D) goto L_C905; 
+L_C91D: STEP; FETCH(0xC5, 0xC91F); operand = 0x0008; ZP; CMP(MEM); 
+L_C91F: STEP; FETCH(0xF0, 0xC921); operand = 0x00E4; REL; BEQ; if (pc != 0xC921) goto L_C905; 
+L_C921: STEP; FETCH(0xC8, 0xC922); operand = 0x0000; IMP; INY; 
+L_C922: STEP; FETCH(0xC9, 0xC924); operand = 0x0022; IMM; CMP(IMMV); 
+L_C924: STEP; FETCH(0xD0, 0xC926); operand = 0x00F3; REL; BNE; if (pc != 0xC926) goto L_C919; 
+L_C926: STEP; FETCH(0xF0, 0xC928); operand = 0x00E9; REL; BEQ; if (pc != 0xC928) goto L_C911; 
+L_C928: STEP; FETCH(0x20, 0xC92B); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_C92B: STEP; FETCH(0x20, 0xC92E); operand = 0x0079; ABSO; JSR; goto out;
+L_C92E: STEP; FETCH(0xC9, 0xC930); operand = 0x0089; IMM; CMP(IMMV); 
+L_C930: STEP; FETCH(0xF0, 0xC932); operand = 0x0005; REL; BEQ; if (pc != 0xC932) goto L_C937; 
+L_C932: STEP; FETCH(0xA9, 0xC934); operand = 0x00A7; IMM; LDA(IMMV); 
+L_C934: STEP; FETCH(0x20, 0xC937); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_C937: STEP; FETCH(0xA5, 0xC939); operand = 0x0061; ZP; LDA(MEM); 
+L_C939: STEP; FETCH(0xD0, 0xC93B); operand = 0x0005; REL; BNE; if (pc != 0xC93B) goto L_C940; 
+L_C93B: STEP; FETCH(0x20, 0xC93E); operand = 0xC909; ABSO; JSR; goto L_C909;
+L_C93E: STEP; FETCH(0xF0, 0xC940); operand = 0x00BB; REL; BEQ; if (pc != 0xC940) goto L_C8FB; 
+L_C940: STEP; FETCH(0x20, 0xC943); operand = 0x0079; ABSO; JSR; goto out;
+L_C943: STEP; FETCH(0xB0, 0xC945); operand = 0x0003; REL; BCS; if (pc != 0xC945) goto L_C948; 
+L_C945: STEP; FETCH(0x4C, 0xC948); operand = 0xC8A0; ABSO; JMP; goto L_C8A0;
+L_C948: STEP; FETCH(0x4C, 0xC94B); operand = 0xC7ED; ABSO; JMP; goto L_C7ED;
+L_C94B: STEP; FETCH(0x20, 0xC94E); operand = 0xD79E; ABSO; JSR; goto L_D79E;
+L_C94E: STEP; FETCH(0x48, 0xC94F); operand = 0x0000; IMP; PHA; 
+L_C94F: STEP; FETCH(0xC9, 0xC951); operand = 0x008D; IMM; CMP(IMMV); 
+L_C951: STEP; FETCH(0xF0, 0xC953); operand = 0x0004; REL; BEQ; if (pc != 0xC953) goto L_C957; 
+L_C953: STEP; FETCH(0xC9, 0xC955); operand = 0x0089; IMM; CMP(IMMV); 
+L_C955: STEP; FETCH(0xD0, 0xC957); operand = 0x0091; REL; BNE; if (pc != 0xC957) goto L_C8E8; 
+L_C957: STEP; FETCH(0xC6, 0xC959); operand = 0x0065; ZP; DEC; 
+L_C959: STEP; FETCH(0xD0, 0xC95B); operand = 0x0004; REL; BNE; if (pc != 0xC95B) goto L_C95F; 
+L_C95B: STEP; FETCH(0x68, 0xC95C); operand = 0x0000; IMP; PLA; 
+L_C95C: STEP; FETCH(0x4C, 0xC95F); operand = 0xC7EF; ABSO; JMP; goto L_C7EF;
+L_C95F: STEP; FETCH(0x20, 0xC962); operand = 0x0073; ABSO; JSR; goto out;
+L_C962: STEP; FETCH(0x20, 0xC965); operand = 0xC96B; ABSO; JSR; goto L_C96B;
+L_C965: STEP; FETCH(0xC9, 0xC967); operand = 0x002C; IMM; CMP(IMMV); 
+L_C967: STEP; FETCH(0xF0, 0xC969); operand = 0x00EE; REL; BEQ; if (pc != 0xC969) goto L_C957; 
+L_C969: STEP; FETCH(0x68, 0xC96A); operand = 0x0000; IMP; PLA; 
+L_C96A: STEP; FETCH(0x60, 0xC96B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C96B: STEP; FETCH(0xA2, 0xC96D); operand = 0x0000; IMM; LDX(IMMV); 
+L_C96D: STEP; FETCH(0x86, 0xC96F); operand = 0x0014; ZP; STX; 
+L_C96F: STEP; FETCH(0x86, 0xC971); operand = 0x0015; ZP; STX; 
+L_C971: STEP; FETCH(0xB0, 0xC973); operand = 0x00F7; REL; BCS; if (pc != 0xC973) goto L_C96A; 
+L_C973: STEP; FETCH(0xE9, 0xC975); operand = 0x002F; IMM; SBC(IMMV); 
+L_C975: STEP; FETCH(0x85, 0xC977); operand = 0x0007; ZP; STA; 
+L_C977: STEP; FETCH(0xA5, 0xC979); operand = 0x0015; ZP; LDA(MEM); 
+L_C979: STEP; FETCH(0x85, 0xC97B); operand = 0x0022; ZP; STA; 
+L_C97B: STEP; FETCH(0xC9, 0xC97D); operand = 0x0019; IMM; CMP(IMMV); 
+L_C97D: STEP; FETCH(0xB0, 0xC97F); operand = 0x00D4; REL; BCS; if (pc != 0xC97F) goto L_C953; 
+L_C97F: STEP; FETCH(0xA5, 0xC981); operand = 0x0014; ZP; LDA(MEM); 
+L_C981: STEP; FETCH(0x0A, 0xC982); operand = 0x0000; ACC; ASL_A; 
+L_C982: STEP; FETCH(0x26, 0xC984); operand = 0x0022; ZP; ROL; 
+L_C984: STEP; FETCH(0x0A, 0xC985); operand = 0x0000; ACC; ASL_A; 
+L_C985: STEP; FETCH(0x26, 0xC987); operand = 0x0022; ZP; ROL; 
+L_C987: STEP; FETCH(0x65, 0xC989); operand = 0x0014; ZP; ADC(MEM); 
+L_C989: STEP; FETCH(0x85, 0xC98B); operand = 0x0014; ZP; STA; 
+L_C98B: STEP; FETCH(0xA5, 0xC98D); operand = 0x0022; ZP; LDA(MEM); 
+L_C98D: STEP; FETCH(0x65, 0xC98F); operand = 0x0015; ZP; ADC(MEM); 
+L_C98F: STEP; FETCH(0x85, 0xC991); operand = 0x0015; ZP; STA; 
+L_C991: STEP; FETCH(0x06, 0xC993); operand = 0x0014; ZP; ASL; 
+L_C993: STEP; FETCH(0x26, 0xC995); operand = 0x0015; ZP; ROL; 
+L_C995: STEP; FETCH(0xA5, 0xC997); operand = 0x0014; ZP; LDA(MEM); 
+L_C997: STEP; FETCH(0x65, 0xC999); operand = 0x0007; ZP; ADC(MEM); 
+L_C999: STEP; FETCH(0x85, 0xC99B); operand = 0x0014; ZP; STA; 
+L_C99B: STEP; FETCH(0x90, 0xC99D); operand = 0x0002; REL; BCC; if (pc != 0xC99D) goto L_C99F; 
+L_C99D: STEP; FETCH(0xE6, 0xC99F); operand = 0x0015; ZP; INC; 
+L_C99F: STEP; FETCH(0x20, 0xC9A2); operand = 0x0073; ABSO; JSR; goto out;
+L_C9A2: STEP; FETCH(0x4C, 0xC9A5); operand = 0xC971; ABSO; JMP; goto L_C971;
+L_C9A5: STEP; FETCH(0x20, 0xC9A8); operand = 0xD08B; ABSO; JSR; goto L_D08B;
+L_C9A8: STEP; FETCH(0x85, 0xC9AA); operand = 0x0049; ZP; STA; 
+L_C9AA: STEP; FETCH(0x84, 0xC9AC); operand = 0x004A; ZP; STY; 
+L_C9AC: STEP; FETCH(0xA9, 0xC9AE); operand = 0x00B2; IMM; LDA(IMMV); 
+L_C9AE: STEP; FETCH(0x20, 0xC9B1); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_C9B1: STEP; FETCH(0xA5, 0xC9B3); operand = 0x000E; ZP; LDA(MEM); 
+L_C9B3: STEP; FETCH(0x48, 0xC9B4); operand = 0x0000; IMP; PHA; 
+L_C9B4: STEP; FETCH(0xA5, 0xC9B6); operand = 0x000D; ZP; LDA(MEM); 
+L_C9B6: STEP; FETCH(0x48, 0xC9B7); operand = 0x0000; IMP; PHA; 
+L_C9B7: STEP; FETCH(0x20, 0xC9BA); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_C9BA: STEP; FETCH(0x68, 0xC9BB); operand = 0x0000; IMP; PLA; 
+L_C9BB: STEP; FETCH(0x2A, 0xC9BC); operand = 0x0000; ACC; ROL_A; 
+L_C9BC: STEP; FETCH(0x20, 0xC9BF); operand = 0xCD90; ABSO; JSR; goto L_CD90;
+L_C9BF: STEP; FETCH(0xD0, 0xC9C1); operand = 0x0018; REL; BNE; if (pc != 0xC9C1) goto L_C9D9; 
+L_C9C1: STEP; FETCH(0x68, 0xC9C2); operand = 0x0000; IMP; PLA; 
+L_C9C2: STEP; FETCH(0x10, 0xC9C4); operand = 0x0012; REL; BPL; if (pc != 0xC9C4) goto L_C9D6; 
+L_C9C4: STEP; FETCH(0x20, 0xC9C7); operand = 0xDC1B; ABSO; JSR; goto L_DC1B;
+L_C9C7: STEP; FETCH(0x20, 0xC9CA); operand = 0xD1BF; ABSO; JSR; goto L_D1BF;
+L_C9CA: STEP; FETCH(0xA0, 0xC9CC); operand = 0x0000; IMM; LDY(IMMV); 
+L_C9CC: STEP; FETCH(0xA5, 0xC9CE); operand = 0x0064; ZP; LDA(MEM); 
+L_C9CE: STEP; FETCH(0x91, 0xC9D0); operand = 0x0049; INDY(0); STA; 
+L_C9D0: STEP; FETCH(0xC8, 0xC9D1); operand = 0x0000; IMP; INY; 
+L_C9D1: STEP; FETCH(0xA5, 0xC9D3); operand = 0x0065; ZP; LDA(MEM); 
+L_C9D3: STEP; FETCH(0x91, 0xC9D5); operand = 0x0049; INDY(0); STA; 
+L_C9D5: STEP; FETCH(0x60, 0xC9D6); operand = 0x0000; IMP; RTS; goto dispatch;
+L_C9D6: STEP; FETCH(0x4C, 0xC9D9); operand = 0xDBD0; ABSO; JMP; goto L_DBD0;
+L_C9D9: STEP; FETCH(0x68, 0xC9DA); operand = 0x0000; IMP; PLA; 
+L_C9DA: STEP; FETCH(0xA4, 0xC9DC); operand = 0x004A; ZP; LDY(MEM); 
+L_C9DC: STEP; FETCH(0xC0, 0xC9DE); operand = 0x00DF; IMM; CPY(IMMV); 
+L_C9DE: STEP; FETCH(0xD0, 0xC9E0); operand = 0x004C; REL; BNE; if (pc != 0xC9E0) goto L_CA2C; 
+L_C9E0: STEP; FETCH(0x20, 0xC9E3); operand = 0xD6A6; ABSO; JSR; goto L_D6A6;
+L_C9E3: STEP; FETCH(0xC9, 0xC9E5); operand = 0x0006; IMM; CMP(IMMV); 
+L_C9E5: STEP; FETCH(0xD0, 0xC9E7); operand = 0x003D; REL; BNE; if (pc != 0xC9E7) goto L_CA24; 
+L_C9E7: STEP; FETCH(0xA0, 0xC9E9); operand = 0x0000; IMM; LDY(IMMV); 
+L_C9E9: STEP; FETCH(0x84, 0xC9EB); operand = 0x0061; ZP; STY; 
+L_C9EB: STEP; FETCH(0x84, 0xC9ED); operand = 0x0066; ZP; STY; 
+L_C9ED: STEP; FETCH(0x84, 0xC9EF); operand = 0x0071; ZP; STY; 
+L_C9EF: STEP; FETCH(0x20, 0xC9F2); operand = 0xCA1D; ABSO; JSR; goto L_CA1D;
+L_C9F2: STEP; FETCH(0x20, 0xC9F5); operand = 0xDAE2; ABSO; JSR; goto L_DAE2;
+L_C9F5: STEP; FETCH(0xE6, 0xC9F7); operand = 0x0071; ZP; INC; 
+L_C9F7: STEP; FETCH(0xA4, 0xC9F9); operand = 0x0071; ZP; LDY(MEM); 
+L_C9F9: STEP; FETCH(0x20, 0xC9FC); operand = 0xCA1D; ABSO; JSR; goto L_CA1D;
+L_C9FC: STEP; FETCH(0x20, 0xC9FF); operand = 0xDC0C; ABSO; JSR; goto L_DC0C;
+L_C9FF: STEP; FETCH(0xAA, 0xCA00); operand = 0x0000; IMP; TAX; 
+L_CA00: STEP; FETCH(0xF0, 0xCA02); operand = 0x0005; REL; BEQ; if (pc != 0xCA02) goto L_CA07; 
+L_CA02: STEP; FETCH(0xE8, 0xCA03); operand = 0x0000; IMP; INX; 
+L_CA03: STEP; FETCH(0x8A, 0xCA04); operand = 0x0000; IMP; TXA; 
+L_CA04: STEP; FETCH(0x20, 0xCA07); operand = 0xDAED; ABSO; JSR; goto L_DAED;
+L_CA07: STEP; FETCH(0xA4, 0xCA09); operand = 0x0071; ZP; LDY(MEM); 
+L_CA09: STEP; FETCH(0xC8, 0xCA0A); operand = 0x0000; IMP; INY; 
+L_CA0A: STEP; FETCH(0xC0, 0xCA0C); operand = 0x0006; IMM; CPY(IMMV); 
+L_CA0C: STEP; FETCH(0xD0, 0xCA0E); operand = 0x00DF; REL; BNE; if (pc != 0xCA0E) goto L_C9ED; 
+L_CA0E: STEP; FETCH(0x20, 0xCA11); operand = 0xDAE2; ABSO; JSR; goto L_DAE2;
+L_CA11: STEP; FETCH(0x20, 0xCA14); operand = 0xDC9B; ABSO; JSR; goto L_DC9B;
+L_CA14: STEP; FETCH(0xA6, 0xCA16); operand = 0x0064; ZP; LDX(MEM); 
+L_CA16: STEP; FETCH(0xA4, 0xCA18); operand = 0x0063; ZP; LDY(MEM); 
+L_CA18: STEP; FETCH(0xA5, 0xCA1A); operand = 0x0065; ZP; LDA(MEM); 
+L_CA1A: STEP; FETCH(0x4C, 0xCA1D); operand = 0xFFDB; ABSO; JMP; goto L_FFDB;
+L_CA1D: STEP; FETCH(0xB1, 0xCA1F); operand = 0x0022; INDY(1); LDA(MEM); 
+L_CA1F: STEP; FETCH(0x20, 0xCA22); operand = 0x0080; ABSO; JSR; goto out;
+L_CA22: STEP; FETCH(0x90, 0xCA24); operand = 0x0003; REL; BCC; if (pc != 0xCA24) goto L_CA27; 
+L_CA24: STEP; FETCH(0x4C, 0xCA27); operand = 0xD248; ABSO; JMP; goto L_D248;
+L_CA27: STEP; FETCH(0xE9, 0xCA29); operand = 0x002F; IMM; SBC(IMMV); 
+L_CA29: STEP; FETCH(0x4C, 0xCA2C); operand = 0xDD7E; ABSO; JMP; goto L_DD7E;
+L_CA2C: STEP; FETCH(0xA0, 0xCA2E); operand = 0x0002; IMM; LDY(IMMV); 
+L_CA2E: STEP; FETCH(0xB1, 0xCA30); operand = 0x0064; INDY(1); LDA(MEM); 
+L_CA30: STEP; FETCH(0xC5, 0xCA32); operand = 0x0034; ZP; CMP(MEM); 
+L_CA32: STEP; FETCH(0x90, 0xCA34); operand = 0x0017; REL; BCC; if (pc != 0xCA34) goto L_CA4B; 
+L_CA34: STEP; FETCH(0xD0, 0xCA36); operand = 0x0007; REL; BNE; if (pc != 0xCA36) goto L_CA3D; 
+L_CA36: STEP; FETCH(0x88, 0xCA37); operand = 0x0000; IMP; DEY; 
+L_CA37: STEP; FETCH(0xB1, 0xCA39); operand = 0x0064; INDY(1); LDA(MEM); 
+L_CA39: STEP; FETCH(0xC5, 0xCA3B); operand = 0x0033; ZP; CMP(MEM); 
+L_CA3B: STEP; FETCH(0x90, 0xCA3D); operand = 0x000E; REL; BCC; if (pc != 0xCA3D) goto L_CA4B; 
+L_CA3D: STEP; FETCH(0xA4, 0xCA3F); operand = 0x0065; ZP; LDY(MEM); 
+L_CA3F: STEP; FETCH(0xC4, 0xCA41); operand = 0x002E; ZP; CPY(MEM); 
+L_CA41: STEP; FETCH(0x90, 0xCA43); operand = 0x0008; REL; BCC; if (pc != 0xCA43) goto L_CA4B; 
+L_CA43: STEP; FETCH(0xD0, 0xCA45); operand = 0x000D; REL; BNE; if (pc != 0xCA45) goto L_CA52; 
+L_CA45: STEP; FETCH(0xA5, 0xCA47); operand = 0x0064; ZP; LDA(MEM); 
+L_CA47: STEP; FETCH(0xC5, 0xCA49); operand = 0x002D; ZP; CMP(MEM); 
+L_CA49: STEP; FETCH(0xB0, 0xCA4B); operand = 0x0007; REL; BCS; if (pc != 0xCA4B) goto L_CA52; 
+L_CA4B: STEP; FETCH(0xA5, 0xCA4D); operand = 0x0064; ZP; LDA(MEM); 
+L_CA4D: STEP; FETCH(0xA4, 0xCA4F); operand = 0x0065; ZP; LDY(MEM); 
+L_CA4F: STEP; FETCH(0x4C, 0xCA52); operand = 0xCA68; ABSO; JMP; goto L_CA68;
+L_CA52: STEP; FETCH(0xA0, 0xCA54); operand = 0x0000; IMM; LDY(IMMV); 
+L_CA54: STEP; FETCH(0xB1, 0xCA56); operand = 0x0064; INDY(1); LDA(MEM); 
+L_CA56: STEP; FETCH(0x20, 0xCA59); operand = 0xD475; ABSO; JSR; goto L_D475;
+L_CA59: STEP; FETCH(0xA5, 0xCA5B); operand = 0x0050; ZP; LDA(MEM); 
+L_CA5B: STEP; FETCH(0xA4, 0xCA5D); operand = 0x0051; ZP; LDY(MEM); 
+L_CA5D: STEP; FETCH(0x85, 0xCA5F); operand = 0x006F; ZP; STA; 
+L_CA5F: STEP; FETCH(0x84, 0xCA61); operand = 0x0070; ZP; STY; 
+L_CA61: STEP; FETCH(0x20, 0xCA64); operand = 0xD67A; ABSO; JSR; goto L_D67A;
+L_CA64: STEP; FETCH(0xA9, 0xCA66); operand = 0x0061; IMM; LDA(IMMV); 
+L_CA66: STEP; FETCH(0xA0, 0xCA68); operand = 0x0000; IMM; LDY(IMMV); 
+L_CA68: STEP; FETCH(0x85, 0xCA6A); operand = 0x0050; ZP; STA; 
+L_CA6A: STEP; FETCH(0x84, 0xCA6C); operand = 0x0051; ZP; STY; 
+L_CA6C: STEP; FETCH(0x20, 0xCA6F); operand = 0xD6DB; ABSO; JSR; goto L_D6DB;
+L_CA6F: STEP; FETCH(0xA0, 0xCA71); operand = 0x0000; IMM; LDY(IMMV); 
+L_CA71: STEP; FETCH(0xB1, 0xCA73); operand = 0x0050; INDY(1); LDA(MEM); 
+L_CA73: STEP; FETCH(0x91, 0xCA75); operand = 0x0049; INDY(0); STA; 
+L_CA75: STEP; FETCH(0xC8, 0xCA76); operand = 0x0000; IMP; INY; 
+L_CA76: STEP; FETCH(0xB1, 0xCA78); operand = 0x0050; INDY(1); LDA(MEM); 
+L_CA78: STEP; FETCH(0x91, 0xCA7A); operand = 0x0049; INDY(0); STA; 
+L_CA7A: STEP; FETCH(0xC8, 0xCA7B); operand = 0x0000; IMP; INY; 
+L_CA7B: STEP; FETCH(0xB1, 0xCA7D); operand = 0x0050; INDY(1); LDA(MEM); 
+L_CA7D: STEP; FETCH(0x91, 0xCA7F); operand = 0x0049; INDY(0); STA; 
+L_CA7F: STEP; FETCH(0x60, 0xCA80); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CA80: STEP; FETCH(0x20, 0xCA83); operand = 0xCA86; ABSO; JSR; goto L_CA86;
+L_CA83: STEP; FETCH(0x4C, 0xCA86); operand = 0xCBB5; ABSO; JMP; goto L_CBB5;
+L_CA86: STEP; FETCH(0x20, 0xCA89); operand = 0xD79E; ABSO; JSR; goto L_D79E;
+L_CA89: STEP; FETCH(0xF0, 0xCA8B); operand = 0x0005; REL; BEQ; if (pc != 0xCA8B) goto L_CA90; 
+L_CA8B: STEP; FETCH(0xA9, 0xCA8D); operand = 0x002C; IMM; LDA(IMMV); 
+L_CA8D: STEP; FETCH(0x20, 0xCA90); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_CA90: STEP; FETCH(0x08, 0xCA91); operand = 0x0000; IMP; PHP; 
+L_CA91: STEP; FETCH(0x86, 0xCA93); operand = 0x0013; ZP; STX; 
+L_CA93: STEP; FETCH(0x20, 0xCA96); operand = 0xE115; ABSO; JSR; goto L_E115;
+L_CA96: STEP; FETCH(0x28, 0xCA97); operand = 0x0000; IMP; PLP; 
+L_CA97: STEP; FETCH(0x4C, 0xCA9A); operand = 0xCAA0; ABSO; JMP; goto L_CAA0;
+L_CA9A: STEP; FETCH(0x20, 0xCA9D); operand = 0xCB21; ABSO; JSR; goto L_CB21;
+L_CA9D: STEP; FETCH(0x20, 0xCAA0); operand = 0x0079; ABSO; JSR; goto out;
+L_CAA0: STEP; FETCH(0xF0, 0xCAA2); operand = 0x0035; REL; BEQ; if (pc != 0xCAA2) goto L_CAD7; 
+L_CAA2: STEP; FETCH(0xF0, 0xCAA4); operand = 0x0043; REL; BEQ; if (pc != 0xCAA4) goto L_CAE7; 
+L_CAA4: STEP; FETCH(0xC9, 0xCAA6); operand = 0x00A3; IMM; CMP(IMMV); 
+L_CAA6: STEP; FETCH(0xF0, 0xCAA8); operand = 0x0050; REL; BEQ; if (pc != 0xCAA8) goto L_CAF8; 
+L_CAA8: STEP; FETCH(0xC9, 0xCAAA); operand = 0x00A6; IMM; CMP(IMMV); 
+L_CAAA: STEP; FETCH(0x18, 0xCAAB); operand = 0x0000; IMP; CLC; 
+L_CAAB: STEP; FETCH(0xF0, 0xCAAD); operand = 0x004B; REL; BEQ; if (pc != 0xCAAD) goto L_CAF8; 
+L_CAAD: STEP; FETCH(0xC9, 0xCAAF); operand = 0x002C; IMM; CMP(IMMV); 
+L_CAAF: STEP; FETCH(0xF0, 0xCAB1); operand = 0x0037; REL; BEQ; if (pc != 0xCAB1) goto L_CAE8; 
+L_CAB1: STEP; FETCH(0xC9, 0xCAB3); operand = 0x003B; IMM; CMP(IMMV); 
+L_CAB3: STEP; FETCH(0xF0, 0xCAB5); operand = 0x005E; REL; BEQ; if (pc != 0xCAB5) goto L_CB13; 
+L_CAB5: STEP; FETCH(0x20, 0xCAB8); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_CAB8: STEP; FETCH(0x24, 0xCABA); operand = 0x000D; ZP; BIT(MEM); 
+L_CABA: STEP; FETCH(0x30, 0xCABC); operand = 0x00DE; REL; BMI; if (pc != 0xCABC) goto L_CA9A; 
+L_CABC: STEP; FETCH(0x20, 0xCABF); operand = 0xDDDD; ABSO; JSR; goto L_DDDD;
+L_CABF: STEP; FETCH(0x20, 0xCAC2); operand = 0xD487; ABSO; JSR; goto L_D487;
+L_CAC2: STEP; FETCH(0x20, 0xCAC5); operand = 0xCB21; ABSO; JSR; goto L_CB21;
+L_CAC5: STEP; FETCH(0x20, 0xCAC8); operand = 0xCB3B; ABSO; JSR; goto L_CB3B;
+L_CAC8: STEP; FETCH(0xD0, 0xCACA); operand = 0x00D3; REL; BNE; if (pc != 0xCACA) goto L_CA9D; 
+L_CACA: STEP; FETCH(0xA9, 0xCACC); operand = 0x0000; IMM; LDA(IMMV); 
+L_CACC: STEP; FETCH(0x9D, 0xCACF); operand = 0x0200; ABSX(0); STA; 
+L_CACF: STEP; FETCH(0xA2, 0xCAD1); operand = 0x00FF; IMM; LDX(IMMV); 
+L_CAD1: STEP; FETCH(0xA0, 0xCAD3); operand = 0x0001; IMM; LDY(IMMV); 
+L_CAD3: STEP; FETCH(0xA5, 0xCAD5); operand = 0x0013; ZP; LDA(MEM); 
+L_CAD5: STEP; FETCH(0xD0, 0xCAD7); operand = 0x0010; REL; BNE; if (pc != 0xCAD7) goto L_CAE7; 
+L_CAD7: STEP; FETCH(0xA9, 0xCAD9); operand = 0x000D; IMM; LDA(IMMV); 
+L_CAD9: STEP; FETCH(0x20, 0xCADC); operand = 0xCB47; ABSO; JSR; goto L_CB47;
+L_CADC: STEP; FETCH(0x24, 0xCADE); operand = 0x0013; ZP; BIT(MEM); 
+L_CADE: STEP; FETCH(0x10, 0xCAE0); operand = 0x0005; REL; BPL; if (pc != 0xCAE0) goto L_CAE5; 
+L_CAE0: STEP; FETCH(0xA9, 0xCAE2); operand = 0x000A; IMM; LDA(IMMV); 
+L_CAE2: STEP; FETCH(0x20, 0xCAE5); operand = 0xCB47; ABSO; JSR; goto L_CB47;
+L_CAE5: STEP; FETCH(0x49, 0xCAE7); operand = 0x00FF; IMM; EOR(IMMV); 
+L_CAE7: STEP; FETCH(0x60, 0xCAE8); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CAE8: STEP; FETCH(0x38, 0xCAE9); operand = 0x0000; IMP; SEC; 
+L_CAE9: STEP; FETCH(0x20, 0xCAEC); operand = 0xFFF0; ABSO; JSR; goto L_FFF0;
+L_CAEC: STEP; FETCH(0x98, 0xCAED); operand = 0x0000; IMP; TYA; 
+L_CAED: STEP; FETCH(0x38, 0xCAEE); operand = 0x0000; IMP; SEC; 
+L_CAEE: STEP; FETCH(0xE9, 0xCAF0); operand = 0x000B; IMM; SBC(IMMV); 
+L_CAF0: STEP; FETCH(0xB0, 0xCAF2); operand = 0x00FC; REL; BCS; if (pc != 0xCAF2) goto L_CAEE; 
+L_CAF2: STEP; FETCH(0x49, 0xCAF4); operand = 0x00FF; IMM; EOR(IMMV); 
+L_CAF4: STEP; FETCH(0x69, 0xCAF6); operand = 0x0001; IMM; ADC(IMMV); 
+L_CAF6: STEP; FETCH(0xD0, 0xCAF8); operand = 0x0016; REL; BNE; if (pc != 0xCAF8) goto L_CB0E; 
+L_CAF8: STEP; FETCH(0x08, 0xCAF9); operand = 0x0000; IMP; PHP; 
+L_CAF9: STEP; FETCH(0x38, 0xCAFA); operand = 0x0000; IMP; SEC; 
+L_CAFA: STEP; FETCH(0x20, 0xCAFD); operand = 0xFFF0; ABSO; JSR; goto L_FFF0;
+L_CAFD: STEP; FETCH(0x84, 0xCAFF); operand = 0x0009; ZP; STY; 
+L_CAFF: STEP; FETCH(0x20, 0xCB02); operand = 0xD79B; ABSO; JSR; goto L_D79B;
+L_CB02: STEP; FETCH(0xC9, 0xCB04); operand = 0x0029; IMM; CMP(IMMV); 
+L_CB04: STEP; FETCH(0xD0, 0xCB06); operand = 0x0059; REL; BNE; if (pc != 0xCB06) goto L_CB5F; 
+L_CB06: STEP; FETCH(0x28, 0xCB07); operand = 0x0000; IMP; PLP; 
+L_CB07: STEP; FETCH(0x90, 0xCB09); operand = 0x0006; REL; BCC; if (pc != 0xCB09) goto L_CB0F; 
+L_CB09: STEP; FETCH(0x8A, 0xCB0A); operand = 0x0000; IMP; TXA; 
+L_CB0A: STEP; FETCH(0xE5, 0xCB0C); operand = 0x0009; ZP; SBC(MEM); 
+L_CB0C: STEP; FETCH(0x90, 0xCB0E); operand = 0x0005; REL; BCC; if (pc != 0xCB0E) goto L_CB13; 
+L_CB0E: STEP; FETCH(0xAA, 0xCB0F); operand = 0x0000; IMP; TAX; 
+L_CB0F: STEP; FETCH(0xE8, 0xCB10); operand = 0x0000; IMP; INX; 
+L_CB10: STEP; FETCH(0xCA, 0xCB11); operand = 0x0000; IMP; DEX; 
+L_CB11: STEP; FETCH(0xD0, 0xCB13); operand = 0x0006; REL; BNE; if (pc != 0xCB13) goto L_CB19; 
+L_CB13: STEP; FETCH(0x20, 0xCB16); operand = 0x0073; ABSO; JSR; goto out;
+L_CB16: STEP; FETCH(0x4C, 0xCB19); operand = 0xCAA2; ABSO; JMP; goto L_CAA2;
+L_CB19: STEP; FETCH(0x20, 0xCB1C); operand = 0xCB3B; ABSO; JSR; goto L_CB3B;
+L_CB1C: STEP; FETCH(0xD0, 0xCB1E); operand = 0x00F2; REL; BNE; if (pc != 0xCB1E) goto L_CB10; 
+L_CB1E: STEP; FETCH(0x20, 0xCB21); operand = 0xD487; ABSO; JSR; goto L_D487;
+L_CB21: STEP; FETCH(0x20, 0xCB24); operand = 0xD6A6; ABSO; JSR; goto L_D6A6;
+L_CB24: STEP; FETCH(0xAA, 0xCB25); operand = 0x0000; IMP; TAX; 
+L_CB25: STEP; FETCH(0xA0, 0xCB27); operand = 0x0000; IMM; LDY(IMMV); 
+L_CB27: STEP; FETCH(0xE8, 0xCB28); operand = 0x0000; IMP; INX; 
+L_CB28: STEP; FETCH(0xCA, 0xCB29); operand = 0x0000; IMP; DEX; 
+L_CB29: STEP; FETCH(0xF0, 0xCB2B); operand = 0x00BC; REL; BEQ; if (pc != 0xCB2B) goto L_CAE7; 
+L_CB2B: STEP; FETCH(0xB1, 0xCB2D); operand = 0x0022; INDY(1); LDA(MEM); 
+L_CB2D: STEP; FETCH(0x20, 0xCB30); operand = 0xCB47; ABSO; JSR; goto L_CB47;
+L_CB30: STEP; FETCH(0xC8, 0xCB31); operand = 0x0000; IMP; INY; 
+L_CB31: STEP; FETCH(0xC9, 0xCB33); operand = 0x000D; IMM; CMP(IMMV); 
+L_CB33: STEP; FETCH(0xD0, 0xCB35); operand = 0x00F3; REL; BNE; if (pc != 0xCB35) goto L_CB28; 
+L_CB35: STEP; FETCH(0x20, 0xCB38); operand = 0xCAE5; ABSO; JSR; goto L_CAE5;
+L_CB38: STEP; FETCH(0x4C, 0xCB3B); operand = 0xCB28; ABSO; JMP; goto L_CB28;
+L_CB3B: STEP; FETCH(0xA5, 0xCB3D); operand = 0x0013; ZP; LDA(MEM); 
+L_CB3D: STEP; FETCH(0xF0, 0xCB3F); operand = 0x0003; REL; BEQ; if (pc != 0xCB3F) goto L_CB42; 
+L_CB3F: STEP; FETCH(0xA9, 0xCB41); operand = 0x0020; IMM; LDA(IMMV); 
+L_CB41: STEP; FETCH(0x2C, 0xCB44); operand = 0x1DA9; ABSO; BIT(MEM); goto L_CB44;
+L_CB42: STEP; FETCH(0xA9, 0xCB44); operand = 0x001D; IMM; LDA(IMMV); 
+L_CB44: STEP; FETCH(0x2C, 0xCB47); operand = 0x3FA9; ABSO; BIT(MEM); goto L_CB47;
+L_CB45: STEP; FETCH(0xA9, 0xCB47); operand = 0x003F; IMM; LDA(IMMV); 
+L_CB47: STEP; FETCH(0x20, 0xCB4A); operand = 0xE109; ABSO; JSR; goto L_E109;
+L_CB4A: STEP; FETCH(0x29, 0xCB4C); operand = 0x00FF; IMM; AND(IMMV); 
+L_CB4C: STEP; FETCH(0x60, 0xCB4D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CB4D: STEP; FETCH(0xA5, 0xCB4F); operand = 0x0011; ZP; LDA(MEM); 
+L_CB4F: STEP; FETCH(0xF0, 0xCB51); operand = 0x0011; REL; BEQ; if (pc != 0xCB51) goto L_CB62; 
+L_CB51: STEP; FETCH(0x30, 0xCB53); operand = 0x0004; REL; BMI; if (pc != 0xCB53) goto L_CB57; 
+L_CB53: STEP; FETCH(0xA0, 0xCB55); operand = 0x00FF; IMM; LDY(IMMV); 
+L_CB55: STEP; FETCH(0xD0, 0xCB57); operand = 0x0004; REL; BNE; if (pc != 0xCB57) goto L_CB5B; 
+L_CB57: STEP; FETCH(0xA5, 0xCB59); operand = 0x003F; ZP; LDA(MEM); 
+L_CB59: STEP; FETCH(0xA4, 0xCB5B); operand = 0x0040; ZP; LDY(MEM); 
+L_CB5B: STEP; FETCH(0x85, 0xCB5D); operand = 0x0039; ZP; STA; 
+L_CB5D: STEP; FETCH(0x84, 0xCB5F); operand = 0x003A; ZP; STY; 
+L_CB5F: STEP; FETCH(0x4C, 0xCB62); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_CB62: STEP; FETCH(0xA5, 0xCB64); operand = 0x0013; ZP; LDA(MEM); 
+L_CB64: STEP; FETCH(0xF0, 0xCB66); operand = 0x0005; REL; BEQ; if (pc != 0xCB66) goto L_CB6B; 
+L_CB66: STEP; FETCH(0xA2, 0xCB68); operand = 0x0018; IMM; LDX(IMMV); 
+L_CB68: STEP; FETCH(0x4C, 0xCB6B); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_CB6B: STEP; FETCH(0xA9, 0xCB6D); operand = 0x000C; IMM; LDA(IMMV); 
+L_CB6D: STEP; FETCH(0xA0, 0xCB6F); operand = 0x00CD; IMM; LDY(IMMV); 
+L_CB6F: STEP; FETCH(0x20, 0xCB72); operand = 0xCB1E; ABSO; JSR; goto L_CB1E;
+L_CB72: STEP; FETCH(0xA5, 0xCB74); operand = 0x003D; ZP; LDA(MEM); 
+L_CB74: STEP; FETCH(0xA4, 0xCB76); operand = 0x003E; ZP; LDY(MEM); 
+L_CB76: STEP; FETCH(0x85, 0xCB78); operand = 0x007A; ZP; STA; 
+L_CB78: STEP; FETCH(0x84, 0xCB7A); operand = 0x007B; ZP; STY; 
+L_CB7A: STEP; FETCH(0x60, 0xCB7B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CB7B: STEP; FETCH(0x20, 0xCB7E); operand = 0xD3A6; ABSO; JSR; goto L_D3A6;
+L_CB7E: STEP; FETCH(0xC9, 0xCB80); operand = 0x0023; IMM; CMP(IMMV); 
+L_CB80: STEP; FETCH(0xD0, 0xCB82); operand = 0x0010; REL; BNE; if (pc != 0xCB82) goto L_CB92; 
+L_CB82: STEP; FETCH(0x20, 0xCB85); operand = 0x0073; ABSO; JSR; goto out;
+L_CB85: STEP; FETCH(0x20, 0xCB88); operand = 0xD79E; ABSO; JSR; goto L_D79E;
+L_CB88: STEP; FETCH(0xA9, 0xCB8A); operand = 0x002C; IMM; LDA(IMMV); 
+L_CB8A: STEP; FETCH(0x20, 0xCB8D); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_CB8D: STEP; FETCH(0x86, 0xCB8F); operand = 0x0013; ZP; STX; 
+L_CB8F: STEP; FETCH(0x20, 0xCB92); operand = 0xE11B; ABSO; JSR; goto L_E11B;
+L_CB92: STEP; FETCH(0xA2, 0xCB94); operand = 0x0001; IMM; LDX(IMMV); 
+L_CB94: STEP; FETCH(0xA0, 0xCB96); operand = 0x0002; IMM; LDY(IMMV); 
+L_CB96: STEP; FETCH(0xA9, 0xCB98); operand = 0x0000; IMM; LDA(IMMV); 
+L_CB98: STEP; FETCH(0x8D, 0xCB9B); operand = 0x0201; ABSO; STA; 
+L_CB9B: STEP; FETCH(0xA9, 0xCB9D); operand = 0x0040; IMM; LDA(IMMV); 
+L_CB9D: STEP; FETCH(0x20, 0xCBA0); operand = 0xCC0F; ABSO; JSR; goto L_CC0F;
+L_CBA0: STEP; FETCH(0xA6, 0xCBA2); operand = 0x0013; ZP; LDX(MEM); 
+L_CBA2: STEP; FETCH(0xD0, 0xCBA4); operand = 0x0013; REL; BNE; if (pc != 0xCBA4) goto L_CBB7; 
+L_CBA4: STEP; FETCH(0x60, 0xCBA5); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CBA5: STEP; FETCH(0x20, 0xCBA8); operand = 0xD79E; ABSO; JSR; goto L_D79E;
+L_CBA8: STEP; FETCH(0xA9, 0xCBAA); operand = 0x002C; IMM; LDA(IMMV); 
+L_CBAA: STEP; FETCH(0x20, 0xCBAD); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_CBAD: STEP; FETCH(0x86, 0xCBAF); operand = 0x0013; ZP; STX; 
+L_CBAF: STEP; FETCH(0x20, 0xCBB2); operand = 0xE11B; ABSO; JSR; goto L_E11B;
+L_CBB2: STEP; FETCH(0x20, 0xCBB5); operand = 0xCBCE; ABSO; JSR; goto L_CBCE;
+L_CBB5: STEP; FETCH(0xA5, 0xCBB7); operand = 0x0013; ZP; LDA(MEM); 
+L_CBB7: STEP; FETCH(0x20, 0xCBBA); operand = 0xFFCC; ABSO; JSR; goto L_FFCC;
+L_CBBA: STEP; FETCH(0xA2, 0xCBBC); operand = 0x0000; IMM; LDX(IMMV); 
+L_CBBC: STEP; FETCH(0x86, 0xCBBE); operand = 0x0013; ZP; STX; 
+L_CBBE: STEP; FETCH(0x60, 0xCBBF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CBBF: STEP; FETCH(0xC9, 0xCBC1); operand = 0x0022; IMM; CMP(IMMV); 
+L_CBC1: STEP; FETCH(0xD0, 0xCBC3); operand = 0x000B; REL; BNE; if (pc != 0xCBC3) goto L_CBCE; 
+L_CBC3: STEP; FETCH(0x20, 0xCBC6); operand = 0xCEBD; ABSO; JSR; goto L_CEBD;
+L_CBC6: STEP; FETCH(0xA9, 0xCBC8); operand = 0x003B; IMM; LDA(IMMV); 
+L_CBC8: STEP; FETCH(0x20, 0xCBCB); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_CBCB: STEP; FETCH(0x20, 0xCBCE); operand = 0xCB21; ABSO; JSR; goto L_CB21;
+L_CBCE: STEP; FETCH(0x20, 0xCBD1); operand = 0xD3A6; ABSO; JSR; goto L_D3A6;
+L_CBD1: STEP; FETCH(0xA9, 0xCBD3); operand = 0x002C; IMM; LDA(IMMV); 
+L_CBD3: STEP; FETCH(0x8D, 0xCBD6); operand = 0x01FF; ABSO; STA; 
+L_CBD6: STEP; FETCH(0x20, 0xCBD9); operand = 0xCBF9; ABSO; JSR; goto L_CBF9;
+L_CBD9: STEP; FETCH(0xA5, 0xCBDB); operand = 0x0013; ZP; LDA(MEM); 
+L_CBDB: STEP; FETCH(0xF0, 0xCBDD); operand = 0x000D; REL; BEQ; if (pc != 0xCBDD) goto L_CBEA; 
+L_CBDD: STEP; FETCH(0x20, 0xCBE0); operand = 0xFFB7; ABSO; JSR; goto L_FFB7;
+L_CBE0: STEP; FETCH(0x29, 0xCBE2); operand = 0x0002; IMM; AND(IMMV); 
+L_CBE2: STEP; FETCH(0xF0, 0xCBE4); operand = 0x0006; REL; BEQ; if (pc != 0xCBE4) goto L_CBEA; 
+L_CBE4: STEP; FETCH(0x20, 0xCBE7); operand = 0xCBB5; ABSO; JSR; goto L_CBB5;
+L_CBE7: STEP; FETCH(0x4C, 0xCBEA); operand = 0xC8F8; ABSO; JMP; goto L_C8F8;
+L_CBEA: STEP; FETCH(0xAD, 0xCBED); operand = 0x0200; ABSO; LDA(MEM); 
+L_CBED: STEP; FETCH(0xD0, 0xCBEF); operand = 0x001E; REL; BNE; if (pc != 0xCBEF) goto L_CC0D; 
+L_CBEF: STEP; FETCH(0xA5, 0xCBF1); operand = 0x0013; ZP; LDA(MEM); 
+L_CBF1: STEP; FETCH(0xD0, 0xCBF3); operand = 0x00E3; REL; BNE; if (pc != 0xCBF3) goto L_CBD6; 
+L_CBF3: STEP; FETCH(0x20, 0xCBF6); operand = 0xC906; ABSO; JSR; goto L_C906;
+L_CBF6: STEP; FETCH(0x4C, 0xCBF9); operand = 0xC8FB; ABSO; JMP; goto L_C8FB;
+L_CBF9: STEP; FETCH(0xA5, 0xCBFB); operand = 0x0013; ZP; LDA(MEM); 
+L_CBFB: STEP; FETCH(0xD0, 0xCBFD); operand = 0x0006; REL; BNE; if (pc != 0xCBFD) goto L_CC03; 
+L_CBFD: STEP; FETCH(0x20, 0xCC00); operand = 0xCB45; ABSO; JSR; goto L_CB45;
+L_CC00: STEP; FETCH(0x20, 0xCC03); operand = 0xCB3B; ABSO; JSR; goto L_CB3B;
+L_CC03: STEP; FETCH(0x4C, 0xCC06); operand = 0xC560; ABSO; JMP; goto L_C560;
+L_CC06: STEP; FETCH(0xA6, 0xCC08); operand = 0x0041; ZP; LDX(MEM); 
+L_CC08: STEP; FETCH(0xA4, 0xCC0A); operand = 0x0042; ZP; LDY(MEM); 
+L_CC0A: STEP; FETCH(0xA9, 0xCC0C); operand = 0x0098; IMM; LDA(IMMV); 
+L_CC0C: STEP; FETCH(0x2C, 0xCC0F); operand = 0x00A9; ABSO; BIT(MEM); goto L_CC0F;
+L_CC0D: STEP; FETCH(0xA9, 0xCC0F); operand = 0x0000; IMM; LDA(IMMV); 
+L_CC0F: STEP; FETCH(0x85, 0xCC11); operand = 0x0011; ZP; STA; 
+L_CC11: STEP; FETCH(0x86, 0xCC13); operand = 0x0043; ZP; STX; 
+L_CC13: STEP; FETCH(0x84, 0xCC15); operand = 0x0044; ZP; STY; 
+L_CC15: STEP; FETCH(0x20, 0xCC18); operand = 0xD08B; ABSO; JSR; goto L_D08B;
+L_CC18: STEP; FETCH(0x85, 0xCC1A); operand = 0x0049; ZP; STA; 
+L_CC1A: STEP; FETCH(0x84, 0xCC1C); operand = 0x004A; ZP; STY; 
+L_CC1C: STEP; FETCH(0xA5, 0xCC1E); operand = 0x007A; ZP; LDA(MEM); 
+L_CC1E: STEP; FETCH(0xA4, 0xCC20); operand = 0x007B; ZP; LDY(MEM); 
+L_CC20: STEP; FETCH(0x85, 0xCC22); operand = 0x004B; ZP; STA; 
+L_CC22: STEP; FETCH(0x84, 0xCC24); operand = 0x004C; ZP; STY; 
+L_CC24: STEP; FETCH(0xA6, 0xCC26); operand = 0x0043; ZP; LDX(MEM); 
+L_CC26: STEP; FETCH(0xA4, 0xCC28); operand = 0x0044; ZP; LDY(MEM); 
+L_CC28: STEP; FETCH(0x86, 0xCC2A); operand = 0x007A; ZP; STX; 
+L_CC2A: STEP; FETCH(0x84, 0xCC2C); operand = 0x007B; ZP; STY; 
+L_CC2C: STEP; FETCH(0x20, 0xCC2F); operand = 0x0079; ABSO; JSR; goto out;
+L_CC2F: STEP; FETCH(0xD0, 0xCC31); operand = 0x0020; REL; BNE; if (pc != 0xCC31) goto L_CC51; 
+L_CC31: STEP; FETCH(0x24, 0xCC33); operand = 0x0011; ZP; BIT(MEM); 
+L_CC33: STEP; FETCH(0x50, 0xCC35); operand = 0x000C; REL; BVC; if (pc != 0xCC35) goto L_CC41; 
+L_CC35: STEP; FETCH(0x20, 0xCC38); operand = 0xE121; ABSO; JSR; goto L_E121;
+L_CC38: STEP; FETCH(0x8D, 0xCC3B); operand = 0x0200; ABSO; STA; 
+L_CC3B: STEP; FETCH(0xA2, 0xCC3D); operand = 0x00FF; IMM; LDX(IMMV); 
+L_CC3D: STEP; FETCH(0xA0, 0xCC3F); operand = 0x0001; IMM; LDY(IMMV); 
+L_CC3F: STEP; FETCH(0xD0, 0xCC41); operand = 0x000C; REL; BNE; if (pc != 0xCC41) goto L_CC4D; 
+L_CC41: STEP; FETCH(0x30, 0xCC43); operand = 0x0075; REL; BMI; if (pc != 0xCC43) goto L_CCB8; 
+L_CC43: STEP; FETCH(0xA5, 0xCC45); operand = 0x0013; ZP; LDA(MEM); 
+L_CC45: STEP; FETCH(0xD0, 0xCC47); operand = 0x0003; REL; BNE; if (pc != 0xCC47) goto L_CC4A; 
+L_CC47: STEP; FETCH(0x20, 0xCC4A); operand = 0xCB45; ABSO; JSR; goto L_CB45;
+L_CC4A: STEP; FETCH(0x20, 0xCC4D); operand = 0xCBF9; ABSO; JSR; goto L_CBF9;
+L_CC4D: STEP; FETCH(0x86, 0xCC4F); operand = 0x007A; ZP; STX; 
+L_CC4F: STEP; FETCH(0x84, 0xCC51); operand = 0x007B; ZP; STY; 
+L_CC51: STEP; FETCH(0x20, 0xCC54); operand = 0x0073; ABSO; JSR; goto out;
+L_CC54: STEP; FETCH(0x24, 0xCC56); operand = 0x000D; ZP; BIT(MEM); 
+L_CC56: STEP; FETCH(0x10, 0xCC58); operand = 0x0031; REL; BPL; if (pc != 0xCC58) goto L_CC89; 
+L_CC58: STEP; FETCH(0x24, 0xCC5A); operand = 0x0011; ZP; BIT(MEM); 
+L_CC5A: STEP; FETCH(0x50, 0xCC5C); operand = 0x0009; REL; BVC; if (pc != 0xCC5C) goto L_CC65; 
+L_CC5C: STEP; FETCH(0xE8, 0xCC5D); operand = 0x0000; IMP; INX; 
+L_CC5D: STEP; FETCH(0x86, 0xCC5F); operand = 0x007A; ZP; STX; 
+L_CC5F: STEP; FETCH(0xA9, 0xCC61); operand = 0x0000; IMM; LDA(IMMV); 
+L_CC61: STEP; FETCH(0x85, 0xCC63); operand = 0x0007; ZP; STA; 
+L_CC63: STEP; FETCH(0xF0, 0xCC65); operand = 0x000C; REL; BEQ; if (pc != 0xCC65) goto L_CC71; 
+L_CC65: STEP; FETCH(0x85, 0xCC67); operand = 0x0007; ZP; STA; 
+L_CC67: STEP; FETCH(0xC9, 0xCC69); operand = 0x0022; IMM; CMP(IMMV); 
+L_CC69: STEP; FETCH(0xF0, 0xCC6B); operand = 0x0007; REL; BEQ; if (pc != 0xCC6B) goto L_CC72; 
+L_CC6B: STEP; FETCH(0xA9, 0xCC6D); operand = 0x003A; IMM; LDA(IMMV); 
+L_CC6D: STEP; FETCH(0x85, 0xCC6F); operand = 0x0007; ZP; STA; 
+L_CC6F: STEP; FETCH(0xA9, 0xCC71); operand = 0x002C; IMM; LDA(IMMV); 
+L_CC71: STEP; FETCH(0x18, 0xCC72); operand = 0x0000; IMP; CLC; 
+L_CC72: STEP; FETCH(0x85, 0xCC74); operand = 0x0008; ZP; STA; 
+L_CC74: STEP; FETCH(0xA5, 0xCC76); operand = 0x007A; ZP; LDA(MEM); 
+L_CC76: STEP; FETCH(0xA4, 0xCC78); operand = 0x007B; ZP; LDY(MEM); 
+L_CC78: STEP; FETCH(0x69, 0xCC7A); operand = 0x0000; IMM; ADC(IMMV); 
+L_CC7A: STEP; FETCH(0x90, 0xCC7C); operand = 0x0001; REL; BCC; if (pc != 0xCC7C) goto L_CC7D; 
+L_CC7C: STEP; FETCH(0xC8, 0xCC7D); operand = 0x0000; IMP; INY; 
+L_CC7D: STEP; FETCH(0x20, 0xCC80); operand = 0xD48D; ABSO; JSR; goto L_D48D;
+L_CC80: STEP; FETCH(0x20, 0xCC83); operand = 0xD7E2; ABSO; JSR; goto L_D7E2;
+L_CC83: STEP; FETCH(0x20, 0xCC86); operand = 0xC9DA; ABSO; JSR; goto L_C9DA;
+L_CC86: STEP; FETCH(0x4C, 0xCC89); operand = 0xCC91; ABSO; JMP; goto L_CC91;
+L_CC89: STEP; FETCH(0x20, 0xCC8C); operand = 0xDCF3; ABSO; JSR; goto L_DCF3;
+L_CC8C: STEP; FETCH(0xA5, 0xCC8E); operand = 0x000E; ZP; LDA(MEM); 
+L_CC8E: STEP; FETCH(0x20, 0xCC91); operand = 0xC9C2; ABSO; JSR; goto L_C9C2;
+L_CC91: STEP; FETCH(0x20, 0xCC94); operand = 0x0079; ABSO; JSR; goto out;
+L_CC94: STEP; FETCH(0xF0, 0xCC96); operand = 0x0007; REL; BEQ; if (pc != 0xCC96) goto L_CC9D; 
+L_CC96: STEP; FETCH(0xC9, 0xCC98); operand = 0x002C; IMM; CMP(IMMV); 
+L_CC98: STEP; FETCH(0xF0, 0xCC9A); operand = 0x0003; REL; BEQ; if (pc != 0xCC9A) goto L_CC9D; 
+L_CC9A: STEP; FETCH(0x4C, 0xCC9D); operand = 0xCB4D; ABSO; JMP; goto L_CB4D;
+L_CC9D: STEP; FETCH(0xA5, 0xCC9F); operand = 0x007A; ZP; LDA(MEM); 
+L_CC9F: STEP; FETCH(0xA4, 0xCCA1); operand = 0x007B; ZP; LDY(MEM); 
+L_CCA1: STEP; FETCH(0x85, 0xCCA3); operand = 0x0043; ZP; STA; 
+L_CCA3: STEP; FETCH(0x84, 0xCCA5); operand = 0x0044; ZP; STY; 
+L_CCA5: STEP; FETCH(0xA5, 0xCCA7); operand = 0x004B; ZP; LDA(MEM); 
+L_CCA7: STEP; FETCH(0xA4, 0xCCA9); operand = 0x004C; ZP; LDY(MEM); 
+L_CCA9: STEP; FETCH(0x85, 0xCCAB); operand = 0x007A; ZP; STA; 
+L_CCAB: STEP; FETCH(0x84, 0xCCAD); operand = 0x007B; ZP; STY; 
+L_CCAD: STEP; FETCH(0x20, 0xCCB0); operand = 0x0079; ABSO; JSR; goto out;
+L_CCB0: STEP; FETCH(0xF0, 0xCCB2); operand = 0x002D; REL; BEQ; if (pc != 0xCCB2) goto L_CCDF; 
+L_CCB2: STEP; FETCH(0x20, 0xCCB5); operand = 0xCEFD; ABSO; JSR; goto L_CEFD;
+L_CCB5: STEP; FETCH(0x4C, 0xCCB8); operand = 0xCC15; ABSO; JMP; goto L_CC15;
+L_CCB8: STEP; FETCH(0x20, 0xCCBB); operand = 0xC906; ABSO; JSR; goto L_C906;
+L_CCBB: STEP; FETCH(0xC8, 0xCCBC); operand = 0x0000; IMP; INY; 
+L_CCBC: STEP; FETCH(0xAA, 0xCCBD); operand = 0x0000; IMP; TAX; 
+L_CCBD: STEP; FETCH(0xD0, 0xCCBF); operand = 0x0012; REL; BNE; if (pc != 0xCCBF) goto L_CCD1; 
+L_CCBF: STEP; FETCH(0xA2, 0xCCC1); operand = 0x000D; IMM; LDX(IMMV); 
+L_CCC1: STEP; FETCH(0xC8, 0xCCC2); operand = 0x0000; IMP; INY; 
+L_CCC2: STEP; FETCH(0xB1, 0xCCC4); operand = 0x007A; INDY(1); LDA(MEM); 
+L_CCC4: STEP; FETCH(0xF0, 0xCCC6); operand = 0x006C; REL; BEQ; if (pc != 0xCCC6) goto L_CD32; 
+L_CCC6: STEP; FETCH(0xC8, 0xCCC7); operand = 0x0000; IMP; INY; 
+L_CCC7: STEP; FETCH(0xB1, 0xCCC9); operand = 0x007A; INDY(1); LDA(MEM); 
+L_CCC9: STEP; FETCH(0x85, 0xCCCB); operand = 0x003F; ZP; STA; 
+L_CCCB: STEP; FETCH(0xC8, 0xCCCC); operand = 0x0000; IMP; INY; 
+L_CCCC: STEP; FETCH(0xB1, 0xCCCE); operand = 0x007A; INDY(1); LDA(MEM); 
+L_CCCE: STEP; FETCH(0xC8, 0xCCCF); operand = 0x0000; IMP; INY; 
+L_CCCF: STEP; FETCH(0x85, 0xCCD1); operand = 0x0040; ZP; STA; 
+L_CCD1: STEP; FETCH(0x20, 0xCCD4); operand = 0xC8FB; ABSO; JSR; goto L_C8FB;
+L_CCD4: STEP; FETCH(0x20, 0xCCD7); operand = 0x0079; ABSO; JSR; goto out;
+L_CCD7: STEP; FETCH(0xAA, 0xCCD8); operand = 0x0000; IMP; TAX; 
+L_CCD8: STEP; FETCH(0xE0, 0xCCDA); operand = 0x0083; IMM; CPX(IMMV); 
+L_CCDA: STEP; FETCH(0xD0, 0xCCDC); operand = 0x00DC; REL; BNE; if (pc != 0xCCDC) goto L_CCB8; 
+L_CCDC: STEP; FETCH(0x4C, 0xCCDF); operand = 0xCC51; ABSO; JMP; goto L_CC51;
+L_CCDF: STEP; FETCH(0xA5, 0xCCE1); operand = 0x0043; ZP; LDA(MEM); 
+L_CCE1: STEP; FETCH(0xA4, 0xCCE3); operand = 0x0044; ZP; LDY(MEM); 
+L_CCE3: STEP; FETCH(0xA6, 0xCCE5); operand = 0x0011; ZP; LDX(MEM); 
+L_CCE5: STEP; FETCH(0x10, 0xCCE7); operand = 0x0003; REL; BPL; if (pc != 0xCCE7) goto L_CCEA; 
+L_CCE7: STEP; FETCH(0x4C, 0xCCEA); operand = 0xC827; ABSO; JMP; goto L_C827;
+L_CCEA: STEP; FETCH(0xA0, 0xCCEC); operand = 0x0000; IMM; LDY(IMMV); 
+L_CCEC: STEP; FETCH(0xB1, 0xCCEE); operand = 0x0043; INDY(1); LDA(MEM); 
+L_CCEE: STEP; FETCH(0xF0, 0xCCF0); operand = 0x000B; REL; BEQ; if (pc != 0xCCF0) goto L_CCFB; 
+L_CCF0: STEP; FETCH(0xA5, 0xCCF2); operand = 0x0013; ZP; LDA(MEM); 
+L_CCF2: STEP; FETCH(0xD0, 0xCCF4); operand = 0x0007; REL; BNE; if (pc != 0xCCF4) goto L_CCFB; 
+L_CCF4: STEP; FETCH(0xA9, 0xCCF6); operand = 0x00FC; IMM; LDA(IMMV); 
+L_CCF6: STEP; FETCH(0xA0, 0xCCF8); operand = 0x00CC; IMM; LDY(IMMV); 
+L_CCF8: STEP; FETCH(0x4C, 0xCCFB); operand = 0xCB1E; ABSO; JMP; goto L_CB1E;
+L_CCFB: STEP; FETCH(0x60, 0xCCFC); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CD1E: STEP; FETCH(0xD0, 0xCD20); operand = 0x0004; REL; BNE; if (pc != 0xCD20) goto L_CD24; 
+L_CD20: STEP; FETCH(0xA0, 0xCD22); operand = 0x0000; IMM; LDY(IMMV); 
+L_CD22: STEP; FETCH(0xF0, 0xCD24); operand = 0x0003; REL; BEQ; if (pc != 0xCD24) goto L_CD27; 
+L_CD24: STEP; FETCH(0x20, 0xCD27); operand = 0xD08B; ABSO; JSR; goto L_D08B;
+L_CD27: STEP; FETCH(0x85, 0xCD29); operand = 0x0049; ZP; STA; 
+L_CD29: STEP; FETCH(0x84, 0xCD2B); operand = 0x004A; ZP; STY; 
+L_CD2B: STEP; FETCH(0x20, 0xCD2E); operand = 0xC38A; ABSO; JSR; goto L_C38A;
+L_CD2E: STEP; FETCH(0xF0, 0xCD30); operand = 0x0005; REL; BEQ; if (pc != 0xCD30) goto L_CD35; 
+L_CD30: STEP; FETCH(0xA2, 0xCD32); operand = 0x000A; IMM; LDX(IMMV); 
+L_CD32: STEP; FETCH(0x4C, 0xCD35); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_CD35: STEP; FETCH(0x9A, 0xCD36); operand = 0x0000; IMP; TXS; 
+L_CD36: STEP; FETCH(0x8A, 0xCD37); operand = 0x0000; IMP; TXA; 
+L_CD37: STEP; FETCH(0x18, 0xCD38); operand = 0x0000; IMP; CLC; 
+L_CD38: STEP; FETCH(0x69, 0xCD3A); operand = 0x0004; IMM; ADC(IMMV); 
+L_CD3A: STEP; FETCH(0x48, 0xCD3B); operand = 0x0000; IMP; PHA; 
+L_CD3B: STEP; FETCH(0x69, 0xCD3D); operand = 0x0006; IMM; ADC(IMMV); 
+L_CD3D: STEP; FETCH(0x85, 0xCD3F); operand = 0x0024; ZP; STA; 
+L_CD3F: STEP; FETCH(0x68, 0xCD40); operand = 0x0000; IMP; PLA; 
+L_CD40: STEP; FETCH(0xA0, 0xCD42); operand = 0x0001; IMM; LDY(IMMV); 
+L_CD42: STEP; FETCH(0x20, 0xCD45); operand = 0xDBA2; ABSO; JSR; goto L_DBA2;
+L_CD45: STEP; FETCH(0xBA, 0xCD46); operand = 0x0000; IMP; TSX; 
+L_CD46: STEP; FETCH(0xBD, 0xCD49); operand = 0x0109; ABSX(1); LDA(MEM); 
+L_CD49: STEP; FETCH(0x85, 0xCD4B); operand = 0x0066; ZP; STA; 
+L_CD4B: STEP; FETCH(0xA5, 0xCD4D); operand = 0x0049; ZP; LDA(MEM); 
+L_CD4D: STEP; FETCH(0xA4, 0xCD4F); operand = 0x004A; ZP; LDY(MEM); 
+L_CD4F: STEP; FETCH(0x20, 0xCD52); operand = 0xD867; ABSO; JSR; goto L_D867;
+L_CD52: STEP; FETCH(0x20, 0xCD55); operand = 0xDBD0; ABSO; JSR; goto L_DBD0;
+L_CD55: STEP; FETCH(0xA0, 0xCD57); operand = 0x0001; IMM; LDY(IMMV); 
+L_CD57: STEP; FETCH(0x20, 0xCD5A); operand = 0xDC5D; ABSO; JSR; goto L_DC5D;
+L_CD5A: STEP; FETCH(0xBA, 0xCD5B); operand = 0x0000; IMP; TSX; 
+L_CD5B: STEP; FETCH(0x38, 0xCD5C); operand = 0x0000; IMP; SEC; 
+L_CD5C: STEP; FETCH(0xFD, 0xCD5F); operand = 0x0109; ABSX(1); SBC(MEM); 
+L_CD5F: STEP; FETCH(0xF0, 0xCD61); operand = 0x0017; REL; BEQ; if (pc != 0xCD61) goto L_CD78; 
+L_CD61: STEP; FETCH(0xBD, 0xCD64); operand = 0x010F; ABSX(1); LDA(MEM); 
+L_CD64: STEP; FETCH(0x85, 0xCD66); operand = 0x0039; ZP; STA; 
+L_CD66: STEP; FETCH(0xBD, 0xCD69); operand = 0x0110; ABSX(1); LDA(MEM); 
+L_CD69: STEP; FETCH(0x85, 0xCD6B); operand = 0x003A; ZP; STA; 
+L_CD6B: STEP; FETCH(0xBD, 0xCD6E); operand = 0x0112; ABSX(1); LDA(MEM); 
+L_CD6E: STEP; FETCH(0x85, 0xCD70); operand = 0x007A; ZP; STA; 
+L_CD70: STEP; FETCH(0xBD, 0xCD73); operand = 0x0111; ABSX(1); LDA(MEM); 
+L_CD73: STEP; FETCH(0x85, 0xCD75); operand = 0x007B; ZP; STA; 
+L_CD75: STEP; FETCH(0x4C, 0xCD78); operand = 0xC7AE; ABSO; JMP; goto L_C7AE;
+L_CD78: STEP; FETCH(0x8A, 0xCD79); operand = 0x0000; IMP; TXA; 
+L_CD79: STEP; FETCH(0x69, 0xCD7B); operand = 0x0011; IMM; ADC(IMMV); 
+L_CD7B: STEP; FETCH(0xAA, 0xCD7C); operand = 0x0000; IMP; TAX; 
+L_CD7C: STEP; FETCH(0x9A, 0xCD7D); operand = 0x0000; IMP; TXS; 
+L_CD7D: STEP; FETCH(0x20, 0xCD80); operand = 0x0079; ABSO; JSR; goto out;
+L_CD80: STEP; FETCH(0xC9, 0xCD82); operand = 0x002C; IMM; CMP(IMMV); 
+L_CD82: STEP; FETCH(0xD0, 0xCD84); operand = 0x00F1; REL; BNE; if (pc != 0xCD84) goto L_CD75; 
+L_CD84: STEP; FETCH(0x20, 0xCD87); operand = 0x0073; ABSO; JSR; goto out;
+L_CD87: STEP; FETCH(0x20, 0xCD8A); operand = 0xCD24; ABSO; JSR; goto L_CD24;
+L_CD8A: STEP; FETCH(0x20, 0xCD8D); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_CD8D: STEP; FETCH(0x18, 0xCD8E); operand = 0x0000; IMP; CLC; 
+L_CD8E: STEP; FETCH(0x24, 0xCD90); operand = 0x0038; ZP; BIT(MEM); goto L_CD90;
+L_CD8F: STEP; FETCH(0x38, 0xCD90); operand = 0x0000; IMP; SEC; 
+L_CD90: STEP; FETCH(0x24, 0xCD92); operand = 0x000D; ZP; BIT(MEM); 
+L_CD92: STEP; FETCH(0x30, 0xCD94); operand = 0x0003; REL; BMI; if (pc != 0xCD94) goto L_CD97; 
+L_CD94: STEP; FETCH(0xB0, 0xCD96); operand = 0x0003; REL; BCS; if (pc != 0xCD96) goto L_CD99; 
+L_CD96: STEP; FETCH(0x60, 0xCD97); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CD97: STEP; FETCH(0xB0, 0xCD99); operand = 0x00FD; REL; BCS; if (pc != 0xCD99) goto L_CD96; 
+L_CD99: STEP; FETCH(0xA2, 0xCD9B); operand = 0x0016; IMM; LDX(IMMV); 
+L_CD9B: STEP; FETCH(0x4C, 0xCD9E); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_CD9E: STEP; FETCH(0xA6, 0xCDA0); operand = 0x007A; ZP; LDX(MEM); 
+L_CDA0: STEP; FETCH(0xD0, 0xCDA2); operand = 0x0002; REL; BNE; if (pc != 0xCDA2) goto L_CDA4; 
+L_CDA2: STEP; FETCH(0xC6, 0xCDA4); operand = 0x007B; ZP; DEC; 
+L_CDA4: STEP; FETCH(0xC6, 0xCDA6); operand = 0x007A; ZP; DEC; 
+L_CDA6: STEP; FETCH(0xA2, 0xCDA8); operand = 0x0000; IMM; LDX(IMMV); 
+L_CDA8: STEP; FETCH(0x24, 0xCDAA); operand = 0x0048; ZP; BIT(MEM); goto L_CDAA;
+L_CDA9: STEP; FETCH(0x48, 0xCDAA); operand = 0x0000; IMP; PHA; 
+L_CDAA: STEP; FETCH(0x8A, 0xCDAB); operand = 0x0000; IMP; TXA; 
+L_CDAB: STEP; FETCH(0x48, 0xCDAC); operand = 0x0000; IMP; PHA; 
+L_CDAC: STEP; FETCH(0xA9, 0xCDAE); operand = 0x0001; IMM; LDA(IMMV); 
+L_CDAE: STEP; FETCH(0x20, 0xCDB1); operand = 0xC3FB; ABSO; JSR; goto L_C3FB;
+L_CDB1: STEP; FETCH(0x20, 0xCDB4); operand = 0xCE83; ABSO; JSR; goto L_CE83;
+L_CDB4: STEP; FETCH(0xA9, 0xCDB6); operand = 0x0000; IMM; LDA(IMMV); 
+L_CDB6: STEP; FETCH(0x85, 0xCDB8); operand = 0x004D; ZP; STA; 
+L_CDB8: STEP; FETCH(0x20, 0xCDBB); operand = 0x0079; ABSO; JSR; goto out;
+L_CDBB: STEP; FETCH(0x38, 0xCDBC); operand = 0x0000; IMP; SEC; 
+L_CDBC: STEP; FETCH(0xE9, 0xCDBE); operand = 0x00B1; IMM; SBC(IMMV); 
+L_CDBE: STEP; FETCH(0x90, 0xCDC0); operand = 0x0017; REL; BCC; if (pc != 0xCDC0) goto L_CDD7; 
+L_CDC0: STEP; FETCH(0xC9, 0xCDC2); operand = 0x0003; IMM; CMP(IMMV); 
+L_CDC2: STEP; FETCH(0xB0, 0xCDC4); operand = 0x0013; REL; BCS; if (pc != 0xCDC4) goto L_CDD7; 
+L_CDC4: STEP; FETCH(0xC9, 0xCDC6); operand = 0x0001; IMM; CMP(IMMV); 
+L_CDC6: STEP; FETCH(0x2A, 0xCDC7); operand = 0x0000; ACC; ROL_A; 
+L_CDC7: STEP; FETCH(0x49, 0xCDC9); operand = 0x0001; IMM; EOR(IMMV); 
+L_CDC9: STEP; FETCH(0x45, 0xCDCB); operand = 0x004D; ZP; EOR(MEM); 
+L_CDCB: STEP; FETCH(0xC5, 0xCDCD); operand = 0x004D; ZP; CMP(MEM); 
+L_CDCD: STEP; FETCH(0x90, 0xCDCF); operand = 0x0061; REL; BCC; if (pc != 0xCDCF) goto L_CE30; 
+L_CDCF: STEP; FETCH(0x85, 0xCDD1); operand = 0x004D; ZP; STA; 
+L_CDD1: STEP; FETCH(0x20, 0xCDD4); operand = 0x0073; ABSO; JSR; goto out;
+L_CDD4: STEP; FETCH(0x4C, 0xCDD7); operand = 0xCDBB; ABSO; JMP; goto L_CDBB;
+L_CDD7: STEP; FETCH(0xA6, 0xCDD9); operand = 0x004D; ZP; LDX(MEM); 
+L_CDD9: STEP; FETCH(0xD0, 0xCDDB); operand = 0x002C; REL; BNE; if (pc != 0xCDDB) goto L_CE07; 
+L_CDDB: STEP; FETCH(0xB0, 0xCDDD); operand = 0x007B; REL; BCS; if (pc != 0xCDDD) goto L_CE58; 
+L_CDDD: STEP; FETCH(0x69, 0xCDDF); operand = 0x0007; IMM; ADC(IMMV); 
+L_CDDF: STEP; FETCH(0x90, 0xCDE1); operand = 0x0077; REL; BCC; if (pc != 0xCDE1) goto L_CE58; 
+L_CDE1: STEP; FETCH(0x65, 0xCDE3); operand = 0x000D; ZP; ADC(MEM); 
+L_CDE3: STEP; FETCH(0xD0, 0xCDE5); operand = 0x0003; REL; BNE; if (pc != 0xCDE5) goto L_CDE8; 
+L_CDE5: STEP; FETCH(0x4C, 0xCDE8); operand = 0xD63D; ABSO; JMP; goto L_D63D;
+L_CDE8: STEP; FETCH(0x69, 0xCDEA); operand = 0x00FF; IMM; ADC(IMMV); 
+L_CDEA: STEP; FETCH(0x85, 0xCDEC); operand = 0x0022; ZP; STA; 
+L_CDEC: STEP; FETCH(0x0A, 0xCDED); operand = 0x0000; ACC; ASL_A; 
+L_CDED: STEP; FETCH(0x65, 0xCDEF); operand = 0x0022; ZP; ADC(MEM); 
+L_CDEF: STEP; FETCH(0xA8, 0xCDF0); operand = 0x0000; IMP; TAY; 
+L_CDF0: STEP; FETCH(0x68, 0xCDF1); operand = 0x0000; IMP; PLA; 
+L_CDF1: STEP; FETCH(0xD9, 0xCDF4); operand = 0xC080; ABSY(1); CMP(MEM); 
+L_CDF4: STEP; FETCH(0xB0, 0xCDF6); operand = 0x0067; REL; BCS; if (pc != 0xCDF6) goto L_CE5D; 
+L_CDF6: STEP; FETCH(0x20, 0xCDF9); operand = 0xCD8D; ABSO; JSR; goto L_CD8D;
+L_CDF9: STEP; FETCH(0x48, 0xCDFA); operand = 0x0000; IMP; PHA; 
+L_CDFA: STEP; FETCH(0x20, 0xCDFD); operand = 0xCE20; ABSO; JSR; goto L_CE20;
+L_CDFD: STEP; FETCH(0x68, 0xCDFE); operand = 0x0000; IMP; PLA; 
+L_CDFE: STEP; FETCH(0xA4, 0xCE00); operand = 0x004B; ZP; LDY(MEM); 
+L_CE00: STEP; FETCH(0x10, 0xCE02); operand = 0x0017; REL; BPL; if (pc != 0xCE02) goto L_CE19; 
+L_CE02: STEP; FETCH(0xAA, 0xCE03); operand = 0x0000; IMP; TAX; 
+L_CE03: STEP; FETCH(0xF0, 0xCE05); operand = 0x0056; REL; BEQ; if (pc != 0xCE05) goto L_CE5B; 
+L_CE05: STEP; FETCH(0xD0, 0xCE07); operand = 0x005F; REL; BNE; if (pc != 0xCE07) goto L_CE66; 
+L_CE07: STEP; FETCH(0x46, 0xCE09); operand = 0x000D; ZP; LSR; 
+L_CE09: STEP; FETCH(0x8A, 0xCE0A); operand = 0x0000; IMP; TXA; 
+L_CE0A: STEP; FETCH(0x2A, 0xCE0B); operand = 0x0000; ACC; ROL_A; 
+L_CE0B: STEP; FETCH(0xA6, 0xCE0D); operand = 0x007A; ZP; LDX(MEM); 
+L_CE0D: STEP; FETCH(0xD0, 0xCE0F); operand = 0x0002; REL; BNE; if (pc != 0xCE0F) goto L_CE11; 
+L_CE0F: STEP; FETCH(0xC6, 0xCE11); operand = 0x007B; ZP; DEC; 
+L_CE11: STEP; FETCH(0xC6, 0xCE13); operand = 0x007A; ZP; DEC; 
+L_CE13: STEP; FETCH(0xA0, 0xCE15); operand = 0x001B; IMM; LDY(IMMV); 
+L_CE15: STEP; FETCH(0x85, 0xCE17); operand = 0x004D; ZP; STA; 
+L_CE17: STEP; FETCH(0xD0, 0xCE19); operand = 0x00D7; REL; BNE; if (pc != 0xCE19) goto L_CDF0; 
+L_CE19: STEP; FETCH(0xD9, 0xCE1C); operand = 0xC080; ABSY(1); CMP(MEM); 
+L_CE1C: STEP; FETCH(0xB0, 0xCE1E); operand = 0x0048; REL; BCS; if (pc != 0xCE1E) goto L_CE66; 
+L_CE1E: STEP; FETCH(0x90, 0xCE20); operand = 0x00D9; REL; BCC; if (pc != 0xCE20) goto L_CDF9; 
+L_CE20: STEP; FETCH(0xB9, 0xCE23); operand = 0xC082; ABSY(1); LDA(MEM); 
+L_CE23: STEP; FETCH(0x48, 0xCE24); operand = 0x0000; IMP; PHA; 
+L_CE24: STEP; FETCH(0xB9, 0xCE27); operand = 0xC081; ABSY(1); LDA(MEM); 
+L_CE27: STEP; FETCH(0x48, 0xCE28); operand = 0x0000; IMP; PHA; 
+L_CE28: STEP; FETCH(0x20, 0xCE2B); operand = 0xCE33; ABSO; JSR; goto L_CE33;
+L_CE2B: STEP; FETCH(0xA5, 0xCE2D); operand = 0x004D; ZP; LDA(MEM); 
+L_CE2D: STEP; FETCH(0x4C, 0xCE30); operand = 0xCDA9; ABSO; JMP; goto L_CDA9;
+L_CE30: STEP; FETCH(0x4C, 0xCE33); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_CE33: STEP; FETCH(0xA5, 0xCE35); operand = 0x0066; ZP; LDA(MEM); 
+L_CE35: STEP; FETCH(0xBE, 0xCE38); operand = 0xC080; ABSY(1); LDX(MEM); 
+L_CE38: STEP; FETCH(0xA8, 0xCE39); operand = 0x0000; IMP; TAY; 
+L_CE39: STEP; FETCH(0x68, 0xCE3A); operand = 0x0000; IMP; PLA; 
+L_CE3A: STEP; FETCH(0x85, 0xCE3C); operand = 0x0022; ZP; STA; 
+L_CE3C: STEP; FETCH(0xE6, 0xCE3E); operand = 0x0022; ZP; INC; 
+L_CE3E: STEP; FETCH(0x68, 0xCE3F); operand = 0x0000; IMP; PLA; 
+L_CE3F: STEP; FETCH(0x85, 0xCE41); operand = 0x0023; ZP; STA; 
+L_CE41: STEP; FETCH(0x98, 0xCE42); operand = 0x0000; IMP; TYA; 
+L_CE42: STEP; FETCH(0x48, 0xCE43); operand = 0x0000; IMP; PHA; 
+L_CE43: STEP; FETCH(0x20, 0xCE46); operand = 0xDC1B; ABSO; JSR; goto L_DC1B;
+L_CE46: STEP; FETCH(0xA5, 0xCE48); operand = 0x0065; ZP; LDA(MEM); 
+L_CE48: STEP; FETCH(0x48, 0xCE49); operand = 0x0000; IMP; PHA; 
+L_CE49: STEP; FETCH(0xA5, 0xCE4B); operand = 0x0064; ZP; LDA(MEM); 
+L_CE4B: STEP; FETCH(0x48, 0xCE4C); operand = 0x0000; IMP; PHA; 
+L_CE4C: STEP; FETCH(0xA5, 0xCE4E); operand = 0x0063; ZP; LDA(MEM); 
+L_CE4E: STEP; FETCH(0x48, 0xCE4F); operand = 0x0000; IMP; PHA; 
+L_CE4F: STEP; FETCH(0xA5, 0xCE51); operand = 0x0062; ZP; LDA(MEM); 
+L_CE51: STEP; FETCH(0x48, 0xCE52); operand = 0x0000; IMP; PHA; 
+L_CE52: STEP; FETCH(0xA5, 0xCE54); operand = 0x0061; ZP; LDA(MEM); 
+L_CE54: STEP; FETCH(0x48, 0xCE55); operand = 0x0000; IMP; PHA; 
+L_CE55: STEP; FETCH(0x6C, 0xCE58); operand = 0x0022; IND; JMP; goto dispatch;
+L_CE58: STEP; FETCH(0xA0, 0xCE5A); operand = 0x00FF; IMM; LDY(IMMV); 
+L_CE5A: STEP; FETCH(0x68, 0xCE5B); operand = 0x0000; IMP; PLA; 
+L_CE5B: STEP; FETCH(0xF0, 0xCE5D); operand = 0x0023; REL; BEQ; if (pc != 0xCE5D) goto L_CE80; 
+L_CE5D: STEP; FETCH(0xC9, 0xCE5F); operand = 0x0064; IMM; CMP(IMMV); 
+L_CE5F: STEP; FETCH(0xF0, 0xCE61); operand = 0x0003; REL; BEQ; if (pc != 0xCE61) goto L_CE64; 
+L_CE61: STEP; FETCH(0x20, 0xCE64); operand = 0xCD8D; ABSO; JSR; goto L_CD8D;
+L_CE64: STEP; FETCH(0x84, 0xCE66); operand = 0x004B; ZP; STY; 
+L_CE66: STEP; FETCH(0x68, 0xCE67); operand = 0x0000; IMP; PLA; 
+L_CE67: STEP; FETCH(0x4A, 0xCE68); operand = 0x0000; ACC; LSR_A; 
+L_CE68: STEP; FETCH(0x85, 0xCE6A); operand = 0x0012; ZP; STA; 
+L_CE6A: STEP; FETCH(0x68, 0xCE6B); operand = 0x0000; IMP; PLA; 
+L_CE6B: STEP; FETCH(0x85, 0xCE6D); operand = 0x0069; ZP; STA; 
+L_CE6D: STEP; FETCH(0x68, 0xCE6E); operand = 0x0000; IMP; PLA; 
+L_CE6E: STEP; FETCH(0x85, 0xCE70); operand = 0x006A; ZP; STA; 
+L_CE70: STEP; FETCH(0x68, 0xCE71); operand = 0x0000; IMP; PLA; 
+L_CE71: STEP; FETCH(0x85, 0xCE73); operand = 0x006B; ZP; STA; 
+L_CE73: STEP; FETCH(0x68, 0xCE74); operand = 0x0000; IMP; PLA; 
+L_CE74: STEP; FETCH(0x85, 0xCE76); operand = 0x006C; ZP; STA; 
+L_CE76: STEP; FETCH(0x68, 0xCE77); operand = 0x0000; IMP; PLA; 
+L_CE77: STEP; FETCH(0x85, 0xCE79); operand = 0x006D; ZP; STA; 
+L_CE79: STEP; FETCH(0x68, 0xCE7A); operand = 0x0000; IMP; PLA; 
+L_CE7A: STEP; FETCH(0x85, 0xCE7C); operand = 0x006E; ZP; STA; 
+L_CE7C: STEP; FETCH(0x45, 0xCE7E); operand = 0x0066; ZP; EOR(MEM); 
+L_CE7E: STEP; FETCH(0x85, 0xCE80); operand = 0x006F; ZP; STA; 
+L_CE80: STEP; FETCH(0xA5, 0xCE82); operand = 0x0061; ZP; LDA(MEM); 
+L_CE82: STEP; FETCH(0x60, 0xCE83); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CE83: STEP; FETCH(0x6C, 0xCE86); operand = 0x030A; IND; JMP; goto dispatch;
+L_CE86: STEP; FETCH(0xA9, 0xCE88); operand = 0x0000; IMM; LDA(IMMV); 
+L_CE88: STEP; FETCH(0x85, 0xCE8A); operand = 0x000D; ZP; STA; 
+L_CE8A: STEP; FETCH(0x20, 0xCE8D); operand = 0x0073; ABSO; JSR; goto out;
+L_CE8D: STEP; FETCH(0xB0, 0xCE8F); operand = 0x0003; REL; BCS; if (pc != 0xCE8F) goto L_CE92; 
+L_CE8F: STEP; FETCH(0x4C, 0xCE92); operand = 0xDCF3; ABSO; JMP; goto L_DCF3;
+L_CE92: STEP; FETCH(0x20, 0xCE95); operand = 0xD113; ABSO; JSR; goto L_D113;
+L_CE95: STEP; FETCH(0x90, 0xCE97); operand = 0x0003; REL; BCC; if (pc != 0xCE97) goto L_CE9A; 
+L_CE97: STEP; FETCH(0x4C, 0xCE9A); operand = 0xCF28; ABSO; JMP; goto L_CF28;
+L_CE9A: STEP; FETCH(0xC9, 0xCE9C); operand = 0x00FF; IMM; CMP(IMMV); 
+L_CE9C: STEP; FETCH(0xD0, 0xCE9E); operand = 0x000F; REL; BNE; if (pc != 0xCE9E) goto L_CEAD; 
+L_CE9E: STEP; FETCH(0xA9, 0xCEA0); operand = 0x00A8; IMM; LDA(IMMV); 
+L_CEA0: STEP; FETCH(0xA0, 0xCEA2); operand = 0x00CE; IMM; LDY(IMMV); 
+L_CEA2: STEP; FETCH(0x20, 0xCEA5); operand = 0xDBA2; ABSO; JSR; goto L_DBA2;
+L_CEA5: STEP; FETCH(0x4C, 0xCEA8); operand = 0x0073; ABSO; JMP; goto out;
+L_CEAD: STEP; FETCH(0xC9, 0xCEAF); operand = 0x002E; IMM; CMP(IMMV); 
+L_CEAF: STEP; FETCH(0xF0, 0xCEB1); operand = 0x00DE; REL; BEQ; if (pc != 0xCEB1) goto L_CE8F; 
+L_CEB1: STEP; FETCH(0xC9, 0xCEB3); operand = 0x00AB; IMM; CMP(IMMV); 
+L_CEB3: STEP; FETCH(0xF0, 0xCEB5); operand = 0x0058; REL; BEQ; if (pc != 0xCEB5) goto L_CF0D; 
+L_CEB5: STEP; FETCH(0xC9, 0xCEB7); operand = 0x00AA; IMM; CMP(IMMV); 
+L_CEB7: STEP; FETCH(0xF0, 0xCEB9); operand = 0x00D1; REL; BEQ; if (pc != 0xCEB9) goto L_CE8A; 
+L_CEB9: STEP; FETCH(0xC9, 0xCEBB); operand = 0x0022; IMM; CMP(IMMV); 
+L_CEBB: STEP; FETCH(0xD0, 0xCEBD); operand = 0x000F; REL; BNE; if (pc != 0xCEBD) goto L_CECC; 
+L_CEBD: STEP; FETCH(0xA5, 0xCEBF); operand = 0x007A; ZP; LDA(MEM); 
+L_CEBF: STEP; FETCH(0xA4, 0xCEC1); operand = 0x007B; ZP; LDY(MEM); 
+L_CEC1: STEP; FETCH(0x69, 0xCEC3); operand = 0x0000; IMM; ADC(IMMV); 
+L_CEC3: STEP; FETCH(0x90, 0xCEC5); operand = 0x0001; REL; BCC; if (pc != 0xCEC5) goto L_CEC6; 
+L_CEC5: STEP; FETCH(0xC8, 0xCEC6); operand = 0x0000; IMP; INY; 
+L_CEC6: STEP; FETCH(0x20, 0xCEC9); operand = 0xD487; ABSO; JSR; goto L_D487;
+L_CEC9: STEP; FETCH(0x4C, 0xCECC); operand = 0xD7E2; ABSO; JMP; goto L_D7E2;
+L_CECC: STEP; FETCH(0xC9, 0xCECE); operand = 0x00A8; IMM; CMP(IMMV); 
+L_CECE: STEP; FETCH(0xD0, 0xCED0); operand = 0x0013; REL; BNE; if (pc != 0xCED0) goto L_CEE3; 
+L_CED0: STEP; FETCH(0xA0, 0xCED2); operand = 0x0018; IMM; LDY(IMMV); 
+L_CED2: STEP; FETCH(0xD0, 0xCED4); operand = 0x003B; REL; BNE; if (pc != 0xCED4) goto L_CF0F; 
+L_CED4: STEP; FETCH(0x20, 0xCED7); operand = 0xD1BF; ABSO; JSR; goto L_D1BF;
+L_CED7: STEP; FETCH(0xA5, 0xCED9); operand = 0x0065; ZP; LDA(MEM); 
+L_CED9: STEP; FETCH(0x49, 0xCEDB); operand = 0x00FF; IMM; EOR(IMMV); 
+L_CEDB: STEP; FETCH(0xA8, 0xCEDC); operand = 0x0000; IMP; TAY; 
+L_CEDC: STEP; FETCH(0xA5, 0xCEDE); operand = 0x0064; ZP; LDA(MEM); 
+L_CEDE: STEP; FETCH(0x49, 0xCEE0); operand = 0x00FF; IMM; EOR(IMMV); 
+L_CEE0: STEP; FETCH(0x4C, 0xCEE3); operand = 0xD391; ABSO; JMP; goto L_D391;
+L_CEE3: STEP; FETCH(0xC9, 0xCEE5); operand = 0x00A5; IMM; CMP(IMMV); 
+L_CEE5: STEP; FETCH(0xD0, 0xCEE7); operand = 0x0003; REL; BNE; if (pc != 0xCEE7) goto L_CEEA; 
+L_CEE7: STEP; FETCH(0x4C, 0xCEEA); operand = 0xD3F4; ABSO; JMP; goto L_D3F4;
+L_CEEA: STEP; FETCH(0xC9, 0xCEEC); operand = 0x00B4; IMM; CMP(IMMV); 
+L_CEEC: STEP; FETCH(0x90, 0xCEEE); operand = 0x0003; REL; BCC; if (pc != 0xCEEE) goto L_CEF1; 
+L_CEEE: STEP; FETCH(0x4C, 0xCEF1); operand = 0xCFA7; ABSO; JMP; goto L_CFA7;
+L_CEF1: STEP; FETCH(0x20, 0xCEF4); operand = 0xCEFA; ABSO; JSR; goto L_CEFA;
+L_CEF4: STEP; FETCH(0x20, 0xCEF7); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_CEF7: STEP; FETCH(0xA9, 0xCEF9); operand = 0x0029; IMM; LDA(IMMV); 
+L_CEF9: STEP; FETCH(0x2C, 0xCEFC); operand = 0x28A9; ABSO; BIT(MEM); goto L_CEFC;
+L_CEFA: STEP; FETCH(0xA9, 0xCEFC); operand = 0x0028; IMM; LDA(IMMV); 
+L_CEFC: STEP; FETCH(0x2C, 0xCEFF); operand = 0x2CA9; ABSO; BIT(MEM); goto L_CEFF;
+L_CEFD: STEP; FETCH(0xA9, 0xCEFF); operand = 0x002C; IMM; LDA(IMMV); 
+L_CEFF: STEP; FETCH(0xA0, 0xCF01); operand = 0x0000; IMM; LDY(IMMV); 
+L_CF01: STEP; FETCH(0xD1, 0xCF03); operand = 0x007A; INDY(1); CMP(MEM); 
+L_CF03: STEP; FETCH(0xD0, 0xCF05); operand = 0x0003; REL; BNE; if (pc != 0xCF05) goto L_CF08; 
+L_CF05: STEP; FETCH(0x4C, 0xCF08); operand = 0x0073; ABSO; JMP; goto out;
+L_CF08: STEP; FETCH(0xA2, 0xCF0A); operand = 0x000B; IMM; LDX(IMMV); 
+L_CF0A: STEP; FETCH(0x4C, 0xCF0D); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_CF0D: STEP; FETCH(0xA0, 0xCF0F); operand = 0x0015; IMM; LDY(IMMV); 
+L_CF0F: STEP; FETCH(0x68, 0xCF10); operand = 0x0000; IMP; PLA; 
+L_CF10: STEP; FETCH(0x68, 0xCF11); operand = 0x0000; IMP; PLA; 
+L_CF11: STEP; FETCH(0x4C, 0xCF14); operand = 0xCDFA; ABSO; JMP; goto L_CDFA;
+L_CF14: STEP; FETCH(0x38, 0xCF15); operand = 0x0000; IMP; SEC; 
+L_CF15: STEP; FETCH(0xA5, 0xCF17); operand = 0x0064; ZP; LDA(MEM); 
+L_CF17: STEP; FETCH(0xE9, 0xCF19); operand = 0x0000; IMM; SBC(IMMV); 
+L_CF19: STEP; FETCH(0xA5, 0xCF1B); operand = 0x0065; ZP; LDA(MEM); 
+L_CF1B: STEP; FETCH(0xE9, 0xCF1D); operand = 0x00C0; IMM; SBC(IMMV); 
+L_CF1D: STEP; FETCH(0x90, 0xCF1F); operand = 0x0008; REL; BCC; if (pc != 0xCF1F) goto L_CF27; 
+L_CF1F: STEP; FETCH(0xA9, 0xCF21); operand = 0x0087; IMM; LDA(IMMV); 
+L_CF21: STEP; FETCH(0xE5, 0xCF23); operand = 0x0064; ZP; SBC(MEM); 
+L_CF23: STEP; FETCH(0xA9, 0xCF25); operand = 0x00E3; IMM; LDA(IMMV); 
+L_CF25: STEP; FETCH(0xE5, 0xCF27); operand = 0x0065; ZP; SBC(MEM); 
+L_CF27: STEP; FETCH(0x60, 0xCF28); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CF28: STEP; FETCH(0x20, 0xCF2B); operand = 0xD08B; ABSO; JSR; goto L_D08B;
+L_CF2B: STEP; FETCH(0x85, 0xCF2D); operand = 0x0064; ZP; STA; 
+L_CF2D: STEP; FETCH(0x84, 0xCF2F); operand = 0x0065; ZP; STY; 
+L_CF2F: STEP; FETCH(0xA6, 0xCF31); operand = 0x0045; ZP; LDX(MEM); 
+L_CF31: STEP; FETCH(0xA4, 0xCF33); operand = 0x0046; ZP; LDY(MEM); 
+L_CF33: STEP; FETCH(0xA5, 0xCF35); operand = 0x000D; ZP; LDA(MEM); 
+L_CF35: STEP; FETCH(0xF0, 0xCF37); operand = 0x0026; REL; BEQ; if (pc != 0xCF37) goto L_CF5D; 
+L_CF37: STEP; FETCH(0xA9, 0xCF39); operand = 0x0000; IMM; LDA(IMMV); 
+L_CF39: STEP; FETCH(0x85, 0xCF3B); operand = 0x0070; ZP; STA; 
+L_CF3B: STEP; FETCH(0x20, 0xCF3E); operand = 0xCF14; ABSO; JSR; goto L_CF14;
+L_CF3E: STEP; FETCH(0x90, 0xCF40); operand = 0x001C; REL; BCC; if (pc != 0xCF40) goto L_CF5C; 
+L_CF40: STEP; FETCH(0xE0, 0xCF42); operand = 0x0054; IMM; CPX(IMMV); 
+L_CF42: STEP; FETCH(0xD0, 0xCF44); operand = 0x0018; REL; BNE; if (pc != 0xCF44) goto L_CF5C; 
+L_CF44: STEP; FETCH(0xC0, 0xCF46); operand = 0x00C9; IMM; CPY(IMMV); 
+L_CF46: STEP; FETCH(0xD0, 0xCF48); operand = 0x0014; REL; BNE; if (pc != 0xCF48) goto L_CF5C; 
+L_CF48: STEP; FETCH(0x20, 0xCF4B); operand = 0xCF84; ABSO; JSR; goto L_CF84;
+L_CF4B: STEP; FETCH(0x84, 0xCF4D); operand = 0x005E; ZP; STY; 
+L_CF4D: STEP; FETCH(0x88, 0xCF4E); operand = 0x0000; IMP; DEY; 
+L_CF4E: STEP; FETCH(0x84, 0xCF50); operand = 0x0071; ZP; STY; 
+L_CF50: STEP; FETCH(0xA0, 0xCF52); operand = 0x0006; IMM; LDY(IMMV); 
+L_CF52: STEP; FETCH(0x84, 0xCF54); operand = 0x005D; ZP; STY; 
+L_CF54: STEP; FETCH(0xA0, 0xCF56); operand = 0x0024; IMM; LDY(IMMV); 
+L_CF56: STEP; FETCH(0x20, 0xCF59); operand = 0xDE68; ABSO; JSR; goto L_DE68;
+L_CF59: STEP; FETCH(0x4C, 0xCF5C); operand = 0xD46F; ABSO; JMP; goto L_D46F;
+L_CF5C: STEP; FETCH(0x60, 0xCF5D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CF5D: STEP; FETCH(0x24, 0xCF5F); operand = 0x000E; ZP; BIT(MEM); 
+L_CF5F: STEP; FETCH(0x10, 0xCF61); operand = 0x000D; REL; BPL; if (pc != 0xCF61) goto L_CF6E; 
+L_CF61: STEP; FETCH(0xA0, 0xCF63); operand = 0x0000; IMM; LDY(IMMV); 
+L_CF63: STEP; FETCH(0xB1, 0xCF65); operand = 0x0064; INDY(1); LDA(MEM); 
+L_CF65: STEP; FETCH(0xAA, 0xCF66); operand = 0x0000; IMP; TAX; 
+L_CF66: STEP; FETCH(0xC8, 0xCF67); operand = 0x0000; IMP; INY; 
+L_CF67: STEP; FETCH(0xB1, 0xCF69); operand = 0x0064; INDY(1); LDA(MEM); 
+L_CF69: STEP; FETCH(0xA8, 0xCF6A); operand = 0x0000; IMP; TAY; 
+L_CF6A: STEP; FETCH(0x8A, 0xCF6B); operand = 0x0000; IMP; TXA; 
+L_CF6B: STEP; FETCH(0x4C, 0xCF6E); operand = 0xD391; ABSO; JMP; goto L_D391;
+L_CF6E: STEP; FETCH(0x20, 0xCF71); operand = 0xCF14; ABSO; JSR; goto L_CF14;
+L_CF71: STEP; FETCH(0x90, 0xCF73); operand = 0x002D; REL; BCC; if (pc != 0xCF73) goto L_CFA0; 
+L_CF73: STEP; FETCH(0xE0, 0xCF75); operand = 0x0054; IMM; CPX(IMMV); 
+L_CF75: STEP; FETCH(0xD0, 0xCF77); operand = 0x001B; REL; BNE; if (pc != 0xCF77) goto L_CF92; 
+L_CF77: STEP; FETCH(0xC0, 0xCF79); operand = 0x0049; IMM; CPY(IMMV); 
+L_CF79: STEP; FETCH(0xD0, 0xCF7B); operand = 0x0025; REL; BNE; if (pc != 0xCF7B) goto L_CFA0; 
+L_CF7B: STEP; FETCH(0x20, 0xCF7E); operand = 0xCF84; ABSO; JSR; goto L_CF84;
+L_CF7E: STEP; FETCH(0x98, 0xCF7F); operand = 0x0000; IMP; TYA; 
+L_CF7F: STEP; FETCH(0xA2, 0xCF81); operand = 0x00A0; IMM; LDX(IMMV); 
+L_CF81: STEP; FETCH(0x4C, 0xCF84); operand = 0xDC4F; ABSO; JMP; goto L_DC4F;
+L_CF84: STEP; FETCH(0x20, 0xCF87); operand = 0xFFDE; ABSO; JSR; goto L_FFDE;
+L_CF87: STEP; FETCH(0x86, 0xCF89); operand = 0x0064; ZP; STX; 
+L_CF89: STEP; FETCH(0x84, 0xCF8B); operand = 0x0063; ZP; STY; 
+L_CF8B: STEP; FETCH(0x85, 0xCF8D); operand = 0x0065; ZP; STA; 
+L_CF8D: STEP; FETCH(0xA0, 0xCF8F); operand = 0x0000; IMM; LDY(IMMV); 
+L_CF8F: STEP; FETCH(0x84, 0xCF91); operand = 0x0062; ZP; STY; 
+L_CF91: STEP; FETCH(0x60, 0xCF92); operand = 0x0000; IMP; RTS; goto dispatch;
+L_CF92: STEP; FETCH(0xE0, 0xCF94); operand = 0x0053; IMM; CPX(IMMV); 
+L_CF94: STEP; FETCH(0xD0, 0xCF96); operand = 0x000A; REL; BNE; if (pc != 0xCF96) goto L_CFA0; 
+L_CF96: STEP; FETCH(0xC0, 0xCF98); operand = 0x0054; IMM; CPY(IMMV); 
+L_CF98: STEP; FETCH(0xD0, 0xCF9A); operand = 0x0006; REL; BNE; if (pc != 0xCF9A) goto L_CFA0; 
+L_CF9A: STEP; FETCH(0x20, 0xCF9D); operand = 0xFFB7; ABSO; JSR; goto L_FFB7;
+L_CF9D: STEP; FETCH(0x4C, 0xCFA0); operand = 0xDC3C; ABSO; JMP; goto L_DC3C;
+L_CFA0: STEP; FETCH(0xA5, 0xCFA2); operand = 0x0064; ZP; LDA(MEM); 
+L_CFA2: STEP; FETCH(0xA4, 0xCFA4); operand = 0x0065; ZP; LDY(MEM); 
+L_CFA4: STEP; FETCH(0x4C, 0xCFA7); operand = 0xDBA2; ABSO; JMP; goto L_DBA2;
+L_CFA7: STEP; FETCH(0x0A, 0xCFA8); operand = 0x0000; ACC; ASL_A; 
+L_CFA8: STEP; FETCH(0x48, 0xCFA9); operand = 0x0000; IMP; PHA; 
+L_CFA9: STEP; FETCH(0xAA, 0xCFAA); operand = 0x0000; IMP; TAX; 
+L_CFAA: STEP; FETCH(0x20, 0xCFAD); operand = 0x0073; ABSO; JSR; goto out;
+L_CFAD: STEP; FETCH(0xE0, 0xCFAF); operand = 0x008F; IMM; CPX(IMMV); 
+L_CFAF: STEP; FETCH(0x90, 0xCFB1); operand = 0x0020; REL; BCC; if (pc != 0xCFB1) goto L_CFD1; 
+L_CFB1: STEP; FETCH(0x20, 0xCFB4); operand = 0xCEFA; ABSO; JSR; goto L_CEFA;
+L_CFB4: STEP; FETCH(0x20, 0xCFB7); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_CFB7: STEP; FETCH(0x20, 0xCFBA); operand = 0xCEFD; ABSO; JSR; goto L_CEFD;
+L_CFBA: STEP; FETCH(0x20, 0xCFBD); operand = 0xCD8F; ABSO; JSR; goto L_CD8F;
+L_CFBD: STEP; FETCH(0x68, 0xCFBE); operand = 0x0000; IMP; PLA; 
+L_CFBE: STEP; FETCH(0xAA, 0xCFBF); operand = 0x0000; IMP; TAX; 
+L_CFBF: STEP; FETCH(0xA5, 0xCFC1); operand = 0x0065; ZP; LDA(MEM); 
+L_CFC1: STEP; FETCH(0x48, 0xCFC2); operand = 0x0000; IMP; PHA; 
+L_CFC2: STEP; FETCH(0xA5, 0xCFC4); operand = 0x0064; ZP; LDA(MEM); 
+L_CFC4: STEP; FETCH(0x48, 0xCFC5); operand = 0x0000; IMP; PHA; 
+L_CFC5: STEP; FETCH(0x8A, 0xCFC6); operand = 0x0000; IMP; TXA; 
+L_CFC6: STEP; FETCH(0x48, 0xCFC7); operand = 0x0000; IMP; PHA; 
+L_CFC7: STEP; FETCH(0x20, 0xCFCA); operand = 0xD79E; ABSO; JSR; goto L_D79E;
+L_CFCA: STEP; FETCH(0x68, 0xCFCB); operand = 0x0000; IMP; PLA; 
+L_CFCB: STEP; FETCH(0xA8, 0xCFCC); operand = 0x0000; IMP; TAY; 
+L_CFCC: STEP; FETCH(0x8A, 0xCFCD); operand = 0x0000; IMP; TXA; 
+L_CFCD: STEP; FETCH(0x48, 0xCFCE); operand = 0x0000; IMP; PHA; 
+L_CFCE: STEP; FETCH(0x4C, 0xCFD1); operand = 0xCFD6; ABSO; JMP; goto L_CFD6;
+L_CFD1: STEP; FETCH(0x20, 0xCFD4); operand = 0xCEF1; ABSO; JSR; goto L_CEF1;
+L_CFD4: STEP; FETCH(0x68, 0xCFD5); operand = 0x0000; IMP; PLA; 
+L_CFD5: STEP; FETCH(0xA8, 0xCFD6); operand = 0x0000; IMP; TAY; 
+L_CFD6: STEP; FETCH(0xB9, 0xCFD9); operand = 0xBFEA; ABSY(1); LDA(MEM); 
+L_CFD9: STEP; FETCH(0x85, 0xCFDB); operand = 0x0055; ZP; STA; 
+L_CFDB: STEP; FETCH(0xB9, 0xCFDE); operand = 0xBFEB; ABSY(1); LDA(MEM); 
+L_CFDE: STEP; FETCH(0x85, 0xCFE0); operand = 0x0056; ZP; STA; 
+L_CFE0: STEP; FETCH(0x20, 0xCFE3); operand = 0x0054; ABSO; JSR; goto out;
+L_CFE3: STEP; FETCH(0x4C, 0xCFE6); operand = 0xCD8D; ABSO; JMP; goto L_CD8D;
+L_CFE6: STEP; FETCH(0xA0, 0xCFE8); operand = 0x00FF; IMM; LDY(IMMV); 
+L_CFE8: STEP; FETCH(0x2C, 0xCFEB); operand = 0x00A0; ABSO; BIT(MEM); goto L_CFEB;
+L_CFE9: STEP; FETCH(0xA0, 0xCFEB); operand = 0x0000; IMM; LDY(IMMV); 
+L_CFEB: STEP; FETCH(0x84, 0xCFED); operand = 0x000B; ZP; STY; 
+L_CFED: STEP; FETCH(0x20, 0xCFF0); operand = 0xD1BF; ABSO; JSR; goto L_D1BF;
+L_CFF0: STEP; FETCH(0xA5, 0xCFF2); operand = 0x0064; ZP; LDA(MEM); 
+L_CFF2: STEP; FETCH(0x45, 0xCFF4); operand = 0x000B; ZP; EOR(MEM); 
+L_CFF4: STEP; FETCH(0x85, 0xCFF6); operand = 0x0007; ZP; STA; 
+L_CFF6: STEP; FETCH(0xA5, 0xCFF8); operand = 0x0065; ZP; LDA(MEM); 
+L_CFF8: STEP; FETCH(0x45, 0xCFFA); operand = 0x000B; ZP; EOR(MEM); 
+L_CFFA: STEP; FETCH(0x85, 0xCFFC); operand = 0x0008; ZP; STA; 
+L_CFFC: STEP; FETCH(0x20, 0xCFFF); operand = 0xDBFC; ABSO; JSR; goto L_DBFC;
+L_CFFF: STEP; FETCH(0x20, 0xD002); operand = 0xD1BF; ABSO; JSR; goto L_D1BF;
+L_D002: STEP; FETCH(0xA5, 0xD004); operand = 0x0065; ZP; LDA(MEM); 
+L_D004: STEP; FETCH(0x45, 0xD006); operand = 0x000B; ZP; EOR(MEM); 
+L_D006: STEP; FETCH(0x25, 0xD008); operand = 0x0008; ZP; AND(MEM); 
+L_D008: STEP; FETCH(0x45, 0xD00A); operand = 0x000B; ZP; EOR(MEM); 
+L_D00A: STEP; FETCH(0xA8, 0xD00B); operand = 0x0000; IMP; TAY; 
+L_D00B: STEP; FETCH(0xA5, 0xD00D); operand = 0x0064; ZP; LDA(MEM); 
+L_D00D: STEP; FETCH(0x45, 0xD00F); operand = 0x000B; ZP; EOR(MEM); 
+L_D00F: STEP; FETCH(0x25, 0xD011); operand = 0x0007; ZP; AND(MEM); 
+L_D011: STEP; FETCH(0x45, 0xD013); operand = 0x000B; ZP; EOR(MEM); 
+L_D013: STEP; FETCH(0x4C, 0xD016); operand = 0xD391; ABSO; JMP; goto L_D391;
+L_D016: STEP; FETCH(0x20, 0xD019); operand = 0xCD90; ABSO; JSR; goto L_CD90;
+L_D019: STEP; FETCH(0xB0, 0xD01B); operand = 0x0013; REL; BCS; if (pc != 0xD01B) goto L_D02E; 
+L_D01B: STEP; FETCH(0xA5, 0xD01D); operand = 0x006E; ZP; LDA(MEM); 
+L_D01D: STEP; FETCH(0x09, 0xD01F); operand = 0x007F; IMM; ORA(IMMV); 
+L_D01F: STEP; FETCH(0x25, 0xD021); operand = 0x006A; ZP; AND(MEM); 
+L_D021: STEP; FETCH(0x85, 0xD023); operand = 0x006A; ZP; STA; 
+L_D023: STEP; FETCH(0xA9, 0xD025); operand = 0x0069; IMM; LDA(IMMV); 
+L_D025: STEP; FETCH(0xA0, 0xD027); operand = 0x0000; IMM; LDY(IMMV); 
+L_D027: STEP; FETCH(0x20, 0xD02A); operand = 0xDC5B; ABSO; JSR; goto L_DC5B;
+L_D02A: STEP; FETCH(0xAA, 0xD02B); operand = 0x0000; IMP; TAX; 
+L_D02B: STEP; FETCH(0x4C, 0xD02E); operand = 0xD061; ABSO; JMP; goto L_D061;
+L_D02E: STEP; FETCH(0xA9, 0xD030); operand = 0x0000; IMM; LDA(IMMV); 
+L_D030: STEP; FETCH(0x85, 0xD032); operand = 0x000D; ZP; STA; 
+L_D032: STEP; FETCH(0xC6, 0xD034); operand = 0x004D; ZP; DEC; 
+L_D034: STEP; FETCH(0x20, 0xD037); operand = 0xD6A6; ABSO; JSR; goto L_D6A6;
+L_D037: STEP; FETCH(0x85, 0xD039); operand = 0x0061; ZP; STA; 
+L_D039: STEP; FETCH(0x86, 0xD03B); operand = 0x0062; ZP; STX; 
+L_D03B: STEP; FETCH(0x84, 0xD03D); operand = 0x0063; ZP; STY; 
+L_D03D: STEP; FETCH(0xA5, 0xD03F); operand = 0x006C; ZP; LDA(MEM); 
+L_D03F: STEP; FETCH(0xA4, 0xD041); operand = 0x006D; ZP; LDY(MEM); 
+L_D041: STEP; FETCH(0x20, 0xD044); operand = 0xD6AA; ABSO; JSR; goto L_D6AA;
+L_D044: STEP; FETCH(0x86, 0xD046); operand = 0x006C; ZP; STX; 
+L_D046: STEP; FETCH(0x84, 0xD048); operand = 0x006D; ZP; STY; 
+L_D048: STEP; FETCH(0xAA, 0xD049); operand = 0x0000; IMP; TAX; 
+L_D049: STEP; FETCH(0x38, 0xD04A); operand = 0x0000; IMP; SEC; 
+L_D04A: STEP; FETCH(0xE5, 0xD04C); operand = 0x0061; ZP; SBC(MEM); 
+L_D04C: STEP; FETCH(0xF0, 0xD04E); operand = 0x0008; REL; BEQ; if (pc != 0xD04E) goto L_D056; 
+L_D04E: STEP; FETCH(0xA9, 0xD050); operand = 0x0001; IMM; LDA(IMMV); 
+L_D050: STEP; FETCH(0x90, 0xD052); operand = 0x0004; REL; BCC; if (pc != 0xD052) goto L_D056; 
+L_D052: STEP; FETCH(0xA6, 0xD054); operand = 0x0061; ZP; LDX(MEM); 
+L_D054: STEP; FETCH(0xA9, 0xD056); operand = 0x00FF; IMM; LDA(IMMV); 
+L_D056: STEP; FETCH(0x85, 0xD058); operand = 0x0066; ZP; STA; 
+L_D058: STEP; FETCH(0xA0, 0xD05A); operand = 0x00FF; IMM; LDY(IMMV); 
+L_D05A: STEP; FETCH(0xE8, 0xD05B); operand = 0x0000; IMP; INX; 
+L_D05B: STEP; FETCH(0xC8, 0xD05C); operand = 0x0000; IMP; INY; 
+L_D05C: STEP; FETCH(0xCA, 0xD05D); operand = 0x0000; IMP; DEX; 
+L_D05D: STEP; FETCH(0xD0, 0xD05F); operand = 0x0007; REL; BNE; if (pc != 0xD05F) goto L_D066; 
+L_D05F: STEP; FETCH(0xA6, 0xD061); operand = 0x0066; ZP; LDX(MEM); 
+L_D061: STEP; FETCH(0x30, 0xD063); operand = 0x000F; REL; BMI; if (pc != 0xD063) goto L_D072; 
+L_D063: STEP; FETCH(0x18, 0xD064); operand = 0x0000; IMP; CLC; 
+L_D064: STEP; FETCH(0x90, 0xD066); operand = 0x000C; REL; BCC; if (pc != 0xD066) goto L_D072; 
+L_D066: STEP; FETCH(0xB1, 0xD068); operand = 0x006C; INDY(1); LDA(MEM); 
+L_D068: STEP; FETCH(0xD1, 0xD06A); operand = 0x0062; INDY(1); CMP(MEM); 
+L_D06A: STEP; FETCH(0xF0, 0xD06C); operand = 0x00EF; REL; BEQ; if (pc != 0xD06C) goto L_D05B; 
+L_D06C: STEP; FETCH(0xA2, 0xD06E); operand = 0x00FF; IMM; LDX(IMMV); 
+L_D06E: STEP; FETCH(0xB0, 0xD070); operand = 0x0002; REL; BCS; if (pc != 0xD070) goto L_D072; 
+L_D070: STEP; FETCH(0xA2, 0xD072); operand = 0x0001; IMM; LDX(IMMV); 
+L_D072: STEP; FETCH(0xE8, 0xD073); operand = 0x0000; IMP; INX; 
+L_D073: STEP; FETCH(0x8A, 0xD074); operand = 0x0000; IMP; TXA; 
+L_D074: STEP; FETCH(0x2A, 0xD075); operand = 0x0000; ACC; ROL_A; 
+L_D075: STEP; FETCH(0x25, 0xD077); operand = 0x0012; ZP; AND(MEM); 
+L_D077: STEP; FETCH(0xF0, 0xD079); operand = 0x0002; REL; BEQ; if (pc != 0xD079) goto L_D07B; 
+L_D079: STEP; FETCH(0xA9, 0xD07B); operand = 0x00FF; IMM; LDA(IMMV); 
+L_D07B: STEP; FETCH(0x4C, 0xD07E); operand = 0xDC3C; ABSO; JMP; goto L_DC3C;
+L_D07E: STEP; FETCH(0x20, 0xD081); operand = 0xCEFD; ABSO; JSR; goto L_CEFD;
+L_D081: STEP; FETCH(0xAA, 0xD082); operand = 0x0000; IMP; TAX; 
+L_D082: STEP; FETCH(0x20, 0xD085); operand = 0xD090; ABSO; JSR; goto L_D090;
+L_D085: STEP; FETCH(0x20, 0xD088); operand = 0x0079; ABSO; JSR; goto out;
+L_D088: STEP; FETCH(0xD0, 0xD08A); operand = 0x00F4; REL; BNE; if (pc != 0xD08A) goto L_D07E; 
+L_D08A: STEP; FETCH(0x60, 0xD08B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D08B: STEP; FETCH(0xA2, 0xD08D); operand = 0x0000; IMM; LDX(IMMV); 
+L_D08D: STEP; FETCH(0x20, 0xD090); operand = 0x0079; ABSO; JSR; goto out;
+L_D090: STEP; FETCH(0x86, 0xD092); operand = 0x000C; ZP; STX; 
+L_D092: STEP; FETCH(0x85, 0xD094); operand = 0x0045; ZP; STA; 
+L_D094: STEP; FETCH(0x20, 0xD097); operand = 0x0079; ABSO; JSR; goto out;
+L_D097: STEP; FETCH(0x20, 0xD09A); operand = 0xD113; ABSO; JSR; goto L_D113;
+L_D09A: STEP; FETCH(0xB0, 0xD09C); operand = 0x0003; REL; BCS; if (pc != 0xD09C) goto L_D09F; 
+L_D09C: STEP; FETCH(0x4C, 0xD09F); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_D09F: STEP; FETCH(0xA2, 0xD0A1); operand = 0x0000; IMM; LDX(IMMV); 
+L_D0A1: STEP; FETCH(0x86, 0xD0A3); operand = 0x000D; ZP; STX; 
+L_D0A3: STEP; FETCH(0x86, 0xD0A5); operand = 0x000E; ZP; STX; 
+L_D0A5: STEP; FETCH(0x20, 0xD0A8); operand = 0x0073; ABSO; JSR; goto out;
+L_D0A8: STEP; FETCH(0x90, 0xD0AA); operand = 0x0005; REL; BCC; if (pc != 0xD0AA) goto L_D0AF; 
+L_D0AA: STEP; FETCH(0x20, 0xD0AD); operand = 0xD113; ABSO; JSR; goto L_D113;
+L_D0AD: STEP; FETCH(0x90, 0xD0AF); operand = 0x000B; REL; BCC; if (pc != 0xD0AF) goto L_D0BA; 
+L_D0AF: STEP; FETCH(0xAA, 0xD0B0); operand = 0x0000; IMP; TAX; 
+L_D0B0: STEP; FETCH(0x20, 0xD0B3); operand = 0x0073; ABSO; JSR; goto out;
+L_D0B3: STEP; FETCH(0x90, 0xD0B5); operand = 0x00FB; REL; BCC; if (pc != 0xD0B5) goto L_D0B0; 
+L_D0B5: STEP; FETCH(0x20, 0xD0B8); operand = 0xD113; ABSO; JSR; goto L_D113;
+L_D0B8: STEP; FETCH(0xB0, 0xD0BA); operand = 0x00F6; REL; BCS; if (pc != 0xD0BA) goto L_D0B0; 
+L_D0BA: STEP; FETCH(0xC9, 0xD0BC); operand = 0x0024; IMM; CMP(IMMV); 
+L_D0BC: STEP; FETCH(0xD0, 0xD0BE); operand = 0x0006; REL; BNE; if (pc != 0xD0BE) goto L_D0C4; 
+L_D0BE: STEP; FETCH(0xA9, 0xD0C0); operand = 0x00FF; IMM; LDA(IMMV); 
+L_D0C0: STEP; FETCH(0x85, 0xD0C2); operand = 0x000D; ZP; STA; 
+L_D0C2: STEP; FETCH(0xD0, 0xD0C4); operand = 0x0010; REL; BNE; if (pc != 0xD0C4) goto L_D0D4; 
+L_D0C4: STEP; FETCH(0xC9, 0xD0C6); operand = 0x0025; IMM; CMP(IMMV); 
+L_D0C6: STEP; FETCH(0xD0, 0xD0C8); operand = 0x0013; REL; BNE; if (pc != 0xD0C8) goto L_D0DB; 
+L_D0C8: STEP; FETCH(0xA5, 0xD0CA); operand = 0x0010; ZP; LDA(MEM); 
+L_D0CA: STEP; FETCH(0xD0, 0xD0CC); operand = 0x00D0; REL; BNE; if (pc != 0xD0CC) goto L_D09C; 
+L_D0CC: STEP; FETCH(0xA9, 0xD0CE); operand = 0x0080; IMM; LDA(IMMV); 
+L_D0CE: STEP; FETCH(0x85, 0xD0D0); operand = 0x000E; ZP; STA; 
+L_D0D0: STEP; FETCH(0x05, 0xD0D2); operand = 0x0045; ZP; ORA(MEM); 
+L_D0D2: STEP; FETCH(0x85, 0xD0D4); operand = 0x0045; ZP; STA; 
+L_D0D4: STEP; FETCH(0x8A, 0xD0D5); operand = 0x0000; IMP; TXA; 
+L_D0D5: STEP; FETCH(0x09, 0xD0D7); operand = 0x0080; IMM; ORA(IMMV); 
+L_D0D7: STEP; FETCH(0xAA, 0xD0D8); operand = 0x0000; IMP; TAX; 
+L_D0D8: STEP; FETCH(0x20, 0xD0DB); operand = 0x0073; ABSO; JSR; goto out;
+L_D0DB: STEP; FETCH(0x86, 0xD0DD); operand = 0x0046; ZP; STX; 
+L_D0DD: STEP; FETCH(0x38, 0xD0DE); operand = 0x0000; IMP; SEC; 
+L_D0DE: STEP; FETCH(0x05, 0xD0E0); operand = 0x0010; ZP; ORA(MEM); 
+L_D0E0: STEP; FETCH(0xE9, 0xD0E2); operand = 0x0028; IMM; SBC(IMMV); 
+L_D0E2: STEP; FETCH(0xD0, 0xD0E4); operand = 0x0003; REL; BNE; if (pc != 0xD0E4) goto L_D0E7; 
+L_D0E4: STEP; FETCH(0x4C, 0xD0E7); operand = 0xD1D1; ABSO; JMP; goto L_D1D1;
+L_D0E7: STEP; FETCH(0xA0, 0xD0E9); operand = 0x0000; IMM; LDY(IMMV); 
+L_D0E9: STEP; FETCH(0x84, 0xD0EB); operand = 0x0010; ZP; STY; 
+L_D0EB: STEP; FETCH(0xA5, 0xD0ED); operand = 0x002D; ZP; LDA(MEM); 
+L_D0ED: STEP; FETCH(0xA6, 0xD0EF); operand = 0x002E; ZP; LDX(MEM); 
+L_D0EF: STEP; FETCH(0x86, 0xD0F1); operand = 0x0060; ZP; STX; 
+L_D0F1: STEP; FETCH(0x85, 0xD0F3); operand = 0x005F; ZP; STA; 
+L_D0F3: STEP; FETCH(0xE4, 0xD0F5); operand = 0x0030; ZP; CPX(MEM); 
+L_D0F5: STEP; FETCH(0xD0, 0xD0F7); operand = 0x0004; REL; BNE; if (pc != 0xD0F7) goto L_D0FB; 
+L_D0F7: STEP; FETCH(0xC5, 0xD0F9); operand = 0x002F; ZP; CMP(MEM); 
+L_D0F9: STEP; FETCH(0xF0, 0xD0FB); operand = 0x0022; REL; BEQ; if (pc != 0xD0FB) goto L_D11D; 
+L_D0FB: STEP; FETCH(0xA5, 0xD0FD); operand = 0x0045; ZP; LDA(MEM); 
+L_D0FD: STEP; FETCH(0xD1, 0xD0FF); operand = 0x005F; INDY(1); CMP(MEM); 
+L_D0FF: STEP; FETCH(0xD0, 0xD101); operand = 0x0008; REL; BNE; if (pc != 0xD101) goto L_D109; 
+L_D101: STEP; FETCH(0xA5, 0xD103); operand = 0x0046; ZP; LDA(MEM); 
+L_D103: STEP; FETCH(0xC8, 0xD104); operand = 0x0000; IMP; INY; 
+L_D104: STEP; FETCH(0xD1, 0xD106); operand = 0x005F; INDY(1); CMP(MEM); 
+L_D106: STEP; FETCH(0xF0, 0xD108); operand = 0x007D; REL; BEQ; if (pc != 0xD108) goto L_D185; 
+L_D108: STEP; FETCH(0x88, 0xD109); operand = 0x0000; IMP; DEY; 
+L_D109: STEP; FETCH(0x18, 0xD10A); operand = 0x0000; IMP; CLC; 
+L_D10A: STEP; FETCH(0xA5, 0xD10C); operand = 0x005F; ZP; LDA(MEM); 
+L_D10C: STEP; FETCH(0x69, 0xD10E); operand = 0x0007; IMM; ADC(IMMV); 
+L_D10E: STEP; FETCH(0x90, 0xD110); operand = 0x00E1; REL; BCC; if (pc != 0xD110) goto L_D0F1; 
+L_D110: STEP; FETCH(0xE8, 0xD111); operand = 0x0000; IMP; INX; 
+L_D111: STEP; FETCH(0xD0, 0xD113); operand = 0x00DC; REL; BNE; if (pc != 0xD113) goto L_D0EF; 
+L_D113: STEP; FETCH(0xC9, 0xD115); operand = 0x0041; IMM; CMP(IMMV); 
+L_D115: STEP; FETCH(0x90, 0xD117); operand = 0x0005; REL; BCC; if (pc != 0xD117) goto L_D11C; 
+L_D117: STEP; FETCH(0xE9, 0xD119); operand = 0x005B; IMM; SBC(IMMV); 
+L_D119: STEP; FETCH(0x38, 0xD11A); operand = 0x0000; IMP; SEC; 
+L_D11A: STEP; FETCH(0xE9, 0xD11C); operand = 0x00A5; IMM; SBC(IMMV); 
+L_D11C: STEP; FETCH(0x60, 0xD11D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D11D: STEP; FETCH(0x68, 0xD11E); operand = 0x0000; IMP; PLA; 
+L_D11E: STEP; FETCH(0x48, 0xD11F); operand = 0x0000; IMP; PHA; 
+L_D11F: STEP; FETCH(0xC9, 0xD121); operand = 0x002A; IMM; CMP(IMMV); 
+L_D121: STEP; FETCH(0xD0, 0xD123); operand = 0x0005; REL; BNE; if (pc != 0xD123) goto L_D128; 
+L_D123: STEP; FETCH(0xA9, 0xD125); operand = 0x0013; IMM; LDA(IMMV); 
+L_D125: STEP; FETCH(0xA0, 0xD127); operand = 0x00DF; IMM; LDY(IMMV); 
+L_D127: STEP; FETCH(0x60, 0xD128); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D128: STEP; FETCH(0xA5, 0xD12A); operand = 0x0045; ZP; LDA(MEM); 
+L_D12A: STEP; FETCH(0xA4, 0xD12C); operand = 0x0046; ZP; LDY(MEM); 
+L_D12C: STEP; FETCH(0xC9, 0xD12E); operand = 0x0054; IMM; CMP(IMMV); 
+L_D12E: STEP; FETCH(0xD0, 0xD130); operand = 0x000B; REL; BNE; if (pc != 0xD130) goto L_D13B; 
+L_D130: STEP; FETCH(0xC0, 0xD132); operand = 0x00C9; IMM; CPY(IMMV); 
+L_D132: STEP; FETCH(0xF0, 0xD134); operand = 0x00EF; REL; BEQ; if (pc != 0xD134) goto L_D123; 
+L_D134: STEP; FETCH(0xC0, 0xD136); operand = 0x0049; IMM; CPY(IMMV); 
+L_D136: STEP; FETCH(0xD0, 0xD138); operand = 0x0003; REL; BNE; if (pc != 0xD138) goto L_D13B; 
+L_D138: STEP; FETCH(0x4C, 0xD13B); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_D13B: STEP; FETCH(0xC9, 0xD13D); operand = 0x0053; IMM; CMP(IMMV); 
+L_D13D: STEP; FETCH(0xD0, 0xD13F); operand = 0x0004; REL; BNE; if (pc != 0xD13F) goto L_D143; 
+L_D13F: STEP; FETCH(0xC0, 0xD141); operand = 0x0054; IMM; CPY(IMMV); 
+L_D141: STEP; FETCH(0xF0, 0xD143); operand = 0x00F5; REL; BEQ; if (pc != 0xD143) goto L_D138; 
+L_D143: STEP; FETCH(0xA5, 0xD145); operand = 0x002F; ZP; LDA(MEM); 
+L_D145: STEP; FETCH(0xA4, 0xD147); operand = 0x0030; ZP; LDY(MEM); 
+L_D147: STEP; FETCH(0x85, 0xD149); operand = 0x005F; ZP; STA; 
+L_D149: STEP; FETCH(0x84, 0xD14B); operand = 0x0060; ZP; STY; 
+L_D14B: STEP; FETCH(0xA5, 0xD14D); operand = 0x0031; ZP; LDA(MEM); 
+L_D14D: STEP; FETCH(0xA4, 0xD14F); operand = 0x0032; ZP; LDY(MEM); 
+L_D14F: STEP; FETCH(0x85, 0xD151); operand = 0x005A; ZP; STA; 
+L_D151: STEP; FETCH(0x84, 0xD153); operand = 0x005B; ZP; STY; 
+L_D153: STEP; FETCH(0x18, 0xD154); operand = 0x0000; IMP; CLC; 
+L_D154: STEP; FETCH(0x69, 0xD156); operand = 0x0007; IMM; ADC(IMMV); 
+L_D156: STEP; FETCH(0x90, 0xD158); operand = 0x0001; REL; BCC; if (pc != 0xD158) goto L_D159; 
+L_D158: STEP; FETCH(0xC8, 0xD159); operand = 0x0000; IMP; INY; 
+L_D159: STEP; FETCH(0x85, 0xD15B); operand = 0x0058; ZP; STA; 
+L_D15B: STEP; FETCH(0x84, 0xD15D); operand = 0x0059; ZP; STY; 
+L_D15D: STEP; FETCH(0x20, 0xD160); operand = 0xC3B8; ABSO; JSR; goto L_C3B8;
+L_D160: STEP; FETCH(0xA5, 0xD162); operand = 0x0058; ZP; LDA(MEM); 
+L_D162: STEP; FETCH(0xA4, 0xD164); operand = 0x0059; ZP; LDY(MEM); 
+L_D164: STEP; FETCH(0xC8, 0xD165); operand = 0x0000; IMP; INY; 
+L_D165: STEP; FETCH(0x85, 0xD167); operand = 0x002F; ZP; STA; 
+L_D167: STEP; FETCH(0x84, 0xD169); operand = 0x0030; ZP; STY; 
+L_D169: STEP; FETCH(0xA0, 0xD16B); operand = 0x0000; IMM; LDY(IMMV); 
+L_D16B: STEP; FETCH(0xA5, 0xD16D); operand = 0x0045; ZP; LDA(MEM); 
+L_D16D: STEP; FETCH(0x91, 0xD16F); operand = 0x005F; INDY(0); STA; 
+L_D16F: STEP; FETCH(0xC8, 0xD170); operand = 0x0000; IMP; INY; 
+L_D170: STEP; FETCH(0xA5, 0xD172); operand = 0x0046; ZP; LDA(MEM); 
+L_D172: STEP; FETCH(0x91, 0xD174); operand = 0x005F; INDY(0); STA; 
+L_D174: STEP; FETCH(0xA9, 0xD176); operand = 0x0000; IMM; LDA(IMMV); 
+L_D176: STEP; FETCH(0xC8, 0xD177); operand = 0x0000; IMP; INY; 
+L_D177: STEP; FETCH(0x91, 0xD179); operand = 0x005F; INDY(0); STA; 
+L_D179: STEP; FETCH(0xC8, 0xD17A); operand = 0x0000; IMP; INY; 
+L_D17A: STEP; FETCH(0x91, 0xD17C); operand = 0x005F; INDY(0); STA; 
+L_D17C: STEP; FETCH(0xC8, 0xD17D); operand = 0x0000; IMP; INY; 
+L_D17D: STEP; FETCH(0x91, 0xD17F); operand = 0x005F; INDY(0); STA; 
+L_D17F: STEP; FETCH(0xC8, 0xD180); operand = 0x0000; IMP; INY; 
+L_D180: STEP; FETCH(0x91, 0xD182); operand = 0x005F; INDY(0); STA; 
+L_D182: STEP; FETCH(0xC8, 0xD183); operand = 0x0000; IMP; INY; 
+L_D183: STEP; FETCH(0x91, 0xD185); operand = 0x005F; INDY(0); STA; 
+L_D185: STEP; FETCH(0xA5, 0xD187); operand = 0x005F; ZP; LDA(MEM); 
+L_D187: STEP; FETCH(0x18, 0xD188); operand = 0x0000; IMP; CLC; 
+L_D188: STEP; FETCH(0x69, 0xD18A); operand = 0x0002; IMM; ADC(IMMV); 
+L_D18A: STEP; FETCH(0xA4, 0xD18C); operand = 0x0060; ZP; LDY(MEM); 
+L_D18C: STEP; FETCH(0x90, 0xD18E); operand = 0x0001; REL; BCC; if (pc != 0xD18E) goto L_D18F; 
+L_D18E: STEP; FETCH(0xC8, 0xD18F); operand = 0x0000; IMP; INY; 
+L_D18F: STEP; FETCH(0x85, 0xD191); operand = 0x0047; ZP; STA; 
+L_D191: STEP; FETCH(0x84, 0xD193); operand = 0x0048; ZP; STY; 
+L_D193: STEP; FETCH(0x60, 0xD194); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D194: STEP; FETCH(0xA5, 0xD196); operand = 0x000B; ZP; LDA(MEM); 
+L_D196: STEP; FETCH(0x0A, 0xD197); operand = 0x0000; ACC; ASL_A; 
+L_D197: STEP; FETCH(0x69, 0xD199); operand = 0x0005; IMM; ADC(IMMV); 
+L_D199: STEP; FETCH(0x65, 0xD19B); operand = 0x005F; ZP; ADC(MEM); 
+L_D19B: STEP; FETCH(0xA4, 0xD19D); operand = 0x0060; ZP; LDY(MEM); 
+L_D19D: STEP; FETCH(0x90, 0xD19F); operand = 0x0001; REL; BCC; if (pc != 0xD19F) goto L_D1A0; 
+L_D19F: STEP; FETCH(0xC8, 0xD1A0); operand = 0x0000; IMP; INY; 
+L_D1A0: STEP; FETCH(0x85, 0xD1A2); operand = 0x0058; ZP; STA; 
+L_D1A2: STEP; FETCH(0x84, 0xD1A4); operand = 0x0059; ZP; STY; 
+L_D1A4: STEP; FETCH(0x60, 0xD1A5); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D1B2: STEP; FETCH(0x20, 0xD1B5); operand = 0x0073; ABSO; JSR; goto out;
+L_D1B5: STEP; FETCH(0x20, 0xD1B8); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_D1B8: STEP; FETCH(0x20, 0xD1BB); operand = 0xCD8D; ABSO; JSR; goto L_CD8D;
+L_D1BB: STEP; FETCH(0xA5, 0xD1BD); operand = 0x0066; ZP; LDA(MEM); 
+L_D1BD: STEP; FETCH(0x30, 0xD1BF); operand = 0x000D; REL; BMI; if (pc != 0xD1BF) goto L_D1CC; 
+L_D1BF: STEP; FETCH(0xA5, 0xD1C1); operand = 0x0061; ZP; LDA(MEM); 
+L_D1C1: STEP; FETCH(0xC9, 0xD1C3); operand = 0x0090; IMM; CMP(IMMV); 
+L_D1C3: STEP; FETCH(0x90, 0xD1C5); operand = 0x0009; REL; BCC; if (pc != 0xD1C5) goto L_D1CE; 
+L_D1C5: STEP; FETCH(0xA9, 0xD1C7); operand = 0x00A5; IMM; LDA(IMMV); 
+L_D1C7: STEP; FETCH(0xA0, 0xD1C9); operand = 0x00D1; IMM; LDY(IMMV); 
+L_D1C9: STEP; FETCH(0x20, 0xD1CC); operand = 0xDC5B; ABSO; JSR; goto L_DC5B;
+L_D1CC: STEP; FETCH(0xD0, 0xD1CE); operand = 0x007A; REL; BNE; if (pc != 0xD1CE) goto L_D248; 
+L_D1CE: STEP; FETCH(0x4C, 0xD1D1); operand = 0xDC9B; ABSO; JMP; goto L_DC9B;
+L_D1D1: STEP; FETCH(0xA5, 0xD1D3); operand = 0x000C; ZP; LDA(MEM); 
+L_D1D3: STEP; FETCH(0x05, 0xD1D5); operand = 0x000E; ZP; ORA(MEM); 
+L_D1D5: STEP; FETCH(0x48, 0xD1D6); operand = 0x0000; IMP; PHA; 
+L_D1D6: STEP; FETCH(0xA5, 0xD1D8); operand = 0x000D; ZP; LDA(MEM); 
+L_D1D8: STEP; FETCH(0x48, 0xD1D9); operand = 0x0000; IMP; PHA; 
+L_D1D9: STEP; FETCH(0xA0, 0xD1DB); operand = 0x0000; IMM; LDY(IMMV); 
+L_D1DB: STEP; FETCH(0x98, 0xD1DC); operand = 0x0000; IMP; TYA; 
+L_D1DC: STEP; FETCH(0x48, 0xD1DD); operand = 0x0000; IMP; PHA; 
+L_D1DD: STEP; FETCH(0xA5, 0xD1DF); operand = 0x0046; ZP; LDA(MEM); 
+L_D1DF: STEP; FETCH(0x48, 0xD1E0); operand = 0x0000; IMP; PHA; 
+L_D1E0: STEP; FETCH(0xA5, 0xD1E2); operand = 0x0045; ZP; LDA(MEM); 
+L_D1E2: STEP; FETCH(0x48, 0xD1E3); operand = 0x0000; IMP; PHA; 
+L_D1E3: STEP; FETCH(0x20, 0xD1E6); operand = 0xD1B2; ABSO; JSR; goto L_D1B2;
+L_D1E6: STEP; FETCH(0x68, 0xD1E7); operand = 0x0000; IMP; PLA; 
+L_D1E7: STEP; FETCH(0x85, 0xD1E9); operand = 0x0045; ZP; STA; 
+L_D1E9: STEP; FETCH(0x68, 0xD1EA); operand = 0x0000; IMP; PLA; 
+L_D1EA: STEP; FETCH(0x85, 0xD1EC); operand = 0x0046; ZP; STA; 
+L_D1EC: STEP; FETCH(0x68, 0xD1ED); operand = 0x0000; IMP; PLA; 
+L_D1ED: STEP; FETCH(0xA8, 0xD1EE); operand = 0x0000; IMP; TAY; 
+L_D1EE: STEP; FETCH(0xBA, 0xD1EF); operand = 0x0000; IMP; TSX; 
+L_D1EF: STEP; FETCH(0xBD, 0xD1F2); operand = 0x0102; ABSX(1); LDA(MEM); 
+L_D1F2: STEP; FETCH(0x48, 0xD1F3); operand = 0x0000; IMP; PHA; 
+L_D1F3: STEP; FETCH(0xBD, 0xD1F6); operand = 0x0101; ABSX(1); LDA(MEM); 
+L_D1F6: STEP; FETCH(0x48, 0xD1F7); operand = 0x0000; IMP; PHA; 
+L_D1F7: STEP; FETCH(0xA5, 0xD1F9); operand = 0x0064; ZP; LDA(MEM); 
+L_D1F9: STEP; FETCH(0x9D, 0xD1FC); operand = 0x0102; ABSX(0); STA; 
+L_D1FC: STEP; FETCH(0xA5, 0xD1FE); operand = 0x0065; ZP; LDA(MEM); 
+L_D1FE: STEP; FETCH(0x9D, 0xD201); operand = 0x0101; ABSX(0); STA; 
+L_D201: STEP; FETCH(0xC8, 0xD202); operand = 0x0000; IMP; INY; 
+L_D202: STEP; FETCH(0x20, 0xD205); operand = 0x0079; ABSO; JSR; goto out;
+L_D205: STEP; FETCH(0xC9, 0xD207); operand = 0x002C; IMM; CMP(IMMV); 
+L_D207: STEP; FETCH(0xF0, 0xD209); operand = 0x00D2; REL; BEQ; if (pc != 0xD209) goto L_D1DB; 
+L_D209: STEP; FETCH(0x84, 0xD20B); operand = 0x000B; ZP; STY; 
+L_D20B: STEP; FETCH(0x20, 0xD20E); operand = 0xCEF7; ABSO; JSR; goto L_CEF7;
+L_D20E: STEP; FETCH(0x68, 0xD20F); operand = 0x0000; IMP; PLA; 
+L_D20F: STEP; FETCH(0x85, 0xD211); operand = 0x000D; ZP; STA; 
+L_D211: STEP; FETCH(0x68, 0xD212); operand = 0x0000; IMP; PLA; 
+L_D212: STEP; FETCH(0x85, 0xD214); operand = 0x000E; ZP; STA; 
+L_D214: STEP; FETCH(0x29, 0xD216); operand = 0x007F; IMM; AND(IMMV); 
+L_D216: STEP; FETCH(0x85, 0xD218); operand = 0x000C; ZP; STA; 
+L_D218: STEP; FETCH(0xA6, 0xD21A); operand = 0x002F; ZP; LDX(MEM); 
+L_D21A: STEP; FETCH(0xA5, 0xD21C); operand = 0x0030; ZP; LDA(MEM); 
+L_D21C: STEP; FETCH(0x86, 0xD21E); operand = 0x005F; ZP; STX; 
+L_D21E: STEP; FETCH(0x85, 0xD220); operand = 0x0060; ZP; STA; 
+L_D220: STEP; FETCH(0xC5, 0xD222); operand = 0x0032; ZP; CMP(MEM); 
+L_D222: STEP; FETCH(0xD0, 0xD224); operand = 0x0004; REL; BNE; if (pc != 0xD224) goto L_D228; 
+L_D224: STEP; FETCH(0xE4, 0xD226); operand = 0x0031; ZP; CPX(MEM); 
+L_D226: STEP; FETCH(0xF0, 0xD228); operand = 0x0039; REL; BEQ; if (pc != 0xD228) goto L_D261; 
+L_D228: STEP; FETCH(0xA0, 0xD22A); operand = 0x0000; IMM; LDY(IMMV); 
+L_D22A: STEP; FETCH(0xB1, 0xD22C); operand = 0x005F; INDY(1); LDA(MEM); 
+L_D22C: STEP; FETCH(0xC8, 0xD22D); operand = 0x0000; IMP; INY; 
+L_D22D: STEP; FETCH(0xC5, 0xD22F); operand = 0x0045; ZP; CMP(MEM); 
+L_D22F: STEP; FETCH(0xD0, 0xD231); operand = 0x0006; REL; BNE; if (pc != 0xD231) goto L_D237; 
+L_D231: STEP; FETCH(0xA5, 0xD233); operand = 0x0046; ZP; LDA(MEM); 
+L_D233: STEP; FETCH(0xD1, 0xD235); operand = 0x005F; INDY(1); CMP(MEM); 
+L_D235: STEP; FETCH(0xF0, 0xD237); operand = 0x0016; REL; BEQ; if (pc != 0xD237) goto L_D24D; 
+L_D237: STEP; FETCH(0xC8, 0xD238); operand = 0x0000; IMP; INY; 
+L_D238: STEP; FETCH(0xB1, 0xD23A); operand = 0x005F; INDY(1); LDA(MEM); 
+L_D23A: STEP; FETCH(0x18, 0xD23B); operand = 0x0000; IMP; CLC; 
+L_D23B: STEP; FETCH(0x65, 0xD23D); operand = 0x005F; ZP; ADC(MEM); 
+L_D23D: STEP; FETCH(0xAA, 0xD23E); operand = 0x0000; IMP; TAX; 
+L_D23E: STEP; FETCH(0xC8, 0xD23F); operand = 0x0000; IMP; INY; 
+L_D23F: STEP; FETCH(0xB1, 0xD241); operand = 0x005F; INDY(1); LDA(MEM); 
+L_D241: STEP; FETCH(0x65, 0xD243); operand = 0x0060; ZP; ADC(MEM); 
+L_D243: STEP; FETCH(0x90, 0xD245); operand = 0x00D7; REL; BCC; if (pc != 0xD245) goto L_D21C; 
+L_D245: STEP; FETCH(0xA2, 0xD247); operand = 0x0012; IMM; LDX(IMMV); 
+L_D247: STEP; FETCH(0x2C, 0xD24A); operand = 0x0EA2; ABSO; BIT(MEM); goto L_D24A;
+L_D248: STEP; FETCH(0xA2, 0xD24A); operand = 0x000E; IMM; LDX(IMMV); 
+L_D24A: STEP; FETCH(0x4C, 0xD24D); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_D24D: STEP; FETCH(0xA2, 0xD24F); operand = 0x0013; IMM; LDX(IMMV); 
+L_D24F: STEP; FETCH(0xA5, 0xD251); operand = 0x000C; ZP; LDA(MEM); 
+L_D251: STEP; FETCH(0xD0, 0xD253); operand = 0x00F7; REL; BNE; if (pc != 0xD253) goto L_D24A; 
+L_D253: STEP; FETCH(0x20, 0xD256); operand = 0xD194; ABSO; JSR; goto L_D194;
+L_D256: STEP; FETCH(0xA5, 0xD258); operand = 0x000B; ZP; LDA(MEM); 
+L_D258: STEP; FETCH(0xA0, 0xD25A); operand = 0x0004; IMM; LDY(IMMV); 
+L_D25A: STEP; FETCH(0xD1, 0xD25C); operand = 0x005F; INDY(1); CMP(MEM); 
+L_D25C: STEP; FETCH(0xD0, 0xD25E); operand = 0x00E7; REL; BNE; if (pc != 0xD25E) goto L_D245; 
+L_D25E: STEP; FETCH(0x4C, 0xD261); operand = 0xD2EA; ABSO; JMP; goto L_D2EA;
+L_D261: STEP; FETCH(0x20, 0xD264); operand = 0xD194; ABSO; JSR; goto L_D194;
+L_D264: STEP; FETCH(0x20, 0xD267); operand = 0xC408; ABSO; JSR; goto L_C408;
+L_D267: STEP; FETCH(0xA0, 0xD269); operand = 0x0000; IMM; LDY(IMMV); 
+L_D269: STEP; FETCH(0x84, 0xD26B); operand = 0x0072; ZP; STY; 
+L_D26B: STEP; FETCH(0xA2, 0xD26D); operand = 0x0005; IMM; LDX(IMMV); 
+L_D26D: STEP; FETCH(0xA5, 0xD26F); operand = 0x0045; ZP; LDA(MEM); 
+L_D26F: STEP; FETCH(0x91, 0xD271); operand = 0x005F; INDY(0); STA; 
+L_D271: STEP; FETCH(0x10, 0xD273); operand = 0x0001; REL; BPL; if (pc != 0xD273) goto L_D274; 
+L_D273: STEP; FETCH(0xCA, 0xD274); operand = 0x0000; IMP; DEX; 
+L_D274: STEP; FETCH(0xC8, 0xD275); operand = 0x0000; IMP; INY; 
+L_D275: STEP; FETCH(0xA5, 0xD277); operand = 0x0046; ZP; LDA(MEM); 
+L_D277: STEP; FETCH(0x91, 0xD279); operand = 0x005F; INDY(0); STA; 
+L_D279: STEP; FETCH(0x10, 0xD27B); operand = 0x0002; REL; BPL; if (pc != 0xD27B) goto L_D27D; 
+L_D27B: STEP; FETCH(0xCA, 0xD27C); operand = 0x0000; IMP; DEX; 
+L_D27C: STEP; FETCH(0xCA, 0xD27D); operand = 0x0000; IMP; DEX; 
+L_D27D: STEP; FETCH(0x86, 0xD27F); operand = 0x0071; ZP; STX; 
+L_D27F: STEP; FETCH(0xA5, 0xD281); operand = 0x000B; ZP; LDA(MEM); 
+L_D281: STEP; FETCH(0xC8, 0xD282); operand = 0x0000; IMP; INY; 
+L_D282: STEP; FETCH(0xC8, 0xD283); operand = 0x0000; IMP; INY; 
+L_D283: STEP; FETCH(0xC8, 0xD284); operand = 0x0000; IMP; INY; 
+L_D284: STEP; FETCH(0x91, 0xD286); operand = 0x005F; INDY(0); STA; 
+L_D286: STEP; FETCH(0xA2, 0xD288); operand = 0x000B; IMM; LDX(IMMV); 
+L_D288: STEP; FETCH(0xA9, 0xD28A); operand = 0x0000; IMM; LDA(IMMV); 
+L_D28A: STEP; FETCH(0x24, 0xD28C); operand = 0x000C; ZP; BIT(MEM); 
+L_D28C: STEP; FETCH(0x50, 0xD28E); operand = 0x0008; REL; BVC; if (pc != 0xD28E) goto L_D296; 
+L_D28E: STEP; FETCH(0x68, 0xD28F); operand = 0x0000; IMP; PLA; 
+L_D28F: STEP; FETCH(0x18, 0xD290); operand = 0x0000; IMP; CLC; 
+L_D290: STEP; FETCH(0x69, 0xD292); operand = 0x0001; IMM; ADC(IMMV); 
+L_D292: STEP; FETCH(0xAA, 0xD293); operand = 0x0000; IMP; TAX; 
+L_D293: STEP; FETCH(0x68, 0xD294); operand = 0x0000; IMP; PLA; 
+L_D294: STEP; FETCH(0x69, 0xD296); operand = 0x0000; IMM; ADC(IMMV); 
+L_D296: STEP; FETCH(0xC8, 0xD297); operand = 0x0000; IMP; INY; 
+L_D297: STEP; FETCH(0x91, 0xD299); operand = 0x005F; INDY(0); STA; 
+L_D299: STEP; FETCH(0xC8, 0xD29A); operand = 0x0000; IMP; INY; 
+L_D29A: STEP; FETCH(0x8A, 0xD29B); operand = 0x0000; IMP; TXA; 
+L_D29B: STEP; FETCH(0x91, 0xD29D); operand = 0x005F; INDY(0); STA; 
+L_D29D: STEP; FETCH(0x20, 0xD2A0); operand = 0xD34C; ABSO; JSR; goto L_D34C;
+L_D2A0: STEP; FETCH(0x86, 0xD2A2); operand = 0x0071; ZP; STX; 
+L_D2A2: STEP; FETCH(0x85, 0xD2A4); operand = 0x0072; ZP; STA; 
+L_D2A4: STEP; FETCH(0xA4, 0xD2A6); operand = 0x0022; ZP; LDY(MEM); 
+L_D2A6: STEP; FETCH(0xC6, 0xD2A8); operand = 0x000B; ZP; DEC; 
+L_D2A8: STEP; FETCH(0xD0, 0xD2AA); operand = 0x00DC; REL; BNE; if (pc != 0xD2AA) goto L_D286; 
+L_D2AA: STEP; FETCH(0x65, 0xD2AC); operand = 0x0059; ZP; ADC(MEM); 
+L_D2AC: STEP; FETCH(0xB0, 0xD2AE); operand = 0x005D; REL; BCS; if (pc != 0xD2AE) goto L_D30B; 
+L_D2AE: STEP; FETCH(0x85, 0xD2B0); operand = 0x0059; ZP; STA; 
+L_D2B0: STEP; FETCH(0xA8, 0xD2B1); operand = 0x0000; IMP; TAY; 
+L_D2B1: STEP; FETCH(0x8A, 0xD2B2); operand = 0x0000; IMP; TXA; 
+L_D2B2: STEP; FETCH(0x65, 0xD2B4); operand = 0x0058; ZP; ADC(MEM); 
+L_D2B4: STEP; FETCH(0x90, 0xD2B6); operand = 0x0003; REL; BCC; if (pc != 0xD2B6) goto L_D2B9; 
+L_D2B6: STEP; FETCH(0xC8, 0xD2B7); operand = 0x0000; IMP; INY; 
+L_D2B7: STEP; FETCH(0xF0, 0xD2B9); operand = 0x0052; REL; BEQ; if (pc != 0xD2B9) goto L_D30B; 
+L_D2B9: STEP; FETCH(0x20, 0xD2BC); operand = 0xC408; ABSO; JSR; goto L_C408;
+L_D2BC: STEP; FETCH(0x85, 0xD2BE); operand = 0x0031; ZP; STA; 
+L_D2BE: STEP; FETCH(0x84, 0xD2C0); operand = 0x0032; ZP; STY; 
+L_D2C0: STEP; FETCH(0xA9, 0xD2C2); operand = 0x0000; IMM; LDA(IMMV); 
+L_D2C2: STEP; FETCH(0xE6, 0xD2C4); operand = 0x0072; ZP; INC; 
+L_D2C4: STEP; FETCH(0xA4, 0xD2C6); operand = 0x0071; ZP; LDY(MEM); 
+L_D2C6: STEP; FETCH(0xF0, 0xD2C8); operand = 0x0005; REL; BEQ; if (pc != 0xD2C8) goto L_D2CD; 
+L_D2C8: STEP; FETCH(0x88, 0xD2C9); operand = 0x0000; IMP; DEY; 
+L_D2C9: STEP; FETCH(0x91, 0xD2CB); operand = 0x0058; INDY(0); STA; 
+L_D2CB: STEP; FETCH(0xD0, 0xD2CD); operand = 0x00FB; REL; BNE; if (pc != 0xD2CD) goto L_D2C8; 
+L_D2CD: STEP; FETCH(0xC6, 0xD2CF); operand = 0x0059; ZP; DEC; 
+L_D2CF: STEP; FETCH(0xC6, 0xD2D1); operand = 0x0072; ZP; DEC; 
+L_D2D1: STEP; FETCH(0xD0, 0xD2D3); operand = 0x00F5; REL; BNE; if (pc != 0xD2D3) goto L_D2C8; 
+L_D2D3: STEP; FETCH(0xE6, 0xD2D5); operand = 0x0059; ZP; INC; 
+L_D2D5: STEP; FETCH(0x38, 0xD2D6); operand = 0x0000; IMP; SEC; 
+L_D2D6: STEP; FETCH(0xA5, 0xD2D8); operand = 0x0031; ZP; LDA(MEM); 
+L_D2D8: STEP; FETCH(0xE5, 0xD2DA); operand = 0x005F; ZP; SBC(MEM); 
+L_D2DA: STEP; FETCH(0xA0, 0xD2DC); operand = 0x0002; IMM; LDY(IMMV); 
+L_D2DC: STEP; FETCH(0x91, 0xD2DE); operand = 0x005F; INDY(0); STA; 
+L_D2DE: STEP; FETCH(0xA5, 0xD2E0); operand = 0x0032; ZP; LDA(MEM); 
+L_D2E0: STEP; FETCH(0xC8, 0xD2E1); operand = 0x0000; IMP; INY; 
+L_D2E1: STEP; FETCH(0xE5, 0xD2E3); operand = 0x0060; ZP; SBC(MEM); 
+L_D2E3: STEP; FETCH(0x91, 0xD2E5); operand = 0x005F; INDY(0); STA; 
+L_D2E5: STEP; FETCH(0xA5, 0xD2E7); operand = 0x000C; ZP; LDA(MEM); 
+L_D2E7: STEP; FETCH(0xD0, 0xD2E9); operand = 0x0062; REL; BNE; if (pc != 0xD2E9) goto L_D34B; 
+L_D2E9: STEP; FETCH(0xC8, 0xD2EA); operand = 0x0000; IMP; INY; 
+L_D2EA: STEP; FETCH(0xB1, 0xD2EC); operand = 0x005F; INDY(1); LDA(MEM); 
+L_D2EC: STEP; FETCH(0x85, 0xD2EE); operand = 0x000B; ZP; STA; 
+L_D2EE: STEP; FETCH(0xA9, 0xD2F0); operand = 0x0000; IMM; LDA(IMMV); 
+L_D2F0: STEP; FETCH(0x85, 0xD2F2); operand = 0x0071; ZP; STA; 
+L_D2F2: STEP; FETCH(0x85, 0xD2F4); operand = 0x0072; ZP; STA; 
+L_D2F4: STEP; FETCH(0xC8, 0xD2F5); operand = 0x0000; IMP; INY; 
+L_D2F5: STEP; FETCH(0x68, 0xD2F6); operand = 0x0000; IMP; PLA; 
+L_D2F6: STEP; FETCH(0xAA, 0xD2F7); operand = 0x0000; IMP; TAX; 
+L_D2F7: STEP; FETCH(0x85, 0xD2F9); operand = 0x0064; ZP; STA; 
+L_D2F9: STEP; FETCH(0x68, 0xD2FA); operand = 0x0000; IMP; PLA; 
+L_D2FA: STEP; FETCH(0x85, 0xD2FC); operand = 0x0065; ZP; STA; 
+L_D2FC: STEP; FETCH(0xD1, 0xD2FE); operand = 0x005F; INDY(1); CMP(MEM); 
+L_D2FE: STEP; FETCH(0x90, 0xD300); operand = 0x000E; REL; BCC; if (pc != 0xD300) goto L_D30E; 
+L_D300: STEP; FETCH(0xD0, 0xD302); operand = 0x0006; REL; BNE; if (pc != 0xD302) goto L_D308; 
+L_D302: STEP; FETCH(0xC8, 0xD303); operand = 0x0000; IMP; INY; 
+L_D303: STEP; FETCH(0x8A, 0xD304); operand = 0x0000; IMP; TXA; 
+L_D304: STEP; FETCH(0xD1, 0xD306); operand = 0x005F; INDY(1); CMP(MEM); 
+L_D306: STEP; FETCH(0x90, 0xD308); operand = 0x0007; REL; BCC; if (pc != 0xD308) goto L_D30F; 
+L_D308: STEP; FETCH(0x4C, 0xD30B); operand = 0xD245; ABSO; JMP; goto L_D245;
+L_D30B: STEP; FETCH(0x4C, 0xD30E); operand = 0xC435; ABSO; JMP; goto L_C435;
+L_D30E: STEP; FETCH(0xC8, 0xD30F); operand = 0x0000; IMP; INY; 
+L_D30F: STEP; FETCH(0xA5, 0xD311); operand = 0x0072; ZP; LDA(MEM); 
+L_D311: STEP; FETCH(0x05, 0xD313); operand = 0x0071; ZP; ORA(MEM); 
+L_D313: STEP; FETCH(0x18, 0xD314); operand = 0x0000; IMP; CLC; 
+L_D314: STEP; FETCH(0xF0, 0xD316); operand = 0x000A; REL; BEQ; if (pc != 0xD316) goto L_D320; 
+L_D316: STEP; FETCH(0x20, 0xD319); operand = 0xD34C; ABSO; JSR; goto L_D34C;
+L_D319: STEP; FETCH(0x8A, 0xD31A); operand = 0x0000; IMP; TXA; 
+L_D31A: STEP; FETCH(0x65, 0xD31C); operand = 0x0064; ZP; ADC(MEM); 
+L_D31C: STEP; FETCH(0xAA, 0xD31D); operand = 0x0000; IMP; TAX; 
+L_D31D: STEP; FETCH(0x98, 0xD31E); operand = 0x0000; IMP; TYA; 
+L_D31E: STEP; FETCH(0xA4, 0xD320); operand = 0x0022; ZP; LDY(MEM); 
+L_D320: STEP; FETCH(0x65, 0xD322); operand = 0x0065; ZP; ADC(MEM); 
+L_D322: STEP; FETCH(0x86, 0xD324); operand = 0x0071; ZP; STX; 
+L_D324: STEP; FETCH(0xC6, 0xD326); operand = 0x000B; ZP; DEC; 
+L_D326: STEP; FETCH(0xD0, 0xD328); operand = 0x00CA; REL; BNE; if (pc != 0xD328) goto L_D2F2; 
+L_D328: STEP; FETCH(0x85, 0xD32A); operand = 0x0072; ZP; STA; 
+L_D32A: STEP; FETCH(0xA2, 0xD32C); operand = 0x0005; IMM; LDX(IMMV); 
+L_D32C: STEP; FETCH(0xA5, 0xD32E); operand = 0x0045; ZP; LDA(MEM); 
+L_D32E: STEP; FETCH(0x10, 0xD330); operand = 0x0001; REL; BPL; if (pc != 0xD330) goto L_D331; 
+L_D330: STEP; FETCH(0xCA, 0xD331); operand = 0x0000; IMP; DEX; 
+L_D331: STEP; FETCH(0xA5, 0xD333); operand = 0x0046; ZP; LDA(MEM); 
+L_D333: STEP; FETCH(0x10, 0xD335); operand = 0x0002; REL; BPL; if (pc != 0xD335) goto L_D337; 
+L_D335: STEP; FETCH(0xCA, 0xD336); operand = 0x0000; IMP; DEX; 
+L_D336: STEP; FETCH(0xCA, 0xD337); operand = 0x0000; IMP; DEX; 
+L_D337: STEP; FETCH(0x86, 0xD339); operand = 0x0028; ZP; STX; 
+L_D339: STEP; FETCH(0xA9, 0xD33B); operand = 0x0000; IMM; LDA(IMMV); 
+L_D33B: STEP; FETCH(0x20, 0xD33E); operand = 0xD355; ABSO; JSR; goto L_D355;
+L_D33E: STEP; FETCH(0x8A, 0xD33F); operand = 0x0000; IMP; TXA; 
+L_D33F: STEP; FETCH(0x65, 0xD341); operand = 0x0058; ZP; ADC(MEM); 
+L_D341: STEP; FETCH(0x85, 0xD343); operand = 0x0047; ZP; STA; 
+L_D343: STEP; FETCH(0x98, 0xD344); operand = 0x0000; IMP; TYA; 
+L_D344: STEP; FETCH(0x65, 0xD346); operand = 0x0059; ZP; ADC(MEM); 
+L_D346: STEP; FETCH(0x85, 0xD348); operand = 0x0048; ZP; STA; 
+L_D348: STEP; FETCH(0xA8, 0xD349); operand = 0x0000; IMP; TAY; 
+L_D349: STEP; FETCH(0xA5, 0xD34B); operand = 0x0047; ZP; LDA(MEM); 
+L_D34B: STEP; FETCH(0x60, 0xD34C); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D34C: STEP; FETCH(0x84, 0xD34E); operand = 0x0022; ZP; STY; 
+L_D34E: STEP; FETCH(0xB1, 0xD350); operand = 0x005F; INDY(1); LDA(MEM); 
+L_D350: STEP; FETCH(0x85, 0xD352); operand = 0x0028; ZP; STA; 
+L_D352: STEP; FETCH(0x88, 0xD353); operand = 0x0000; IMP; DEY; 
+L_D353: STEP; FETCH(0xB1, 0xD355); operand = 0x005F; INDY(1); LDA(MEM); 
+L_D355: STEP; FETCH(0x85, 0xD357); operand = 0x0029; ZP; STA; 
+L_D357: STEP; FETCH(0xA9, 0xD359); operand = 0x0010; IMM; LDA(IMMV); 
+L_D359: STEP; FETCH(0x85, 0xD35B); operand = 0x005D; ZP; STA; 
+L_D35B: STEP; FETCH(0xA2, 0xD35D); operand = 0x0000; IMM; LDX(IMMV); 
+L_D35D: STEP; FETCH(0xA0, 0xD35F); operand = 0x0000; IMM; LDY(IMMV); 
+L_D35F: STEP; FETCH(0x8A, 0xD360); operand = 0x0000; IMP; TXA; 
+L_D360: STEP; FETCH(0x0A, 0xD361); operand = 0x0000; ACC; ASL_A; 
+L_D361: STEP; FETCH(0xAA, 0xD362); operand = 0x0000; IMP; TAX; 
+L_D362: STEP; FETCH(0x98, 0xD363); operand = 0x0000; IMP; TYA; 
+L_D363: STEP; FETCH(0x2A, 0xD364); operand = 0x0000; ACC; ROL_A; 
+L_D364: STEP; FETCH(0xA8, 0xD365); operand = 0x0000; IMP; TAY; 
+L_D365: STEP; FETCH(0xB0, 0xD367); operand = 0x00A4; REL; BCS; if (pc != 0xD367) goto L_D30B; 
+L_D367: STEP; FETCH(0x06, 0xD369); operand = 0x0071; ZP; ASL; 
+L_D369: STEP; FETCH(0x26, 0xD36B); operand = 0x0072; ZP; ROL; 
+L_D36B: STEP; FETCH(0x90, 0xD36D); operand = 0x000B; REL; BCC; if (pc != 0xD36D) goto L_D378; 
+L_D36D: STEP; FETCH(0x18, 0xD36E); operand = 0x0000; IMP; CLC; 
+L_D36E: STEP; FETCH(0x8A, 0xD36F); operand = 0x0000; IMP; TXA; 
+L_D36F: STEP; FETCH(0x65, 0xD371); operand = 0x0028; ZP; ADC(MEM); 
+L_D371: STEP; FETCH(0xAA, 0xD372); operand = 0x0000; IMP; TAX; 
+L_D372: STEP; FETCH(0x98, 0xD373); operand = 0x0000; IMP; TYA; 
+L_D373: STEP; FETCH(0x65, 0xD375); operand = 0x0029; ZP; ADC(MEM); 
+L_D375: STEP; FETCH(0xA8, 0xD376); operand = 0x0000; IMP; TAY; 
+L_D376: STEP; FETCH(0xB0, 0xD378); operand = 0x0093; REL; BCS; if (pc != 0xD378) goto L_D30B; 
+L_D378: STEP; FETCH(0xC6, 0xD37A); operand = 0x005D; ZP; DEC; 
+L_D37A: STEP; FETCH(0xD0, 0xD37C); operand = 0x00E3; REL; BNE; if (pc != 0xD37C) goto L_D35F; 
+L_D37C: STEP; FETCH(0x60, 0xD37D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D37D: STEP; FETCH(0xA5, 0xD37F); operand = 0x000D; ZP; LDA(MEM); 
+L_D37F: STEP; FETCH(0xF0, 0xD381); operand = 0x0003; REL; BEQ; if (pc != 0xD381) goto L_D384; 
+L_D381: STEP; FETCH(0x20, 0xD384); operand = 0xD6A6; ABSO; JSR; goto L_D6A6;
+L_D384: STEP; FETCH(0x20, 0xD387); operand = 0xD526; ABSO; JSR; goto L_D526;
+L_D387: STEP; FETCH(0x38, 0xD388); operand = 0x0000; IMP; SEC; 
+L_D388: STEP; FETCH(0xA5, 0xD38A); operand = 0x0033; ZP; LDA(MEM); 
+L_D38A: STEP; FETCH(0xE5, 0xD38C); operand = 0x0031; ZP; SBC(MEM); 
+L_D38C: STEP; FETCH(0xA8, 0xD38D); operand = 0x0000; IMP; TAY; 
+L_D38D: STEP; FETCH(0xA5, 0xD38F); operand = 0x0034; ZP; LDA(MEM); 
+L_D38F: STEP; FETCH(0xE5, 0xD391); operand = 0x0032; ZP; SBC(MEM); 
+L_D391: STEP; FETCH(0xA2, 0xD393); operand = 0x0000; IMM; LDX(IMMV); 
+L_D393: STEP; FETCH(0x86, 0xD395); operand = 0x000D; ZP; STX; 
+L_D395: STEP; FETCH(0x85, 0xD397); operand = 0x0062; ZP; STA; 
+L_D397: STEP; FETCH(0x84, 0xD399); operand = 0x0063; ZP; STY; 
+L_D399: STEP; FETCH(0xA2, 0xD39B); operand = 0x0090; IMM; LDX(IMMV); 
+L_D39B: STEP; FETCH(0x4C, 0xD39E); operand = 0xDC44; ABSO; JMP; goto L_DC44;
+L_D39E: STEP; FETCH(0x38, 0xD39F); operand = 0x0000; IMP; SEC; 
+L_D39F: STEP; FETCH(0x20, 0xD3A2); operand = 0xFFF0; ABSO; JSR; goto L_FFF0;
+L_D3A2: STEP; FETCH(0xA9, 0xD3A4); operand = 0x0000; IMM; LDA(IMMV); 
+L_D3A4: STEP; FETCH(0xF0, 0xD3A6); operand = 0x00EB; REL; BEQ; if (pc != 0xD3A6) goto L_D391; 
+L_D3A6: STEP; FETCH(0xA6, 0xD3A8); operand = 0x003A; ZP; LDX(MEM); 
+L_D3A8: STEP; FETCH(0xE8, 0xD3A9); operand = 0x0000; IMP; INX; 
+L_D3A9: STEP; FETCH(0xD0, 0xD3AB); operand = 0x00A0; REL; BNE; if (pc != 0xD3AB) goto L_D34B; 
+L_D3AB: STEP; FETCH(0xA2, 0xD3AD); operand = 0x0015; IMM; LDX(IMMV); 
+L_D3AD: STEP; FETCH(0x2C, 0xD3B0); operand = 0x1BA2; ABSO; BIT(MEM); goto L_D3B0;
+L_D3AE: STEP; FETCH(0xA2, 0xD3B0); operand = 0x001B; IMM; LDX(IMMV); 
+L_D3B0: STEP; FETCH(0x4C, 0xD3B3); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_D3B3: STEP; FETCH(0x20, 0xD3B6); operand = 0xD3E1; ABSO; JSR; goto L_D3E1;
+L_D3B6: STEP; FETCH(0x20, 0xD3B9); operand = 0xD3A6; ABSO; JSR; goto L_D3A6;
+L_D3B9: STEP; FETCH(0x20, 0xD3BC); operand = 0xCEFA; ABSO; JSR; goto L_CEFA;
+L_D3BC: STEP; FETCH(0xA9, 0xD3BE); operand = 0x0080; IMM; LDA(IMMV); 
+L_D3BE: STEP; FETCH(0x85, 0xD3C0); operand = 0x0010; ZP; STA; 
+L_D3C0: STEP; FETCH(0x20, 0xD3C3); operand = 0xD08B; ABSO; JSR; goto L_D08B;
+L_D3C3: STEP; FETCH(0x20, 0xD3C6); operand = 0xCD8D; ABSO; JSR; goto L_CD8D;
+L_D3C6: STEP; FETCH(0x20, 0xD3C9); operand = 0xCEF7; ABSO; JSR; goto L_CEF7;
+L_D3C9: STEP; FETCH(0xA9, 0xD3CB); operand = 0x00B2; IMM; LDA(IMMV); 
+L_D3CB: STEP; FETCH(0x20, 0xD3CE); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_D3CE: STEP; FETCH(0x48, 0xD3CF); operand = 0x0000; IMP; PHA; 
+L_D3CF: STEP; FETCH(0xA5, 0xD3D1); operand = 0x0048; ZP; LDA(MEM); 
+L_D3D1: STEP; FETCH(0x48, 0xD3D2); operand = 0x0000; IMP; PHA; 
+L_D3D2: STEP; FETCH(0xA5, 0xD3D4); operand = 0x0047; ZP; LDA(MEM); 
+L_D3D4: STEP; FETCH(0x48, 0xD3D5); operand = 0x0000; IMP; PHA; 
+L_D3D5: STEP; FETCH(0xA5, 0xD3D7); operand = 0x007B; ZP; LDA(MEM); 
+L_D3D7: STEP; FETCH(0x48, 0xD3D8); operand = 0x0000; IMP; PHA; 
+L_D3D8: STEP; FETCH(0xA5, 0xD3DA); operand = 0x007A; ZP; LDA(MEM); 
+L_D3DA: STEP; FETCH(0x48, 0xD3DB); operand = 0x0000; IMP; PHA; 
+L_D3DB: STEP; FETCH(0x20, 0xD3DE); operand = 0xC8F8; ABSO; JSR; goto L_C8F8;
+L_D3DE: STEP; FETCH(0x4C, 0xD3E1); operand = 0xD44F; ABSO; JMP; goto L_D44F;
+L_D3E1: STEP; FETCH(0xA9, 0xD3E3); operand = 0x00A5; IMM; LDA(IMMV); 
+L_D3E3: STEP; FETCH(0x20, 0xD3E6); operand = 0xCEFF; ABSO; JSR; goto L_CEFF;
+L_D3E6: STEP; FETCH(0x09, 0xD3E8); operand = 0x0080; IMM; ORA(IMMV); 
+L_D3E8: STEP; FETCH(0x85, 0xD3EA); operand = 0x0010; ZP; STA; 
+L_D3EA: STEP; FETCH(0x20, 0xD3ED); operand = 0xD092; ABSO; JSR; goto L_D092;
+L_D3ED: STEP; FETCH(0x85, 0xD3EF); operand = 0x004E; ZP; STA; 
+L_D3EF: STEP; FETCH(0x84, 0xD3F1); operand = 0x004F; ZP; STY; 
+L_D3F1: STEP; FETCH(0x4C, 0xD3F4); operand = 0xCD8D; ABSO; JMP; goto L_CD8D;
+L_D3F4: STEP; FETCH(0x20, 0xD3F7); operand = 0xD3E1; ABSO; JSR; goto L_D3E1;
+L_D3F7: STEP; FETCH(0xA5, 0xD3F9); operand = 0x004F; ZP; LDA(MEM); 
+L_D3F9: STEP; FETCH(0x48, 0xD3FA); operand = 0x0000; IMP; PHA; 
+L_D3FA: STEP; FETCH(0xA5, 0xD3FC); operand = 0x004E; ZP; LDA(MEM); 
+L_D3FC: STEP; FETCH(0x48, 0xD3FD); operand = 0x0000; IMP; PHA; 
+L_D3FD: STEP; FETCH(0x20, 0xD400); operand = 0xCEF1; ABSO; JSR; goto L_CEF1;
+L_D400: STEP; FETCH(0x20, 0xD403); operand = 0xCD8D; ABSO; JSR; goto L_CD8D;
+L_D403: STEP; FETCH(0x68, 0xD404); operand = 0x0000; IMP; PLA; 
+L_D404: STEP; FETCH(0x85, 0xD406); operand = 0x004E; ZP; STA; 
+L_D406: STEP; FETCH(0x68, 0xD407); operand = 0x0000; IMP; PLA; 
+L_D407: STEP; FETCH(0x85, 0xD409); operand = 0x004F; ZP; STA; 
+L_D409: STEP; FETCH(0xA0, 0xD40B); operand = 0x0002; IMM; LDY(IMMV); 
+L_D40B: STEP; FETCH(0xB1, 0xD40D); operand = 0x004E; INDY(1); LDA(MEM); 
+L_D40D: STEP; FETCH(0x85, 0xD40F); operand = 0x0047; ZP; STA; 
+L_D40F: STEP; FETCH(0xAA, 0xD410); operand = 0x0000; IMP; TAX; 
+L_D410: STEP; FETCH(0xC8, 0xD411); operand = 0x0000; IMP; INY; 
+L_D411: STEP; FETCH(0xB1, 0xD413); operand = 0x004E; INDY(1); LDA(MEM); 
+L_D413: STEP; FETCH(0xF0, 0xD415); operand = 0x0099; REL; BEQ; if (pc != 0xD415) goto L_D3AE; 
+L_D415: STEP; FETCH(0x85, 0xD417); operand = 0x0048; ZP; STA; 
+L_D417: STEP; FETCH(0xC8, 0xD418); operand = 0x0000; IMP; INY; 
+L_D418: STEP; FETCH(0xB1, 0xD41A); operand = 0x0047; INDY(1); LDA(MEM); 
+L_D41A: STEP; FETCH(0x48, 0xD41B); operand = 0x0000; IMP; PHA; 
+L_D41B: STEP; FETCH(0x88, 0xD41C); operand = 0x0000; IMP; DEY; 
+L_D41C: STEP; FETCH(0x10, 0xD41E); operand = 0x00FA; REL; BPL; if (pc != 0xD41E) goto L_D418; 
+L_D41E: STEP; FETCH(0xA4, 0xD420); operand = 0x0048; ZP; LDY(MEM); 
+L_D420: STEP; FETCH(0x20, 0xD423); operand = 0xDBD4; ABSO; JSR; goto L_DBD4;
+L_D423: STEP; FETCH(0xA5, 0xD425); operand = 0x007B; ZP; LDA(MEM); 
+L_D425: STEP; FETCH(0x48, 0xD426); operand = 0x0000; IMP; PHA; 
+L_D426: STEP; FETCH(0xA5, 0xD428); operand = 0x007A; ZP; LDA(MEM); 
+L_D428: STEP; FETCH(0x48, 0xD429); operand = 0x0000; IMP; PHA; 
+L_D429: STEP; FETCH(0xB1, 0xD42B); operand = 0x004E; INDY(1); LDA(MEM); 
+L_D42B: STEP; FETCH(0x85, 0xD42D); operand = 0x007A; ZP; STA; 
+L_D42D: STEP; FETCH(0xC8, 0xD42E); operand = 0x0000; IMP; INY; 
+L_D42E: STEP; FETCH(0xB1, 0xD430); operand = 0x004E; INDY(1); LDA(MEM); 
+L_D430: STEP; FETCH(0x85, 0xD432); operand = 0x007B; ZP; STA; 
+L_D432: STEP; FETCH(0xA5, 0xD434); operand = 0x0048; ZP; LDA(MEM); 
+L_D434: STEP; FETCH(0x48, 0xD435); operand = 0x0000; IMP; PHA; 
+L_D435: STEP; FETCH(0xA5, 0xD437); operand = 0x0047; ZP; LDA(MEM); 
+L_D437: STEP; FETCH(0x48, 0xD438); operand = 0x0000; IMP; PHA; 
+L_D438: STEP; FETCH(0x20, 0xD43B); operand = 0xCD8A; ABSO; JSR; goto L_CD8A;
+L_D43B: STEP; FETCH(0x68, 0xD43C); operand = 0x0000; IMP; PLA; 
+L_D43C: STEP; FETCH(0x85, 0xD43E); operand = 0x004E; ZP; STA; 
+L_D43E: STEP; FETCH(0x68, 0xD43F); operand = 0x0000; IMP; PLA; 
+L_D43F: STEP; FETCH(0x85, 0xD441); operand = 0x004F; ZP; STA; 
+L_D441: STEP; FETCH(0x20, 0xD444); operand = 0x0079; ABSO; JSR; goto out;
+L_D444: STEP; FETCH(0xF0, 0xD446); operand = 0x0003; REL; BEQ; if (pc != 0xD446) goto L_D449; 
+L_D446: STEP; FETCH(0x4C, 0xD449); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_D449: STEP; FETCH(0x68, 0xD44A); operand = 0x0000; IMP; PLA; 
+L_D44A: STEP; FETCH(0x85, 0xD44C); operand = 0x007A; ZP; STA; 
+L_D44C: STEP; FETCH(0x68, 0xD44D); operand = 0x0000; IMP; PLA; 
+L_D44D: STEP; FETCH(0x85, 0xD44F); operand = 0x007B; ZP; STA; 
+L_D44F: STEP; FETCH(0xA0, 0xD451); operand = 0x0000; IMM; LDY(IMMV); 
+L_D451: STEP; FETCH(0x68, 0xD452); operand = 0x0000; IMP; PLA; 
+L_D452: STEP; FETCH(0x91, 0xD454); operand = 0x004E; INDY(0); STA; 
+L_D454: STEP; FETCH(0x68, 0xD455); operand = 0x0000; IMP; PLA; 
+L_D455: STEP; FETCH(0xC8, 0xD456); operand = 0x0000; IMP; INY; 
+L_D456: STEP; FETCH(0x91, 0xD458); operand = 0x004E; INDY(0); STA; 
+L_D458: STEP; FETCH(0x68, 0xD459); operand = 0x0000; IMP; PLA; 
+L_D459: STEP; FETCH(0xC8, 0xD45A); operand = 0x0000; IMP; INY; 
+L_D45A: STEP; FETCH(0x91, 0xD45C); operand = 0x004E; INDY(0); STA; 
+L_D45C: STEP; FETCH(0x68, 0xD45D); operand = 0x0000; IMP; PLA; 
+L_D45D: STEP; FETCH(0xC8, 0xD45E); operand = 0x0000; IMP; INY; 
+L_D45E: STEP; FETCH(0x91, 0xD460); operand = 0x004E; INDY(0); STA; 
+L_D460: STEP; FETCH(0x68, 0xD461); operand = 0x0000; IMP; PLA; 
+L_D461: STEP; FETCH(0xC8, 0xD462); operand = 0x0000; IMP; INY; 
+L_D462: STEP; FETCH(0x91, 0xD464); operand = 0x004E; INDY(0); STA; 
+L_D464: STEP; FETCH(0x60, 0xD465); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D465: STEP; FETCH(0x20, 0xD468); operand = 0xCD8D; ABSO; JSR; goto L_CD8D;
+L_D468: STEP; FETCH(0xA0, 0xD46A); operand = 0x0000; IMM; LDY(IMMV); 
+L_D46A: STEP; FETCH(0x20, 0xD46D); operand = 0xDDDF; ABSO; JSR; goto L_DDDF;
+L_D46D: STEP; FETCH(0x68, 0xD46E); operand = 0x0000; IMP; PLA; 
+L_D46E: STEP; FETCH(0x68, 0xD46F); operand = 0x0000; IMP; PLA; 
+L_D46F: STEP; FETCH(0xA9, 0xD471); operand = 0x00FF; IMM; LDA(IMMV); 
+L_D471: STEP; FETCH(0xA0, 0xD473); operand = 0x0000; IMM; LDY(IMMV); 
+L_D473: STEP; FETCH(0xF0, 0xD475); operand = 0x0012; REL; BEQ; if (pc != 0xD475) goto L_D487; 
+L_D475: STEP; FETCH(0xA6, 0xD477); operand = 0x0064; ZP; LDX(MEM); 
+L_D477: STEP; FETCH(0xA4, 0xD479); operand = 0x0065; ZP; LDY(MEM); 
+L_D479: STEP; FETCH(0x86, 0xD47B); operand = 0x0050; ZP; STX; 
+L_D47B: STEP; FETCH(0x84, 0xD47D); operand = 0x0051; ZP; STY; 
+L_D47D: STEP; FETCH(0x20, 0xD480); operand = 0xD4F4; ABSO; JSR; goto L_D4F4;
+L_D480: STEP; FETCH(0x86, 0xD482); operand = 0x0062; ZP; STX; 
+L_D482: STEP; FETCH(0x84, 0xD484); operand = 0x0063; ZP; STY; 
+L_D484: STEP; FETCH(0x85, 0xD486); operand = 0x0061; ZP; STA; 
+L_D486: STEP; FETCH(0x60, 0xD487); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D487: STEP; FETCH(0xA2, 0xD489); operand = 0x0022; IMM; LDX(IMMV); 
+L_D489: STEP; FETCH(0x86, 0xD48B); operand = 0x0007; ZP; STX; 
+L_D48B: STEP; FETCH(0x86, 0xD48D); operand = 0x0008; ZP; STX; 
+L_D48D: STEP; FETCH(0x85, 0xD48F); operand = 0x006F; ZP; STA; 
+L_D48F: STEP; FETCH(0x84, 0xD491); operand = 0x0070; ZP; STY; 
+L_D491: STEP; FETCH(0x85, 0xD493); operand = 0x0062; ZP; STA; 
+L_D493: STEP; FETCH(0x84, 0xD495); operand = 0x0063; ZP; STY; 
+L_D495: STEP; FETCH(0xA0, 0xD497); operand = 0x00FF; IMM; LDY(IMMV); 
+L_D497: STEP; FETCH(0xC8, 0xD498); operand = 0x0000; IMP; INY; 
+L_D498: STEP; FETCH(0xB1, 0xD49A); operand = 0x006F; INDY(1); LDA(MEM); 
+L_D49A: STEP; FETCH(0xF0, 0xD49C); operand = 0x000C; REL; BEQ; if (pc != 0xD49C) goto L_D4A8; 
+L_D49C: STEP; FETCH(0xC5, 0xD49E); operand = 0x0007; ZP; CMP(MEM); 
+L_D49E: STEP; FETCH(0xF0, 0xD4A0); operand = 0x0004; REL; BEQ; if (pc != 0xD4A0) goto L_D4A4; 
+L_D4A0: STEP; FETCH(0xC5, 0xD4A2); operand = 0x0008; ZP; CMP(MEM); 
+L_D4A2: STEP; FETCH(0xD0, 0xD4A4); operand = 0x00F3; REL; BNE; if (pc != 0xD4A4) goto L_D497; 
+L_D4A4: STEP; FETCH(0xC9, 0xD4A6); operand = 0x0022; IMM; CMP(IMMV); 
+L_D4A6: STEP; FETCH(0xF0, 0xD4A8); operand = 0x0001; REL; BEQ; if (pc != 0xD4A8) goto L_D4A9; 
+L_D4A8: STEP; FETCH(0x18, 0xD4A9); operand = 0x0000; IMP; CLC; 
+L_D4A9: STEP; FETCH(0x84, 0xD4AB); operand = 0x0061; ZP; STY; 
+L_D4AB: STEP; FETCH(0x98, 0xD4AC); operand = 0x0000; IMP; TYA; 
+L_D4AC: STEP; FETCH(0x65, 0xD4AE); operand = 0x006F; ZP; ADC(MEM); 
+L_D4AE: STEP; FETCH(0x85, 0xD4B0); operand = 0x0071; ZP; STA; 
+L_D4B0: STEP; FETCH(0xA6, 0xD4B2); operand = 0x0070; ZP; LDX(MEM); 
+L_D4B2: STEP; FETCH(0x90, 0xD4B4); operand = 0x0001; REL; BCC; if (pc != 0xD4B4) goto L_D4B5; 
+L_D4B4: STEP; FETCH(0xE8, 0xD4B5); operand = 0x0000; IMP; INX; 
+L_D4B5: STEP; FETCH(0x86, 0xD4B7); operand = 0x0072; ZP; STX; 
+L_D4B7: STEP; FETCH(0xA5, 0xD4B9); operand = 0x0070; ZP; LDA(MEM); 
+L_D4B9: STEP; FETCH(0xF0, 0xD4BB); operand = 0x0004; REL; BEQ; if (pc != 0xD4BB) goto L_D4BF; 
+L_D4BB: STEP; FETCH(0xC9, 0xD4BD); operand = 0x0002; IMM; CMP(IMMV); 
+L_D4BD: STEP; FETCH(0xD0, 0xD4BF); operand = 0x000B; REL; BNE; if (pc != 0xD4BF) goto L_D4CA; 
+L_D4BF: STEP; FETCH(0x98, 0xD4C0); operand = 0x0000; IMP; TYA; 
+L_D4C0: STEP; FETCH(0x20, 0xD4C3); operand = 0xD475; ABSO; JSR; goto L_D475;
+L_D4C3: STEP; FETCH(0xA6, 0xD4C5); operand = 0x006F; ZP; LDX(MEM); 
+L_D4C5: STEP; FETCH(0xA4, 0xD4C7); operand = 0x0070; ZP; LDY(MEM); 
+L_D4C7: STEP; FETCH(0x20, 0xD4CA); operand = 0xD688; ABSO; JSR; goto L_D688;
+L_D4CA: STEP; FETCH(0xA6, 0xD4CC); operand = 0x0016; ZP; LDX(MEM); 
+L_D4CC: STEP; FETCH(0xE0, 0xD4CE); operand = 0x0022; IMM; CPX(IMMV); 
+L_D4CE: STEP; FETCH(0xD0, 0xD4D0); operand = 0x0005; REL; BNE; if (pc != 0xD4D0) goto L_D4D5; 
+L_D4D0: STEP; FETCH(0xA2, 0xD4D2); operand = 0x0019; IMM; LDX(IMMV); 
+L_D4D2: STEP; FETCH(0x4C, 0xD4D5); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_D4D5: STEP; FETCH(0xA5, 0xD4D7); operand = 0x0061; ZP; LDA(MEM); 
+L_D4D7: STEP; FETCH(0x95, 0xD4D9); operand = 0x0000; ZPX; STA; 
+L_D4D9: STEP; FETCH(0xA5, 0xD4DB); operand = 0x0062; ZP; LDA(MEM); 
+L_D4DB: STEP; FETCH(0x95, 0xD4DD); operand = 0x0001; ZPX; STA; 
+L_D4DD: STEP; FETCH(0xA5, 0xD4DF); operand = 0x0063; ZP; LDA(MEM); 
+L_D4DF: STEP; FETCH(0x95, 0xD4E1); operand = 0x0002; ZPX; STA; 
+L_D4E1: STEP; FETCH(0xA0, 0xD4E3); operand = 0x0000; IMM; LDY(IMMV); 
+L_D4E3: STEP; FETCH(0x86, 0xD4E5); operand = 0x0064; ZP; STX; 
+L_D4E5: STEP; FETCH(0x84, 0xD4E7); operand = 0x0065; ZP; STY; 
+L_D4E7: STEP; FETCH(0x84, 0xD4E9); operand = 0x0070; ZP; STY; 
+L_D4E9: STEP; FETCH(0x88, 0xD4EA); operand = 0x0000; IMP; DEY; 
+L_D4EA: STEP; FETCH(0x84, 0xD4EC); operand = 0x000D; ZP; STY; 
+L_D4EC: STEP; FETCH(0x86, 0xD4EE); operand = 0x0017; ZP; STX; 
+L_D4EE: STEP; FETCH(0xE8, 0xD4EF); operand = 0x0000; IMP; INX; 
+L_D4EF: STEP; FETCH(0xE8, 0xD4F0); operand = 0x0000; IMP; INX; 
+L_D4F0: STEP; FETCH(0xE8, 0xD4F1); operand = 0x0000; IMP; INX; 
+L_D4F1: STEP; FETCH(0x86, 0xD4F3); operand = 0x0016; ZP; STX; 
+L_D4F3: STEP; FETCH(0x60, 0xD4F4); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D4F4: STEP; FETCH(0x46, 0xD4F6); operand = 0x000F; ZP; LSR; 
+L_D4F6: STEP; FETCH(0x48, 0xD4F7); operand = 0x0000; IMP; PHA; 
+L_D4F7: STEP; FETCH(0x49, 0xD4F9); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D4F9: STEP; FETCH(0x38, 0xD4FA); operand = 0x0000; IMP; SEC; 
+L_D4FA: STEP; FETCH(0x65, 0xD4FC); operand = 0x0033; ZP; ADC(MEM); 
+L_D4FC: STEP; FETCH(0xA4, 0xD4FE); operand = 0x0034; ZP; LDY(MEM); 
+L_D4FE: STEP; FETCH(0xB0, 0xD500); operand = 0x0001; REL; BCS; if (pc != 0xD500) goto L_D501; 
+L_D500: STEP; FETCH(0x88, 0xD501); operand = 0x0000; IMP; DEY; 
+L_D501: STEP; FETCH(0xC4, 0xD503); operand = 0x0032; ZP; CPY(MEM); 
+L_D503: STEP; FETCH(0x90, 0xD505); operand = 0x0011; REL; BCC; if (pc != 0xD505) goto L_D516; 
+L_D505: STEP; FETCH(0xD0, 0xD507); operand = 0x0004; REL; BNE; if (pc != 0xD507) goto L_D50B; 
+L_D507: STEP; FETCH(0xC5, 0xD509); operand = 0x0031; ZP; CMP(MEM); 
+L_D509: STEP; FETCH(0x90, 0xD50B); operand = 0x000B; REL; BCC; if (pc != 0xD50B) goto L_D516; 
+L_D50B: STEP; FETCH(0x85, 0xD50D); operand = 0x0033; ZP; STA; 
+L_D50D: STEP; FETCH(0x84, 0xD50F); operand = 0x0034; ZP; STY; 
+L_D50F: STEP; FETCH(0x85, 0xD511); operand = 0x0035; ZP; STA; 
+L_D511: STEP; FETCH(0x84, 0xD513); operand = 0x0036; ZP; STY; 
+L_D513: STEP; FETCH(0xAA, 0xD514); operand = 0x0000; IMP; TAX; 
+L_D514: STEP; FETCH(0x68, 0xD515); operand = 0x0000; IMP; PLA; 
+L_D515: STEP; FETCH(0x60, 0xD516); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D516: STEP; FETCH(0xA2, 0xD518); operand = 0x0010; IMM; LDX(IMMV); 
+L_D518: STEP; FETCH(0xA5, 0xD51A); operand = 0x000F; ZP; LDA(MEM); 
+L_D51A: STEP; FETCH(0x30, 0xD51C); operand = 0x00B6; REL; BMI; if (pc != 0xD51C) goto L_D4D2; 
+L_D51C: STEP; FETCH(0x20, 0xD51F); operand = 0xD526; ABSO; JSR; goto L_D526;
+L_D51F: STEP; FETCH(0xA9, 0xD521); operand = 0x0080; IMM; LDA(IMMV); 
+L_D521: STEP; FETCH(0x85, 0xD523); operand = 0x000F; ZP; STA; 
+L_D523: STEP; FETCH(0x68, 0xD524); operand = 0x0000; IMP; PLA; 
+L_D524: STEP; FETCH(0xD0, 0xD526); operand = 0x00D0; REL; BNE; if (pc != 0xD526) goto L_D4F6; 
+L_D526: STEP; FETCH(0xA6, 0xD528); operand = 0x0037; ZP; LDX(MEM); 
+L_D528: STEP; FETCH(0xA5, 0xD52A); operand = 0x0038; ZP; LDA(MEM); 
+L_D52A: STEP; FETCH(0x86, 0xD52C); operand = 0x0033; ZP; STX; 
+L_D52C: STEP; FETCH(0x85, 0xD52E); operand = 0x0034; ZP; STA; 
+L_D52E: STEP; FETCH(0xA0, 0xD530); operand = 0x0000; IMM; LDY(IMMV); 
+L_D530: STEP; FETCH(0x84, 0xD532); operand = 0x004F; ZP; STY; 
+L_D532: STEP; FETCH(0x84, 0xD534); operand = 0x004E; ZP; STY; 
+L_D534: STEP; FETCH(0xA5, 0xD536); operand = 0x0031; ZP; LDA(MEM); 
+L_D536: STEP; FETCH(0xA6, 0xD538); operand = 0x0032; ZP; LDX(MEM); 
+L_D538: STEP; FETCH(0x85, 0xD53A); operand = 0x005F; ZP; STA; 
+L_D53A: STEP; FETCH(0x86, 0xD53C); operand = 0x0060; ZP; STX; 
+L_D53C: STEP; FETCH(0xA9, 0xD53E); operand = 0x0019; IMM; LDA(IMMV); 
+L_D53E: STEP; FETCH(0xA2, 0xD540); operand = 0x0000; IMM; LDX(IMMV); 
+L_D540: STEP; FETCH(0x85, 0xD542); operand = 0x0022; ZP; STA; 
+L_D542: STEP; FETCH(0x86, 0xD544); operand = 0x0023; ZP; STX; 
+L_D544: STEP; FETCH(0xC5, 0xD546); operand = 0x0016; ZP; CMP(MEM); 
+L_D546: STEP; FETCH(0xF0, 0xD548); operand = 0x0005; REL; BEQ; if (pc != 0xD548) goto L_D54D; 
+L_D548: STEP; FETCH(0x20, 0xD54B); operand = 0xD5C7; ABSO; JSR; goto L_D5C7;
+L_D54B: STEP; FETCH(0xF0, 0xD54D); operand = 0x00F7; REL; BEQ; if (pc != 0xD54D) goto L_D544; 
+L_D54D: STEP; FETCH(0xA9, 0xD54F); operand = 0x0007; IMM; LDA(IMMV); 
+L_D54F: STEP; FETCH(0x85, 0xD551); operand = 0x0053; ZP; STA; 
+L_D551: STEP; FETCH(0xA5, 0xD553); operand = 0x002D; ZP; LDA(MEM); 
+L_D553: STEP; FETCH(0xA6, 0xD555); operand = 0x002E; ZP; LDX(MEM); 
+L_D555: STEP; FETCH(0x85, 0xD557); operand = 0x0022; ZP; STA; 
+L_D557: STEP; FETCH(0x86, 0xD559); operand = 0x0023; ZP; STX; 
+L_D559: STEP; FETCH(0xE4, 0xD55B); operand = 0x0030; ZP; CPX(MEM); 
+L_D55B: STEP; FETCH(0xD0, 0xD55D); operand = 0x0004; REL; BNE; if (pc != 0xD55D) goto L_D561; 
+L_D55D: STEP; FETCH(0xC5, 0xD55F); operand = 0x002F; ZP; CMP(MEM); 
+L_D55F: STEP; FETCH(0xF0, 0xD561); operand = 0x0005; REL; BEQ; if (pc != 0xD561) goto L_D566; 
+L_D561: STEP; FETCH(0x20, 0xD564); operand = 0xD5BD; ABSO; JSR; goto L_D5BD;
+L_D564: STEP; FETCH(0xF0, 0xD566); operand = 0x00F3; REL; BEQ; if (pc != 0xD566) goto L_D559; 
+L_D566: STEP; FETCH(0x85, 0xD568); operand = 0x0058; ZP; STA; 
+L_D568: STEP; FETCH(0x86, 0xD56A); operand = 0x0059; ZP; STX; 
+L_D56A: STEP; FETCH(0xA9, 0xD56C); operand = 0x0003; IMM; LDA(IMMV); 
+L_D56C: STEP; FETCH(0x85, 0xD56E); operand = 0x0053; ZP; STA; 
+L_D56E: STEP; FETCH(0xA5, 0xD570); operand = 0x0058; ZP; LDA(MEM); 
+L_D570: STEP; FETCH(0xA6, 0xD572); operand = 0x0059; ZP; LDX(MEM); 
+L_D572: STEP; FETCH(0xE4, 0xD574); operand = 0x0032; ZP; CPX(MEM); 
+L_D574: STEP; FETCH(0xD0, 0xD576); operand = 0x0007; REL; BNE; if (pc != 0xD576) goto L_D57D; 
+L_D576: STEP; FETCH(0xC5, 0xD578); operand = 0x0031; ZP; CMP(MEM); 
+L_D578: STEP; FETCH(0xD0, 0xD57A); operand = 0x0003; REL; BNE; if (pc != 0xD57A) goto L_D57D; 
+L_D57A: STEP; FETCH(0x4C, 0xD57D); operand = 0xD606; ABSO; JMP; goto L_D606;
+L_D57D: STEP; FETCH(0x85, 0xD57F); operand = 0x0022; ZP; STA; 
+L_D57F: STEP; FETCH(0x86, 0xD581); operand = 0x0023; ZP; STX; 
+L_D581: STEP; FETCH(0xA0, 0xD583); operand = 0x0000; IMM; LDY(IMMV); 
+L_D583: STEP; FETCH(0xB1, 0xD585); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D585: STEP; FETCH(0xAA, 0xD586); operand = 0x0000; IMP; TAX; 
+L_D586: STEP; FETCH(0xC8, 0xD587); operand = 0x0000; IMP; INY; 
+L_D587: STEP; FETCH(0xB1, 0xD589); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D589: STEP; FETCH(0x08, 0xD58A); operand = 0x0000; IMP; PHP; 
+L_D58A: STEP; FETCH(0xC8, 0xD58B); operand = 0x0000; IMP; INY; 
+L_D58B: STEP; FETCH(0xB1, 0xD58D); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D58D: STEP; FETCH(0x65, 0xD58F); operand = 0x0058; ZP; ADC(MEM); 
+L_D58F: STEP; FETCH(0x85, 0xD591); operand = 0x0058; ZP; STA; 
+L_D591: STEP; FETCH(0xC8, 0xD592); operand = 0x0000; IMP; INY; 
+L_D592: STEP; FETCH(0xB1, 0xD594); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D594: STEP; FETCH(0x65, 0xD596); operand = 0x0059; ZP; ADC(MEM); 
+L_D596: STEP; FETCH(0x85, 0xD598); operand = 0x0059; ZP; STA; 
+L_D598: STEP; FETCH(0x28, 0xD599); operand = 0x0000; IMP; PLP; 
+L_D599: STEP; FETCH(0x10, 0xD59B); operand = 0x00D3; REL; BPL; if (pc != 0xD59B) goto L_D56E; 
+L_D59B: STEP; FETCH(0x8A, 0xD59C); operand = 0x0000; IMP; TXA; 
+L_D59C: STEP; FETCH(0x30, 0xD59E); operand = 0x00D0; REL; BMI; if (pc != 0xD59E) goto L_D56E; 
+L_D59E: STEP; FETCH(0xC8, 0xD59F); operand = 0x0000; IMP; INY; 
+L_D59F: STEP; FETCH(0xB1, 0xD5A1); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D5A1: STEP; FETCH(0xA0, 0xD5A3); operand = 0x0000; IMM; LDY(IMMV); 
+L_D5A3: STEP; FETCH(0x0A, 0xD5A4); operand = 0x0000; ACC; ASL_A; 
+L_D5A4: STEP; FETCH(0x69, 0xD5A6); operand = 0x0005; IMM; ADC(IMMV); 
+L_D5A6: STEP; FETCH(0x65, 0xD5A8); operand = 0x0022; ZP; ADC(MEM); 
+L_D5A8: STEP; FETCH(0x85, 0xD5AA); operand = 0x0022; ZP; STA; 
+L_D5AA: STEP; FETCH(0x90, 0xD5AC); operand = 0x0002; REL; BCC; if (pc != 0xD5AC) goto L_D5AE; 
+L_D5AC: STEP; FETCH(0xE6, 0xD5AE); operand = 0x0023; ZP; INC; 
+L_D5AE: STEP; FETCH(0xA6, 0xD5B0); operand = 0x0023; ZP; LDX(MEM); 
+L_D5B0: STEP; FETCH(0xE4, 0xD5B2); operand = 0x0059; ZP; CPX(MEM); 
+L_D5B2: STEP; FETCH(0xD0, 0xD5B4); operand = 0x0004; REL; BNE; if (pc != 0xD5B4) goto L_D5B8; 
+L_D5B4: STEP; FETCH(0xC5, 0xD5B6); operand = 0x0058; ZP; CMP(MEM); 
+L_D5B6: STEP; FETCH(0xF0, 0xD5B8); operand = 0x00BA; REL; BEQ; if (pc != 0xD5B8) goto L_D572; 
+L_D5B8: STEP; FETCH(0x20, 0xD5BB); operand = 0xD5C7; ABSO; JSR; goto L_D5C7;
+L_D5BB: STEP; FETCH(0xF0, 0xD5BD); operand = 0x00F3; REL; BEQ; if (pc != 0xD5BD) goto L_D5B0; 
+L_D5BD: STEP; FETCH(0xB1, 0xD5BF); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D5BF: STEP; FETCH(0x30, 0xD5C1); operand = 0x0035; REL; BMI; if (pc != 0xD5C1) goto L_D5F6; 
+L_D5C1: STEP; FETCH(0xC8, 0xD5C2); operand = 0x0000; IMP; INY; 
+L_D5C2: STEP; FETCH(0xB1, 0xD5C4); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D5C4: STEP; FETCH(0x10, 0xD5C6); operand = 0x0030; REL; BPL; if (pc != 0xD5C6) goto L_D5F6; 
+L_D5C6: STEP; FETCH(0xC8, 0xD5C7); operand = 0x0000; IMP; INY; 
+L_D5C7: STEP; FETCH(0xB1, 0xD5C9); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D5C9: STEP; FETCH(0xF0, 0xD5CB); operand = 0x002B; REL; BEQ; if (pc != 0xD5CB) goto L_D5F6; 
+L_D5CB: STEP; FETCH(0xC8, 0xD5CC); operand = 0x0000; IMP; INY; 
+L_D5CC: STEP; FETCH(0xB1, 0xD5CE); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D5CE: STEP; FETCH(0xAA, 0xD5CF); operand = 0x0000; IMP; TAX; 
+L_D5CF: STEP; FETCH(0xC8, 0xD5D0); operand = 0x0000; IMP; INY; 
+L_D5D0: STEP; FETCH(0xB1, 0xD5D2); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D5D2: STEP; FETCH(0xC5, 0xD5D4); operand = 0x0034; ZP; CMP(MEM); 
+L_D5D4: STEP; FETCH(0x90, 0xD5D6); operand = 0x0006; REL; BCC; if (pc != 0xD5D6) goto L_D5DC; 
+L_D5D6: STEP; FETCH(0xD0, 0xD5D8); operand = 0x001E; REL; BNE; if (pc != 0xD5D8) goto L_D5F6; 
+L_D5D8: STEP; FETCH(0xE4, 0xD5DA); operand = 0x0033; ZP; CPX(MEM); 
+L_D5DA: STEP; FETCH(0xB0, 0xD5DC); operand = 0x001A; REL; BCS; if (pc != 0xD5DC) goto L_D5F6; 
+L_D5DC: STEP; FETCH(0xC5, 0xD5DE); operand = 0x0060; ZP; CMP(MEM); 
+L_D5DE: STEP; FETCH(0x90, 0xD5E0); operand = 0x0016; REL; BCC; if (pc != 0xD5E0) goto L_D5F6; 
+L_D5E0: STEP; FETCH(0xD0, 0xD5E2); operand = 0x0004; REL; BNE; if (pc != 0xD5E2) goto L_D5E6; 
+L_D5E2: STEP; FETCH(0xE4, 0xD5E4); operand = 0x005F; ZP; CPX(MEM); 
+L_D5E4: STEP; FETCH(0x90, 0xD5E6); operand = 0x0010; REL; BCC; if (pc != 0xD5E6) goto L_D5F6; 
+L_D5E6: STEP; FETCH(0x86, 0xD5E8); operand = 0x005F; ZP; STX; 
+L_D5E8: STEP; FETCH(0x85, 0xD5EA); operand = 0x0060; ZP; STA; 
+L_D5EA: STEP; FETCH(0xA5, 0xD5EC); operand = 0x0022; ZP; LDA(MEM); 
+L_D5EC: STEP; FETCH(0xA6, 0xD5EE); operand = 0x0023; ZP; LDX(MEM); 
+L_D5EE: STEP; FETCH(0x85, 0xD5F0); operand = 0x004E; ZP; STA; 
+L_D5F0: STEP; FETCH(0x86, 0xD5F2); operand = 0x004F; ZP; STX; 
+L_D5F2: STEP; FETCH(0xA5, 0xD5F4); operand = 0x0053; ZP; LDA(MEM); 
+L_D5F4: STEP; FETCH(0x85, 0xD5F6); operand = 0x0055; ZP; STA; 
+L_D5F6: STEP; FETCH(0xA5, 0xD5F8); operand = 0x0053; ZP; LDA(MEM); 
+L_D5F8: STEP; FETCH(0x18, 0xD5F9); operand = 0x0000; IMP; CLC; 
+L_D5F9: STEP; FETCH(0x65, 0xD5FB); operand = 0x0022; ZP; ADC(MEM); 
+L_D5FB: STEP; FETCH(0x85, 0xD5FD); operand = 0x0022; ZP; STA; 
+L_D5FD: STEP; FETCH(0x90, 0xD5FF); operand = 0x0002; REL; BCC; if (pc != 0xD5FF) goto L_D601; 
+L_D5FF: STEP; FETCH(0xE6, 0xD601); operand = 0x0023; ZP; INC; 
+L_D601: STEP; FETCH(0xA6, 0xD603); operand = 0x0023; ZP; LDX(MEM); 
+L_D603: STEP; FETCH(0xA0, 0xD605); operand = 0x0000; IMM; LDY(IMMV); 
+L_D605: STEP; FETCH(0x60, 0xD606); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D606: STEP; FETCH(0xA5, 0xD608); operand = 0x004F; ZP; LDA(MEM); 
+L_D608: STEP; FETCH(0x05, 0xD60A); operand = 0x004E; ZP; ORA(MEM); 
+L_D60A: STEP; FETCH(0xF0, 0xD60C); operand = 0x00F5; REL; BEQ; if (pc != 0xD60C) goto L_D601; 
+L_D60C: STEP; FETCH(0xA5, 0xD60E); operand = 0x0055; ZP; LDA(MEM); 
+L_D60E: STEP; FETCH(0x29, 0xD610); operand = 0x0004; IMM; AND(IMMV); 
+L_D610: STEP; FETCH(0x4A, 0xD611); operand = 0x0000; ACC; LSR_A; 
+L_D611: STEP; FETCH(0xA8, 0xD612); operand = 0x0000; IMP; TAY; 
+L_D612: STEP; FETCH(0x85, 0xD614); operand = 0x0055; ZP; STA; 
+L_D614: STEP; FETCH(0xB1, 0xD616); operand = 0x004E; INDY(1); LDA(MEM); 
+L_D616: STEP; FETCH(0x65, 0xD618); operand = 0x005F; ZP; ADC(MEM); 
+L_D618: STEP; FETCH(0x85, 0xD61A); operand = 0x005A; ZP; STA; 
+L_D61A: STEP; FETCH(0xA5, 0xD61C); operand = 0x0060; ZP; LDA(MEM); 
+L_D61C: STEP; FETCH(0x69, 0xD61E); operand = 0x0000; IMM; ADC(IMMV); 
+L_D61E: STEP; FETCH(0x85, 0xD620); operand = 0x005B; ZP; STA; 
+L_D620: STEP; FETCH(0xA5, 0xD622); operand = 0x0033; ZP; LDA(MEM); 
+L_D622: STEP; FETCH(0xA6, 0xD624); operand = 0x0034; ZP; LDX(MEM); 
+L_D624: STEP; FETCH(0x85, 0xD626); operand = 0x0058; ZP; STA; 
+L_D626: STEP; FETCH(0x86, 0xD628); operand = 0x0059; ZP; STX; 
+L_D628: STEP; FETCH(0x20, 0xD62B); operand = 0xC3BF; ABSO; JSR; goto L_C3BF;
+L_D62B: STEP; FETCH(0xA4, 0xD62D); operand = 0x0055; ZP; LDY(MEM); 
+L_D62D: STEP; FETCH(0xC8, 0xD62E); operand = 0x0000; IMP; INY; 
+L_D62E: STEP; FETCH(0xA5, 0xD630); operand = 0x0058; ZP; LDA(MEM); 
+L_D630: STEP; FETCH(0x91, 0xD632); operand = 0x004E; INDY(0); STA; 
+L_D632: STEP; FETCH(0xAA, 0xD633); operand = 0x0000; IMP; TAX; 
+L_D633: STEP; FETCH(0xE6, 0xD635); operand = 0x0059; ZP; INC; 
+L_D635: STEP; FETCH(0xA5, 0xD637); operand = 0x0059; ZP; LDA(MEM); 
+L_D637: STEP; FETCH(0xC8, 0xD638); operand = 0x0000; IMP; INY; 
+L_D638: STEP; FETCH(0x91, 0xD63A); operand = 0x004E; INDY(0); STA; 
+L_D63A: STEP; FETCH(0x4C, 0xD63D); operand = 0xD52A; ABSO; JMP; goto L_D52A;
+L_D63D: STEP; FETCH(0xA5, 0xD63F); operand = 0x0065; ZP; LDA(MEM); 
+L_D63F: STEP; FETCH(0x48, 0xD640); operand = 0x0000; IMP; PHA; 
+L_D640: STEP; FETCH(0xA5, 0xD642); operand = 0x0064; ZP; LDA(MEM); 
+L_D642: STEP; FETCH(0x48, 0xD643); operand = 0x0000; IMP; PHA; 
+L_D643: STEP; FETCH(0x20, 0xD646); operand = 0xCE83; ABSO; JSR; goto L_CE83;
+L_D646: STEP; FETCH(0x20, 0xD649); operand = 0xCD8F; ABSO; JSR; goto L_CD8F;
+L_D649: STEP; FETCH(0x68, 0xD64A); operand = 0x0000; IMP; PLA; 
+L_D64A: STEP; FETCH(0x85, 0xD64C); operand = 0x006F; ZP; STA; 
+L_D64C: STEP; FETCH(0x68, 0xD64D); operand = 0x0000; IMP; PLA; 
+L_D64D: STEP; FETCH(0x85, 0xD64F); operand = 0x0070; ZP; STA; 
+L_D64F: STEP; FETCH(0xA0, 0xD651); operand = 0x0000; IMM; LDY(IMMV); 
+L_D651: STEP; FETCH(0xB1, 0xD653); operand = 0x006F; INDY(1); LDA(MEM); 
+L_D653: STEP; FETCH(0x18, 0xD654); operand = 0x0000; IMP; CLC; 
+L_D654: STEP; FETCH(0x71, 0xD656); operand = 0x0064; INDY(1); ADC(MEM); 
+L_D656: STEP; FETCH(0x90, 0xD658); operand = 0x0005; REL; BCC; if (pc != 0xD658) goto L_D65D; 
+L_D658: STEP; FETCH(0xA2, 0xD65A); operand = 0x0017; IMM; LDX(IMMV); 
+L_D65A: STEP; FETCH(0x4C, 0xD65D); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_D65D: STEP; FETCH(0x20, 0xD660); operand = 0xD475; ABSO; JSR; goto L_D475;
+L_D660: STEP; FETCH(0x20, 0xD663); operand = 0xD67A; ABSO; JSR; goto L_D67A;
+L_D663: STEP; FETCH(0xA5, 0xD665); operand = 0x0050; ZP; LDA(MEM); 
+L_D665: STEP; FETCH(0xA4, 0xD667); operand = 0x0051; ZP; LDY(MEM); 
+L_D667: STEP; FETCH(0x20, 0xD66A); operand = 0xD6AA; ABSO; JSR; goto L_D6AA;
+L_D66A: STEP; FETCH(0x20, 0xD66D); operand = 0xD68C; ABSO; JSR; goto L_D68C;
+L_D66D: STEP; FETCH(0xA5, 0xD66F); operand = 0x006F; ZP; LDA(MEM); 
+L_D66F: STEP; FETCH(0xA4, 0xD671); operand = 0x0070; ZP; LDY(MEM); 
+L_D671: STEP; FETCH(0x20, 0xD674); operand = 0xD6AA; ABSO; JSR; goto L_D6AA;
+L_D674: STEP; FETCH(0x20, 0xD677); operand = 0xD4CA; ABSO; JSR; goto L_D4CA;
+L_D677: STEP; FETCH(0x4C, 0xD67A); operand = 0xCDB8; ABSO; JMP; goto L_CDB8;
+L_D67A: STEP; FETCH(0xA0, 0xD67C); operand = 0x0000; IMM; LDY(IMMV); 
+L_D67C: STEP; FETCH(0xB1, 0xD67E); operand = 0x006F; INDY(1); LDA(MEM); 
+L_D67E: STEP; FETCH(0x48, 0xD67F); operand = 0x0000; IMP; PHA; 
+L_D67F: STEP; FETCH(0xC8, 0xD680); operand = 0x0000; IMP; INY; 
+L_D680: STEP; FETCH(0xB1, 0xD682); operand = 0x006F; INDY(1); LDA(MEM); 
+L_D682: STEP; FETCH(0xAA, 0xD683); operand = 0x0000; IMP; TAX; 
+L_D683: STEP; FETCH(0xC8, 0xD684); operand = 0x0000; IMP; INY; 
+L_D684: STEP; FETCH(0xB1, 0xD686); operand = 0x006F; INDY(1); LDA(MEM); 
+L_D686: STEP; FETCH(0xA8, 0xD687); operand = 0x0000; IMP; TAY; 
+L_D687: STEP; FETCH(0x68, 0xD688); operand = 0x0000; IMP; PLA; 
+L_D688: STEP; FETCH(0x86, 0xD68A); operand = 0x0022; ZP; STX; 
+L_D68A: STEP; FETCH(0x84, 0xD68C); operand = 0x0023; ZP; STY; 
+L_D68C: STEP; FETCH(0xA8, 0xD68D); operand = 0x0000; IMP; TAY; 
+L_D68D: STEP; FETCH(0xF0, 0xD68F); operand = 0x000A; REL; BEQ; if (pc != 0xD68F) goto L_D699; 
+L_D68F: STEP; FETCH(0x48, 0xD690); operand = 0x0000; IMP; PHA; 
+L_D690: STEP; FETCH(0x88, 0xD691); operand = 0x0000; IMP; DEY; 
+L_D691: STEP; FETCH(0xB1, 0xD693); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D693: STEP; FETCH(0x91, 0xD695); operand = 0x0035; INDY(0); STA; 
+L_D695: STEP; FETCH(0x98, 0xD696); operand = 0x0000; IMP; TYA; 
+L_D696: STEP; FETCH(0xD0, 0xD698); operand = 0x00F8; REL; BNE; if (pc != 0xD698) goto L_D690; 
+L_D698: STEP; FETCH(0x68, 0xD699); operand = 0x0000; IMP; PLA; 
+L_D699: STEP; FETCH(0x18, 0xD69A); operand = 0x0000; IMP; CLC; 
+L_D69A: STEP; FETCH(0x65, 0xD69C); operand = 0x0035; ZP; ADC(MEM); 
+L_D69C: STEP; FETCH(0x85, 0xD69E); operand = 0x0035; ZP; STA; 
+L_D69E: STEP; FETCH(0x90, 0xD6A0); operand = 0x0002; REL; BCC; if (pc != 0xD6A0) goto L_D6A2; 
+L_D6A0: STEP; FETCH(0xE6, 0xD6A2); operand = 0x0036; ZP; INC; 
+L_D6A2: STEP; FETCH(0x60, 0xD6A3); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D6A3: STEP; FETCH(0x20, 0xD6A6); operand = 0xCD8F; ABSO; JSR; goto L_CD8F;
+L_D6A6: STEP; FETCH(0xA5, 0xD6A8); operand = 0x0064; ZP; LDA(MEM); 
+L_D6A8: STEP; FETCH(0xA4, 0xD6AA); operand = 0x0065; ZP; LDY(MEM); 
+L_D6AA: STEP; FETCH(0x85, 0xD6AC); operand = 0x0022; ZP; STA; 
+L_D6AC: STEP; FETCH(0x84, 0xD6AE); operand = 0x0023; ZP; STY; 
+L_D6AE: STEP; FETCH(0x20, 0xD6B1); operand = 0xD6DB; ABSO; JSR; goto L_D6DB;
+L_D6B1: STEP; FETCH(0x08, 0xD6B2); operand = 0x0000; IMP; PHP; 
+L_D6B2: STEP; FETCH(0xA0, 0xD6B4); operand = 0x0000; IMM; LDY(IMMV); 
+L_D6B4: STEP; FETCH(0xB1, 0xD6B6); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D6B6: STEP; FETCH(0x48, 0xD6B7); operand = 0x0000; IMP; PHA; 
+L_D6B7: STEP; FETCH(0xC8, 0xD6B8); operand = 0x0000; IMP; INY; 
+L_D6B8: STEP; FETCH(0xB1, 0xD6BA); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D6BA: STEP; FETCH(0xAA, 0xD6BB); operand = 0x0000; IMP; TAX; 
+L_D6BB: STEP; FETCH(0xC8, 0xD6BC); operand = 0x0000; IMP; INY; 
+L_D6BC: STEP; FETCH(0xB1, 0xD6BE); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D6BE: STEP; FETCH(0xA8, 0xD6BF); operand = 0x0000; IMP; TAY; 
+L_D6BF: STEP; FETCH(0x68, 0xD6C0); operand = 0x0000; IMP; PLA; 
+L_D6C0: STEP; FETCH(0x28, 0xD6C1); operand = 0x0000; IMP; PLP; 
+L_D6C1: STEP; FETCH(0xD0, 0xD6C3); operand = 0x0013; REL; BNE; if (pc != 0xD6C3) goto L_D6D6; 
+L_D6C3: STEP; FETCH(0xC4, 0xD6C5); operand = 0x0034; ZP; CPY(MEM); 
+L_D6C5: STEP; FETCH(0xD0, 0xD6C7); operand = 0x000F; REL; BNE; if (pc != 0xD6C7) goto L_D6D6; 
+L_D6C7: STEP; FETCH(0xE4, 0xD6C9); operand = 0x0033; ZP; CPX(MEM); 
+L_D6C9: STEP; FETCH(0xD0, 0xD6CB); operand = 0x000B; REL; BNE; if (pc != 0xD6CB) goto L_D6D6; 
+L_D6CB: STEP; FETCH(0x48, 0xD6CC); operand = 0x0000; IMP; PHA; 
+L_D6CC: STEP; FETCH(0x18, 0xD6CD); operand = 0x0000; IMP; CLC; 
+L_D6CD: STEP; FETCH(0x65, 0xD6CF); operand = 0x0033; ZP; ADC(MEM); 
+L_D6CF: STEP; FETCH(0x85, 0xD6D1); operand = 0x0033; ZP; STA; 
+L_D6D1: STEP; FETCH(0x90, 0xD6D3); operand = 0x0002; REL; BCC; if (pc != 0xD6D3) goto L_D6D5; 
+L_D6D3: STEP; FETCH(0xE6, 0xD6D5); operand = 0x0034; ZP; INC; 
+L_D6D5: STEP; FETCH(0x68, 0xD6D6); operand = 0x0000; IMP; PLA; 
+L_D6D6: STEP; FETCH(0x86, 0xD6D8); operand = 0x0022; ZP; STX; 
+L_D6D8: STEP; FETCH(0x84, 0xD6DA); operand = 0x0023; ZP; STY; 
+L_D6DA: STEP; FETCH(0x60, 0xD6DB); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D6DB: STEP; FETCH(0xC4, 0xD6DD); operand = 0x0018; ZP; CPY(MEM); 
+L_D6DD: STEP; FETCH(0xD0, 0xD6DF); operand = 0x000C; REL; BNE; if (pc != 0xD6DF) goto L_D6EB; 
+L_D6DF: STEP; FETCH(0xC5, 0xD6E1); operand = 0x0017; ZP; CMP(MEM); 
+L_D6E1: STEP; FETCH(0xD0, 0xD6E3); operand = 0x0008; REL; BNE; if (pc != 0xD6E3) goto L_D6EB; 
+L_D6E3: STEP; FETCH(0x85, 0xD6E5); operand = 0x0016; ZP; STA; 
+L_D6E5: STEP; FETCH(0xE9, 0xD6E7); operand = 0x0003; IMM; SBC(IMMV); 
+L_D6E7: STEP; FETCH(0x85, 0xD6E9); operand = 0x0017; ZP; STA; 
+L_D6E9: STEP; FETCH(0xA0, 0xD6EB); operand = 0x0000; IMM; LDY(IMMV); 
+L_D6EB: STEP; FETCH(0x60, 0xD6EC); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D6EC: STEP; FETCH(0x20, 0xD6EF); operand = 0xD7A1; ABSO; JSR; goto L_D7A1;
+L_D6EF: STEP; FETCH(0x8A, 0xD6F0); operand = 0x0000; IMP; TXA; 
+L_D6F0: STEP; FETCH(0x48, 0xD6F1); operand = 0x0000; IMP; PHA; 
+L_D6F1: STEP; FETCH(0xA9, 0xD6F3); operand = 0x0001; IMM; LDA(IMMV); 
+L_D6F3: STEP; FETCH(0x20, 0xD6F6); operand = 0xD47D; ABSO; JSR; goto L_D47D;
+L_D6F6: STEP; FETCH(0x68, 0xD6F7); operand = 0x0000; IMP; PLA; 
+L_D6F7: STEP; FETCH(0xA0, 0xD6F9); operand = 0x0000; IMM; LDY(IMMV); 
+L_D6F9: STEP; FETCH(0x91, 0xD6FB); operand = 0x0062; INDY(0); STA; 
+L_D6FB: STEP; FETCH(0x68, 0xD6FC); operand = 0x0000; IMP; PLA; 
+L_D6FC: STEP; FETCH(0x68, 0xD6FD); operand = 0x0000; IMP; PLA; 
+L_D6FD: STEP; FETCH(0x4C, 0xD700); operand = 0xD4CA; ABSO; JMP; goto L_D4CA;
+L_D700: STEP; FETCH(0x20, 0xD703); operand = 0xD761; ABSO; JSR; goto L_D761;
+L_D703: STEP; FETCH(0xD1, 0xD705); operand = 0x0050; INDY(1); CMP(MEM); 
+L_D705: STEP; FETCH(0x98, 0xD706); operand = 0x0000; IMP; TYA; 
+L_D706: STEP; FETCH(0x90, 0xD708); operand = 0x0004; REL; BCC; if (pc != 0xD708) goto L_D70C; 
+L_D708: STEP; FETCH(0xB1, 0xD70A); operand = 0x0050; INDY(1); LDA(MEM); 
+L_D70A: STEP; FETCH(0xAA, 0xD70B); operand = 0x0000; IMP; TAX; 
+L_D70B: STEP; FETCH(0x98, 0xD70C); operand = 0x0000; IMP; TYA; 
+L_D70C: STEP; FETCH(0x48, 0xD70D); operand = 0x0000; IMP; PHA; 
+L_D70D: STEP; FETCH(0x8A, 0xD70E); operand = 0x0000; IMP; TXA; 
+L_D70E: STEP; FETCH(0x48, 0xD70F); operand = 0x0000; IMP; PHA; 
+L_D70F: STEP; FETCH(0x20, 0xD712); operand = 0xD47D; ABSO; JSR; goto L_D47D;
+L_D712: STEP; FETCH(0xA5, 0xD714); operand = 0x0050; ZP; LDA(MEM); 
+L_D714: STEP; FETCH(0xA4, 0xD716); operand = 0x0051; ZP; LDY(MEM); 
+L_D716: STEP; FETCH(0x20, 0xD719); operand = 0xD6AA; ABSO; JSR; goto L_D6AA;
+L_D719: STEP; FETCH(0x68, 0xD71A); operand = 0x0000; IMP; PLA; 
+L_D71A: STEP; FETCH(0xA8, 0xD71B); operand = 0x0000; IMP; TAY; 
+L_D71B: STEP; FETCH(0x68, 0xD71C); operand = 0x0000; IMP; PLA; 
+L_D71C: STEP; FETCH(0x18, 0xD71D); operand = 0x0000; IMP; CLC; 
+L_D71D: STEP; FETCH(0x65, 0xD71F); operand = 0x0022; ZP; ADC(MEM); 
+L_D71F: STEP; FETCH(0x85, 0xD721); operand = 0x0022; ZP; STA; 
+L_D721: STEP; FETCH(0x90, 0xD723); operand = 0x0002; REL; BCC; if (pc != 0xD723) goto L_D725; 
+L_D723: STEP; FETCH(0xE6, 0xD725); operand = 0x0023; ZP; INC; 
+L_D725: STEP; FETCH(0x98, 0xD726); operand = 0x0000; IMP; TYA; 
+L_D726: STEP; FETCH(0x20, 0xD729); operand = 0xD68C; ABSO; JSR; goto L_D68C;
+L_D729: STEP; FETCH(0x4C, 0xD72C); operand = 0xD4CA; ABSO; JMP; goto L_D4CA;
+L_D72C: STEP; FETCH(0x20, 0xD72F); operand = 0xD761; ABSO; JSR; goto L_D761;
+L_D72F: STEP; FETCH(0x18, 0xD730); operand = 0x0000; IMP; CLC; 
+L_D730: STEP; FETCH(0xF1, 0xD732); operand = 0x0050; INDY(1); SBC(MEM); 
+L_D732: STEP; FETCH(0x49, 0xD734); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D734: STEP; FETCH(0x4C, 0xD737); operand = 0xD706; ABSO; JMP; goto L_D706;
+L_D737: STEP; FETCH(0xA9, 0xD739); operand = 0x00FF; IMM; LDA(IMMV); 
+L_D739: STEP; FETCH(0x85, 0xD73B); operand = 0x0065; ZP; STA; 
+L_D73B: STEP; FETCH(0x20, 0xD73E); operand = 0x0079; ABSO; JSR; goto out;
+L_D73E: STEP; FETCH(0xC9, 0xD740); operand = 0x0029; IMM; CMP(IMMV); 
+L_D740: STEP; FETCH(0xF0, 0xD742); operand = 0x0006; REL; BEQ; if (pc != 0xD742) goto L_D748; 
+L_D742: STEP; FETCH(0x20, 0xD745); operand = 0xCEFD; ABSO; JSR; goto L_CEFD;
+L_D745: STEP; FETCH(0x20, 0xD748); operand = 0xD79E; ABSO; JSR; goto L_D79E;
+L_D748: STEP; FETCH(0x20, 0xD74B); operand = 0xD761; ABSO; JSR; goto L_D761;
+L_D74B: STEP; FETCH(0xF0, 0xD74D); operand = 0x004B; REL; BEQ; if (pc != 0xD74D) goto L_D798; 
+L_D74D: STEP; FETCH(0xCA, 0xD74E); operand = 0x0000; IMP; DEX; 
+L_D74E: STEP; FETCH(0x8A, 0xD74F); operand = 0x0000; IMP; TXA; 
+L_D74F: STEP; FETCH(0x48, 0xD750); operand = 0x0000; IMP; PHA; 
+L_D750: STEP; FETCH(0x18, 0xD751); operand = 0x0000; IMP; CLC; 
+L_D751: STEP; FETCH(0xA2, 0xD753); operand = 0x0000; IMM; LDX(IMMV); 
+L_D753: STEP; FETCH(0xF1, 0xD755); operand = 0x0050; INDY(1); SBC(MEM); 
+L_D755: STEP; FETCH(0xB0, 0xD757); operand = 0x00B6; REL; BCS; if (pc != 0xD757) goto L_D70D; 
+L_D757: STEP; FETCH(0x49, 0xD759); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D759: STEP; FETCH(0xC5, 0xD75B); operand = 0x0065; ZP; CMP(MEM); 
+L_D75B: STEP; FETCH(0x90, 0xD75D); operand = 0x00B1; REL; BCC; if (pc != 0xD75D) goto L_D70E; 
+L_D75D: STEP; FETCH(0xA5, 0xD75F); operand = 0x0065; ZP; LDA(MEM); 
+L_D75F: STEP; FETCH(0xB0, 0xD761); operand = 0x00AD; REL; BCS; if (pc != 0xD761) goto L_D70E; 
+L_D761: STEP; FETCH(0x20, 0xD764); operand = 0xCEF7; ABSO; JSR; goto L_CEF7;
+L_D764: STEP; FETCH(0x68, 0xD765); operand = 0x0000; IMP; PLA; 
+L_D765: STEP; FETCH(0xA8, 0xD766); operand = 0x0000; IMP; TAY; 
+L_D766: STEP; FETCH(0x68, 0xD767); operand = 0x0000; IMP; PLA; 
+L_D767: STEP; FETCH(0x85, 0xD769); operand = 0x0055; ZP; STA; 
+L_D769: STEP; FETCH(0x68, 0xD76A); operand = 0x0000; IMP; PLA; 
+L_D76A: STEP; FETCH(0x68, 0xD76B); operand = 0x0000; IMP; PLA; 
+L_D76B: STEP; FETCH(0x68, 0xD76C); operand = 0x0000; IMP; PLA; 
+L_D76C: STEP; FETCH(0xAA, 0xD76D); operand = 0x0000; IMP; TAX; 
+L_D76D: STEP; FETCH(0x68, 0xD76E); operand = 0x0000; IMP; PLA; 
+L_D76E: STEP; FETCH(0x85, 0xD770); operand = 0x0050; ZP; STA; 
+L_D770: STEP; FETCH(0x68, 0xD771); operand = 0x0000; IMP; PLA; 
+L_D771: STEP; FETCH(0x85, 0xD773); operand = 0x0051; ZP; STA; 
+L_D773: STEP; FETCH(0xA5, 0xD775); operand = 0x0055; ZP; LDA(MEM); 
+L_D775: STEP; FETCH(0x48, 0xD776); operand = 0x0000; IMP; PHA; 
+L_D776: STEP; FETCH(0x98, 0xD777); operand = 0x0000; IMP; TYA; 
+L_D777: STEP; FETCH(0x48, 0xD778); operand = 0x0000; IMP; PHA; 
+L_D778: STEP; FETCH(0xA0, 0xD77A); operand = 0x0000; IMM; LDY(IMMV); 
+L_D77A: STEP; FETCH(0x8A, 0xD77B); operand = 0x0000; IMP; TXA; 
+L_D77B: STEP; FETCH(0x60, 0xD77C); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D77C: STEP; FETCH(0x20, 0xD77F); operand = 0xD782; ABSO; JSR; goto L_D782;
+L_D77F: STEP; FETCH(0x4C, 0xD782); operand = 0xD3A2; ABSO; JMP; goto L_D3A2;
+L_D782: STEP; FETCH(0x20, 0xD785); operand = 0xD6A3; ABSO; JSR; goto L_D6A3;
+L_D785: STEP; FETCH(0xA2, 0xD787); operand = 0x0000; IMM; LDX(IMMV); 
+L_D787: STEP; FETCH(0x86, 0xD789); operand = 0x000D; ZP; STX; 
+L_D789: STEP; FETCH(0xA8, 0xD78A); operand = 0x0000; IMP; TAY; 
+L_D78A: STEP; FETCH(0x60, 0xD78B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D78B: STEP; FETCH(0x20, 0xD78E); operand = 0xD782; ABSO; JSR; goto L_D782;
+L_D78E: STEP; FETCH(0xF0, 0xD790); operand = 0x0008; REL; BEQ; if (pc != 0xD790) goto L_D798; 
+L_D790: STEP; FETCH(0xA0, 0xD792); operand = 0x0000; IMM; LDY(IMMV); 
+L_D792: STEP; FETCH(0xB1, 0xD794); operand = 0x0022; INDY(1); LDA(MEM); 
+L_D794: STEP; FETCH(0xA8, 0xD795); operand = 0x0000; IMP; TAY; 
+L_D795: STEP; FETCH(0x4C, 0xD798); operand = 0xD3A2; ABSO; JMP; goto L_D3A2;
+L_D798: STEP; FETCH(0x4C, 0xD79B); operand = 0xD248; ABSO; JMP; goto L_D248;
+L_D79B: STEP; FETCH(0x20, 0xD79E); operand = 0x0073; ABSO; JSR; goto out;
+L_D79E: STEP; FETCH(0x20, 0xD7A1); operand = 0xCD8A; ABSO; JSR; goto L_CD8A;
+L_D7A1: STEP; FETCH(0x20, 0xD7A4); operand = 0xD1B8; ABSO; JSR; goto L_D1B8;
+L_D7A4: STEP; FETCH(0xA6, 0xD7A6); operand = 0x0064; ZP; LDX(MEM); 
+L_D7A6: STEP; FETCH(0xD0, 0xD7A8); operand = 0x00F0; REL; BNE; if (pc != 0xD7A8) goto L_D798; 
+L_D7A8: STEP; FETCH(0xA6, 0xD7AA); operand = 0x0065; ZP; LDX(MEM); 
+L_D7AA: STEP; FETCH(0x4C, 0xD7AD); operand = 0x0079; ABSO; JMP; goto out;
+L_D7AD: STEP; FETCH(0x20, 0xD7B0); operand = 0xD782; ABSO; JSR; goto L_D782;
+L_D7B0: STEP; FETCH(0xD0, 0xD7B2); operand = 0x0003; REL; BNE; if (pc != 0xD7B2) goto L_D7B5; 
+L_D7B2: STEP; FETCH(0x4C, 0xD7B5); operand = 0xD8F7; ABSO; JMP; goto L_D8F7;
+L_D7B5: STEP; FETCH(0xA6, 0xD7B7); operand = 0x007A; ZP; LDX(MEM); 
+L_D7B7: STEP; FETCH(0xA4, 0xD7B9); operand = 0x007B; ZP; LDY(MEM); 
+L_D7B9: STEP; FETCH(0x86, 0xD7BB); operand = 0x0071; ZP; STX; 
+L_D7BB: STEP; FETCH(0x84, 0xD7BD); operand = 0x0072; ZP; STY; 
+L_D7BD: STEP; FETCH(0xA6, 0xD7BF); operand = 0x0022; ZP; LDX(MEM); 
+L_D7BF: STEP; FETCH(0x86, 0xD7C1); operand = 0x007A; ZP; STX; 
+L_D7C1: STEP; FETCH(0x18, 0xD7C2); operand = 0x0000; IMP; CLC; 
+L_D7C2: STEP; FETCH(0x65, 0xD7C4); operand = 0x0022; ZP; ADC(MEM); 
+L_D7C4: STEP; FETCH(0x85, 0xD7C6); operand = 0x0024; ZP; STA; 
+L_D7C6: STEP; FETCH(0xA6, 0xD7C8); operand = 0x0023; ZP; LDX(MEM); 
+L_D7C8: STEP; FETCH(0x86, 0xD7CA); operand = 0x007B; ZP; STX; 
+L_D7CA: STEP; FETCH(0x90, 0xD7CC); operand = 0x0001; REL; BCC; if (pc != 0xD7CC) goto L_D7CD; 
+L_D7CC: STEP; FETCH(0xE8, 0xD7CD); operand = 0x0000; IMP; INX; 
+L_D7CD: STEP; FETCH(0x86, 0xD7CF); operand = 0x0025; ZP; STX; 
+L_D7CF: STEP; FETCH(0xA0, 0xD7D1); operand = 0x0000; IMM; LDY(IMMV); 
+L_D7D1: STEP; FETCH(0xB1, 0xD7D3); operand = 0x0024; INDY(1); LDA(MEM); 
+L_D7D3: STEP; FETCH(0x48, 0xD7D4); operand = 0x0000; IMP; PHA; 
+L_D7D4: STEP; FETCH(0x98, 0xD7D5); operand = 0x0000; IMP; TYA; 
+L_D7D5: STEP; FETCH(0x91, 0xD7D7); operand = 0x0024; INDY(0); STA; 
+L_D7D7: STEP; FETCH(0x20, 0xD7DA); operand = 0x0079; ABSO; JSR; goto out;
+L_D7DA: STEP; FETCH(0x20, 0xD7DD); operand = 0xDCF3; ABSO; JSR; goto L_DCF3;
+L_D7DD: STEP; FETCH(0x68, 0xD7DE); operand = 0x0000; IMP; PLA; 
+L_D7DE: STEP; FETCH(0xA0, 0xD7E0); operand = 0x0000; IMM; LDY(IMMV); 
+L_D7E0: STEP; FETCH(0x91, 0xD7E2); operand = 0x0024; INDY(0); STA; 
+L_D7E2: STEP; FETCH(0xA6, 0xD7E4); operand = 0x0071; ZP; LDX(MEM); 
+L_D7E4: STEP; FETCH(0xA4, 0xD7E6); operand = 0x0072; ZP; LDY(MEM); 
+L_D7E6: STEP; FETCH(0x86, 0xD7E8); operand = 0x007A; ZP; STX; 
+L_D7E8: STEP; FETCH(0x84, 0xD7EA); operand = 0x007B; ZP; STY; 
+L_D7EA: STEP; FETCH(0x60, 0xD7EB); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D7EB: STEP; FETCH(0x20, 0xD7EE); operand = 0xCD8A; ABSO; JSR; goto L_CD8A;
+L_D7EE: STEP; FETCH(0x20, 0xD7F1); operand = 0xD7F7; ABSO; JSR; goto L_D7F7;
+L_D7F1: STEP; FETCH(0x20, 0xD7F4); operand = 0xCEFD; ABSO; JSR; goto L_CEFD;
+L_D7F4: STEP; FETCH(0x4C, 0xD7F7); operand = 0xD79E; ABSO; JMP; goto L_D79E;
+L_D7F7: STEP; FETCH(0xA5, 0xD7F9); operand = 0x0066; ZP; LDA(MEM); 
+L_D7F9: STEP; FETCH(0x30, 0xD7FB); operand = 0x009D; REL; BMI; if (pc != 0xD7FB) goto L_D798; 
+L_D7FB: STEP; FETCH(0xA5, 0xD7FD); operand = 0x0061; ZP; LDA(MEM); 
+L_D7FD: STEP; FETCH(0xC9, 0xD7FF); operand = 0x0091; IMM; CMP(IMMV); 
+L_D7FF: STEP; FETCH(0xB0, 0xD801); operand = 0x0097; REL; BCS; if (pc != 0xD801) goto L_D798; 
+L_D801: STEP; FETCH(0x20, 0xD804); operand = 0xDC9B; ABSO; JSR; goto L_DC9B;
+L_D804: STEP; FETCH(0xA5, 0xD806); operand = 0x0064; ZP; LDA(MEM); 
+L_D806: STEP; FETCH(0xA4, 0xD808); operand = 0x0065; ZP; LDY(MEM); 
+L_D808: STEP; FETCH(0x84, 0xD80A); operand = 0x0014; ZP; STY; 
+L_D80A: STEP; FETCH(0x85, 0xD80C); operand = 0x0015; ZP; STA; 
+L_D80C: STEP; FETCH(0x60, 0xD80D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D80D: STEP; FETCH(0xA5, 0xD80F); operand = 0x0015; ZP; LDA(MEM); 
+L_D80F: STEP; FETCH(0x48, 0xD810); operand = 0x0000; IMP; PHA; 
+L_D810: STEP; FETCH(0xA5, 0xD812); operand = 0x0014; ZP; LDA(MEM); 
+L_D812: STEP; FETCH(0x48, 0xD813); operand = 0x0000; IMP; PHA; 
+L_D813: STEP; FETCH(0x20, 0xD816); operand = 0xD7F7; ABSO; JSR; goto L_D7F7;
+L_D816: STEP; FETCH(0xA0, 0xD818); operand = 0x0000; IMM; LDY(IMMV); 
+L_D818: STEP; FETCH(0xB1, 0xD81A); operand = 0x0014; INDY(1); LDA(MEM); 
+L_D81A: STEP; FETCH(0xA8, 0xD81B); operand = 0x0000; IMP; TAY; 
+L_D81B: STEP; FETCH(0x68, 0xD81C); operand = 0x0000; IMP; PLA; 
+L_D81C: STEP; FETCH(0x85, 0xD81E); operand = 0x0014; ZP; STA; 
+L_D81E: STEP; FETCH(0x68, 0xD81F); operand = 0x0000; IMP; PLA; 
+L_D81F: STEP; FETCH(0x85, 0xD821); operand = 0x0015; ZP; STA; 
+L_D821: STEP; FETCH(0x4C, 0xD824); operand = 0xD3A2; ABSO; JMP; goto L_D3A2;
+L_D824: STEP; FETCH(0x20, 0xD827); operand = 0xD7EB; ABSO; JSR; goto L_D7EB;
+L_D827: STEP; FETCH(0x8A, 0xD828); operand = 0x0000; IMP; TXA; 
+L_D828: STEP; FETCH(0xA0, 0xD82A); operand = 0x0000; IMM; LDY(IMMV); 
+L_D82A: STEP; FETCH(0x91, 0xD82C); operand = 0x0014; INDY(0); STA; 
+L_D82C: STEP; FETCH(0x60, 0xD82D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D82D: STEP; FETCH(0x20, 0xD830); operand = 0xD7EB; ABSO; JSR; goto L_D7EB;
+L_D830: STEP; FETCH(0x86, 0xD832); operand = 0x0049; ZP; STX; 
+L_D832: STEP; FETCH(0xA2, 0xD834); operand = 0x0000; IMM; LDX(IMMV); 
+L_D834: STEP; FETCH(0x20, 0xD837); operand = 0x0079; ABSO; JSR; goto out;
+L_D837: STEP; FETCH(0xF0, 0xD839); operand = 0x0003; REL; BEQ; if (pc != 0xD839) goto L_D83C; 
+L_D839: STEP; FETCH(0x20, 0xD83C); operand = 0xD7F1; ABSO; JSR; goto L_D7F1;
+L_D83C: STEP; FETCH(0x86, 0xD83E); operand = 0x004A; ZP; STX; 
+L_D83E: STEP; FETCH(0xA0, 0xD840); operand = 0x0000; IMM; LDY(IMMV); 
+L_D840: STEP; FETCH(0xB1, 0xD842); operand = 0x0014; INDY(1); LDA(MEM); 
+L_D842: STEP; FETCH(0x45, 0xD844); operand = 0x004A; ZP; EOR(MEM); 
+L_D844: STEP; FETCH(0x25, 0xD846); operand = 0x0049; ZP; AND(MEM); 
+L_D846: STEP; FETCH(0xF0, 0xD848); operand = 0x00F8; REL; BEQ; if (pc != 0xD848) goto L_D840; 
+L_D848: STEP; FETCH(0x60, 0xD849); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D849: STEP; FETCH(0xA9, 0xD84B); operand = 0x0011; IMM; LDA(IMMV); 
+L_D84B: STEP; FETCH(0xA0, 0xD84D); operand = 0x00DF; IMM; LDY(IMMV); 
+L_D84D: STEP; FETCH(0x4C, 0xD850); operand = 0xD867; ABSO; JMP; goto L_D867;
+L_D850: STEP; FETCH(0x20, 0xD853); operand = 0xDA8C; ABSO; JSR; goto L_DA8C;
+L_D853: STEP; FETCH(0xA5, 0xD855); operand = 0x0066; ZP; LDA(MEM); 
+L_D855: STEP; FETCH(0x49, 0xD857); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D857: STEP; FETCH(0x85, 0xD859); operand = 0x0066; ZP; STA; 
+L_D859: STEP; FETCH(0x45, 0xD85B); operand = 0x006E; ZP; EOR(MEM); 
+L_D85B: STEP; FETCH(0x85, 0xD85D); operand = 0x006F; ZP; STA; 
+L_D85D: STEP; FETCH(0xA5, 0xD85F); operand = 0x0061; ZP; LDA(MEM); 
+L_D85F: STEP; FETCH(0x4C, 0xD862); operand = 0xD86A; ABSO; JMP; goto L_D86A;
+L_D862: STEP; FETCH(0x20, 0xD865); operand = 0xD999; ABSO; JSR; goto L_D999;
+L_D865: STEP; FETCH(0x90, 0xD867); operand = 0x003C; REL; BCC; if (pc != 0xD867) goto L_D8A3; 
+L_D867: STEP; FETCH(0x20, 0xD86A); operand = 0xDA8C; ABSO; JSR; goto L_DA8C;
+L_D86A: STEP; FETCH(0xD0, 0xD86C); operand = 0x0003; REL; BNE; if (pc != 0xD86C) goto L_D86F; 
+L_D86C: STEP; FETCH(0x4C, 0xD86F); operand = 0xDBFC; ABSO; JMP; goto L_DBFC;
+L_D86F: STEP; FETCH(0xA6, 0xD871); operand = 0x0070; ZP; LDX(MEM); 
+L_D871: STEP; FETCH(0x86, 0xD873); operand = 0x0056; ZP; STX; 
+L_D873: STEP; FETCH(0xA2, 0xD875); operand = 0x0069; IMM; LDX(IMMV); 
+L_D875: STEP; FETCH(0xA5, 0xD877); operand = 0x0069; ZP; LDA(MEM); 
+L_D877: STEP; FETCH(0xA8, 0xD878); operand = 0x0000; IMP; TAY; 
+L_D878: STEP; FETCH(0xF0, 0xD87A); operand = 0x00CE; REL; BEQ; if (pc != 0xD87A) goto L_D848; 
+L_D87A: STEP; FETCH(0x38, 0xD87B); operand = 0x0000; IMP; SEC; 
+L_D87B: STEP; FETCH(0xE5, 0xD87D); operand = 0x0061; ZP; SBC(MEM); 
+L_D87D: STEP; FETCH(0xF0, 0xD87F); operand = 0x0024; REL; BEQ; if (pc != 0xD87F) goto L_D8A3; 
+L_D87F: STEP; FETCH(0x90, 0xD881); operand = 0x0012; REL; BCC; if (pc != 0xD881) goto L_D893; 
+L_D881: STEP; FETCH(0x84, 0xD883); operand = 0x0061; ZP; STY; 
+L_D883: STEP; FETCH(0xA4, 0xD885); operand = 0x006E; ZP; LDY(MEM); 
+L_D885: STEP; FETCH(0x84, 0xD887); operand = 0x0066; ZP; STY; 
+L_D887: STEP; FETCH(0x49, 0xD889); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D889: STEP; FETCH(0x69, 0xD88B); operand = 0x0000; IMM; ADC(IMMV); 
+L_D88B: STEP; FETCH(0xA0, 0xD88D); operand = 0x0000; IMM; LDY(IMMV); 
+L_D88D: STEP; FETCH(0x84, 0xD88F); operand = 0x0056; ZP; STY; 
+L_D88F: STEP; FETCH(0xA2, 0xD891); operand = 0x0061; IMM; LDX(IMMV); 
+L_D891: STEP; FETCH(0xD0, 0xD893); operand = 0x0004; REL; BNE; if (pc != 0xD893) goto L_D897; 
+L_D893: STEP; FETCH(0xA0, 0xD895); operand = 0x0000; IMM; LDY(IMMV); 
+L_D895: STEP; FETCH(0x84, 0xD897); operand = 0x0070; ZP; STY; 
+L_D897: STEP; FETCH(0xC9, 0xD899); operand = 0x00F9; IMM; CMP(IMMV); 
+L_D899: STEP; FETCH(0x30, 0xD89B); operand = 0x00C7; REL; BMI; if (pc != 0xD89B) goto L_D862; 
+L_D89B: STEP; FETCH(0xA8, 0xD89C); operand = 0x0000; IMP; TAY; 
+L_D89C: STEP; FETCH(0xA5, 0xD89E); operand = 0x0070; ZP; LDA(MEM); 
+L_D89E: STEP; FETCH(0x56, 0xD8A0); operand = 0x0001; ZPX; LSR; 
+L_D8A0: STEP; FETCH(0x20, 0xD8A3); operand = 0xD9B0; ABSO; JSR; goto L_D9B0;
+L_D8A3: STEP; FETCH(0x24, 0xD8A5); operand = 0x006F; ZP; BIT(MEM); 
+L_D8A5: STEP; FETCH(0x10, 0xD8A7); operand = 0x0057; REL; BPL; if (pc != 0xD8A7) goto L_D8FE; 
+L_D8A7: STEP; FETCH(0xA0, 0xD8A9); operand = 0x0061; IMM; LDY(IMMV); 
+L_D8A9: STEP; FETCH(0xE0, 0xD8AB); operand = 0x0069; IMM; CPX(IMMV); 
+L_D8AB: STEP; FETCH(0xF0, 0xD8AD); operand = 0x0002; REL; BEQ; if (pc != 0xD8AD) goto L_D8AF; 
+L_D8AD: STEP; FETCH(0xA0, 0xD8AF); operand = 0x0069; IMM; LDY(IMMV); 
+L_D8AF: STEP; FETCH(0x38, 0xD8B0); operand = 0x0000; IMP; SEC; 
+L_D8B0: STEP; FETCH(0x49, 0xD8B2); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D8B2: STEP; FETCH(0x65, 0xD8B4); operand = 0x0056; ZP; ADC(MEM); 
+L_D8B4: STEP; FETCH(0x85, 0xD8B6); operand = 0x0070; ZP; STA; 
+L_D8B6: STEP; FETCH(0xB9, 0xD8B9); operand = 0x0004; ABSY(1); LDA(MEM); 
+L_D8B9: STEP; FETCH(0xF5, 0xD8BB); operand = 0x0004; ZPX; SBC(MEM); 
+L_D8BB: STEP; FETCH(0x85, 0xD8BD); operand = 0x0065; ZP; STA; 
+L_D8BD: STEP; FETCH(0xB9, 0xD8C0); operand = 0x0003; ABSY(1); LDA(MEM); 
+L_D8C0: STEP; FETCH(0xF5, 0xD8C2); operand = 0x0003; ZPX; SBC(MEM); 
+L_D8C2: STEP; FETCH(0x85, 0xD8C4); operand = 0x0064; ZP; STA; 
+L_D8C4: STEP; FETCH(0xB9, 0xD8C7); operand = 0x0002; ABSY(1); LDA(MEM); 
+L_D8C7: STEP; FETCH(0xF5, 0xD8C9); operand = 0x0002; ZPX; SBC(MEM); 
+L_D8C9: STEP; FETCH(0x85, 0xD8CB); operand = 0x0063; ZP; STA; 
+L_D8CB: STEP; FETCH(0xB9, 0xD8CE); operand = 0x0001; ABSY(1); LDA(MEM); 
+L_D8CE: STEP; FETCH(0xF5, 0xD8D0); operand = 0x0001; ZPX; SBC(MEM); 
+L_D8D0: STEP; FETCH(0x85, 0xD8D2); operand = 0x0062; ZP; STA; 
+L_D8D2: STEP; FETCH(0xB0, 0xD8D4); operand = 0x0003; REL; BCS; if (pc != 0xD8D4) goto L_D8D7; 
+L_D8D4: STEP; FETCH(0x20, 0xD8D7); operand = 0xD947; ABSO; JSR; goto L_D947;
+L_D8D7: STEP; FETCH(0xA0, 0xD8D9); operand = 0x0000; IMM; LDY(IMMV); 
+L_D8D9: STEP; FETCH(0x98, 0xD8DA); operand = 0x0000; IMP; TYA; 
+L_D8DA: STEP; FETCH(0x18, 0xD8DB); operand = 0x0000; IMP; CLC; 
+L_D8DB: STEP; FETCH(0xA6, 0xD8DD); operand = 0x0062; ZP; LDX(MEM); 
+L_D8DD: STEP; FETCH(0xD0, 0xD8DF); operand = 0x004A; REL; BNE; if (pc != 0xD8DF) goto L_D929; 
+L_D8DF: STEP; FETCH(0xA6, 0xD8E1); operand = 0x0063; ZP; LDX(MEM); 
+L_D8E1: STEP; FETCH(0x86, 0xD8E3); operand = 0x0062; ZP; STX; 
+L_D8E3: STEP; FETCH(0xA6, 0xD8E5); operand = 0x0064; ZP; LDX(MEM); 
+L_D8E5: STEP; FETCH(0x86, 0xD8E7); operand = 0x0063; ZP; STX; 
+L_D8E7: STEP; FETCH(0xA6, 0xD8E9); operand = 0x0065; ZP; LDX(MEM); 
+L_D8E9: STEP; FETCH(0x86, 0xD8EB); operand = 0x0064; ZP; STX; 
+L_D8EB: STEP; FETCH(0xA6, 0xD8ED); operand = 0x0070; ZP; LDX(MEM); 
+L_D8ED: STEP; FETCH(0x86, 0xD8EF); operand = 0x0065; ZP; STX; 
+L_D8EF: STEP; FETCH(0x84, 0xD8F1); operand = 0x0070; ZP; STY; 
+L_D8F1: STEP; FETCH(0x69, 0xD8F3); operand = 0x0008; IMM; ADC(IMMV); 
+L_D8F3: STEP; FETCH(0xC9, 0xD8F5); operand = 0x0020; IMM; CMP(IMMV); 
+L_D8F5: STEP; FETCH(0xD0, 0xD8F7); operand = 0x00E4; REL; BNE; if (pc != 0xD8F7) goto L_D8DB; 
+L_D8F7: STEP; FETCH(0xA9, 0xD8F9); operand = 0x0000; IMM; LDA(IMMV); 
+L_D8F9: STEP; FETCH(0x85, 0xD8FB); operand = 0x0061; ZP; STA; 
+L_D8FB: STEP; FETCH(0x85, 0xD8FD); operand = 0x0066; ZP; STA; 
+L_D8FD: STEP; FETCH(0x60, 0xD8FE); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D8FE: STEP; FETCH(0x65, 0xD900); operand = 0x0056; ZP; ADC(MEM); 
+L_D900: STEP; FETCH(0x85, 0xD902); operand = 0x0070; ZP; STA; 
+L_D902: STEP; FETCH(0xA5, 0xD904); operand = 0x0065; ZP; LDA(MEM); 
+L_D904: STEP; FETCH(0x65, 0xD906); operand = 0x006D; ZP; ADC(MEM); 
+L_D906: STEP; FETCH(0x85, 0xD908); operand = 0x0065; ZP; STA; 
+L_D908: STEP; FETCH(0xA5, 0xD90A); operand = 0x0064; ZP; LDA(MEM); 
+L_D90A: STEP; FETCH(0x65, 0xD90C); operand = 0x006C; ZP; ADC(MEM); 
+L_D90C: STEP; FETCH(0x85, 0xD90E); operand = 0x0064; ZP; STA; 
+L_D90E: STEP; FETCH(0xA5, 0xD910); operand = 0x0063; ZP; LDA(MEM); 
+L_D910: STEP; FETCH(0x65, 0xD912); operand = 0x006B; ZP; ADC(MEM); 
+L_D912: STEP; FETCH(0x85, 0xD914); operand = 0x0063; ZP; STA; 
+L_D914: STEP; FETCH(0xA5, 0xD916); operand = 0x0062; ZP; LDA(MEM); 
+L_D916: STEP; FETCH(0x65, 0xD918); operand = 0x006A; ZP; ADC(MEM); 
+L_D918: STEP; FETCH(0x85, 0xD91A); operand = 0x0062; ZP; STA; 
+L_D91A: STEP; FETCH(0x4C, 0xD91D); operand = 0xD936; ABSO; JMP; goto L_D936;
+L_D91D: STEP; FETCH(0x69, 0xD91F); operand = 0x0001; IMM; ADC(IMMV); 
+L_D91F: STEP; FETCH(0x06, 0xD921); operand = 0x0070; ZP; ASL; 
+L_D921: STEP; FETCH(0x26, 0xD923); operand = 0x0065; ZP; ROL; 
+L_D923: STEP; FETCH(0x26, 0xD925); operand = 0x0064; ZP; ROL; 
+L_D925: STEP; FETCH(0x26, 0xD927); operand = 0x0063; ZP; ROL; 
+L_D927: STEP; FETCH(0x26, 0xD929); operand = 0x0062; ZP; ROL; 
+L_D929: STEP; FETCH(0x10, 0xD92B); operand = 0x00F2; REL; BPL; if (pc != 0xD92B) goto L_D91D; 
+L_D92B: STEP; FETCH(0x38, 0xD92C); operand = 0x0000; IMP; SEC; 
+L_D92C: STEP; FETCH(0xE5, 0xD92E); operand = 0x0061; ZP; SBC(MEM); 
+L_D92E: STEP; FETCH(0xB0, 0xD930); operand = 0x00C7; REL; BCS; if (pc != 0xD930) goto L_D8F7; 
+L_D930: STEP; FETCH(0x49, 0xD932); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D932: STEP; FETCH(0x69, 0xD934); operand = 0x0001; IMM; ADC(IMMV); 
+L_D934: STEP; FETCH(0x85, 0xD936); operand = 0x0061; ZP; STA; 
+L_D936: STEP; FETCH(0x90, 0xD938); operand = 0x000E; REL; BCC; if (pc != 0xD938) goto L_D946; 
+L_D938: STEP; FETCH(0xE6, 0xD93A); operand = 0x0061; ZP; INC; 
+L_D93A: STEP; FETCH(0xF0, 0xD93C); operand = 0x0042; REL; BEQ; if (pc != 0xD93C) goto L_D97E; 
+L_D93C: STEP; FETCH(0x66, 0xD93E); operand = 0x0062; ZP; ROR; 
+L_D93E: STEP; FETCH(0x66, 0xD940); operand = 0x0063; ZP; ROR; 
+L_D940: STEP; FETCH(0x66, 0xD942); operand = 0x0064; ZP; ROR; 
+L_D942: STEP; FETCH(0x66, 0xD944); operand = 0x0065; ZP; ROR; 
+L_D944: STEP; FETCH(0x66, 0xD946); operand = 0x0070; ZP; ROR; 
+L_D946: STEP; FETCH(0x60, 0xD947); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D947: STEP; FETCH(0xA5, 0xD949); operand = 0x0066; ZP; LDA(MEM); 
+L_D949: STEP; FETCH(0x49, 0xD94B); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D94B: STEP; FETCH(0x85, 0xD94D); operand = 0x0066; ZP; STA; 
+L_D94D: STEP; FETCH(0xA5, 0xD94F); operand = 0x0062; ZP; LDA(MEM); 
+L_D94F: STEP; FETCH(0x49, 0xD951); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D951: STEP; FETCH(0x85, 0xD953); operand = 0x0062; ZP; STA; 
+L_D953: STEP; FETCH(0xA5, 0xD955); operand = 0x0063; ZP; LDA(MEM); 
+L_D955: STEP; FETCH(0x49, 0xD957); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D957: STEP; FETCH(0x85, 0xD959); operand = 0x0063; ZP; STA; 
+L_D959: STEP; FETCH(0xA5, 0xD95B); operand = 0x0064; ZP; LDA(MEM); 
+L_D95B: STEP; FETCH(0x49, 0xD95D); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D95D: STEP; FETCH(0x85, 0xD95F); operand = 0x0064; ZP; STA; 
+L_D95F: STEP; FETCH(0xA5, 0xD961); operand = 0x0065; ZP; LDA(MEM); 
+L_D961: STEP; FETCH(0x49, 0xD963); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D963: STEP; FETCH(0x85, 0xD965); operand = 0x0065; ZP; STA; 
+L_D965: STEP; FETCH(0xA5, 0xD967); operand = 0x0070; ZP; LDA(MEM); 
+L_D967: STEP; FETCH(0x49, 0xD969); operand = 0x00FF; IMM; EOR(IMMV); 
+L_D969: STEP; FETCH(0x85, 0xD96B); operand = 0x0070; ZP; STA; 
+L_D96B: STEP; FETCH(0xE6, 0xD96D); operand = 0x0070; ZP; INC; 
+L_D96D: STEP; FETCH(0xD0, 0xD96F); operand = 0x000E; REL; BNE; if (pc != 0xD96F) goto L_D97D; 
+L_D96F: STEP; FETCH(0xE6, 0xD971); operand = 0x0065; ZP; INC; 
+L_D971: STEP; FETCH(0xD0, 0xD973); operand = 0x000A; REL; BNE; if (pc != 0xD973) goto L_D97D; 
+L_D973: STEP; FETCH(0xE6, 0xD975); operand = 0x0064; ZP; INC; 
+L_D975: STEP; FETCH(0xD0, 0xD977); operand = 0x0006; REL; BNE; if (pc != 0xD977) goto L_D97D; 
+L_D977: STEP; FETCH(0xE6, 0xD979); operand = 0x0063; ZP; INC; 
+L_D979: STEP; FETCH(0xD0, 0xD97B); operand = 0x0002; REL; BNE; if (pc != 0xD97B) goto L_D97D; 
+L_D97B: STEP; FETCH(0xE6, 0xD97D); operand = 0x0062; ZP; INC; 
+L_D97D: STEP; FETCH(0x60, 0xD97E); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D97E: STEP; FETCH(0xA2, 0xD980); operand = 0x000F; IMM; LDX(IMMV); 
+L_D980: STEP; FETCH(0x4C, 0xD983); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_D983: STEP; FETCH(0xA2, 0xD985); operand = 0x0025; IMM; LDX(IMMV); 
+L_D985: STEP; FETCH(0xB4, 0xD987); operand = 0x0004; ZPX; LDY(MEM); 
+L_D987: STEP; FETCH(0x84, 0xD989); operand = 0x0070; ZP; STY; 
+L_D989: STEP; FETCH(0xB4, 0xD98B); operand = 0x0003; ZPX; LDY(MEM); 
+L_D98B: STEP; FETCH(0x94, 0xD98D); operand = 0x0004; ZPX; STY; 
+L_D98D: STEP; FETCH(0xB4, 0xD98F); operand = 0x0002; ZPX; LDY(MEM); 
+L_D98F: STEP; FETCH(0x94, 0xD991); operand = 0x0003; ZPX; STY; 
+L_D991: STEP; FETCH(0xB4, 0xD993); operand = 0x0001; ZPX; LDY(MEM); 
+L_D993: STEP; FETCH(0x94, 0xD995); operand = 0x0002; ZPX; STY; 
+L_D995: STEP; FETCH(0xA4, 0xD997); operand = 0x0068; ZP; LDY(MEM); 
+L_D997: STEP; FETCH(0x94, 0xD999); operand = 0x0001; ZPX; STY; 
+L_D999: STEP; FETCH(0x69, 0xD99B); operand = 0x0008; IMM; ADC(IMMV); 
+L_D99B: STEP; FETCH(0x30, 0xD99D); operand = 0x00E8; REL; BMI; if (pc != 0xD99D) goto L_D985; 
+L_D99D: STEP; FETCH(0xF0, 0xD99F); operand = 0x00E6; REL; BEQ; if (pc != 0xD99F) goto L_D985; 
+L_D99F: STEP; FETCH(0xE9, 0xD9A1); operand = 0x0008; IMM; SBC(IMMV); 
+L_D9A1: STEP; FETCH(0xA8, 0xD9A2); operand = 0x0000; IMP; TAY; 
+L_D9A2: STEP; FETCH(0xA5, 0xD9A4); operand = 0x0070; ZP; LDA(MEM); 
+L_D9A4: STEP; FETCH(0xB0, 0xD9A6); operand = 0x0014; REL; BCS; if (pc != 0xD9A6) goto L_D9BA; 
+L_D9A6: STEP; FETCH(0x16, 0xD9A8); operand = 0x0001; ZPX; ASL; 
+L_D9A8: STEP; FETCH(0x90, 0xD9AA); operand = 0x0002; REL; BCC; if (pc != 0xD9AA) goto L_D9AC; 
+L_D9AA: STEP; FETCH(0xF6, 0xD9AC); operand = 0x0001; ZPX; INC; 
+L_D9AC: STEP; FETCH(0x76, 0xD9AE); operand = 0x0001; ZPX; ROR; 
+L_D9AE: STEP; FETCH(0x76, 0xD9B0); operand = 0x0001; ZPX; ROR; 
+L_D9B0: STEP; FETCH(0x76, 0xD9B2); operand = 0x0002; ZPX; ROR; 
+L_D9B2: STEP; FETCH(0x76, 0xD9B4); operand = 0x0003; ZPX; ROR; 
+L_D9B4: STEP; FETCH(0x76, 0xD9B6); operand = 0x0004; ZPX; ROR; 
+L_D9B6: STEP; FETCH(0x6A, 0xD9B7); operand = 0x0000; ACC; ROR_A; 
+L_D9B7: STEP; FETCH(0xC8, 0xD9B8); operand = 0x0000; IMP; INY; 
+L_D9B8: STEP; FETCH(0xD0, 0xD9BA); operand = 0x00EC; REL; BNE; if (pc != 0xD9BA) goto L_D9A6; 
+L_D9BA: STEP; FETCH(0x18, 0xD9BB); operand = 0x0000; IMP; CLC; 
+L_D9BB: STEP; FETCH(0x60, 0xD9BC); operand = 0x0000; IMP; RTS; goto dispatch;
+L_D9EA: STEP; FETCH(0x20, 0xD9ED); operand = 0xDC2B; ABSO; JSR; goto L_DC2B;
+L_D9ED: STEP; FETCH(0xF0, 0xD9EF); operand = 0x0002; REL; BEQ; if (pc != 0xD9EF) goto L_D9F1; 
+L_D9EF: STEP; FETCH(0x10, 0xD9F1); operand = 0x0003; REL; BPL; if (pc != 0xD9F1) goto L_D9F4; 
+L_D9F1: STEP; FETCH(0x4C, 0xD9F4); operand = 0xD248; ABSO; JMP; goto L_D248;
+L_D9F4: STEP; FETCH(0xA5, 0xD9F6); operand = 0x0061; ZP; LDA(MEM); 
+L_D9F6: STEP; FETCH(0xE9, 0xD9F8); operand = 0x007F; IMM; SBC(IMMV); 
+L_D9F8: STEP; FETCH(0x48, 0xD9F9); operand = 0x0000; IMP; PHA; 
+L_D9F9: STEP; FETCH(0xA9, 0xD9FB); operand = 0x0080; IMM; LDA(IMMV); 
+L_D9FB: STEP; FETCH(0x85, 0xD9FD); operand = 0x0061; ZP; STA; 
+L_D9FD: STEP; FETCH(0xA9, 0xD9FF); operand = 0x00D6; IMM; LDA(IMMV); 
+L_D9FF: STEP; FETCH(0xA0, 0xDA01); operand = 0x00D9; IMM; LDY(IMMV); 
+L_DA01: STEP; FETCH(0x20, 0xDA04); operand = 0xD867; ABSO; JSR; goto L_D867;
+L_DA04: STEP; FETCH(0xA9, 0xDA06); operand = 0x00DB; IMM; LDA(IMMV); 
+L_DA06: STEP; FETCH(0xA0, 0xDA08); operand = 0x00D9; IMM; LDY(IMMV); 
+L_DA08: STEP; FETCH(0x20, 0xDA0B); operand = 0xDB0F; ABSO; JSR; goto L_DB0F;
+L_DA0B: STEP; FETCH(0xA9, 0xDA0D); operand = 0x00BC; IMM; LDA(IMMV); 
+L_DA0D: STEP; FETCH(0xA0, 0xDA0F); operand = 0x00D9; IMM; LDY(IMMV); 
+L_DA0F: STEP; FETCH(0x20, 0xDA12); operand = 0xD850; ABSO; JSR; goto L_D850;
+L_DA12: STEP; FETCH(0xA9, 0xDA14); operand = 0x00C1; IMM; LDA(IMMV); 
+L_DA14: STEP; FETCH(0xA0, 0xDA16); operand = 0x00D9; IMM; LDY(IMMV); 
+L_DA16: STEP; FETCH(0x20, 0xDA19); operand = 0xE040; ABSO; JSR; goto L_E040;
+L_DA19: STEP; FETCH(0xA9, 0xDA1B); operand = 0x00E0; IMM; LDA(IMMV); 
+L_DA1B: STEP; FETCH(0xA0, 0xDA1D); operand = 0x00D9; IMM; LDY(IMMV); 
+L_DA1D: STEP; FETCH(0x20, 0xDA20); operand = 0xD867; ABSO; JSR; goto L_D867;
+L_DA20: STEP; FETCH(0x68, 0xDA21); operand = 0x0000; IMP; PLA; 
+L_DA21: STEP; FETCH(0x20, 0xDA24); operand = 0xDD7E; ABSO; JSR; goto L_DD7E;
+L_DA24: STEP; FETCH(0xA9, 0xDA26); operand = 0x00E5; IMM; LDA(IMMV); 
+L_DA26: STEP; FETCH(0xA0, 0xDA28); operand = 0x00D9; IMM; LDY(IMMV); 
+L_DA28: STEP; FETCH(0x20, 0xDA2B); operand = 0xDA8C; ABSO; JSR; goto L_DA8C;
+L_DA2B: STEP; FETCH(0xD0, 0xDA2D); operand = 0x0003; REL; BNE; if (pc != 0xDA2D) goto L_DA30; 
+L_DA2D: STEP; FETCH(0x4C, 0xDA30); operand = 0xDA8B; ABSO; JMP; goto L_DA8B;
+L_DA30: STEP; FETCH(0x20, 0xDA33); operand = 0xDAB7; ABSO; JSR; goto L_DAB7;
+L_DA33: STEP; FETCH(0xA9, 0xDA35); operand = 0x0000; IMM; LDA(IMMV); 
+L_DA35: STEP; FETCH(0x85, 0xDA37); operand = 0x0026; ZP; STA; 
+L_DA37: STEP; FETCH(0x85, 0xDA39); operand = 0x0027; ZP; STA; 
+L_DA39: STEP; FETCH(0x85, 0xDA3B); operand = 0x0028; ZP; STA; 
+L_DA3B: STEP; FETCH(0x85, 0xDA3D); operand = 0x0029; ZP; STA; 
+L_DA3D: STEP; FETCH(0xA5, 0xDA3F); operand = 0x0070; ZP; LDA(MEM); 
+L_DA3F: STEP; FETCH(0x20, 0xDA42); operand = 0xDA59; ABSO; JSR; goto L_DA59;
+L_DA42: STEP; FETCH(0xA5, 0xDA44); operand = 0x0065; ZP; LDA(MEM); 
+L_DA44: STEP; FETCH(0x20, 0xDA47); operand = 0xDA59; ABSO; JSR; goto L_DA59;
+L_DA47: STEP; FETCH(0xA5, 0xDA49); operand = 0x0064; ZP; LDA(MEM); 
+L_DA49: STEP; FETCH(0x20, 0xDA4C); operand = 0xDA59; ABSO; JSR; goto L_DA59;
+L_DA4C: STEP; FETCH(0xA5, 0xDA4E); operand = 0x0063; ZP; LDA(MEM); 
+L_DA4E: STEP; FETCH(0x20, 0xDA51); operand = 0xDA59; ABSO; JSR; goto L_DA59;
+L_DA51: STEP; FETCH(0xA5, 0xDA53); operand = 0x0062; ZP; LDA(MEM); 
+L_DA53: STEP; FETCH(0x20, 0xDA56); operand = 0xDA5E; ABSO; JSR; goto L_DA5E;
+L_DA56: STEP; FETCH(0x4C, 0xDA59); operand = 0xDB8F; ABSO; JMP; goto L_DB8F;
+L_DA59: STEP; FETCH(0xD0, 0xDA5B); operand = 0x0003; REL; BNE; if (pc != 0xDA5B) goto L_DA5E; 
+L_DA5B: STEP; FETCH(0x4C, 0xDA5E); operand = 0xD983; ABSO; JMP; goto L_D983;
+L_DA5E: STEP; FETCH(0x4A, 0xDA5F); operand = 0x0000; ACC; LSR_A; 
+L_DA5F: STEP; FETCH(0x09, 0xDA61); operand = 0x0080; IMM; ORA(IMMV); 
+L_DA61: STEP; FETCH(0xA8, 0xDA62); operand = 0x0000; IMP; TAY; 
+L_DA62: STEP; FETCH(0x90, 0xDA64); operand = 0x0019; REL; BCC; if (pc != 0xDA64) goto L_DA7D; 
+L_DA64: STEP; FETCH(0x18, 0xDA65); operand = 0x0000; IMP; CLC; 
+L_DA65: STEP; FETCH(0xA5, 0xDA67); operand = 0x0029; ZP; LDA(MEM); 
+L_DA67: STEP; FETCH(0x65, 0xDA69); operand = 0x006D; ZP; ADC(MEM); 
+L_DA69: STEP; FETCH(0x85, 0xDA6B); operand = 0x0029; ZP; STA; 
+L_DA6B: STEP; FETCH(0xA5, 0xDA6D); operand = 0x0028; ZP; LDA(MEM); 
+L_DA6D: STEP; FETCH(0x65, 0xDA6F); operand = 0x006C; ZP; ADC(MEM); 
+L_DA6F: STEP; FETCH(0x85, 0xDA71); operand = 0x0028; ZP; STA; 
+L_DA71: STEP; FETCH(0xA5, 0xDA73); operand = 0x0027; ZP; LDA(MEM); 
+L_DA73: STEP; FETCH(0x65, 0xDA75); operand = 0x006B; ZP; ADC(MEM); 
+L_DA75: STEP; FETCH(0x85, 0xDA77); operand = 0x0027; ZP; STA; 
+L_DA77: STEP; FETCH(0xA5, 0xDA79); operand = 0x0026; ZP; LDA(MEM); 
+L_DA79: STEP; FETCH(0x65, 0xDA7B); operand = 0x006A; ZP; ADC(MEM); 
+L_DA7B: STEP; FETCH(0x85, 0xDA7D); operand = 0x0026; ZP; STA; 
+L_DA7D: STEP; FETCH(0x66, 0xDA7F); operand = 0x0026; ZP; ROR; 
+L_DA7F: STEP; FETCH(0x66, 0xDA81); operand = 0x0027; ZP; ROR; 
+L_DA81: STEP; FETCH(0x66, 0xDA83); operand = 0x0028; ZP; ROR; 
+L_DA83: STEP; FETCH(0x66, 0xDA85); operand = 0x0029; ZP; ROR; 
+L_DA85: STEP; FETCH(0x66, 0xDA87); operand = 0x0070; ZP; ROR; 
+L_DA87: STEP; FETCH(0x98, 0xDA88); operand = 0x0000; IMP; TYA; 
+L_DA88: STEP; FETCH(0x4A, 0xDA89); operand = 0x0000; ACC; LSR_A; 
+L_DA89: STEP; FETCH(0xD0, 0xDA8B); operand = 0x00D6; REL; BNE; if (pc != 0xDA8B) goto L_DA61; 
+L_DA8B: STEP; FETCH(0x60, 0xDA8C); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DA8C: STEP; FETCH(0x85, 0xDA8E); operand = 0x0022; ZP; STA; 
+L_DA8E: STEP; FETCH(0x84, 0xDA90); operand = 0x0023; ZP; STY; 
+L_DA90: STEP; FETCH(0xA0, 0xDA92); operand = 0x0004; IMM; LDY(IMMV); 
+L_DA92: STEP; FETCH(0xB1, 0xDA94); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DA94: STEP; FETCH(0x85, 0xDA96); operand = 0x006D; ZP; STA; 
+L_DA96: STEP; FETCH(0x88, 0xDA97); operand = 0x0000; IMP; DEY; 
+L_DA97: STEP; FETCH(0xB1, 0xDA99); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DA99: STEP; FETCH(0x85, 0xDA9B); operand = 0x006C; ZP; STA; 
+L_DA9B: STEP; FETCH(0x88, 0xDA9C); operand = 0x0000; IMP; DEY; 
+L_DA9C: STEP; FETCH(0xB1, 0xDA9E); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DA9E: STEP; FETCH(0x85, 0xDAA0); operand = 0x006B; ZP; STA; 
+L_DAA0: STEP; FETCH(0x88, 0xDAA1); operand = 0x0000; IMP; DEY; 
+L_DAA1: STEP; FETCH(0xB1, 0xDAA3); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DAA3: STEP; FETCH(0x85, 0xDAA5); operand = 0x006E; ZP; STA; 
+L_DAA5: STEP; FETCH(0x45, 0xDAA7); operand = 0x0066; ZP; EOR(MEM); 
+L_DAA7: STEP; FETCH(0x85, 0xDAA9); operand = 0x006F; ZP; STA; 
+L_DAA9: STEP; FETCH(0xA5, 0xDAAB); operand = 0x006E; ZP; LDA(MEM); 
+L_DAAB: STEP; FETCH(0x09, 0xDAAD); operand = 0x0080; IMM; ORA(IMMV); 
+L_DAAD: STEP; FETCH(0x85, 0xDAAF); operand = 0x006A; ZP; STA; 
+L_DAAF: STEP; FETCH(0x88, 0xDAB0); operand = 0x0000; IMP; DEY; 
+L_DAB0: STEP; FETCH(0xB1, 0xDAB2); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DAB2: STEP; FETCH(0x85, 0xDAB4); operand = 0x0069; ZP; STA; 
+L_DAB4: STEP; FETCH(0xA5, 0xDAB6); operand = 0x0061; ZP; LDA(MEM); 
+L_DAB6: STEP; FETCH(0x60, 0xDAB7); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DAB7: STEP; FETCH(0xA5, 0xDAB9); operand = 0x0069; ZP; LDA(MEM); 
+L_DAB9: STEP; FETCH(0xF0, 0xDABB); operand = 0x001F; REL; BEQ; if (pc != 0xDABB) goto L_DADA; 
+L_DABB: STEP; FETCH(0x18, 0xDABC); operand = 0x0000; IMP; CLC; 
+L_DABC: STEP; FETCH(0x65, 0xDABE); operand = 0x0061; ZP; ADC(MEM); 
+L_DABE: STEP; FETCH(0x90, 0xDAC0); operand = 0x0004; REL; BCC; if (pc != 0xDAC0) goto L_DAC4; 
+L_DAC0: STEP; FETCH(0x30, 0xDAC2); operand = 0x001D; REL; BMI; if (pc != 0xDAC2) goto L_DADF; 
+L_DAC2: STEP; FETCH(0x18, 0xDAC3); operand = 0x0000; IMP; CLC; 
+L_DAC3: STEP; FETCH(0x2C, 0xDAC6); operand = 0x1410; ABSO; BIT(MEM); goto L_DAC6;
+L_DAC4: STEP; FETCH(0x10, 0xDAC6); operand = 0x0014; REL; BPL; if (pc != 0xDAC6) goto L_DADA; 
+L_DAC6: STEP; FETCH(0x69, 0xDAC8); operand = 0x0080; IMM; ADC(IMMV); 
+L_DAC8: STEP; FETCH(0x85, 0xDACA); operand = 0x0061; ZP; STA; 
+L_DACA: STEP; FETCH(0xD0, 0xDACC); operand = 0x0003; REL; BNE; if (pc != 0xDACC) goto L_DACF; 
+L_DACC: STEP; FETCH(0x4C, 0xDACF); operand = 0xD8FB; ABSO; JMP; goto L_D8FB;
+L_DACF: STEP; FETCH(0xA5, 0xDAD1); operand = 0x006F; ZP; LDA(MEM); 
+L_DAD1: STEP; FETCH(0x85, 0xDAD3); operand = 0x0066; ZP; STA; 
+L_DAD3: STEP; FETCH(0x60, 0xDAD4); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DAD4: STEP; FETCH(0xA5, 0xDAD6); operand = 0x0066; ZP; LDA(MEM); 
+L_DAD6: STEP; FETCH(0x49, 0xDAD8); operand = 0x00FF; IMM; EOR(IMMV); 
+L_DAD8: STEP; FETCH(0x30, 0xDADA); operand = 0x0005; REL; BMI; if (pc != 0xDADA) goto L_DADF; 
+L_DADA: STEP; FETCH(0x68, 0xDADB); operand = 0x0000; IMP; PLA; 
+L_DADB: STEP; FETCH(0x68, 0xDADC); operand = 0x0000; IMP; PLA; 
+L_DADC: STEP; FETCH(0x4C, 0xDADF); operand = 0xD8F7; ABSO; JMP; goto L_D8F7;
+L_DADF: STEP; FETCH(0x4C, 0xDAE2); operand = 0xD97E; ABSO; JMP; goto L_D97E;
+L_DAE2: STEP; FETCH(0x20, 0xDAE5); operand = 0xDC0C; ABSO; JSR; goto L_DC0C;
+L_DAE5: STEP; FETCH(0xAA, 0xDAE6); operand = 0x0000; IMP; TAX; 
+L_DAE6: STEP; FETCH(0xF0, 0xDAE8); operand = 0x0010; REL; BEQ; if (pc != 0xDAE8) goto L_DAF8; 
+L_DAE8: STEP; FETCH(0x18, 0xDAE9); operand = 0x0000; IMP; CLC; 
+L_DAE9: STEP; FETCH(0x69, 0xDAEB); operand = 0x0002; IMM; ADC(IMMV); 
+L_DAEB: STEP; FETCH(0xB0, 0xDAED); operand = 0x00F2; REL; BCS; if (pc != 0xDAED) goto L_DADF; 
+L_DAED: STEP; FETCH(0xA2, 0xDAEF); operand = 0x0000; IMM; LDX(IMMV); 
+L_DAEF: STEP; FETCH(0x86, 0xDAF1); operand = 0x006F; ZP; STX; 
+L_DAF1: STEP; FETCH(0x20, 0xDAF4); operand = 0xD877; ABSO; JSR; goto L_D877;
+L_DAF4: STEP; FETCH(0xE6, 0xDAF6); operand = 0x0061; ZP; INC; 
+L_DAF6: STEP; FETCH(0xF0, 0xDAF8); operand = 0x00E7; REL; BEQ; if (pc != 0xDAF8) goto L_DADF; 
+L_DAF8: STEP; FETCH(0x60, 0xDAF9); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DAFE: STEP; FETCH(0x20, 0xDB01); operand = 0xDC0C; ABSO; JSR; goto L_DC0C;
+L_DB01: STEP; FETCH(0xA9, 0xDB03); operand = 0x00F9; IMM; LDA(IMMV); 
+L_DB03: STEP; FETCH(0xA0, 0xDB05); operand = 0x00DA; IMM; LDY(IMMV); 
+L_DB05: STEP; FETCH(0xA2, 0xDB07); operand = 0x0000; IMM; LDX(IMMV); 
+L_DB07: STEP; FETCH(0x86, 0xDB09); operand = 0x006F; ZP; STX; 
+L_DB09: STEP; FETCH(0x20, 0xDB0C); operand = 0xDBA2; ABSO; JSR; goto L_DBA2;
+L_DB0C: STEP; FETCH(0x4C, 0xDB0F); operand = 0xDB12; ABSO; JMP; goto L_DB12;
+L_DB0F: STEP; FETCH(0x20, 0xDB12); operand = 0xDA8C; ABSO; JSR; goto L_DA8C;
+L_DB12: STEP; FETCH(0xF0, 0xDB14); operand = 0x0076; REL; BEQ; if (pc != 0xDB14) goto L_DB8A; 
+L_DB14: STEP; FETCH(0x20, 0xDB17); operand = 0xDC1B; ABSO; JSR; goto L_DC1B;
+L_DB17: STEP; FETCH(0xA9, 0xDB19); operand = 0x0000; IMM; LDA(IMMV); 
+L_DB19: STEP; FETCH(0x38, 0xDB1A); operand = 0x0000; IMP; SEC; 
+L_DB1A: STEP; FETCH(0xE5, 0xDB1C); operand = 0x0061; ZP; SBC(MEM); 
+L_DB1C: STEP; FETCH(0x85, 0xDB1E); operand = 0x0061; ZP; STA; 
+L_DB1E: STEP; FETCH(0x20, 0xDB21); operand = 0xDAB7; ABSO; JSR; goto L_DAB7;
+L_DB21: STEP; FETCH(0xE6, 0xDB23); operand = 0x0061; ZP; INC; 
+L_DB23: STEP; FETCH(0xF0, 0xDB25); operand = 0x00BA; REL; BEQ; if (pc != 0xDB25) goto L_DADF; 
+L_DB25: STEP; FETCH(0xA2, 0xDB27); operand = 0x00FC; IMM; LDX(IMMV); 
+L_DB27: STEP; FETCH(0xA9, 0xDB29); operand = 0x0001; IMM; LDA(IMMV); 
+L_DB29: STEP; FETCH(0xA4, 0xDB2B); operand = 0x006A; ZP; LDY(MEM); 
+L_DB2B: STEP; FETCH(0xC4, 0xDB2D); operand = 0x0062; ZP; CPY(MEM); 
+L_DB2D: STEP; FETCH(0xD0, 0xDB2F); operand = 0x0010; REL; BNE; if (pc != 0xDB2F) goto L_DB3F; 
+L_DB2F: STEP; FETCH(0xA4, 0xDB31); operand = 0x006B; ZP; LDY(MEM); 
+L_DB31: STEP; FETCH(0xC4, 0xDB33); operand = 0x0063; ZP; CPY(MEM); 
+L_DB33: STEP; FETCH(0xD0, 0xDB35); operand = 0x000A; REL; BNE; if (pc != 0xDB35) goto L_DB3F; 
+L_DB35: STEP; FETCH(0xA4, 0xDB37); operand = 0x006C; ZP; LDY(MEM); 
+L_DB37: STEP; FETCH(0xC4, 0xDB39); operand = 0x0064; ZP; CPY(MEM); 
+L_DB39: STEP; FETCH(0xD0, 0xDB3B); operand = 0x0004; REL; BNE; if (pc != 0xDB3B) goto L_DB3F; 
+L_DB3B: STEP; FETCH(0xA4, 0xDB3D); operand = 0x006D; ZP; LDY(MEM); 
+L_DB3D: STEP; FETCH(0xC4, 0xDB3F); operand = 0x0065; ZP; CPY(MEM); 
+L_DB3F: STEP; FETCH(0x08, 0xDB40); operand = 0x0000; IMP; PHP; 
+L_DB40: STEP; FETCH(0x2A, 0xDB41); operand = 0x0000; ACC; ROL_A; 
+L_DB41: STEP; FETCH(0x90, 0xDB43); operand = 0x0009; REL; BCC; if (pc != 0xDB43) goto L_DB4C; 
+L_DB43: STEP; FETCH(0xE8, 0xDB44); operand = 0x0000; IMP; INX; 
+L_DB44: STEP; FETCH(0x95, 0xDB46); operand = 0x0029; ZPX; STA; 
+L_DB46: STEP; FETCH(0xF0, 0xDB48); operand = 0x0032; REL; BEQ; if (pc != 0xDB48) goto L_DB7A; 
+L_DB48: STEP; FETCH(0x10, 0xDB4A); operand = 0x0034; REL; BPL; if (pc != 0xDB4A) goto L_DB7E; 
+L_DB4A: STEP; FETCH(0xA9, 0xDB4C); operand = 0x0001; IMM; LDA(IMMV); 
+L_DB4C: STEP; FETCH(0x28, 0xDB4D); operand = 0x0000; IMP; PLP; 
+L_DB4D: STEP; FETCH(0xB0, 0xDB4F); operand = 0x000E; REL; BCS; if (pc != 0xDB4F) goto L_DB5D; 
+L_DB4F: STEP; FETCH(0x06, 0xDB51); operand = 0x006D; ZP; ASL; 
+L_DB51: STEP; FETCH(0x26, 0xDB53); operand = 0x006C; ZP; ROL; 
+L_DB53: STEP; FETCH(0x26, 0xDB55); operand = 0x006B; ZP; ROL; 
+L_DB55: STEP; FETCH(0x26, 0xDB57); operand = 0x006A; ZP; ROL; 
+L_DB57: STEP; FETCH(0xB0, 0xDB59); operand = 0x00E6; REL; BCS; if (pc != 0xDB59) goto L_DB3F; 
+L_DB59: STEP; FETCH(0x30, 0xDB5B); operand = 0x00CE; REL; BMI; if (pc != 0xDB5B) goto L_DB29; 
+L_DB5B: STEP; FETCH(0x10, 0xDB5D); operand = 0x00E2; REL; BPL; if (pc != 0xDB5D) goto L_DB3F; 
+L_DB5D: STEP; FETCH(0xA8, 0xDB5E); operand = 0x0000; IMP; TAY; 
+L_DB5E: STEP; FETCH(0xA5, 0xDB60); operand = 0x006D; ZP; LDA(MEM); 
+L_DB60: STEP; FETCH(0xE5, 0xDB62); operand = 0x0065; ZP; SBC(MEM); 
+L_DB62: STEP; FETCH(0x85, 0xDB64); operand = 0x006D; ZP; STA; 
+L_DB64: STEP; FETCH(0xA5, 0xDB66); operand = 0x006C; ZP; LDA(MEM); 
+L_DB66: STEP; FETCH(0xE5, 0xDB68); operand = 0x0064; ZP; SBC(MEM); 
+L_DB68: STEP; FETCH(0x85, 0xDB6A); operand = 0x006C; ZP; STA; 
+L_DB6A: STEP; FETCH(0xA5, 0xDB6C); operand = 0x006B; ZP; LDA(MEM); 
+L_DB6C: STEP; FETCH(0xE5, 0xDB6E); operand = 0x0063; ZP; SBC(MEM); 
+L_DB6E: STEP; FETCH(0x85, 0xDB70); operand = 0x006B; ZP; STA; 
+L_DB70: STEP; FETCH(0xA5, 0xDB72); operand = 0x006A; ZP; LDA(MEM); 
+L_DB72: STEP; FETCH(0xE5, 0xDB74); operand = 0x0062; ZP; SBC(MEM); 
+L_DB74: STEP; FETCH(0x85, 0xDB76); operand = 0x006A; ZP; STA; 
+L_DB76: STEP; FETCH(0x98, 0xDB77); operand = 0x0000; IMP; TYA; 
+L_DB77: STEP; FETCH(0x4C, 0xDB7A); operand = 0xDB4F; ABSO; JMP; goto L_DB4F;
+L_DB7A: STEP; FETCH(0xA9, 0xDB7C); operand = 0x0040; IMM; LDA(IMMV); 
+L_DB7C: STEP; FETCH(0xD0, 0xDB7E); operand = 0x00CE; REL; BNE; if (pc != 0xDB7E) goto L_DB4C; 
+L_DB7E: STEP; FETCH(0x0A, 0xDB7F); operand = 0x0000; ACC; ASL_A; 
+L_DB7F: STEP; FETCH(0x0A, 0xDB80); operand = 0x0000; ACC; ASL_A; 
+L_DB80: STEP; FETCH(0x0A, 0xDB81); operand = 0x0000; ACC; ASL_A; 
+L_DB81: STEP; FETCH(0x0A, 0xDB82); operand = 0x0000; ACC; ASL_A; 
+L_DB82: STEP; FETCH(0x0A, 0xDB83); operand = 0x0000; ACC; ASL_A; 
+L_DB83: STEP; FETCH(0x0A, 0xDB84); operand = 0x0000; ACC; ASL_A; 
+L_DB84: STEP; FETCH(0x85, 0xDB86); operand = 0x0070; ZP; STA; 
+L_DB86: STEP; FETCH(0x28, 0xDB87); operand = 0x0000; IMP; PLP; 
+L_DB87: STEP; FETCH(0x4C, 0xDB8A); operand = 0xDB8F; ABSO; JMP; goto L_DB8F;
+L_DB8A: STEP; FETCH(0xA2, 0xDB8C); operand = 0x0014; IMM; LDX(IMMV); 
+L_DB8C: STEP; FETCH(0x4C, 0xDB8F); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_DB8F: STEP; FETCH(0xA5, 0xDB91); operand = 0x0026; ZP; LDA(MEM); 
+L_DB91: STEP; FETCH(0x85, 0xDB93); operand = 0x0062; ZP; STA; 
+L_DB93: STEP; FETCH(0xA5, 0xDB95); operand = 0x0027; ZP; LDA(MEM); 
+L_DB95: STEP; FETCH(0x85, 0xDB97); operand = 0x0063; ZP; STA; 
+L_DB97: STEP; FETCH(0xA5, 0xDB99); operand = 0x0028; ZP; LDA(MEM); 
+L_DB99: STEP; FETCH(0x85, 0xDB9B); operand = 0x0064; ZP; STA; 
+L_DB9B: STEP; FETCH(0xA5, 0xDB9D); operand = 0x0029; ZP; LDA(MEM); 
+L_DB9D: STEP; FETCH(0x85, 0xDB9F); operand = 0x0065; ZP; STA; 
+L_DB9F: STEP; FETCH(0x4C, 0xDBA2); operand = 0xD8D7; ABSO; JMP; goto L_D8D7;
+L_DBA2: STEP; FETCH(0x85, 0xDBA4); operand = 0x0022; ZP; STA; 
+L_DBA4: STEP; FETCH(0x84, 0xDBA6); operand = 0x0023; ZP; STY; 
+L_DBA6: STEP; FETCH(0xA0, 0xDBA8); operand = 0x0004; IMM; LDY(IMMV); 
+L_DBA8: STEP; FETCH(0xB1, 0xDBAA); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DBAA: STEP; FETCH(0x85, 0xDBAC); operand = 0x0065; ZP; STA; 
+L_DBAC: STEP; FETCH(0x88, 0xDBAD); operand = 0x0000; IMP; DEY; 
+L_DBAD: STEP; FETCH(0xB1, 0xDBAF); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DBAF: STEP; FETCH(0x85, 0xDBB1); operand = 0x0064; ZP; STA; 
+L_DBB1: STEP; FETCH(0x88, 0xDBB2); operand = 0x0000; IMP; DEY; 
+L_DBB2: STEP; FETCH(0xB1, 0xDBB4); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DBB4: STEP; FETCH(0x85, 0xDBB6); operand = 0x0063; ZP; STA; 
+L_DBB6: STEP; FETCH(0x88, 0xDBB7); operand = 0x0000; IMP; DEY; 
+L_DBB7: STEP; FETCH(0xB1, 0xDBB9); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DBB9: STEP; FETCH(0x85, 0xDBBB); operand = 0x0066; ZP; STA; 
+L_DBBB: STEP; FETCH(0x09, 0xDBBD); operand = 0x0080; IMM; ORA(IMMV); 
+L_DBBD: STEP; FETCH(0x85, 0xDBBF); operand = 0x0062; ZP; STA; 
+L_DBBF: STEP; FETCH(0x88, 0xDBC0); operand = 0x0000; IMP; DEY; 
+L_DBC0: STEP; FETCH(0xB1, 0xDBC2); operand = 0x0022; INDY(1); LDA(MEM); 
+L_DBC2: STEP; FETCH(0x85, 0xDBC4); operand = 0x0061; ZP; STA; 
+L_DBC4: STEP; FETCH(0x84, 0xDBC6); operand = 0x0070; ZP; STY; 
+L_DBC6: STEP; FETCH(0x60, 0xDBC7); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DBC7: STEP; FETCH(0xA2, 0xDBC9); operand = 0x005C; IMM; LDX(IMMV); 
+L_DBC9: STEP; FETCH(0x2C, 0xDBCC); operand = 0x57A2; ABSO; BIT(MEM); goto L_DBCC;
+L_DBCA: STEP; FETCH(0xA2, 0xDBCC); operand = 0x0057; IMM; LDX(IMMV); 
+L_DBCC: STEP; FETCH(0xA0, 0xDBCE); operand = 0x0000; IMM; LDY(IMMV); 
+L_DBCE: STEP; FETCH(0xF0, 0xDBD0); operand = 0x0004; REL; BEQ; if (pc != 0xDBD0) goto L_DBD4; 
+L_DBD0: STEP; FETCH(0xA6, 0xDBD2); operand = 0x0049; ZP; LDX(MEM); 
+L_DBD2: STEP; FETCH(0xA4, 0xDBD4); operand = 0x004A; ZP; LDY(MEM); 
+L_DBD4: STEP; FETCH(0x20, 0xDBD7); operand = 0xDC1B; ABSO; JSR; goto L_DC1B;
+L_DBD7: STEP; FETCH(0x86, 0xDBD9); operand = 0x0022; ZP; STX; 
+L_DBD9: STEP; FETCH(0x84, 0xDBDB); operand = 0x0023; ZP; STY; 
+L_DBDB: STEP; FETCH(0xA0, 0xDBDD); operand = 0x0004; IMM; LDY(IMMV); 
+L_DBDD: STEP; FETCH(0xA5, 0xDBDF); operand = 0x0065; ZP; LDA(MEM); 
+L_DBDF: STEP; FETCH(0x91, 0xDBE1); operand = 0x0022; INDY(0); STA; 
+L_DBE1: STEP; FETCH(0x88, 0xDBE2); operand = 0x0000; IMP; DEY; 
+L_DBE2: STEP; FETCH(0xA5, 0xDBE4); operand = 0x0064; ZP; LDA(MEM); 
+L_DBE4: STEP; FETCH(0x91, 0xDBE6); operand = 0x0022; INDY(0); STA; 
+L_DBE6: STEP; FETCH(0x88, 0xDBE7); operand = 0x0000; IMP; DEY; 
+L_DBE7: STEP; FETCH(0xA5, 0xDBE9); operand = 0x0063; ZP; LDA(MEM); 
+L_DBE9: STEP; FETCH(0x91, 0xDBEB); operand = 0x0022; INDY(0); STA; 
+L_DBEB: STEP; FETCH(0x88, 0xDBEC); operand = 0x0000; IMP; DEY; 
+L_DBEC: STEP; FETCH(0xA5, 0xDBEE); operand = 0x0066; ZP; LDA(MEM); 
+L_DBEE: STEP; FETCH(0x09, 0xDBF0); operand = 0x007F; IMM; ORA(IMMV); 
+L_DBF0: STEP; FETCH(0x25, 0xDBF2); operand = 0x0062; ZP; AND(MEM); 
+L_DBF2: STEP; FETCH(0x91, 0xDBF4); operand = 0x0022; INDY(0); STA; 
+L_DBF4: STEP; FETCH(0x88, 0xDBF5); operand = 0x0000; IMP; DEY; 
+L_DBF5: STEP; FETCH(0xA5, 0xDBF7); operand = 0x0061; ZP; LDA(MEM); 
+L_DBF7: STEP; FETCH(0x91, 0xDBF9); operand = 0x0022; INDY(0); STA; 
+L_DBF9: STEP; FETCH(0x84, 0xDBFB); operand = 0x0070; ZP; STY; 
+L_DBFB: STEP; FETCH(0x60, 0xDBFC); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DBFC: STEP; FETCH(0xA5, 0xDBFE); operand = 0x006E; ZP; LDA(MEM); 
+L_DBFE: STEP; FETCH(0x85, 0xDC00); operand = 0x0066; ZP; STA; 
+L_DC00: STEP; FETCH(0xA2, 0xDC02); operand = 0x0005; IMM; LDX(IMMV); 
+L_DC02: STEP; FETCH(0xB5, 0xDC04); operand = 0x0068; ZPX; LDA(MEM); 
+L_DC04: STEP; FETCH(0x95, 0xDC06); operand = 0x0060; ZPX; STA; 
+L_DC06: STEP; FETCH(0xCA, 0xDC07); operand = 0x0000; IMP; DEX; 
+L_DC07: STEP; FETCH(0xD0, 0xDC09); operand = 0x00F9; REL; BNE; if (pc != 0xDC09) goto L_DC02; 
+L_DC09: STEP; FETCH(0x86, 0xDC0B); operand = 0x0070; ZP; STX; 
+L_DC0B: STEP; FETCH(0x60, 0xDC0C); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DC0C: STEP; FETCH(0x20, 0xDC0F); operand = 0xDC1B; ABSO; JSR; goto L_DC1B;
+L_DC0F: STEP; FETCH(0xA2, 0xDC11); operand = 0x0006; IMM; LDX(IMMV); 
+L_DC11: STEP; FETCH(0xB5, 0xDC13); operand = 0x0060; ZPX; LDA(MEM); 
+L_DC13: STEP; FETCH(0x95, 0xDC15); operand = 0x0068; ZPX; STA; 
+L_DC15: STEP; FETCH(0xCA, 0xDC16); operand = 0x0000; IMP; DEX; 
+L_DC16: STEP; FETCH(0xD0, 0xDC18); operand = 0x00F9; REL; BNE; if (pc != 0xDC18) goto L_DC11; 
+L_DC18: STEP; FETCH(0x86, 0xDC1A); operand = 0x0070; ZP; STX; 
+L_DC1A: STEP; FETCH(0x60, 0xDC1B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DC1B: STEP; FETCH(0xA5, 0xDC1D); operand = 0x0061; ZP; LDA(MEM); 
+L_DC1D: STEP; FETCH(0xF0, 0xDC1F); operand = 0x00FB; REL; BEQ; if (pc != 0xDC1F) goto L_DC1A; 
+L_DC1F: STEP; FETCH(0x06, 0xDC21); operand = 0x0070; ZP; ASL; 
+L_DC21: STEP; FETCH(0x90, 0xDC23); operand = 0x00F7; REL; BCC; if (pc != 0xDC23) goto L_DC1A; 
+L_DC23: STEP; FETCH(0x20, 0xDC26); operand = 0xD96F; ABSO; JSR; goto L_D96F;
+L_DC26: STEP; FETCH(0xD0, 0xDC28); operand = 0x00F2; REL; BNE; if (pc != 0xDC28) goto L_DC1A; 
+L_DC28: STEP; FETCH(0x4C, 0xDC2B); operand = 0xD938; ABSO; JMP; goto L_D938;
+L_DC2B: STEP; FETCH(0xA5, 0xDC2D); operand = 0x0061; ZP; LDA(MEM); 
+L_DC2D: STEP; FETCH(0xF0, 0xDC2F); operand = 0x0009; REL; BEQ; if (pc != 0xDC2F) goto L_DC38; 
+L_DC2F: STEP; FETCH(0xA5, 0xDC31); operand = 0x0066; ZP; LDA(MEM); 
+L_DC31: STEP; FETCH(0x2A, 0xDC32); operand = 0x0000; ACC; ROL_A; 
+L_DC32: STEP; FETCH(0xA9, 0xDC34); operand = 0x00FF; IMM; LDA(IMMV); 
+L_DC34: STEP; FETCH(0xB0, 0xDC36); operand = 0x0002; REL; BCS; if (pc != 0xDC36) goto L_DC38; 
+L_DC36: STEP; FETCH(0xA9, 0xDC38); operand = 0x0001; IMM; LDA(IMMV); 
+L_DC38: STEP; FETCH(0x60, 0xDC39); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DC39: STEP; FETCH(0x20, 0xDC3C); operand = 0xDC2B; ABSO; JSR; goto L_DC2B;
+L_DC3C: STEP; FETCH(0x85, 0xDC3E); operand = 0x0062; ZP; STA; 
+L_DC3E: STEP; FETCH(0xA9, 0xDC40); operand = 0x0000; IMM; LDA(IMMV); 
+L_DC40: STEP; FETCH(0x85, 0xDC42); operand = 0x0063; ZP; STA; 
+L_DC42: STEP; FETCH(0xA2, 0xDC44); operand = 0x0088; IMM; LDX(IMMV); 
+L_DC44: STEP; FETCH(0xA5, 0xDC46); operand = 0x0062; ZP; LDA(MEM); 
+L_DC46: STEP; FETCH(0x49, 0xDC48); operand = 0x00FF; IMM; EOR(IMMV); 
+L_DC48: STEP; FETCH(0x2A, 0xDC49); operand = 0x0000; ACC; ROL_A; 
+L_DC49: STEP; FETCH(0xA9, 0xDC4B); operand = 0x0000; IMM; LDA(IMMV); 
+L_DC4B: STEP; FETCH(0x85, 0xDC4D); operand = 0x0065; ZP; STA; 
+L_DC4D: STEP; FETCH(0x85, 0xDC4F); operand = 0x0064; ZP; STA; 
+L_DC4F: STEP; FETCH(0x86, 0xDC51); operand = 0x0061; ZP; STX; 
+L_DC51: STEP; FETCH(0x85, 0xDC53); operand = 0x0070; ZP; STA; 
+L_DC53: STEP; FETCH(0x85, 0xDC55); operand = 0x0066; ZP; STA; 
+L_DC55: STEP; FETCH(0x4C, 0xDC58); operand = 0xD8D2; ABSO; JMP; goto L_D8D2;
+L_DC58: STEP; FETCH(0x46, 0xDC5A); operand = 0x0066; ZP; LSR; 
+L_DC5A: STEP; FETCH(0x60, 0xDC5B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DC5B: STEP; FETCH(0x85, 0xDC5D); operand = 0x0024; ZP; STA; 
+L_DC5D: STEP; FETCH(0x84, 0xDC5F); operand = 0x0025; ZP; STY; 
+L_DC5F: STEP; FETCH(0xA0, 0xDC61); operand = 0x0000; IMM; LDY(IMMV); 
+L_DC61: STEP; FETCH(0xB1, 0xDC63); operand = 0x0024; INDY(1); LDA(MEM); 
+L_DC63: STEP; FETCH(0xC8, 0xDC64); operand = 0x0000; IMP; INY; 
+L_DC64: STEP; FETCH(0xAA, 0xDC65); operand = 0x0000; IMP; TAX; 
+L_DC65: STEP; FETCH(0xF0, 0xDC67); operand = 0x00C4; REL; BEQ; if (pc != 0xDC67) goto L_DC2B; 
+L_DC67: STEP; FETCH(0xB1, 0xDC69); operand = 0x0024; INDY(1); LDA(MEM); 
+L_DC69: STEP; FETCH(0x45, 0xDC6B); operand = 0x0066; ZP; EOR(MEM); 
+L_DC6B: STEP; FETCH(0x30, 0xDC6D); operand = 0x00C2; REL; BMI; if (pc != 0xDC6D) goto L_DC2F; 
+L_DC6D: STEP; FETCH(0xE4, 0xDC6F); operand = 0x0061; ZP; CPX(MEM); 
+L_DC6F: STEP; FETCH(0xD0, 0xDC71); operand = 0x0021; REL; BNE; if (pc != 0xDC71) goto L_DC92; 
+L_DC71: STEP; FETCH(0xB1, 0xDC73); operand = 0x0024; INDY(1); LDA(MEM); 
+L_DC73: STEP; FETCH(0x09, 0xDC75); operand = 0x0080; IMM; ORA(IMMV); 
+L_DC75: STEP; FETCH(0xC5, 0xDC77); operand = 0x0062; ZP; CMP(MEM); 
+L_DC77: STEP; FETCH(0xD0, 0xDC79); operand = 0x0019; REL; BNE; if (pc != 0xDC79) goto L_DC92; 
+L_DC79: STEP; FETCH(0xC8, 0xDC7A); operand = 0x0000; IMP; INY; 
+L_DC7A: STEP; FETCH(0xB1, 0xDC7C); operand = 0x0024; INDY(1); LDA(MEM); 
+L_DC7C: STEP; FETCH(0xC5, 0xDC7E); operand = 0x0063; ZP; CMP(MEM); 
+L_DC7E: STEP; FETCH(0xD0, 0xDC80); operand = 0x0012; REL; BNE; if (pc != 0xDC80) goto L_DC92; 
+L_DC80: STEP; FETCH(0xC8, 0xDC81); operand = 0x0000; IMP; INY; 
+L_DC81: STEP; FETCH(0xB1, 0xDC83); operand = 0x0024; INDY(1); LDA(MEM); 
+L_DC83: STEP; FETCH(0xC5, 0xDC85); operand = 0x0064; ZP; CMP(MEM); 
+L_DC85: STEP; FETCH(0xD0, 0xDC87); operand = 0x000B; REL; BNE; if (pc != 0xDC87) goto L_DC92; 
+L_DC87: STEP; FETCH(0xC8, 0xDC88); operand = 0x0000; IMP; INY; 
+L_DC88: STEP; FETCH(0xA9, 0xDC8A); operand = 0x007F; IMM; LDA(IMMV); 
+L_DC8A: STEP; FETCH(0xC5, 0xDC8C); operand = 0x0070; ZP; CMP(MEM); 
+L_DC8C: STEP; FETCH(0xB1, 0xDC8E); operand = 0x0024; INDY(1); LDA(MEM); 
+L_DC8E: STEP; FETCH(0xE5, 0xDC90); operand = 0x0065; ZP; SBC(MEM); 
+L_DC90: STEP; FETCH(0xF0, 0xDC92); operand = 0x0028; REL; BEQ; if (pc != 0xDC92) goto L_DCBA; 
+L_DC92: STEP; FETCH(0xA5, 0xDC94); operand = 0x0066; ZP; LDA(MEM); 
+L_DC94: STEP; FETCH(0x90, 0xDC96); operand = 0x0002; REL; BCC; if (pc != 0xDC96) goto L_DC98; 
+L_DC96: STEP; FETCH(0x49, 0xDC98); operand = 0x00FF; IMM; EOR(IMMV); 
+L_DC98: STEP; FETCH(0x4C, 0xDC9B); operand = 0xDC31; ABSO; JMP; goto L_DC31;
+L_DC9B: STEP; FETCH(0xA5, 0xDC9D); operand = 0x0061; ZP; LDA(MEM); 
+L_DC9D: STEP; FETCH(0xF0, 0xDC9F); operand = 0x004A; REL; BEQ; if (pc != 0xDC9F) goto L_DCE9; 
+L_DC9F: STEP; FETCH(0x38, 0xDCA0); operand = 0x0000; IMP; SEC; 
+L_DCA0: STEP; FETCH(0xE9, 0xDCA2); operand = 0x00A0; IMM; SBC(IMMV); 
+L_DCA2: STEP; FETCH(0x24, 0xDCA4); operand = 0x0066; ZP; BIT(MEM); 
+L_DCA4: STEP; FETCH(0x10, 0xDCA6); operand = 0x0009; REL; BPL; if (pc != 0xDCA6) goto L_DCAF; 
+L_DCA6: STEP; FETCH(0xAA, 0xDCA7); operand = 0x0000; IMP; TAX; 
+L_DCA7: STEP; FETCH(0xA9, 0xDCA9); operand = 0x00FF; IMM; LDA(IMMV); 
+L_DCA9: STEP; FETCH(0x85, 0xDCAB); operand = 0x0068; ZP; STA; 
+L_DCAB: STEP; FETCH(0x20, 0xDCAE); operand = 0xD94D; ABSO; JSR; goto L_D94D;
+L_DCAE: STEP; FETCH(0x8A, 0xDCAF); operand = 0x0000; IMP; TXA; 
+L_DCAF: STEP; FETCH(0xA2, 0xDCB1); operand = 0x0061; IMM; LDX(IMMV); 
+L_DCB1: STEP; FETCH(0xC9, 0xDCB3); operand = 0x00F9; IMM; CMP(IMMV); 
+L_DCB3: STEP; FETCH(0x10, 0xDCB5); operand = 0x0006; REL; BPL; if (pc != 0xDCB5) goto L_DCBB; 
+L_DCB5: STEP; FETCH(0x20, 0xDCB8); operand = 0xD999; ABSO; JSR; goto L_D999;
+L_DCB8: STEP; FETCH(0x84, 0xDCBA); operand = 0x0068; ZP; STY; 
+L_DCBA: STEP; FETCH(0x60, 0xDCBB); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DCBB: STEP; FETCH(0xA8, 0xDCBC); operand = 0x0000; IMP; TAY; 
+L_DCBC: STEP; FETCH(0xA5, 0xDCBE); operand = 0x0066; ZP; LDA(MEM); 
+L_DCBE: STEP; FETCH(0x29, 0xDCC0); operand = 0x0080; IMM; AND(IMMV); 
+L_DCC0: STEP; FETCH(0x46, 0xDCC2); operand = 0x0062; ZP; LSR; 
+L_DCC2: STEP; FETCH(0x05, 0xDCC4); operand = 0x0062; ZP; ORA(MEM); 
+L_DCC4: STEP; FETCH(0x85, 0xDCC6); operand = 0x0062; ZP; STA; 
+L_DCC6: STEP; FETCH(0x20, 0xDCC9); operand = 0xD9B0; ABSO; JSR; goto L_D9B0;
+L_DCC9: STEP; FETCH(0x84, 0xDCCB); operand = 0x0068; ZP; STY; 
+L_DCCB: STEP; FETCH(0x60, 0xDCCC); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DCCC: STEP; FETCH(0xA5, 0xDCCE); operand = 0x0061; ZP; LDA(MEM); 
+L_DCCE: STEP; FETCH(0xC9, 0xDCD0); operand = 0x00A0; IMM; CMP(IMMV); 
+L_DCD0: STEP; FETCH(0xB0, 0xDCD2); operand = 0x0020; REL; BCS; if (pc != 0xDCD2) goto L_DCF2; 
+L_DCD2: STEP; FETCH(0x20, 0xDCD5); operand = 0xDC9B; ABSO; JSR; goto L_DC9B;
+L_DCD5: STEP; FETCH(0x84, 0xDCD7); operand = 0x0070; ZP; STY; 
+L_DCD7: STEP; FETCH(0xA5, 0xDCD9); operand = 0x0066; ZP; LDA(MEM); 
+L_DCD9: STEP; FETCH(0x84, 0xDCDB); operand = 0x0066; ZP; STY; 
+L_DCDB: STEP; FETCH(0x49, 0xDCDD); operand = 0x0080; IMM; EOR(IMMV); 
+L_DCDD: STEP; FETCH(0x2A, 0xDCDE); operand = 0x0000; ACC; ROL_A; 
+L_DCDE: STEP; FETCH(0xA9, 0xDCE0); operand = 0x00A0; IMM; LDA(IMMV); 
+L_DCE0: STEP; FETCH(0x85, 0xDCE2); operand = 0x0061; ZP; STA; 
+L_DCE2: STEP; FETCH(0xA5, 0xDCE4); operand = 0x0065; ZP; LDA(MEM); 
+L_DCE4: STEP; FETCH(0x85, 0xDCE6); operand = 0x0007; ZP; STA; 
+L_DCE6: STEP; FETCH(0x4C, 0xDCE9); operand = 0xD8D2; ABSO; JMP; goto L_D8D2;
+L_DCE9: STEP; FETCH(0x85, 0xDCEB); operand = 0x0062; ZP; STA; 
+L_DCEB: STEP; FETCH(0x85, 0xDCED); operand = 0x0063; ZP; STA; 
+L_DCED: STEP; FETCH(0x85, 0xDCEF); operand = 0x0064; ZP; STA; 
+L_DCEF: STEP; FETCH(0x85, 0xDCF1); operand = 0x0065; ZP; STA; 
+L_DCF1: STEP; FETCH(0xA8, 0xDCF2); operand = 0x0000; IMP; TAY; 
+L_DCF2: STEP; FETCH(0x60, 0xDCF3); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DCF3: STEP; FETCH(0xA0, 0xDCF5); operand = 0x0000; IMM; LDY(IMMV); 
+L_DCF5: STEP; FETCH(0xA2, 0xDCF7); operand = 0x000A; IMM; LDX(IMMV); 
+L_DCF7: STEP; FETCH(0x94, 0xDCF9); operand = 0x005D; ZPX; STY; 
+L_DCF9: STEP; FETCH(0xCA, 0xDCFA); operand = 0x0000; IMP; DEX; 
+L_DCFA: STEP; FETCH(0x10, 0xDCFC); operand = 0x00FB; REL; BPL; if (pc != 0xDCFC) goto L_DCF7; 
+L_DCFC: STEP; FETCH(0x90, 0xDCFE); operand = 0x000F; REL; BCC; if (pc != 0xDCFE) goto L_DD0D; 
+L_DCFE: STEP; FETCH(0xC9, 0xDD00); operand = 0x002D; IMM; CMP(IMMV); 
+L_DD00: STEP; FETCH(0xD0, 0xDD02); operand = 0x0004; REL; BNE; if (pc != 0xDD02) goto L_DD06; 
+L_DD02: STEP; FETCH(0x86, 0xDD04); operand = 0x0067; ZP; STX; 
+L_DD04: STEP; FETCH(0xF0, 0xDD06); operand = 0x0004; REL; BEQ; if (pc != 0xDD06) goto L_DD0A; 
+L_DD06: STEP; FETCH(0xC9, 0xDD08); operand = 0x002B; IMM; CMP(IMMV); 
+L_DD08: STEP; FETCH(0xD0, 0xDD0A); operand = 0x0005; REL; BNE; if (pc != 0xDD0A) goto L_DD0F; 
+L_DD0A: STEP; FETCH(0x20, 0xDD0D); operand = 0x0073; ABSO; JSR; goto out;
+L_DD0D: STEP; FETCH(0x90, 0xDD0F); operand = 0x005B; REL; BCC; if (pc != 0xDD0F) goto L_DD6A; 
+L_DD0F: STEP; FETCH(0xC9, 0xDD11); operand = 0x002E; IMM; CMP(IMMV); 
+L_DD11: STEP; FETCH(0xF0, 0xDD13); operand = 0x002E; REL; BEQ; if (pc != 0xDD13) goto L_DD41; 
+L_DD13: STEP; FETCH(0xC9, 0xDD15); operand = 0x0045; IMM; CMP(IMMV); 
+L_DD15: STEP; FETCH(0xD0, 0xDD17); operand = 0x0030; REL; BNE; if (pc != 0xDD17) goto L_DD47; 
+L_DD17: STEP; FETCH(0x20, 0xDD1A); operand = 0x0073; ABSO; JSR; goto out;
+L_DD1A: STEP; FETCH(0x90, 0xDD1C); operand = 0x0017; REL; BCC; if (pc != 0xDD1C) goto L_DD33; 
+L_DD1C: STEP; FETCH(0xC9, 0xDD1E); operand = 0x00AB; IMM; CMP(IMMV); 
+L_DD1E: STEP; FETCH(0xF0, 0xDD20); operand = 0x000E; REL; BEQ; if (pc != 0xDD20) goto L_DD2E; 
+L_DD20: STEP; FETCH(0xC9, 0xDD22); operand = 0x002D; IMM; CMP(IMMV); 
+L_DD22: STEP; FETCH(0xF0, 0xDD24); operand = 0x000A; REL; BEQ; if (pc != 0xDD24) goto L_DD2E; 
+L_DD24: STEP; FETCH(0xC9, 0xDD26); operand = 0x00AA; IMM; CMP(IMMV); 
+L_DD26: STEP; FETCH(0xF0, 0xDD28); operand = 0x0008; REL; BEQ; if (pc != 0xDD28) goto L_DD30; 
+L_DD28: STEP; FETCH(0xC9, 0xDD2A); operand = 0x002B; IMM; CMP(IMMV); 
+L_DD2A: STEP; FETCH(0xF0, 0xDD2C); operand = 0x0004; REL; BEQ; if (pc != 0xDD2C) goto L_DD30; 
+L_DD2C: STEP; FETCH(0xD0, 0xDD2E); operand = 0x0007; REL; BNE; if (pc != 0xDD2E) goto L_DD35; 
+L_DD2E: STEP; FETCH(0x66, 0xDD30); operand = 0x0060; ZP; ROR; 
+L_DD30: STEP; FETCH(0x20, 0xDD33); operand = 0x0073; ABSO; JSR; goto out;
+L_DD33: STEP; FETCH(0x90, 0xDD35); operand = 0x005C; REL; BCC; if (pc != 0xDD35) goto L_DD91; 
+L_DD35: STEP; FETCH(0x24, 0xDD37); operand = 0x0060; ZP; BIT(MEM); 
+L_DD37: STEP; FETCH(0x10, 0xDD39); operand = 0x000E; REL; BPL; if (pc != 0xDD39) goto L_DD47; 
+L_DD39: STEP; FETCH(0xA9, 0xDD3B); operand = 0x0000; IMM; LDA(IMMV); 
+L_DD3B: STEP; FETCH(0x38, 0xDD3C); operand = 0x0000; IMP; SEC; 
+L_DD3C: STEP; FETCH(0xE5, 0xDD3E); operand = 0x005E; ZP; SBC(MEM); 
+L_DD3E: STEP; FETCH(0x4C, 0xDD41); operand = 0xDD49; ABSO; JMP; goto L_DD49;
+L_DD41: STEP; FETCH(0x66, 0xDD43); operand = 0x005F; ZP; ROR; 
+L_DD43: STEP; FETCH(0x24, 0xDD45); operand = 0x005F; ZP; BIT(MEM); 
+L_DD45: STEP; FETCH(0x50, 0xDD47); operand = 0x00C3; REL; BVC; if (pc != 0xDD47) goto L_DD0A; 
+L_DD47: STEP; FETCH(0xA5, 0xDD49); operand = 0x005E; ZP; LDA(MEM); 
+L_DD49: STEP; FETCH(0x38, 0xDD4A); operand = 0x0000; IMP; SEC; 
+L_DD4A: STEP; FETCH(0xE5, 0xDD4C); operand = 0x005D; ZP; SBC(MEM); 
+L_DD4C: STEP; FETCH(0x85, 0xDD4E); operand = 0x005E; ZP; STA; 
+L_DD4E: STEP; FETCH(0xF0, 0xDD50); operand = 0x0012; REL; BEQ; if (pc != 0xDD50) goto L_DD62; 
+L_DD50: STEP; FETCH(0x10, 0xDD52); operand = 0x0009; REL; BPL; if (pc != 0xDD52) goto L_DD5B; 
+L_DD52: STEP; FETCH(0x20, 0xDD55); operand = 0xDAFE; ABSO; JSR; goto L_DAFE;
+L_DD55: STEP; FETCH(0xE6, 0xDD57); operand = 0x005E; ZP; INC; 
+L_DD57: STEP; FETCH(0xD0, 0xDD59); operand = 0x00F9; REL; BNE; if (pc != 0xDD59) goto L_DD52; 
+L_DD59: STEP; FETCH(0xF0, 0xDD5B); operand = 0x0007; REL; BEQ; if (pc != 0xDD5B) goto L_DD62; 
+L_DD5B: STEP; FETCH(0x20, 0xDD5E); operand = 0xDAE2; ABSO; JSR; goto L_DAE2;
+L_DD5E: STEP; FETCH(0xC6, 0xDD60); operand = 0x005E; ZP; DEC; 
+L_DD60: STEP; FETCH(0xD0, 0xDD62); operand = 0x00F9; REL; BNE; if (pc != 0xDD62) goto L_DD5B; 
+L_DD62: STEP; FETCH(0xA5, 0xDD64); operand = 0x0067; ZP; LDA(MEM); 
+L_DD64: STEP; FETCH(0x30, 0xDD66); operand = 0x0001; REL; BMI; if (pc != 0xDD66) goto L_DD67; 
+L_DD66: STEP; FETCH(0x60, 0xDD67); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DD67: STEP; FETCH(0x4C, 0xDD6A); operand = 0xDFB4; ABSO; JMP; goto L_DFB4;
+L_DD6A: STEP; FETCH(0x48, 0xDD6B); operand = 0x0000; IMP; PHA; 
+L_DD6B: STEP; FETCH(0x24, 0xDD6D); operand = 0x005F; ZP; BIT(MEM); 
+L_DD6D: STEP; FETCH(0x10, 0xDD6F); operand = 0x0002; REL; BPL; if (pc != 0xDD6F) goto L_DD71; 
+L_DD6F: STEP; FETCH(0xE6, 0xDD71); operand = 0x005D; ZP; INC; 
+L_DD71: STEP; FETCH(0x20, 0xDD74); operand = 0xDAE2; ABSO; JSR; goto L_DAE2;
+L_DD74: STEP; FETCH(0x68, 0xDD75); operand = 0x0000; IMP; PLA; 
+L_DD75: STEP; FETCH(0x38, 0xDD76); operand = 0x0000; IMP; SEC; 
+L_DD76: STEP; FETCH(0xE9, 0xDD78); operand = 0x0030; IMM; SBC(IMMV); 
+L_DD78: STEP; FETCH(0x20, 0xDD7B); operand = 0xDD7E; ABSO; JSR; goto L_DD7E;
+L_DD7B: STEP; FETCH(0x4C, 0xDD7E); operand = 0xDD0A; ABSO; JMP; goto L_DD0A;
+L_DD7E: STEP; FETCH(0x48, 0xDD7F); operand = 0x0000; IMP; PHA; 
+L_DD7F: STEP; FETCH(0x20, 0xDD82); operand = 0xDC0C; ABSO; JSR; goto L_DC0C;
+L_DD82: STEP; FETCH(0x68, 0xDD83); operand = 0x0000; IMP; PLA; 
+L_DD83: STEP; FETCH(0x20, 0xDD86); operand = 0xDC3C; ABSO; JSR; goto L_DC3C;
+L_DD86: STEP; FETCH(0xA5, 0xDD88); operand = 0x006E; ZP; LDA(MEM); 
+L_DD88: STEP; FETCH(0x45, 0xDD8A); operand = 0x0066; ZP; EOR(MEM); 
+L_DD8A: STEP; FETCH(0x85, 0xDD8C); operand = 0x006F; ZP; STA; 
+L_DD8C: STEP; FETCH(0xA6, 0xDD8E); operand = 0x0061; ZP; LDX(MEM); 
+L_DD8E: STEP; FETCH(0x4C, 0xDD91); operand = 0xD86A; ABSO; JMP; goto L_D86A;
+L_DD91: STEP; FETCH(0xA5, 0xDD93); operand = 0x005E; ZP; LDA(MEM); 
+L_DD93: STEP; FETCH(0xC9, 0xDD95); operand = 0x000A; IMM; CMP(IMMV); 
+L_DD95: STEP; FETCH(0x90, 0xDD97); operand = 0x0009; REL; BCC; if (pc != 0xDD97) goto L_DDA0; 
+L_DD97: STEP; FETCH(0xA9, 0xDD99); operand = 0x0064; IMM; LDA(IMMV); 
+L_DD99: STEP; FETCH(0x24, 0xDD9B); operand = 0x0060; ZP; BIT(MEM); 
+L_DD9B: STEP; FETCH(0x30, 0xDD9D); operand = 0x0011; REL; BMI; if (pc != 0xDD9D) goto L_DDAE; 
+L_DD9D: STEP; FETCH(0x4C, 0xDDA0); operand = 0xD97E; ABSO; JMP; goto L_D97E;
+L_DDA0: STEP; FETCH(0x0A, 0xDDA1); operand = 0x0000; ACC; ASL_A; 
+L_DDA1: STEP; FETCH(0x0A, 0xDDA2); operand = 0x0000; ACC; ASL_A; 
+L_DDA2: STEP; FETCH(0x18, 0xDDA3); operand = 0x0000; IMP; CLC; 
+L_DDA3: STEP; FETCH(0x65, 0xDDA5); operand = 0x005E; ZP; ADC(MEM); 
+L_DDA5: STEP; FETCH(0x0A, 0xDDA6); operand = 0x0000; ACC; ASL_A; 
+L_DDA6: STEP; FETCH(0x18, 0xDDA7); operand = 0x0000; IMP; CLC; 
+L_DDA7: STEP; FETCH(0xA0, 0xDDA9); operand = 0x0000; IMM; LDY(IMMV); 
+L_DDA9: STEP; FETCH(0x71, 0xDDAB); operand = 0x007A; INDY(1); ADC(MEM); 
+L_DDAB: STEP; FETCH(0x38, 0xDDAC); operand = 0x0000; IMP; SEC; 
+L_DDAC: STEP; FETCH(0xE9, 0xDDAE); operand = 0x0030; IMM; SBC(IMMV); 
+L_DDAE: STEP; FETCH(0x85, 0xDDB0); operand = 0x005E; ZP; STA; 
+L_DDB0: STEP; FETCH(0x4C, 0xDDB3); operand = 0xDD30; ABSO; JMP; goto L_DD30;
+L_DDC2: STEP; FETCH(0xA9, 0xDDC4); operand = 0x0071; IMM; LDA(IMMV); 
+L_DDC4: STEP; FETCH(0xA0, 0xDDC6); operand = 0x00C3; IMM; LDY(IMMV); 
+L_DDC6: STEP; FETCH(0x20, 0xDDC9); operand = 0xDDDA; ABSO; JSR; goto L_DDDA;
+L_DDC9: STEP; FETCH(0xA5, 0xDDCB); operand = 0x003A; ZP; LDA(MEM); 
+L_DDCB: STEP; FETCH(0xA6, 0xDDCD); operand = 0x0039; ZP; LDX(MEM); 
+L_DDCD: STEP; FETCH(0x85, 0xDDCF); operand = 0x0062; ZP; STA; 
+L_DDCF: STEP; FETCH(0x86, 0xDDD1); operand = 0x0063; ZP; STX; 
+L_DDD1: STEP; FETCH(0xA2, 0xDDD3); operand = 0x0090; IMM; LDX(IMMV); 
+L_DDD3: STEP; FETCH(0x38, 0xDDD4); operand = 0x0000; IMP; SEC; 
+L_DDD4: STEP; FETCH(0x20, 0xDDD7); operand = 0xDC49; ABSO; JSR; goto L_DC49;
+L_DDD7: STEP; FETCH(0x20, 0xDDDA); operand = 0xDDDF; ABSO; JSR; goto L_DDDF;
+L_DDDA: STEP; FETCH(0x4C, 0xDDDD); operand = 0xCB1E; ABSO; JMP; goto L_CB1E;
+L_DDDD: STEP; FETCH(0xA0, 0xDDDF); operand = 0x0001; IMM; LDY(IMMV); 
+L_DDDF: STEP; FETCH(0xA9, 0xDDE1); operand = 0x0020; IMM; LDA(IMMV); 
+L_DDE1: STEP; FETCH(0x24, 0xDDE3); operand = 0x0066; ZP; BIT(MEM); 
+L_DDE3: STEP; FETCH(0x10, 0xDDE5); operand = 0x0002; REL; BPL; if (pc != 0xDDE5) goto L_DDE7; 
+L_DDE5: STEP; FETCH(0xA9, 0xDDE7); operand = 0x002D; IMM; LDA(IMMV); 
+L_DDE7: STEP; FETCH(0x99, 0xDDEA); operand = 0x00FF; ABSY(0); STA; 
+L_DDEA: STEP; FETCH(0x85, 0xDDEC); operand = 0x0066; ZP; STA; 
+L_DDEC: STEP; FETCH(0x84, 0xDDEE); operand = 0x0071; ZP; STY; 
+L_DDEE: STEP; FETCH(0xC8, 0xDDEF); operand = 0x0000; IMP; INY; 
+L_DDEF: STEP; FETCH(0xA9, 0xDDF1); operand = 0x0030; IMM; LDA(IMMV); 
+L_DDF1: STEP; FETCH(0xA6, 0xDDF3); operand = 0x0061; ZP; LDX(MEM); 
+L_DDF3: STEP; FETCH(0xD0, 0xDDF5); operand = 0x0003; REL; BNE; if (pc != 0xDDF5) goto L_DDF8; 
+L_DDF5: STEP; FETCH(0x4C, 0xDDF8); operand = 0xDF04; ABSO; JMP; goto L_DF04;
+L_DDF8: STEP; FETCH(0xA9, 0xDDFA); operand = 0x0000; IMM; LDA(IMMV); 
+L_DDFA: STEP; FETCH(0xE0, 0xDDFC); operand = 0x0080; IMM; CPX(IMMV); 
+L_DDFC: STEP; FETCH(0xF0, 0xDDFE); operand = 0x0002; REL; BEQ; if (pc != 0xDDFE) goto L_DE00; 
+L_DDFE: STEP; FETCH(0xB0, 0xDE00); operand = 0x0009; REL; BCS; if (pc != 0xDE00) goto L_DE09; 
+L_DE00: STEP; FETCH(0xA9, 0xDE02); operand = 0x00BD; IMM; LDA(IMMV); 
+L_DE02: STEP; FETCH(0xA0, 0xDE04); operand = 0x00DD; IMM; LDY(IMMV); 
+L_DE04: STEP; FETCH(0x20, 0xDE07); operand = 0xDA28; ABSO; JSR; goto L_DA28;
+L_DE07: STEP; FETCH(0xA9, 0xDE09); operand = 0x00F7; IMM; LDA(IMMV); 
+L_DE09: STEP; FETCH(0x85, 0xDE0B); operand = 0x005D; ZP; STA; 
+L_DE0B: STEP; FETCH(0xA9, 0xDE0D); operand = 0x00B8; IMM; LDA(IMMV); 
+L_DE0D: STEP; FETCH(0xA0, 0xDE0F); operand = 0x00DD; IMM; LDY(IMMV); 
+L_DE0F: STEP; FETCH(0x20, 0xDE12); operand = 0xDC5B; ABSO; JSR; goto L_DC5B;
+L_DE12: STEP; FETCH(0xF0, 0xDE14); operand = 0x001E; REL; BEQ; if (pc != 0xDE14) goto L_DE32; 
+L_DE14: STEP; FETCH(0x10, 0xDE16); operand = 0x0012; REL; BPL; if (pc != 0xDE16) goto L_DE28; 
+L_DE16: STEP; FETCH(0xA9, 0xDE18); operand = 0x00B3; IMM; LDA(IMMV); 
+L_DE18: STEP; FETCH(0xA0, 0xDE1A); operand = 0x00DD; IMM; LDY(IMMV); 
+L_DE1A: STEP; FETCH(0x20, 0xDE1D); operand = 0xDC5B; ABSO; JSR; goto L_DC5B;
+L_DE1D: STEP; FETCH(0xF0, 0xDE1F); operand = 0x0002; REL; BEQ; if (pc != 0xDE1F) goto L_DE21; 
+L_DE1F: STEP; FETCH(0x10, 0xDE21); operand = 0x000E; REL; BPL; if (pc != 0xDE21) goto L_DE2F; 
+L_DE21: STEP; FETCH(0x20, 0xDE24); operand = 0xDAE2; ABSO; JSR; goto L_DAE2;
+L_DE24: STEP; FETCH(0xC6, 0xDE26); operand = 0x005D; ZP; DEC; 
+L_DE26: STEP; FETCH(0xD0, 0xDE28); operand = 0x00EE; REL; BNE; if (pc != 0xDE28) goto L_DE16; 
+L_DE28: STEP; FETCH(0x20, 0xDE2B); operand = 0xDAFE; ABSO; JSR; goto L_DAFE;
+L_DE2B: STEP; FETCH(0xE6, 0xDE2D); operand = 0x005D; ZP; INC; 
+L_DE2D: STEP; FETCH(0xD0, 0xDE2F); operand = 0x00DC; REL; BNE; if (pc != 0xDE2F) goto L_DE0B; 
+L_DE2F: STEP; FETCH(0x20, 0xDE32); operand = 0xD849; ABSO; JSR; goto L_D849;
+L_DE32: STEP; FETCH(0x20, 0xDE35); operand = 0xDC9B; ABSO; JSR; goto L_DC9B;
+L_DE35: STEP; FETCH(0xA2, 0xDE37); operand = 0x0001; IMM; LDX(IMMV); 
+L_DE37: STEP; FETCH(0xA5, 0xDE39); operand = 0x005D; ZP; LDA(MEM); 
+L_DE39: STEP; FETCH(0x18, 0xDE3A); operand = 0x0000; IMP; CLC; 
+L_DE3A: STEP; FETCH(0x69, 0xDE3C); operand = 0x000A; IMM; ADC(IMMV); 
+L_DE3C: STEP; FETCH(0x30, 0xDE3E); operand = 0x0009; REL; BMI; if (pc != 0xDE3E) goto L_DE47; 
+L_DE3E: STEP; FETCH(0xC9, 0xDE40); operand = 0x000B; IMM; CMP(IMMV); 
+L_DE40: STEP; FETCH(0xB0, 0xDE42); operand = 0x0006; REL; BCS; if (pc != 0xDE42) goto L_DE48; 
+L_DE42: STEP; FETCH(0x69, 0xDE44); operand = 0x00FF; IMM; ADC(IMMV); 
+L_DE44: STEP; FETCH(0xAA, 0xDE45); operand = 0x0000; IMP; TAX; 
+L_DE45: STEP; FETCH(0xA9, 0xDE47); operand = 0x0002; IMM; LDA(IMMV); 
+L_DE47: STEP; FETCH(0x38, 0xDE48); operand = 0x0000; IMP; SEC; 
+L_DE48: STEP; FETCH(0xE9, 0xDE4A); operand = 0x0002; IMM; SBC(IMMV); 
+L_DE4A: STEP; FETCH(0x85, 0xDE4C); operand = 0x005E; ZP; STA; 
+L_DE4C: STEP; FETCH(0x86, 0xDE4E); operand = 0x005D; ZP; STX; 
+L_DE4E: STEP; FETCH(0x8A, 0xDE4F); operand = 0x0000; IMP; TXA; 
+L_DE4F: STEP; FETCH(0xF0, 0xDE51); operand = 0x0002; REL; BEQ; if (pc != 0xDE51) goto L_DE53; 
+L_DE51: STEP; FETCH(0x10, 0xDE53); operand = 0x0013; REL; BPL; if (pc != 0xDE53) goto L_DE66; 
+L_DE53: STEP; FETCH(0xA4, 0xDE55); operand = 0x0071; ZP; LDY(MEM); 
+L_DE55: STEP; FETCH(0xA9, 0xDE57); operand = 0x002E; IMM; LDA(IMMV); 
+L_DE57: STEP; FETCH(0xC8, 0xDE58); operand = 0x0000; IMP; INY; 
+L_DE58: STEP; FETCH(0x99, 0xDE5B); operand = 0x00FF; ABSY(0); STA; 
+L_DE5B: STEP; FETCH(0x8A, 0xDE5C); operand = 0x0000; IMP; TXA; 
+L_DE5C: STEP; FETCH(0xF0, 0xDE5E); operand = 0x0006; REL; BEQ; if (pc != 0xDE5E) goto L_DE64; 
+L_DE5E: STEP; FETCH(0xA9, 0xDE60); operand = 0x0030; IMM; LDA(IMMV); 
+L_DE60: STEP; FETCH(0xC8, 0xDE61); operand = 0x0000; IMP; INY; 
+L_DE61: STEP; FETCH(0x99, 0xDE64); operand = 0x00FF; ABSY(0); STA; 
+L_DE64: STEP; FETCH(0x84, 0xDE66); operand = 0x0071; ZP; STY; 
+L_DE66: STEP; FETCH(0xA0, 0xDE68); operand = 0x0000; IMM; LDY(IMMV); 
+L_DE68: STEP; FETCH(0xA2, 0xDE6A); operand = 0x0080; IMM; LDX(IMMV); 
+L_DE6A: STEP; FETCH(0xA5, 0xDE6C); operand = 0x0065; ZP; LDA(MEM); 
+L_DE6C: STEP; FETCH(0x18, 0xDE6D); operand = 0x0000; IMP; CLC; 
+L_DE6D: STEP; FETCH(0x79, 0xDE70); operand = 0xDF19; ABSY(1); ADC(MEM); 
+L_DE70: STEP; FETCH(0x85, 0xDE72); operand = 0x0065; ZP; STA; 
+L_DE72: STEP; FETCH(0xA5, 0xDE74); operand = 0x0064; ZP; LDA(MEM); 
+L_DE74: STEP; FETCH(0x79, 0xDE77); operand = 0xDF18; ABSY(1); ADC(MEM); 
+L_DE77: STEP; FETCH(0x85, 0xDE79); operand = 0x0064; ZP; STA; 
+L_DE79: STEP; FETCH(0xA5, 0xDE7B); operand = 0x0063; ZP; LDA(MEM); 
+L_DE7B: STEP; FETCH(0x79, 0xDE7E); operand = 0xDF17; ABSY(1); ADC(MEM); 
+L_DE7E: STEP; FETCH(0x85, 0xDE80); operand = 0x0063; ZP; STA; 
+L_DE80: STEP; FETCH(0xA5, 0xDE82); operand = 0x0062; ZP; LDA(MEM); 
+L_DE82: STEP; FETCH(0x79, 0xDE85); operand = 0xDF16; ABSY(1); ADC(MEM); 
+L_DE85: STEP; FETCH(0x85, 0xDE87); operand = 0x0062; ZP; STA; 
+L_DE87: STEP; FETCH(0xE8, 0xDE88); operand = 0x0000; IMP; INX; 
+L_DE88: STEP; FETCH(0xB0, 0xDE8A); operand = 0x0004; REL; BCS; if (pc != 0xDE8A) goto L_DE8E; 
+L_DE8A: STEP; FETCH(0x10, 0xDE8C); operand = 0x00DE; REL; BPL; if (pc != 0xDE8C) goto L_DE6A; 
+L_DE8C: STEP; FETCH(0x30, 0xDE8E); operand = 0x0002; REL; BMI; if (pc != 0xDE8E) goto L_DE90; 
+L_DE8E: STEP; FETCH(0x30, 0xDE90); operand = 0x00DA; REL; BMI; if (pc != 0xDE90) goto L_DE6A; 
+L_DE90: STEP; FETCH(0x8A, 0xDE91); operand = 0x0000; IMP; TXA; 
+L_DE91: STEP; FETCH(0x90, 0xDE93); operand = 0x0004; REL; BCC; if (pc != 0xDE93) goto L_DE97; 
+L_DE93: STEP; FETCH(0x49, 0xDE95); operand = 0x00FF; IMM; EOR(IMMV); 
+L_DE95: STEP; FETCH(0x69, 0xDE97); operand = 0x000A; IMM; ADC(IMMV); 
+L_DE97: STEP; FETCH(0x69, 0xDE99); operand = 0x002F; IMM; ADC(IMMV); 
+L_DE99: STEP; FETCH(0xC8, 0xDE9A); operand = 0x0000; IMP; INY; 
+L_DE9A: STEP; FETCH(0xC8, 0xDE9B); operand = 0x0000; IMP; INY; 
+L_DE9B: STEP; FETCH(0xC8, 0xDE9C); operand = 0x0000; IMP; INY; 
+L_DE9C: STEP; FETCH(0xC8, 0xDE9D); operand = 0x0000; IMP; INY; 
+L_DE9D: STEP; FETCH(0x84, 0xDE9F); operand = 0x0047; ZP; STY; 
+L_DE9F: STEP; FETCH(0xA4, 0xDEA1); operand = 0x0071; ZP; LDY(MEM); 
+L_DEA1: STEP; FETCH(0xC8, 0xDEA2); operand = 0x0000; IMP; INY; 
+L_DEA2: STEP; FETCH(0xAA, 0xDEA3); operand = 0x0000; IMP; TAX; 
+L_DEA3: STEP; FETCH(0x29, 0xDEA5); operand = 0x007F; IMM; AND(IMMV); 
+L_DEA5: STEP; FETCH(0x99, 0xDEA8); operand = 0x00FF; ABSY(0); STA; 
+L_DEA8: STEP; FETCH(0xC6, 0xDEAA); operand = 0x005D; ZP; DEC; 
+L_DEAA: STEP; FETCH(0xD0, 0xDEAC); operand = 0x0006; REL; BNE; if (pc != 0xDEAC) goto L_DEB2; 
+L_DEAC: STEP; FETCH(0xA9, 0xDEAE); operand = 0x002E; IMM; LDA(IMMV); 
+L_DEAE: STEP; FETCH(0xC8, 0xDEAF); operand = 0x0000; IMP; INY; 
+L_DEAF: STEP; FETCH(0x99, 0xDEB2); operand = 0x00FF; ABSY(0); STA; 
+L_DEB2: STEP; FETCH(0x84, 0xDEB4); operand = 0x0071; ZP; STY; 
+L_DEB4: STEP; FETCH(0xA4, 0xDEB6); operand = 0x0047; ZP; LDY(MEM); 
+L_DEB6: STEP; FETCH(0x8A, 0xDEB7); operand = 0x0000; IMP; TXA; 
+L_DEB7: STEP; FETCH(0x49, 0xDEB9); operand = 0x00FF; IMM; EOR(IMMV); 
+L_DEB9: STEP; FETCH(0x29, 0xDEBB); operand = 0x0080; IMM; AND(IMMV); 
+L_DEBB: STEP; FETCH(0xAA, 0xDEBC); operand = 0x0000; IMP; TAX; 
+L_DEBC: STEP; FETCH(0xC0, 0xDEBE); operand = 0x0024; IMM; CPY(IMMV); 
+L_DEBE: STEP; FETCH(0xF0, 0xDEC0); operand = 0x0004; REL; BEQ; if (pc != 0xDEC0) goto L_DEC4; 
+L_DEC0: STEP; FETCH(0xC0, 0xDEC2); operand = 0x003C; IMM; CPY(IMMV); 
+L_DEC2: STEP; FETCH(0xD0, 0xDEC4); operand = 0x00A6; REL; BNE; if (pc != 0xDEC4) goto L_DE6A; 
+L_DEC4: STEP; FETCH(0xA4, 0xDEC6); operand = 0x0071; ZP; LDY(MEM); 
+L_DEC6: STEP; FETCH(0xB9, 0xDEC9); operand = 0x00FF; ABSY(1); LDA(MEM); 
+L_DEC9: STEP; FETCH(0x88, 0xDECA); operand = 0x0000; IMP; DEY; 
+L_DECA: STEP; FETCH(0xC9, 0xDECC); operand = 0x0030; IMM; CMP(IMMV); 
+L_DECC: STEP; FETCH(0xF0, 0xDECE); operand = 0x00F8; REL; BEQ; if (pc != 0xDECE) goto L_DEC6; 
+L_DECE: STEP; FETCH(0xC9, 0xDED0); operand = 0x002E; IMM; CMP(IMMV); 
+L_DED0: STEP; FETCH(0xF0, 0xDED2); operand = 0x0001; REL; BEQ; if (pc != 0xDED2) goto L_DED3; 
+L_DED2: STEP; FETCH(0xC8, 0xDED3); operand = 0x0000; IMP; INY; 
+L_DED3: STEP; FETCH(0xA9, 0xDED5); operand = 0x002B; IMM; LDA(IMMV); 
+L_DED5: STEP; FETCH(0xA6, 0xDED7); operand = 0x005E; ZP; LDX(MEM); 
+L_DED7: STEP; FETCH(0xF0, 0xDED9); operand = 0x002E; REL; BEQ; if (pc != 0xDED9) goto L_DF07; 
+L_DED9: STEP; FETCH(0x10, 0xDEDB); operand = 0x0008; REL; BPL; if (pc != 0xDEDB) goto L_DEE3; 
+L_DEDB: STEP; FETCH(0xA9, 0xDEDD); operand = 0x0000; IMM; LDA(IMMV); 
+L_DEDD: STEP; FETCH(0x38, 0xDEDE); operand = 0x0000; IMP; SEC; 
+L_DEDE: STEP; FETCH(0xE5, 0xDEE0); operand = 0x005E; ZP; SBC(MEM); 
+L_DEE0: STEP; FETCH(0xAA, 0xDEE1); operand = 0x0000; IMP; TAX; 
+L_DEE1: STEP; FETCH(0xA9, 0xDEE3); operand = 0x002D; IMM; LDA(IMMV); 
+L_DEE3: STEP; FETCH(0x99, 0xDEE6); operand = 0x0101; ABSY(0); STA; 
+L_DEE6: STEP; FETCH(0xA9, 0xDEE8); operand = 0x0045; IMM; LDA(IMMV); 
+L_DEE8: STEP; FETCH(0x99, 0xDEEB); operand = 0x0100; ABSY(0); STA; 
+L_DEEB: STEP; FETCH(0x8A, 0xDEEC); operand = 0x0000; IMP; TXA; 
+L_DEEC: STEP; FETCH(0xA2, 0xDEEE); operand = 0x002F; IMM; LDX(IMMV); 
+L_DEEE: STEP; FETCH(0x38, 0xDEEF); operand = 0x0000; IMP; SEC; 
+L_DEEF: STEP; FETCH(0xE8, 0xDEF0); operand = 0x0000; IMP; INX; 
+L_DEF0: STEP; FETCH(0xE9, 0xDEF2); operand = 0x000A; IMM; SBC(IMMV); 
+L_DEF2: STEP; FETCH(0xB0, 0xDEF4); operand = 0x00FB; REL; BCS; if (pc != 0xDEF4) goto L_DEEF; 
+L_DEF4: STEP; FETCH(0x69, 0xDEF6); operand = 0x003A; IMM; ADC(IMMV); 
+L_DEF6: STEP; FETCH(0x99, 0xDEF9); operand = 0x0103; ABSY(0); STA; 
+L_DEF9: STEP; FETCH(0x8A, 0xDEFA); operand = 0x0000; IMP; TXA; 
+L_DEFA: STEP; FETCH(0x99, 0xDEFD); operand = 0x0102; ABSY(0); STA; 
+L_DEFD: STEP; FETCH(0xA9, 0xDEFF); operand = 0x0000; IMM; LDA(IMMV); 
+L_DEFF: STEP; FETCH(0x99, 0xDF02); operand = 0x0104; ABSY(0); STA; 
+L_DF02: STEP; FETCH(0xF0, 0xDF04); operand = 0x0008; REL; BEQ; if (pc != 0xDF04) goto L_DF0C; 
+L_DF04: STEP; FETCH(0x99, 0xDF07); operand = 0x00FF; ABSY(0); STA; 
+L_DF07: STEP; FETCH(0xA9, 0xDF09); operand = 0x0000; IMM; LDA(IMMV); 
+L_DF09: STEP; FETCH(0x99, 0xDF0C); operand = 0x0100; ABSY(0); STA; 
+L_DF0C: STEP; FETCH(0xA9, 0xDF0E); operand = 0x0000; IMM; LDA(IMMV); 
+L_DF0E: STEP; FETCH(0xA0, 0xDF10); operand = 0x0001; IMM; LDY(IMMV); 
+L_DF10: STEP; FETCH(0x60, 0xDF11); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DF71: STEP; FETCH(0x20, 0xDF74); operand = 0xDC0C; ABSO; JSR; goto L_DC0C;
+L_DF74: STEP; FETCH(0xA9, 0xDF76); operand = 0x0011; IMM; LDA(IMMV); 
+L_DF76: STEP; FETCH(0xA0, 0xDF78); operand = 0x00DF; IMM; LDY(IMMV); 
+L_DF78: STEP; FETCH(0x20, 0xDF7B); operand = 0xDBA2; ABSO; JSR; goto L_DBA2;
+L_DF7B: STEP; FETCH(0xF0, 0xDF7D); operand = 0x0070; REL; BEQ; if (pc != 0xDF7D) goto L_DFED; 
+L_DF7D: STEP; FETCH(0xA5, 0xDF7F); operand = 0x0069; ZP; LDA(MEM); 
+L_DF7F: STEP; FETCH(0xD0, 0xDF81); operand = 0x0003; REL; BNE; if (pc != 0xDF81) goto L_DF84; 
+L_DF81: STEP; FETCH(0x4C, 0xDF84); operand = 0xD8F9; ABSO; JMP; goto L_D8F9;
+L_DF84: STEP; FETCH(0xA2, 0xDF86); operand = 0x004E; IMM; LDX(IMMV); 
+L_DF86: STEP; FETCH(0xA0, 0xDF88); operand = 0x0000; IMM; LDY(IMMV); 
+L_DF88: STEP; FETCH(0x20, 0xDF8B); operand = 0xDBD4; ABSO; JSR; goto L_DBD4;
+L_DF8B: STEP; FETCH(0xA5, 0xDF8D); operand = 0x006E; ZP; LDA(MEM); 
+L_DF8D: STEP; FETCH(0x10, 0xDF8F); operand = 0x000F; REL; BPL; if (pc != 0xDF8F) goto L_DF9E; 
+L_DF8F: STEP; FETCH(0x20, 0xDF92); operand = 0xDCCC; ABSO; JSR; goto L_DCCC;
+L_DF92: STEP; FETCH(0xA9, 0xDF94); operand = 0x004E; IMM; LDA(IMMV); 
+L_DF94: STEP; FETCH(0xA0, 0xDF96); operand = 0x0000; IMM; LDY(IMMV); 
+L_DF96: STEP; FETCH(0x20, 0xDF99); operand = 0xDC5B; ABSO; JSR; goto L_DC5B;
+L_DF99: STEP; FETCH(0xD0, 0xDF9B); operand = 0x0003; REL; BNE; if (pc != 0xDF9B) goto L_DF9E; 
+L_DF9B: STEP; FETCH(0x98, 0xDF9C); operand = 0x0000; IMP; TYA; 
+L_DF9C: STEP; FETCH(0xA4, 0xDF9E); operand = 0x0007; ZP; LDY(MEM); 
+L_DF9E: STEP; FETCH(0x20, 0xDFA1); operand = 0xDBFE; ABSO; JSR; goto L_DBFE;
+L_DFA1: STEP; FETCH(0x98, 0xDFA2); operand = 0x0000; IMP; TYA; 
+L_DFA2: STEP; FETCH(0x48, 0xDFA3); operand = 0x0000; IMP; PHA; 
+L_DFA3: STEP; FETCH(0x20, 0xDFA6); operand = 0xD9EA; ABSO; JSR; goto L_D9EA;
+L_DFA6: STEP; FETCH(0xA9, 0xDFA8); operand = 0x004E; IMM; LDA(IMMV); 
+L_DFA8: STEP; FETCH(0xA0, 0xDFAA); operand = 0x0000; IMM; LDY(IMMV); 
+L_DFAA: STEP; FETCH(0x20, 0xDFAD); operand = 0xDA28; ABSO; JSR; goto L_DA28;
+L_DFAD: STEP; FETCH(0x20, 0xDFB0); operand = 0xDFED; ABSO; JSR; goto L_DFED;
+L_DFB0: STEP; FETCH(0x68, 0xDFB1); operand = 0x0000; IMP; PLA; 
+L_DFB1: STEP; FETCH(0x4A, 0xDFB2); operand = 0x0000; ACC; LSR_A; 
+L_DFB2: STEP; FETCH(0x90, 0xDFB4); operand = 0x000A; REL; BCC; if (pc != 0xDFB4) goto L_DFBE; 
+L_DFB4: STEP; FETCH(0xA5, 0xDFB6); operand = 0x0061; ZP; LDA(MEM); 
+L_DFB6: STEP; FETCH(0xF0, 0xDFB8); operand = 0x0006; REL; BEQ; if (pc != 0xDFB8) goto L_DFBE; 
+L_DFB8: STEP; FETCH(0xA5, 0xDFBA); operand = 0x0066; ZP; LDA(MEM); 
+L_DFBA: STEP; FETCH(0x49, 0xDFBC); operand = 0x00FF; IMM; EOR(IMMV); 
+L_DFBC: STEP; FETCH(0x85, 0xDFBE); operand = 0x0066; ZP; STA; 
+L_DFBE: STEP; FETCH(0x60, 0xDFBF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_DFED: STEP; FETCH(0xA9, 0xDFEF); operand = 0x00BF; IMM; LDA(IMMV); 
+L_DFEF: STEP; FETCH(0xA0, 0xDFF1); operand = 0x00DF; IMM; LDY(IMMV); 
+L_DFF1: STEP; FETCH(0x20, 0xDFF4); operand = 0xDA28; ABSO; JSR; goto L_DA28;
+L_DFF4: STEP; FETCH(0xA5, 0xDFF6); operand = 0x0070; ZP; LDA(MEM); 
+L_DFF6: STEP; FETCH(0x69, 0xDFF8); operand = 0x0050; IMM; ADC(IMMV); 
+L_DFF8: STEP; FETCH(0x90, 0xDFFA); operand = 0x0003; REL; BCC; if (pc != 0xDFFA) goto L_DFFD; 
+L_DFFA: STEP; FETCH(0x20, 0xDFFD); operand = 0xDC23; ABSO; JSR; goto L_DC23;
+L_DFFD: STEP; FETCH(0x85, 0xDFFF); operand = 0x0056; ZP; STA; 
+L_DFFF: STEP; FETCH(0x20, 0xE002); operand = 0xDC0F; ABSO; JSR; goto L_DC0F;
+L_E002: STEP; FETCH(0xA5, 0xE004); operand = 0x0061; ZP; LDA(MEM); 
+L_E004: STEP; FETCH(0xC9, 0xE006); operand = 0x0088; IMM; CMP(IMMV); 
+L_E006: STEP; FETCH(0x90, 0xE008); operand = 0x0003; REL; BCC; if (pc != 0xE008) goto L_E00B; 
+L_E008: STEP; FETCH(0x20, 0xE00B); operand = 0xDAD4; ABSO; JSR; goto L_DAD4;
+L_E00B: STEP; FETCH(0x20, 0xE00E); operand = 0xDCCC; ABSO; JSR; goto L_DCCC;
+L_E00E: STEP; FETCH(0xA5, 0xE010); operand = 0x0007; ZP; LDA(MEM); 
+L_E010: STEP; FETCH(0x18, 0xE011); operand = 0x0000; IMP; CLC; 
+L_E011: STEP; FETCH(0x69, 0xE013); operand = 0x0081; IMM; ADC(IMMV); 
+L_E013: STEP; FETCH(0xF0, 0xE015); operand = 0x00F3; REL; BEQ; if (pc != 0xE015) goto L_E008; 
+L_E015: STEP; FETCH(0x38, 0xE016); operand = 0x0000; IMP; SEC; 
+L_E016: STEP; FETCH(0xE9, 0xE018); operand = 0x0001; IMM; SBC(IMMV); 
+L_E018: STEP; FETCH(0x48, 0xE019); operand = 0x0000; IMP; PHA; 
+L_E019: STEP; FETCH(0xA2, 0xE01B); operand = 0x0005; IMM; LDX(IMMV); 
+L_E01B: STEP; FETCH(0xB5, 0xE01D); operand = 0x0069; ZPX; LDA(MEM); 
+L_E01D: STEP; FETCH(0xB4, 0xE01F); operand = 0x0061; ZPX; LDY(MEM); 
+L_E01F: STEP; FETCH(0x95, 0xE021); operand = 0x0061; ZPX; STA; 
+L_E021: STEP; FETCH(0x94, 0xE023); operand = 0x0069; ZPX; STY; 
+L_E023: STEP; FETCH(0xCA, 0xE024); operand = 0x0000; IMP; DEX; 
+L_E024: STEP; FETCH(0x10, 0xE026); operand = 0x00F5; REL; BPL; if (pc != 0xE026) goto L_E01B; 
+L_E026: STEP; FETCH(0xA5, 0xE028); operand = 0x0056; ZP; LDA(MEM); 
+L_E028: STEP; FETCH(0x85, 0xE02A); operand = 0x0070; ZP; STA; 
+L_E02A: STEP; FETCH(0x20, 0xE02D); operand = 0xD853; ABSO; JSR; goto L_D853;
+L_E02D: STEP; FETCH(0x20, 0xE030); operand = 0xDFB4; ABSO; JSR; goto L_DFB4;
+L_E030: STEP; FETCH(0xA9, 0xE032); operand = 0x00C4; IMM; LDA(IMMV); 
+L_E032: STEP; FETCH(0xA0, 0xE034); operand = 0x00DF; IMM; LDY(IMMV); 
+L_E034: STEP; FETCH(0x20, 0xE037); operand = 0xE056; ABSO; JSR; goto L_E056;
+L_E037: STEP; FETCH(0xA9, 0xE039); operand = 0x0000; IMM; LDA(IMMV); 
+L_E039: STEP; FETCH(0x85, 0xE03B); operand = 0x006F; ZP; STA; 
+L_E03B: STEP; FETCH(0x68, 0xE03C); operand = 0x0000; IMP; PLA; 
+L_E03C: STEP; FETCH(0x20, 0xE03F); operand = 0xDAB9; ABSO; JSR; goto L_DAB9;
+L_E03F: STEP; FETCH(0x60, 0xE040); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E040: STEP; FETCH(0x85, 0xE042); operand = 0x0071; ZP; STA; 
+L_E042: STEP; FETCH(0x84, 0xE044); operand = 0x0072; ZP; STY; 
+L_E044: STEP; FETCH(0x20, 0xE047); operand = 0xDBCA; ABSO; JSR; goto L_DBCA;
+L_E047: STEP; FETCH(0xA9, 0xE049); operand = 0x0057; IMM; LDA(IMMV); 
+L_E049: STEP; FETCH(0x20, 0xE04C); operand = 0xDA28; ABSO; JSR; goto L_DA28;
+L_E04C: STEP; FETCH(0x20, 0xE04F); operand = 0xE05A; ABSO; JSR; goto L_E05A;
+L_E04F: STEP; FETCH(0xA9, 0xE051); operand = 0x0057; IMM; LDA(IMMV); 
+L_E051: STEP; FETCH(0xA0, 0xE053); operand = 0x0000; IMM; LDY(IMMV); 
+L_E053: STEP; FETCH(0x4C, 0xE056); operand = 0xDA28; ABSO; JMP; goto L_DA28;
+L_E056: STEP; FETCH(0x85, 0xE058); operand = 0x0071; ZP; STA; 
+L_E058: STEP; FETCH(0x84, 0xE05A); operand = 0x0072; ZP; STY; 
+L_E05A: STEP; FETCH(0x20, 0xE05D); operand = 0xDBC7; ABSO; JSR; goto L_DBC7;
+L_E05D: STEP; FETCH(0xB1, 0xE05F); operand = 0x0071; INDY(1); LDA(MEM); 
+L_E05F: STEP; FETCH(0x85, 0xE061); operand = 0x0067; ZP; STA; 
+L_E061: STEP; FETCH(0xA4, 0xE063); operand = 0x0071; ZP; LDY(MEM); 
+L_E063: STEP; FETCH(0xC8, 0xE064); operand = 0x0000; IMP; INY; 
+L_E064: STEP; FETCH(0x98, 0xE065); operand = 0x0000; IMP; TYA; 
+L_E065: STEP; FETCH(0xD0, 0xE067); operand = 0x0002; REL; BNE; if (pc != 0xE067) goto L_E069; 
+L_E067: STEP; FETCH(0xE6, 0xE069); operand = 0x0072; ZP; INC; 
+L_E069: STEP; FETCH(0x85, 0xE06B); operand = 0x0071; ZP; STA; 
+L_E06B: STEP; FETCH(0xA4, 0xE06D); operand = 0x0072; ZP; LDY(MEM); 
+L_E06D: STEP; FETCH(0x20, 0xE070); operand = 0xDA28; ABSO; JSR; goto L_DA28;
+L_E070: STEP; FETCH(0xA5, 0xE072); operand = 0x0071; ZP; LDA(MEM); 
+L_E072: STEP; FETCH(0xA4, 0xE074); operand = 0x0072; ZP; LDY(MEM); 
+L_E074: STEP; FETCH(0x18, 0xE075); operand = 0x0000; IMP; CLC; 
+L_E075: STEP; FETCH(0x69, 0xE077); operand = 0x0005; IMM; ADC(IMMV); 
+L_E077: STEP; FETCH(0x90, 0xE079); operand = 0x0001; REL; BCC; if (pc != 0xE079) goto L_E07A; 
+L_E079: STEP; FETCH(0xC8, 0xE07A); operand = 0x0000; IMP; INY; 
+L_E07A: STEP; FETCH(0x85, 0xE07C); operand = 0x0071; ZP; STA; 
+L_E07C: STEP; FETCH(0x84, 0xE07E); operand = 0x0072; ZP; STY; 
+L_E07E: STEP; FETCH(0x20, 0xE081); operand = 0xD867; ABSO; JSR; goto L_D867;
+L_E081: STEP; FETCH(0xA9, 0xE083); operand = 0x005C; IMM; LDA(IMMV); 
+L_E083: STEP; FETCH(0xA0, 0xE085); operand = 0x0000; IMM; LDY(IMMV); 
+L_E085: STEP; FETCH(0xC6, 0xE087); operand = 0x0067; ZP; DEC; 
+L_E087: STEP; FETCH(0xD0, 0xE089); operand = 0x00E4; REL; BNE; if (pc != 0xE089) goto L_E06D; 
+L_E089: STEP; FETCH(0x60, 0xE08A); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E094: STEP; FETCH(0x20, 0xE097); operand = 0xDC2B; ABSO; JSR; goto L_DC2B;
+L_E097: STEP; FETCH(0x30, 0xE099); operand = 0x0037; REL; BMI; if (pc != 0xE099) goto L_E0D0; 
+L_E099: STEP; FETCH(0xD0, 0xE09B); operand = 0x0020; REL; BNE; if (pc != 0xE09B) goto L_E0BB; 
+L_E09B: STEP; FETCH(0x20, 0xE09E); operand = 0xFFF3; ABSO; JSR; goto L_FFF3;
+L_E09E: STEP; FETCH(0x86, 0xE0A0); operand = 0x0022; ZP; STX; 
+L_E0A0: STEP; FETCH(0x84, 0xE0A2); operand = 0x0023; ZP; STY; 
+L_E0A2: STEP; FETCH(0xA0, 0xE0A4); operand = 0x0004; IMM; LDY(IMMV); 
+L_E0A4: STEP; FETCH(0xB1, 0xE0A6); operand = 0x0022; INDY(1); LDA(MEM); 
+L_E0A6: STEP; FETCH(0x85, 0xE0A8); operand = 0x0062; ZP; STA; 
+L_E0A8: STEP; FETCH(0xC8, 0xE0A9); operand = 0x0000; IMP; INY; 
+L_E0A9: STEP; FETCH(0xB1, 0xE0AB); operand = 0x0022; INDY(1); LDA(MEM); 
+L_E0AB: STEP; FETCH(0x85, 0xE0AD); operand = 0x0064; ZP; STA; 
+L_E0AD: STEP; FETCH(0xA0, 0xE0AF); operand = 0x0008; IMM; LDY(IMMV); 
+L_E0AF: STEP; FETCH(0xB1, 0xE0B1); operand = 0x0022; INDY(1); LDA(MEM); 
+L_E0B1: STEP; FETCH(0x85, 0xE0B3); operand = 0x0063; ZP; STA; 
+L_E0B3: STEP; FETCH(0xC8, 0xE0B4); operand = 0x0000; IMP; INY; 
+L_E0B4: STEP; FETCH(0xB1, 0xE0B6); operand = 0x0022; INDY(1); LDA(MEM); 
+L_E0B6: STEP; FETCH(0x85, 0xE0B8); operand = 0x0065; ZP; STA; 
+L_E0B8: STEP; FETCH(0x4C, 0xE0BB); operand = 0xE0E0; ABSO; JMP; goto L_E0E0;
+L_E0BB: STEP; FETCH(0xA9, 0xE0BD); operand = 0x008B; IMM; LDA(IMMV); 
+L_E0BD: STEP; FETCH(0xA0, 0xE0BF); operand = 0x0000; IMM; LDY(IMMV); 
+L_E0BF: STEP; FETCH(0x20, 0xE0C2); operand = 0xDBA2; ABSO; JSR; goto L_DBA2;
+L_E0C2: STEP; FETCH(0xA9, 0xE0C4); operand = 0x008A; IMM; LDA(IMMV); 
+L_E0C4: STEP; FETCH(0xA0, 0xE0C6); operand = 0x00E0; IMM; LDY(IMMV); 
+L_E0C6: STEP; FETCH(0x20, 0xE0C9); operand = 0xDA28; ABSO; JSR; goto L_DA28;
+L_E0C9: STEP; FETCH(0xA9, 0xE0CB); operand = 0x008F; IMM; LDA(IMMV); 
+L_E0CB: STEP; FETCH(0xA0, 0xE0CD); operand = 0x00E0; IMM; LDY(IMMV); 
+L_E0CD: STEP; FETCH(0x20, 0xE0D0); operand = 0xD867; ABSO; JSR; goto L_D867;
+L_E0D0: STEP; FETCH(0xA6, 0xE0D2); operand = 0x0065; ZP; LDX(MEM); 
+L_E0D2: STEP; FETCH(0xA5, 0xE0D4); operand = 0x0062; ZP; LDA(MEM); 
+L_E0D4: STEP; FETCH(0x85, 0xE0D6); operand = 0x0065; ZP; STA; 
+L_E0D6: STEP; FETCH(0x86, 0xE0D8); operand = 0x0062; ZP; STX; 
+L_E0D8: STEP; FETCH(0xA6, 0xE0DA); operand = 0x0063; ZP; LDX(MEM); 
+L_E0DA: STEP; FETCH(0xA5, 0xE0DC); operand = 0x0064; ZP; LDA(MEM); 
+L_E0DC: STEP; FETCH(0x85, 0xE0DE); operand = 0x0063; ZP; STA; 
+L_E0DE: STEP; FETCH(0x86, 0xE0E0); operand = 0x0064; ZP; STX; 
+L_E0E0: STEP; FETCH(0xA9, 0xE0E2); operand = 0x0000; IMM; LDA(IMMV); 
+L_E0E2: STEP; FETCH(0x85, 0xE0E4); operand = 0x0066; ZP; STA; 
+L_E0E4: STEP; FETCH(0xA5, 0xE0E6); operand = 0x0061; ZP; LDA(MEM); 
+L_E0E6: STEP; FETCH(0x85, 0xE0E8); operand = 0x0070; ZP; STA; 
+L_E0E8: STEP; FETCH(0xA9, 0xE0EA); operand = 0x0080; IMM; LDA(IMMV); 
+L_E0EA: STEP; FETCH(0x85, 0xE0EC); operand = 0x0061; ZP; STA; 
+L_E0EC: STEP; FETCH(0x20, 0xE0EF); operand = 0xD8D7; ABSO; JSR; goto L_D8D7;
+L_E0EF: STEP; FETCH(0xA2, 0xE0F1); operand = 0x008B; IMM; LDX(IMMV); 
+L_E0F1: STEP; FETCH(0xA0, 0xE0F3); operand = 0x0000; IMM; LDY(IMMV); 
+L_E0F3: STEP; FETCH(0x4C, 0xE0F6); operand = 0xDBD4; ABSO; JMP; goto L_DBD4;
+L_E0F6: STEP; FETCH(0xC9, 0xE0F8); operand = 0x00F0; IMM; CMP(IMMV); 
+L_E0F8: STEP; FETCH(0xD0, 0xE0FA); operand = 0x0007; REL; BNE; if (pc != 0xE0FA) goto L_E101; 
+L_E0FA: STEP; FETCH(0x84, 0xE0FC); operand = 0x0038; ZP; STY; 
+L_E0FC: STEP; FETCH(0x86, 0xE0FE); operand = 0x0037; ZP; STX; 
+L_E0FE: STEP; FETCH(0x4C, 0xE101); operand = 0xC663; ABSO; JMP; goto L_C663;
+L_E101: STEP; FETCH(0xAA, 0xE102); operand = 0x0000; IMP; TAX; 
+L_E102: STEP; FETCH(0xD0, 0xE104); operand = 0x0002; REL; BNE; if (pc != 0xE104) goto L_E106; 
+L_E104: STEP; FETCH(0xA2, 0xE106); operand = 0x001E; IMM; LDX(IMMV); 
+L_E106: STEP; FETCH(0x4C, 0xE109); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_E109: STEP; FETCH(0x20, 0xE10C); operand = 0xFFD2; ABSO; JSR; goto L_FFD2;
+L_E10C: STEP; FETCH(0xB0, 0xE10E); operand = 0x00E8; REL; BCS; if (pc != 0xE10E) goto L_E0F6; 
+L_E10E: STEP; FETCH(0x60, 0xE10F); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E10F: STEP; FETCH(0x20, 0xE112); operand = 0xFFCF; ABSO; JSR; goto L_FFCF;
+L_E112: STEP; FETCH(0xB0, 0xE114); operand = 0x00E2; REL; BCS; if (pc != 0xE114) goto L_E0F6; 
+L_E114: STEP; FETCH(0x60, 0xE115); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E115: STEP; FETCH(0x20, 0xE118); operand = 0xFFC9; ABSO; JSR; goto L_FFC9;
+L_E118: STEP; FETCH(0xB0, 0xE11A); operand = 0x00DC; REL; BCS; if (pc != 0xE11A) goto L_E0F6; 
+L_E11A: STEP; FETCH(0x60, 0xE11B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E11B: STEP; FETCH(0x20, 0xE11E); operand = 0xFFC6; ABSO; JSR; goto L_FFC6;
+L_E11E: STEP; FETCH(0xB0, 0xE120); operand = 0x00D6; REL; BCS; if (pc != 0xE120) goto L_E0F6; 
+L_E120: STEP; FETCH(0x60, 0xE121); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E121: STEP; FETCH(0x20, 0xE124); operand = 0xFFE4; ABSO; JSR; goto L_FFE4;
+L_E124: STEP; FETCH(0xB0, 0xE126); operand = 0x00D0; REL; BCS; if (pc != 0xE126) goto L_E0F6; 
+L_E126: STEP; FETCH(0x60, 0xE127); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E127: STEP; FETCH(0x20, 0xE12A); operand = 0xCD8A; ABSO; JSR; goto L_CD8A;
+L_E12A: STEP; FETCH(0x20, 0xE12D); operand = 0xD7F7; ABSO; JSR; goto L_D7F7;
+L_E12D: STEP; FETCH(0xA9, 0xE12F); operand = 0x00E1; IMM; LDA(IMMV); 
+L_E12F: STEP; FETCH(0x48, 0xE130); operand = 0x0000; IMP; PHA; 
+L_E130: STEP; FETCH(0xA9, 0xE132); operand = 0x0043; IMM; LDA(IMMV); 
+L_E132: STEP; FETCH(0x48, 0xE133); operand = 0x0000; IMP; PHA; 
+L_E133: STEP; FETCH(0xAD, 0xE136); operand = 0x030F; ABSO; LDA(MEM); 
+L_E136: STEP; FETCH(0x48, 0xE137); operand = 0x0000; IMP; PHA; 
+L_E137: STEP; FETCH(0xAD, 0xE13A); operand = 0x030C; ABSO; LDA(MEM); 
+L_E13A: STEP; FETCH(0xAE, 0xE13D); operand = 0x030D; ABSO; LDX(MEM); 
+L_E13D: STEP; FETCH(0xAC, 0xE140); operand = 0x030E; ABSO; LDY(MEM); 
+L_E140: STEP; FETCH(0x28, 0xE141); operand = 0x0000; IMP; PLP; 
+L_E141: STEP; FETCH(0x6C, 0xE144); operand = 0x0014; IND; JMP; goto dispatch;
+L_E153: STEP; FETCH(0x20, 0xE156); operand = 0xE1D1; ABSO; JSR; goto L_E1D1;
+L_E156: STEP; FETCH(0xA6, 0xE158); operand = 0x002D; ZP; LDX(MEM); 
+L_E158: STEP; FETCH(0xA4, 0xE15A); operand = 0x002E; ZP; LDY(MEM); 
+L_E15A: STEP; FETCH(0xA9, 0xE15C); operand = 0x002B; IMM; LDA(IMMV); 
+L_E15C: STEP; FETCH(0x20, 0xE15F); operand = 0xFFD8; ABSO; JSR; goto L_FFD8;
+L_E15F: STEP; FETCH(0xB0, 0xE161); operand = 0x0095; REL; BCS; if (pc != 0xE161) goto L_E0F6; 
+L_E161: STEP; FETCH(0x60, 0xE162); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E162: STEP; FETCH(0xA9, 0xE164); operand = 0x0001; IMM; LDA(IMMV); 
+L_E164: STEP; FETCH(0x2C, 0xE167); operand = 0x00A9; ABSO; BIT(MEM); goto L_E167;
+L_E165: STEP; FETCH(0xA9, 0xE167); operand = 0x0000; IMM; LDA(IMMV); 
+L_E167: STEP; FETCH(0x85, 0xE169); operand = 0x000A; ZP; STA; 
+L_E169: STEP; FETCH(0x20, 0xE16C); operand = 0xE1D1; ABSO; JSR; goto L_E1D1;
+L_E16C: STEP; FETCH(0xA5, 0xE16E); operand = 0x000A; ZP; LDA(MEM); 
+L_E16E: STEP; FETCH(0xA6, 0xE170); operand = 0x002B; ZP; LDX(MEM); 
+L_E170: STEP; FETCH(0xA4, 0xE172); operand = 0x002C; ZP; LDY(MEM); 
+L_E172: STEP; FETCH(0x20, 0xE175); operand = 0xFFD5; ABSO; JSR; goto L_FFD5;
+L_E175: STEP; FETCH(0xB0, 0xE177); operand = 0x0057; REL; BCS; if (pc != 0xE177) goto L_E1CE; 
+L_E177: STEP; FETCH(0xA5, 0xE179); operand = 0x000A; ZP; LDA(MEM); 
+L_E179: STEP; FETCH(0xF0, 0xE17B); operand = 0x001A; REL; BEQ; if (pc != 0xE17B) goto L_E195; 
+L_E17B: STEP; FETCH(0xA2, 0xE17D); operand = 0x001C; IMM; LDX(IMMV); 
+L_E17D: STEP; FETCH(0x20, 0xE180); operand = 0xFFB7; ABSO; JSR; goto L_FFB7;
+L_E180: STEP; FETCH(0x29, 0xE182); operand = 0x0010; IMM; AND(IMMV); 
+L_E182: STEP; FETCH(0xF0, 0xE184); operand = 0x0003; REL; BEQ; if (pc != 0xE184) goto L_E187; 
+L_E184: STEP; FETCH(0x4C, 0xE187); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_E187: STEP; FETCH(0xA5, 0xE189); operand = 0x007A; ZP; LDA(MEM); 
+L_E189: STEP; FETCH(0xC9, 0xE18B); operand = 0x0002; IMM; CMP(IMMV); 
+L_E18B: STEP; FETCH(0xF0, 0xE18D); operand = 0x0007; REL; BEQ; if (pc != 0xE18D) goto L_E194; 
+L_E18D: STEP; FETCH(0xA9, 0xE18F); operand = 0x0064; IMM; LDA(IMMV); 
+L_E18F: STEP; FETCH(0xA0, 0xE191); operand = 0x00C3; IMM; LDY(IMMV); 
+L_E191: STEP; FETCH(0x4C, 0xE194); operand = 0xCB1E; ABSO; JMP; goto L_CB1E;
+L_E194: STEP; FETCH(0x60, 0xE195); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E195: STEP; FETCH(0x20, 0xE198); operand = 0xFFB7; ABSO; JSR; goto L_FFB7;
+L_E198: STEP; FETCH(0x29, 0xE19A); operand = 0x00BF; IMM; AND(IMMV); 
+L_E19A: STEP; FETCH(0xF0, 0xE19C); operand = 0x0005; REL; BEQ; if (pc != 0xE19C) goto L_E1A1; 
+L_E19C: STEP; FETCH(0xA2, 0xE19E); operand = 0x001D; IMM; LDX(IMMV); 
+L_E19E: STEP; FETCH(0x4C, 0xE1A1); operand = 0xC437; ABSO; JMP; goto L_C437;
+L_E1A1: STEP; FETCH(0xA5, 0xE1A3); operand = 0x007B; ZP; LDA(MEM); 
+L_E1A3: STEP; FETCH(0xC9, 0xE1A5); operand = 0x0002; IMM; CMP(IMMV); 
+L_E1A5: STEP; FETCH(0xD0, 0xE1A7); operand = 0x000E; REL; BNE; if (pc != 0xE1A7) goto L_E1B5; 
+L_E1A7: STEP; FETCH(0x86, 0xE1A9); operand = 0x002D; ZP; STX; 
+L_E1A9: STEP; FETCH(0x84, 0xE1AB); operand = 0x002E; ZP; STY; 
+L_E1AB: STEP; FETCH(0xA9, 0xE1AD); operand = 0x0076; IMM; LDA(IMMV); 
+L_E1AD: STEP; FETCH(0xA0, 0xE1AF); operand = 0x00C3; IMM; LDY(IMMV); 
+L_E1AF: STEP; FETCH(0x20, 0xE1B2); operand = 0xCB1E; ABSO; JSR; goto L_CB1E;
+L_E1B2: STEP; FETCH(0x4C, 0xE1B5); operand = 0xC52A; ABSO; JMP; goto L_C52A;
+L_E1B5: STEP; FETCH(0x20, 0xE1B8); operand = 0xC68E; ABSO; JSR; goto L_C68E;
+L_E1B8: STEP; FETCH(0x4C, 0xE1BB); operand = 0xE476; ABSO; JMP; goto L_E476;
+L_E1BB: STEP; FETCH(0x20, 0xE1BE); operand = 0xE216; ABSO; JSR; goto L_E216;
+L_E1BE: STEP; FETCH(0x20, 0xE1C1); operand = 0xFFC0; ABSO; JSR; goto L_FFC0;
+L_E1C1: STEP; FETCH(0xB0, 0xE1C3); operand = 0x000B; REL; BCS; if (pc != 0xE1C3) goto L_E1CE; 
+L_E1C3: STEP; FETCH(0x60, 0xE1C4); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E1C4: STEP; FETCH(0x20, 0xE1C7); operand = 0xE216; ABSO; JSR; goto L_E216;
+L_E1C7: STEP; FETCH(0xA5, 0xE1C9); operand = 0x0049; ZP; LDA(MEM); 
+L_E1C9: STEP; FETCH(0x20, 0xE1CC); operand = 0xFFC3; ABSO; JSR; goto L_FFC3;
+L_E1CC: STEP; FETCH(0x90, 0xE1CE); operand = 0x00C6; REL; BCC; if (pc != 0xE1CE) goto L_E194; 
+L_E1CE: STEP; FETCH(0x4C, 0xE1D1); operand = 0xE0F6; ABSO; JMP; goto L_E0F6;
+L_E1D1: STEP; FETCH(0xA9, 0xE1D3); operand = 0x0000; IMM; LDA(IMMV); 
+L_E1D3: STEP; FETCH(0x20, 0xE1D6); operand = 0xFFBD; ABSO; JSR; goto L_FFBD;
+L_E1D6: STEP; FETCH(0xA2, 0xE1D8); operand = 0x0001; IMM; LDX(IMMV); 
+L_E1D8: STEP; FETCH(0xA0, 0xE1DA); operand = 0x0000; IMM; LDY(IMMV); 
+L_E1DA: STEP; FETCH(0x20, 0xE1DD); operand = 0xFFBA; ABSO; JSR; goto L_FFBA;
+L_E1DD: STEP; FETCH(0x20, 0xE1E0); operand = 0xE203; ABSO; JSR; goto L_E203;
+L_E1E0: STEP; FETCH(0x20, 0xE1E3); operand = 0xE254; ABSO; JSR; goto L_E254;
+L_E1E3: STEP; FETCH(0x20, 0xE1E6); operand = 0xE203; ABSO; JSR; goto L_E203;
+L_E1E6: STEP; FETCH(0x20, 0xE1E9); operand = 0xE1FD; ABSO; JSR; goto L_E1FD;
+L_E1E9: STEP; FETCH(0xA0, 0xE1EB); operand = 0x0000; IMM; LDY(IMMV); 
+L_E1EB: STEP; FETCH(0x86, 0xE1ED); operand = 0x0049; ZP; STX; 
+L_E1ED: STEP; FETCH(0x20, 0xE1F0); operand = 0xFFBA; ABSO; JSR; goto L_FFBA;
+L_E1F0: STEP; FETCH(0x20, 0xE1F3); operand = 0xE203; ABSO; JSR; goto L_E203;
+L_E1F3: STEP; FETCH(0x20, 0xE1F6); operand = 0xE1FD; ABSO; JSR; goto L_E1FD;
+L_E1F6: STEP; FETCH(0x8A, 0xE1F7); operand = 0x0000; IMP; TXA; 
+L_E1F7: STEP; FETCH(0xA8, 0xE1F8); operand = 0x0000; IMP; TAY; 
+L_E1F8: STEP; FETCH(0xA6, 0xE1FA); operand = 0x0049; ZP; LDX(MEM); 
+L_E1FA: STEP; FETCH(0x4C, 0xE1FD); operand = 0xFFBA; ABSO; JMP; goto L_FFBA;
+L_E1FD: STEP; FETCH(0x20, 0xE200); operand = 0xE20B; ABSO; JSR; goto L_E20B;
+L_E200: STEP; FETCH(0x4C, 0xE203); operand = 0xD79E; ABSO; JMP; goto L_D79E;
+L_E203: STEP; FETCH(0x20, 0xE206); operand = 0x0079; ABSO; JSR; goto out;
+L_E206: STEP; FETCH(0xD0, 0xE208); operand = 0x0002; REL; BNE; if (pc != 0xE208) goto L_E20A; 
+L_E208: STEP; FETCH(0x68, 0xE209); operand = 0x0000; IMP; PLA; 
+L_E209: STEP; FETCH(0x68, 0xE20A); operand = 0x0000; IMP; PLA; 
+L_E20A: STEP; FETCH(0x60, 0xE20B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E20B: STEP; FETCH(0x20, 0xE20E); operand = 0xCEFD; ABSO; JSR; goto L_CEFD;
+L_E20E: STEP; FETCH(0x20, 0xE211); operand = 0x0079; ABSO; JSR; goto out;
+L_E211: STEP; FETCH(0xD0, 0xE213); operand = 0x00F7; REL; BNE; if (pc != 0xE213) goto L_E20A; 
+L_E213: STEP; FETCH(0x4C, 0xE216); operand = 0xCF08; ABSO; JMP; goto L_CF08;
+L_E216: STEP; FETCH(0xA9, 0xE218); operand = 0x0000; IMM; LDA(IMMV); 
+L_E218: STEP; FETCH(0x20, 0xE21B); operand = 0xFFBD; ABSO; JSR; goto L_FFBD;
+L_E21B: STEP; FETCH(0x20, 0xE21E); operand = 0xE20E; ABSO; JSR; goto L_E20E;
+L_E21E: STEP; FETCH(0x20, 0xE221); operand = 0xD79E; ABSO; JSR; goto L_D79E;
+L_E221: STEP; FETCH(0x86, 0xE223); operand = 0x0049; ZP; STX; 
+L_E223: STEP; FETCH(0x8A, 0xE224); operand = 0x0000; IMP; TXA; 
+L_E224: STEP; FETCH(0xA2, 0xE226); operand = 0x0001; IMM; LDX(IMMV); 
+L_E226: STEP; FETCH(0xA0, 0xE228); operand = 0x0000; IMM; LDY(IMMV); 
+L_E228: STEP; FETCH(0x20, 0xE22B); operand = 0xFFBA; ABSO; JSR; goto L_FFBA;
+L_E22B: STEP; FETCH(0x20, 0xE22E); operand = 0xE203; ABSO; JSR; goto L_E203;
+L_E22E: STEP; FETCH(0x20, 0xE231); operand = 0xE1FD; ABSO; JSR; goto L_E1FD;
+L_E231: STEP; FETCH(0x86, 0xE233); operand = 0x004A; ZP; STX; 
+L_E233: STEP; FETCH(0xA0, 0xE235); operand = 0x0000; IMM; LDY(IMMV); 
+L_E235: STEP; FETCH(0xA5, 0xE237); operand = 0x0049; ZP; LDA(MEM); 
+L_E237: STEP; FETCH(0xE0, 0xE239); operand = 0x0003; IMM; CPX(IMMV); 
+L_E239: STEP; FETCH(0x90, 0xE23B); operand = 0x0001; REL; BCC; if (pc != 0xE23B) goto L_E23C; 
+L_E23B: STEP; FETCH(0x88, 0xE23C); operand = 0x0000; IMP; DEY; 
+L_E23C: STEP; FETCH(0x20, 0xE23F); operand = 0xFFBA; ABSO; JSR; goto L_FFBA;
+L_E23F: STEP; FETCH(0x20, 0xE242); operand = 0xE203; ABSO; JSR; goto L_E203;
+L_E242: STEP; FETCH(0x20, 0xE245); operand = 0xE1FD; ABSO; JSR; goto L_E1FD;
+L_E245: STEP; FETCH(0x8A, 0xE246); operand = 0x0000; IMP; TXA; 
+L_E246: STEP; FETCH(0xA8, 0xE247); operand = 0x0000; IMP; TAY; 
+L_E247: STEP; FETCH(0xA6, 0xE249); operand = 0x004A; ZP; LDX(MEM); 
+L_E249: STEP; FETCH(0xA5, 0xE24B); operand = 0x0049; ZP; LDA(MEM); 
+L_E24B: STEP; FETCH(0x20, 0xE24E); operand = 0xFFBA; ABSO; JSR; goto L_FFBA;
+L_E24E: STEP; FETCH(0x20, 0xE251); operand = 0xE203; ABSO; JSR; goto L_E203;
+L_E251: STEP; FETCH(0x20, 0xE254); operand = 0xE20B; ABSO; JSR; goto L_E20B;
+L_E254: STEP; FETCH(0x20, 0xE257); operand = 0xCD9E; ABSO; JSR; goto L_CD9E;
+L_E257: STEP; FETCH(0x20, 0xE25A); operand = 0xD6A3; ABSO; JSR; goto L_D6A3;
+L_E25A: STEP; FETCH(0xA6, 0xE25C); operand = 0x0022; ZP; LDX(MEM); 
+L_E25C: STEP; FETCH(0xA4, 0xE25E); operand = 0x0023; ZP; LDY(MEM); 
+L_E25E: STEP; FETCH(0x4C, 0xE261); operand = 0xFFBD; ABSO; JMP; goto L_FFBD;
+L_E261: STEP; FETCH(0xA9, 0xE263); operand = 0x00DD; IMM; LDA(IMMV); 
+L_E263: STEP; FETCH(0xA0, 0xE265); operand = 0x00E2; IMM; LDY(IMMV); 
+L_E265: STEP; FETCH(0x20, 0xE268); operand = 0xD867; ABSO; JSR; goto L_D867;
+L_E268: STEP; FETCH(0x20, 0xE26B); operand = 0xDC0C; ABSO; JSR; goto L_DC0C;
+L_E26B: STEP; FETCH(0xA9, 0xE26D); operand = 0x00E2; IMM; LDA(IMMV); 
+L_E26D: STEP; FETCH(0xA0, 0xE26F); operand = 0x00E2; IMM; LDY(IMMV); 
+L_E26F: STEP; FETCH(0xA6, 0xE271); operand = 0x006E; ZP; LDX(MEM); 
+L_E271: STEP; FETCH(0x20, 0xE274); operand = 0xDB07; ABSO; JSR; goto L_DB07;
+L_E274: STEP; FETCH(0x20, 0xE277); operand = 0xDC0C; ABSO; JSR; goto L_DC0C;
+L_E277: STEP; FETCH(0x20, 0xE27A); operand = 0xDCCC; ABSO; JSR; goto L_DCCC;
+L_E27A: STEP; FETCH(0xA9, 0xE27C); operand = 0x0000; IMM; LDA(IMMV); 
+L_E27C: STEP; FETCH(0x85, 0xE27E); operand = 0x006F; ZP; STA; 
+L_E27E: STEP; FETCH(0x20, 0xE281); operand = 0xD853; ABSO; JSR; goto L_D853;
+L_E281: STEP; FETCH(0xA9, 0xE283); operand = 0x00E7; IMM; LDA(IMMV); 
+L_E283: STEP; FETCH(0xA0, 0xE285); operand = 0x00E2; IMM; LDY(IMMV); 
+L_E285: STEP; FETCH(0x20, 0xE288); operand = 0xD850; ABSO; JSR; goto L_D850;
+L_E288: STEP; FETCH(0xA5, 0xE28A); operand = 0x0066; ZP; LDA(MEM); 
+L_E28A: STEP; FETCH(0x48, 0xE28B); operand = 0x0000; IMP; PHA; 
+L_E28B: STEP; FETCH(0x10, 0xE28D); operand = 0x000D; REL; BPL; if (pc != 0xE28D) goto L_E29A; 
+L_E28D: STEP; FETCH(0x20, 0xE290); operand = 0xD849; ABSO; JSR; goto L_D849;
+L_E290: STEP; FETCH(0xA5, 0xE292); operand = 0x0066; ZP; LDA(MEM); 
+L_E292: STEP; FETCH(0x30, 0xE294); operand = 0x0009; REL; BMI; if (pc != 0xE294) goto L_E29D; 
+L_E294: STEP; FETCH(0xA5, 0xE296); operand = 0x0012; ZP; LDA(MEM); 
+L_E296: STEP; FETCH(0x49, 0xE298); operand = 0x00FF; IMM; EOR(IMMV); 
+L_E298: STEP; FETCH(0x85, 0xE29A); operand = 0x0012; ZP; STA; 
+L_E29A: STEP; FETCH(0x20, 0xE29D); operand = 0xDFB4; ABSO; JSR; goto L_DFB4;
+L_E29D: STEP; FETCH(0xA9, 0xE29F); operand = 0x00E7; IMM; LDA(IMMV); 
+L_E29F: STEP; FETCH(0xA0, 0xE2A1); operand = 0x00E2; IMM; LDY(IMMV); 
+L_E2A1: STEP; FETCH(0x20, 0xE2A4); operand = 0xD867; ABSO; JSR; goto L_D867;
+L_E2A4: STEP; FETCH(0x68, 0xE2A5); operand = 0x0000; IMP; PLA; 
+L_E2A5: STEP; FETCH(0x10, 0xE2A7); operand = 0x0003; REL; BPL; if (pc != 0xE2A7) goto L_E2AA; 
+L_E2A7: STEP; FETCH(0x20, 0xE2AA); operand = 0xDFB4; ABSO; JSR; goto L_DFB4;
+L_E2AA: STEP; FETCH(0xA9, 0xE2AC); operand = 0x00EC; IMM; LDA(IMMV); 
+L_E2AC: STEP; FETCH(0xA0, 0xE2AE); operand = 0x00E2; IMM; LDY(IMMV); 
+L_E2AE: STEP; FETCH(0x4C, 0xE2B1); operand = 0xE040; ABSO; JMP; goto L_E040;
+L_E2B1: STEP; FETCH(0x20, 0xE2B4); operand = 0xDBCA; ABSO; JSR; goto L_DBCA;
+L_E2B4: STEP; FETCH(0xA9, 0xE2B6); operand = 0x0000; IMM; LDA(IMMV); 
+L_E2B6: STEP; FETCH(0x85, 0xE2B8); operand = 0x0012; ZP; STA; 
+L_E2B8: STEP; FETCH(0x20, 0xE2BB); operand = 0xE268; ABSO; JSR; goto L_E268;
+L_E2BB: STEP; FETCH(0xA2, 0xE2BD); operand = 0x004E; IMM; LDX(IMMV); 
+L_E2BD: STEP; FETCH(0xA0, 0xE2BF); operand = 0x0000; IMM; LDY(IMMV); 
+L_E2BF: STEP; FETCH(0x20, 0xE2C2); operand = 0xE0F3; ABSO; JSR; goto L_E0F3;
+L_E2C2: STEP; FETCH(0xA9, 0xE2C4); operand = 0x0057; IMM; LDA(IMMV); 
+L_E2C4: STEP; FETCH(0xA0, 0xE2C6); operand = 0x0000; IMM; LDY(IMMV); 
+L_E2C6: STEP; FETCH(0x20, 0xE2C9); operand = 0xDBA2; ABSO; JSR; goto L_DBA2;
+L_E2C9: STEP; FETCH(0xA9, 0xE2CB); operand = 0x0000; IMM; LDA(IMMV); 
+L_E2CB: STEP; FETCH(0x85, 0xE2CD); operand = 0x0066; ZP; STA; 
+L_E2CD: STEP; FETCH(0xA5, 0xE2CF); operand = 0x0012; ZP; LDA(MEM); 
+L_E2CF: STEP; FETCH(0x20, 0xE2D2); operand = 0xE2D9; ABSO; JSR; goto L_E2D9;
+L_E2D2: STEP; FETCH(0xA9, 0xE2D4); operand = 0x004E; IMM; LDA(IMMV); 
+L_E2D4: STEP; FETCH(0xA0, 0xE2D6); operand = 0x0000; IMM; LDY(IMMV); 
+L_E2D6: STEP; FETCH(0x4C, 0xE2D9); operand = 0xDB0F; ABSO; JMP; goto L_DB0F;
+L_E2D9: STEP; FETCH(0x48, 0xE2DA); operand = 0x0000; IMP; PHA; 
+L_E2DA: STEP; FETCH(0x4C, 0xE2DD); operand = 0xE29A; ABSO; JMP; goto L_E29A;
+L_E30B: STEP; FETCH(0xA5, 0xE30D); operand = 0x0066; ZP; LDA(MEM); 
+L_E30D: STEP; FETCH(0x48, 0xE30E); operand = 0x0000; IMP; PHA; 
+L_E30E: STEP; FETCH(0x10, 0xE310); operand = 0x0003; REL; BPL; if (pc != 0xE310) goto L_E313; 
+L_E310: STEP; FETCH(0x20, 0xE313); operand = 0xDFB4; ABSO; JSR; goto L_DFB4;
+L_E313: STEP; FETCH(0xA5, 0xE315); operand = 0x0061; ZP; LDA(MEM); 
+L_E315: STEP; FETCH(0x48, 0xE316); operand = 0x0000; IMP; PHA; 
+L_E316: STEP; FETCH(0xC9, 0xE318); operand = 0x0081; IMM; CMP(IMMV); 
+L_E318: STEP; FETCH(0x90, 0xE31A); operand = 0x0007; REL; BCC; if (pc != 0xE31A) goto L_E321; 
+L_E31A: STEP; FETCH(0xA9, 0xE31C); operand = 0x00BC; IMM; LDA(IMMV); 
+L_E31C: STEP; FETCH(0xA0, 0xE31E); operand = 0x00D9; IMM; LDY(IMMV); 
+L_E31E: STEP; FETCH(0x20, 0xE321); operand = 0xDB0F; ABSO; JSR; goto L_DB0F;
+L_E321: STEP; FETCH(0xA9, 0xE323); operand = 0x003B; IMM; LDA(IMMV); 
+L_E323: STEP; FETCH(0xA0, 0xE325); operand = 0x00E3; IMM; LDY(IMMV); 
+L_E325: STEP; FETCH(0x20, 0xE328); operand = 0xE040; ABSO; JSR; goto L_E040;
+L_E328: STEP; FETCH(0x68, 0xE329); operand = 0x0000; IMP; PLA; 
+L_E329: STEP; FETCH(0xC9, 0xE32B); operand = 0x0081; IMM; CMP(IMMV); 
+L_E32B: STEP; FETCH(0x90, 0xE32D); operand = 0x0007; REL; BCC; if (pc != 0xE32D) goto L_E334; 
+L_E32D: STEP; FETCH(0xA9, 0xE32F); operand = 0x00DD; IMM; LDA(IMMV); 
+L_E32F: STEP; FETCH(0xA0, 0xE331); operand = 0x00E2; IMM; LDY(IMMV); 
+L_E331: STEP; FETCH(0x20, 0xE334); operand = 0xD850; ABSO; JSR; goto L_D850;
+L_E334: STEP; FETCH(0x68, 0xE335); operand = 0x0000; IMP; PLA; 
+L_E335: STEP; FETCH(0x10, 0xE337); operand = 0x0003; REL; BPL; if (pc != 0xE337) goto L_E33A; 
+L_E337: STEP; FETCH(0x4C, 0xE33A); operand = 0xDFB4; ABSO; JMP; goto L_DFB4;
+L_E33A: STEP; FETCH(0x60, 0xE33B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E378: STEP; FETCH(0x20, 0xE37B); operand = 0xE45B; ABSO; JSR; goto L_E45B;
+L_E37B: STEP; FETCH(0x20, 0xE37E); operand = 0xE3A4; ABSO; JSR; goto L_E3A4;
+L_E37E: STEP; FETCH(0x20, 0xE381); operand = 0xE404; ABSO; JSR; goto L_E404;
+L_E381: STEP; FETCH(0xA2, 0xE383); operand = 0x00FB; IMM; LDX(IMMV); 
+L_E383: STEP; FETCH(0x9A, 0xE384); operand = 0x0000; IMP; TXS; 
+L_E384: STEP; FETCH(0x4C, 0xE387); operand = 0xC474; ABSO; JMP; goto L_C474;
+L_E3A4: STEP; FETCH(0xA9, 0xE3A6); operand = 0x004C; IMM; LDA(IMMV); 
+L_E3A6: STEP; FETCH(0x85, 0xE3A8); operand = 0x0054; ZP; STA; 
+L_E3A8: STEP; FETCH(0x85, 0xE3AA); operand = 0x0000; ZP; STA; 
+L_E3AA: STEP; FETCH(0xA9, 0xE3AC); operand = 0x0048; IMM; LDA(IMMV); 
+L_E3AC: STEP; FETCH(0xA0, 0xE3AE); operand = 0x00D2; IMM; LDY(IMMV); 
+L_E3AE: STEP; FETCH(0x85, 0xE3B0); operand = 0x0001; ZP; STA; 
+L_E3B0: STEP; FETCH(0x84, 0xE3B2); operand = 0x0002; ZP; STY; 
+L_E3B2: STEP; FETCH(0xA9, 0xE3B4); operand = 0x0091; IMM; LDA(IMMV); 
+L_E3B4: STEP; FETCH(0xA0, 0xE3B6); operand = 0x00D3; IMM; LDY(IMMV); 
+L_E3B6: STEP; FETCH(0x85, 0xE3B8); operand = 0x0005; ZP; STA; 
+L_E3B8: STEP; FETCH(0x84, 0xE3BA); operand = 0x0006; ZP; STY; 
+L_E3BA: STEP; FETCH(0xA9, 0xE3BC); operand = 0x00AA; IMM; LDA(IMMV); 
+L_E3BC: STEP; FETCH(0xA0, 0xE3BE); operand = 0x00D1; IMM; LDY(IMMV); 
+L_E3BE: STEP; FETCH(0x85, 0xE3C0); operand = 0x0003; ZP; STA; 
+L_E3C0: STEP; FETCH(0x84, 0xE3C2); operand = 0x0004; ZP; STY; 
+L_E3C2: STEP; FETCH(0xA2, 0xE3C4); operand = 0x001C; IMM; LDX(IMMV); 
+L_E3C4: STEP; FETCH(0xBD, 0xE3C7); operand = 0xE387; ABSX(1); LDA(MEM); 
+L_E3C7: STEP; FETCH(0x95, 0xE3C9); operand = 0x0073; ZPX; STA; 
+L_E3C9: STEP; FETCH(0xCA, 0xE3CA); operand = 0x0000; IMP; DEX; 
+L_E3CA: STEP; FETCH(0x10, 0xE3CC); operand = 0x00F8; REL; BPL; if (pc != 0xE3CC) goto L_E3C4; 
+L_E3CC: STEP; FETCH(0xA9, 0xE3CE); operand = 0x0003; IMM; LDA(IMMV); 
+L_E3CE: STEP; FETCH(0x85, 0xE3D0); operand = 0x0053; ZP; STA; 
+L_E3D0: STEP; FETCH(0xA9, 0xE3D2); operand = 0x0000; IMM; LDA(IMMV); 
+L_E3D2: STEP; FETCH(0x85, 0xE3D4); operand = 0x0068; ZP; STA; 
+L_E3D4: STEP; FETCH(0x85, 0xE3D6); operand = 0x0013; ZP; STA; 
+L_E3D6: STEP; FETCH(0x85, 0xE3D8); operand = 0x0018; ZP; STA; 
+L_E3D8: STEP; FETCH(0xA2, 0xE3DA); operand = 0x0001; IMM; LDX(IMMV); 
+L_E3DA: STEP; FETCH(0x8E, 0xE3DD); operand = 0x01FD; ABSO; STX; 
+L_E3DD: STEP; FETCH(0x8E, 0xE3E0); operand = 0x01FC; ABSO; STX; 
+L_E3E0: STEP; FETCH(0xA2, 0xE3E2); operand = 0x0019; IMM; LDX(IMMV); 
+L_E3E2: STEP; FETCH(0x86, 0xE3E4); operand = 0x0016; ZP; STX; 
+L_E3E4: STEP; FETCH(0x38, 0xE3E5); operand = 0x0000; IMP; SEC; 
+L_E3E5: STEP; FETCH(0x20, 0xE3E8); operand = 0xFF9C; ABSO; JSR; goto L_FF9C;
+L_E3E8: STEP; FETCH(0x86, 0xE3EA); operand = 0x002B; ZP; STX; 
+L_E3EA: STEP; FETCH(0x84, 0xE3EC); operand = 0x002C; ZP; STY; 
+L_E3EC: STEP; FETCH(0x38, 0xE3ED); operand = 0x0000; IMP; SEC; 
+L_E3ED: STEP; FETCH(0x20, 0xE3F0); operand = 0xFF99; ABSO; JSR; goto L_FF99;
+L_E3F0: STEP; FETCH(0x86, 0xE3F2); operand = 0x0037; ZP; STX; 
+L_E3F2: STEP; FETCH(0x84, 0xE3F4); operand = 0x0038; ZP; STY; 
+L_E3F4: STEP; FETCH(0x86, 0xE3F6); operand = 0x0033; ZP; STX; 
+L_E3F6: STEP; FETCH(0x84, 0xE3F8); operand = 0x0034; ZP; STY; 
+L_E3F8: STEP; FETCH(0xA0, 0xE3FA); operand = 0x0000; IMM; LDY(IMMV); 
+L_E3FA: STEP; FETCH(0x98, 0xE3FB); operand = 0x0000; IMP; TYA; 
+L_E3FB: STEP; FETCH(0x91, 0xE3FD); operand = 0x002B; INDY(0); STA; 
+L_E3FD: STEP; FETCH(0xE6, 0xE3FF); operand = 0x002B; ZP; INC; 
+L_E3FF: STEP; FETCH(0xD0, 0xE401); operand = 0x0002; REL; BNE; if (pc != 0xE401) goto L_E403; 
+L_E401: STEP; FETCH(0xE6, 0xE403); operand = 0x002C; ZP; INC; 
+L_E403: STEP; FETCH(0x60, 0xE404); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E404: STEP; FETCH(0xA5, 0xE406); operand = 0x002B; ZP; LDA(MEM); 
+L_E406: STEP; FETCH(0xA4, 0xE408); operand = 0x002C; ZP; LDY(MEM); 
+L_E408: STEP; FETCH(0x20, 0xE40B); operand = 0xC408; ABSO; JSR; goto L_C408;
+L_E40B: STEP; FETCH(0xA9, 0xE40D); operand = 0x0036; IMM; LDA(IMMV); 
+L_E40D: STEP; FETCH(0xA0, 0xE40F); operand = 0x00E4; IMM; LDY(IMMV); 
+L_E40F: STEP; FETCH(0x20, 0xE412); operand = 0xCB1E; ABSO; JSR; goto L_CB1E;
+L_E412: STEP; FETCH(0xA5, 0xE414); operand = 0x0037; ZP; LDA(MEM); 
+L_E414: STEP; FETCH(0x38, 0xE415); operand = 0x0000; IMP; SEC; 
+L_E415: STEP; FETCH(0xE5, 0xE417); operand = 0x002B; ZP; SBC(MEM); 
+L_E417: STEP; FETCH(0xAA, 0xE418); operand = 0x0000; IMP; TAX; 
+L_E418: STEP; FETCH(0xA5, 0xE41A); operand = 0x0038; ZP; LDA(MEM); 
+L_E41A: STEP; FETCH(0xE5, 0xE41C); operand = 0x002C; ZP; SBC(MEM); 
+L_E41C: STEP; FETCH(0x20, 0xE41F); operand = 0xDDCD; ABSO; JSR; goto L_DDCD;
+L_E41F: STEP; FETCH(0xA9, 0xE421); operand = 0x0029; IMM; LDA(IMMV); 
+L_E421: STEP; FETCH(0xA0, 0xE423); operand = 0x00E4; IMM; LDY(IMMV); 
+L_E423: STEP; FETCH(0x20, 0xE426); operand = 0xCB1E; ABSO; JSR; goto L_CB1E;
+L_E426: STEP; FETCH(0x4C, 0xE429); operand = 0xC644; ABSO; JMP; goto L_C644;
+L_E45B: STEP; FETCH(0xA2, 0xE45D); operand = 0x000B; IMM; LDX(IMMV); 
+L_E45D: STEP; FETCH(0xBD, 0xE460); operand = 0xE44F; ABSX(1); LDA(MEM); 
+L_E460: STEP; FETCH(0x9D, 0xE463); operand = 0x0300; ABSX(0); STA; 
+L_E463: STEP; FETCH(0xCA, 0xE464); operand = 0x0000; IMP; DEX; 
+L_E464: STEP; FETCH(0x10, 0xE466); operand = 0x00F7; REL; BPL; if (pc != 0xE466) goto L_E45D; 
+L_E466: STEP; FETCH(0x60, 0xE467); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E467: STEP; FETCH(0x20, 0xE46A); operand = 0xFFCC; ABSO; JSR; goto L_FFCC;
+L_E46A: STEP; FETCH(0xA9, 0xE46C); operand = 0x0000; IMM; LDA(IMMV); 
+L_E46C: STEP; FETCH(0x85, 0xE46E); operand = 0x0013; ZP; STA; 
+L_E46E: STEP; FETCH(0x20, 0xE471); operand = 0xC67A; ABSO; JSR; goto L_C67A;
+L_E471: STEP; FETCH(0x58, 0xE472); operand = 0x0000; IMP; CLI; 
+L_E472: STEP; FETCH(0x4C, 0xE475); operand = 0xC474; ABSO; JMP; goto L_C474;
+L_E476: STEP; FETCH(0x20, 0xE479); operand = 0xC533; ABSO; JSR; goto L_C533;
+L_E479: STEP; FETCH(0x4C, 0xE47C); operand = 0xC677; ABSO; JMP; goto L_C677;
+L_E4A0: STEP; FETCH(0xAD, 0xE4A3); operand = 0x912C; ABSO; LDA(MEM); 
+L_E4A3: STEP; FETCH(0x29, 0xE4A5); operand = 0x00DF; IMM; AND(IMMV); 
+L_E4A5: STEP; FETCH(0x8D, 0xE4A8); operand = 0x912C; ABSO; STA; 
+L_E4A8: STEP; FETCH(0x60, 0xE4A9); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E4A9: STEP; FETCH(0xAD, 0xE4AC); operand = 0x912C; ABSO; LDA(MEM); 
+L_E4AC: STEP; FETCH(0x09, 0xE4AE); operand = 0x0020; IMM; ORA(IMMV); 
+L_E4AE: STEP; FETCH(0x8D, 0xE4B1); operand = 0x912C; ABSO; STA; 
+L_E4B1: STEP; FETCH(0x60, 0xE4B2); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E4B2: STEP; FETCH(0xAD, 0xE4B5); operand = 0x911F; ABSO; LDA(MEM); 
+L_E4B5: STEP; FETCH(0xCD, 0xE4B8); operand = 0x911F; ABSO; CMP(MEM); 
+L_E4B8: STEP; FETCH(0xD0, 0xE4BA); operand = 0x00F8; REL; BNE; if (pc != 0xE4BA) goto L_E4B2; 
+L_E4BA: STEP; FETCH(0x4A, 0xE4BB); operand = 0x0000; ACC; LSR_A; 
+L_E4BB: STEP; FETCH(0x60, 0xE4BC); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E4BC: STEP; FETCH(0xA6, 0xE4BE); operand = 0x00B9; ZP; LDX(MEM); 
+L_E4BE: STEP; FETCH(0x4C, 0xE4C1); operand = 0xF647; ABSO; JMP; goto L_F647;
+L_E4C1: STEP; FETCH(0x8A, 0xE4C2); operand = 0x0000; IMP; TXA; 
+L_E4C2: STEP; FETCH(0xD0, 0xE4C4); operand = 0x0008; REL; BNE; if (pc != 0xE4C4) goto L_E4CC; 
+L_E4C4: STEP; FETCH(0xA5, 0xE4C6); operand = 0x00C3; ZP; LDA(MEM); 
+L_E4C6: STEP; FETCH(0x85, 0xE4C8); operand = 0x00AE; ZP; STA; 
+L_E4C8: STEP; FETCH(0xA5, 0xE4CA); operand = 0x00C4; ZP; LDA(MEM); 
+L_E4CA: STEP; FETCH(0x85, 0xE4CC); operand = 0x00AF; ZP; STA; 
+L_E4CC: STEP; FETCH(0x4C, 0xE4CF); operand = 0xF66A; ABSO; JMP; goto L_F66A;
+L_E4CF: STEP; FETCH(0x20, 0xE4D2); operand = 0xF8E3; ABSO; JSR; goto L_F8E3;
+L_E4D2: STEP; FETCH(0x90, 0xE4D4); operand = 0x0003; REL; BCC; if (pc != 0xE4D4) goto L_E4D7; 
+L_E4D4: STEP; FETCH(0x68, 0xE4D5); operand = 0x0000; IMP; PLA; 
+L_E4D5: STEP; FETCH(0xA9, 0xE4D7); operand = 0x0000; IMM; LDA(IMMV); 
+L_E4D7: STEP; FETCH(0x4C, 0xE4DA); operand = 0xF39E; ABSO; JMP; goto L_F39E;
+L_E500: STEP; FETCH(0xA2, 0xE502); operand = 0x0010; IMM; LDX(IMMV); 
+L_E502: STEP; FETCH(0xA0, 0xE504); operand = 0x0091; IMM; LDY(IMMV); 
+L_E504: STEP; FETCH(0x60, 0xE505); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E505: STEP; FETCH(0xA2, 0xE507); operand = 0x0016; IMM; LDX(IMMV); 
+L_E507: STEP; FETCH(0xA0, 0xE509); operand = 0x0017; IMM; LDY(IMMV); 
+L_E509: STEP; FETCH(0x60, 0xE50A); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E50A: STEP; FETCH(0xB0, 0xE50C); operand = 0x0007; REL; BCS; if (pc != 0xE50C) goto L_E513; 
+L_E50C: STEP; FETCH(0x86, 0xE50E); operand = 0x00D6; ZP; STX; 
+L_E50E: STEP; FETCH(0x84, 0xE510); operand = 0x00D3; ZP; STY; 
+L_E510: STEP; FETCH(0x20, 0xE513); operand = 0xE587; ABSO; JSR; goto L_E587;
+L_E513: STEP; FETCH(0xA6, 0xE515); operand = 0x00D6; ZP; LDX(MEM); 
+L_E515: STEP; FETCH(0xA4, 0xE517); operand = 0x00D3; ZP; LDY(MEM); 
+L_E517: STEP; FETCH(0x60, 0xE518); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E518: STEP; FETCH(0x20, 0xE51B); operand = 0xE5BB; ABSO; JSR; goto L_E5BB;
+L_E51B: STEP; FETCH(0xAD, 0xE51E); operand = 0x0288; ABSO; LDA(MEM); 
+L_E51E: STEP; FETCH(0x29, 0xE520); operand = 0x00FD; IMM; AND(IMMV); 
+L_E520: STEP; FETCH(0x0A, 0xE521); operand = 0x0000; ACC; ASL_A; 
+L_E521: STEP; FETCH(0x0A, 0xE522); operand = 0x0000; ACC; ASL_A; 
+L_E522: STEP; FETCH(0x09, 0xE524); operand = 0x0080; IMM; ORA(IMMV); 
+L_E524: STEP; FETCH(0x8D, 0xE527); operand = 0x9005; ABSO; STA; 
+L_E527: STEP; FETCH(0xAD, 0xE52A); operand = 0x0288; ABSO; LDA(MEM); 
+L_E52A: STEP; FETCH(0x29, 0xE52C); operand = 0x0002; IMM; AND(IMMV); 
+L_E52C: STEP; FETCH(0xF0, 0xE52E); operand = 0x0008; REL; BEQ; if (pc != 0xE52E) goto L_E536; 
+L_E52E: STEP; FETCH(0xA9, 0xE530); operand = 0x0080; IMM; LDA(IMMV); 
+L_E530: STEP; FETCH(0x0D, 0xE533); operand = 0x9002; ABSO; ORA(MEM); 
+L_E533: STEP; FETCH(0x8D, 0xE536); operand = 0x9002; ABSO; STA; 
+L_E536: STEP; FETCH(0xA9, 0xE538); operand = 0x0000; IMM; LDA(IMMV); 
+L_E538: STEP; FETCH(0x8D, 0xE53B); operand = 0x0291; ABSO; STA; 
+L_E53B: STEP; FETCH(0x85, 0xE53D); operand = 0x00CF; ZP; STA; 
+L_E53D: STEP; FETCH(0xA9, 0xE53F); operand = 0x00DC; IMM; LDA(IMMV); 
+L_E53F: STEP; FETCH(0x8D, 0xE542); operand = 0x028F; ABSO; STA; 
+L_E542: STEP; FETCH(0xA9, 0xE544); operand = 0x00EB; IMM; LDA(IMMV); 
+L_E544: STEP; FETCH(0x8D, 0xE547); operand = 0x0290; ABSO; STA; 
+L_E547: STEP; FETCH(0xA9, 0xE549); operand = 0x000A; IMM; LDA(IMMV); 
+L_E549: STEP; FETCH(0x8D, 0xE54C); operand = 0x0289; ABSO; STA; 
+L_E54C: STEP; FETCH(0x8D, 0xE54F); operand = 0x028C; ABSO; STA; 
+L_E54F: STEP; FETCH(0xA9, 0xE551); operand = 0x0006; IMM; LDA(IMMV); 
+L_E551: STEP; FETCH(0x8D, 0xE554); operand = 0x0286; ABSO; STA; 
+L_E554: STEP; FETCH(0xA9, 0xE556); operand = 0x0004; IMM; LDA(IMMV); 
+L_E556: STEP; FETCH(0x8D, 0xE559); operand = 0x028B; ABSO; STA; 
+L_E559: STEP; FETCH(0xA9, 0xE55B); operand = 0x000C; IMM; LDA(IMMV); 
+L_E55B: STEP; FETCH(0x85, 0xE55D); operand = 0x00CD; ZP; STA; 
+L_E55D: STEP; FETCH(0x85, 0xE55F); operand = 0x00CC; ZP; STA; 
+L_E55F: STEP; FETCH(0xAD, 0xE562); operand = 0x0288; ABSO; LDA(MEM); 
+L_E562: STEP; FETCH(0x09, 0xE564); operand = 0x0080; IMM; ORA(IMMV); 
+L_E564: STEP; FETCH(0xA8, 0xE565); operand = 0x0000; IMP; TAY; 
+L_E565: STEP; FETCH(0xA9, 0xE567); operand = 0x0000; IMM; LDA(IMMV); 
+L_E567: STEP; FETCH(0xAA, 0xE568); operand = 0x0000; IMP; TAX; 
+L_E568: STEP; FETCH(0x94, 0xE56A); operand = 0x00D9; ZPX; STY; 
+L_E56A: STEP; FETCH(0x18, 0xE56B); operand = 0x0000; IMP; CLC; 
+L_E56B: STEP; FETCH(0x69, 0xE56D); operand = 0x0016; IMM; ADC(IMMV); 
+L_E56D: STEP; FETCH(0x90, 0xE56F); operand = 0x0001; REL; BCC; if (pc != 0xE56F) goto L_E570; 
+L_E56F: STEP; FETCH(0xC8, 0xE570); operand = 0x0000; IMP; INY; 
+L_E570: STEP; FETCH(0xE8, 0xE571); operand = 0x0000; IMP; INX; 
+L_E571: STEP; FETCH(0xE0, 0xE573); operand = 0x0018; IMM; CPX(IMMV); 
+L_E573: STEP; FETCH(0xD0, 0xE575); operand = 0x00F3; REL; BNE; if (pc != 0xE575) goto L_E568; 
+L_E575: STEP; FETCH(0xA9, 0xE577); operand = 0x00FF; IMM; LDA(IMMV); 
+L_E577: STEP; FETCH(0x95, 0xE579); operand = 0x00D9; ZPX; STA; 
+L_E579: STEP; FETCH(0xA2, 0xE57B); operand = 0x0016; IMM; LDX(IMMV); 
+L_E57B: STEP; FETCH(0x20, 0xE57E); operand = 0xEA8D; ABSO; JSR; goto L_EA8D;
+L_E57E: STEP; FETCH(0xCA, 0xE57F); operand = 0x0000; IMP; DEX; 
+L_E57F: STEP; FETCH(0x10, 0xE581); operand = 0x00FA; REL; BPL; if (pc != 0xE581) goto L_E57B; 
+L_E581: STEP; FETCH(0xA0, 0xE583); operand = 0x0000; IMM; LDY(IMMV); 
+L_E583: STEP; FETCH(0x84, 0xE585); operand = 0x00D3; ZP; STY; 
+L_E585: STEP; FETCH(0x84, 0xE587); operand = 0x00D6; ZP; STY; 
+L_E587: STEP; FETCH(0xA6, 0xE589); operand = 0x00D6; ZP; LDX(MEM); 
+L_E589: STEP; FETCH(0xA5, 0xE58B); operand = 0x00D3; ZP; LDA(MEM); 
+L_E58B: STEP; FETCH(0xB4, 0xE58D); operand = 0x00D9; ZPX; LDY(MEM); 
+L_E58D: STEP; FETCH(0x30, 0xE58F); operand = 0x0008; REL; BMI; if (pc != 0xE58F) goto L_E597; 
+L_E58F: STEP; FETCH(0x18, 0xE590); operand = 0x0000; IMP; CLC; 
+L_E590: STEP; FETCH(0x69, 0xE592); operand = 0x0016; IMM; ADC(IMMV); 
+L_E592: STEP; FETCH(0x85, 0xE594); operand = 0x00D3; ZP; STA; 
+L_E594: STEP; FETCH(0xCA, 0xE595); operand = 0x0000; IMP; DEX; 
+L_E595: STEP; FETCH(0x10, 0xE597); operand = 0x00F4; REL; BPL; if (pc != 0xE597) goto L_E58B; 
+L_E597: STEP; FETCH(0xB5, 0xE599); operand = 0x00D9; ZPX; LDA(MEM); 
+L_E599: STEP; FETCH(0x29, 0xE59B); operand = 0x0003; IMM; AND(IMMV); 
+L_E59B: STEP; FETCH(0x0D, 0xE59E); operand = 0x0288; ABSO; ORA(MEM); 
+L_E59E: STEP; FETCH(0x85, 0xE5A0); operand = 0x00D2; ZP; STA; 
+L_E5A0: STEP; FETCH(0xBD, 0xE5A3); operand = 0xEDFD; ABSX(1); LDA(MEM); 
+L_E5A3: STEP; FETCH(0x85, 0xE5A5); operand = 0x00D1; ZP; STA; 
+L_E5A5: STEP; FETCH(0xA9, 0xE5A7); operand = 0x0015; IMM; LDA(IMMV); 
+L_E5A7: STEP; FETCH(0xE8, 0xE5A8); operand = 0x0000; IMP; INX; 
+L_E5A8: STEP; FETCH(0xB4, 0xE5AA); operand = 0x00D9; ZPX; LDY(MEM); 
+L_E5AA: STEP; FETCH(0x30, 0xE5AC); operand = 0x0006; REL; BMI; if (pc != 0xE5AC) goto L_E5B2; 
+L_E5AC: STEP; FETCH(0x18, 0xE5AD); operand = 0x0000; IMP; CLC; 
+L_E5AD: STEP; FETCH(0x69, 0xE5AF); operand = 0x0016; IMM; ADC(IMMV); 
+L_E5AF: STEP; FETCH(0xE8, 0xE5B0); operand = 0x0000; IMP; INX; 
+L_E5B0: STEP; FETCH(0x10, 0xE5B2); operand = 0x00F6; REL; BPL; if (pc != 0xE5B2) goto L_E5A8; 
+L_E5B2: STEP; FETCH(0x85, 0xE5B4); operand = 0x00D5; ZP; STA; 
+L_E5B4: STEP; FETCH(0x60, 0xE5B5); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E5BB: STEP; FETCH(0xA9, 0xE5BD); operand = 0x0003; IMM; LDA(IMMV); 
+L_E5BD: STEP; FETCH(0x85, 0xE5BF); operand = 0x009A; ZP; STA; 
+L_E5BF: STEP; FETCH(0xA9, 0xE5C1); operand = 0x0000; IMM; LDA(IMMV); 
+L_E5C1: STEP; FETCH(0x85, 0xE5C3); operand = 0x0099; ZP; STA; 
+L_E5C3: STEP; FETCH(0xA2, 0xE5C5); operand = 0x0010; IMM; LDX(IMMV); 
+L_E5C5: STEP; FETCH(0xBD, 0xE5C8); operand = 0xEDE3; ABSX(1); LDA(MEM); 
+L_E5C8: STEP; FETCH(0x9D, 0xE5CB); operand = 0x8FFF; ABSX(0); STA; 
+L_E5CB: STEP; FETCH(0xCA, 0xE5CC); operand = 0x0000; IMP; DEX; 
+L_E5CC: STEP; FETCH(0xD0, 0xE5CE); operand = 0x00F7; REL; BNE; if (pc != 0xE5CE) goto L_E5C5; 
+L_E5CE: STEP; FETCH(0x60, 0xE5CF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E5CF: STEP; FETCH(0xAC, 0xE5D2); operand = 0x0277; ABSO; LDY(MEM); 
+L_E5D2: STEP; FETCH(0xA2, 0xE5D4); operand = 0x0000; IMM; LDX(IMMV); 
+L_E5D4: STEP; FETCH(0xBD, 0xE5D7); operand = 0x0278; ABSX(1); LDA(MEM); 
+L_E5D7: STEP; FETCH(0x9D, 0xE5DA); operand = 0x0277; ABSX(0); STA; 
+L_E5DA: STEP; FETCH(0xE8, 0xE5DB); operand = 0x0000; IMP; INX; 
+L_E5DB: STEP; FETCH(0xE4, 0xE5DD); operand = 0x00C6; ZP; CPX(MEM); 
+L_E5DD: STEP; FETCH(0xD0, 0xE5DF); operand = 0x00F5; REL; BNE; if (pc != 0xE5DF) goto L_E5D4; 
+L_E5DF: STEP; FETCH(0xC6, 0xE5E1); operand = 0x00C6; ZP; DEC; 
+L_E5E1: STEP; FETCH(0x98, 0xE5E2); operand = 0x0000; IMP; TYA; 
+L_E5E2: STEP; FETCH(0x58, 0xE5E3); operand = 0x0000; IMP; CLI; 
+L_E5E3: STEP; FETCH(0x18, 0xE5E4); operand = 0x0000; IMP; CLC; 
+L_E5E4: STEP; FETCH(0x60, 0xE5E5); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E5E5: STEP; FETCH(0x20, 0xE5E8); operand = 0xE742; ABSO; JSR; goto L_E742;
+L_E5E8: STEP; FETCH(0xA5, 0xE5EA); operand = 0x00C6; ZP; LDA(MEM); 
+L_E5EA: STEP; FETCH(0x85, 0xE5EC); operand = 0x00CC; ZP; STA; 
+L_E5EC: STEP; FETCH(0x8D, 0xE5EF); operand = 0x0292; ABSO; STA; 
+L_E5EF: STEP; FETCH(0xF0, 0xE5F1); operand = 0x00F7; REL; BEQ; if (pc != 0xE5F1) goto L_E5E8; 
+L_E5F1: STEP; FETCH(0x78, 0xE5F2); operand = 0x0000; IMP; SEI; 
+L_E5F2: STEP; FETCH(0xA5, 0xE5F4); operand = 0x00CF; ZP; LDA(MEM); 
+L_E5F4: STEP; FETCH(0xF0, 0xE5F6); operand = 0x000C; REL; BEQ; if (pc != 0xE5F6) goto L_E602; 
+L_E5F6: STEP; FETCH(0xA5, 0xE5F8); operand = 0x00CE; ZP; LDA(MEM); 
+L_E5F8: STEP; FETCH(0xAE, 0xE5FB); operand = 0x0287; ABSO; LDX(MEM); 
+L_E5FB: STEP; FETCH(0xA0, 0xE5FD); operand = 0x0000; IMM; LDY(IMMV); 
+L_E5FD: STEP; FETCH(0x84, 0xE5FF); operand = 0x00CF; ZP; STY; 
+L_E5FF: STEP; FETCH(0x20, 0xE602); operand = 0xEAA1; ABSO; JSR; goto L_EAA1;
+L_E602: STEP; FETCH(0x20, 0xE605); operand = 0xE5CF; ABSO; JSR; goto L_E5CF;
+L_E605: STEP; FETCH(0xC9, 0xE607); operand = 0x0083; IMM; CMP(IMMV); 
+L_E607: STEP; FETCH(0xD0, 0xE609); operand = 0x0010; REL; BNE; if (pc != 0xE609) goto L_E619; 
+L_E609: STEP; FETCH(0xA2, 0xE60B); operand = 0x0009; IMM; LDX(IMMV); 
+L_E60B: STEP; FETCH(0x78, 0xE60C); operand = 0x0000; IMP; SEI; 
+L_E60C: STEP; FETCH(0x86, 0xE60E); operand = 0x00C6; ZP; STX; 
+L_E60E: STEP; FETCH(0xBD, 0xE611); operand = 0xEDF3; ABSX(1); LDA(MEM); 
+L_E611: STEP; FETCH(0x9D, 0xE614); operand = 0x0276; ABSX(0); STA; 
+L_E614: STEP; FETCH(0xCA, 0xE615); operand = 0x0000; IMP; DEX; 
+L_E615: STEP; FETCH(0xD0, 0xE617); operand = 0x00F7; REL; BNE; if (pc != 0xE617) goto L_E60E; 
+L_E617: STEP; FETCH(0xF0, 0xE619); operand = 0x00CF; REL; BEQ; if (pc != 0xE619) goto L_E5E8; 
+L_E619: STEP; FETCH(0xC9, 0xE61B); operand = 0x000D; IMM; CMP(IMMV); 
+L_E61B: STEP; FETCH(0xD0, 0xE61D); operand = 0x00C8; REL; BNE; if (pc != 0xE61D) goto L_E5E5; 
+L_E61D: STEP; FETCH(0xA4, 0xE61F); operand = 0x00D5; ZP; LDY(MEM); 
+L_E61F: STEP; FETCH(0x84, 0xE621); operand = 0x00D0; ZP; STY; 
+L_E621: STEP; FETCH(0xB1, 0xE623); operand = 0x00D1; INDY(1); LDA(MEM); 
+L_E623: STEP; FETCH(0xC9, 0xE625); operand = 0x0020; IMM; CMP(IMMV); 
+L_E625: STEP; FETCH(0xD0, 0xE627); operand = 0x0003; REL; BNE; if (pc != 0xE627) goto L_E62A; 
+L_E627: STEP; FETCH(0x88, 0xE628); operand = 0x0000; IMP; DEY; 
+L_E628: STEP; FETCH(0xD0, 0xE62A); operand = 0x00F7; REL; BNE; if (pc != 0xE62A) goto L_E621; 
+L_E62A: STEP; FETCH(0xC8, 0xE62B); operand = 0x0000; IMP; INY; 
+L_E62B: STEP; FETCH(0x84, 0xE62D); operand = 0x00C8; ZP; STY; 
+L_E62D: STEP; FETCH(0xA0, 0xE62F); operand = 0x0000; IMM; LDY(IMMV); 
+L_E62F: STEP; FETCH(0x8C, 0xE632); operand = 0x0292; ABSO; STY; 
+L_E632: STEP; FETCH(0x84, 0xE634); operand = 0x00D3; ZP; STY; 
+L_E634: STEP; FETCH(0x84, 0xE636); operand = 0x00D4; ZP; STY; 
+L_E636: STEP; FETCH(0xA5, 0xE638); operand = 0x00C9; ZP; LDA(MEM); 
+L_E638: STEP; FETCH(0x30, 0xE63A); operand = 0x001D; REL; BMI; if (pc != 0xE63A) goto L_E657; 
+L_E63A: STEP; FETCH(0xA6, 0xE63C); operand = 0x00D6; ZP; LDX(MEM); 
+L_E63C: STEP; FETCH(0x20, 0xE63F); operand = 0xE719; ABSO; JSR; goto L_E719;
+L_E63F: STEP; FETCH(0xE4, 0xE641); operand = 0x00C9; ZP; CPX(MEM); 
+L_E641: STEP; FETCH(0xD0, 0xE643); operand = 0x0014; REL; BNE; if (pc != 0xE643) goto L_E657; 
+L_E643: STEP; FETCH(0xD0, 0xE645); operand = 0x0012; REL; BNE; if (pc != 0xE645) goto L_E657; 
+L_E645: STEP; FETCH(0xA5, 0xE647); operand = 0x00CA; ZP; LDA(MEM); 
+L_E647: STEP; FETCH(0x85, 0xE649); operand = 0x00D3; ZP; STA; 
+L_E649: STEP; FETCH(0xC5, 0xE64B); operand = 0x00C8; ZP; CMP(MEM); 
+L_E64B: STEP; FETCH(0x90, 0xE64D); operand = 0x000A; REL; BCC; if (pc != 0xE64D) goto L_E657; 
+L_E64D: STEP; FETCH(0xB0, 0xE64F); operand = 0x0042; REL; BCS; if (pc != 0xE64F) goto L_E691; 
+L_E64F: STEP; FETCH(0x98, 0xE650); operand = 0x0000; IMP; TYA; 
+L_E650: STEP; FETCH(0x48, 0xE651); operand = 0x0000; IMP; PHA; 
+L_E651: STEP; FETCH(0x8A, 0xE652); operand = 0x0000; IMP; TXA; 
+L_E652: STEP; FETCH(0x48, 0xE653); operand = 0x0000; IMP; PHA; 
+L_E653: STEP; FETCH(0xA5, 0xE655); operand = 0x00D0; ZP; LDA(MEM); 
+L_E655: STEP; FETCH(0xF0, 0xE657); operand = 0x0091; REL; BEQ; if (pc != 0xE657) goto L_E5E8; 
+L_E657: STEP; FETCH(0xA4, 0xE659); operand = 0x00D3; ZP; LDY(MEM); 
+L_E659: STEP; FETCH(0xB1, 0xE65B); operand = 0x00D1; INDY(1); LDA(MEM); 
+L_E65B: STEP; FETCH(0xEA, 0xE65C); operand = 0x0000; IMP; NOP; 
+L_E65C: STEP; FETCH(0xEA, 0xE65D); operand = 0x0000; IMP; NOP; 
+L_E65D: STEP; FETCH(0xEA, 0xE65E); operand = 0x0000; IMP; NOP; 
+L_E65E: STEP; FETCH(0xEA, 0xE65F); operand = 0x0000; IMP; NOP; 
+L_E65F: STEP; FETCH(0xEA, 0xE660); operand = 0x0000; IMP; NOP; 
+L_E660: STEP; FETCH(0xEA, 0xE661); operand = 0x0000; IMP; NOP; 
+L_E661: STEP; FETCH(0xEA, 0xE662); operand = 0x0000; IMP; NOP; 
+L_E662: STEP; FETCH(0xEA, 0xE663); operand = 0x0000; IMP; NOP; 
+L_E663: STEP; FETCH(0xEA, 0xE664); operand = 0x0000; IMP; NOP; 
+L_E664: STEP; FETCH(0xEA, 0xE665); operand = 0x0000; IMP; NOP; 
+L_E665: STEP; FETCH(0xEA, 0xE666); operand = 0x0000; IMP; NOP; 
+L_E666: STEP; FETCH(0xEA, 0xE667); operand = 0x0000; IMP; NOP; 
+L_E667: STEP; FETCH(0xEA, 0xE668); operand = 0x0000; IMP; NOP; 
+L_E668: STEP; FETCH(0xEA, 0xE669); operand = 0x0000; IMP; NOP; 
+L_E669: STEP; FETCH(0xEA, 0xE66A); operand = 0x0000; IMP; NOP; 
+L_E66A: STEP; FETCH(0xEA, 0xE66B); operand = 0x0000; IMP; NOP; 
+L_E66B: STEP; FETCH(0xEA, 0xE66C); operand = 0x0000; IMP; NOP; 
+L_E66C: STEP; FETCH(0xEA, 0xE66D); operand = 0x0000; IMP; NOP; 
+L_E66D: STEP; FETCH(0xEA, 0xE66E); operand = 0x0000; IMP; NOP; 
+L_E66E: STEP; FETCH(0xEA, 0xE66F); operand = 0x0000; IMP; NOP; 
+L_E66F: STEP; FETCH(0xEA, 0xE670); operand = 0x0000; IMP; NOP; 
+L_E670: STEP; FETCH(0xEA, 0xE671); operand = 0x0000; IMP; NOP; 
+L_E671: STEP; FETCH(0xEA, 0xE672); operand = 0x0000; IMP; NOP; 
+L_E672: STEP; FETCH(0x85, 0xE674); operand = 0x00D7; ZP; STA; 
+L_E674: STEP; FETCH(0x29, 0xE676); operand = 0x003F; IMM; AND(IMMV); 
+L_E676: STEP; FETCH(0x06, 0xE678); operand = 0x00D7; ZP; ASL; 
+L_E678: STEP; FETCH(0x24, 0xE67A); operand = 0x00D7; ZP; BIT(MEM); 
+L_E67A: STEP; FETCH(0x10, 0xE67C); operand = 0x0002; REL; BPL; if (pc != 0xE67C) goto L_E67E; 
+L_E67C: STEP; FETCH(0x09, 0xE67E); operand = 0x0080; IMM; ORA(IMMV); 
+L_E67E: STEP; FETCH(0x90, 0xE680); operand = 0x0004; REL; BCC; if (pc != 0xE680) goto L_E684; 
+L_E680: STEP; FETCH(0xA6, 0xE682); operand = 0x00D4; ZP; LDX(MEM); 
+L_E682: STEP; FETCH(0xD0, 0xE684); operand = 0x0004; REL; BNE; if (pc != 0xE684) goto L_E688; 
+L_E684: STEP; FETCH(0x70, 0xE686); operand = 0x0002; REL; BVS; if (pc != 0xE686) goto L_E688; 
+L_E686: STEP; FETCH(0x09, 0xE688); operand = 0x0040; IMM; ORA(IMMV); 
+L_E688: STEP; FETCH(0xE6, 0xE68A); operand = 0x00D3; ZP; INC; 
+L_E68A: STEP; FETCH(0x20, 0xE68D); operand = 0xE6B8; ABSO; JSR; goto L_E6B8;
+L_E68D: STEP; FETCH(0xC4, 0xE68F); operand = 0x00C8; ZP; CPY(MEM); 
+L_E68F: STEP; FETCH(0xD0, 0xE691); operand = 0x0017; REL; BNE; if (pc != 0xE691) goto L_E6A8; 
+L_E691: STEP; FETCH(0xA9, 0xE693); operand = 0x0000; IMM; LDA(IMMV); 
+L_E693: STEP; FETCH(0x85, 0xE695); operand = 0x00D0; ZP; STA; 
+L_E695: STEP; FETCH(0xA9, 0xE697); operand = 0x000D; IMM; LDA(IMMV); 
+L_E697: STEP; FETCH(0xA6, 0xE699); operand = 0x0099; ZP; LDX(MEM); 
+L_E699: STEP; FETCH(0xE0, 0xE69B); operand = 0x0003; IMM; CPX(IMMV); 
+L_E69B: STEP; FETCH(0xF0, 0xE69D); operand = 0x0006; REL; BEQ; if (pc != 0xE69D) goto L_E6A3; 
+L_E69D: STEP; FETCH(0xA6, 0xE69F); operand = 0x009A; ZP; LDX(MEM); 
+L_E69F: STEP; FETCH(0xE0, 0xE6A1); operand = 0x0003; IMM; CPX(IMMV); 
+L_E6A1: STEP; FETCH(0xF0, 0xE6A3); operand = 0x0003; REL; BEQ; if (pc != 0xE6A3) goto L_E6A6; 
+L_E6A3: STEP; FETCH(0x20, 0xE6A6); operand = 0xE742; ABSO; JSR; goto L_E742;
+L_E6A6: STEP; FETCH(0xA9, 0xE6A8); operand = 0x000D; IMM; LDA(IMMV); 
+L_E6A8: STEP; FETCH(0x85, 0xE6AA); operand = 0x00D7; ZP; STA; 
+L_E6AA: STEP; FETCH(0x68, 0xE6AB); operand = 0x0000; IMP; PLA; 
+L_E6AB: STEP; FETCH(0xAA, 0xE6AC); operand = 0x0000; IMP; TAX; 
+L_E6AC: STEP; FETCH(0x68, 0xE6AD); operand = 0x0000; IMP; PLA; 
+L_E6AD: STEP; FETCH(0xA8, 0xE6AE); operand = 0x0000; IMP; TAY; 
+L_E6AE: STEP; FETCH(0xA5, 0xE6B0); operand = 0x00D7; ZP; LDA(MEM); 
+L_E6B0: STEP; FETCH(0xC9, 0xE6B2); operand = 0x00DE; IMM; CMP(IMMV); 
+L_E6B2: STEP; FETCH(0xD0, 0xE6B4); operand = 0x0002; REL; BNE; if (pc != 0xE6B4) goto L_E6B6; 
+L_E6B4: STEP; FETCH(0xA9, 0xE6B6); operand = 0x00FF; IMM; LDA(IMMV); 
+L_E6B6: STEP; FETCH(0x18, 0xE6B7); operand = 0x0000; IMP; CLC; 
+L_E6B7: STEP; FETCH(0x60, 0xE6B8); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E6B8: STEP; FETCH(0xC9, 0xE6BA); operand = 0x0022; IMM; CMP(IMMV); 
+L_E6BA: STEP; FETCH(0xD0, 0xE6BC); operand = 0x0008; REL; BNE; if (pc != 0xE6BC) goto L_E6C4; 
+L_E6BC: STEP; FETCH(0xA5, 0xE6BE); operand = 0x00D4; ZP; LDA(MEM); 
+L_E6BE: STEP; FETCH(0x49, 0xE6C0); operand = 0x0001; IMM; EOR(IMMV); 
+L_E6C0: STEP; FETCH(0x85, 0xE6C2); operand = 0x00D4; ZP; STA; 
+L_E6C2: STEP; FETCH(0xA9, 0xE6C4); operand = 0x0022; IMM; LDA(IMMV); 
+L_E6C4: STEP; FETCH(0x60, 0xE6C5); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E6C5: STEP; FETCH(0x09, 0xE6C7); operand = 0x0040; IMM; ORA(IMMV); 
+L_E6C7: STEP; FETCH(0xA6, 0xE6C9); operand = 0x00C7; ZP; LDX(MEM); 
+L_E6C9: STEP; FETCH(0xF0, 0xE6CB); operand = 0x0002; REL; BEQ; if (pc != 0xE6CB) goto L_E6CD; 
+L_E6CB: STEP; FETCH(0x09, 0xE6CD); operand = 0x0080; IMM; ORA(IMMV); 
+L_E6CD: STEP; FETCH(0xA6, 0xE6CF); operand = 0x00D8; ZP; LDX(MEM); 
+L_E6CF: STEP; FETCH(0xF0, 0xE6D1); operand = 0x0002; REL; BEQ; if (pc != 0xE6D1) goto L_E6D3; 
+L_E6D1: STEP; FETCH(0xC6, 0xE6D3); operand = 0x00D8; ZP; DEC; 
+L_E6D3: STEP; FETCH(0xAE, 0xE6D6); operand = 0x0286; ABSO; LDX(MEM); 
+L_E6D6: STEP; FETCH(0x20, 0xE6D9); operand = 0xEAA1; ABSO; JSR; goto L_EAA1;
+L_E6D9: STEP; FETCH(0x20, 0xE6DC); operand = 0xE6EA; ABSO; JSR; goto L_E6EA;
+L_E6DC: STEP; FETCH(0x68, 0xE6DD); operand = 0x0000; IMP; PLA; 
+L_E6DD: STEP; FETCH(0xA8, 0xE6DE); operand = 0x0000; IMP; TAY; 
+L_E6DE: STEP; FETCH(0xA5, 0xE6E0); operand = 0x00D8; ZP; LDA(MEM); 
+L_E6E0: STEP; FETCH(0xF0, 0xE6E2); operand = 0x0002; REL; BEQ; if (pc != 0xE6E2) goto L_E6E4; 
+L_E6E2: STEP; FETCH(0x46, 0xE6E4); operand = 0x00D4; ZP; LSR; 
+L_E6E4: STEP; FETCH(0x68, 0xE6E5); operand = 0x0000; IMP; PLA; 
+L_E6E5: STEP; FETCH(0xAA, 0xE6E6); operand = 0x0000; IMP; TAX; 
+L_E6E6: STEP; FETCH(0x68, 0xE6E7); operand = 0x0000; IMP; PLA; 
+L_E6E7: STEP; FETCH(0x18, 0xE6E8); operand = 0x0000; IMP; CLC; 
+L_E6E8: STEP; FETCH(0x58, 0xE6E9); operand = 0x0000; IMP; CLI; 
+L_E6E9: STEP; FETCH(0x60, 0xE6EA); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E6EA: STEP; FETCH(0x20, 0xE6ED); operand = 0xE8FA; ABSO; JSR; goto L_E8FA;
+L_E6ED: STEP; FETCH(0xE6, 0xE6EF); operand = 0x00D3; ZP; INC; 
+L_E6EF: STEP; FETCH(0xA5, 0xE6F1); operand = 0x00D5; ZP; LDA(MEM); 
+L_E6F1: STEP; FETCH(0xC5, 0xE6F3); operand = 0x00D3; ZP; CMP(MEM); 
+L_E6F3: STEP; FETCH(0xB0, 0xE6F5); operand = 0x0037; REL; BCS; if (pc != 0xE6F5) goto L_E72C; 
+L_E6F5: STEP; FETCH(0xC9, 0xE6F7); operand = 0x0057; IMM; CMP(IMMV); 
+L_E6F7: STEP; FETCH(0xF0, 0xE6F9); operand = 0x002A; REL; BEQ; if (pc != 0xE6F9) goto L_E723; 
+L_E6F9: STEP; FETCH(0xAD, 0xE6FC); operand = 0x0292; ABSO; LDA(MEM); 
+L_E6FC: STEP; FETCH(0xF0, 0xE6FE); operand = 0x0003; REL; BEQ; if (pc != 0xE6FE) goto L_E701; 
+L_E6FE: STEP; FETCH(0x4C, 0xE701); operand = 0xE9F0; ABSO; JMP; goto L_E9F0;
+L_E701: STEP; FETCH(0xA6, 0xE703); operand = 0x00D6; ZP; LDX(MEM); 
+L_E703: STEP; FETCH(0xE0, 0xE705); operand = 0x0017; IMM; CPX(IMMV); 
+L_E705: STEP; FETCH(0x90, 0xE707); operand = 0x0007; REL; BCC; if (pc != 0xE707) goto L_E70E; 
+L_E707: STEP; FETCH(0x20, 0xE70A); operand = 0xE975; ABSO; JSR; goto L_E975;
+L_E70A: STEP; FETCH(0xC6, 0xE70C); operand = 0x00D6; ZP; DEC; 
+L_E70C: STEP; FETCH(0xA6, 0xE70E); operand = 0x00D6; ZP; LDX(MEM); 
+L_E70E: STEP; FETCH(0x16, 0xE710); operand = 0x00D9; ZPX; ASL; 
+L_E710: STEP; FETCH(0x56, 0xE712); operand = 0x00D9; ZPX; LSR; 
+L_E712: STEP; FETCH(0x4C, 0xE715); operand = 0xED5B; ABSO; JMP; goto L_ED5B;
+L_E715: STEP; FETCH(0x69, 0xE717); operand = 0x0016; IMM; ADC(IMMV); 
+L_E717: STEP; FETCH(0x85, 0xE719); operand = 0x00D5; ZP; STA; 
+L_E719: STEP; FETCH(0xB5, 0xE71B); operand = 0x00D9; ZPX; LDA(MEM); 
+L_E71B: STEP; FETCH(0x30, 0xE71D); operand = 0x0003; REL; BMI; if (pc != 0xE71D) goto L_E720; 
+L_E71D: STEP; FETCH(0xCA, 0xE71E); operand = 0x0000; IMP; DEX; 
+L_E71E: STEP; FETCH(0xD0, 0xE720); operand = 0x00F9; REL; BNE; if (pc != 0xE720) goto L_E719; 
+L_E720: STEP; FETCH(0x4C, 0xE723); operand = 0xEA7E; ABSO; JMP; goto L_EA7E;
+L_E723: STEP; FETCH(0xC6, 0xE725); operand = 0x00D6; ZP; DEC; 
+L_E725: STEP; FETCH(0x20, 0xE728); operand = 0xE8C3; ABSO; JSR; goto L_E8C3;
+L_E728: STEP; FETCH(0xA9, 0xE72A); operand = 0x0000; IMM; LDA(IMMV); 
+L_E72A: STEP; FETCH(0x85, 0xE72C); operand = 0x00D3; ZP; STA; 
+L_E72C: STEP; FETCH(0x60, 0xE72D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E72D: STEP; FETCH(0xA6, 0xE72F); operand = 0x00D6; ZP; LDX(MEM); 
+L_E72F: STEP; FETCH(0xD0, 0xE731); operand = 0x0006; REL; BNE; if (pc != 0xE731) goto L_E737; 
+L_E731: STEP; FETCH(0x86, 0xE733); operand = 0x00D3; ZP; STX; 
+L_E733: STEP; FETCH(0x68, 0xE734); operand = 0x0000; IMP; PLA; 
+L_E734: STEP; FETCH(0x68, 0xE735); operand = 0x0000; IMP; PLA; 
+L_E735: STEP; FETCH(0xD0, 0xE737); operand = 0x00A5; REL; BNE; if (pc != 0xE737) goto L_E6DC; 
+L_E737: STEP; FETCH(0xCA, 0xE738); operand = 0x0000; IMP; DEX; 
+L_E738: STEP; FETCH(0x86, 0xE73A); operand = 0x00D6; ZP; STX; 
+L_E73A: STEP; FETCH(0x20, 0xE73D); operand = 0xE587; ABSO; JSR; goto L_E587;
+L_E73D: STEP; FETCH(0xA4, 0xE73F); operand = 0x00D5; ZP; LDY(MEM); 
+L_E73F: STEP; FETCH(0x84, 0xE741); operand = 0x00D3; ZP; STY; 
+L_E741: STEP; FETCH(0x60, 0xE742); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E742: STEP; FETCH(0x48, 0xE743); operand = 0x0000; IMP; PHA; 
+L_E743: STEP; FETCH(0x85, 0xE745); operand = 0x00D7; ZP; STA; 
+L_E745: STEP; FETCH(0x8A, 0xE746); operand = 0x0000; IMP; TXA; 
+L_E746: STEP; FETCH(0x48, 0xE747); operand = 0x0000; IMP; PHA; 
+L_E747: STEP; FETCH(0x98, 0xE748); operand = 0x0000; IMP; TYA; 
+L_E748: STEP; FETCH(0x48, 0xE749); operand = 0x0000; IMP; PHA; 
+L_E749: STEP; FETCH(0xA9, 0xE74B); operand = 0x0000; IMM; LDA(IMMV); 
+L_E74B: STEP; FETCH(0x85, 0xE74D); operand = 0x00D0; ZP; STA; 
+L_E74D: STEP; FETCH(0xA4, 0xE74F); operand = 0x00D3; ZP; LDY(MEM); 
+L_E74F: STEP; FETCH(0xA5, 0xE751); operand = 0x00D7; ZP; LDA(MEM); 
+L_E751: STEP; FETCH(0x10, 0xE753); operand = 0x0003; REL; BPL; if (pc != 0xE753) goto L_E756; 
+L_E753: STEP; FETCH(0x4C, 0xE756); operand = 0xE800; ABSO; JMP; goto L_E800;
+L_E756: STEP; FETCH(0xC9, 0xE758); operand = 0x000D; IMM; CMP(IMMV); 
+L_E758: STEP; FETCH(0xD0, 0xE75A); operand = 0x0003; REL; BNE; if (pc != 0xE75A) goto L_E75D; 
+L_E75A: STEP; FETCH(0x4C, 0xE75D); operand = 0xE8D8; ABSO; JMP; goto L_E8D8;
+L_E75D: STEP; FETCH(0xC9, 0xE75F); operand = 0x0020; IMM; CMP(IMMV); 
+L_E75F: STEP; FETCH(0x90, 0xE761); operand = 0x0010; REL; BCC; if (pc != 0xE761) goto L_E771; 
+L_E761: STEP; FETCH(0xC9, 0xE763); operand = 0x0060; IMM; CMP(IMMV); 
+L_E763: STEP; FETCH(0x90, 0xE765); operand = 0x0004; REL; BCC; if (pc != 0xE765) goto L_E769; 
+L_E765: STEP; FETCH(0x29, 0xE767); operand = 0x00DF; IMM; AND(IMMV); 
+L_E767: STEP; FETCH(0xD0, 0xE769); operand = 0x0002; REL; BNE; if (pc != 0xE769) goto L_E76B; 
+L_E769: STEP; FETCH(0x29, 0xE76B); operand = 0x003F; IMM; AND(IMMV); 
+L_E76B: STEP; FETCH(0x20, 0xE76E); operand = 0xE6B8; ABSO; JSR; goto L_E6B8;
+L_E76E: STEP; FETCH(0x4C, 0xE771); operand = 0xE6C7; ABSO; JMP; goto L_E6C7;
+L_E771: STEP; FETCH(0xA6, 0xE773); operand = 0x00D8; ZP; LDX(MEM); 
+L_E773: STEP; FETCH(0xF0, 0xE775); operand = 0x0003; REL; BEQ; if (pc != 0xE775) goto L_E778; 
+L_E775: STEP; FETCH(0x4C, 0xE778); operand = 0xE6CB; ABSO; JMP; goto L_E6CB;
+L_E778: STEP; FETCH(0xC9, 0xE77A); operand = 0x0014; IMM; CMP(IMMV); 
+L_E77A: STEP; FETCH(0xD0, 0xE77C); operand = 0x002E; REL; BNE; if (pc != 0xE77C) goto L_E7AA; 
+L_E77C: STEP; FETCH(0x98, 0xE77D); operand = 0x0000; IMP; TYA; 
+L_E77D: STEP; FETCH(0xD0, 0xE77F); operand = 0x0006; REL; BNE; if (pc != 0xE77F) goto L_E785; 
+L_E77F: STEP; FETCH(0x20, 0xE782); operand = 0xE72D; ABSO; JSR; goto L_E72D;
+L_E782: STEP; FETCH(0x4C, 0xE785); operand = 0xE79F; ABSO; JMP; goto L_E79F;
+L_E785: STEP; FETCH(0x20, 0xE788); operand = 0xE8E8; ABSO; JSR; goto L_E8E8;
+L_E788: STEP; FETCH(0x88, 0xE789); operand = 0x0000; IMP; DEY; 
+L_E789: STEP; FETCH(0x84, 0xE78B); operand = 0x00D3; ZP; STY; 
+L_E78B: STEP; FETCH(0x20, 0xE78E); operand = 0xEAB2; ABSO; JSR; goto L_EAB2;
+L_E78E: STEP; FETCH(0xC8, 0xE78F); operand = 0x0000; IMP; INY; 
+L_E78F: STEP; FETCH(0xB1, 0xE791); operand = 0x00D1; INDY(1); LDA(MEM); 
+L_E791: STEP; FETCH(0x88, 0xE792); operand = 0x0000; IMP; DEY; 
+L_E792: STEP; FETCH(0x91, 0xE794); operand = 0x00D1; INDY(0); STA; 
+L_E794: STEP; FETCH(0xC8, 0xE795); operand = 0x0000; IMP; INY; 
+L_E795: STEP; FETCH(0xB1, 0xE797); operand = 0x00F3; INDY(1); LDA(MEM); 
+L_E797: STEP; FETCH(0x88, 0xE798); operand = 0x0000; IMP; DEY; 
+L_E798: STEP; FETCH(0x91, 0xE79A); operand = 0x00F3; INDY(0); STA; 
+L_E79A: STEP; FETCH(0xC8, 0xE79B); operand = 0x0000; IMP; INY; 
+L_E79B: STEP; FETCH(0xC4, 0xE79D); operand = 0x00D5; ZP; CPY(MEM); 
+L_E79D: STEP; FETCH(0xD0, 0xE79F); operand = 0x00EF; REL; BNE; if (pc != 0xE79F) goto L_E78E; 
+L_E79F: STEP; FETCH(0xA9, 0xE7A1); operand = 0x0020; IMM; LDA(IMMV); 
+L_E7A1: STEP; FETCH(0x91, 0xE7A3); operand = 0x00D1; INDY(0); STA; 
+L_E7A3: STEP; FETCH(0xAD, 0xE7A6); operand = 0x0286; ABSO; LDA(MEM); 
+L_E7A6: STEP; FETCH(0x91, 0xE7A8); operand = 0x00F3; INDY(0); STA; 
+L_E7A8: STEP; FETCH(0x10, 0xE7AA); operand = 0x004D; REL; BPL; if (pc != 0xE7AA) goto L_E7F7; 
+L_E7AA: STEP; FETCH(0xA6, 0xE7AC); operand = 0x00D4; ZP; LDX(MEM); 
+L_E7AC: STEP; FETCH(0xF0, 0xE7AE); operand = 0x0003; REL; BEQ; if (pc != 0xE7AE) goto L_E7B1; 
+L_E7AE: STEP; FETCH(0x4C, 0xE7B1); operand = 0xE6CB; ABSO; JMP; goto L_E6CB;
+L_E7B1: STEP; FETCH(0xC9, 0xE7B3); operand = 0x0012; IMM; CMP(IMMV); 
+L_E7B3: STEP; FETCH(0xD0, 0xE7B5); operand = 0x0002; REL; BNE; if (pc != 0xE7B5) goto L_E7B7; 
+L_E7B5: STEP; FETCH(0x85, 0xE7B7); operand = 0x00C7; ZP; STA; 
+L_E7B7: STEP; FETCH(0xC9, 0xE7B9); operand = 0x0013; IMM; CMP(IMMV); 
+L_E7B9: STEP; FETCH(0xD0, 0xE7BB); operand = 0x0003; REL; BNE; if (pc != 0xE7BB) goto L_E7BE; 
+L_E7BB: STEP; FETCH(0x20, 0xE7BE); operand = 0xE581; ABSO; JSR; goto L_E581;
+L_E7BE: STEP; FETCH(0xC9, 0xE7C0); operand = 0x001D; IMM; CMP(IMMV); 
+L_E7C0: STEP; FETCH(0xD0, 0xE7C2); operand = 0x0017; REL; BNE; if (pc != 0xE7C2) goto L_E7D9; 
+L_E7C2: STEP; FETCH(0xC8, 0xE7C3); operand = 0x0000; IMP; INY; 
+L_E7C3: STEP; FETCH(0x20, 0xE7C6); operand = 0xE8FA; ABSO; JSR; goto L_E8FA;
+L_E7C6: STEP; FETCH(0x84, 0xE7C8); operand = 0x00D3; ZP; STY; 
+L_E7C8: STEP; FETCH(0x88, 0xE7C9); operand = 0x0000; IMP; DEY; 
+L_E7C9: STEP; FETCH(0xC4, 0xE7CB); operand = 0x00D5; ZP; CPY(MEM); 
+L_E7CB: STEP; FETCH(0x90, 0xE7CD); operand = 0x0009; REL; BCC; if (pc != 0xE7CD) goto L_E7D6; 
+L_E7CD: STEP; FETCH(0xC6, 0xE7CF); operand = 0x00D6; ZP; DEC; 
+L_E7CF: STEP; FETCH(0x20, 0xE7D2); operand = 0xE8C3; ABSO; JSR; goto L_E8C3;
+L_E7D2: STEP; FETCH(0xA0, 0xE7D4); operand = 0x0000; IMM; LDY(IMMV); 
+L_E7D4: STEP; FETCH(0x84, 0xE7D6); operand = 0x00D3; ZP; STY; 
+L_E7D6: STEP; FETCH(0x4C, 0xE7D9); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_E7D9: STEP; FETCH(0xC9, 0xE7DB); operand = 0x0011; IMM; CMP(IMMV); 
+L_E7DB: STEP; FETCH(0xD0, 0xE7DD); operand = 0x001D; REL; BNE; if (pc != 0xE7DD) goto L_E7FA; 
+L_E7DD: STEP; FETCH(0x18, 0xE7DE); operand = 0x0000; IMP; CLC; 
+L_E7DE: STEP; FETCH(0x98, 0xE7DF); operand = 0x0000; IMP; TYA; 
+L_E7DF: STEP; FETCH(0x69, 0xE7E1); operand = 0x0016; IMM; ADC(IMMV); 
+L_E7E1: STEP; FETCH(0xA8, 0xE7E2); operand = 0x0000; IMP; TAY; 
+L_E7E2: STEP; FETCH(0xE6, 0xE7E4); operand = 0x00D6; ZP; INC; 
+L_E7E4: STEP; FETCH(0xC5, 0xE7E6); operand = 0x00D5; ZP; CMP(MEM); 
+L_E7E6: STEP; FETCH(0x90, 0xE7E8); operand = 0x00EC; REL; BCC; if (pc != 0xE7E8) goto L_E7D4; 
+L_E7E8: STEP; FETCH(0xF0, 0xE7EA); operand = 0x00EA; REL; BEQ; if (pc != 0xE7EA) goto L_E7D4; 
+L_E7EA: STEP; FETCH(0xC6, 0xE7EC); operand = 0x00D6; ZP; DEC; 
+L_E7EC: STEP; FETCH(0xE9, 0xE7EE); operand = 0x0016; IMM; SBC(IMMV); 
+L_E7EE: STEP; FETCH(0x90, 0xE7F0); operand = 0x0004; REL; BCC; if (pc != 0xE7F0) goto L_E7F4; 
+L_E7F0: STEP; FETCH(0x85, 0xE7F2); operand = 0x00D3; ZP; STA; 
+L_E7F2: STEP; FETCH(0xD0, 0xE7F4); operand = 0x00F8; REL; BNE; if (pc != 0xE7F4) goto L_E7EC; 
+L_E7F4: STEP; FETCH(0x20, 0xE7F7); operand = 0xE8C3; ABSO; JSR; goto L_E8C3;
+L_E7F7: STEP; FETCH(0x4C, 0xE7FA); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_E7FA: STEP; FETCH(0x20, 0xE7FD); operand = 0xE912; ABSO; JSR; goto L_E912;
+L_E7FD: STEP; FETCH(0x4C, 0xE800); operand = 0xED21; ABSO; JMP; goto L_ED21;
+L_E800: STEP; FETCH(0xEA, 0xE801); operand = 0x0000; IMP; NOP; 
+L_E801: STEP; FETCH(0xEA, 0xE802); operand = 0x0000; IMP; NOP; 
+L_E802: STEP; FETCH(0xEA, 0xE803); operand = 0x0000; IMP; NOP; 
+L_E803: STEP; FETCH(0xEA, 0xE804); operand = 0x0000; IMP; NOP; 
+L_E804: STEP; FETCH(0xEA, 0xE805); operand = 0x0000; IMP; NOP; 
+L_E805: STEP; FETCH(0xEA, 0xE806); operand = 0x0000; IMP; NOP; 
+L_E806: STEP; FETCH(0xEA, 0xE807); operand = 0x0000; IMP; NOP; 
+L_E807: STEP; FETCH(0xEA, 0xE808); operand = 0x0000; IMP; NOP; 
+L_E808: STEP; FETCH(0xEA, 0xE809); operand = 0x0000; IMP; NOP; 
+L_E809: STEP; FETCH(0xEA, 0xE80A); operand = 0x0000; IMP; NOP; 
+L_E80A: STEP; FETCH(0xEA, 0xE80B); operand = 0x0000; IMP; NOP; 
+L_E80B: STEP; FETCH(0xEA, 0xE80C); operand = 0x0000; IMP; NOP; 
+L_E80C: STEP; FETCH(0xEA, 0xE80D); operand = 0x0000; IMP; NOP; 
+L_E80D: STEP; FETCH(0xEA, 0xE80E); operand = 0x0000; IMP; NOP; 
+L_E80E: STEP; FETCH(0xEA, 0xE80F); operand = 0x0000; IMP; NOP; 
+L_E80F: STEP; FETCH(0xEA, 0xE810); operand = 0x0000; IMP; NOP; 
+L_E810: STEP; FETCH(0xEA, 0xE811); operand = 0x0000; IMP; NOP; 
+L_E811: STEP; FETCH(0xEA, 0xE812); operand = 0x0000; IMP; NOP; 
+L_E812: STEP; FETCH(0xEA, 0xE813); operand = 0x0000; IMP; NOP; 
+L_E813: STEP; FETCH(0xEA, 0xE814); operand = 0x0000; IMP; NOP; 
+L_E814: STEP; FETCH(0xEA, 0xE815); operand = 0x0000; IMP; NOP; 
+L_E815: STEP; FETCH(0x29, 0xE817); operand = 0x007F; IMM; AND(IMMV); 
+L_E817: STEP; FETCH(0xC9, 0xE819); operand = 0x007F; IMM; CMP(IMMV); 
+L_E819: STEP; FETCH(0xD0, 0xE81B); operand = 0x0002; REL; BNE; if (pc != 0xE81B) goto L_E81D; 
+L_E81B: STEP; FETCH(0xA9, 0xE81D); operand = 0x005E; IMM; LDA(IMMV); 
+L_E81D: STEP; FETCH(0xEA, 0xE81E); operand = 0x0000; IMP; NOP; 
+L_E81E: STEP; FETCH(0xEA, 0xE81F); operand = 0x0000; IMP; NOP; 
+L_E81F: STEP; FETCH(0xEA, 0xE820); operand = 0x0000; IMP; NOP; 
+L_E820: STEP; FETCH(0xEA, 0xE821); operand = 0x0000; IMP; NOP; 
+L_E821: STEP; FETCH(0xEA, 0xE822); operand = 0x0000; IMP; NOP; 
+L_E822: STEP; FETCH(0xEA, 0xE823); operand = 0x0000; IMP; NOP; 
+L_E823: STEP; FETCH(0xC9, 0xE825); operand = 0x0020; IMM; CMP(IMMV); 
+L_E825: STEP; FETCH(0x90, 0xE827); operand = 0x0003; REL; BCC; if (pc != 0xE827) goto L_E82A; 
+L_E827: STEP; FETCH(0x4C, 0xE82A); operand = 0xE6C5; ABSO; JMP; goto L_E6C5;
+L_E82A: STEP; FETCH(0xC9, 0xE82C); operand = 0x000D; IMM; CMP(IMMV); 
+L_E82C: STEP; FETCH(0xD0, 0xE82E); operand = 0x0003; REL; BNE; if (pc != 0xE82E) goto L_E831; 
+L_E82E: STEP; FETCH(0x4C, 0xE831); operand = 0xE8D8; ABSO; JMP; goto L_E8D8;
+L_E831: STEP; FETCH(0xA6, 0xE833); operand = 0x00D4; ZP; LDX(MEM); 
+L_E833: STEP; FETCH(0xD0, 0xE835); operand = 0x003F; REL; BNE; if (pc != 0xE835) goto L_E874; 
+L_E835: STEP; FETCH(0xC9, 0xE837); operand = 0x0014; IMM; CMP(IMMV); 
+L_E837: STEP; FETCH(0xD0, 0xE839); operand = 0x0037; REL; BNE; if (pc != 0xE839) goto L_E870; 
+L_E839: STEP; FETCH(0xA4, 0xE83B); operand = 0x00D5; ZP; LDY(MEM); 
+L_E83B: STEP; FETCH(0xB1, 0xE83D); operand = 0x00D1; INDY(1); LDA(MEM); 
+L_E83D: STEP; FETCH(0xC9, 0xE83F); operand = 0x0020; IMM; CMP(IMMV); 
+L_E83F: STEP; FETCH(0xD0, 0xE841); operand = 0x0004; REL; BNE; if (pc != 0xE841) goto L_E845; 
+L_E841: STEP; FETCH(0xC4, 0xE843); operand = 0x00D3; ZP; CPY(MEM); 
+L_E843: STEP; FETCH(0xD0, 0xE845); operand = 0x0007; REL; BNE; if (pc != 0xE845) goto L_E84C; 
+L_E845: STEP; FETCH(0xC0, 0xE847); operand = 0x0057; IMM; CPY(IMMV); 
+L_E847: STEP; FETCH(0xF0, 0xE849); operand = 0x0024; REL; BEQ; if (pc != 0xE849) goto L_E86D; 
+L_E849: STEP; FETCH(0x20, 0xE84C); operand = 0xE9EE; ABSO; JSR; goto L_E9EE;
+L_E84C: STEP; FETCH(0xA4, 0xE84E); operand = 0x00D5; ZP; LDY(MEM); 
+L_E84E: STEP; FETCH(0x20, 0xE851); operand = 0xEAB2; ABSO; JSR; goto L_EAB2;
+L_E851: STEP; FETCH(0x88, 0xE852); operand = 0x0000; IMP; DEY; 
+L_E852: STEP; FETCH(0xB1, 0xE854); operand = 0x00D1; INDY(1); LDA(MEM); 
+L_E854: STEP; FETCH(0xC8, 0xE855); operand = 0x0000; IMP; INY; 
+L_E855: STEP; FETCH(0x91, 0xE857); operand = 0x00D1; INDY(0); STA; 
+L_E857: STEP; FETCH(0x88, 0xE858); operand = 0x0000; IMP; DEY; 
+L_E858: STEP; FETCH(0xB1, 0xE85A); operand = 0x00F3; INDY(1); LDA(MEM); 
+L_E85A: STEP; FETCH(0xC8, 0xE85B); operand = 0x0000; IMP; INY; 
+L_E85B: STEP; FETCH(0x91, 0xE85D); operand = 0x00F3; INDY(0); STA; 
+L_E85D: STEP; FETCH(0x88, 0xE85E); operand = 0x0000; IMP; DEY; 
+L_E85E: STEP; FETCH(0xC4, 0xE860); operand = 0x00D3; ZP; CPY(MEM); 
+L_E860: STEP; FETCH(0xD0, 0xE862); operand = 0x00EF; REL; BNE; if (pc != 0xE862) goto L_E851; 
+L_E862: STEP; FETCH(0xA9, 0xE864); operand = 0x0020; IMM; LDA(IMMV); 
+L_E864: STEP; FETCH(0x91, 0xE866); operand = 0x00D1; INDY(0); STA; 
+L_E866: STEP; FETCH(0xAD, 0xE869); operand = 0x0286; ABSO; LDA(MEM); 
+L_E869: STEP; FETCH(0x91, 0xE86B); operand = 0x00F3; INDY(0); STA; 
+L_E86B: STEP; FETCH(0xE6, 0xE86D); operand = 0x00D8; ZP; INC; 
+L_E86D: STEP; FETCH(0x4C, 0xE870); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_E870: STEP; FETCH(0xA6, 0xE872); operand = 0x00D8; ZP; LDX(MEM); 
+L_E872: STEP; FETCH(0xF0, 0xE874); operand = 0x0005; REL; BEQ; if (pc != 0xE874) goto L_E879; 
+L_E874: STEP; FETCH(0x09, 0xE876); operand = 0x0040; IMM; ORA(IMMV); 
+L_E876: STEP; FETCH(0x4C, 0xE879); operand = 0xE6CB; ABSO; JMP; goto L_E6CB;
+L_E879: STEP; FETCH(0xC9, 0xE87B); operand = 0x0011; IMM; CMP(IMMV); 
+L_E87B: STEP; FETCH(0xD0, 0xE87D); operand = 0x0016; REL; BNE; if (pc != 0xE87D) goto L_E893; 
+L_E87D: STEP; FETCH(0xA6, 0xE87F); operand = 0x00D6; ZP; LDX(MEM); 
+L_E87F: STEP; FETCH(0xF0, 0xE881); operand = 0x0037; REL; BEQ; if (pc != 0xE881) goto L_E8B8; 
+L_E881: STEP; FETCH(0xC6, 0xE883); operand = 0x00D6; ZP; DEC; 
+L_E883: STEP; FETCH(0xA5, 0xE885); operand = 0x00D3; ZP; LDA(MEM); 
+L_E885: STEP; FETCH(0x38, 0xE886); operand = 0x0000; IMP; SEC; 
+L_E886: STEP; FETCH(0xE9, 0xE888); operand = 0x0016; IMM; SBC(IMMV); 
+L_E888: STEP; FETCH(0x90, 0xE88A); operand = 0x0004; REL; BCC; if (pc != 0xE88A) goto L_E88E; 
+L_E88A: STEP; FETCH(0x85, 0xE88C); operand = 0x00D3; ZP; STA; 
+L_E88C: STEP; FETCH(0x10, 0xE88E); operand = 0x002A; REL; BPL; if (pc != 0xE88E) goto L_E8B8; 
+L_E88E: STEP; FETCH(0x20, 0xE891); operand = 0xE587; ABSO; JSR; goto L_E587;
+L_E891: STEP; FETCH(0xD0, 0xE893); operand = 0x0025; REL; BNE; if (pc != 0xE893) goto L_E8B8; 
+L_E893: STEP; FETCH(0xC9, 0xE895); operand = 0x0012; IMM; CMP(IMMV); 
+L_E895: STEP; FETCH(0xD0, 0xE897); operand = 0x0004; REL; BNE; if (pc != 0xE897) goto L_E89B; 
+L_E897: STEP; FETCH(0xA9, 0xE899); operand = 0x0000; IMM; LDA(IMMV); 
+L_E899: STEP; FETCH(0x85, 0xE89B); operand = 0x00C7; ZP; STA; 
+L_E89B: STEP; FETCH(0xC9, 0xE89D); operand = 0x001D; IMM; CMP(IMMV); 
+L_E89D: STEP; FETCH(0xD0, 0xE89F); operand = 0x0012; REL; BNE; if (pc != 0xE89F) goto L_E8B1; 
+L_E89F: STEP; FETCH(0x98, 0xE8A0); operand = 0x0000; IMP; TYA; 
+L_E8A0: STEP; FETCH(0xF0, 0xE8A2); operand = 0x0009; REL; BEQ; if (pc != 0xE8A2) goto L_E8AB; 
+L_E8A2: STEP; FETCH(0x20, 0xE8A5); operand = 0xE8E8; ABSO; JSR; goto L_E8E8;
+L_E8A5: STEP; FETCH(0x88, 0xE8A6); operand = 0x0000; IMP; DEY; 
+L_E8A6: STEP; FETCH(0x84, 0xE8A8); operand = 0x00D3; ZP; STY; 
+L_E8A8: STEP; FETCH(0x4C, 0xE8AB); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_E8AB: STEP; FETCH(0x20, 0xE8AE); operand = 0xE72D; ABSO; JSR; goto L_E72D;
+L_E8AE: STEP; FETCH(0x4C, 0xE8B1); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_E8B1: STEP; FETCH(0xC9, 0xE8B3); operand = 0x0013; IMM; CMP(IMMV); 
+L_E8B3: STEP; FETCH(0xD0, 0xE8B5); operand = 0x0006; REL; BNE; if (pc != 0xE8B5) goto L_E8BB; 
+L_E8B5: STEP; FETCH(0x20, 0xE8B8); operand = 0xE55F; ABSO; JSR; goto L_E55F;
+L_E8B8: STEP; FETCH(0x4C, 0xE8BB); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_E8BB: STEP; FETCH(0x09, 0xE8BD); operand = 0x0080; IMM; ORA(IMMV); 
+L_E8BD: STEP; FETCH(0x20, 0xE8C0); operand = 0xE912; ABSO; JSR; goto L_E912;
+L_E8C0: STEP; FETCH(0x4C, 0xE8C3); operand = 0xED30; ABSO; JMP; goto L_ED30;
+L_E8C3: STEP; FETCH(0x46, 0xE8C5); operand = 0x00C9; ZP; LSR; 
+L_E8C5: STEP; FETCH(0xA6, 0xE8C7); operand = 0x00D6; ZP; LDX(MEM); 
+L_E8C7: STEP; FETCH(0xE8, 0xE8C8); operand = 0x0000; IMP; INX; 
+L_E8C8: STEP; FETCH(0xE0, 0xE8CA); operand = 0x0017; IMM; CPX(IMMV); 
+L_E8CA: STEP; FETCH(0xD0, 0xE8CC); operand = 0x0003; REL; BNE; if (pc != 0xE8CC) goto L_E8CF; 
+L_E8CC: STEP; FETCH(0x20, 0xE8CF); operand = 0xE975; ABSO; JSR; goto L_E975;
+L_E8CF: STEP; FETCH(0xB5, 0xE8D1); operand = 0x00D9; ZPX; LDA(MEM); 
+L_E8D1: STEP; FETCH(0x10, 0xE8D3); operand = 0x00F4; REL; BPL; if (pc != 0xE8D3) goto L_E8C7; 
+L_E8D3: STEP; FETCH(0x86, 0xE8D5); operand = 0x00D6; ZP; STX; 
+L_E8D5: STEP; FETCH(0x4C, 0xE8D8); operand = 0xE587; ABSO; JMP; goto L_E587;
+L_E8D8: STEP; FETCH(0xA2, 0xE8DA); operand = 0x0000; IMM; LDX(IMMV); 
+L_E8DA: STEP; FETCH(0x86, 0xE8DC); operand = 0x00D8; ZP; STX; 
+L_E8DC: STEP; FETCH(0x86, 0xE8DE); operand = 0x00C7; ZP; STX; 
+L_E8DE: STEP; FETCH(0x86, 0xE8E0); operand = 0x00D4; ZP; STX; 
+L_E8E0: STEP; FETCH(0x86, 0xE8E2); operand = 0x00D3; ZP; STX; 
+L_E8E2: STEP; FETCH(0x20, 0xE8E5); operand = 0xE8C3; ABSO; JSR; goto L_E8C3;
+L_E8E5: STEP; FETCH(0x4C, 0xE8E8); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_E8E8: STEP; FETCH(0xA2, 0xE8EA); operand = 0x0004; IMM; LDX(IMMV); 
+L_E8EA: STEP; FETCH(0xA9, 0xE8EC); operand = 0x0000; IMM; LDA(IMMV); 
+L_E8EC: STEP; FETCH(0xC5, 0xE8EE); operand = 0x00D3; ZP; CMP(MEM); 
+L_E8EE: STEP; FETCH(0xF0, 0xE8F0); operand = 0x0007; REL; BEQ; if (pc != 0xE8F0) goto L_E8F7; 
+L_E8F0: STEP; FETCH(0x18, 0xE8F1); operand = 0x0000; IMP; CLC; 
+L_E8F1: STEP; FETCH(0x69, 0xE8F3); operand = 0x0016; IMM; ADC(IMMV); 
+L_E8F3: STEP; FETCH(0xCA, 0xE8F4); operand = 0x0000; IMP; DEX; 
+L_E8F4: STEP; FETCH(0xD0, 0xE8F6); operand = 0x00F6; REL; BNE; if (pc != 0xE8F6) goto L_E8EC; 
+L_E8F6: STEP; FETCH(0x60, 0xE8F7); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E8F7: STEP; FETCH(0xC6, 0xE8F9); operand = 0x00D6; ZP; DEC; 
+L_E8F9: STEP; FETCH(0x60, 0xE8FA); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E8FA: STEP; FETCH(0xA2, 0xE8FC); operand = 0x0004; IMM; LDX(IMMV); 
+L_E8FC: STEP; FETCH(0xA9, 0xE8FE); operand = 0x0015; IMM; LDA(IMMV); 
+L_E8FE: STEP; FETCH(0xC5, 0xE900); operand = 0x00D3; ZP; CMP(MEM); 
+L_E900: STEP; FETCH(0xF0, 0xE902); operand = 0x0007; REL; BEQ; if (pc != 0xE902) goto L_E909; 
+L_E902: STEP; FETCH(0x18, 0xE903); operand = 0x0000; IMP; CLC; 
+L_E903: STEP; FETCH(0x69, 0xE905); operand = 0x0016; IMM; ADC(IMMV); 
+L_E905: STEP; FETCH(0xCA, 0xE906); operand = 0x0000; IMP; DEX; 
+L_E906: STEP; FETCH(0xD0, 0xE908); operand = 0x00F6; REL; BNE; if (pc != 0xE908) goto L_E8FE; 
+L_E908: STEP; FETCH(0x60, 0xE909); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E909: STEP; FETCH(0xA6, 0xE90B); operand = 0x00D6; ZP; LDX(MEM); 
+L_E90B: STEP; FETCH(0xE0, 0xE90D); operand = 0x0017; IMM; CPX(IMMV); 
+L_E90D: STEP; FETCH(0xF0, 0xE90F); operand = 0x0002; REL; BEQ; if (pc != 0xE90F) goto L_E911; 
+L_E90F: STEP; FETCH(0xE6, 0xE911); operand = 0x00D6; ZP; INC; 
+L_E911: STEP; FETCH(0x60, 0xE912); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E912: STEP; FETCH(0xA2, 0xE914); operand = 0x0007; IMM; LDX(IMMV); 
+L_E914: STEP; FETCH(0xDD, 0xE917); operand = 0xE921; ABSX(1); CMP(MEM); 
+L_E917: STEP; FETCH(0xF0, 0xE919); operand = 0x0004; REL; BEQ; if (pc != 0xE919) goto L_E91D; 
+L_E919: STEP; FETCH(0xCA, 0xE91A); operand = 0x0000; IMP; DEX; 
+L_E91A: STEP; FETCH(0x10, 0xE91C); operand = 0x00F8; REL; BPL; if (pc != 0xE91C) goto L_E914; 
+L_E91C: STEP; FETCH(0x60, 0xE91D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E91D: STEP; FETCH(0x8E, 0xE920); operand = 0x0286; ABSO; STX; 
+L_E920: STEP; FETCH(0x60, 0xE921); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E975: STEP; FETCH(0xA5, 0xE977); operand = 0x00AC; ZP; LDA(MEM); 
+L_E977: STEP; FETCH(0x48, 0xE978); operand = 0x0000; IMP; PHA; 
+L_E978: STEP; FETCH(0xA5, 0xE97A); operand = 0x00AD; ZP; LDA(MEM); 
+L_E97A: STEP; FETCH(0x48, 0xE97B); operand = 0x0000; IMP; PHA; 
+L_E97B: STEP; FETCH(0xA5, 0xE97D); operand = 0x00AE; ZP; LDA(MEM); 
+L_E97D: STEP; FETCH(0x48, 0xE97E); operand = 0x0000; IMP; PHA; 
+L_E97E: STEP; FETCH(0xA5, 0xE980); operand = 0x00AF; ZP; LDA(MEM); 
+L_E980: STEP; FETCH(0x48, 0xE981); operand = 0x0000; IMP; PHA; 
+L_E981: STEP; FETCH(0xA2, 0xE983); operand = 0x00FF; IMM; LDX(IMMV); 
+L_E983: STEP; FETCH(0xC6, 0xE985); operand = 0x00D6; ZP; DEC; 
+L_E985: STEP; FETCH(0xC6, 0xE987); operand = 0x00C9; ZP; DEC; 
+L_E987: STEP; FETCH(0xC6, 0xE989); operand = 0x00F2; ZP; DEC; 
+L_E989: STEP; FETCH(0xE8, 0xE98A); operand = 0x0000; IMP; INX; 
+L_E98A: STEP; FETCH(0x20, 0xE98D); operand = 0xEA7E; ABSO; JSR; goto L_EA7E;
+L_E98D: STEP; FETCH(0xE0, 0xE98F); operand = 0x0016; IMM; CPX(IMMV); 
+L_E98F: STEP; FETCH(0xB0, 0xE991); operand = 0x000C; REL; BCS; if (pc != 0xE991) goto L_E99D; 
+L_E991: STEP; FETCH(0xBD, 0xE994); operand = 0xEDFE; ABSX(1); LDA(MEM); 
+L_E994: STEP; FETCH(0x85, 0xE996); operand = 0x00AC; ZP; STA; 
+L_E996: STEP; FETCH(0xB5, 0xE998); operand = 0x00DA; ZPX; LDA(MEM); 
+L_E998: STEP; FETCH(0x20, 0xE99B); operand = 0xEA56; ABSO; JSR; goto L_EA56;
+L_E99B: STEP; FETCH(0x30, 0xE99D); operand = 0x00EC; REL; BMI; if (pc != 0xE99D) goto L_E989; 
+L_E99D: STEP; FETCH(0x20, 0xE9A0); operand = 0xEA8D; ABSO; JSR; goto L_EA8D;
+L_E9A0: STEP; FETCH(0xA2, 0xE9A2); operand = 0x0000; IMM; LDX(IMMV); 
+L_E9A2: STEP; FETCH(0xB5, 0xE9A4); operand = 0x00D9; ZPX; LDA(MEM); 
+L_E9A4: STEP; FETCH(0x29, 0xE9A6); operand = 0x007F; IMM; AND(IMMV); 
+L_E9A6: STEP; FETCH(0xB4, 0xE9A8); operand = 0x00DA; ZPX; LDY(MEM); 
+L_E9A8: STEP; FETCH(0x10, 0xE9AA); operand = 0x0002; REL; BPL; if (pc != 0xE9AA) goto L_E9AC; 
+L_E9AA: STEP; FETCH(0x09, 0xE9AC); operand = 0x0080; IMM; ORA(IMMV); 
+L_E9AC: STEP; FETCH(0x95, 0xE9AE); operand = 0x00D9; ZPX; STA; 
+L_E9AE: STEP; FETCH(0xE8, 0xE9AF); operand = 0x0000; IMP; INX; 
+L_E9AF: STEP; FETCH(0xE0, 0xE9B1); operand = 0x0016; IMM; CPX(IMMV); 
+L_E9B1: STEP; FETCH(0xD0, 0xE9B3); operand = 0x00EF; REL; BNE; if (pc != 0xE9B3) goto L_E9A2; 
+L_E9B3: STEP; FETCH(0xA5, 0xE9B5); operand = 0x00EF; ZP; LDA(MEM); 
+L_E9B5: STEP; FETCH(0x09, 0xE9B7); operand = 0x0080; IMM; ORA(IMMV); 
+L_E9B7: STEP; FETCH(0x85, 0xE9B9); operand = 0x00EF; ZP; STA; 
+L_E9B9: STEP; FETCH(0xA5, 0xE9BB); operand = 0x00D9; ZP; LDA(MEM); 
+L_E9BB: STEP; FETCH(0x10, 0xE9BD); operand = 0x00C4; REL; BPL; if (pc != 0xE9BD) goto L_E981; 
+L_E9BD: STEP; FETCH(0xE6, 0xE9BF); operand = 0x00D6; ZP; INC; 
+L_E9BF: STEP; FETCH(0xE6, 0xE9C1); operand = 0x00F2; ZP; INC; 
+L_E9C1: STEP; FETCH(0xA9, 0xE9C3); operand = 0x00FB; IMM; LDA(IMMV); 
+L_E9C3: STEP; FETCH(0x8D, 0xE9C6); operand = 0x9120; ABSO; STA; 
+L_E9C6: STEP; FETCH(0xAD, 0xE9C9); operand = 0x9121; ABSO; LDA(MEM); 
+L_E9C9: STEP; FETCH(0xC9, 0xE9CB); operand = 0x00FE; IMM; CMP(IMMV); 
+L_E9CB: STEP; FETCH(0x08, 0xE9CC); operand = 0x0000; IMP; PHP; 
+L_E9CC: STEP; FETCH(0xA9, 0xE9CE); operand = 0x00F7; IMM; LDA(IMMV); 
+L_E9CE: STEP; FETCH(0x8D, 0xE9D1); operand = 0x9120; ABSO; STA; 
+L_E9D1: STEP; FETCH(0x28, 0xE9D2); operand = 0x0000; IMP; PLP; 
+L_E9D2: STEP; FETCH(0xD0, 0xE9D4); operand = 0x000B; REL; BNE; if (pc != 0xE9D4) goto L_E9DF; 
+L_E9D4: STEP; FETCH(0xA0, 0xE9D6); operand = 0x0000; IMM; LDY(IMMV); 
+L_E9D6: STEP; FETCH(0xEA, 0xE9D7); operand = 0x0000; IMP; NOP; 
+L_E9D7: STEP; FETCH(0xCA, 0xE9D8); operand = 0x0000; IMP; DEX; 
+L_E9D8: STEP; FETCH(0xD0, 0xE9DA); operand = 0x00FC; REL; BNE; if (pc != 0xE9DA) goto L_E9D6; 
+L_E9DA: STEP; FETCH(0x88, 0xE9DB); operand = 0x0000; IMP; DEY; 
+L_E9DB: STEP; FETCH(0xD0, 0xE9DD); operand = 0x00F9; REL; BNE; if (pc != 0xE9DD) goto L_E9D6; 
+L_E9DD: STEP; FETCH(0x84, 0xE9DF); operand = 0x00C6; ZP; STY; 
+L_E9DF: STEP; FETCH(0xA6, 0xE9E1); operand = 0x00D6; ZP; LDX(MEM); 
+L_E9E1: STEP; FETCH(0x68, 0xE9E2); operand = 0x0000; IMP; PLA; 
+L_E9E2: STEP; FETCH(0x85, 0xE9E4); operand = 0x00AF; ZP; STA; 
+L_E9E4: STEP; FETCH(0x68, 0xE9E5); operand = 0x0000; IMP; PLA; 
+L_E9E5: STEP; FETCH(0x85, 0xE9E7); operand = 0x00AE; ZP; STA; 
+L_E9E7: STEP; FETCH(0x68, 0xE9E8); operand = 0x0000; IMP; PLA; 
+L_E9E8: STEP; FETCH(0x85, 0xE9EA); operand = 0x00AD; ZP; STA; 
+L_E9EA: STEP; FETCH(0x68, 0xE9EB); operand = 0x0000; IMP; PLA; 
+L_E9EB: STEP; FETCH(0x85, 0xE9ED); operand = 0x00AC; ZP; STA; 
+L_E9ED: STEP; FETCH(0x60, 0xE9EE); operand = 0x0000; IMP; RTS; goto dispatch;
+L_E9EE: STEP; FETCH(0xA6, 0xE9F0); operand = 0x00D6; ZP; LDX(MEM); 
+L_E9F0: STEP; FETCH(0xE8, 0xE9F1); operand = 0x0000; IMP; INX; 
+L_E9F1: STEP; FETCH(0xB5, 0xE9F3); operand = 0x00D9; ZPX; LDA(MEM); 
+L_E9F3: STEP; FETCH(0x10, 0xE9F5); operand = 0x00FB; REL; BPL; if (pc != 0xE9F5) goto L_E9F0; 
+L_E9F5: STEP; FETCH(0x86, 0xE9F7); operand = 0x00F2; ZP; STX; 
+L_E9F7: STEP; FETCH(0xE0, 0xE9F9); operand = 0x0016; IMM; CPX(IMMV); 
+L_E9F9: STEP; FETCH(0xF0, 0xE9FB); operand = 0x000D; REL; BEQ; if (pc != 0xE9FB) goto L_EA08; 
+L_E9FB: STEP; FETCH(0x90, 0xE9FD); operand = 0x000B; REL; BCC; if (pc != 0xE9FD) goto L_EA08; 
+L_E9FD: STEP; FETCH(0x20, 0xEA00); operand = 0xE975; ABSO; JSR; goto L_E975;
+L_EA00: STEP; FETCH(0xA6, 0xEA02); operand = 0x00F2; ZP; LDX(MEM); 
+L_EA02: STEP; FETCH(0xCA, 0xEA03); operand = 0x0000; IMP; DEX; 
+L_EA03: STEP; FETCH(0xC6, 0xEA05); operand = 0x00D6; ZP; DEC; 
+L_EA05: STEP; FETCH(0x4C, 0xEA08); operand = 0xE70E; ABSO; JMP; goto L_E70E;
+L_EA08: STEP; FETCH(0xA5, 0xEA0A); operand = 0x00AC; ZP; LDA(MEM); 
+L_EA0A: STEP; FETCH(0x48, 0xEA0B); operand = 0x0000; IMP; PHA; 
+L_EA0B: STEP; FETCH(0xA5, 0xEA0D); operand = 0x00AD; ZP; LDA(MEM); 
+L_EA0D: STEP; FETCH(0x48, 0xEA0E); operand = 0x0000; IMP; PHA; 
+L_EA0E: STEP; FETCH(0xA5, 0xEA10); operand = 0x00AE; ZP; LDA(MEM); 
+L_EA10: STEP; FETCH(0x48, 0xEA11); operand = 0x0000; IMP; PHA; 
+L_EA11: STEP; FETCH(0xA5, 0xEA13); operand = 0x00AF; ZP; LDA(MEM); 
+L_EA13: STEP; FETCH(0x48, 0xEA14); operand = 0x0000; IMP; PHA; 
+L_EA14: STEP; FETCH(0xA2, 0xEA16); operand = 0x0017; IMM; LDX(IMMV); 
+L_EA16: STEP; FETCH(0xCA, 0xEA17); operand = 0x0000; IMP; DEX; 
+L_EA17: STEP; FETCH(0x20, 0xEA1A); operand = 0xEA7E; ABSO; JSR; goto L_EA7E;
+L_EA1A: STEP; FETCH(0xE4, 0xEA1C); operand = 0x00F2; ZP; CPX(MEM); 
+L_EA1C: STEP; FETCH(0x90, 0xEA1E); operand = 0x000E; REL; BCC; if (pc != 0xEA1E) goto L_EA2C; 
+L_EA1E: STEP; FETCH(0xF0, 0xEA20); operand = 0x000C; REL; BEQ; if (pc != 0xEA20) goto L_EA2C; 
+L_EA20: STEP; FETCH(0xBD, 0xEA23); operand = 0xEDFC; ABSX(1); LDA(MEM); 
+L_EA23: STEP; FETCH(0x85, 0xEA25); operand = 0x00AC; ZP; STA; 
+L_EA25: STEP; FETCH(0xB5, 0xEA27); operand = 0x00D8; ZPX; LDA(MEM); 
+L_EA27: STEP; FETCH(0x20, 0xEA2A); operand = 0xEA56; ABSO; JSR; goto L_EA56;
+L_EA2A: STEP; FETCH(0x30, 0xEA2C); operand = 0x00EA; REL; BMI; if (pc != 0xEA2C) goto L_EA16; 
+L_EA2C: STEP; FETCH(0x20, 0xEA2F); operand = 0xEA8D; ABSO; JSR; goto L_EA8D;
+L_EA2F: STEP; FETCH(0xA2, 0xEA31); operand = 0x0015; IMM; LDX(IMMV); 
+L_EA31: STEP; FETCH(0xE4, 0xEA33); operand = 0x00F2; ZP; CPX(MEM); 
+L_EA33: STEP; FETCH(0x90, 0xEA35); operand = 0x000F; REL; BCC; if (pc != 0xEA35) goto L_EA44; 
+L_EA35: STEP; FETCH(0xB5, 0xEA37); operand = 0x00DA; ZPX; LDA(MEM); 
+L_EA37: STEP; FETCH(0x29, 0xEA39); operand = 0x007F; IMM; AND(IMMV); 
+L_EA39: STEP; FETCH(0xB4, 0xEA3B); operand = 0x00D9; ZPX; LDY(MEM); 
+L_EA3B: STEP; FETCH(0x10, 0xEA3D); operand = 0x0002; REL; BPL; if (pc != 0xEA3D) goto L_EA3F; 
+L_EA3D: STEP; FETCH(0x09, 0xEA3F); operand = 0x0080; IMM; ORA(IMMV); 
+L_EA3F: STEP; FETCH(0x95, 0xEA41); operand = 0x00DA; ZPX; STA; 
+L_EA41: STEP; FETCH(0xCA, 0xEA42); operand = 0x0000; IMP; DEX; 
+L_EA42: STEP; FETCH(0xD0, 0xEA44); operand = 0x00ED; REL; BNE; if (pc != 0xEA44) goto L_EA31; 
+L_EA44: STEP; FETCH(0xA6, 0xEA46); operand = 0x00F2; ZP; LDX(MEM); 
+L_EA46: STEP; FETCH(0x20, 0xEA49); operand = 0xE70E; ABSO; JSR; goto L_E70E;
+L_EA49: STEP; FETCH(0x68, 0xEA4A); operand = 0x0000; IMP; PLA; 
+L_EA4A: STEP; FETCH(0x85, 0xEA4C); operand = 0x00AF; ZP; STA; 
+L_EA4C: STEP; FETCH(0x68, 0xEA4D); operand = 0x0000; IMP; PLA; 
+L_EA4D: STEP; FETCH(0x85, 0xEA4F); operand = 0x00AE; ZP; STA; 
+L_EA4F: STEP; FETCH(0x68, 0xEA50); operand = 0x0000; IMP; PLA; 
+L_EA50: STEP; FETCH(0x85, 0xEA52); operand = 0x00AD; ZP; STA; 
+L_EA52: STEP; FETCH(0x68, 0xEA53); operand = 0x0000; IMP; PLA; 
+L_EA53: STEP; FETCH(0x85, 0xEA55); operand = 0x00AC; ZP; STA; 
+L_EA55: STEP; FETCH(0x60, 0xEA56); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EA56: STEP; FETCH(0x29, 0xEA58); operand = 0x0003; IMM; AND(IMMV); 
+L_EA58: STEP; FETCH(0x0D, 0xEA5B); operand = 0x0288; ABSO; ORA(MEM); 
+L_EA5B: STEP; FETCH(0x85, 0xEA5D); operand = 0x00AD; ZP; STA; 
+L_EA5D: STEP; FETCH(0x20, 0xEA60); operand = 0xEA6E; ABSO; JSR; goto L_EA6E;
+L_EA60: STEP; FETCH(0xA0, 0xEA62); operand = 0x0015; IMM; LDY(IMMV); 
+L_EA62: STEP; FETCH(0xB1, 0xEA64); operand = 0x00AC; INDY(1); LDA(MEM); 
+L_EA64: STEP; FETCH(0x91, 0xEA66); operand = 0x00D1; INDY(0); STA; 
+L_EA66: STEP; FETCH(0xB1, 0xEA68); operand = 0x00AE; INDY(1); LDA(MEM); 
+L_EA68: STEP; FETCH(0x91, 0xEA6A); operand = 0x00F3; INDY(0); STA; 
+L_EA6A: STEP; FETCH(0x88, 0xEA6B); operand = 0x0000; IMP; DEY; 
+L_EA6B: STEP; FETCH(0x10, 0xEA6D); operand = 0x00F5; REL; BPL; if (pc != 0xEA6D) goto L_EA62; 
+L_EA6D: STEP; FETCH(0x60, 0xEA6E); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EA6E: STEP; FETCH(0x20, 0xEA71); operand = 0xEAB2; ABSO; JSR; goto L_EAB2;
+L_EA71: STEP; FETCH(0xA5, 0xEA73); operand = 0x00AC; ZP; LDA(MEM); 
+L_EA73: STEP; FETCH(0x85, 0xEA75); operand = 0x00AE; ZP; STA; 
+L_EA75: STEP; FETCH(0xA5, 0xEA77); operand = 0x00AD; ZP; LDA(MEM); 
+L_EA77: STEP; FETCH(0x29, 0xEA79); operand = 0x0003; IMM; AND(IMMV); 
+L_EA79: STEP; FETCH(0x09, 0xEA7B); operand = 0x0094; IMM; ORA(IMMV); 
+L_EA7B: STEP; FETCH(0x85, 0xEA7D); operand = 0x00AF; ZP; STA; 
+L_EA7D: STEP; FETCH(0x60, 0xEA7E); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EA7E: STEP; FETCH(0xBD, 0xEA81); operand = 0xEDFD; ABSX(1); LDA(MEM); 
+L_EA81: STEP; FETCH(0x85, 0xEA83); operand = 0x00D1; ZP; STA; 
+L_EA83: STEP; FETCH(0xB5, 0xEA85); operand = 0x00D9; ZPX; LDA(MEM); 
+L_EA85: STEP; FETCH(0x29, 0xEA87); operand = 0x0003; IMM; AND(IMMV); 
+L_EA87: STEP; FETCH(0x0D, 0xEA8A); operand = 0x0288; ABSO; ORA(MEM); 
+L_EA8A: STEP; FETCH(0x85, 0xEA8C); operand = 0x00D2; ZP; STA; 
+L_EA8C: STEP; FETCH(0x60, 0xEA8D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EA8D: STEP; FETCH(0xA0, 0xEA8F); operand = 0x0015; IMM; LDY(IMMV); 
+L_EA8F: STEP; FETCH(0x20, 0xEA92); operand = 0xEA7E; ABSO; JSR; goto L_EA7E;
+L_EA92: STEP; FETCH(0x20, 0xEA95); operand = 0xEAB2; ABSO; JSR; goto L_EAB2;
+L_EA95: STEP; FETCH(0xA9, 0xEA97); operand = 0x0020; IMM; LDA(IMMV); 
+L_EA97: STEP; FETCH(0x91, 0xEA99); operand = 0x00D1; INDY(0); STA; 
+L_EA99: STEP; FETCH(0xA9, 0xEA9B); operand = 0x0001; IMM; LDA(IMMV); 
+L_EA9B: STEP; FETCH(0x91, 0xEA9D); operand = 0x00F3; INDY(0); STA; 
+L_EA9D: STEP; FETCH(0x88, 0xEA9E); operand = 0x0000; IMP; DEY; 
+L_EA9E: STEP; FETCH(0x10, 0xEAA0); operand = 0x00F5; REL; BPL; if (pc != 0xEAA0) goto L_EA95; 
+L_EAA0: STEP; FETCH(0x60, 0xEAA1); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EAA1: STEP; FETCH(0xA8, 0xEAA2); operand = 0x0000; IMP; TAY; 
+L_EAA2: STEP; FETCH(0xA9, 0xEAA4); operand = 0x0002; IMM; LDA(IMMV); 
+L_EAA4: STEP; FETCH(0x85, 0xEAA6); operand = 0x00CD; ZP; STA; 
+L_EAA6: STEP; FETCH(0x20, 0xEAA9); operand = 0xEAB2; ABSO; JSR; goto L_EAB2;
+L_EAA9: STEP; FETCH(0x98, 0xEAAA); operand = 0x0000; IMP; TYA; 
+L_EAAA: STEP; FETCH(0xA4, 0xEAAC); operand = 0x00D3; ZP; LDY(MEM); 
+L_EAAC: STEP; FETCH(0x91, 0xEAAE); operand = 0x00D1; INDY(0); STA; 
+L_EAAE: STEP; FETCH(0x8A, 0xEAAF); operand = 0x0000; IMP; TXA; 
+L_EAAF: STEP; FETCH(0x91, 0xEAB1); operand = 0x00F3; INDY(0); STA; 
+L_EAB1: STEP; FETCH(0x60, 0xEAB2); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EAB2: STEP; FETCH(0xA5, 0xEAB4); operand = 0x00D1; ZP; LDA(MEM); 
+L_EAB4: STEP; FETCH(0x85, 0xEAB6); operand = 0x00F3; ZP; STA; 
+L_EAB6: STEP; FETCH(0xA5, 0xEAB8); operand = 0x00D2; ZP; LDA(MEM); 
+L_EAB8: STEP; FETCH(0x29, 0xEABA); operand = 0x0003; IMM; AND(IMMV); 
+L_EABA: STEP; FETCH(0x09, 0xEABC); operand = 0x0094; IMM; ORA(IMMV); 
+L_EABC: STEP; FETCH(0x85, 0xEABE); operand = 0x00F4; ZP; STA; 
+L_EABE: STEP; FETCH(0x60, 0xEABF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EABF: STEP; FETCH(0x20, 0xEAC2); operand = 0xFFEA; ABSO; JSR; goto L_FFEA;
+L_EAC2: STEP; FETCH(0xA5, 0xEAC4); operand = 0x00CC; ZP; LDA(MEM); 
+L_EAC4: STEP; FETCH(0xD0, 0xEAC6); operand = 0x0029; REL; BNE; if (pc != 0xEAC6) goto L_EAEF; 
+L_EAC6: STEP; FETCH(0xC6, 0xEAC8); operand = 0x00CD; ZP; DEC; 
+L_EAC8: STEP; FETCH(0xD0, 0xEACA); operand = 0x0025; REL; BNE; if (pc != 0xEACA) goto L_EAEF; 
+L_EACA: STEP; FETCH(0xA9, 0xEACC); operand = 0x0014; IMM; LDA(IMMV); 
+L_EACC: STEP; FETCH(0x85, 0xEACE); operand = 0x00CD; ZP; STA; 
+L_EACE: STEP; FETCH(0xA4, 0xEAD0); operand = 0x00D3; ZP; LDY(MEM); 
+L_EAD0: STEP; FETCH(0x46, 0xEAD2); operand = 0x00CF; ZP; LSR; 
+L_EAD2: STEP; FETCH(0xAE, 0xEAD5); operand = 0x0287; ABSO; LDX(MEM); 
+L_EAD5: STEP; FETCH(0xB1, 0xEAD7); operand = 0x00D1; INDY(1); LDA(MEM); 
+L_EAD7: STEP; FETCH(0xB0, 0xEAD9); operand = 0x0011; REL; BCS; if (pc != 0xEAD9) goto L_EAEA; 
+L_EAD9: STEP; FETCH(0xE6, 0xEADB); operand = 0x00CF; ZP; INC; 
+L_EADB: STEP; FETCH(0x85, 0xEADD); operand = 0x00CE; ZP; STA; 
+L_EADD: STEP; FETCH(0x20, 0xEAE0); operand = 0xEAB2; ABSO; JSR; goto L_EAB2;
+L_EAE0: STEP; FETCH(0xB1, 0xEAE2); operand = 0x00F3; INDY(1); LDA(MEM); 
+L_EAE2: STEP; FETCH(0x8D, 0xEAE5); operand = 0x0287; ABSO; STA; 
+L_EAE5: STEP; FETCH(0xAE, 0xEAE8); operand = 0x0286; ABSO; LDX(MEM); 
+L_EAE8: STEP; FETCH(0xA5, 0xEAEA); operand = 0x00CE; ZP; LDA(MEM); 
+L_EAEA: STEP; FETCH(0x49, 0xEAEC); operand = 0x0080; IMM; EOR(IMMV); 
+L_EAEC: STEP; FETCH(0x20, 0xEAEF); operand = 0xEAAA; ABSO; JSR; goto L_EAAA;
+L_EAEF: STEP; FETCH(0xAD, 0xEAF2); operand = 0x911F; ABSO; LDA(MEM); 
+L_EAF2: STEP; FETCH(0x29, 0xEAF4); operand = 0x0040; IMM; AND(IMMV); 
+L_EAF4: STEP; FETCH(0xF0, 0xEAF6); operand = 0x000B; REL; BEQ; if (pc != 0xEAF6) goto L_EB01; 
+L_EAF6: STEP; FETCH(0xA0, 0xEAF8); operand = 0x0000; IMM; LDY(IMMV); 
+L_EAF8: STEP; FETCH(0x84, 0xEAFA); operand = 0x00C0; ZP; STY; 
+L_EAFA: STEP; FETCH(0xAD, 0xEAFD); operand = 0x911C; ABSO; LDA(MEM); 
+L_EAFD: STEP; FETCH(0x09, 0xEAFF); operand = 0x0002; IMM; ORA(IMMV); 
+L_EAFF: STEP; FETCH(0xD0, 0xEB01); operand = 0x0009; REL; BNE; if (pc != 0xEB01) goto L_EB0A; 
+L_EB01: STEP; FETCH(0xA5, 0xEB03); operand = 0x00C0; ZP; LDA(MEM); 
+L_EB03: STEP; FETCH(0xD0, 0xEB05); operand = 0x000D; REL; BNE; if (pc != 0xEB05) goto L_EB12; 
+L_EB05: STEP; FETCH(0xAD, 0xEB08); operand = 0x911C; ABSO; LDA(MEM); 
+L_EB08: STEP; FETCH(0x29, 0xEB0A); operand = 0x00FD; IMM; AND(IMMV); 
+L_EB0A: STEP; FETCH(0x2C, 0xEB0D); operand = 0x911E; ABSO; BIT(MEM); 
+L_EB0D: STEP; FETCH(0x70, 0xEB0F); operand = 0x0003; REL; BVS; if (pc != 0xEB0F) goto L_EB12; 
+L_EB0F: STEP; FETCH(0x8D, 0xEB12); operand = 0x911C; ABSO; STA; 
+L_EB12: STEP; FETCH(0x20, 0xEB15); operand = 0xEB1E; ABSO; JSR; goto L_EB1E;
+L_EB15: STEP; FETCH(0x2C, 0xEB18); operand = 0x9124; ABSO; BIT(MEM); 
+L_EB18: STEP; FETCH(0x68, 0xEB19); operand = 0x0000; IMP; PLA; 
+L_EB19: STEP; FETCH(0xA8, 0xEB1A); operand = 0x0000; IMP; TAY; 
+L_EB1A: STEP; FETCH(0x68, 0xEB1B); operand = 0x0000; IMP; PLA; 
+L_EB1B: STEP; FETCH(0xAA, 0xEB1C); operand = 0x0000; IMP; TAX; 
+L_EB1C: STEP; FETCH(0x68, 0xEB1D); operand = 0x0000; IMP; PLA; 
+L_EB1D: STEP; FETCH(0x40, 0xEB1E); operand = 0x0000; IMP; RTI; goto dispatch;
+L_EB1E: STEP; FETCH(0xA9, 0xEB20); operand = 0x0000; IMM; LDA(IMMV); 
+L_EB20: STEP; FETCH(0x8D, 0xEB23); operand = 0x028D; ABSO; STA; 
+L_EB23: STEP; FETCH(0xA0, 0xEB25); operand = 0x0040; IMM; LDY(IMMV); 
+L_EB25: STEP; FETCH(0x84, 0xEB27); operand = 0x00CB; ZP; STY; 
+L_EB27: STEP; FETCH(0x8D, 0xEB2A); operand = 0x9120; ABSO; STA; 
+L_EB2A: STEP; FETCH(0xAE, 0xEB2D); operand = 0x9121; ABSO; LDX(MEM); 
+L_EB2D: STEP; FETCH(0xE0, 0xEB2F); operand = 0x00FF; IMM; CPX(IMMV); 
+L_EB2F: STEP; FETCH(0xF0, 0xEB31); operand = 0x005E; REL; BEQ; if (pc != 0xEB31) goto L_EB8F; 
+L_EB31: STEP; FETCH(0xA9, 0xEB33); operand = 0x00FE; IMM; LDA(IMMV); 
+L_EB33: STEP; FETCH(0x8D, 0xEB36); operand = 0x9120; ABSO; STA; 
+L_EB36: STEP; FETCH(0xA0, 0xEB38); operand = 0x0000; IMM; LDY(IMMV); 
+L_EB38: STEP; FETCH(0xA9, 0xEB3A); operand = 0x005E; IMM; LDA(IMMV); 
+L_EB3A: STEP; FETCH(0x85, 0xEB3C); operand = 0x00F5; ZP; STA; 
+L_EB3C: STEP; FETCH(0xA9, 0xEB3E); operand = 0x00EC; IMM; LDA(IMMV); 
+L_EB3E: STEP; FETCH(0x85, 0xEB40); operand = 0x00F6; ZP; STA; 
+L_EB40: STEP; FETCH(0xA2, 0xEB42); operand = 0x0008; IMM; LDX(IMMV); 
+L_EB42: STEP; FETCH(0xAD, 0xEB45); operand = 0x9121; ABSO; LDA(MEM); 
+L_EB45: STEP; FETCH(0xCD, 0xEB48); operand = 0x9121; ABSO; CMP(MEM); 
+L_EB48: STEP; FETCH(0xD0, 0xEB4A); operand = 0x00F6; REL; BNE; if (pc != 0xEB4A) goto L_EB40; 
+L_EB4A: STEP; FETCH(0x4A, 0xEB4B); operand = 0x0000; ACC; LSR_A; 
+L_EB4B: STEP; FETCH(0xB0, 0xEB4D); operand = 0x0016; REL; BCS; if (pc != 0xEB4D) goto L_EB63; 
+L_EB4D: STEP; FETCH(0x48, 0xEB4E); operand = 0x0000; IMP; PHA; 
+L_EB4E: STEP; FETCH(0xB1, 0xEB50); operand = 0x00F5; INDY(1); LDA(MEM); 
+L_EB50: STEP; FETCH(0xC9, 0xEB52); operand = 0x0005; IMM; CMP(IMMV); 
+L_EB52: STEP; FETCH(0xB0, 0xEB54); operand = 0x000C; REL; BCS; if (pc != 0xEB54) goto L_EB60; 
+L_EB54: STEP; FETCH(0xC9, 0xEB56); operand = 0x0003; IMM; CMP(IMMV); 
+L_EB56: STEP; FETCH(0xF0, 0xEB58); operand = 0x0008; REL; BEQ; if (pc != 0xEB58) goto L_EB60; 
+L_EB58: STEP; FETCH(0x0D, 0xEB5B); operand = 0x028D; ABSO; ORA(MEM); 
+L_EB5B: STEP; FETCH(0x8D, 0xEB5E); operand = 0x028D; ABSO; STA; 
+L_EB5E: STEP; FETCH(0x10, 0xEB60); operand = 0x0002; REL; BPL; if (pc != 0xEB60) goto L_EB62; 
+L_EB60: STEP; FETCH(0x84, 0xEB62); operand = 0x00CB; ZP; STY; 
+L_EB62: STEP; FETCH(0x68, 0xEB63); operand = 0x0000; IMP; PLA; 
+L_EB63: STEP; FETCH(0xC8, 0xEB64); operand = 0x0000; IMP; INY; 
+L_EB64: STEP; FETCH(0xC0, 0xEB66); operand = 0x0041; IMM; CPY(IMMV); 
+L_EB66: STEP; FETCH(0xB0, 0xEB68); operand = 0x0009; REL; BCS; if (pc != 0xEB68) goto L_EB71; 
+L_EB68: STEP; FETCH(0xCA, 0xEB69); operand = 0x0000; IMP; DEX; 
+L_EB69: STEP; FETCH(0xD0, 0xEB6B); operand = 0x00DF; REL; BNE; if (pc != 0xEB6B) goto L_EB4A; 
+L_EB6B: STEP; FETCH(0x38, 0xEB6C); operand = 0x0000; IMP; SEC; 
+L_EB6C: STEP; FETCH(0x2E, 0xEB6F); operand = 0x9120; ABSO; ROL; 
+L_EB6F: STEP; FETCH(0xD0, 0xEB71); operand = 0x00CF; REL; BNE; if (pc != 0xEB71) goto L_EB40; 
+L_EB71: STEP; FETCH(0x6C, 0xEB74); operand = 0x028F; IND; JMP; goto dispatch;
+L_EB8F: STEP; FETCH(0xF0, 0xEB91); operand = 0x0029; REL; BEQ; if (pc != 0xEB91) goto L_EBBA; 
+L_EB91: STEP; FETCH(0xC9, 0xEB93); operand = 0x0014; IMM; CMP(IMMV); 
+L_EB93: STEP; FETCH(0xF0, 0xEB95); operand = 0x000C; REL; BEQ; if (pc != 0xEB95) goto L_EBA1; 
+L_EB95: STEP; FETCH(0xC9, 0xEB97); operand = 0x0020; IMM; CMP(IMMV); 
+L_EB97: STEP; FETCH(0xF0, 0xEB99); operand = 0x0008; REL; BEQ; if (pc != 0xEB99) goto L_EBA1; 
+L_EB99: STEP; FETCH(0xC9, 0xEB9B); operand = 0x001D; IMM; CMP(IMMV); 
+L_EB9B: STEP; FETCH(0xF0, 0xEB9D); operand = 0x0004; REL; BEQ; if (pc != 0xEB9D) goto L_EBA1; 
+L_EB9D: STEP; FETCH(0xC9, 0xEB9F); operand = 0x0011; IMM; CMP(IMMV); 
+L_EB9F: STEP; FETCH(0xD0, 0xEBA1); operand = 0x0035; REL; BNE; if (pc != 0xEBA1) goto L_EBD6; 
+L_EBA1: STEP; FETCH(0xAC, 0xEBA4); operand = 0x028C; ABSO; LDY(MEM); 
+L_EBA4: STEP; FETCH(0xF0, 0xEBA6); operand = 0x0005; REL; BEQ; if (pc != 0xEBA6) goto L_EBAB; 
+L_EBA6: STEP; FETCH(0xCE, 0xEBA9); operand = 0x028C; ABSO; DEC; 
+L_EBA9: STEP; FETCH(0xD0, 0xEBAB); operand = 0x002B; REL; BNE; if (pc != 0xEBAB) goto L_EBD6; 
+L_EBAB: STEP; FETCH(0xCE, 0xEBAE); operand = 0x028B; ABSO; DEC; 
+L_EBAE: STEP; FETCH(0xD0, 0xEBB0); operand = 0x0026; REL; BNE; if (pc != 0xEBB0) goto L_EBD6; 
+L_EBB0: STEP; FETCH(0xA0, 0xEBB2); operand = 0x0004; IMM; LDY(IMMV); 
+L_EBB2: STEP; FETCH(0x8C, 0xEBB5); operand = 0x028B; ABSO; STY; 
+L_EBB5: STEP; FETCH(0xA4, 0xEBB7); operand = 0x00C6; ZP; LDY(MEM); 
+L_EBB7: STEP; FETCH(0x88, 0xEBB8); operand = 0x0000; IMP; DEY; 
+L_EBB8: STEP; FETCH(0x10, 0xEBBA); operand = 0x001C; REL; BPL; if (pc != 0xEBBA) goto L_EBD6; 
+L_EBBA: STEP; FETCH(0xA4, 0xEBBC); operand = 0x00CB; ZP; LDY(MEM); 
+L_EBBC: STEP; FETCH(0x84, 0xEBBE); operand = 0x00C5; ZP; STY; 
+L_EBBE: STEP; FETCH(0xAC, 0xEBC1); operand = 0x028D; ABSO; LDY(MEM); 
+L_EBC1: STEP; FETCH(0x8C, 0xEBC4); operand = 0x028E; ABSO; STY; 
+L_EBC4: STEP; FETCH(0xE0, 0xEBC6); operand = 0x00FF; IMM; CPX(IMMV); 
+L_EBC6: STEP; FETCH(0xF0, 0xEBC8); operand = 0x000E; REL; BEQ; if (pc != 0xEBC8) goto L_EBD6; 
+L_EBC8: STEP; FETCH(0x8A, 0xEBC9); operand = 0x0000; IMP; TXA; 
+L_EBC9: STEP; FETCH(0xA6, 0xEBCB); operand = 0x00C6; ZP; LDX(MEM); 
+L_EBCB: STEP; FETCH(0xEC, 0xEBCE); operand = 0x0289; ABSO; CPX(MEM); 
+L_EBCE: STEP; FETCH(0xB0, 0xEBD0); operand = 0x0006; REL; BCS; if (pc != 0xEBD0) goto L_EBD6; 
+L_EBD0: STEP; FETCH(0x9D, 0xEBD3); operand = 0x0277; ABSX(0); STA; 
+L_EBD3: STEP; FETCH(0xE8, 0xEBD4); operand = 0x0000; IMP; INX; 
+L_EBD4: STEP; FETCH(0x86, 0xEBD6); operand = 0x00C6; ZP; STX; 
+L_EBD6: STEP; FETCH(0xA9, 0xEBD8); operand = 0x00F7; IMM; LDA(IMMV); 
+L_EBD8: STEP; FETCH(0x8D, 0xEBDB); operand = 0x9120; ABSO; STA; 
+L_EBDB: STEP; FETCH(0x60, 0xEBDC); operand = 0x0000; IMP; RTS; goto dispatch;
+L_ED21: STEP; FETCH(0xC9, 0xED23); operand = 0x000E; IMM; CMP(IMMV); 
+L_ED23: STEP; FETCH(0xD0, 0xED25); operand = 0x000B; REL; BNE; if (pc != 0xED25) goto L_ED30; 
+L_ED25: STEP; FETCH(0xA9, 0xED27); operand = 0x0002; IMM; LDA(IMMV); 
+L_ED27: STEP; FETCH(0x0D, 0xED2A); operand = 0x9005; ABSO; ORA(MEM); 
+L_ED2A: STEP; FETCH(0x8D, 0xED2D); operand = 0x9005; ABSO; STA; 
+L_ED2D: STEP; FETCH(0x4C, 0xED30); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_ED30: STEP; FETCH(0xC9, 0xED32); operand = 0x008E; IMM; CMP(IMMV); 
+L_ED32: STEP; FETCH(0xD0, 0xED34); operand = 0x000B; REL; BNE; if (pc != 0xED34) goto L_ED3F; 
+L_ED34: STEP; FETCH(0xA9, 0xED36); operand = 0x00FD; IMM; LDA(IMMV); 
+L_ED36: STEP; FETCH(0x2D, 0xED39); operand = 0x9005; ABSO; AND(MEM); 
+L_ED39: STEP; FETCH(0x8D, 0xED3C); operand = 0x9005; ABSO; STA; 
+L_ED3C: STEP; FETCH(0x4C, 0xED3F); operand = 0xE6DC; ABSO; JMP; goto L_E6DC;
+L_ED3F: STEP; FETCH(0xC9, 0xED41); operand = 0x0008; IMM; CMP(IMMV); 
+L_ED41: STEP; FETCH(0xD0, 0xED43); operand = 0x000A; REL; BNE; if (pc != 0xED43) goto L_ED4D; 
+L_ED43: STEP; FETCH(0xA9, 0xED45); operand = 0x0080; IMM; LDA(IMMV); 
+L_ED45: STEP; FETCH(0x0D, 0xED48); operand = 0x0291; ABSO; ORA(MEM); 
+L_ED48: STEP; FETCH(0x8D, 0xED4B); operand = 0x0291; ABSO; STA; 
+L_ED4B: STEP; FETCH(0x30, 0xED4D); operand = 0x00EF; REL; BMI; if (pc != 0xED4D) goto L_ED3C; 
+L_ED4D: STEP; FETCH(0xC9, 0xED4F); operand = 0x0009; IMM; CMP(IMMV); 
+L_ED4F: STEP; FETCH(0xD0, 0xED51); operand = 0x00EB; REL; BNE; if (pc != 0xED51) goto L_ED3C; 
+L_ED51: STEP; FETCH(0xA9, 0xED53); operand = 0x007F; IMM; LDA(IMMV); 
+L_ED53: STEP; FETCH(0x2D, 0xED56); operand = 0x0291; ABSO; AND(MEM); 
+L_ED56: STEP; FETCH(0x8D, 0xED59); operand = 0x0291; ABSO; STA; 
+L_ED59: STEP; FETCH(0x10, 0xED5B); operand = 0x00E1; REL; BPL; if (pc != 0xED5B) goto L_ED3C; 
+L_ED5B: STEP; FETCH(0xE8, 0xED5C); operand = 0x0000; IMP; INX; 
+L_ED5C: STEP; FETCH(0xB5, 0xED5E); operand = 0x00D9; ZPX; LDA(MEM); 
+L_ED5E: STEP; FETCH(0x09, 0xED60); operand = 0x0080; IMM; ORA(IMMV); 
+L_ED60: STEP; FETCH(0x95, 0xED62); operand = 0x00D9; ZPX; STA; 
+L_ED62: STEP; FETCH(0xCA, 0xED63); operand = 0x0000; IMP; DEX; 
+L_ED63: STEP; FETCH(0xA5, 0xED65); operand = 0x00D5; ZP; LDA(MEM); 
+L_ED65: STEP; FETCH(0x18, 0xED66); operand = 0x0000; IMP; CLC; 
+L_ED66: STEP; FETCH(0x4C, 0xED69); operand = 0xE715; ABSO; JMP; goto L_E715;
+L_EE14: STEP; FETCH(0x09, 0xEE16); operand = 0x0040; IMM; ORA(IMMV); 
+L_EE16: STEP; FETCH(0x2C, 0xEE19); operand = 0x2009; ABSO; BIT(MEM); goto L_EE19;
+L_EE17: STEP; FETCH(0x09, 0xEE19); operand = 0x0020; IMM; ORA(IMMV); 
+L_EE19: STEP; FETCH(0x20, 0xEE1C); operand = 0xF160; ABSO; JSR; goto L_F160;
+L_EE1C: STEP; FETCH(0x48, 0xEE1D); operand = 0x0000; IMP; PHA; 
+L_EE1D: STEP; FETCH(0x24, 0xEE1F); operand = 0x0094; ZP; BIT(MEM); 
+L_EE1F: STEP; FETCH(0x10, 0xEE21); operand = 0x000A; REL; BPL; if (pc != 0xEE21) goto L_EE2B; 
+L_EE21: STEP; FETCH(0x38, 0xEE22); operand = 0x0000; IMP; SEC; 
+L_EE22: STEP; FETCH(0x66, 0xEE24); operand = 0x00A3; ZP; ROR; 
+L_EE24: STEP; FETCH(0x20, 0xEE27); operand = 0xEE49; ABSO; JSR; goto L_EE49;
+L_EE27: STEP; FETCH(0x46, 0xEE29); operand = 0x0094; ZP; LSR; 
+L_EE29: STEP; FETCH(0x46, 0xEE2B); operand = 0x00A3; ZP; LSR; 
+L_EE2B: STEP; FETCH(0x68, 0xEE2C); operand = 0x0000; IMP; PLA; 
+L_EE2C: STEP; FETCH(0x85, 0xEE2E); operand = 0x0095; ZP; STA; 
+L_EE2E: STEP; FETCH(0x20, 0xEE31); operand = 0xE4A0; ABSO; JSR; goto L_E4A0;
+L_EE31: STEP; FETCH(0xC9, 0xEE33); operand = 0x003F; IMM; CMP(IMMV); 
+L_EE33: STEP; FETCH(0xD0, 0xEE35); operand = 0x0003; REL; BNE; if (pc != 0xEE35) goto L_EE38; 
+L_EE35: STEP; FETCH(0x20, 0xEE38); operand = 0xEF84; ABSO; JSR; goto L_EF84;
+L_EE38: STEP; FETCH(0xAD, 0xEE3B); operand = 0x911F; ABSO; LDA(MEM); 
+L_EE3B: STEP; FETCH(0x09, 0xEE3D); operand = 0x0080; IMM; ORA(IMMV); 
+L_EE3D: STEP; FETCH(0x8D, 0xEE40); operand = 0x911F; ABSO; STA; 
+L_EE40: STEP; FETCH(0x20, 0xEE43); operand = 0xEF8D; ABSO; JSR; goto L_EF8D;
+L_EE43: STEP; FETCH(0x20, 0xEE46); operand = 0xE4A0; ABSO; JSR; goto L_E4A0;
+L_EE46: STEP; FETCH(0x20, 0xEE49); operand = 0xEF96; ABSO; JSR; goto L_EF96;
+L_EE49: STEP; FETCH(0x78, 0xEE4A); operand = 0x0000; IMP; SEI; 
+L_EE4A: STEP; FETCH(0x20, 0xEE4D); operand = 0xE4A0; ABSO; JSR; goto L_E4A0;
+L_EE4D: STEP; FETCH(0x20, 0xEE50); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EE50: STEP; FETCH(0x4A, 0xEE51); operand = 0x0000; ACC; LSR_A; 
+L_EE51: STEP; FETCH(0xB0, 0xEE53); operand = 0x0061; REL; BCS; if (pc != 0xEE53) goto L_EEB4; 
+L_EE53: STEP; FETCH(0x20, 0xEE56); operand = 0xEF84; ABSO; JSR; goto L_EF84;
+L_EE56: STEP; FETCH(0x24, 0xEE58); operand = 0x00A3; ZP; BIT(MEM); 
+L_EE58: STEP; FETCH(0x10, 0xEE5A); operand = 0x000C; REL; BPL; if (pc != 0xEE5A) goto L_EE66; 
+L_EE5A: STEP; FETCH(0x20, 0xEE5D); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EE5D: STEP; FETCH(0x4A, 0xEE5E); operand = 0x0000; ACC; LSR_A; 
+L_EE5E: STEP; FETCH(0x90, 0xEE60); operand = 0x00FA; REL; BCC; if (pc != 0xEE60) goto L_EE5A; 
+L_EE60: STEP; FETCH(0x20, 0xEE63); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EE63: STEP; FETCH(0x4A, 0xEE64); operand = 0x0000; ACC; LSR_A; 
+L_EE64: STEP; FETCH(0xB0, 0xEE66); operand = 0x00FA; REL; BCS; if (pc != 0xEE66) goto L_EE60; 
+L_EE66: STEP; FETCH(0x20, 0xEE69); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EE69: STEP; FETCH(0x4A, 0xEE6A); operand = 0x0000; ACC; LSR_A; 
+L_EE6A: STEP; FETCH(0x90, 0xEE6C); operand = 0x00FA; REL; BCC; if (pc != 0xEE6C) goto L_EE66; 
+L_EE6C: STEP; FETCH(0x20, 0xEE6F); operand = 0xEF8D; ABSO; JSR; goto L_EF8D;
+L_EE6F: STEP; FETCH(0xA9, 0xEE71); operand = 0x0008; IMM; LDA(IMMV); 
+L_EE71: STEP; FETCH(0x85, 0xEE73); operand = 0x00A5; ZP; STA; 
+L_EE73: STEP; FETCH(0xAD, 0xEE76); operand = 0x911F; ABSO; LDA(MEM); 
+L_EE76: STEP; FETCH(0xCD, 0xEE79); operand = 0x911F; ABSO; CMP(MEM); 
+L_EE79: STEP; FETCH(0xD0, 0xEE7B); operand = 0x00F8; REL; BNE; if (pc != 0xEE7B) goto L_EE73; 
+L_EE7B: STEP; FETCH(0x4A, 0xEE7C); operand = 0x0000; ACC; LSR_A; 
+L_EE7C: STEP; FETCH(0x4A, 0xEE7D); operand = 0x0000; ACC; LSR_A; 
+L_EE7D: STEP; FETCH(0x90, 0xEE7F); operand = 0x0038; REL; BCC; if (pc != 0xEE7F) goto L_EEB7; 
+L_EE7F: STEP; FETCH(0x66, 0xEE81); operand = 0x0095; ZP; ROR; 
+L_EE81: STEP; FETCH(0xB0, 0xEE83); operand = 0x0005; REL; BCS; if (pc != 0xEE83) goto L_EE88; 
+L_EE83: STEP; FETCH(0x20, 0xEE86); operand = 0xE4A9; ABSO; JSR; goto L_E4A9;
+L_EE86: STEP; FETCH(0xD0, 0xEE88); operand = 0x0003; REL; BNE; if (pc != 0xEE88) goto L_EE8B; 
+L_EE88: STEP; FETCH(0x20, 0xEE8B); operand = 0xE4A0; ABSO; JSR; goto L_E4A0;
+L_EE8B: STEP; FETCH(0x20, 0xEE8E); operand = 0xEF84; ABSO; JSR; goto L_EF84;
+L_EE8E: STEP; FETCH(0xEA, 0xEE8F); operand = 0x0000; IMP; NOP; 
+L_EE8F: STEP; FETCH(0xEA, 0xEE90); operand = 0x0000; IMP; NOP; 
+L_EE90: STEP; FETCH(0xEA, 0xEE91); operand = 0x0000; IMP; NOP; 
+L_EE91: STEP; FETCH(0xEA, 0xEE92); operand = 0x0000; IMP; NOP; 
+L_EE92: STEP; FETCH(0xAD, 0xEE95); operand = 0x912C; ABSO; LDA(MEM); 
+L_EE95: STEP; FETCH(0x29, 0xEE97); operand = 0x00DF; IMM; AND(IMMV); 
+L_EE97: STEP; FETCH(0x09, 0xEE99); operand = 0x0002; IMM; ORA(IMMV); 
+L_EE99: STEP; FETCH(0x8D, 0xEE9C); operand = 0x912C; ABSO; STA; 
+L_EE9C: STEP; FETCH(0xC6, 0xEE9E); operand = 0x00A5; ZP; DEC; 
+L_EE9E: STEP; FETCH(0xD0, 0xEEA0); operand = 0x00D3; REL; BNE; if (pc != 0xEEA0) goto L_EE73; 
+L_EEA0: STEP; FETCH(0xA9, 0xEEA2); operand = 0x0004; IMM; LDA(IMMV); 
+L_EEA2: STEP; FETCH(0x8D, 0xEEA5); operand = 0x9129; ABSO; STA; 
+L_EEA5: STEP; FETCH(0xAD, 0xEEA8); operand = 0x912D; ABSO; LDA(MEM); 
+L_EEA8: STEP; FETCH(0x29, 0xEEAA); operand = 0x0020; IMM; AND(IMMV); 
+L_EEAA: STEP; FETCH(0xD0, 0xEEAC); operand = 0x000B; REL; BNE; if (pc != 0xEEAC) goto L_EEB7; 
+L_EEAC: STEP; FETCH(0x20, 0xEEAF); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EEAF: STEP; FETCH(0x4A, 0xEEB0); operand = 0x0000; ACC; LSR_A; 
+L_EEB0: STEP; FETCH(0xB0, 0xEEB2); operand = 0x00F3; REL; BCS; if (pc != 0xEEB2) goto L_EEA5; 
+L_EEB2: STEP; FETCH(0x58, 0xEEB3); operand = 0x0000; IMP; CLI; 
+L_EEB3: STEP; FETCH(0x60, 0xEEB4); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EEB4: STEP; FETCH(0xA9, 0xEEB6); operand = 0x0080; IMM; LDA(IMMV); 
+L_EEB6: STEP; FETCH(0x2C, 0xEEB9); operand = 0x03A9; ABSO; BIT(MEM); goto L_EEB9;
+L_EEB7: STEP; FETCH(0xA9, 0xEEB9); operand = 0x0003; IMM; LDA(IMMV); 
+L_EEB9: STEP; FETCH(0x20, 0xEEBC); operand = 0xFE6A; ABSO; JSR; goto L_FE6A;
+L_EEBC: STEP; FETCH(0x58, 0xEEBD); operand = 0x0000; IMP; CLI; 
+L_EEBD: STEP; FETCH(0x18, 0xEEBE); operand = 0x0000; IMP; CLC; 
+L_EEBE: STEP; FETCH(0x90, 0xEEC0); operand = 0x0049; REL; BCC; if (pc != 0xEEC0) goto L_EF09; 
+L_EEC0: STEP; FETCH(0x85, 0xEEC2); operand = 0x0095; ZP; STA; 
+L_EEC2: STEP; FETCH(0x20, 0xEEC5); operand = 0xEE40; ABSO; JSR; goto L_EE40;
+L_EEC5: STEP; FETCH(0xAD, 0xEEC8); operand = 0x911F; ABSO; LDA(MEM); 
+L_EEC8: STEP; FETCH(0x29, 0xEECA); operand = 0x007F; IMM; AND(IMMV); 
+L_EECA: STEP; FETCH(0x8D, 0xEECD); operand = 0x911F; ABSO; STA; 
+L_EECD: STEP; FETCH(0x60, 0xEECE); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EECE: STEP; FETCH(0x85, 0xEED0); operand = 0x0095; ZP; STA; 
+L_EED0: STEP; FETCH(0x20, 0xEED3); operand = 0xEE40; ABSO; JSR; goto L_EE40;
+L_EED3: STEP; FETCH(0x78, 0xEED4); operand = 0x0000; IMP; SEI; 
+L_EED4: STEP; FETCH(0x20, 0xEED7); operand = 0xE4A9; ABSO; JSR; goto L_E4A9;
+L_EED7: STEP; FETCH(0x20, 0xEEDA); operand = 0xEEC5; ABSO; JSR; goto L_EEC5;
+L_EEDA: STEP; FETCH(0x20, 0xEEDD); operand = 0xEF84; ABSO; JSR; goto L_EF84;
+L_EEDD: STEP; FETCH(0x20, 0xEEE0); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EEE0: STEP; FETCH(0xB0, 0xEEE2); operand = 0x00FB; REL; BCS; if (pc != 0xEEE2) goto L_EEDD; 
+L_EEE2: STEP; FETCH(0x58, 0xEEE3); operand = 0x0000; IMP; CLI; 
+L_EEE3: STEP; FETCH(0x60, 0xEEE4); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EEE4: STEP; FETCH(0x24, 0xEEE6); operand = 0x0094; ZP; BIT(MEM); 
+L_EEE6: STEP; FETCH(0x30, 0xEEE8); operand = 0x0005; REL; BMI; if (pc != 0xEEE8) goto L_EEED; 
+L_EEE8: STEP; FETCH(0x38, 0xEEE9); operand = 0x0000; IMP; SEC; 
+L_EEE9: STEP; FETCH(0x66, 0xEEEB); operand = 0x0094; ZP; ROR; 
+L_EEEB: STEP; FETCH(0xD0, 0xEEED); operand = 0x0005; REL; BNE; if (pc != 0xEEED) goto L_EEF2; 
+L_EEED: STEP; FETCH(0x48, 0xEEEE); operand = 0x0000; IMP; PHA; 
+L_EEEE: STEP; FETCH(0x20, 0xEEF1); operand = 0xEE49; ABSO; JSR; goto L_EE49;
+L_EEF1: STEP; FETCH(0x68, 0xEEF2); operand = 0x0000; IMP; PLA; 
+L_EEF2: STEP; FETCH(0x85, 0xEEF4); operand = 0x0095; ZP; STA; 
+L_EEF4: STEP; FETCH(0x18, 0xEEF5); operand = 0x0000; IMP; CLC; 
+L_EEF5: STEP; FETCH(0x60, 0xEEF6); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EEF6: STEP; FETCH(0x20, 0xEEF9); operand = 0xEF8D; ABSO; JSR; goto L_EF8D;
+L_EEF9: STEP; FETCH(0xAD, 0xEEFC); operand = 0x911F; ABSO; LDA(MEM); 
+L_EEFC: STEP; FETCH(0x09, 0xEEFE); operand = 0x0080; IMM; ORA(IMMV); 
+L_EEFE: STEP; FETCH(0x8D, 0xEF01); operand = 0x911F; ABSO; STA; 
+L_EF01: STEP; FETCH(0xA9, 0xEF03); operand = 0x005F; IMM; LDA(IMMV); 
+L_EF03: STEP; FETCH(0x2C, 0xEF06); operand = 0x3FA9; ABSO; BIT(MEM); goto L_EF06;
+L_EF04: STEP; FETCH(0xA9, 0xEF06); operand = 0x003F; IMM; LDA(IMMV); 
+L_EF06: STEP; FETCH(0x20, 0xEF09); operand = 0xEE1C; ABSO; JSR; goto L_EE1C;
+L_EF09: STEP; FETCH(0x20, 0xEF0C); operand = 0xEEC5; ABSO; JSR; goto L_EEC5;
+L_EF0C: STEP; FETCH(0x8A, 0xEF0D); operand = 0x0000; IMP; TXA; 
+L_EF0D: STEP; FETCH(0xA2, 0xEF0F); operand = 0x000B; IMM; LDX(IMMV); 
+L_EF0F: STEP; FETCH(0xCA, 0xEF10); operand = 0x0000; IMP; DEX; 
+L_EF10: STEP; FETCH(0xD0, 0xEF12); operand = 0x00FD; REL; BNE; if (pc != 0xEF12) goto L_EF0F; 
+L_EF12: STEP; FETCH(0xAA, 0xEF13); operand = 0x0000; IMP; TAX; 
+L_EF13: STEP; FETCH(0x20, 0xEF16); operand = 0xEF84; ABSO; JSR; goto L_EF84;
+L_EF16: STEP; FETCH(0x4C, 0xEF19); operand = 0xE4A0; ABSO; JMP; goto L_E4A0;
+L_EF19: STEP; FETCH(0x78, 0xEF1A); operand = 0x0000; IMP; SEI; 
+L_EF1A: STEP; FETCH(0xA9, 0xEF1C); operand = 0x0000; IMM; LDA(IMMV); 
+L_EF1C: STEP; FETCH(0x85, 0xEF1E); operand = 0x00A5; ZP; STA; 
+L_EF1E: STEP; FETCH(0x20, 0xEF21); operand = 0xEF84; ABSO; JSR; goto L_EF84;
+L_EF21: STEP; FETCH(0x20, 0xEF24); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EF24: STEP; FETCH(0x90, 0xEF26); operand = 0x00FB; REL; BCC; if (pc != 0xEF26) goto L_EF21; 
+L_EF26: STEP; FETCH(0x20, 0xEF29); operand = 0xE4A0; ABSO; JSR; goto L_E4A0;
+L_EF29: STEP; FETCH(0xA9, 0xEF2B); operand = 0x0001; IMM; LDA(IMMV); 
+L_EF2B: STEP; FETCH(0x8D, 0xEF2E); operand = 0x9129; ABSO; STA; 
+L_EF2E: STEP; FETCH(0xAD, 0xEF31); operand = 0x912D; ABSO; LDA(MEM); 
+L_EF31: STEP; FETCH(0x29, 0xEF33); operand = 0x0020; IMM; AND(IMMV); 
+L_EF33: STEP; FETCH(0xD0, 0xEF35); operand = 0x0007; REL; BNE; if (pc != 0xEF35) goto L_EF3C; 
+L_EF35: STEP; FETCH(0x20, 0xEF38); operand = 0xE4B2; ABSO; JSR; goto L_E4B2;
+L_EF38: STEP; FETCH(0xB0, 0xEF3A); operand = 0x00F4; REL; BCS; if (pc != 0xEF3A) goto L_EF2E; 
+L_EF3A: STEP; FETCH(0x90, 0xEF3C); operand = 0x0018; REL; BCC; if (pc != 0xEF3C) goto L_EF54; 
+L_EF3C: STEP; FETCH(0xA5, 0xEF3E); operand = 0x00A5; ZP; LDA(MEM); 
+L_EF3E: STEP; FETCH(0xF0, 0xEF40); operand = 0x0005; REL; BEQ; if (pc != 0xEF40) goto L_EF45; 
+L_EF40: STEP; FETCH(0xA9, 0xEF42); operand = 0x0002; IMM; LDA(IMMV); 
+L_EF42: STEP; FETCH(0x4C, 0xEF45); operand = 0xEEB9; ABSO; JMP; goto L_EEB9;
+L_EF45: STEP; FETCH(0x20, 0xEF48); operand = 0xE4A9; ABSO; JSR; goto L_E4A9;
+L_EF48: STEP; FETCH(0x20, 0xEF4B); operand = 0xEF0C; ABSO; JSR; goto L_EF0C;
+L_EF4B: STEP; FETCH(0xA9, 0xEF4D); operand = 0x0040; IMM; LDA(IMMV); 
+L_EF4D: STEP; FETCH(0x20, 0xEF50); operand = 0xFE6A; ABSO; JSR; goto L_FE6A;
+L_EF50: STEP; FETCH(0xE6, 0xEF52); operand = 0x00A5; ZP; INC; 
+L_EF52: STEP; FETCH(0xD0, 0xEF54); operand = 0x00D5; REL; BNE; if (pc != 0xEF54) goto L_EF29; 
+L_EF54: STEP; FETCH(0xA9, 0xEF56); operand = 0x0008; IMM; LDA(IMMV); 
+L_EF56: STEP; FETCH(0x85, 0xEF58); operand = 0x00A5; ZP; STA; 
+L_EF58: STEP; FETCH(0xAD, 0xEF5B); operand = 0x911F; ABSO; LDA(MEM); 
+L_EF5B: STEP; FETCH(0xCD, 0xEF5E); operand = 0x911F; ABSO; CMP(MEM); 
+L_EF5E: STEP; FETCH(0xD0, 0xEF60); operand = 0x00F8; REL; BNE; if (pc != 0xEF60) goto L_EF58; 
+L_EF60: STEP; FETCH(0x4A, 0xEF61); operand = 0x0000; ACC; LSR_A; 
+L_EF61: STEP; FETCH(0x90, 0xEF63); operand = 0x00F5; REL; BCC; if (pc != 0xEF63) goto L_EF58; 
+L_EF63: STEP; FETCH(0x4A, 0xEF64); operand = 0x0000; ACC; LSR_A; 
+L_EF64: STEP; FETCH(0x66, 0xEF66); operand = 0x00A4; ZP; ROR; 
+L_EF66: STEP; FETCH(0xAD, 0xEF69); operand = 0x911F; ABSO; LDA(MEM); 
+L_EF69: STEP; FETCH(0xCD, 0xEF6C); operand = 0x911F; ABSO; CMP(MEM); 
+L_EF6C: STEP; FETCH(0xD0, 0xEF6E); operand = 0x00F8; REL; BNE; if (pc != 0xEF6E) goto L_EF66; 
+L_EF6E: STEP; FETCH(0x4A, 0xEF6F); operand = 0x0000; ACC; LSR_A; 
+L_EF6F: STEP; FETCH(0xB0, 0xEF71); operand = 0x00F5; REL; BCS; if (pc != 0xEF71) goto L_EF66; 
+L_EF71: STEP; FETCH(0xC6, 0xEF73); operand = 0x00A5; ZP; DEC; 
+L_EF73: STEP; FETCH(0xD0, 0xEF75); operand = 0x00E3; REL; BNE; if (pc != 0xEF75) goto L_EF58; 
+L_EF75: STEP; FETCH(0x20, 0xEF78); operand = 0xE4A9; ABSO; JSR; goto L_E4A9;
+L_EF78: STEP; FETCH(0xA5, 0xEF7A); operand = 0x0090; ZP; LDA(MEM); 
+L_EF7A: STEP; FETCH(0xF0, 0xEF7C); operand = 0x0003; REL; BEQ; if (pc != 0xEF7C) goto L_EF7F; 
+L_EF7C: STEP; FETCH(0x20, 0xEF7F); operand = 0xEF0C; ABSO; JSR; goto L_EF0C;
+L_EF7F: STEP; FETCH(0xA5, 0xEF81); operand = 0x00A4; ZP; LDA(MEM); 
+L_EF81: STEP; FETCH(0x58, 0xEF82); operand = 0x0000; IMP; CLI; 
+L_EF82: STEP; FETCH(0x18, 0xEF83); operand = 0x0000; IMP; CLC; 
+L_EF83: STEP; FETCH(0x60, 0xEF84); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EF84: STEP; FETCH(0xAD, 0xEF87); operand = 0x912C; ABSO; LDA(MEM); 
+L_EF87: STEP; FETCH(0x29, 0xEF89); operand = 0x00FD; IMM; AND(IMMV); 
+L_EF89: STEP; FETCH(0x8D, 0xEF8C); operand = 0x912C; ABSO; STA; 
+L_EF8C: STEP; FETCH(0x60, 0xEF8D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EF8D: STEP; FETCH(0xAD, 0xEF90); operand = 0x912C; ABSO; LDA(MEM); 
+L_EF90: STEP; FETCH(0x09, 0xEF92); operand = 0x0002; IMM; ORA(IMMV); 
+L_EF92: STEP; FETCH(0x8D, 0xEF95); operand = 0x912C; ABSO; STA; 
+L_EF95: STEP; FETCH(0x60, 0xEF96); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EF96: STEP; FETCH(0xA9, 0xEF98); operand = 0x0004; IMM; LDA(IMMV); 
+L_EF98: STEP; FETCH(0x8D, 0xEF9B); operand = 0x9129; ABSO; STA; 
+L_EF9B: STEP; FETCH(0xAD, 0xEF9E); operand = 0x912D; ABSO; LDA(MEM); 
+L_EF9E: STEP; FETCH(0x29, 0xEFA0); operand = 0x0020; IMM; AND(IMMV); 
+L_EFA0: STEP; FETCH(0xF0, 0xEFA2); operand = 0x00F9; REL; BEQ; if (pc != 0xEFA2) goto L_EF9B; 
+L_EFA2: STEP; FETCH(0x60, 0xEFA3); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EFA3: STEP; FETCH(0xA5, 0xEFA5); operand = 0x00B4; ZP; LDA(MEM); 
+L_EFA5: STEP; FETCH(0xF0, 0xEFA7); operand = 0x0047; REL; BEQ; if (pc != 0xEFA7) goto L_EFEE; 
+L_EFA7: STEP; FETCH(0x30, 0xEFA9); operand = 0x003F; REL; BMI; if (pc != 0xEFA9) goto L_EFE8; 
+L_EFA9: STEP; FETCH(0x46, 0xEFAB); operand = 0x00B6; ZP; LSR; 
+L_EFAB: STEP; FETCH(0xA2, 0xEFAD); operand = 0x0000; IMM; LDX(IMMV); 
+L_EFAD: STEP; FETCH(0x90, 0xEFAF); operand = 0x0001; REL; BCC; if (pc != 0xEFAF) goto L_EFB0; 
+L_EFAF: STEP; FETCH(0xCA, 0xEFB0); operand = 0x0000; IMP; DEX; 
+L_EFB0: STEP; FETCH(0x8A, 0xEFB1); operand = 0x0000; IMP; TXA; 
+L_EFB1: STEP; FETCH(0x45, 0xEFB3); operand = 0x00BD; ZP; EOR(MEM); 
+L_EFB3: STEP; FETCH(0x85, 0xEFB5); operand = 0x00BD; ZP; STA; 
+L_EFB5: STEP; FETCH(0xC6, 0xEFB7); operand = 0x00B4; ZP; DEC; 
+L_EFB7: STEP; FETCH(0xF0, 0xEFB9); operand = 0x0006; REL; BEQ; if (pc != 0xEFB9) goto L_EFBF; 
+L_EFB9: STEP; FETCH(0x8A, 0xEFBA); operand = 0x0000; IMP; TXA; 
+L_EFBA: STEP; FETCH(0x29, 0xEFBC); operand = 0x0020; IMM; AND(IMMV); 
+L_EFBC: STEP; FETCH(0x85, 0xEFBE); operand = 0x00B5; ZP; STA; 
+L_EFBE: STEP; FETCH(0x60, 0xEFBF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_EFBF: STEP; FETCH(0xA9, 0xEFC1); operand = 0x0020; IMM; LDA(IMMV); 
+L_EFC1: STEP; FETCH(0x2C, 0xEFC4); operand = 0x0294; ABSO; BIT(MEM); 
+L_EFC4: STEP; FETCH(0xF0, 0xEFC6); operand = 0x0014; REL; BEQ; if (pc != 0xEFC6) goto L_EFDA; 
+L_EFC6: STEP; FETCH(0x30, 0xEFC8); operand = 0x001C; REL; BMI; if (pc != 0xEFC8) goto L_EFE4; 
+L_EFC8: STEP; FETCH(0x70, 0xEFCA); operand = 0x0014; REL; BVS; if (pc != 0xEFCA) goto L_EFDE; 
+L_EFCA: STEP; FETCH(0xA5, 0xEFCC); operand = 0x00BD; ZP; LDA(MEM); 
+L_EFCC: STEP; FETCH(0xD0, 0xEFCE); operand = 0x0001; REL; BNE; if (pc != 0xEFCE) goto L_EFCF; 
+L_EFCE: STEP; FETCH(0xCA, 0xEFCF); operand = 0x0000; IMP; DEX; 
+L_EFCF: STEP; FETCH(0xC6, 0xEFD1); operand = 0x00B4; ZP; DEC; 
+L_EFD1: STEP; FETCH(0xAD, 0xEFD4); operand = 0x0293; ABSO; LDA(MEM); 
+L_EFD4: STEP; FETCH(0x10, 0xEFD6); operand = 0x00E3; REL; BPL; if (pc != 0xEFD6) goto L_EFB9; 
+L_EFD6: STEP; FETCH(0xC6, 0xEFD8); operand = 0x00B4; ZP; DEC; 
+L_EFD8: STEP; FETCH(0xD0, 0xEFDA); operand = 0x00DF; REL; BNE; if (pc != 0xEFDA) goto L_EFB9; 
+L_EFDA: STEP; FETCH(0xE6, 0xEFDC); operand = 0x00B4; ZP; INC; 
+L_EFDC: STEP; FETCH(0xD0, 0xEFDE); operand = 0x00F0; REL; BNE; if (pc != 0xEFDE) goto L_EFCE; 
+L_EFDE: STEP; FETCH(0xA5, 0xEFE0); operand = 0x00BD; ZP; LDA(MEM); 
+L_EFE0: STEP; FETCH(0xF0, 0xEFE2); operand = 0x00ED; REL; BEQ; if (pc != 0xEFE2) goto L_EFCF; 
+L_EFE2: STEP; FETCH(0xD0, 0xEFE4); operand = 0x00EA; REL; BNE; if (pc != 0xEFE4) goto L_EFCE; 
+L_EFE4: STEP; FETCH(0x70, 0xEFE6); operand = 0x00E9; REL; BVS; if (pc != 0xEFE6) goto L_EFCF; 
+L_EFE6: STEP; FETCH(0x50, 0xEFE8); operand = 0x00E6; REL; BVC; if (pc != 0xEFE8) goto L_EFCE; 
+L_EFE8: STEP; FETCH(0xE6, 0xEFEA); operand = 0x00B4; ZP; INC; 
+L_EFEA: STEP; FETCH(0xA2, 0xEFEC); operand = 0x00FF; IMM; LDX(IMMV); 
+L_EFEC: STEP; FETCH(0xD0, 0xEFEE); operand = 0x00CB; REL; BNE; if (pc != 0xEFEE) goto L_EFB9; 
+L_EFEE: STEP; FETCH(0xAD, 0xEFF1); operand = 0x0294; ABSO; LDA(MEM); 
+L_EFF1: STEP; FETCH(0x4A, 0xEFF2); operand = 0x0000; ACC; LSR_A; 
+L_EFF2: STEP; FETCH(0x90, 0xEFF4); operand = 0x0007; REL; BCC; if (pc != 0xEFF4) goto L_EFFB; 
+L_EFF4: STEP; FETCH(0x2C, 0xEFF7); operand = 0x9120; ABSO; BIT(MEM); 
+L_EFF7: STEP; FETCH(0x10, 0xEFF9); operand = 0x001D; REL; BPL; if (pc != 0xEFF9) goto L_F016; 
+L_EFF9: STEP; FETCH(0x50, 0xEFFB); operand = 0x001E; REL; BVC; if (pc != 0xEFFB) goto L_F019; 
+L_EFFB: STEP; FETCH(0xA9, 0xEFFD); operand = 0x0000; IMM; LDA(IMMV); 
+L_EFFD: STEP; FETCH(0x85, 0xEFFF); operand = 0x00BD; ZP; STA; 
+L_EFFF: STEP; FETCH(0x85, 0xF001); operand = 0x00B5; ZP; STA; 
+L_F001: STEP; FETCH(0xAE, 0xF004); operand = 0x0298; ABSO; LDX(MEM); 
+L_F004: STEP; FETCH(0x86, 0xF006); operand = 0x00B4; ZP; STX; 
+L_F006: STEP; FETCH(0xAC, 0xF009); operand = 0x029D; ABSO; LDY(MEM); 
+L_F009: STEP; FETCH(0xCC, 0xF00C); operand = 0x029E; ABSO; CPY(MEM); 
+L_F00C: STEP; FETCH(0xF0, 0xF00E); operand = 0x0013; REL; BEQ; if (pc != 0xF00E) goto L_F021; 
+L_F00E: STEP; FETCH(0xB1, 0xF010); operand = 0x00F9; INDY(1); LDA(MEM); 
+L_F010: STEP; FETCH(0x85, 0xF012); operand = 0x00B6; ZP; STA; 
+L_F012: STEP; FETCH(0xEE, 0xF015); operand = 0x029D; ABSO; INC; 
+L_F015: STEP; FETCH(0x60, 0xF016); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F016: STEP; FETCH(0xA9, 0xF018); operand = 0x0040; IMM; LDA(IMMV); 
+L_F018: STEP; FETCH(0x2C, 0xF01B); operand = 0x10A9; ABSO; BIT(MEM); goto L_F01B;
+L_F019: STEP; FETCH(0xA9, 0xF01B); operand = 0x0010; IMM; LDA(IMMV); 
+L_F01B: STEP; FETCH(0x0D, 0xF01E); operand = 0x0297; ABSO; ORA(MEM); 
+L_F01E: STEP; FETCH(0x8D, 0xF021); operand = 0x0297; ABSO; STA; 
+L_F021: STEP; FETCH(0xA9, 0xF023); operand = 0x0040; IMM; LDA(IMMV); 
+L_F023: STEP; FETCH(0x8D, 0xF026); operand = 0x911E; ABSO; STA; 
+L_F026: STEP; FETCH(0x60, 0xF027); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F027: STEP; FETCH(0xA2, 0xF029); operand = 0x0009; IMM; LDX(IMMV); 
+L_F029: STEP; FETCH(0xA9, 0xF02B); operand = 0x0020; IMM; LDA(IMMV); 
+L_F02B: STEP; FETCH(0x2C, 0xF02E); operand = 0x0293; ABSO; BIT(MEM); 
+L_F02E: STEP; FETCH(0xF0, 0xF030); operand = 0x0001; REL; BEQ; if (pc != 0xF030) goto L_F031; 
+L_F030: STEP; FETCH(0xCA, 0xF031); operand = 0x0000; IMP; DEX; 
+L_F031: STEP; FETCH(0x50, 0xF033); operand = 0x0002; REL; BVC; if (pc != 0xF033) goto L_F035; 
+L_F033: STEP; FETCH(0xCA, 0xF034); operand = 0x0000; IMP; DEX; 
+L_F034: STEP; FETCH(0xCA, 0xF035); operand = 0x0000; IMP; DEX; 
+L_F035: STEP; FETCH(0x60, 0xF036); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F036: STEP; FETCH(0xA6, 0xF038); operand = 0x00A9; ZP; LDX(MEM); 
+L_F038: STEP; FETCH(0xD0, 0xF03A); operand = 0x002E; REL; BNE; if (pc != 0xF03A) goto L_F068; 
+L_F03A: STEP; FETCH(0xC6, 0xF03C); operand = 0x00A8; ZP; DEC; 
+L_F03C: STEP; FETCH(0xF0, 0xF03E); operand = 0x0031; REL; BEQ; if (pc != 0xF03E) goto L_F06F; 
+L_F03E: STEP; FETCH(0x30, 0xF040); operand = 0x000D; REL; BMI; if (pc != 0xF040) goto L_F04D; 
+L_F040: STEP; FETCH(0xA5, 0xF042); operand = 0x00A7; ZP; LDA(MEM); 
+L_F042: STEP; FETCH(0x45, 0xF044); operand = 0x00AB; ZP; EOR(MEM); 
+L_F044: STEP; FETCH(0x85, 0xF046); operand = 0x00AB; ZP; STA; 
+L_F046: STEP; FETCH(0x46, 0xF048); operand = 0x00A7; ZP; LSR; 
+L_F048: STEP; FETCH(0x66, 0xF04A); operand = 0x00AA; ZP; ROR; 
+L_F04A: STEP; FETCH(0x60, 0xF04B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F04B: STEP; FETCH(0xC6, 0xF04D); operand = 0x00A8; ZP; DEC; 
+L_F04D: STEP; FETCH(0xA5, 0xF04F); operand = 0x00A7; ZP; LDA(MEM); 
+L_F04F: STEP; FETCH(0xF0, 0xF051); operand = 0x0062; REL; BEQ; if (pc != 0xF051) goto L_F0B3; 
+L_F051: STEP; FETCH(0xAD, 0xF054); operand = 0x0293; ABSO; LDA(MEM); 
+L_F054: STEP; FETCH(0x0A, 0xF055); operand = 0x0000; ACC; ASL_A; 
+L_F055: STEP; FETCH(0xA9, 0xF057); operand = 0x0001; IMM; LDA(IMMV); 
+L_F057: STEP; FETCH(0x65, 0xF059); operand = 0x00A8; ZP; ADC(MEM); 
+L_F059: STEP; FETCH(0xD0, 0xF05B); operand = 0x00EF; REL; BNE; if (pc != 0xF05B) goto L_F04A; 
+L_F05B: STEP; FETCH(0xA9, 0xF05D); operand = 0x0090; IMM; LDA(IMMV); 
+L_F05D: STEP; FETCH(0x8D, 0xF060); operand = 0x911E; ABSO; STA; 
+L_F060: STEP; FETCH(0x85, 0xF062); operand = 0x00A9; ZP; STA; 
+L_F062: STEP; FETCH(0xA9, 0xF064); operand = 0x0020; IMM; LDA(IMMV); 
+L_F064: STEP; FETCH(0x8D, 0xF067); operand = 0x911E; ABSO; STA; 
+L_F067: STEP; FETCH(0x60, 0xF068); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F068: STEP; FETCH(0xA5, 0xF06A); operand = 0x00A7; ZP; LDA(MEM); 
+L_F06A: STEP; FETCH(0xD0, 0xF06C); operand = 0x00EF; REL; BNE; if (pc != 0xF06C) goto L_F05B; 
+L_F06C: STEP; FETCH(0x85, 0xF06E); operand = 0x00A9; ZP; STA; 
+L_F06E: STEP; FETCH(0x60, 0xF06F); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F06F: STEP; FETCH(0xAC, 0xF072); operand = 0x029B; ABSO; LDY(MEM); 
+L_F072: STEP; FETCH(0xC8, 0xF073); operand = 0x0000; IMP; INY; 
+L_F073: STEP; FETCH(0xCC, 0xF076); operand = 0x029C; ABSO; CPY(MEM); 
+L_F076: STEP; FETCH(0xF0, 0xF078); operand = 0x002A; REL; BEQ; if (pc != 0xF078) goto L_F0A2; 
+L_F078: STEP; FETCH(0x8C, 0xF07B); operand = 0x029B; ABSO; STY; 
+L_F07B: STEP; FETCH(0x88, 0xF07C); operand = 0x0000; IMP; DEY; 
+L_F07C: STEP; FETCH(0xA5, 0xF07E); operand = 0x00AA; ZP; LDA(MEM); 
+L_F07E: STEP; FETCH(0xAE, 0xF081); operand = 0x0298; ABSO; LDX(MEM); 
+L_F081: STEP; FETCH(0xE0, 0xF083); operand = 0x0009; IMM; CPX(IMMV); 
+L_F083: STEP; FETCH(0xF0, 0xF085); operand = 0x0004; REL; BEQ; if (pc != 0xF085) goto L_F089; 
+L_F085: STEP; FETCH(0x4A, 0xF086); operand = 0x0000; ACC; LSR_A; 
+L_F086: STEP; FETCH(0xE8, 0xF087); operand = 0x0000; IMP; INX; 
+L_F087: STEP; FETCH(0xD0, 0xF089); operand = 0x00F8; REL; BNE; if (pc != 0xF089) goto L_F081; 
+L_F089: STEP; FETCH(0x91, 0xF08B); operand = 0x00F7; INDY(0); STA; 
+L_F08B: STEP; FETCH(0xA9, 0xF08D); operand = 0x0020; IMM; LDA(IMMV); 
+L_F08D: STEP; FETCH(0x2C, 0xF090); operand = 0x0294; ABSO; BIT(MEM); 
+L_F090: STEP; FETCH(0xF0, 0xF092); operand = 0x00B9; REL; BEQ; if (pc != 0xF092) goto L_F04B; 
+L_F092: STEP; FETCH(0x30, 0xF094); operand = 0x00B6; REL; BMI; if (pc != 0xF094) goto L_F04A; 
+L_F094: STEP; FETCH(0xA5, 0xF096); operand = 0x00A7; ZP; LDA(MEM); 
+L_F096: STEP; FETCH(0x45, 0xF098); operand = 0x00AB; ZP; EOR(MEM); 
+L_F098: STEP; FETCH(0xF0, 0xF09A); operand = 0x0003; REL; BEQ; if (pc != 0xF09A) goto L_F09D; 
+L_F09A: STEP; FETCH(0x70, 0xF09C); operand = 0x00AE; REL; BVS; if (pc != 0xF09C) goto L_F04A; 
+L_F09C: STEP; FETCH(0x2C, 0xF09F); operand = 0xAB50; ABSO; BIT(MEM); goto L_F09F;
+L_F09D: STEP; FETCH(0x50, 0xF09F); operand = 0x00AB; REL; BVC; if (pc != 0xF09F) goto L_F04A; 
+L_F09F: STEP; FETCH(0xA9, 0xF0A1); operand = 0x0001; IMM; LDA(IMMV); 
+L_F0A1: STEP; FETCH(0x2C, 0xF0A4); operand = 0x04A9; ABSO; BIT(MEM); goto L_F0A4;
+L_F0A2: STEP; FETCH(0xA9, 0xF0A4); operand = 0x0004; IMM; LDA(IMMV); 
+L_F0A4: STEP; FETCH(0x2C, 0xF0A7); operand = 0x80A9; ABSO; BIT(MEM); goto L_F0A7;
+L_F0A5: STEP; FETCH(0xA9, 0xF0A7); operand = 0x0080; IMM; LDA(IMMV); 
+L_F0A7: STEP; FETCH(0x2C, 0xF0AA); operand = 0x02A9; ABSO; BIT(MEM); goto L_F0AA;
+L_F0A8: STEP; FETCH(0xA9, 0xF0AA); operand = 0x0002; IMM; LDA(IMMV); 
+L_F0AA: STEP; FETCH(0x0D, 0xF0AD); operand = 0x0297; ABSO; ORA(MEM); 
+L_F0AD: STEP; FETCH(0x8D, 0xF0B0); operand = 0x0297; ABSO; STA; 
+L_F0B0: STEP; FETCH(0x4C, 0xF0B3); operand = 0xF05B; ABSO; JMP; goto L_F05B;
+L_F0B3: STEP; FETCH(0xA5, 0xF0B5); operand = 0x00AA; ZP; LDA(MEM); 
+L_F0B5: STEP; FETCH(0xD0, 0xF0B7); operand = 0x00F1; REL; BNE; if (pc != 0xF0B7) goto L_F0A8; 
+L_F0B7: STEP; FETCH(0xF0, 0xF0B9); operand = 0x00EC; REL; BEQ; if (pc != 0xF0B9) goto L_F0A5; 
+L_F0B9: STEP; FETCH(0x4C, 0xF0BC); operand = 0xF796; ABSO; JMP; goto L_F796;
+L_F0BC: STEP; FETCH(0x85, 0xF0BE); operand = 0x009A; ZP; STA; 
+L_F0BE: STEP; FETCH(0xAD, 0xF0C1); operand = 0x0294; ABSO; LDA(MEM); 
+L_F0C1: STEP; FETCH(0x4A, 0xF0C2); operand = 0x0000; ACC; LSR_A; 
+L_F0C2: STEP; FETCH(0x90, 0xF0C4); operand = 0x0027; REL; BCC; if (pc != 0xF0C4) goto L_F0EB; 
+L_F0C4: STEP; FETCH(0xA9, 0xF0C6); operand = 0x0002; IMM; LDA(IMMV); 
+L_F0C6: STEP; FETCH(0x2C, 0xF0C9); operand = 0x9110; ABSO; BIT(MEM); 
+L_F0C9: STEP; FETCH(0x10, 0xF0CB); operand = 0x001D; REL; BPL; if (pc != 0xF0CB) goto L_F0E8; 
+L_F0CB: STEP; FETCH(0xD0, 0xF0CD); operand = 0x001E; REL; BNE; if (pc != 0xF0CD) goto L_F0EB; 
+L_F0CD: STEP; FETCH(0xAD, 0xF0D0); operand = 0x911E; ABSO; LDA(MEM); 
+L_F0D0: STEP; FETCH(0x29, 0xF0D2); operand = 0x0030; IMM; AND(IMMV); 
+L_F0D2: STEP; FETCH(0xD0, 0xF0D4); operand = 0x00F9; REL; BNE; if (pc != 0xF0D4) goto L_F0CD; 
+L_F0D4: STEP; FETCH(0x2C, 0xF0D7); operand = 0x9110; ABSO; BIT(MEM); 
+L_F0D7: STEP; FETCH(0x70, 0xF0D9); operand = 0x00FB; REL; BVS; if (pc != 0xF0D9) goto L_F0D4; 
+L_F0D9: STEP; FETCH(0xAD, 0xF0DC); operand = 0x9110; ABSO; LDA(MEM); 
+L_F0DC: STEP; FETCH(0x09, 0xF0DE); operand = 0x0002; IMM; ORA(IMMV); 
+L_F0DE: STEP; FETCH(0x8D, 0xF0E1); operand = 0x9110; ABSO; STA; 
+L_F0E1: STEP; FETCH(0x2C, 0xF0E4); operand = 0x9110; ABSO; BIT(MEM); 
+L_F0E4: STEP; FETCH(0x70, 0xF0E6); operand = 0x0005; REL; BVS; if (pc != 0xF0E6) goto L_F0EB; 
+L_F0E6: STEP; FETCH(0x30, 0xF0E8); operand = 0x00F9; REL; BMI; if (pc != 0xF0E8) goto L_F0E1; 
+L_F0E8: STEP; FETCH(0x20, 0xF0EB); operand = 0xF016; ABSO; JSR; goto L_F016;
+L_F0EB: STEP; FETCH(0x18, 0xF0EC); operand = 0x0000; IMP; CLC; 
+L_F0EC: STEP; FETCH(0x60, 0xF0ED); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F0ED: STEP; FETCH(0xAC, 0xF0F0); operand = 0x029E; ABSO; LDY(MEM); 
+L_F0F0: STEP; FETCH(0xC8, 0xF0F1); operand = 0x0000; IMP; INY; 
+L_F0F1: STEP; FETCH(0xCC, 0xF0F4); operand = 0x029D; ABSO; CPY(MEM); 
+L_F0F4: STEP; FETCH(0xF0, 0xF0F6); operand = 0x00F7; REL; BEQ; if (pc != 0xF0F6) goto L_F0ED; 
+L_F0F6: STEP; FETCH(0x8C, 0xF0F9); operand = 0x029E; ABSO; STY; 
+L_F0F9: STEP; FETCH(0x88, 0xF0FA); operand = 0x0000; IMP; DEY; 
+L_F0FA: STEP; FETCH(0x91, 0xF0FC); operand = 0x00F9; INDY(0); STA; 
+L_F0FC: STEP; FETCH(0x2C, 0xF0FF); operand = 0x911E; ABSO; BIT(MEM); 
+L_F0FF: STEP; FETCH(0x50, 0xF101); operand = 0x0001; REL; BVC; if (pc != 0xF101) goto L_F102; 
+L_F101: STEP; FETCH(0x60, 0xF102); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F102: STEP; FETCH(0xAD, 0xF105); operand = 0x0299; ABSO; LDA(MEM); 
+L_F105: STEP; FETCH(0x8D, 0xF108); operand = 0x9114; ABSO; STA; 
+L_F108: STEP; FETCH(0xAD, 0xF10B); operand = 0x029A; ABSO; LDA(MEM); 
+L_F10B: STEP; FETCH(0x8D, 0xF10E); operand = 0x9115; ABSO; STA; 
+L_F10E: STEP; FETCH(0xA9, 0xF110); operand = 0x00C0; IMM; LDA(IMMV); 
+L_F110: STEP; FETCH(0x8D, 0xF113); operand = 0x911E; ABSO; STA; 
+L_F113: STEP; FETCH(0x4C, 0xF116); operand = 0xEFEE; ABSO; JMP; goto L_EFEE;
+L_F116: STEP; FETCH(0x85, 0xF118); operand = 0x0099; ZP; STA; 
+L_F118: STEP; FETCH(0xAD, 0xF11B); operand = 0x0294; ABSO; LDA(MEM); 
+L_F11B: STEP; FETCH(0x4A, 0xF11C); operand = 0x0000; ACC; LSR_A; 
+L_F11C: STEP; FETCH(0x90, 0xF11E); operand = 0x0028; REL; BCC; if (pc != 0xF11E) goto L_F146; 
+L_F11E: STEP; FETCH(0x29, 0xF120); operand = 0x0008; IMM; AND(IMMV); 
+L_F120: STEP; FETCH(0xF0, 0xF122); operand = 0x0024; REL; BEQ; if (pc != 0xF122) goto L_F146; 
+L_F122: STEP; FETCH(0xA9, 0xF124); operand = 0x0002; IMM; LDA(IMMV); 
+L_F124: STEP; FETCH(0x2C, 0xF127); operand = 0x9110; ABSO; BIT(MEM); 
+L_F127: STEP; FETCH(0x10, 0xF129); operand = 0x00BF; REL; BPL; if (pc != 0xF129) goto L_F0E8; 
+L_F129: STEP; FETCH(0xF0, 0xF12B); operand = 0x0019; REL; BEQ; if (pc != 0xF12B) goto L_F144; 
+L_F12B: STEP; FETCH(0x2C, 0xF12E); operand = 0x911E; ABSO; BIT(MEM); 
+L_F12E: STEP; FETCH(0x70, 0xF130); operand = 0x00FB; REL; BVS; if (pc != 0xF130) goto L_F12B; 
+L_F130: STEP; FETCH(0xAD, 0xF133); operand = 0x9110; ABSO; LDA(MEM); 
+L_F133: STEP; FETCH(0x29, 0xF135); operand = 0x00FD; IMM; AND(IMMV); 
+L_F135: STEP; FETCH(0x8D, 0xF138); operand = 0x9110; ABSO; STA; 
+L_F138: STEP; FETCH(0xAD, 0xF13B); operand = 0x9110; ABSO; LDA(MEM); 
+L_F13B: STEP; FETCH(0x29, 0xF13D); operand = 0x0004; IMM; AND(IMMV); 
+L_F13D: STEP; FETCH(0xF0, 0xF13F); operand = 0x00F9; REL; BEQ; if (pc != 0xF13F) goto L_F138; 
+L_F13F: STEP; FETCH(0xA9, 0xF141); operand = 0x0090; IMM; LDA(IMMV); 
+L_F141: STEP; FETCH(0x8D, 0xF144); operand = 0x911E; ABSO; STA; 
+L_F144: STEP; FETCH(0x18, 0xF145); operand = 0x0000; IMP; CLC; 
+L_F145: STEP; FETCH(0x60, 0xF146); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F146: STEP; FETCH(0xAD, 0xF149); operand = 0x911E; ABSO; LDA(MEM); 
+L_F149: STEP; FETCH(0x29, 0xF14B); operand = 0x0030; IMM; AND(IMMV); 
+L_F14B: STEP; FETCH(0xF0, 0xF14D); operand = 0x00F2; REL; BEQ; if (pc != 0xF14D) goto L_F13F; 
+L_F14D: STEP; FETCH(0x18, 0xF14E); operand = 0x0000; IMP; CLC; 
+L_F14E: STEP; FETCH(0x60, 0xF14F); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F14F: STEP; FETCH(0xAC, 0xF152); operand = 0x029C; ABSO; LDY(MEM); 
+L_F152: STEP; FETCH(0xCC, 0xF155); operand = 0x029B; ABSO; CPY(MEM); 
+L_F155: STEP; FETCH(0xF0, 0xF157); operand = 0x0006; REL; BEQ; if (pc != 0xF157) goto L_F15D; 
+L_F157: STEP; FETCH(0xB1, 0xF159); operand = 0x00F7; INDY(1); LDA(MEM); 
+L_F159: STEP; FETCH(0xEE, 0xF15C); operand = 0x029C; ABSO; INC; 
+L_F15C: STEP; FETCH(0x60, 0xF15D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F15D: STEP; FETCH(0xA9, 0xF15F); operand = 0x0000; IMM; LDA(IMMV); 
+L_F15F: STEP; FETCH(0x60, 0xF160); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F160: STEP; FETCH(0x48, 0xF161); operand = 0x0000; IMP; PHA; 
+L_F161: STEP; FETCH(0xAD, 0xF164); operand = 0x911E; ABSO; LDA(MEM); 
+L_F164: STEP; FETCH(0xF0, 0xF166); operand = 0x000C; REL; BEQ; if (pc != 0xF166) goto L_F172; 
+L_F166: STEP; FETCH(0xAD, 0xF169); operand = 0x911E; ABSO; LDA(MEM); 
+L_F169: STEP; FETCH(0x29, 0xF16B); operand = 0x0060; IMM; AND(IMMV); 
+L_F16B: STEP; FETCH(0xD0, 0xF16D); operand = 0x00F9; REL; BNE; if (pc != 0xF16D) goto L_F166; 
+L_F16D: STEP; FETCH(0xA9, 0xF16F); operand = 0x0010; IMM; LDA(IMMV); 
+L_F16F: STEP; FETCH(0x8D, 0xF172); operand = 0x911E; ABSO; STA; 
+L_F172: STEP; FETCH(0x68, 0xF173); operand = 0x0000; IMP; PLA; 
+L_F173: STEP; FETCH(0x60, 0xF174); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F1E2: STEP; FETCH(0x24, 0xF1E4); operand = 0x009D; ZP; BIT(MEM); 
+L_F1E4: STEP; FETCH(0x10, 0xF1E6); operand = 0x000D; REL; BPL; if (pc != 0xF1E6) goto L_F1F3; 
+L_F1E6: STEP; FETCH(0xB9, 0xF1E9); operand = 0xF174; ABSY(1); LDA(MEM); 
+L_F1E9: STEP; FETCH(0x08, 0xF1EA); operand = 0x0000; IMP; PHP; 
+L_F1EA: STEP; FETCH(0x29, 0xF1EC); operand = 0x007F; IMM; AND(IMMV); 
+L_F1EC: STEP; FETCH(0x20, 0xF1EF); operand = 0xFFD2; ABSO; JSR; goto L_FFD2;
+L_F1EF: STEP; FETCH(0xC8, 0xF1F0); operand = 0x0000; IMP; INY; 
+L_F1F0: STEP; FETCH(0x28, 0xF1F1); operand = 0x0000; IMP; PLP; 
+L_F1F1: STEP; FETCH(0x10, 0xF1F3); operand = 0x00F3; REL; BPL; if (pc != 0xF1F3) goto L_F1E6; 
+L_F1F3: STEP; FETCH(0x18, 0xF1F4); operand = 0x0000; IMP; CLC; 
+L_F1F4: STEP; FETCH(0x60, 0xF1F5); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F1F5: STEP; FETCH(0xA5, 0xF1F7); operand = 0x0099; ZP; LDA(MEM); 
+L_F1F7: STEP; FETCH(0xD0, 0xF1F9); operand = 0x0008; REL; BNE; if (pc != 0xF1F9) goto L_F201; 
+L_F1F9: STEP; FETCH(0xA5, 0xF1FB); operand = 0x00C6; ZP; LDA(MEM); 
+L_F1FB: STEP; FETCH(0xF0, 0xF1FD); operand = 0x006D; REL; BEQ; if (pc != 0xF1FD) goto L_F26A; 
+L_F1FD: STEP; FETCH(0x78, 0xF1FE); operand = 0x0000; IMP; SEI; 
+L_F1FE: STEP; FETCH(0x4C, 0xF201); operand = 0xE5CF; ABSO; JMP; goto L_E5CF;
+L_F201: STEP; FETCH(0xC9, 0xF203); operand = 0x0002; IMM; CMP(IMMV); 
+L_F203: STEP; FETCH(0xD0, 0xF205); operand = 0x0018; REL; BNE; if (pc != 0xF205) goto L_F21D; 
+L_F205: STEP; FETCH(0x84, 0xF207); operand = 0x0097; ZP; STY; 
+L_F207: STEP; FETCH(0x20, 0xF20A); operand = 0xF14F; ABSO; JSR; goto L_F14F;
+L_F20A: STEP; FETCH(0xA4, 0xF20C); operand = 0x0097; ZP; LDY(MEM); 
+L_F20C: STEP; FETCH(0x18, 0xF20D); operand = 0x0000; IMP; CLC; 
+L_F20D: STEP; FETCH(0x60, 0xF20E); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F20E: STEP; FETCH(0xA5, 0xF210); operand = 0x0099; ZP; LDA(MEM); 
+L_F210: STEP; FETCH(0xD0, 0xF212); operand = 0x000B; REL; BNE; if (pc != 0xF212) goto L_F21D; 
+L_F212: STEP; FETCH(0xA5, 0xF214); operand = 0x00D3; ZP; LDA(MEM); 
+L_F214: STEP; FETCH(0x85, 0xF216); operand = 0x00CA; ZP; STA; 
+L_F216: STEP; FETCH(0xA5, 0xF218); operand = 0x00D6; ZP; LDA(MEM); 
+L_F218: STEP; FETCH(0x85, 0xF21A); operand = 0x00C9; ZP; STA; 
+L_F21A: STEP; FETCH(0x4C, 0xF21D); operand = 0xE64F; ABSO; JMP; goto L_E64F;
+L_F21D: STEP; FETCH(0xC9, 0xF21F); operand = 0x0003; IMM; CMP(IMMV); 
+L_F21F: STEP; FETCH(0xD0, 0xF221); operand = 0x0009; REL; BNE; if (pc != 0xF221) goto L_F22A; 
+L_F221: STEP; FETCH(0x85, 0xF223); operand = 0x00D0; ZP; STA; 
+L_F223: STEP; FETCH(0xA5, 0xF225); operand = 0x00D5; ZP; LDA(MEM); 
+L_F225: STEP; FETCH(0x85, 0xF227); operand = 0x00C8; ZP; STA; 
+L_F227: STEP; FETCH(0x4C, 0xF22A); operand = 0xE64F; ABSO; JMP; goto L_E64F;
+L_F22A: STEP; FETCH(0xB0, 0xF22C); operand = 0x0038; REL; BCS; if (pc != 0xF22C) goto L_F264; 
+L_F22C: STEP; FETCH(0xC9, 0xF22E); operand = 0x0002; IMM; CMP(IMMV); 
+L_F22E: STEP; FETCH(0xF0, 0xF230); operand = 0x003F; REL; BEQ; if (pc != 0xF230) goto L_F26F; 
+L_F230: STEP; FETCH(0x86, 0xF232); operand = 0x0097; ZP; STX; 
+L_F232: STEP; FETCH(0x20, 0xF235); operand = 0xF250; ABSO; JSR; goto L_F250;
+L_F235: STEP; FETCH(0xB0, 0xF237); operand = 0x0016; REL; BCS; if (pc != 0xF237) goto L_F24D; 
+L_F237: STEP; FETCH(0x48, 0xF238); operand = 0x0000; IMP; PHA; 
+L_F238: STEP; FETCH(0x20, 0xF23B); operand = 0xF250; ABSO; JSR; goto L_F250;
+L_F23B: STEP; FETCH(0xB0, 0xF23D); operand = 0x000D; REL; BCS; if (pc != 0xF23D) goto L_F24A; 
+L_F23D: STEP; FETCH(0xD0, 0xF23F); operand = 0x0005; REL; BNE; if (pc != 0xF23F) goto L_F244; 
+L_F23F: STEP; FETCH(0xA9, 0xF241); operand = 0x0040; IMM; LDA(IMMV); 
+L_F241: STEP; FETCH(0x20, 0xF244); operand = 0xFE6A; ABSO; JSR; goto L_FE6A;
+L_F244: STEP; FETCH(0xC6, 0xF246); operand = 0x00A6; ZP; DEC; 
+L_F246: STEP; FETCH(0xA6, 0xF248); operand = 0x0097; ZP; LDX(MEM); 
+L_F248: STEP; FETCH(0x68, 0xF249); operand = 0x0000; IMP; PLA; 
+L_F249: STEP; FETCH(0x60, 0xF24A); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F24A: STEP; FETCH(0xAA, 0xF24B); operand = 0x0000; IMP; TAX; 
+L_F24B: STEP; FETCH(0x68, 0xF24C); operand = 0x0000; IMP; PLA; 
+L_F24C: STEP; FETCH(0x8A, 0xF24D); operand = 0x0000; IMP; TXA; 
+L_F24D: STEP; FETCH(0xA6, 0xF24F); operand = 0x0097; ZP; LDX(MEM); 
+L_F24F: STEP; FETCH(0x60, 0xF250); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F250: STEP; FETCH(0x20, 0xF253); operand = 0xF88A; ABSO; JSR; goto L_F88A;
+L_F253: STEP; FETCH(0xD0, 0xF255); operand = 0x000B; REL; BNE; if (pc != 0xF255) goto L_F260; 
+L_F255: STEP; FETCH(0x20, 0xF258); operand = 0xF8C0; ABSO; JSR; goto L_F8C0;
+L_F258: STEP; FETCH(0xB0, 0xF25A); operand = 0x0011; REL; BCS; if (pc != 0xF25A) goto L_F26B; 
+L_F25A: STEP; FETCH(0xA9, 0xF25C); operand = 0x0000; IMM; LDA(IMMV); 
+L_F25C: STEP; FETCH(0x85, 0xF25E); operand = 0x00A6; ZP; STA; 
+L_F25E: STEP; FETCH(0xF0, 0xF260); operand = 0x00F0; REL; BEQ; if (pc != 0xF260) goto L_F250; 
+L_F260: STEP; FETCH(0xB1, 0xF262); operand = 0x00B2; INDY(1); LDA(MEM); 
+L_F262: STEP; FETCH(0x18, 0xF263); operand = 0x0000; IMP; CLC; 
+L_F263: STEP; FETCH(0x60, 0xF264); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F264: STEP; FETCH(0xA5, 0xF266); operand = 0x0090; ZP; LDA(MEM); 
+L_F266: STEP; FETCH(0xF0, 0xF268); operand = 0x0004; REL; BEQ; if (pc != 0xF268) goto L_F26C; 
+L_F268: STEP; FETCH(0xA9, 0xF26A); operand = 0x000D; IMM; LDA(IMMV); 
+L_F26A: STEP; FETCH(0x18, 0xF26B); operand = 0x0000; IMP; CLC; 
+L_F26B: STEP; FETCH(0x60, 0xF26C); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F26C: STEP; FETCH(0x4C, 0xF26F); operand = 0xEF19; ABSO; JMP; goto L_EF19;
+L_F26F: STEP; FETCH(0x20, 0xF272); operand = 0xF205; ABSO; JSR; goto L_F205;
+L_F272: STEP; FETCH(0xB0, 0xF274); operand = 0x0005; REL; BCS; if (pc != 0xF274) goto L_F279; 
+L_F274: STEP; FETCH(0xC9, 0xF276); operand = 0x0000; IMM; CMP(IMMV); 
+L_F276: STEP; FETCH(0xF0, 0xF278); operand = 0x00F7; REL; BEQ; if (pc != 0xF278) goto L_F26F; 
+L_F278: STEP; FETCH(0x18, 0xF279); operand = 0x0000; IMP; CLC; 
+L_F279: STEP; FETCH(0x60, 0xF27A); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F27A: STEP; FETCH(0x48, 0xF27B); operand = 0x0000; IMP; PHA; 
+L_F27B: STEP; FETCH(0xA5, 0xF27D); operand = 0x009A; ZP; LDA(MEM); 
+L_F27D: STEP; FETCH(0xC9, 0xF27F); operand = 0x0003; IMM; CMP(IMMV); 
+L_F27F: STEP; FETCH(0xD0, 0xF281); operand = 0x0004; REL; BNE; if (pc != 0xF281) goto L_F285; 
+L_F281: STEP; FETCH(0x68, 0xF282); operand = 0x0000; IMP; PLA; 
+L_F282: STEP; FETCH(0x4C, 0xF285); operand = 0xE742; ABSO; JMP; goto L_E742;
+L_F285: STEP; FETCH(0x90, 0xF287); operand = 0x0004; REL; BCC; if (pc != 0xF287) goto L_F28B; 
+L_F287: STEP; FETCH(0x68, 0xF288); operand = 0x0000; IMP; PLA; 
+L_F288: STEP; FETCH(0x4C, 0xF28B); operand = 0xEEE4; ABSO; JMP; goto L_EEE4;
+L_F28B: STEP; FETCH(0xC9, 0xF28D); operand = 0x0002; IMM; CMP(IMMV); 
+L_F28D: STEP; FETCH(0xF0, 0xF28F); operand = 0x002A; REL; BEQ; if (pc != 0xF28F) goto L_F2B9; 
+L_F28F: STEP; FETCH(0x68, 0xF290); operand = 0x0000; IMP; PLA; 
+L_F290: STEP; FETCH(0x85, 0xF292); operand = 0x009E; ZP; STA; 
+L_F292: STEP; FETCH(0x48, 0xF293); operand = 0x0000; IMP; PHA; 
+L_F293: STEP; FETCH(0x8A, 0xF294); operand = 0x0000; IMP; TXA; 
+L_F294: STEP; FETCH(0x48, 0xF295); operand = 0x0000; IMP; PHA; 
+L_F295: STEP; FETCH(0x98, 0xF296); operand = 0x0000; IMP; TYA; 
+L_F296: STEP; FETCH(0x48, 0xF297); operand = 0x0000; IMP; PHA; 
+L_F297: STEP; FETCH(0x20, 0xF29A); operand = 0xF88A; ABSO; JSR; goto L_F88A;
+L_F29A: STEP; FETCH(0xD0, 0xF29C); operand = 0x000E; REL; BNE; if (pc != 0xF29C) goto L_F2AA; 
+L_F29C: STEP; FETCH(0x20, 0xF29F); operand = 0xF8E3; ABSO; JSR; goto L_F8E3;
+L_F29F: STEP; FETCH(0xB0, 0xF2A1); operand = 0x000E; REL; BCS; if (pc != 0xF2A1) goto L_F2AF; 
+L_F2A1: STEP; FETCH(0xA9, 0xF2A3); operand = 0x0002; IMM; LDA(IMMV); 
+L_F2A3: STEP; FETCH(0xA0, 0xF2A5); operand = 0x0000; IMM; LDY(IMMV); 
+L_F2A5: STEP; FETCH(0x91, 0xF2A7); operand = 0x00B2; INDY(0); STA; 
+L_F2A7: STEP; FETCH(0xC8, 0xF2A8); operand = 0x0000; IMP; INY; 
+L_F2A8: STEP; FETCH(0x84, 0xF2AA); operand = 0x00A6; ZP; STY; 
+L_F2AA: STEP; FETCH(0xA5, 0xF2AC); operand = 0x009E; ZP; LDA(MEM); 
+L_F2AC: STEP; FETCH(0x91, 0xF2AE); operand = 0x00B2; INDY(0); STA; 
+L_F2AE: STEP; FETCH(0x18, 0xF2AF); operand = 0x0000; IMP; CLC; 
+L_F2AF: STEP; FETCH(0x68, 0xF2B0); operand = 0x0000; IMP; PLA; 
+L_F2B0: STEP; FETCH(0xA8, 0xF2B1); operand = 0x0000; IMP; TAY; 
+L_F2B1: STEP; FETCH(0x68, 0xF2B2); operand = 0x0000; IMP; PLA; 
+L_F2B2: STEP; FETCH(0xAA, 0xF2B3); operand = 0x0000; IMP; TAX; 
+L_F2B3: STEP; FETCH(0x68, 0xF2B4); operand = 0x0000; IMP; PLA; 
+L_F2B4: STEP; FETCH(0x90, 0xF2B6); operand = 0x0002; REL; BCC; if (pc != 0xF2B6) goto L_F2B8; 
+L_F2B6: STEP; FETCH(0xA9, 0xF2B8); operand = 0x0000; IMM; LDA(IMMV); 
+L_F2B8: STEP; FETCH(0x60, 0xF2B9); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F2B9: STEP; FETCH(0x68, 0xF2BA); operand = 0x0000; IMP; PLA; 
+L_F2BA: STEP; FETCH(0x86, 0xF2BC); operand = 0x0097; ZP; STX; 
+L_F2BC: STEP; FETCH(0x84, 0xF2BE); operand = 0x009E; ZP; STY; 
+L_F2BE: STEP; FETCH(0x20, 0xF2C1); operand = 0xF0ED; ABSO; JSR; goto L_F0ED;
+L_F2C1: STEP; FETCH(0xA6, 0xF2C3); operand = 0x0097; ZP; LDX(MEM); 
+L_F2C3: STEP; FETCH(0xA4, 0xF2C5); operand = 0x009E; ZP; LDY(MEM); 
+L_F2C5: STEP; FETCH(0x18, 0xF2C6); operand = 0x0000; IMP; CLC; 
+L_F2C6: STEP; FETCH(0x60, 0xF2C7); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F2C7: STEP; FETCH(0x20, 0xF2CA); operand = 0xF3CF; ABSO; JSR; goto L_F3CF;
+L_F2CA: STEP; FETCH(0xF0, 0xF2CC); operand = 0x0003; REL; BEQ; if (pc != 0xF2CC) goto L_F2CF; 
+L_F2CC: STEP; FETCH(0x4C, 0xF2CF); operand = 0xF784; ABSO; JMP; goto L_F784;
+L_F2CF: STEP; FETCH(0x20, 0xF2D2); operand = 0xF3DF; ABSO; JSR; goto L_F3DF;
+L_F2D2: STEP; FETCH(0xA5, 0xF2D4); operand = 0x00BA; ZP; LDA(MEM); 
+L_F2D4: STEP; FETCH(0xF0, 0xF2D6); operand = 0x0016; REL; BEQ; if (pc != 0xF2D6) goto L_F2EC; 
+L_F2D6: STEP; FETCH(0xC9, 0xF2D8); operand = 0x0003; IMM; CMP(IMMV); 
+L_F2D8: STEP; FETCH(0xF0, 0xF2DA); operand = 0x0012; REL; BEQ; if (pc != 0xF2DA) goto L_F2EC; 
+L_F2DA: STEP; FETCH(0xB0, 0xF2DC); operand = 0x0014; REL; BCS; if (pc != 0xF2DC) goto L_F2F0; 
+L_F2DC: STEP; FETCH(0xC9, 0xF2DE); operand = 0x0002; IMM; CMP(IMMV); 
+L_F2DE: STEP; FETCH(0xD0, 0xF2E0); operand = 0x0003; REL; BNE; if (pc != 0xF2E0) goto L_F2E3; 
+L_F2E0: STEP; FETCH(0x4C, 0xF2E3); operand = 0xF116; ABSO; JMP; goto L_F116;
+L_F2E3: STEP; FETCH(0xA6, 0xF2E5); operand = 0x00B9; ZP; LDX(MEM); 
+L_F2E5: STEP; FETCH(0xE0, 0xF2E7); operand = 0x0060; IMM; CPX(IMMV); 
+L_F2E7: STEP; FETCH(0xF0, 0xF2E9); operand = 0x0003; REL; BEQ; if (pc != 0xF2E9) goto L_F2EC; 
+L_F2E9: STEP; FETCH(0x4C, 0xF2EC); operand = 0xF78D; ABSO; JMP; goto L_F78D;
+L_F2EC: STEP; FETCH(0x85, 0xF2EE); operand = 0x0099; ZP; STA; 
+L_F2EE: STEP; FETCH(0x18, 0xF2EF); operand = 0x0000; IMP; CLC; 
+L_F2EF: STEP; FETCH(0x60, 0xF2F0); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F2F0: STEP; FETCH(0xAA, 0xF2F1); operand = 0x0000; IMP; TAX; 
+L_F2F1: STEP; FETCH(0x20, 0xF2F4); operand = 0xEE14; ABSO; JSR; goto L_EE14;
+L_F2F4: STEP; FETCH(0xA5, 0xF2F6); operand = 0x00B9; ZP; LDA(MEM); 
+L_F2F6: STEP; FETCH(0x10, 0xF2F8); operand = 0x0006; REL; BPL; if (pc != 0xF2F8) goto L_F2FE; 
+L_F2F8: STEP; FETCH(0x20, 0xF2FB); operand = 0xEED3; ABSO; JSR; goto L_EED3;
+L_F2FB: STEP; FETCH(0x4C, 0xF2FE); operand = 0xF301; ABSO; JMP; goto L_F301;
+L_F2FE: STEP; FETCH(0x20, 0xF301); operand = 0xEECE; ABSO; JSR; goto L_EECE;
+L_F301: STEP; FETCH(0x8A, 0xF302); operand = 0x0000; IMP; TXA; 
+L_F302: STEP; FETCH(0x24, 0xF304); operand = 0x0090; ZP; BIT(MEM); 
+L_F304: STEP; FETCH(0x10, 0xF306); operand = 0x00E6; REL; BPL; if (pc != 0xF306) goto L_F2EC; 
+L_F306: STEP; FETCH(0x4C, 0xF309); operand = 0xF78A; ABSO; JMP; goto L_F78A;
+L_F309: STEP; FETCH(0x20, 0xF30C); operand = 0xF3CF; ABSO; JSR; goto L_F3CF;
+L_F30C: STEP; FETCH(0xF0, 0xF30E); operand = 0x0003; REL; BEQ; if (pc != 0xF30E) goto L_F311; 
+L_F30E: STEP; FETCH(0x4C, 0xF311); operand = 0xF784; ABSO; JMP; goto L_F784;
+L_F311: STEP; FETCH(0x20, 0xF314); operand = 0xF3DF; ABSO; JSR; goto L_F3DF;
+L_F314: STEP; FETCH(0xA5, 0xF316); operand = 0x00BA; ZP; LDA(MEM); 
+L_F316: STEP; FETCH(0xD0, 0xF318); operand = 0x0003; REL; BNE; if (pc != 0xF318) goto L_F31B; 
+L_F318: STEP; FETCH(0x4C, 0xF31B); operand = 0xF790; ABSO; JMP; goto L_F790;
+L_F31B: STEP; FETCH(0xC9, 0xF31D); operand = 0x0003; IMM; CMP(IMMV); 
+L_F31D: STEP; FETCH(0xF0, 0xF31F); operand = 0x000F; REL; BEQ; if (pc != 0xF31F) goto L_F32E; 
+L_F31F: STEP; FETCH(0xB0, 0xF321); operand = 0x0011; REL; BCS; if (pc != 0xF321) goto L_F332; 
+L_F321: STEP; FETCH(0xC9, 0xF323); operand = 0x0002; IMM; CMP(IMMV); 
+L_F323: STEP; FETCH(0xD0, 0xF325); operand = 0x0003; REL; BNE; if (pc != 0xF325) goto L_F328; 
+L_F325: STEP; FETCH(0x4C, 0xF328); operand = 0xF0BC; ABSO; JMP; goto L_F0BC;
+L_F328: STEP; FETCH(0xA6, 0xF32A); operand = 0x00B9; ZP; LDX(MEM); 
+L_F32A: STEP; FETCH(0xE0, 0xF32C); operand = 0x0060; IMM; CPX(IMMV); 
+L_F32C: STEP; FETCH(0xF0, 0xF32E); operand = 0x00EA; REL; BEQ; if (pc != 0xF32E) goto L_F318; 
+L_F32E: STEP; FETCH(0x85, 0xF330); operand = 0x009A; ZP; STA; 
+L_F330: STEP; FETCH(0x18, 0xF331); operand = 0x0000; IMP; CLC; 
+L_F331: STEP; FETCH(0x60, 0xF332); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F332: STEP; FETCH(0xAA, 0xF333); operand = 0x0000; IMP; TAX; 
+L_F333: STEP; FETCH(0x20, 0xF336); operand = 0xEE17; ABSO; JSR; goto L_EE17;
+L_F336: STEP; FETCH(0xA5, 0xF338); operand = 0x00B9; ZP; LDA(MEM); 
+L_F338: STEP; FETCH(0x10, 0xF33A); operand = 0x0005; REL; BPL; if (pc != 0xF33A) goto L_F33F; 
+L_F33A: STEP; FETCH(0x20, 0xF33D); operand = 0xEEC5; ABSO; JSR; goto L_EEC5;
+L_F33D: STEP; FETCH(0xD0, 0xF33F); operand = 0x0003; REL; BNE; if (pc != 0xF33F) goto L_F342; 
+L_F33F: STEP; FETCH(0x20, 0xF342); operand = 0xEEC0; ABSO; JSR; goto L_EEC0;
+L_F342: STEP; FETCH(0x8A, 0xF343); operand = 0x0000; IMP; TXA; 
+L_F343: STEP; FETCH(0x24, 0xF345); operand = 0x0090; ZP; BIT(MEM); 
+L_F345: STEP; FETCH(0x10, 0xF347); operand = 0x00E7; REL; BPL; if (pc != 0xF347) goto L_F32E; 
+L_F347: STEP; FETCH(0x4C, 0xF34A); operand = 0xF78A; ABSO; JMP; goto L_F78A;
+L_F34A: STEP; FETCH(0x20, 0xF34D); operand = 0xF3D4; ABSO; JSR; goto L_F3D4;
+L_F34D: STEP; FETCH(0xF0, 0xF34F); operand = 0x0002; REL; BEQ; if (pc != 0xF34F) goto L_F351; 
+L_F34F: STEP; FETCH(0x18, 0xF350); operand = 0x0000; IMP; CLC; 
+L_F350: STEP; FETCH(0x60, 0xF351); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F351: STEP; FETCH(0x20, 0xF354); operand = 0xF3DF; ABSO; JSR; goto L_F3DF;
+L_F354: STEP; FETCH(0x8A, 0xF355); operand = 0x0000; IMP; TXA; 
+L_F355: STEP; FETCH(0x48, 0xF356); operand = 0x0000; IMP; PHA; 
+L_F356: STEP; FETCH(0xA5, 0xF358); operand = 0x00BA; ZP; LDA(MEM); 
+L_F358: STEP; FETCH(0xF0, 0xF35A); operand = 0x0057; REL; BEQ; if (pc != 0xF35A) goto L_F3B1; 
+L_F35A: STEP; FETCH(0xC9, 0xF35C); operand = 0x0003; IMM; CMP(IMMV); 
+L_F35C: STEP; FETCH(0xF0, 0xF35E); operand = 0x0053; REL; BEQ; if (pc != 0xF35E) goto L_F3B1; 
+L_F35E: STEP; FETCH(0xB0, 0xF360); operand = 0x004E; REL; BCS; if (pc != 0xF360) goto L_F3AE; 
+L_F360: STEP; FETCH(0xC9, 0xF362); operand = 0x0002; IMM; CMP(IMMV); 
+L_F362: STEP; FETCH(0xD0, 0xF364); operand = 0x0029; REL; BNE; if (pc != 0xF364) goto L_F38D; 
+L_F364: STEP; FETCH(0x68, 0xF365); operand = 0x0000; IMP; PLA; 
+L_F365: STEP; FETCH(0x20, 0xF368); operand = 0xF3B2; ABSO; JSR; goto L_F3B2;
+L_F368: STEP; FETCH(0xA9, 0xF36A); operand = 0x007D; IMM; LDA(IMMV); 
+L_F36A: STEP; FETCH(0x8D, 0xF36D); operand = 0x911E; ABSO; STA; 
+L_F36D: STEP; FETCH(0xA9, 0xF36F); operand = 0x0006; IMM; LDA(IMMV); 
+L_F36F: STEP; FETCH(0x8D, 0xF372); operand = 0x9110; ABSO; STA; 
+L_F372: STEP; FETCH(0xA9, 0xF374); operand = 0x00EE; IMM; LDA(IMMV); 
+L_F374: STEP; FETCH(0x8D, 0xF377); operand = 0x911C; ABSO; STA; 
+L_F377: STEP; FETCH(0x20, 0xF37A); operand = 0xFE75; ABSO; JSR; goto L_FE75;
+L_F37A: STEP; FETCH(0xA5, 0xF37C); operand = 0x00F8; ZP; LDA(MEM); 
+L_F37C: STEP; FETCH(0xF0, 0xF37E); operand = 0x0001; REL; BEQ; if (pc != 0xF37E) goto L_F37F; 
+L_F37E: STEP; FETCH(0xC8, 0xF37F); operand = 0x0000; IMP; INY; 
+L_F37F: STEP; FETCH(0xA5, 0xF381); operand = 0x00FA; ZP; LDA(MEM); 
+L_F381: STEP; FETCH(0xF0, 0xF383); operand = 0x0001; REL; BEQ; if (pc != 0xF383) goto L_F384; 
+L_F383: STEP; FETCH(0xC8, 0xF384); operand = 0x0000; IMP; INY; 
+L_F384: STEP; FETCH(0xA9, 0xF386); operand = 0x0000; IMM; LDA(IMMV); 
+L_F386: STEP; FETCH(0x85, 0xF388); operand = 0x00F8; ZP; STA; 
+L_F388: STEP; FETCH(0x85, 0xF38A); operand = 0x00FA; ZP; STA; 
+L_F38A: STEP; FETCH(0x4C, 0xF38D); operand = 0xF53C; ABSO; JMP; goto L_F53C;
+L_F38D: STEP; FETCH(0xA5, 0xF38F); operand = 0x00B9; ZP; LDA(MEM); 
+L_F38F: STEP; FETCH(0x29, 0xF391); operand = 0x000F; IMM; AND(IMMV); 
+L_F391: STEP; FETCH(0xF0, 0xF393); operand = 0x001E; REL; BEQ; if (pc != 0xF393) goto L_F3B1; 
+L_F393: STEP; FETCH(0x20, 0xF396); operand = 0xF84D; ABSO; JSR; goto L_F84D;
+L_F396: STEP; FETCH(0xA9, 0xF398); operand = 0x0000; IMM; LDA(IMMV); 
+L_F398: STEP; FETCH(0x20, 0xF39B); operand = 0xF290; ABSO; JSR; goto L_F290;
+L_F39B: STEP; FETCH(0x4C, 0xF39E); operand = 0xE4CF; ABSO; JMP; goto L_E4CF;
+L_F39E: STEP; FETCH(0xB0, 0xF3A0); operand = 0x002E; REL; BCS; if (pc != 0xF3A0) goto L_F3CE; 
+L_F3A0: STEP; FETCH(0xA5, 0xF3A2); operand = 0x00B9; ZP; LDA(MEM); 
+L_F3A2: STEP; FETCH(0xC9, 0xF3A4); operand = 0x0062; IMM; CMP(IMMV); 
+L_F3A4: STEP; FETCH(0xD0, 0xF3A6); operand = 0x000B; REL; BNE; if (pc != 0xF3A6) goto L_F3B1; 
+L_F3A6: STEP; FETCH(0xA9, 0xF3A8); operand = 0x0005; IMM; LDA(IMMV); 
+L_F3A8: STEP; FETCH(0x20, 0xF3AB); operand = 0xF7E7; ABSO; JSR; goto L_F7E7;
+L_F3AB: STEP; FETCH(0x4C, 0xF3AE); operand = 0xF3B1; ABSO; JMP; goto L_F3B1;
+L_F3AE: STEP; FETCH(0x20, 0xF3B1); operand = 0xF6DA; ABSO; JSR; goto L_F6DA;
+L_F3B1: STEP; FETCH(0x68, 0xF3B2); operand = 0x0000; IMP; PLA; 
+L_F3B2: STEP; FETCH(0xAA, 0xF3B3); operand = 0x0000; IMP; TAX; 
+L_F3B3: STEP; FETCH(0xC6, 0xF3B5); operand = 0x0098; ZP; DEC; 
+L_F3B5: STEP; FETCH(0xE4, 0xF3B7); operand = 0x0098; ZP; CPX(MEM); 
+L_F3B7: STEP; FETCH(0xF0, 0xF3B9); operand = 0x0014; REL; BEQ; if (pc != 0xF3B9) goto L_F3CD; 
+L_F3B9: STEP; FETCH(0xA4, 0xF3BB); operand = 0x0098; ZP; LDY(MEM); 
+L_F3BB: STEP; FETCH(0xB9, 0xF3BE); operand = 0x0259; ABSY(1); LDA(MEM); 
+L_F3BE: STEP; FETCH(0x9D, 0xF3C1); operand = 0x0259; ABSX(0); STA; 
+L_F3C1: STEP; FETCH(0xB9, 0xF3C4); operand = 0x0263; ABSY(1); LDA(MEM); 
+L_F3C4: STEP; FETCH(0x9D, 0xF3C7); operand = 0x0263; ABSX(0); STA; 
+L_F3C7: STEP; FETCH(0xB9, 0xF3CA); operand = 0x026D; ABSY(1); LDA(MEM); 
+L_F3CA: STEP; FETCH(0x9D, 0xF3CD); operand = 0x026D; ABSX(0); STA; 
+L_F3CD: STEP; FETCH(0x18, 0xF3CE); operand = 0x0000; IMP; CLC; 
+L_F3CE: STEP; FETCH(0x60, 0xF3CF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F3CF: STEP; FETCH(0xA9, 0xF3D1); operand = 0x0000; IMM; LDA(IMMV); 
+L_F3D1: STEP; FETCH(0x85, 0xF3D3); operand = 0x0090; ZP; STA; 
+L_F3D3: STEP; FETCH(0x8A, 0xF3D4); operand = 0x0000; IMP; TXA; 
+L_F3D4: STEP; FETCH(0xA6, 0xF3D6); operand = 0x0098; ZP; LDX(MEM); 
+L_F3D6: STEP; FETCH(0xCA, 0xF3D7); operand = 0x0000; IMP; DEX; 
+L_F3D7: STEP; FETCH(0x30, 0xF3D9); operand = 0x0015; REL; BMI; if (pc != 0xF3D9) goto L_F3EE; 
+L_F3D9: STEP; FETCH(0xDD, 0xF3DC); operand = 0x0259; ABSX(1); CMP(MEM); 
+L_F3DC: STEP; FETCH(0xD0, 0xF3DE); operand = 0x00F8; REL; BNE; if (pc != 0xF3DE) goto L_F3D6; 
+L_F3DE: STEP; FETCH(0x60, 0xF3DF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F3DF: STEP; FETCH(0xBD, 0xF3E2); operand = 0x0259; ABSX(1); LDA(MEM); 
+L_F3E2: STEP; FETCH(0x85, 0xF3E4); operand = 0x00B8; ZP; STA; 
+L_F3E4: STEP; FETCH(0xBD, 0xF3E7); operand = 0x0263; ABSX(1); LDA(MEM); 
+L_F3E7: STEP; FETCH(0x85, 0xF3E9); operand = 0x00BA; ZP; STA; 
+L_F3E9: STEP; FETCH(0xBD, 0xF3EC); operand = 0x026D; ABSX(1); LDA(MEM); 
+L_F3EC: STEP; FETCH(0x85, 0xF3EE); operand = 0x00B9; ZP; STA; 
+L_F3EE: STEP; FETCH(0x60, 0xF3EF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F3EF: STEP; FETCH(0xA9, 0xF3F1); operand = 0x0000; IMM; LDA(IMMV); 
+L_F3F1: STEP; FETCH(0x85, 0xF3F3); operand = 0x0098; ZP; STA; 
+L_F3F3: STEP; FETCH(0xA2, 0xF3F5); operand = 0x0003; IMM; LDX(IMMV); 
+L_F3F5: STEP; FETCH(0xE4, 0xF3F7); operand = 0x009A; ZP; CPX(MEM); 
+L_F3F7: STEP; FETCH(0xB0, 0xF3F9); operand = 0x0003; REL; BCS; if (pc != 0xF3F9) goto L_F3FC; 
+L_F3F9: STEP; FETCH(0x20, 0xF3FC); operand = 0xEF04; ABSO; JSR; goto L_EF04;
+L_F3FC: STEP; FETCH(0xE4, 0xF3FE); operand = 0x0099; ZP; CPX(MEM); 
+L_F3FE: STEP; FETCH(0xB0, 0xF400); operand = 0x0003; REL; BCS; if (pc != 0xF400) goto L_F403; 
+L_F400: STEP; FETCH(0x20, 0xF403); operand = 0xEEF6; ABSO; JSR; goto L_EEF6;
+L_F403: STEP; FETCH(0x86, 0xF405); operand = 0x009A; ZP; STX; 
+L_F405: STEP; FETCH(0xA9, 0xF407); operand = 0x0000; IMM; LDA(IMMV); 
+L_F407: STEP; FETCH(0x85, 0xF409); operand = 0x0099; ZP; STA; 
+L_F409: STEP; FETCH(0x60, 0xF40A); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F40A: STEP; FETCH(0xA6, 0xF40C); operand = 0x00B8; ZP; LDX(MEM); 
+L_F40C: STEP; FETCH(0xD0, 0xF40E); operand = 0x0003; REL; BNE; if (pc != 0xF40E) goto L_F411; 
+L_F40E: STEP; FETCH(0x4C, 0xF411); operand = 0xF78D; ABSO; JMP; goto L_F78D;
+L_F411: STEP; FETCH(0x20, 0xF414); operand = 0xF3CF; ABSO; JSR; goto L_F3CF;
+L_F414: STEP; FETCH(0xD0, 0xF416); operand = 0x0003; REL; BNE; if (pc != 0xF416) goto L_F419; 
+L_F416: STEP; FETCH(0x4C, 0xF419); operand = 0xF781; ABSO; JMP; goto L_F781;
+L_F419: STEP; FETCH(0xA6, 0xF41B); operand = 0x0098; ZP; LDX(MEM); 
+L_F41B: STEP; FETCH(0xE0, 0xF41D); operand = 0x000A; IMM; CPX(IMMV); 
+L_F41D: STEP; FETCH(0x90, 0xF41F); operand = 0x0003; REL; BCC; if (pc != 0xF41F) goto L_F422; 
+L_F41F: STEP; FETCH(0x4C, 0xF422); operand = 0xF77E; ABSO; JMP; goto L_F77E;
+L_F422: STEP; FETCH(0xE6, 0xF424); operand = 0x0098; ZP; INC; 
+L_F424: STEP; FETCH(0xA5, 0xF426); operand = 0x00B8; ZP; LDA(MEM); 
+L_F426: STEP; FETCH(0x9D, 0xF429); operand = 0x0259; ABSX(0); STA; 
+L_F429: STEP; FETCH(0xA5, 0xF42B); operand = 0x00B9; ZP; LDA(MEM); 
+L_F42B: STEP; FETCH(0x09, 0xF42D); operand = 0x0060; IMM; ORA(IMMV); 
+L_F42D: STEP; FETCH(0x85, 0xF42F); operand = 0x00B9; ZP; STA; 
+L_F42F: STEP; FETCH(0x9D, 0xF432); operand = 0x026D; ABSX(0); STA; 
+L_F432: STEP; FETCH(0xA5, 0xF434); operand = 0x00BA; ZP; LDA(MEM); 
+L_F434: STEP; FETCH(0x9D, 0xF437); operand = 0x0263; ABSX(0); STA; 
+L_F437: STEP; FETCH(0xF0, 0xF439); operand = 0x005A; REL; BEQ; if (pc != 0xF439) goto L_F493; 
+L_F439: STEP; FETCH(0xC9, 0xF43B); operand = 0x0003; IMM; CMP(IMMV); 
+L_F43B: STEP; FETCH(0xF0, 0xF43D); operand = 0x0056; REL; BEQ; if (pc != 0xF43D) goto L_F493; 
+L_F43D: STEP; FETCH(0x90, 0xF43F); operand = 0x0005; REL; BCC; if (pc != 0xF43F) goto L_F444; 
+L_F43F: STEP; FETCH(0x20, 0xF442); operand = 0xF495; ABSO; JSR; goto L_F495;
+L_F442: STEP; FETCH(0x90, 0xF444); operand = 0x004F; REL; BCC; if (pc != 0xF444) goto L_F493; 
+L_F444: STEP; FETCH(0xC9, 0xF446); operand = 0x0002; IMM; CMP(IMMV); 
+L_F446: STEP; FETCH(0xD0, 0xF448); operand = 0x0003; REL; BNE; if (pc != 0xF448) goto L_F44B; 
+L_F448: STEP; FETCH(0x4C, 0xF44B); operand = 0xF4C7; ABSO; JMP; goto L_F4C7;
+L_F44B: STEP; FETCH(0x20, 0xF44E); operand = 0xF84D; ABSO; JSR; goto L_F84D;
+L_F44E: STEP; FETCH(0xB0, 0xF450); operand = 0x0003; REL; BCS; if (pc != 0xF450) goto L_F453; 
+L_F450: STEP; FETCH(0x4C, 0xF453); operand = 0xF796; ABSO; JMP; goto L_F796;
+L_F453: STEP; FETCH(0xA5, 0xF455); operand = 0x00B9; ZP; LDA(MEM); 
+L_F455: STEP; FETCH(0x29, 0xF457); operand = 0x000F; IMM; AND(IMMV); 
+L_F457: STEP; FETCH(0xD0, 0xF459); operand = 0x001F; REL; BNE; if (pc != 0xF459) goto L_F478; 
+L_F459: STEP; FETCH(0x20, 0xF45C); operand = 0xF894; ABSO; JSR; goto L_F894;
+L_F45C: STEP; FETCH(0xB0, 0xF45E); operand = 0x0036; REL; BCS; if (pc != 0xF45E) goto L_F494; 
+L_F45E: STEP; FETCH(0x20, 0xF461); operand = 0xF647; ABSO; JSR; goto L_F647;
+L_F461: STEP; FETCH(0xA5, 0xF463); operand = 0x00B7; ZP; LDA(MEM); 
+L_F463: STEP; FETCH(0xF0, 0xF465); operand = 0x000A; REL; BEQ; if (pc != 0xF465) goto L_F46F; 
+L_F465: STEP; FETCH(0x20, 0xF468); operand = 0xF867; ABSO; JSR; goto L_F867;
+L_F468: STEP; FETCH(0x90, 0xF46A); operand = 0x0018; REL; BCC; if (pc != 0xF46A) goto L_F482; 
+L_F46A: STEP; FETCH(0xF0, 0xF46C); operand = 0x0028; REL; BEQ; if (pc != 0xF46C) goto L_F494; 
+L_F46C: STEP; FETCH(0x4C, 0xF46F); operand = 0xF787; ABSO; JMP; goto L_F787;
+L_F46F: STEP; FETCH(0x20, 0xF472); operand = 0xF7AF; ABSO; JSR; goto L_F7AF;
+L_F472: STEP; FETCH(0xF0, 0xF474); operand = 0x0020; REL; BEQ; if (pc != 0xF474) goto L_F494; 
+L_F474: STEP; FETCH(0x90, 0xF476); operand = 0x000C; REL; BCC; if (pc != 0xF476) goto L_F482; 
+L_F476: STEP; FETCH(0xB0, 0xF478); operand = 0x00F4; REL; BCS; if (pc != 0xF478) goto L_F46C; 
+L_F478: STEP; FETCH(0x20, 0xF47B); operand = 0xF8B7; ABSO; JSR; goto L_F8B7;
+L_F47B: STEP; FETCH(0xB0, 0xF47D); operand = 0x0017; REL; BCS; if (pc != 0xF47D) goto L_F494; 
+L_F47D: STEP; FETCH(0xA9, 0xF47F); operand = 0x0004; IMM; LDA(IMMV); 
+L_F47F: STEP; FETCH(0x20, 0xF482); operand = 0xF7E7; ABSO; JSR; goto L_F7E7;
+L_F482: STEP; FETCH(0xA9, 0xF484); operand = 0x00BF; IMM; LDA(IMMV); 
+L_F484: STEP; FETCH(0xA4, 0xF486); operand = 0x00B9; ZP; LDY(MEM); 
+L_F486: STEP; FETCH(0xC0, 0xF488); operand = 0x0060; IMM; CPY(IMMV); 
+L_F488: STEP; FETCH(0xF0, 0xF48A); operand = 0x0007; REL; BEQ; if (pc != 0xF48A) goto L_F491; 
+L_F48A: STEP; FETCH(0xA0, 0xF48C); operand = 0x0000; IMM; LDY(IMMV); 
+L_F48C: STEP; FETCH(0xA9, 0xF48E); operand = 0x0002; IMM; LDA(IMMV); 
+L_F48E: STEP; FETCH(0x91, 0xF490); operand = 0x00B2; INDY(0); STA; 
+L_F490: STEP; FETCH(0x98, 0xF491); operand = 0x0000; IMP; TYA; 
+L_F491: STEP; FETCH(0x85, 0xF493); operand = 0x00A6; ZP; STA; 
+L_F493: STEP; FETCH(0x18, 0xF494); operand = 0x0000; IMP; CLC; 
+L_F494: STEP; FETCH(0x60, 0xF495); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F495: STEP; FETCH(0xA5, 0xF497); operand = 0x00B9; ZP; LDA(MEM); 
+L_F497: STEP; FETCH(0x30, 0xF499); operand = 0x002C; REL; BMI; if (pc != 0xF499) goto L_F4C5; 
+L_F499: STEP; FETCH(0xA4, 0xF49B); operand = 0x00B7; ZP; LDY(MEM); 
+L_F49B: STEP; FETCH(0xF0, 0xF49D); operand = 0x0028; REL; BEQ; if (pc != 0xF49D) goto L_F4C5; 
+L_F49D: STEP; FETCH(0xA5, 0xF49F); operand = 0x00BA; ZP; LDA(MEM); 
+L_F49F: STEP; FETCH(0x20, 0xF4A2); operand = 0xEE17; ABSO; JSR; goto L_EE17;
+L_F4A2: STEP; FETCH(0xA5, 0xF4A4); operand = 0x00B9; ZP; LDA(MEM); 
+L_F4A4: STEP; FETCH(0x09, 0xF4A6); operand = 0x00F0; IMM; ORA(IMMV); 
+L_F4A6: STEP; FETCH(0x20, 0xF4A9); operand = 0xEEC0; ABSO; JSR; goto L_EEC0;
+L_F4A9: STEP; FETCH(0xA5, 0xF4AB); operand = 0x0090; ZP; LDA(MEM); 
+L_F4AB: STEP; FETCH(0x10, 0xF4AD); operand = 0x0005; REL; BPL; if (pc != 0xF4AD) goto L_F4B2; 
+L_F4AD: STEP; FETCH(0x68, 0xF4AE); operand = 0x0000; IMP; PLA; 
+L_F4AE: STEP; FETCH(0x68, 0xF4AF); operand = 0x0000; IMP; PLA; 
+L_F4AF: STEP; FETCH(0x4C, 0xF4B2); operand = 0xF78A; ABSO; JMP; goto L_F78A;
+L_F4B2: STEP; FETCH(0xA5, 0xF4B4); operand = 0x00B7; ZP; LDA(MEM); 
+L_F4B4: STEP; FETCH(0xF0, 0xF4B6); operand = 0x000C; REL; BEQ; if (pc != 0xF4B6) goto L_F4C2; 
+L_F4B6: STEP; FETCH(0xA0, 0xF4B8); operand = 0x0000; IMM; LDY(IMMV); 
+L_F4B8: STEP; FETCH(0xB1, 0xF4BA); operand = 0x00BB; INDY(1); LDA(MEM); 
+L_F4BA: STEP; FETCH(0x20, 0xF4BD); operand = 0xEEE4; ABSO; JSR; goto L_EEE4;
+L_F4BD: STEP; FETCH(0xC8, 0xF4BE); operand = 0x0000; IMP; INY; 
+L_F4BE: STEP; FETCH(0xC4, 0xF4C0); operand = 0x00B7; ZP; CPY(MEM); 
+L_F4C0: STEP; FETCH(0xD0, 0xF4C2); operand = 0x00F6; REL; BNE; if (pc != 0xF4C2) goto L_F4B8; 
+L_F4C2: STEP; FETCH(0x20, 0xF4C5); operand = 0xEF04; ABSO; JSR; goto L_EF04;
+L_F4C5: STEP; FETCH(0x18, 0xF4C6); operand = 0x0000; IMP; CLC; 
+L_F4C6: STEP; FETCH(0x60, 0xF4C7); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F4C7: STEP; FETCH(0xA9, 0xF4C9); operand = 0x0006; IMM; LDA(IMMV); 
+L_F4C9: STEP; FETCH(0x8D, 0xF4CC); operand = 0x9112; ABSO; STA; 
+L_F4CC: STEP; FETCH(0x8D, 0xF4CF); operand = 0x9110; ABSO; STA; 
+L_F4CF: STEP; FETCH(0xA9, 0xF4D1); operand = 0x00EE; IMM; LDA(IMMV); 
+L_F4D1: STEP; FETCH(0x8D, 0xF4D4); operand = 0x911C; ABSO; STA; 
+L_F4D4: STEP; FETCH(0xA0, 0xF4D6); operand = 0x0000; IMM; LDY(IMMV); 
+L_F4D6: STEP; FETCH(0x8C, 0xF4D9); operand = 0x0297; ABSO; STY; 
+L_F4D9: STEP; FETCH(0xC4, 0xF4DB); operand = 0x00B7; ZP; CPY(MEM); 
+L_F4DB: STEP; FETCH(0xF0, 0xF4DD); operand = 0x000A; REL; BEQ; if (pc != 0xF4DD) goto L_F4E7; 
+L_F4DD: STEP; FETCH(0xB1, 0xF4DF); operand = 0x00BB; INDY(1); LDA(MEM); 
+L_F4DF: STEP; FETCH(0x99, 0xF4E2); operand = 0x0293; ABSY(0); STA; 
+L_F4E2: STEP; FETCH(0xC8, 0xF4E3); operand = 0x0000; IMP; INY; 
+L_F4E3: STEP; FETCH(0xC0, 0xF4E5); operand = 0x0004; IMM; CPY(IMMV); 
+L_F4E5: STEP; FETCH(0xD0, 0xF4E7); operand = 0x00F2; REL; BNE; if (pc != 0xF4E7) goto L_F4D9; 
+L_F4E7: STEP; FETCH(0x20, 0xF4EA); operand = 0xF027; ABSO; JSR; goto L_F027;
+L_F4EA: STEP; FETCH(0x8E, 0xF4ED); operand = 0x0298; ABSO; STX; 
+L_F4ED: STEP; FETCH(0xAD, 0xF4F0); operand = 0x0293; ABSO; LDA(MEM); 
+L_F4F0: STEP; FETCH(0x29, 0xF4F2); operand = 0x000F; IMM; AND(IMMV); 
+L_F4F2: STEP; FETCH(0xD0, 0xF4F4); operand = 0x0000; REL; BNE; if (pc != 0xF4F4) goto L_F4F4; 
+L_F4F4: STEP; FETCH(0x0A, 0xF4F5); operand = 0x0000; ACC; ASL_A; 
+L_F4F5: STEP; FETCH(0xAA, 0xF4F6); operand = 0x0000; IMP; TAX; 
+L_F4F6: STEP; FETCH(0xBD, 0xF4F9); operand = 0xFF5A; ABSX(1); LDA(MEM); 
+L_F4F9: STEP; FETCH(0x0A, 0xF4FA); operand = 0x0000; ACC; ASL_A; 
+L_F4FA: STEP; FETCH(0xA8, 0xF4FB); operand = 0x0000; IMP; TAY; 
+L_F4FB: STEP; FETCH(0xBD, 0xF4FE); operand = 0xFF5B; ABSX(1); LDA(MEM); 
+L_F4FE: STEP; FETCH(0x2A, 0xF4FF); operand = 0x0000; ACC; ROL_A; 
+L_F4FF: STEP; FETCH(0x48, 0xF500); operand = 0x0000; IMP; PHA; 
+L_F500: STEP; FETCH(0x98, 0xF501); operand = 0x0000; IMP; TYA; 
+L_F501: STEP; FETCH(0x69, 0xF503); operand = 0x00C8; IMM; ADC(IMMV); 
+L_F503: STEP; FETCH(0x8D, 0xF506); operand = 0x0299; ABSO; STA; 
+L_F506: STEP; FETCH(0x68, 0xF507); operand = 0x0000; IMP; PLA; 
+L_F507: STEP; FETCH(0x69, 0xF509); operand = 0x0000; IMM; ADC(IMMV); 
+L_F509: STEP; FETCH(0x8D, 0xF50C); operand = 0x029A; ABSO; STA; 
+L_F50C: STEP; FETCH(0xAD, 0xF50F); operand = 0x0294; ABSO; LDA(MEM); 
+L_F50F: STEP; FETCH(0x4A, 0xF510); operand = 0x0000; ACC; LSR_A; 
+L_F510: STEP; FETCH(0x90, 0xF512); operand = 0x0009; REL; BCC; if (pc != 0xF512) goto L_F51B; 
+L_F512: STEP; FETCH(0xAD, 0xF515); operand = 0x9120; ABSO; LDA(MEM); 
+L_F515: STEP; FETCH(0x0A, 0xF516); operand = 0x0000; ACC; ASL_A; 
+L_F516: STEP; FETCH(0xB0, 0xF518); operand = 0x0003; REL; BCS; if (pc != 0xF518) goto L_F51B; 
+L_F518: STEP; FETCH(0x4C, 0xF51B); operand = 0xF016; ABSO; JMP; goto L_F016;
+L_F51B: STEP; FETCH(0xAD, 0xF51E); operand = 0x029B; ABSO; LDA(MEM); 
+L_F51E: STEP; FETCH(0x8D, 0xF521); operand = 0x029C; ABSO; STA; 
+L_F521: STEP; FETCH(0xAD, 0xF524); operand = 0x029E; ABSO; LDA(MEM); 
+L_F524: STEP; FETCH(0x8D, 0xF527); operand = 0x029D; ABSO; STA; 
+L_F527: STEP; FETCH(0x20, 0xF52A); operand = 0xFE75; ABSO; JSR; goto L_FE75;
+L_F52A: STEP; FETCH(0xA5, 0xF52C); operand = 0x00F8; ZP; LDA(MEM); 
+L_F52C: STEP; FETCH(0xD0, 0xF52E); operand = 0x0005; REL; BNE; if (pc != 0xF52E) goto L_F533; 
+L_F52E: STEP; FETCH(0x88, 0xF52F); operand = 0x0000; IMP; DEY; 
+L_F52F: STEP; FETCH(0x84, 0xF531); operand = 0x00F8; ZP; STY; 
+L_F531: STEP; FETCH(0x86, 0xF533); operand = 0x00F7; ZP; STX; 
+L_F533: STEP; FETCH(0xA5, 0xF535); operand = 0x00FA; ZP; LDA(MEM); 
+L_F535: STEP; FETCH(0xD0, 0xF537); operand = 0x0005; REL; BNE; if (pc != 0xF537) goto L_F53C; 
+L_F537: STEP; FETCH(0x88, 0xF538); operand = 0x0000; IMP; DEY; 
+L_F538: STEP; FETCH(0x84, 0xF53A); operand = 0x00FA; ZP; STY; 
+L_F53A: STEP; FETCH(0x86, 0xF53C); operand = 0x00F9; ZP; STX; 
+L_F53C: STEP; FETCH(0x38, 0xF53D); operand = 0x0000; IMP; SEC; 
+L_F53D: STEP; FETCH(0xA9, 0xF53F); operand = 0x00F0; IMM; LDA(IMMV); 
+L_F53F: STEP; FETCH(0x4C, 0xF542); operand = 0xFE7B; ABSO; JMP; goto L_FE7B;
+L_F542: STEP; FETCH(0x86, 0xF544); operand = 0x00C3; ZP; STX; 
+L_F544: STEP; FETCH(0x84, 0xF546); operand = 0x00C4; ZP; STY; 
+L_F546: STEP; FETCH(0x6C, 0xF549); operand = 0x0330; IND; JMP; goto dispatch;
+L_F549: STEP; FETCH(0x85, 0xF54B); operand = 0x0093; ZP; STA; 
+L_F54B: STEP; FETCH(0xA9, 0xF54D); operand = 0x0000; IMM; LDA(IMMV); 
+L_F54D: STEP; FETCH(0x85, 0xF54F); operand = 0x0090; ZP; STA; 
+L_F54F: STEP; FETCH(0xA5, 0xF551); operand = 0x00BA; ZP; LDA(MEM); 
+L_F551: STEP; FETCH(0xD0, 0xF553); operand = 0x0003; REL; BNE; if (pc != 0xF553) goto L_F556; 
+L_F553: STEP; FETCH(0x4C, 0xF556); operand = 0xF796; ABSO; JMP; goto L_F796;
+L_F556: STEP; FETCH(0xC9, 0xF558); operand = 0x0003; IMM; CMP(IMMV); 
+L_F558: STEP; FETCH(0xF0, 0xF55A); operand = 0x00F9; REL; BEQ; if (pc != 0xF55A) goto L_F553; 
+L_F55A: STEP; FETCH(0x90, 0xF55C); operand = 0x006E; REL; BCC; if (pc != 0xF55C) goto L_F5CA; 
+L_F55C: STEP; FETCH(0xA4, 0xF55E); operand = 0x00B7; ZP; LDY(MEM); 
+L_F55E: STEP; FETCH(0xD0, 0xF560); operand = 0x0003; REL; BNE; if (pc != 0xF560) goto L_F563; 
+L_F560: STEP; FETCH(0x4C, 0xF563); operand = 0xF793; ABSO; JMP; goto L_F793;
+L_F563: STEP; FETCH(0x20, 0xF566); operand = 0xE4BC; ABSO; JSR; goto L_E4BC;
+L_F566: STEP; FETCH(0xA9, 0xF568); operand = 0x0060; IMM; LDA(IMMV); 
+L_F568: STEP; FETCH(0x85, 0xF56A); operand = 0x00B9; ZP; STA; 
+L_F56A: STEP; FETCH(0x20, 0xF56D); operand = 0xF495; ABSO; JSR; goto L_F495;
+L_F56D: STEP; FETCH(0xA5, 0xF56F); operand = 0x00BA; ZP; LDA(MEM); 
+L_F56F: STEP; FETCH(0x20, 0xF572); operand = 0xEE14; ABSO; JSR; goto L_EE14;
+L_F572: STEP; FETCH(0xA5, 0xF574); operand = 0x00B9; ZP; LDA(MEM); 
+L_F574: STEP; FETCH(0x20, 0xF577); operand = 0xEECE; ABSO; JSR; goto L_EECE;
+L_F577: STEP; FETCH(0x20, 0xF57A); operand = 0xEF19; ABSO; JSR; goto L_EF19;
+L_F57A: STEP; FETCH(0x85, 0xF57C); operand = 0x00AE; ZP; STA; 
+L_F57C: STEP; FETCH(0xA5, 0xF57E); operand = 0x0090; ZP; LDA(MEM); 
+L_F57E: STEP; FETCH(0x4A, 0xF57F); operand = 0x0000; ACC; LSR_A; 
+L_F57F: STEP; FETCH(0x4A, 0xF580); operand = 0x0000; ACC; LSR_A; 
+L_F580: STEP; FETCH(0xB0, 0xF582); operand = 0x0045; REL; BCS; if (pc != 0xF582) goto L_F5C7; 
+L_F582: STEP; FETCH(0x20, 0xF585); operand = 0xEF19; ABSO; JSR; goto L_EF19;
+L_F585: STEP; FETCH(0x85, 0xF587); operand = 0x00AF; ZP; STA; 
+L_F587: STEP; FETCH(0x20, 0xF58A); operand = 0xE4C1; ABSO; JSR; goto L_E4C1;
+L_F58A: STEP; FETCH(0xA9, 0xF58C); operand = 0x00FD; IMM; LDA(IMMV); 
+L_F58C: STEP; FETCH(0x25, 0xF58E); operand = 0x0090; ZP; AND(MEM); 
+L_F58E: STEP; FETCH(0x85, 0xF590); operand = 0x0090; ZP; STA; 
+L_F590: STEP; FETCH(0x20, 0xF593); operand = 0xFFE1; ABSO; JSR; goto L_FFE1;
+L_F593: STEP; FETCH(0xD0, 0xF595); operand = 0x0003; REL; BNE; if (pc != 0xF595) goto L_F598; 
+L_F595: STEP; FETCH(0x4C, 0xF598); operand = 0xF6CB; ABSO; JMP; goto L_F6CB;
+L_F598: STEP; FETCH(0x20, 0xF59B); operand = 0xEF19; ABSO; JSR; goto L_EF19;
+L_F59B: STEP; FETCH(0xAA, 0xF59C); operand = 0x0000; IMP; TAX; 
+L_F59C: STEP; FETCH(0xA5, 0xF59E); operand = 0x0090; ZP; LDA(MEM); 
+L_F59E: STEP; FETCH(0x4A, 0xF59F); operand = 0x0000; ACC; LSR_A; 
+L_F59F: STEP; FETCH(0x4A, 0xF5A0); operand = 0x0000; ACC; LSR_A; 
+L_F5A0: STEP; FETCH(0xB0, 0xF5A2); operand = 0x00E8; REL; BCS; if (pc != 0xF5A2) goto L_F58A; 
+L_F5A2: STEP; FETCH(0x8A, 0xF5A3); operand = 0x0000; IMP; TXA; 
+L_F5A3: STEP; FETCH(0xA4, 0xF5A5); operand = 0x0093; ZP; LDY(MEM); 
+L_F5A5: STEP; FETCH(0xF0, 0xF5A7); operand = 0x000C; REL; BEQ; if (pc != 0xF5A7) goto L_F5B3; 
+L_F5A7: STEP; FETCH(0xA0, 0xF5A9); operand = 0x0000; IMM; LDY(IMMV); 
+L_F5A9: STEP; FETCH(0xD1, 0xF5AB); operand = 0x00AE; INDY(1); CMP(MEM); 
+L_F5AB: STEP; FETCH(0xF0, 0xF5AD); operand = 0x0008; REL; BEQ; if (pc != 0xF5AD) goto L_F5B5; 
+L_F5AD: STEP; FETCH(0xA9, 0xF5AF); operand = 0x0010; IMM; LDA(IMMV); 
+L_F5AF: STEP; FETCH(0x20, 0xF5B2); operand = 0xFE6A; ABSO; JSR; goto L_FE6A;
+L_F5B2: STEP; FETCH(0x2C, 0xF5B5); operand = 0xAE91; ABSO; BIT(MEM); goto L_F5B5;
+L_F5B3: STEP; FETCH(0x91, 0xF5B5); operand = 0x00AE; INDY(0); STA; 
+L_F5B5: STEP; FETCH(0xE6, 0xF5B7); operand = 0x00AE; ZP; INC; 
+L_F5B7: STEP; FETCH(0xD0, 0xF5B9); operand = 0x0002; REL; BNE; if (pc != 0xF5B9) goto L_F5BB; 
+L_F5B9: STEP; FETCH(0xE6, 0xF5BB); operand = 0x00AF; ZP; INC; 
+L_F5BB: STEP; FETCH(0x24, 0xF5BD); operand = 0x0090; ZP; BIT(MEM); 
+L_F5BD: STEP; FETCH(0x50, 0xF5BF); operand = 0x00CB; REL; BVC; if (pc != 0xF5BF) goto L_F58A; 
+L_F5BF: STEP; FETCH(0x20, 0xF5C2); operand = 0xEEF6; ABSO; JSR; goto L_EEF6;
+L_F5C2: STEP; FETCH(0x20, 0xF5C5); operand = 0xF6DA; ABSO; JSR; goto L_F6DA;
+L_F5C5: STEP; FETCH(0x90, 0xF5C7); operand = 0x007A; REL; BCC; if (pc != 0xF5C7) goto L_F641; 
+L_F5C7: STEP; FETCH(0x4C, 0xF5CA); operand = 0xF787; ABSO; JMP; goto L_F787;
+L_F5CA: STEP; FETCH(0xC9, 0xF5CC); operand = 0x0002; IMM; CMP(IMMV); 
+L_F5CC: STEP; FETCH(0xD0, 0xF5CE); operand = 0x0003; REL; BNE; if (pc != 0xF5CE) goto L_F5D1; 
+L_F5CE: STEP; FETCH(0x4C, 0xF5D1); operand = 0xF0B9; ABSO; JMP; goto L_F0B9;
+L_F5D1: STEP; FETCH(0x20, 0xF5D4); operand = 0xF84D; ABSO; JSR; goto L_F84D;
+L_F5D4: STEP; FETCH(0xB0, 0xF5D6); operand = 0x0003; REL; BCS; if (pc != 0xF5D6) goto L_F5D9; 
+L_F5D6: STEP; FETCH(0x4C, 0xF5D9); operand = 0xF796; ABSO; JMP; goto L_F796;
+L_F5D9: STEP; FETCH(0x20, 0xF5DC); operand = 0xF894; ABSO; JSR; goto L_F894;
+L_F5DC: STEP; FETCH(0xB0, 0xF5DE); operand = 0x0068; REL; BCS; if (pc != 0xF5DE) goto L_F646; 
+L_F5DE: STEP; FETCH(0x20, 0xF5E1); operand = 0xF647; ABSO; JSR; goto L_F647;
+L_F5E1: STEP; FETCH(0xA5, 0xF5E3); operand = 0x00B7; ZP; LDA(MEM); 
+L_F5E3: STEP; FETCH(0xF0, 0xF5E5); operand = 0x0009; REL; BEQ; if (pc != 0xF5E5) goto L_F5EE; 
+L_F5E5: STEP; FETCH(0x20, 0xF5E8); operand = 0xF867; ABSO; JSR; goto L_F867;
+L_F5E8: STEP; FETCH(0x90, 0xF5EA); operand = 0x000B; REL; BCC; if (pc != 0xF5EA) goto L_F5F5; 
+L_F5EA: STEP; FETCH(0xF0, 0xF5EC); operand = 0x005A; REL; BEQ; if (pc != 0xF5EC) goto L_F646; 
+L_F5EC: STEP; FETCH(0xB0, 0xF5EE); operand = 0x00D9; REL; BCS; if (pc != 0xF5EE) goto L_F5C7; 
+L_F5EE: STEP; FETCH(0x20, 0xF5F1); operand = 0xF7AF; ABSO; JSR; goto L_F7AF;
+L_F5F1: STEP; FETCH(0xF0, 0xF5F3); operand = 0x0053; REL; BEQ; if (pc != 0xF5F3) goto L_F646; 
+L_F5F3: STEP; FETCH(0xB0, 0xF5F5); operand = 0x00D2; REL; BCS; if (pc != 0xF5F5) goto L_F5C7; 
+L_F5F5: STEP; FETCH(0xA5, 0xF5F7); operand = 0x0090; ZP; LDA(MEM); 
+L_F5F7: STEP; FETCH(0x29, 0xF5F9); operand = 0x0010; IMM; AND(IMMV); 
+L_F5F9: STEP; FETCH(0x38, 0xF5FA); operand = 0x0000; IMP; SEC; 
+L_F5FA: STEP; FETCH(0xD0, 0xF5FC); operand = 0x004A; REL; BNE; if (pc != 0xF5FC) goto L_F646; 
+L_F5FC: STEP; FETCH(0xE0, 0xF5FE); operand = 0x0001; IMM; CPX(IMMV); 
+L_F5FE: STEP; FETCH(0xF0, 0xF600); operand = 0x0011; REL; BEQ; if (pc != 0xF600) goto L_F611; 
+L_F600: STEP; FETCH(0xE0, 0xF602); operand = 0x0003; IMM; CPX(IMMV); 
+L_F602: STEP; FETCH(0xD0, 0xF604); operand = 0x00DD; REL; BNE; if (pc != 0xF604) goto L_F5E1; 
+L_F604: STEP; FETCH(0xA0, 0xF606); operand = 0x0001; IMM; LDY(IMMV); 
+L_F606: STEP; FETCH(0xB1, 0xF608); operand = 0x00B2; INDY(1); LDA(MEM); 
+L_F608: STEP; FETCH(0x85, 0xF60A); operand = 0x00C3; ZP; STA; 
+L_F60A: STEP; FETCH(0xC8, 0xF60B); operand = 0x0000; IMP; INY; 
+L_F60B: STEP; FETCH(0xB1, 0xF60D); operand = 0x00B2; INDY(1); LDA(MEM); 
+L_F60D: STEP; FETCH(0x85, 0xF60F); operand = 0x00C4; ZP; STA; 
+L_F60F: STEP; FETCH(0xB0, 0xF611); operand = 0x0004; REL; BCS; if (pc != 0xF611) goto L_F615; 
+L_F611: STEP; FETCH(0xA5, 0xF613); operand = 0x00B9; ZP; LDA(MEM); 
+L_F613: STEP; FETCH(0xD0, 0xF615); operand = 0x00EF; REL; BNE; if (pc != 0xF615) goto L_F604; 
+L_F615: STEP; FETCH(0xA0, 0xF617); operand = 0x0003; IMM; LDY(IMMV); 
+L_F617: STEP; FETCH(0xB1, 0xF619); operand = 0x00B2; INDY(1); LDA(MEM); 
+L_F619: STEP; FETCH(0xA0, 0xF61B); operand = 0x0001; IMM; LDY(IMMV); 
+L_F61B: STEP; FETCH(0xF1, 0xF61D); operand = 0x00B2; INDY(1); SBC(MEM); 
+L_F61D: STEP; FETCH(0xAA, 0xF61E); operand = 0x0000; IMP; TAX; 
+L_F61E: STEP; FETCH(0xA0, 0xF620); operand = 0x0004; IMM; LDY(IMMV); 
+L_F620: STEP; FETCH(0xB1, 0xF622); operand = 0x00B2; INDY(1); LDA(MEM); 
+L_F622: STEP; FETCH(0xA0, 0xF624); operand = 0x0002; IMM; LDY(IMMV); 
+L_F624: STEP; FETCH(0xF1, 0xF626); operand = 0x00B2; INDY(1); SBC(MEM); 
+L_F626: STEP; FETCH(0xA8, 0xF627); operand = 0x0000; IMP; TAY; 
+L_F627: STEP; FETCH(0x18, 0xF628); operand = 0x0000; IMP; CLC; 
+L_F628: STEP; FETCH(0x8A, 0xF629); operand = 0x0000; IMP; TXA; 
+L_F629: STEP; FETCH(0x65, 0xF62B); operand = 0x00C3; ZP; ADC(MEM); 
+L_F62B: STEP; FETCH(0x85, 0xF62D); operand = 0x00AE; ZP; STA; 
+L_F62D: STEP; FETCH(0x98, 0xF62E); operand = 0x0000; IMP; TYA; 
+L_F62E: STEP; FETCH(0x65, 0xF630); operand = 0x00C4; ZP; ADC(MEM); 
+L_F630: STEP; FETCH(0x85, 0xF632); operand = 0x00AF; ZP; STA; 
+L_F632: STEP; FETCH(0xA5, 0xF634); operand = 0x00C3; ZP; LDA(MEM); 
+L_F634: STEP; FETCH(0x85, 0xF636); operand = 0x00C1; ZP; STA; 
+L_F636: STEP; FETCH(0xA5, 0xF638); operand = 0x00C4; ZP; LDA(MEM); 
+L_F638: STEP; FETCH(0x85, 0xF63A); operand = 0x00C2; ZP; STA; 
+L_F63A: STEP; FETCH(0x20, 0xF63D); operand = 0xF66A; ABSO; JSR; goto L_F66A;
+L_F63D: STEP; FETCH(0x20, 0xF640); operand = 0xF8C9; ABSO; JSR; goto L_F8C9;
+L_F640: STEP; FETCH(0x24, 0xF642); operand = 0x0018; ZP; BIT(MEM); goto L_F642;
+L_F641: STEP; FETCH(0x18, 0xF642); operand = 0x0000; IMP; CLC; 
+L_F642: STEP; FETCH(0xA6, 0xF644); operand = 0x00AE; ZP; LDX(MEM); 
+L_F644: STEP; FETCH(0xA4, 0xF646); operand = 0x00AF; ZP; LDY(MEM); 
+L_F646: STEP; FETCH(0x60, 0xF647); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F647: STEP; FETCH(0xA5, 0xF649); operand = 0x009D; ZP; LDA(MEM); 
+L_F649: STEP; FETCH(0x10, 0xF64B); operand = 0x001E; REL; BPL; if (pc != 0xF64B) goto L_F669; 
+L_F64B: STEP; FETCH(0xA0, 0xF64D); operand = 0x000C; IMM; LDY(IMMV); 
+L_F64D: STEP; FETCH(0x20, 0xF650); operand = 0xF1E6; ABSO; JSR; goto L_F1E6;
+L_F650: STEP; FETCH(0xA5, 0xF652); operand = 0x00B7; ZP; LDA(MEM); 
+L_F652: STEP; FETCH(0xF0, 0xF654); operand = 0x0015; REL; BEQ; if (pc != 0xF654) goto L_F669; 
+L_F654: STEP; FETCH(0xA0, 0xF656); operand = 0x0017; IMM; LDY(IMMV); 
+L_F656: STEP; FETCH(0x20, 0xF659); operand = 0xF1E6; ABSO; JSR; goto L_F1E6;
+L_F659: STEP; FETCH(0xA4, 0xF65B); operand = 0x00B7; ZP; LDY(MEM); 
+L_F65B: STEP; FETCH(0xF0, 0xF65D); operand = 0x000C; REL; BEQ; if (pc != 0xF65D) goto L_F669; 
+L_F65D: STEP; FETCH(0xA0, 0xF65F); operand = 0x0000; IMM; LDY(IMMV); 
+L_F65F: STEP; FETCH(0xB1, 0xF661); operand = 0x00BB; INDY(1); LDA(MEM); 
+L_F661: STEP; FETCH(0x20, 0xF664); operand = 0xFFD2; ABSO; JSR; goto L_FFD2;
+L_F664: STEP; FETCH(0xC8, 0xF665); operand = 0x0000; IMP; INY; 
+L_F665: STEP; FETCH(0xC4, 0xF667); operand = 0x00B7; ZP; CPY(MEM); 
+L_F667: STEP; FETCH(0xD0, 0xF669); operand = 0x00F6; REL; BNE; if (pc != 0xF669) goto L_F65F; 
+L_F669: STEP; FETCH(0x60, 0xF66A); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F66A: STEP; FETCH(0xA0, 0xF66C); operand = 0x0049; IMM; LDY(IMMV); 
+L_F66C: STEP; FETCH(0xA5, 0xF66E); operand = 0x0093; ZP; LDA(MEM); 
+L_F66E: STEP; FETCH(0xF0, 0xF670); operand = 0x0002; REL; BEQ; if (pc != 0xF670) goto L_F672; 
+L_F670: STEP; FETCH(0xA0, 0xF672); operand = 0x0059; IMM; LDY(IMMV); 
+L_F672: STEP; FETCH(0x4C, 0xF675); operand = 0xF1E2; ABSO; JMP; goto L_F1E2;
+L_F675: STEP; FETCH(0x86, 0xF677); operand = 0x00AE; ZP; STX; 
+L_F677: STEP; FETCH(0x84, 0xF679); operand = 0x00AF; ZP; STY; 
+L_F679: STEP; FETCH(0xAA, 0xF67A); operand = 0x0000; IMP; TAX; 
+L_F67A: STEP; FETCH(0xB5, 0xF67C); operand = 0x0000; ZPX; LDA(MEM); 
+L_F67C: STEP; FETCH(0x85, 0xF67E); operand = 0x00C1; ZP; STA; 
+L_F67E: STEP; FETCH(0xB5, 0xF680); operand = 0x0001; ZPX; LDA(MEM); 
+L_F680: STEP; FETCH(0x85, 0xF682); operand = 0x00C2; ZP; STA; 
+L_F682: STEP; FETCH(0x6C, 0xF685); operand = 0x0332; IND; JMP; goto dispatch;
+L_F685: STEP; FETCH(0xA5, 0xF687); operand = 0x00BA; ZP; LDA(MEM); 
+L_F687: STEP; FETCH(0xD0, 0xF689); operand = 0x0003; REL; BNE; if (pc != 0xF689) goto L_F68C; 
+L_F689: STEP; FETCH(0x4C, 0xF68C); operand = 0xF796; ABSO; JMP; goto L_F796;
+L_F68C: STEP; FETCH(0xC9, 0xF68E); operand = 0x0003; IMM; CMP(IMMV); 
+L_F68E: STEP; FETCH(0xF0, 0xF690); operand = 0x00F9; REL; BEQ; if (pc != 0xF690) goto L_F689; 
+L_F690: STEP; FETCH(0x90, 0xF692); operand = 0x005F; REL; BCC; if (pc != 0xF692) goto L_F6F1; 
+L_F692: STEP; FETCH(0xA9, 0xF694); operand = 0x0061; IMM; LDA(IMMV); 
+L_F694: STEP; FETCH(0x85, 0xF696); operand = 0x00B9; ZP; STA; 
+L_F696: STEP; FETCH(0xA4, 0xF698); operand = 0x00B7; ZP; LDY(MEM); 
+L_F698: STEP; FETCH(0xD0, 0xF69A); operand = 0x0003; REL; BNE; if (pc != 0xF69A) goto L_F69D; 
+L_F69A: STEP; FETCH(0x4C, 0xF69D); operand = 0xF793; ABSO; JMP; goto L_F793;
+L_F69D: STEP; FETCH(0x20, 0xF6A0); operand = 0xF495; ABSO; JSR; goto L_F495;
+L_F6A0: STEP; FETCH(0x20, 0xF6A3); operand = 0xF728; ABSO; JSR; goto L_F728;
+L_F6A3: STEP; FETCH(0xA5, 0xF6A5); operand = 0x00BA; ZP; LDA(MEM); 
+L_F6A5: STEP; FETCH(0x20, 0xF6A8); operand = 0xEE17; ABSO; JSR; goto L_EE17;
+L_F6A8: STEP; FETCH(0xA5, 0xF6AA); operand = 0x00B9; ZP; LDA(MEM); 
+L_F6AA: STEP; FETCH(0x20, 0xF6AD); operand = 0xEEC0; ABSO; JSR; goto L_EEC0;
+L_F6AD: STEP; FETCH(0xA0, 0xF6AF); operand = 0x0000; IMM; LDY(IMMV); 
+L_F6AF: STEP; FETCH(0x20, 0xF6B2); operand = 0xFBD2; ABSO; JSR; goto L_FBD2;
+L_F6B2: STEP; FETCH(0xA5, 0xF6B4); operand = 0x00AC; ZP; LDA(MEM); 
+L_F6B4: STEP; FETCH(0x20, 0xF6B7); operand = 0xEEE4; ABSO; JSR; goto L_EEE4;
+L_F6B7: STEP; FETCH(0xA5, 0xF6B9); operand = 0x00AD; ZP; LDA(MEM); 
+L_F6B9: STEP; FETCH(0x20, 0xF6BC); operand = 0xEEE4; ABSO; JSR; goto L_EEE4;
+L_F6BC: STEP; FETCH(0x20, 0xF6BF); operand = 0xFD11; ABSO; JSR; goto L_FD11;
+L_F6BF: STEP; FETCH(0xB0, 0xF6C1); operand = 0x0016; REL; BCS; if (pc != 0xF6C1) goto L_F6D7; 
+L_F6C1: STEP; FETCH(0xB1, 0xF6C3); operand = 0x00AC; INDY(1); LDA(MEM); 
+L_F6C3: STEP; FETCH(0x20, 0xF6C6); operand = 0xEEE4; ABSO; JSR; goto L_EEE4;
+L_F6C6: STEP; FETCH(0x20, 0xF6C9); operand = 0xFFE1; ABSO; JSR; goto L_FFE1;
+L_F6C9: STEP; FETCH(0xD0, 0xF6CB); operand = 0x0007; REL; BNE; if (pc != 0xF6CB) goto L_F6D2; 
+L_F6CB: STEP; FETCH(0x20, 0xF6CE); operand = 0xF6DA; ABSO; JSR; goto L_F6DA;
+L_F6CE: STEP; FETCH(0xA9, 0xF6D0); operand = 0x0000; IMM; LDA(IMMV); 
+L_F6D0: STEP; FETCH(0x38, 0xF6D1); operand = 0x0000; IMP; SEC; 
+L_F6D1: STEP; FETCH(0x60, 0xF6D2); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F6D2: STEP; FETCH(0x20, 0xF6D5); operand = 0xFD1B; ABSO; JSR; goto L_FD1B;
+L_F6D5: STEP; FETCH(0xD0, 0xF6D7); operand = 0x00E5; REL; BNE; if (pc != 0xF6D7) goto L_F6BC; 
+L_F6D7: STEP; FETCH(0x20, 0xF6DA); operand = 0xEF04; ABSO; JSR; goto L_EF04;
+L_F6DA: STEP; FETCH(0x24, 0xF6DC); operand = 0x00B9; ZP; BIT(MEM); 
+L_F6DC: STEP; FETCH(0x30, 0xF6DE); operand = 0x0011; REL; BMI; if (pc != 0xF6DE) goto L_F6EF; 
+L_F6DE: STEP; FETCH(0xA5, 0xF6E0); operand = 0x00BA; ZP; LDA(MEM); 
+L_F6E0: STEP; FETCH(0x20, 0xF6E3); operand = 0xEE17; ABSO; JSR; goto L_EE17;
+L_F6E3: STEP; FETCH(0xA5, 0xF6E5); operand = 0x00B9; ZP; LDA(MEM); 
+L_F6E5: STEP; FETCH(0x29, 0xF6E7); operand = 0x00EF; IMM; AND(IMMV); 
+L_F6E7: STEP; FETCH(0x09, 0xF6E9); operand = 0x00E0; IMM; ORA(IMMV); 
+L_F6E9: STEP; FETCH(0x20, 0xF6EC); operand = 0xEEC0; ABSO; JSR; goto L_EEC0;
+L_F6EC: STEP; FETCH(0x20, 0xF6EF); operand = 0xEF04; ABSO; JSR; goto L_EF04;
+L_F6EF: STEP; FETCH(0x18, 0xF6F0); operand = 0x0000; IMP; CLC; 
+L_F6F0: STEP; FETCH(0x60, 0xF6F1); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F6F1: STEP; FETCH(0xC9, 0xF6F3); operand = 0x0002; IMM; CMP(IMMV); 
+L_F6F3: STEP; FETCH(0xD0, 0xF6F5); operand = 0x0003; REL; BNE; if (pc != 0xF6F5) goto L_F6F8; 
+L_F6F5: STEP; FETCH(0x4C, 0xF6F8); operand = 0xF0B9; ABSO; JMP; goto L_F0B9;
+L_F6F8: STEP; FETCH(0x20, 0xF6FB); operand = 0xF84D; ABSO; JSR; goto L_F84D;
+L_F6FB: STEP; FETCH(0x90, 0xF6FD); operand = 0x008C; REL; BCC; if (pc != 0xF6FD) goto L_F689; 
+L_F6FD: STEP; FETCH(0x20, 0xF700); operand = 0xF8B7; ABSO; JSR; goto L_F8B7;
+L_F700: STEP; FETCH(0xB0, 0xF702); operand = 0x0025; REL; BCS; if (pc != 0xF702) goto L_F727; 
+L_F702: STEP; FETCH(0x20, 0xF705); operand = 0xF728; ABSO; JSR; goto L_F728;
+L_F705: STEP; FETCH(0xA2, 0xF707); operand = 0x0003; IMM; LDX(IMMV); 
+L_F707: STEP; FETCH(0xA5, 0xF709); operand = 0x00B9; ZP; LDA(MEM); 
+L_F709: STEP; FETCH(0x29, 0xF70B); operand = 0x0001; IMM; AND(IMMV); 
+L_F70B: STEP; FETCH(0xD0, 0xF70D); operand = 0x0002; REL; BNE; if (pc != 0xF70D) goto L_F70F; 
+L_F70D: STEP; FETCH(0xA2, 0xF70F); operand = 0x0001; IMM; LDX(IMMV); 
+L_F70F: STEP; FETCH(0x8A, 0xF710); operand = 0x0000; IMP; TXA; 
+L_F710: STEP; FETCH(0x20, 0xF713); operand = 0xF7E7; ABSO; JSR; goto L_F7E7;
+L_F713: STEP; FETCH(0xB0, 0xF715); operand = 0x0012; REL; BCS; if (pc != 0xF715) goto L_F727; 
+L_F715: STEP; FETCH(0x20, 0xF718); operand = 0xF8E6; ABSO; JSR; goto L_F8E6;
+L_F718: STEP; FETCH(0xB0, 0xF71A); operand = 0x000D; REL; BCS; if (pc != 0xF71A) goto L_F727; 
+L_F71A: STEP; FETCH(0xA5, 0xF71C); operand = 0x00B9; ZP; LDA(MEM); 
+L_F71C: STEP; FETCH(0x29, 0xF71E); operand = 0x0002; IMM; AND(IMMV); 
+L_F71E: STEP; FETCH(0xF0, 0xF720); operand = 0x0006; REL; BEQ; if (pc != 0xF720) goto L_F726; 
+L_F720: STEP; FETCH(0xA9, 0xF722); operand = 0x0005; IMM; LDA(IMMV); 
+L_F722: STEP; FETCH(0x20, 0xF725); operand = 0xF7E7; ABSO; JSR; goto L_F7E7;
+L_F725: STEP; FETCH(0x24, 0xF727); operand = 0x0018; ZP; BIT(MEM); goto L_F727;
+L_F726: STEP; FETCH(0x18, 0xF727); operand = 0x0000; IMP; CLC; 
+L_F727: STEP; FETCH(0x60, 0xF728); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F728: STEP; FETCH(0xA5, 0xF72A); operand = 0x009D; ZP; LDA(MEM); 
+L_F72A: STEP; FETCH(0x10, 0xF72C); operand = 0x00FB; REL; BPL; if (pc != 0xF72C) goto L_F727; 
+L_F72C: STEP; FETCH(0xA0, 0xF72E); operand = 0x0051; IMM; LDY(IMMV); 
+L_F72E: STEP; FETCH(0x20, 0xF731); operand = 0xF1E6; ABSO; JSR; goto L_F1E6;
+L_F731: STEP; FETCH(0x4C, 0xF734); operand = 0xF659; ABSO; JMP; goto L_F659;
+L_F734: STEP; FETCH(0xA2, 0xF736); operand = 0x0000; IMM; LDX(IMMV); 
+L_F736: STEP; FETCH(0xE6, 0xF738); operand = 0x00A2; ZP; INC; 
+L_F738: STEP; FETCH(0xD0, 0xF73A); operand = 0x0006; REL; BNE; if (pc != 0xF73A) goto L_F740; 
+L_F73A: STEP; FETCH(0xE6, 0xF73C); operand = 0x00A1; ZP; INC; 
+L_F73C: STEP; FETCH(0xD0, 0xF73E); operand = 0x0002; REL; BNE; if (pc != 0xF73E) goto L_F740; 
+L_F73E: STEP; FETCH(0xE6, 0xF740); operand = 0x00A0; ZP; INC; 
+L_F740: STEP; FETCH(0x38, 0xF741); operand = 0x0000; IMP; SEC; 
+L_F741: STEP; FETCH(0xA5, 0xF743); operand = 0x00A2; ZP; LDA(MEM); 
+L_F743: STEP; FETCH(0xE9, 0xF745); operand = 0x0001; IMM; SBC(IMMV); 
+L_F745: STEP; FETCH(0xA5, 0xF747); operand = 0x00A1; ZP; LDA(MEM); 
+L_F747: STEP; FETCH(0xE9, 0xF749); operand = 0x001A; IMM; SBC(IMMV); 
+L_F749: STEP; FETCH(0xA5, 0xF74B); operand = 0x00A0; ZP; LDA(MEM); 
+L_F74B: STEP; FETCH(0xE9, 0xF74D); operand = 0x004F; IMM; SBC(IMMV); 
+L_F74D: STEP; FETCH(0x90, 0xF74F); operand = 0x0006; REL; BCC; if (pc != 0xF74F) goto L_F755; 
+L_F74F: STEP; FETCH(0x86, 0xF751); operand = 0x00A0; ZP; STX; 
+L_F751: STEP; FETCH(0x86, 0xF753); operand = 0x00A1; ZP; STX; 
+L_F753: STEP; FETCH(0x86, 0xF755); operand = 0x00A2; ZP; STX; 
+L_F755: STEP; FETCH(0xAD, 0xF758); operand = 0x912F; ABSO; LDA(MEM); 
+L_F758: STEP; FETCH(0xCD, 0xF75B); operand = 0x912F; ABSO; CMP(MEM); 
+L_F75B: STEP; FETCH(0xD0, 0xF75D); operand = 0x00F8; REL; BNE; if (pc != 0xF75D) goto L_F755; 
+L_F75D: STEP; FETCH(0x85, 0xF75F); operand = 0x0091; ZP; STA; 
+L_F75F: STEP; FETCH(0x60, 0xF760); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F760: STEP; FETCH(0x78, 0xF761); operand = 0x0000; IMP; SEI; 
+L_F761: STEP; FETCH(0xA5, 0xF763); operand = 0x00A2; ZP; LDA(MEM); 
+L_F763: STEP; FETCH(0xA6, 0xF765); operand = 0x00A1; ZP; LDX(MEM); 
+L_F765: STEP; FETCH(0xA4, 0xF767); operand = 0x00A0; ZP; LDY(MEM); 
+L_F767: STEP; FETCH(0x78, 0xF768); operand = 0x0000; IMP; SEI; 
+L_F768: STEP; FETCH(0x85, 0xF76A); operand = 0x00A2; ZP; STA; 
+L_F76A: STEP; FETCH(0x86, 0xF76C); operand = 0x00A1; ZP; STX; 
+L_F76C: STEP; FETCH(0x84, 0xF76E); operand = 0x00A0; ZP; STY; 
+L_F76E: STEP; FETCH(0x58, 0xF76F); operand = 0x0000; IMP; CLI; 
+L_F76F: STEP; FETCH(0x60, 0xF770); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F770: STEP; FETCH(0xA5, 0xF772); operand = 0x0091; ZP; LDA(MEM); 
+L_F772: STEP; FETCH(0xC9, 0xF774); operand = 0x00FE; IMM; CMP(IMMV); 
+L_F774: STEP; FETCH(0xD0, 0xF776); operand = 0x0007; REL; BNE; if (pc != 0xF776) goto L_F77D; 
+L_F776: STEP; FETCH(0x08, 0xF777); operand = 0x0000; IMP; PHP; 
+L_F777: STEP; FETCH(0x20, 0xF77A); operand = 0xFFCC; ABSO; JSR; goto L_FFCC;
+L_F77A: STEP; FETCH(0x85, 0xF77C); operand = 0x00C6; ZP; STA; 
+L_F77C: STEP; FETCH(0x28, 0xF77D); operand = 0x0000; IMP; PLP; 
+L_F77D: STEP; FETCH(0x60, 0xF77E); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F77E: STEP; FETCH(0xA9, 0xF780); operand = 0x0001; IMM; LDA(IMMV); 
+L_F780: STEP; FETCH(0x2C, 0xF783); operand = 0x02A9; ABSO; BIT(MEM); goto L_F783;
+L_F781: STEP; FETCH(0xA9, 0xF783); operand = 0x0002; IMM; LDA(IMMV); 
+L_F783: STEP; FETCH(0x2C, 0xF786); operand = 0x03A9; ABSO; BIT(MEM); goto L_F786;
+L_F784: STEP; FETCH(0xA9, 0xF786); operand = 0x0003; IMM; LDA(IMMV); 
+L_F786: STEP; FETCH(0x2C, 0xF789); operand = 0x04A9; ABSO; BIT(MEM); goto L_F789;
+L_F787: STEP; FETCH(0xA9, 0xF789); operand = 0x0004; IMM; LDA(IMMV); 
+L_F789: STEP; FETCH(0x2C, 0xF78C); operand = 0x05A9; ABSO; BIT(MEM); goto L_F78C;
+L_F78A: STEP; FETCH(0xA9, 0xF78C); operand = 0x0005; IMM; LDA(IMMV); 
+L_F78C: STEP; FETCH(0x2C, 0xF78F); operand = 0x06A9; ABSO; BIT(MEM); goto L_F78F;
+L_F78D: STEP; FETCH(0xA9, 0xF78F); operand = 0x0006; IMM; LDA(IMMV); 
+L_F78F: STEP; FETCH(0x2C, 0xF792); operand = 0x07A9; ABSO; BIT(MEM); goto L_F792;
+L_F790: STEP; FETCH(0xA9, 0xF792); operand = 0x0007; IMM; LDA(IMMV); 
+L_F792: STEP; FETCH(0x2C, 0xF795); operand = 0x08A9; ABSO; BIT(MEM); goto L_F795;
+L_F793: STEP; FETCH(0xA9, 0xF795); operand = 0x0008; IMM; LDA(IMMV); 
+L_F795: STEP; FETCH(0x2C, 0xF798); operand = 0x09A9; ABSO; BIT(MEM); goto L_F798;
+L_F796: STEP; FETCH(0xA9, 0xF798); operand = 0x0009; IMM; LDA(IMMV); 
+L_F798: STEP; FETCH(0x48, 0xF799); operand = 0x0000; IMP; PHA; 
+L_F799: STEP; FETCH(0x20, 0xF79C); operand = 0xFFCC; ABSO; JSR; goto L_FFCC;
+L_F79C: STEP; FETCH(0xA0, 0xF79E); operand = 0x0000; IMM; LDY(IMMV); 
+L_F79E: STEP; FETCH(0x24, 0xF7A0); operand = 0x009D; ZP; BIT(MEM); 
+L_F7A0: STEP; FETCH(0x50, 0xF7A2); operand = 0x000A; REL; BVC; if (pc != 0xF7A2) goto L_F7AC; 
+L_F7A2: STEP; FETCH(0x20, 0xF7A5); operand = 0xF1E6; ABSO; JSR; goto L_F1E6;
+L_F7A5: STEP; FETCH(0x68, 0xF7A6); operand = 0x0000; IMP; PLA; 
+L_F7A6: STEP; FETCH(0x48, 0xF7A7); operand = 0x0000; IMP; PHA; 
+L_F7A7: STEP; FETCH(0x09, 0xF7A9); operand = 0x0030; IMM; ORA(IMMV); 
+L_F7A9: STEP; FETCH(0x20, 0xF7AC); operand = 0xFFD2; ABSO; JSR; goto L_FFD2;
+L_F7AC: STEP; FETCH(0x68, 0xF7AD); operand = 0x0000; IMP; PLA; 
+L_F7AD: STEP; FETCH(0x38, 0xF7AE); operand = 0x0000; IMP; SEC; 
+L_F7AE: STEP; FETCH(0x60, 0xF7AF); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F7AF: STEP; FETCH(0xA5, 0xF7B1); operand = 0x0093; ZP; LDA(MEM); 
+L_F7B1: STEP; FETCH(0x48, 0xF7B2); operand = 0x0000; IMP; PHA; 
+L_F7B2: STEP; FETCH(0x20, 0xF7B5); operand = 0xF8C0; ABSO; JSR; goto L_F8C0;
+L_F7B5: STEP; FETCH(0x68, 0xF7B6); operand = 0x0000; IMP; PLA; 
+L_F7B6: STEP; FETCH(0x85, 0xF7B8); operand = 0x0093; ZP; STA; 
+L_F7B8: STEP; FETCH(0xB0, 0xF7BA); operand = 0x002C; REL; BCS; if (pc != 0xF7BA) goto L_F7E6; 
+L_F7BA: STEP; FETCH(0xA0, 0xF7BC); operand = 0x0000; IMM; LDY(IMMV); 
+L_F7BC: STEP; FETCH(0xB1, 0xF7BE); operand = 0x00B2; INDY(1); LDA(MEM); 
+L_F7BE: STEP; FETCH(0xC9, 0xF7C0); operand = 0x0005; IMM; CMP(IMMV); 
+L_F7C0: STEP; FETCH(0xF0, 0xF7C2); operand = 0x0024; REL; BEQ; if (pc != 0xF7C2) goto L_F7E6; 
+L_F7C2: STEP; FETCH(0xC9, 0xF7C4); operand = 0x0001; IMM; CMP(IMMV); 
+L_F7C4: STEP; FETCH(0xF0, 0xF7C6); operand = 0x0008; REL; BEQ; if (pc != 0xF7C6) goto L_F7CE; 
+L_F7C6: STEP; FETCH(0xC9, 0xF7C8); operand = 0x0003; IMM; CMP(IMMV); 
+L_F7C8: STEP; FETCH(0xF0, 0xF7CA); operand = 0x0004; REL; BEQ; if (pc != 0xF7CA) goto L_F7CE; 
+L_F7CA: STEP; FETCH(0xC9, 0xF7CC); operand = 0x0004; IMM; CMP(IMMV); 
+L_F7CC: STEP; FETCH(0xD0, 0xF7CE); operand = 0x00E1; REL; BNE; if (pc != 0xF7CE) goto L_F7AF; 
+L_F7CE: STEP; FETCH(0xAA, 0xF7CF); operand = 0x0000; IMP; TAX; 
+L_F7CF: STEP; FETCH(0x24, 0xF7D1); operand = 0x009D; ZP; BIT(MEM); 
+L_F7D1: STEP; FETCH(0x10, 0xF7D3); operand = 0x0011; REL; BPL; if (pc != 0xF7D3) goto L_F7E4; 
+L_F7D3: STEP; FETCH(0xA0, 0xF7D5); operand = 0x0063; IMM; LDY(IMMV); 
+L_F7D5: STEP; FETCH(0x20, 0xF7D8); operand = 0xF1E6; ABSO; JSR; goto L_F1E6;
+L_F7D8: STEP; FETCH(0xA0, 0xF7DA); operand = 0x0005; IMM; LDY(IMMV); 
+L_F7DA: STEP; FETCH(0xB1, 0xF7DC); operand = 0x00B2; INDY(1); LDA(MEM); 
+L_F7DC: STEP; FETCH(0x20, 0xF7DF); operand = 0xFFD2; ABSO; JSR; goto L_FFD2;
+L_F7DF: STEP; FETCH(0xC8, 0xF7E0); operand = 0x0000; IMP; INY; 
+L_F7E0: STEP; FETCH(0xC0, 0xF7E2); operand = 0x0015; IMM; CPY(IMMV); 
+L_F7E2: STEP; FETCH(0xD0, 0xF7E4); operand = 0x00F6; REL; BNE; if (pc != 0xF7E4) goto L_F7DA; 
+L_F7E4: STEP; FETCH(0x18, 0xF7E5); operand = 0x0000; IMP; CLC; 
+L_F7E5: STEP; FETCH(0x88, 0xF7E6); operand = 0x0000; IMP; DEY; 
+L_F7E6: STEP; FETCH(0x60, 0xF7E7); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F7E7: STEP; FETCH(0x85, 0xF7E9); operand = 0x009E; ZP; STA; 
+L_F7E9: STEP; FETCH(0x20, 0xF7EC); operand = 0xF84D; ABSO; JSR; goto L_F84D;
+L_F7EC: STEP; FETCH(0x90, 0xF7EE); operand = 0x005E; REL; BCC; if (pc != 0xF7EE) goto L_F84C; 
+L_F7EE: STEP; FETCH(0xA5, 0xF7F0); operand = 0x00C2; ZP; LDA(MEM); 
+L_F7F0: STEP; FETCH(0x48, 0xF7F1); operand = 0x0000; IMP; PHA; 
+L_F7F1: STEP; FETCH(0xA5, 0xF7F3); operand = 0x00C1; ZP; LDA(MEM); 
+L_F7F3: STEP; FETCH(0x48, 0xF7F4); operand = 0x0000; IMP; PHA; 
+L_F7F4: STEP; FETCH(0xA5, 0xF7F6); operand = 0x00AF; ZP; LDA(MEM); 
+L_F7F6: STEP; FETCH(0x48, 0xF7F7); operand = 0x0000; IMP; PHA; 
+L_F7F7: STEP; FETCH(0xA5, 0xF7F9); operand = 0x00AE; ZP; LDA(MEM); 
+L_F7F9: STEP; FETCH(0x48, 0xF7FA); operand = 0x0000; IMP; PHA; 
+L_F7FA: STEP; FETCH(0xA0, 0xF7FC); operand = 0x00BF; IMM; LDY(IMMV); 
+L_F7FC: STEP; FETCH(0xA9, 0xF7FE); operand = 0x0020; IMM; LDA(IMMV); 
+L_F7FE: STEP; FETCH(0x91, 0xF800); operand = 0x00B2; INDY(0); STA; 
+L_F800: STEP; FETCH(0x88, 0xF801); operand = 0x0000; IMP; DEY; 
+L_F801: STEP; FETCH(0xD0, 0xF803); operand = 0x00FB; REL; BNE; if (pc != 0xF803) goto L_F7FE; 
+L_F803: STEP; FETCH(0xA5, 0xF805); operand = 0x009E; ZP; LDA(MEM); 
+L_F805: STEP; FETCH(0x91, 0xF807); operand = 0x00B2; INDY(0); STA; 
+L_F807: STEP; FETCH(0xC8, 0xF808); operand = 0x0000; IMP; INY; 
+L_F808: STEP; FETCH(0xA5, 0xF80A); operand = 0x00C1; ZP; LDA(MEM); 
+L_F80A: STEP; FETCH(0x91, 0xF80C); operand = 0x00B2; INDY(0); STA; 
+L_F80C: STEP; FETCH(0xC8, 0xF80D); operand = 0x0000; IMP; INY; 
+L_F80D: STEP; FETCH(0xA5, 0xF80F); operand = 0x00C2; ZP; LDA(MEM); 
+L_F80F: STEP; FETCH(0x91, 0xF811); operand = 0x00B2; INDY(0); STA; 
+L_F811: STEP; FETCH(0xC8, 0xF812); operand = 0x0000; IMP; INY; 
+L_F812: STEP; FETCH(0xA5, 0xF814); operand = 0x00AE; ZP; LDA(MEM); 
+L_F814: STEP; FETCH(0x91, 0xF816); operand = 0x00B2; INDY(0); STA; 
+L_F816: STEP; FETCH(0xC8, 0xF817); operand = 0x0000; IMP; INY; 
+L_F817: STEP; FETCH(0xA5, 0xF819); operand = 0x00AF; ZP; LDA(MEM); 
+L_F819: STEP; FETCH(0x91, 0xF81B); operand = 0x00B2; INDY(0); STA; 
+L_F81B: STEP; FETCH(0xC8, 0xF81C); operand = 0x0000; IMP; INY; 
+L_F81C: STEP; FETCH(0x84, 0xF81E); operand = 0x009F; ZP; STY; 
+L_F81E: STEP; FETCH(0xA0, 0xF820); operand = 0x0000; IMM; LDY(IMMV); 
+L_F820: STEP; FETCH(0x84, 0xF822); operand = 0x009E; ZP; STY; 
+L_F822: STEP; FETCH(0xA4, 0xF824); operand = 0x009E; ZP; LDY(MEM); 
+L_F824: STEP; FETCH(0xC4, 0xF826); operand = 0x00B7; ZP; CPY(MEM); 
+L_F826: STEP; FETCH(0xF0, 0xF828); operand = 0x000C; REL; BEQ; if (pc != 0xF828) goto L_F834; 
+L_F828: STEP; FETCH(0xB1, 0xF82A); operand = 0x00BB; INDY(1); LDA(MEM); 
+L_F82A: STEP; FETCH(0xA4, 0xF82C); operand = 0x009F; ZP; LDY(MEM); 
+L_F82C: STEP; FETCH(0x91, 0xF82E); operand = 0x00B2; INDY(0); STA; 
+L_F82E: STEP; FETCH(0xE6, 0xF830); operand = 0x009E; ZP; INC; 
+L_F830: STEP; FETCH(0xE6, 0xF832); operand = 0x009F; ZP; INC; 
+L_F832: STEP; FETCH(0xD0, 0xF834); operand = 0x00EE; REL; BNE; if (pc != 0xF834) goto L_F822; 
+L_F834: STEP; FETCH(0x20, 0xF837); operand = 0xF854; ABSO; JSR; goto L_F854;
+L_F837: STEP; FETCH(0xA9, 0xF839); operand = 0x0069; IMM; LDA(IMMV); 
+L_F839: STEP; FETCH(0x85, 0xF83B); operand = 0x00AB; ZP; STA; 
+L_F83B: STEP; FETCH(0x20, 0xF83E); operand = 0xF8EA; ABSO; JSR; goto L_F8EA;
+L_F83E: STEP; FETCH(0xA8, 0xF83F); operand = 0x0000; IMP; TAY; 
+L_F83F: STEP; FETCH(0x68, 0xF840); operand = 0x0000; IMP; PLA; 
+L_F840: STEP; FETCH(0x85, 0xF842); operand = 0x00AE; ZP; STA; 
+L_F842: STEP; FETCH(0x68, 0xF843); operand = 0x0000; IMP; PLA; 
+L_F843: STEP; FETCH(0x85, 0xF845); operand = 0x00AF; ZP; STA; 
+L_F845: STEP; FETCH(0x68, 0xF846); operand = 0x0000; IMP; PLA; 
+L_F846: STEP; FETCH(0x85, 0xF848); operand = 0x00C1; ZP; STA; 
+L_F848: STEP; FETCH(0x68, 0xF849); operand = 0x0000; IMP; PLA; 
+L_F849: STEP; FETCH(0x85, 0xF84B); operand = 0x00C2; ZP; STA; 
+L_F84B: STEP; FETCH(0x98, 0xF84C); operand = 0x0000; IMP; TYA; 
+L_F84C: STEP; FETCH(0x60, 0xF84D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F84D: STEP; FETCH(0xA6, 0xF84F); operand = 0x00B2; ZP; LDX(MEM); 
+L_F84F: STEP; FETCH(0xA4, 0xF851); operand = 0x00B3; ZP; LDY(MEM); 
+L_F851: STEP; FETCH(0xC0, 0xF853); operand = 0x0002; IMM; CPY(IMMV); 
+L_F853: STEP; FETCH(0x60, 0xF854); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F854: STEP; FETCH(0x20, 0xF857); operand = 0xF84D; ABSO; JSR; goto L_F84D;
+L_F857: STEP; FETCH(0x8A, 0xF858); operand = 0x0000; IMP; TXA; 
+L_F858: STEP; FETCH(0x85, 0xF85A); operand = 0x00C1; ZP; STA; 
+L_F85A: STEP; FETCH(0x18, 0xF85B); operand = 0x0000; IMP; CLC; 
+L_F85B: STEP; FETCH(0x69, 0xF85D); operand = 0x00C0; IMM; ADC(IMMV); 
+L_F85D: STEP; FETCH(0x85, 0xF85F); operand = 0x00AE; ZP; STA; 
+L_F85F: STEP; FETCH(0x98, 0xF860); operand = 0x0000; IMP; TYA; 
+L_F860: STEP; FETCH(0x85, 0xF862); operand = 0x00C2; ZP; STA; 
+L_F862: STEP; FETCH(0x69, 0xF864); operand = 0x0000; IMM; ADC(IMMV); 
+L_F864: STEP; FETCH(0x85, 0xF866); operand = 0x00AF; ZP; STA; 
+L_F866: STEP; FETCH(0x60, 0xF867); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F867: STEP; FETCH(0x20, 0xF86A); operand = 0xF7AF; ABSO; JSR; goto L_F7AF;
+L_F86A: STEP; FETCH(0xB0, 0xF86C); operand = 0x001D; REL; BCS; if (pc != 0xF86C) goto L_F889; 
+L_F86C: STEP; FETCH(0xA0, 0xF86E); operand = 0x0005; IMM; LDY(IMMV); 
+L_F86E: STEP; FETCH(0x84, 0xF870); operand = 0x009F; ZP; STY; 
+L_F870: STEP; FETCH(0xA0, 0xF872); operand = 0x0000; IMM; LDY(IMMV); 
+L_F872: STEP; FETCH(0x84, 0xF874); operand = 0x009E; ZP; STY; 
+L_F874: STEP; FETCH(0xC4, 0xF876); operand = 0x00B7; ZP; CPY(MEM); 
+L_F876: STEP; FETCH(0xF0, 0xF878); operand = 0x0010; REL; BEQ; if (pc != 0xF878) goto L_F888; 
+L_F878: STEP; FETCH(0xB1, 0xF87A); operand = 0x00BB; INDY(1); LDA(MEM); 
+L_F87A: STEP; FETCH(0xA4, 0xF87C); operand = 0x009F; ZP; LDY(MEM); 
+L_F87C: STEP; FETCH(0xD1, 0xF87E); operand = 0x00B2; INDY(1); CMP(MEM); 
+L_F87E: STEP; FETCH(0xD0, 0xF880); operand = 0x00E7; REL; BNE; if (pc != 0xF880) goto L_F867; 
+L_F880: STEP; FETCH(0xE6, 0xF882); operand = 0x009E; ZP; INC; 
+L_F882: STEP; FETCH(0xE6, 0xF884); operand = 0x009F; ZP; INC; 
+L_F884: STEP; FETCH(0xA4, 0xF886); operand = 0x009E; ZP; LDY(MEM); 
+L_F886: STEP; FETCH(0xD0, 0xF888); operand = 0x00EC; REL; BNE; if (pc != 0xF888) goto L_F874; 
+L_F888: STEP; FETCH(0x18, 0xF889); operand = 0x0000; IMP; CLC; 
+L_F889: STEP; FETCH(0x60, 0xF88A); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F88A: STEP; FETCH(0x20, 0xF88D); operand = 0xF84D; ABSO; JSR; goto L_F84D;
+L_F88D: STEP; FETCH(0xE6, 0xF88F); operand = 0x00A6; ZP; INC; 
+L_F88F: STEP; FETCH(0xA4, 0xF891); operand = 0x00A6; ZP; LDY(MEM); 
+L_F891: STEP; FETCH(0xC0, 0xF893); operand = 0x00C0; IMM; CPY(IMMV); 
+L_F893: STEP; FETCH(0x60, 0xF894); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F894: STEP; FETCH(0x20, 0xF897); operand = 0xF8AB; ABSO; JSR; goto L_F8AB;
+L_F897: STEP; FETCH(0xF0, 0xF899); operand = 0x001C; REL; BEQ; if (pc != 0xF899) goto L_F8B5; 
+L_F899: STEP; FETCH(0xA0, 0xF89B); operand = 0x001B; IMM; LDY(IMMV); 
+L_F89B: STEP; FETCH(0x20, 0xF89E); operand = 0xF1E6; ABSO; JSR; goto L_F1E6;
+L_F89E: STEP; FETCH(0x20, 0xF8A1); operand = 0xF94B; ABSO; JSR; goto L_F94B;
+L_F8A1: STEP; FETCH(0x20, 0xF8A4); operand = 0xF8AB; ABSO; JSR; goto L_F8AB;
+L_F8A4: STEP; FETCH(0xD0, 0xF8A6); operand = 0x00F8; REL; BNE; if (pc != 0xF8A6) goto L_F89E; 
+L_F8A6: STEP; FETCH(0xA0, 0xF8A8); operand = 0x006A; IMM; LDY(IMMV); 
+L_F8A8: STEP; FETCH(0x4C, 0xF8AB); operand = 0xF1E6; ABSO; JMP; goto L_F1E6;
+L_F8AB: STEP; FETCH(0xA9, 0xF8AD); operand = 0x0040; IMM; LDA(IMMV); 
+L_F8AD: STEP; FETCH(0x2C, 0xF8B0); operand = 0x911F; ABSO; BIT(MEM); 
+L_F8B0: STEP; FETCH(0xD0, 0xF8B2); operand = 0x0003; REL; BNE; if (pc != 0xF8B2) goto L_F8B5; 
+L_F8B2: STEP; FETCH(0x2C, 0xF8B5); operand = 0x911F; ABSO; BIT(MEM); 
+L_F8B5: STEP; FETCH(0x18, 0xF8B6); operand = 0x0000; IMP; CLC; 
+L_F8B6: STEP; FETCH(0x60, 0xF8B7); operand = 0x0000; IMP; RTS; goto dispatch;
+L_F8B7: STEP; FETCH(0x20, 0xF8BA); operand = 0xF8AB; ABSO; JSR; goto L_F8AB;
+L_F8BA: STEP; FETCH(0xF0, 0xF8BC); operand = 0x00F9; REL; BEQ; if (pc != 0xF8BC) goto L_F8B5; 
+L_F8BC: STEP; FETCH(0xA0, 0xF8BE); operand = 0x002E; IMM; LDY(IMMV); 
+L_F8BE: STEP; FETCH(0xD0, 0xF8C0); operand = 0x00DB; REL; BNE; if (pc != 0xF8C0) goto L_F89B; 
+L_F8C0: STEP; FETCH(0xA9, 0xF8C2); operand = 0x0000; IMM; LDA(IMMV); 
+L_F8C2: STEP; FETCH(0x85, 0xF8C4); operand = 0x0090; ZP; STA; 
+L_F8C4: STEP; FETCH(0x85, 0xF8C6); operand = 0x0093; ZP; STA; 
+L_F8C6: STEP; FETCH(0x20, 0xF8C9); operand = 0xF854; ABSO; JSR; goto L_F854;
+L_F8C9: STEP; FETCH(0x20, 0xF8CC); operand = 0xF894; ABSO; JSR; goto L_F894;
+L_F8CC: STEP; FETCH(0xB0, 0xF8CE); operand = 0x001F; REL; BCS; if (pc != 0xF8CE) goto L_F8ED; 
+L_F8CE: STEP; FETCH(0x78, 0xF8CF); operand = 0x0000; IMP; SEI; 
+L_F8CF: STEP; FETCH(0xA9, 0xF8D1); operand = 0x0000; IMM; LDA(IMMV); 
+L_F8D1: STEP; FETCH(0x85, 0xF8D3); operand = 0x00AA; ZP; STA; 
+L_F8D3: STEP; FETCH(0x85, 0xF8D5); operand = 0x00B4; ZP; STA; 
+L_F8D5: STEP; FETCH(0x85, 0xF8D7); operand = 0x00B0; ZP; STA; 
+L_F8D7: STEP; FETCH(0x85, 0xF8D9); operand = 0x009E; ZP; STA; 
+L_F8D9: STEP; FETCH(0x85, 0xF8DB); operand = 0x009F; ZP; STA; 
+L_F8DB: STEP; FETCH(0x85, 0xF8DD); operand = 0x009C; ZP; STA; 
+L_F8DD: STEP; FETCH(0xA9, 0xF8DF); operand = 0x0082; IMM; LDA(IMMV); 
+L_F8DF: STEP; FETCH(0xA2, 0xF8E1); operand = 0x000E; IMM; LDX(IMMV); 
+L_F8E1: STEP; FETCH(0xD0, 0xF8E3); operand = 0x0011; REL; BNE; if (pc != 0xF8E3) goto L_F8F4; 
+L_F8E3: STEP; FETCH(0x20, 0xF8E6); operand = 0xF854; ABSO; JSR; goto L_F854;
+L_F8E6: STEP; FETCH(0xA9, 0xF8E8); operand = 0x0014; IMM; LDA(IMMV); 
+L_F8E8: STEP; FETCH(0x85, 0xF8EA); operand = 0x00AB; ZP; STA; 
+L_F8EA: STEP; FETCH(0x20, 0xF8ED); operand = 0xF8B7; ABSO; JSR; goto L_F8B7;
+L_F8ED: STEP; FETCH(0xB0, 0xF8EF); operand = 0x0068; REL; BCS; if (pc != 0xF8EF) goto L_F957; 
+L_F8EF: STEP; FETCH(0x78, 0xF8F0); operand = 0x0000; IMP; SEI; 
+L_F8F0: STEP; FETCH(0xA9, 0xF8F2); operand = 0x00A0; IMM; LDA(IMMV); 
+L_F8F2: STEP; FETCH(0xA2, 0xF8F4); operand = 0x0008; IMM; LDX(IMMV); 
+L_F8F4: STEP; FETCH(0xA0, 0xF8F6); operand = 0x007F; IMM; LDY(IMMV); 
+L_F8F6: STEP; FETCH(0x8C, 0xF8F9); operand = 0x912E; ABSO; STY; 
+L_F8F9: STEP; FETCH(0x8D, 0xF8FC); operand = 0x912E; ABSO; STA; 
+L_F8FC: STEP; FETCH(0x20, 0xF8FF); operand = 0xF160; ABSO; JSR; goto L_F160;
+L_F8FF: STEP; FETCH(0xAD, 0xF902); operand = 0x0314; ABSO; LDA(MEM); 
+L_F902: STEP; FETCH(0x8D, 0xF905); operand = 0x029F; ABSO; STA; 
+L_F905: STEP; FETCH(0xAD, 0xF908); operand = 0x0315; ABSO; LDA(MEM); 
+L_F908: STEP; FETCH(0x8D, 0xF90B); operand = 0x02A0; ABSO; STA; 
+L_F90B: STEP; FETCH(0x20, 0xF90E); operand = 0xFCFB; ABSO; JSR; goto L_FCFB;
+L_F90E: STEP; FETCH(0xA9, 0xF910); operand = 0x0002; IMM; LDA(IMMV); 
+L_F910: STEP; FETCH(0x85, 0xF912); operand = 0x00BE; ZP; STA; 
+L_F912: STEP; FETCH(0x20, 0xF915); operand = 0xFBDB; ABSO; JSR; goto L_FBDB;
+L_F915: STEP; FETCH(0xAD, 0xF918); operand = 0x911C; ABSO; LDA(MEM); 
+L_F918: STEP; FETCH(0x29, 0xF91A); operand = 0x00FD; IMM; AND(IMMV); 
+L_F91A: STEP; FETCH(0x09, 0xF91C); operand = 0x000C; IMM; ORA(IMMV); 
+L_F91C: STEP; FETCH(0x8D, 0xF91F); operand = 0x911C; ABSO; STA; 
+L_F91F: STEP; FETCH(0x85, 0xF921); operand = 0x00C0; ZP; STA; 
+L_F921: STEP; FETCH(0xA2, 0xF923); operand = 0x00FF; IMM; LDX(IMMV); 
+L_F923: STEP; FETCH(0xA0, 0xF925); operand = 0x00FF; IMM; LDY(IMMV); 
+L_F925: STEP; FETCH(0x88, 0xF926); operand = 0x0000; IMP; DEY; 
+L_F926: STEP; FETCH(0xD0, 0xF928); operand = 0x00FD; REL; BNE; if (pc != 0xF928) goto L_F925; 
+L_F928: STEP; FETCH(0xCA, 0xF929); operand = 0x0000; IMP; DEX; 
+L_F929: STEP; FETCH(0xD0, 0xF92B); operand = 0x00F8; REL; BNE; if (pc != 0xF92B) goto L_F923; 
+L_F92B: STEP; FETCH(0x8D, 0xF92E); operand = 0x9129; ABSO; STA; 
+L_F92E: STEP; FETCH(0x58, 0xF92F); operand = 0x0000; IMP; CLI; 
+L_F92F: STEP; FETCH(0xAD, 0xF932); operand = 0x02A0; ABSO; LDA(MEM); 
+L_F932: STEP; FETCH(0xCD, 0xF935); operand = 0x0315; ABSO; CMP(MEM); 
+L_F935: STEP; FETCH(0x18, 0xF936); operand = 0x0000; IMP; CLC; 
+L_F936: STEP; FETCH(0xF0, 0xF938); operand = 0x001F; REL; BEQ; if (pc != 0xF938) goto L_F957; 
+L_F938: STEP; FETCH(0x20, 0xF93B); operand = 0xF94B; ABSO; JSR; goto L_F94B;
+L_F93B: STEP; FETCH(0xAD, 0xF93E); operand = 0x912D; ABSO; LDA(MEM); 
+L_F93E: STEP; FETCH(0x29, 0xF940); operand = 0x0040; IMM; AND(IMMV); 
+L_F940: STEP; FETCH(0xF0, 0xF942); operand = 0x00ED; REL; BEQ; if (pc != 0xF942) goto L_F92F; 
+L_F942: STEP; FETCH(0xAD, 0xF945); operand = 0x9114; ABSO; LDA(MEM); 
+L_F945: STEP; FETCH(0x20, 0xF948); operand = 0xF734; ABSO; JSR; goto L_F734;
+L_F948: STEP; FETCH(0x4C, 0xF94B); operand = 0xF92F; ABSO; JMP; goto L_F92F;
+L_F94B: STEP; FETCH(0x20, 0xF94E); operand = 0xFFE1; ABSO; JSR; goto L_FFE1;
+L_F94E: STEP; FETCH(0x18, 0xF94F); operand = 0x0000; IMP; CLC; 
+L_F94F: STEP; FETCH(0xD0, 0xF951); operand = 0x000B; REL; BNE; if (pc != 0xF951) goto L_F95C; 
+L_F951: STEP; FETCH(0x20, 0xF954); operand = 0xFCCF; ABSO; JSR; goto L_FCCF;
+L_F954: STEP; FETCH(0x38, 0xF955); operand = 0x0000; IMP; SEC; 
+L_F955: STEP; FETCH(0x68, 0xF956); operand = 0x0000; IMP; PLA; 
+L_F956: STEP; FETCH(0x68, 0xF957); operand = 0x0000; IMP; PLA; 
+L_F957: STEP; FETCH(0xA9, 0xF959); operand = 0x0000; IMM; LDA(IMMV); 
+L_F959: STEP; FETCH(0x8D, 0xF95C); operand = 0x02A0; ABSO; STA; 
+L_F95C: STEP; FETCH(0x60, 0xF95D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FBD2: STEP; FETCH(0xA5, 0xFBD4); operand = 0x00C2; ZP; LDA(MEM); 
+L_FBD4: STEP; FETCH(0x85, 0xFBD6); operand = 0x00AD; ZP; STA; 
+L_FBD6: STEP; FETCH(0xA5, 0xFBD8); operand = 0x00C1; ZP; LDA(MEM); 
+L_FBD8: STEP; FETCH(0x85, 0xFBDA); operand = 0x00AC; ZP; STA; 
+L_FBDA: STEP; FETCH(0x60, 0xFBDB); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FBDB: STEP; FETCH(0xA9, 0xFBDD); operand = 0x0008; IMM; LDA(IMMV); 
+L_FBDD: STEP; FETCH(0x85, 0xFBDF); operand = 0x00A3; ZP; STA; 
+L_FBDF: STEP; FETCH(0xA9, 0xFBE1); operand = 0x0000; IMM; LDA(IMMV); 
+L_FBE1: STEP; FETCH(0x85, 0xFBE3); operand = 0x00A4; ZP; STA; 
+L_FBE3: STEP; FETCH(0x85, 0xFBE5); operand = 0x00A8; ZP; STA; 
+L_FBE5: STEP; FETCH(0x85, 0xFBE7); operand = 0x009B; ZP; STA; 
+L_FBE7: STEP; FETCH(0x85, 0xFBE9); operand = 0x00A9; ZP; STA; 
+L_FBE9: STEP; FETCH(0x60, 0xFBEA); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FCCF: STEP; FETCH(0x08, 0xFCD0); operand = 0x0000; IMP; PHP; 
+L_FCD0: STEP; FETCH(0x78, 0xFCD1); operand = 0x0000; IMP; SEI; 
+L_FCD1: STEP; FETCH(0x20, 0xFCD4); operand = 0xFD08; ABSO; JSR; goto L_FD08;
+L_FCD4: STEP; FETCH(0xA9, 0xFCD6); operand = 0x007F; IMM; LDA(IMMV); 
+L_FCD6: STEP; FETCH(0x8D, 0xFCD9); operand = 0x912E; ABSO; STA; 
+L_FCD9: STEP; FETCH(0xA9, 0xFCDB); operand = 0x00F7; IMM; LDA(IMMV); 
+L_FCDB: STEP; FETCH(0x8D, 0xFCDE); operand = 0x9120; ABSO; STA; 
+L_FCDE: STEP; FETCH(0xA9, 0xFCE0); operand = 0x0040; IMM; LDA(IMMV); 
+L_FCE0: STEP; FETCH(0x8D, 0xFCE3); operand = 0x912B; ABSO; STA; 
+L_FCE3: STEP; FETCH(0x20, 0xFCE6); operand = 0xFE39; ABSO; JSR; goto L_FE39;
+L_FCE6: STEP; FETCH(0xAD, 0xFCE9); operand = 0x02A0; ABSO; LDA(MEM); 
+L_FCE9: STEP; FETCH(0xF0, 0xFCEB); operand = 0x0009; REL; BEQ; if (pc != 0xFCEB) goto L_FCF4; 
+L_FCEB: STEP; FETCH(0x8D, 0xFCEE); operand = 0x0315; ABSO; STA; 
+L_FCEE: STEP; FETCH(0xAD, 0xFCF1); operand = 0x029F; ABSO; LDA(MEM); 
+L_FCF1: STEP; FETCH(0x8D, 0xFCF4); operand = 0x0314; ABSO; STA; 
+L_FCF4: STEP; FETCH(0x28, 0xFCF5); operand = 0x0000; IMP; PLP; 
+L_FCF5: STEP; FETCH(0x60, 0xFCF6); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FCFB: STEP; FETCH(0xBD, 0xFCFE); operand = 0xFDE9; ABSX(1); LDA(MEM); 
+L_FCFE: STEP; FETCH(0x8D, 0xFD01); operand = 0x0314; ABSO; STA; 
+L_FD01: STEP; FETCH(0xBD, 0xFD04); operand = 0xFDEA; ABSX(1); LDA(MEM); 
+L_FD04: STEP; FETCH(0x8D, 0xFD07); operand = 0x0315; ABSO; STA; 
+L_FD07: STEP; FETCH(0x60, 0xFD08); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FD08: STEP; FETCH(0xAD, 0xFD0B); operand = 0x911C; ABSO; LDA(MEM); 
+L_FD0B: STEP; FETCH(0x09, 0xFD0D); operand = 0x000E; IMM; ORA(IMMV); 
+L_FD0D: STEP; FETCH(0x8D, 0xFD10); operand = 0x911C; ABSO; STA; 
+L_FD10: STEP; FETCH(0x60, 0xFD11); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FD11: STEP; FETCH(0x38, 0xFD12); operand = 0x0000; IMP; SEC; 
+L_FD12: STEP; FETCH(0xA5, 0xFD14); operand = 0x00AC; ZP; LDA(MEM); 
+L_FD14: STEP; FETCH(0xE5, 0xFD16); operand = 0x00AE; ZP; SBC(MEM); 
+L_FD16: STEP; FETCH(0xA5, 0xFD18); operand = 0x00AD; ZP; LDA(MEM); 
+L_FD18: STEP; FETCH(0xE5, 0xFD1A); operand = 0x00AF; ZP; SBC(MEM); 
+L_FD1A: STEP; FETCH(0x60, 0xFD1B); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FD1B: STEP; FETCH(0xE6, 0xFD1D); operand = 0x00AC; ZP; INC; 
+L_FD1D: STEP; FETCH(0xD0, 0xFD1F); operand = 0x0002; REL; BNE; if (pc != 0xFD1F) goto L_FD21; 
+L_FD1F: STEP; FETCH(0xE6, 0xFD21); operand = 0x00AD; ZP; INC; 
+L_FD21: STEP; FETCH(0x60, 0xFD22); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FD22: STEP; FETCH(0xA2, 0xFD24); operand = 0x00FF; IMM; LDX(IMMV); 
+L_FD24: STEP; FETCH(0x78, 0xFD25); operand = 0x0000; IMP; SEI; 
+L_FD25: STEP; FETCH(0x9A, 0xFD26); operand = 0x0000; IMP; TXS; 
+L_FD26: STEP; FETCH(0xD8, 0xFD27); operand = 0x0000; IMP; CLD; 
+L_FD27: STEP; FETCH(0x20, 0xFD2A); operand = 0xFD3F; ABSO; JSR; goto L_FD3F;
+L_FD2A: STEP; FETCH(0xD0, 0xFD2C); operand = 0x0003; REL; BNE; if (pc != 0xFD2C) goto L_FD2F; 
+L_FD2C: STEP; FETCH(0x6C, 0xFD2F); operand = 0xA000; IND; JMP; goto dispatch;
+L_FD2F: STEP; FETCH(0x20, 0xFD32); operand = 0xFD8D; ABSO; JSR; goto L_FD8D;
+L_FD32: STEP; FETCH(0x20, 0xFD35); operand = 0xFD52; ABSO; JSR; goto L_FD52;
+L_FD35: STEP; FETCH(0x20, 0xFD38); operand = 0xFDF9; ABSO; JSR; goto L_FDF9;
+L_FD38: STEP; FETCH(0x20, 0xFD3B); operand = 0xE518; ABSO; JSR; goto L_E518;
+L_FD3B: STEP; FETCH(0x58, 0xFD3C); operand = 0x0000; IMP; CLI; 
+L_FD3C: STEP; FETCH(0x6C, 0xFD3F); operand = 0xC000; IND; JMP; goto dispatch;
+L_FD3F: STEP; FETCH(0xA2, 0xFD41); operand = 0x0005; IMM; LDX(IMMV); 
+L_FD41: STEP; FETCH(0xBD, 0xFD44); operand = 0xFD4C; ABSX(1); LDA(MEM); 
+L_FD44: STEP; FETCH(0xDD, 0xFD47); operand = 0xA003; ABSX(1); CMP(MEM); 
+L_FD47: STEP; FETCH(0xD0, 0xFD49); operand = 0x0003; REL; BNE; if (pc != 0xFD49) goto L_FD4C; 
+L_FD49: STEP; FETCH(0xCA, 0xFD4A); operand = 0x0000; IMP; DEX; 
+L_FD4A: STEP; FETCH(0xD0, 0xFD4C); operand = 0x00F5; REL; BNE; if (pc != 0xFD4C) goto L_FD41; 
+L_FD4C: STEP; FETCH(0x60, 0xFD4D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FD52: STEP; FETCH(0xA2, 0xFD54); operand = 0x006D; IMM; LDX(IMMV); 
+L_FD54: STEP; FETCH(0xA0, 0xFD56); operand = 0x00FD; IMM; LDY(IMMV); 
+L_FD56: STEP; FETCH(0x18, 0xFD57); operand = 0x0000; IMP; CLC; 
+L_FD57: STEP; FETCH(0x86, 0xFD59); operand = 0x00C3; ZP; STX; 
+L_FD59: STEP; FETCH(0x84, 0xFD5B); operand = 0x00C4; ZP; STY; 
+L_FD5B: STEP; FETCH(0xA0, 0xFD5D); operand = 0x001F; IMM; LDY(IMMV); 
+L_FD5D: STEP; FETCH(0xB9, 0xFD60); operand = 0x0314; ABSY(1); LDA(MEM); 
+L_FD60: STEP; FETCH(0xB0, 0xFD62); operand = 0x0002; REL; BCS; if (pc != 0xFD62) goto L_FD64; 
+L_FD62: STEP; FETCH(0xB1, 0xFD64); operand = 0x00C3; INDY(1); LDA(MEM); 
+L_FD64: STEP; FETCH(0x91, 0xFD66); operand = 0x00C3; INDY(0); STA; 
+L_FD66: STEP; FETCH(0x99, 0xFD69); operand = 0x0314; ABSY(0); STA; 
+L_FD69: STEP; FETCH(0x88, 0xFD6A); operand = 0x0000; IMP; DEY; 
+L_FD6A: STEP; FETCH(0x10, 0xFD6C); operand = 0x00F1; REL; BPL; if (pc != 0xFD6C) goto L_FD5D; 
+L_FD6C: STEP; FETCH(0x60, 0xFD6D); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FD8D: STEP; FETCH(0xA9, 0xFD8F); operand = 0x0000; IMM; LDA(IMMV); 
+L_FD8F: STEP; FETCH(0xAA, 0xFD90); operand = 0x0000; IMP; TAX; 
+L_FD90: STEP; FETCH(0x95, 0xFD92); operand = 0x0000; ZPX; STA; 
+L_FD92: STEP; FETCH(0x9D, 0xFD95); operand = 0x0200; ABSX(0); STA; 
+L_FD95: STEP; FETCH(0x9D, 0xFD98); operand = 0x0300; ABSX(0); STA; 
+L_FD98: STEP; FETCH(0xE8, 0xFD99); operand = 0x0000; IMP; INX; 
+L_FD99: STEP; FETCH(0xD0, 0xFD9B); operand = 0x00F5; REL; BNE; if (pc != 0xFD9B) goto L_FD90; 
+L_FD9B: STEP; FETCH(0xA2, 0xFD9D); operand = 0x003C; IMM; LDX(IMMV); 
+L_FD9D: STEP; FETCH(0xA0, 0xFD9F); operand = 0x0003; IMM; LDY(IMMV); 
+L_FD9F: STEP; FETCH(0x86, 0xFDA1); operand = 0x00B2; ZP; STX; 
+L_FDA1: STEP; FETCH(0x84, 0xFDA3); operand = 0x00B3; ZP; STY; 
+L_FDA3: STEP; FETCH(0x85, 0xFDA5); operand = 0x00C1; ZP; STA; 
+L_FDA5: STEP; FETCH(0x85, 0xFDA7); operand = 0x0097; ZP; STA; 
+L_FDA7: STEP; FETCH(0x8D, 0xFDAA); operand = 0x0281; ABSO; STA; 
+L_FDAA: STEP; FETCH(0xA8, 0xFDAB); operand = 0x0000; IMP; TAY; 
+L_FDAB: STEP; FETCH(0xA9, 0xFDAD); operand = 0x0004; IMM; LDA(IMMV); 
+L_FDAD: STEP; FETCH(0x85, 0xFDAF); operand = 0x00C2; ZP; STA; 
+L_FDAF: STEP; FETCH(0xE6, 0xFDB1); operand = 0x00C1; ZP; INC; 
+L_FDB1: STEP; FETCH(0xD0, 0xFDB3); operand = 0x0002; REL; BNE; if (pc != 0xFDB3) goto L_FDB5; 
+L_FDB3: STEP; FETCH(0xE6, 0xFDB5); operand = 0x00C2; ZP; INC; 
+L_FDB5: STEP; FETCH(0x20, 0xFDB8); operand = 0xFE91; ABSO; JSR; goto L_FE91;
+L_FDB8: STEP; FETCH(0xA5, 0xFDBA); operand = 0x0097; ZP; LDA(MEM); 
+L_FDBA: STEP; FETCH(0xF0, 0xFDBC); operand = 0x0022; REL; BEQ; if (pc != 0xFDBC) goto L_FDDE; 
+L_FDBC: STEP; FETCH(0xB0, 0xFDBE); operand = 0x00F1; REL; BCS; if (pc != 0xFDBE) goto L_FDAF; 
+L_FDBE: STEP; FETCH(0xA4, 0xFDC0); operand = 0x00C2; ZP; LDY(MEM); 
+L_FDC0: STEP; FETCH(0xA6, 0xFDC2); operand = 0x00C1; ZP; LDX(MEM); 
+L_FDC2: STEP; FETCH(0xC0, 0xFDC4); operand = 0x0020; IMM; CPY(IMMV); 
+L_FDC4: STEP; FETCH(0x90, 0xFDC6); operand = 0x0025; REL; BCC; if (pc != 0xFDC6) goto L_FDEB; 
+L_FDC6: STEP; FETCH(0xC0, 0xFDC8); operand = 0x0021; IMM; CPY(IMMV); 
+L_FDC8: STEP; FETCH(0xB0, 0xFDCA); operand = 0x0008; REL; BCS; if (pc != 0xFDCA) goto L_FDD2; 
+L_FDCA: STEP; FETCH(0xA0, 0xFDCC); operand = 0x001E; IMM; LDY(IMMV); 
+L_FDCC: STEP; FETCH(0x8C, 0xFDCF); operand = 0x0288; ABSO; STY; 
+L_FDCF: STEP; FETCH(0x4C, 0xFDD2); operand = 0xFE7B; ABSO; JMP; goto L_FE7B;
+L_FDD2: STEP; FETCH(0xA9, 0xFDD4); operand = 0x0012; IMM; LDA(IMMV); 
+L_FDD4: STEP; FETCH(0x8D, 0xFDD7); operand = 0x0282; ABSO; STA; 
+L_FDD7: STEP; FETCH(0xA9, 0xFDD9); operand = 0x0010; IMM; LDA(IMMV); 
+L_FDD9: STEP; FETCH(0x8D, 0xFDDC); operand = 0x0288; ABSO; STA; 
+L_FDDC: STEP; FETCH(0xD0, 0xFDDE); operand = 0x00F1; REL; BNE; if (pc != 0xFDDE) goto L_FDCF; 
+L_FDDE: STEP; FETCH(0x90, 0xFDE0); operand = 0x00CF; REL; BCC; if (pc != 0xFDE0) goto L_FDAF; 
+L_FDE0: STEP; FETCH(0xA5, 0xFDE2); operand = 0x00C2; ZP; LDA(MEM); 
+L_FDE2: STEP; FETCH(0x8D, 0xFDE5); operand = 0x0282; ABSO; STA; 
+L_FDE5: STEP; FETCH(0x85, 0xFDE7); operand = 0x0097; ZP; STA; 
+L_FDE7: STEP; FETCH(0xC9, 0xFDE9); operand = 0x0011; IMM; CMP(IMMV); 
+L_FDE9: STEP; FETCH(0x90, 0xFDEB); operand = 0x00C4; REL; BCC; if (pc != 0xFDEB) goto L_FDAF; 
+L_FDEB: STEP; FETCH(0x20, 0xFDEE); operand = 0xE5C3; ABSO; JSR; goto L_E5C3;
+L_FDEE: STEP; FETCH(0x4C, 0xFDF1); operand = 0xFDEB; ABSO; JMP; goto L_FDEB;
+L_FDF9: STEP; FETCH(0xA9, 0xFDFB); operand = 0x007F; IMM; LDA(IMMV); 
+L_FDFB: STEP; FETCH(0x8D, 0xFDFE); operand = 0x911E; ABSO; STA; 
+L_FDFE: STEP; FETCH(0x8D, 0xFE01); operand = 0x912E; ABSO; STA; 
+L_FE01: STEP; FETCH(0xA9, 0xFE03); operand = 0x0040; IMM; LDA(IMMV); 
+L_FE03: STEP; FETCH(0x8D, 0xFE06); operand = 0x912B; ABSO; STA; 
+L_FE06: STEP; FETCH(0xA9, 0xFE08); operand = 0x0040; IMM; LDA(IMMV); 
+L_FE08: STEP; FETCH(0x8D, 0xFE0B); operand = 0x911B; ABSO; STA; 
+L_FE0B: STEP; FETCH(0xA9, 0xFE0D); operand = 0x00FE; IMM; LDA(IMMV); 
+L_FE0D: STEP; FETCH(0x8D, 0xFE10); operand = 0x911C; ABSO; STA; 
+L_FE10: STEP; FETCH(0xA9, 0xFE12); operand = 0x00DE; IMM; LDA(IMMV); 
+L_FE12: STEP; FETCH(0x8D, 0xFE15); operand = 0x912C; ABSO; STA; 
+L_FE15: STEP; FETCH(0xA2, 0xFE17); operand = 0x0000; IMM; LDX(IMMV); 
+L_FE17: STEP; FETCH(0x8E, 0xFE1A); operand = 0x9112; ABSO; STX; 
+L_FE1A: STEP; FETCH(0xA2, 0xFE1C); operand = 0x00FF; IMM; LDX(IMMV); 
+L_FE1C: STEP; FETCH(0x8E, 0xFE1F); operand = 0x9122; ABSO; STX; 
+L_FE1F: STEP; FETCH(0xA2, 0xFE21); operand = 0x0000; IMM; LDX(IMMV); 
+L_FE21: STEP; FETCH(0x8E, 0xFE24); operand = 0x9123; ABSO; STX; 
+L_FE24: STEP; FETCH(0xA2, 0xFE26); operand = 0x0080; IMM; LDX(IMMV); 
+L_FE26: STEP; FETCH(0x8E, 0xFE29); operand = 0x9113; ABSO; STX; 
+L_FE29: STEP; FETCH(0xA2, 0xFE2B); operand = 0x0000; IMM; LDX(IMMV); 
+L_FE2B: STEP; FETCH(0x8E, 0xFE2E); operand = 0x911F; ABSO; STX; 
+L_FE2E: STEP; FETCH(0x20, 0xFE31); operand = 0xEF84; ABSO; JSR; goto L_EF84;
+L_FE31: STEP; FETCH(0xA9, 0xFE33); operand = 0x0082; IMM; LDA(IMMV); 
+L_FE33: STEP; FETCH(0x8D, 0xFE36); operand = 0x911E; ABSO; STA; 
+L_FE36: STEP; FETCH(0x20, 0xFE39); operand = 0xEF8D; ABSO; JSR; goto L_EF8D;
+L_FE39: STEP; FETCH(0xA9, 0xFE3B); operand = 0x00C0; IMM; LDA(IMMV); 
+L_FE3B: STEP; FETCH(0x8D, 0xFE3E); operand = 0x912E; ABSO; STA; 
+L_FE3E: STEP; FETCH(0xA9, 0xFE40); operand = 0x0089; IMM; LDA(IMMV); 
+L_FE40: STEP; FETCH(0x8D, 0xFE43); operand = 0x9124; ABSO; STA; 
+L_FE43: STEP; FETCH(0xA9, 0xFE45); operand = 0x0042; IMM; LDA(IMMV); 
+L_FE45: STEP; FETCH(0x8D, 0xFE48); operand = 0x9125; ABSO; STA; 
+L_FE48: STEP; FETCH(0x60, 0xFE49); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE49: STEP; FETCH(0x85, 0xFE4B); operand = 0x00B7; ZP; STA; 
+L_FE4B: STEP; FETCH(0x86, 0xFE4D); operand = 0x00BB; ZP; STX; 
+L_FE4D: STEP; FETCH(0x84, 0xFE4F); operand = 0x00BC; ZP; STY; 
+L_FE4F: STEP; FETCH(0x60, 0xFE50); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE50: STEP; FETCH(0x85, 0xFE52); operand = 0x00B8; ZP; STA; 
+L_FE52: STEP; FETCH(0x86, 0xFE54); operand = 0x00BA; ZP; STX; 
+L_FE54: STEP; FETCH(0x84, 0xFE56); operand = 0x00B9; ZP; STY; 
+L_FE56: STEP; FETCH(0x60, 0xFE57); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE57: STEP; FETCH(0xA5, 0xFE59); operand = 0x00BA; ZP; LDA(MEM); 
+L_FE59: STEP; FETCH(0xC9, 0xFE5B); operand = 0x0002; IMM; CMP(IMMV); 
+L_FE5B: STEP; FETCH(0xD0, 0xFE5D); operand = 0x000B; REL; BNE; if (pc != 0xFE5D) goto L_FE68; 
+L_FE5D: STEP; FETCH(0xAD, 0xFE60); operand = 0x0297; ABSO; LDA(MEM); 
+L_FE60: STEP; FETCH(0xA9, 0xFE62); operand = 0x0000; IMM; LDA(IMMV); 
+L_FE62: STEP; FETCH(0x8D, 0xFE65); operand = 0x0297; ABSO; STA; 
+L_FE65: STEP; FETCH(0x60, 0xFE66); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE66: STEP; FETCH(0x85, 0xFE68); operand = 0x009D; ZP; STA; 
+L_FE68: STEP; FETCH(0xA5, 0xFE6A); operand = 0x0090; ZP; LDA(MEM); 
+L_FE6A: STEP; FETCH(0x05, 0xFE6C); operand = 0x0090; ZP; ORA(MEM); 
+L_FE6C: STEP; FETCH(0x85, 0xFE6E); operand = 0x0090; ZP; STA; 
+L_FE6E: STEP; FETCH(0x60, 0xFE6F); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE6F: STEP; FETCH(0x8D, 0xFE72); operand = 0x0285; ABSO; STA; 
+L_FE72: STEP; FETCH(0x60, 0xFE73); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE73: STEP; FETCH(0x90, 0xFE75); operand = 0x0006; REL; BCC; if (pc != 0xFE75) goto L_FE7B; 
+L_FE75: STEP; FETCH(0xAE, 0xFE78); operand = 0x0283; ABSO; LDX(MEM); 
+L_FE78: STEP; FETCH(0xAC, 0xFE7B); operand = 0x0284; ABSO; LDY(MEM); 
+L_FE7B: STEP; FETCH(0x8E, 0xFE7E); operand = 0x0283; ABSO; STX; 
+L_FE7E: STEP; FETCH(0x8C, 0xFE81); operand = 0x0284; ABSO; STY; 
+L_FE81: STEP; FETCH(0x60, 0xFE82); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE82: STEP; FETCH(0x90, 0xFE84); operand = 0x0006; REL; BCC; if (pc != 0xFE84) goto L_FE8A; 
+L_FE84: STEP; FETCH(0xAE, 0xFE87); operand = 0x0281; ABSO; LDX(MEM); 
+L_FE87: STEP; FETCH(0xAC, 0xFE8A); operand = 0x0282; ABSO; LDY(MEM); 
+L_FE8A: STEP; FETCH(0x8E, 0xFE8D); operand = 0x0281; ABSO; STX; 
+L_FE8D: STEP; FETCH(0x8C, 0xFE90); operand = 0x0282; ABSO; STY; 
+L_FE90: STEP; FETCH(0x60, 0xFE91); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FE91: STEP; FETCH(0xB1, 0xFE93); operand = 0x00C1; INDY(1); LDA(MEM); 
+L_FE93: STEP; FETCH(0xAA, 0xFE94); operand = 0x0000; IMP; TAX; 
+L_FE94: STEP; FETCH(0xA9, 0xFE96); operand = 0x0055; IMM; LDA(IMMV); 
+L_FE96: STEP; FETCH(0x91, 0xFE98); operand = 0x00C1; INDY(0); STA; 
+L_FE98: STEP; FETCH(0xD1, 0xFE9A); operand = 0x00C1; INDY(1); CMP(MEM); 
+L_FE9A: STEP; FETCH(0xD0, 0xFE9C); operand = 0x0008; REL; BNE; if (pc != 0xFE9C) goto L_FEA4; 
+L_FE9C: STEP; FETCH(0x6A, 0xFE9D); operand = 0x0000; ACC; ROR_A; 
+L_FE9D: STEP; FETCH(0x91, 0xFE9F); operand = 0x00C1; INDY(0); STA; 
+L_FE9F: STEP; FETCH(0xD1, 0xFEA1); operand = 0x00C1; INDY(1); CMP(MEM); 
+L_FEA1: STEP; FETCH(0xD0, 0xFEA3); operand = 0x0001; REL; BNE; if (pc != 0xFEA3) goto L_FEA4; 
+L_FEA3: STEP; FETCH(0xA9, 0xFEA5); operand = 0x0018; IMM; LDA(IMMV); goto L_FEA5;
+L_FEA4: STEP; FETCH(0x18, 0xFEA5); operand = 0x0000; IMP; CLC; 
+L_FEA5: STEP; FETCH(0x8A, 0xFEA6); operand = 0x0000; IMP; TXA; 
+L_FEA6: STEP; FETCH(0x91, 0xFEA8); operand = 0x00C1; INDY(0); STA; 
+L_FEA8: STEP; FETCH(0x60, 0xFEA9); operand = 0x0000; IMP; RTS; goto dispatch;
+L_FEA9: STEP; FETCH(0x78, 0xFEAA); operand = 0x0000; IMP; SEI; 
+L_FEAA: STEP; FETCH(0x6C, 0xFEAD); operand = 0x0318; IND; JMP; goto dispatch;
+L_FEAD: STEP; FETCH(0x48, 0xFEAE); operand = 0x0000; IMP; PHA; 
+L_FEAE: STEP; FETCH(0x8A, 0xFEAF); operand = 0x0000; IMP; TXA; 
+L_FEAF: STEP; FETCH(0x48, 0xFEB0); operand = 0x0000; IMP; PHA; 
+L_FEB0: STEP; FETCH(0x98, 0xFEB1); operand = 0x0000; IMP; TYA; 
+L_FEB1: STEP; FETCH(0x48, 0xFEB2); operand = 0x0000; IMP; PHA; 
+L_FEB2: STEP; FETCH(0xAD, 0xFEB5); operand = 0x911D; ABSO; LDA(MEM); 
+L_FEB5: STEP; FETCH(0x10, 0xFEB7); operand = 0x0048; REL; BPL; if (pc != 0xFEB7) goto L_FEFF; 
+L_FEB7: STEP; FETCH(0x2D, 0xFEBA); operand = 0x911E; ABSO; AND(MEM); 
+L_FEBA: STEP; FETCH(0xAA, 0xFEBB); operand = 0x0000; IMP; TAX; 
+L_FEBB: STEP; FETCH(0x29, 0xFEBD); operand = 0x0002; IMM; AND(IMMV); 
+L_FEBD: STEP; FETCH(0xF0, 0xFEBF); operand = 0x001F; REL; BEQ; if (pc != 0xFEBF) goto L_FEDE; 
+L_FEBF: STEP; FETCH(0x20, 0xFEC2); operand = 0xFD3F; ABSO; JSR; goto L_FD3F;
+L_FEC2: STEP; FETCH(0xD0, 0xFEC4); operand = 0x0003; REL; BNE; if (pc != 0xFEC4) goto L_FEC7; 
+L_FEC4: STEP; FETCH(0x6C, 0xFEC7); operand = 0xA002; IND; JMP; goto dispatch;
+L_FEC7: STEP; FETCH(0x2C, 0xFECA); operand = 0x9111; ABSO; BIT(MEM); 
+L_FECA: STEP; FETCH(0x20, 0xFECD); operand = 0xF734; ABSO; JSR; goto L_F734;
+L_FECD: STEP; FETCH(0x20, 0xFED0); operand = 0xFFE1; ABSO; JSR; goto L_FFE1;
+L_FED0: STEP; FETCH(0xD0, 0xFED2); operand = 0x002D; REL; BNE; if (pc != 0xFED2) goto L_FEFF; 
+L_FED2: STEP; FETCH(0x20, 0xFED5); operand = 0xFD52; ABSO; JSR; goto L_FD52;
+L_FED5: STEP; FETCH(0x20, 0xFED8); operand = 0xFDF9; ABSO; JSR; goto L_FDF9;
+L_FED8: STEP; FETCH(0x20, 0xFEDB); operand = 0xE518; ABSO; JSR; goto L_E518;
+L_FEDB: STEP; FETCH(0x6C, 0xFEDE); operand = 0xC002; IND; JMP; goto dispatch;
+L_FEDE: STEP; FETCH(0xAD, 0xFEE1); operand = 0x911E; ABSO; LDA(MEM); 
+L_FEE1: STEP; FETCH(0x09, 0xFEE3); operand = 0x0080; IMM; ORA(IMMV); 
+L_FEE3: STEP; FETCH(0x48, 0xFEE4); operand = 0x0000; IMP; PHA; 
+L_FEE4: STEP; FETCH(0xA9, 0xFEE6); operand = 0x007F; IMM; LDA(IMMV); 
+L_FEE6: STEP; FETCH(0x8D, 0xFEE9); operand = 0x911E; ABSO; STA; 
+L_FEE9: STEP; FETCH(0x8A, 0xFEEA); operand = 0x0000; IMP; TXA; 
+L_FEEA: STEP; FETCH(0x29, 0xFEEC); operand = 0x0040; IMM; AND(IMMV); 
+L_FEEC: STEP; FETCH(0xF0, 0xFEEE); operand = 0x0014; REL; BEQ; if (pc != 0xFEEE) goto L_FF02; 
+L_FEEE: STEP; FETCH(0xA9, 0xFEF0); operand = 0x00CE; IMM; LDA(IMMV); 
+L_FEF0: STEP; FETCH(0x05, 0xFEF2); operand = 0x00B5; ZP; ORA(MEM); 
+L_FEF2: STEP; FETCH(0x8D, 0xFEF5); operand = 0x911C; ABSO; STA; 
+L_FEF5: STEP; FETCH(0xAD, 0xFEF8); operand = 0x9114; ABSO; LDA(MEM); 
+L_FEF8: STEP; FETCH(0x68, 0xFEF9); operand = 0x0000; IMP; PLA; 
+L_FEF9: STEP; FETCH(0x8D, 0xFEFC); operand = 0x911E; ABSO; STA; 
+L_FEFC: STEP; FETCH(0x20, 0xFEFF); operand = 0xEFA3; ABSO; JSR; goto L_EFA3;
+L_FEFF: STEP; FETCH(0x4C, 0xFF02); operand = 0xFF56; ABSO; JMP; goto L_FF56;
+L_FF02: STEP; FETCH(0x8A, 0xFF03); operand = 0x0000; IMP; TXA; 
+L_FF03: STEP; FETCH(0x29, 0xFF05); operand = 0x0020; IMM; AND(IMMV); 
+L_FF05: STEP; FETCH(0xF0, 0xFF07); operand = 0x0025; REL; BEQ; if (pc != 0xFF07) goto L_FF2C; 
+L_FF07: STEP; FETCH(0xAD, 0xFF0A); operand = 0x9110; ABSO; LDA(MEM); 
+L_FF0A: STEP; FETCH(0x29, 0xFF0C); operand = 0x0001; IMM; AND(IMMV); 
+L_FF0C: STEP; FETCH(0x85, 0xFF0E); operand = 0x00A7; ZP; STA; 
+L_FF0E: STEP; FETCH(0xAD, 0xFF11); operand = 0x9118; ABSO; LDA(MEM); 
+L_FF11: STEP; FETCH(0xE9, 0xFF13); operand = 0x0016; IMM; SBC(IMMV); 
+L_FF13: STEP; FETCH(0x6D, 0xFF16); operand = 0x0299; ABSO; ADC(MEM); 
+L_FF16: STEP; FETCH(0x8D, 0xFF19); operand = 0x9118; ABSO; STA; 
+L_FF19: STEP; FETCH(0xAD, 0xFF1C); operand = 0x9119; ABSO; LDA(MEM); 
+L_FF1C: STEP; FETCH(0x6D, 0xFF1F); operand = 0x029A; ABSO; ADC(MEM); 
+L_FF1F: STEP; FETCH(0x8D, 0xFF22); operand = 0x9119; ABSO; STA; 
+L_FF22: STEP; FETCH(0x68, 0xFF23); operand = 0x0000; IMP; PLA; 
+L_FF23: STEP; FETCH(0x8D, 0xFF26); operand = 0x911E; ABSO; STA; 
+L_FF26: STEP; FETCH(0x20, 0xFF29); operand = 0xF036; ABSO; JSR; goto L_F036;
+L_FF29: STEP; FETCH(0x4C, 0xFF2C); operand = 0xFF56; ABSO; JMP; goto L_FF56;
+L_FF2C: STEP; FETCH(0x8A, 0xFF2D); operand = 0x0000; IMP; TXA; 
+L_FF2D: STEP; FETCH(0x29, 0xFF2F); operand = 0x0010; IMM; AND(IMMV); 
+L_FF2F: STEP; FETCH(0xF0, 0xFF31); operand = 0x0025; REL; BEQ; if (pc != 0xFF31) goto L_FF56; 
+L_FF31: STEP; FETCH(0xAD, 0xFF34); operand = 0x0293; ABSO; LDA(MEM); 
+L_FF34: STEP; FETCH(0x29, 0xFF36); operand = 0x000F; IMM; AND(IMMV); 
+L_FF36: STEP; FETCH(0xD0, 0xFF38); operand = 0x0000; REL; BNE; if (pc != 0xFF38) goto L_FF38; 
+L_FF38: STEP; FETCH(0x0A, 0xFF39); operand = 0x0000; ACC; ASL_A; 
+L_FF39: STEP; FETCH(0xAA, 0xFF3A); operand = 0x0000; IMP; TAX; 
+L_FF3A: STEP; FETCH(0xBD, 0xFF3D); operand = 0xFF5A; ABSX(1); LDA(MEM); 
+L_FF3D: STEP; FETCH(0x8D, 0xFF40); operand = 0x9118; ABSO; STA; 
+L_FF40: STEP; FETCH(0xBD, 0xFF43); operand = 0xFF5B; ABSX(1); LDA(MEM); 
+L_FF43: STEP; FETCH(0x8D, 0xFF46); operand = 0x9119; ABSO; STA; 
+L_FF46: STEP; FETCH(0xAD, 0xFF49); operand = 0x9110; ABSO; LDA(MEM); 
+L_FF49: STEP; FETCH(0x68, 0xFF4A); operand = 0x0000; IMP; PLA; 
+L_FF4A: STEP; FETCH(0x09, 0xFF4C); operand = 0x0020; IMM; ORA(IMMV); 
+L_FF4C: STEP; FETCH(0x29, 0xFF4E); operand = 0x00EF; IMM; AND(IMMV); 
+L_FF4E: STEP; FETCH(0x8D, 0xFF51); operand = 0x911E; ABSO; STA; 
+L_FF51: STEP; FETCH(0xAE, 0xFF54); operand = 0x0298; ABSO; LDX(MEM); 
+L_FF54: STEP; FETCH(0x86, 0xFF56); operand = 0x00A8; ZP; STX; 
+L_FF56: STEP; FETCH(0x68, 0xFF57); operand = 0x0000; IMP; PLA; 
+L_FF57: STEP; FETCH(0xA8, 0xFF58); operand = 0x0000; IMP; TAY; 
+L_FF58: STEP; FETCH(0x68, 0xFF59); operand = 0x0000; IMP; PLA; 
+L_FF59: STEP; FETCH(0xAA, 0xFF5A); operand = 0x0000; IMP; TAX; 
+L_FF5A: STEP; FETCH(0x68, 0xFF5B); operand = 0x0000; IMP; PLA; 
+L_FF5B: STEP; FETCH(0x40, 0xFF5C); operand = 0x0000; IMP; RTI; goto dispatch;
+L_FF72: STEP; FETCH(0x48, 0xFF73); operand = 0x0000; IMP; PHA; 
+L_FF73: STEP; FETCH(0x8A, 0xFF74); operand = 0x0000; IMP; TXA; 
+L_FF74: STEP; FETCH(0x48, 0xFF75); operand = 0x0000; IMP; PHA; 
+L_FF75: STEP; FETCH(0x98, 0xFF76); operand = 0x0000; IMP; TYA; 
+L_FF76: STEP; FETCH(0x48, 0xFF77); operand = 0x0000; IMP; PHA; 
+L_FF77: STEP; FETCH(0xBA, 0xFF78); operand = 0x0000; IMP; TSX; 
+L_FF78: STEP; FETCH(0xBD, 0xFF7B); operand = 0x0104; ABSX(1); LDA(MEM); 
+L_FF7B: STEP; FETCH(0x29, 0xFF7D); operand = 0x0010; IMM; AND(IMMV); 
+L_FF7D: STEP; FETCH(0xF0, 0xFF7F); operand = 0x0003; REL; BEQ; if (pc != 0xFF7F) goto L_FF82; 
+L_FF7F: STEP; FETCH(0x6C, 0xFF82); operand = 0x0316; IND; JMP; goto dispatch;
+L_FF82: STEP; FETCH(0x6C, 0xFF85); operand = 0x0314; IND; JMP; goto dispatch;
+L_FF8A: STEP; FETCH(0x4C, 0xFF8D); operand = 0xFD52; ABSO; JMP; goto L_FD52;
+L_FF8D: STEP; FETCH(0x4C, 0xFF90); operand = 0xFD57; ABSO; JMP; goto L_FD57;
+L_FF90: STEP; FETCH(0x4C, 0xFF93); operand = 0xFE66; ABSO; JMP; goto L_FE66;
+L_FF93: STEP; FETCH(0x4C, 0xFF96); operand = 0xEEC0; ABSO; JMP; goto L_EEC0;
+L_FF96: STEP; FETCH(0x4C, 0xFF99); operand = 0xEECE; ABSO; JMP; goto L_EECE;
+L_FF99: STEP; FETCH(0x4C, 0xFF9C); operand = 0xFE73; ABSO; JMP; goto L_FE73;
+L_FF9C: STEP; FETCH(0x4C, 0xFF9F); operand = 0xFE82; ABSO; JMP; goto L_FE82;
+L_FF9F: STEP; FETCH(0x4C, 0xFFA2); operand = 0xEB1E; ABSO; JMP; goto L_EB1E;
+L_FFA2: STEP; FETCH(0x4C, 0xFFA5); operand = 0xFE6F; ABSO; JMP; goto L_FE6F;
+L_FFA5: STEP; FETCH(0x4C, 0xFFA8); operand = 0xEF19; ABSO; JMP; goto L_EF19;
+L_FFA8: STEP; FETCH(0x4C, 0xFFAB); operand = 0xEEE4; ABSO; JMP; goto L_EEE4;
+L_FFAB: STEP; FETCH(0x4C, 0xFFAE); operand = 0xEEF6; ABSO; JMP; goto L_EEF6;
+L_FFAE: STEP; FETCH(0x4C, 0xFFB1); operand = 0xEF04; ABSO; JMP; goto L_EF04;
+L_FFB1: STEP; FETCH(0x4C, 0xFFB4); operand = 0xEE17; ABSO; JMP; goto L_EE17;
+L_FFB4: STEP; FETCH(0x4C, 0xFFB7); operand = 0xEE14; ABSO; JMP; goto L_EE14;
+L_FFB7: STEP; FETCH(0x4C, 0xFFBA); operand = 0xFE57; ABSO; JMP; goto L_FE57;
+L_FFBA: STEP; FETCH(0x4C, 0xFFBD); operand = 0xFE50; ABSO; JMP; goto L_FE50;
+L_FFBD: STEP; FETCH(0x4C, 0xFFC0); operand = 0xFE49; ABSO; JMP; goto L_FE49;
+L_FFC0: STEP; FETCH(0x6C, 0xFFC3); operand = 0x031A; IND; JMP; goto dispatch;
+L_FFC3: STEP; FETCH(0x6C, 0xFFC6); operand = 0x031C; IND; JMP; goto dispatch;
+L_FFC6: STEP; FETCH(0x6C, 0xFFC9); operand = 0x031E; IND; JMP; goto dispatch;
+L_FFC9: STEP; FETCH(0x6C, 0xFFCC); operand = 0x0320; IND; JMP; goto dispatch;
+L_FFCC: STEP; FETCH(0x6C, 0xFFCF); operand = 0x0322; IND; JMP; goto dispatch;
+L_FFCF: STEP; FETCH(0x6C, 0xFFD2); operand = 0x0324; IND; JMP; goto dispatch;
+L_FFD2: STEP; FETCH(0x6C, 0xFFD5); operand = 0x0326; IND; JMP; goto dispatch;
+L_FFD5: STEP; FETCH(0x4C, 0xFFD8); operand = 0xF542; ABSO; JMP; goto L_F542;
+L_FFD8: STEP; FETCH(0x4C, 0xFFDB); operand = 0xF675; ABSO; JMP; goto L_F675;
+L_FFDB: STEP; FETCH(0x4C, 0xFFDE); operand = 0xF767; ABSO; JMP; goto L_F767;
+L_FFDE: STEP; FETCH(0x4C, 0xFFE1); operand = 0xF760; ABSO; JMP; goto L_F760;
+L_FFE1: STEP; FETCH(0x6C, 0xFFE4); operand = 0x0328; IND; JMP; goto dispatch;
+L_FFE4: STEP; FETCH(0x6C, 0xFFE7); operand = 0x032A; IND; JMP; goto dispatch;
+L_FFE7: STEP; FETCH(0x6C, 0xFFEA); operand = 0x032C; IND; JMP; goto dispatch;
+L_FFEA: STEP; FETCH(0x4C, 0xFFED); operand = 0xF734; ABSO; JMP; goto L_F734;
+L_FFED: STEP; FETCH(0x4C, 0xFFF0); operand = 0xE505; ABSO; JMP; goto L_E505;
+L_FFF0: STEP; FETCH(0x4C, 0xFFF3); operand = 0xE50A; ABSO; JMP; goto L_E50A;
+L_FFF3: STEP; FETCH(0x4C, 0xFFF6); operand = 0xE500; ABSO; JMP; goto L_E500;
+
+dispatch:
+    switch (pc) {
+    case 0xC38A: goto L_C38A;
+    case 0xC38B: goto L_C38B;
+    case 0xC38C: goto L_C38C;
+    case 0xC38D: goto L_C38D;
+    case 0xC38E: goto L_C38E;
+    case 0xC38F: goto L_C38F;
+    case 0xC392: goto L_C392;
+    case 0xC394: goto L_C394;
+    case 0xC396: goto L_C396;
+    case 0xC398: goto L_C398;
+    case 0xC39A: goto L_C39A;
+    case 0xC39D: goto L_C39D;
+    case 0xC39F: goto L_C39F;
+    case 0xC3A2: goto L_C3A2;
+    case 0xC3A4: goto L_C3A4;
+    case 0xC3A7: goto L_C3A7;
+    case 0xC3A9: goto L_C3A9;
+    case 0xC3AB: goto L_C3AB;
+    case 0xC3AE: goto L_C3AE;
+    case 0xC3B0: goto L_C3B0;
+    case 0xC3B1: goto L_C3B1;
+    case 0xC3B2: goto L_C3B2;
+    case 0xC3B4: goto L_C3B4;
+    case 0xC3B5: goto L_C3B5;
+    case 0xC3B7: goto L_C3B7;
+    case 0xC3B8: goto L_C3B8;
+    case 0xC3BB: goto L_C3BB;
+    case 0xC3BD: goto L_C3BD;
+    case 0xC3BF: goto L_C3BF;
+    case 0xC3C0: goto L_C3C0;
+    case 0xC3C2: goto L_C3C2;
+    case 0xC3C4: goto L_C3C4;
+    case 0xC3C6: goto L_C3C6;
+    case 0xC3C7: goto L_C3C7;
+    case 0xC3C9: goto L_C3C9;
+    case 0xC3CB: goto L_C3CB;
+    case 0xC3CC: goto L_C3CC;
+    case 0xC3CD: goto L_C3CD;
+    case 0xC3CE: goto L_C3CE;
+    case 0xC3D0: goto L_C3D0;
+    case 0xC3D2: goto L_C3D2;
+    case 0xC3D3: goto L_C3D3;
+    case 0xC3D5: goto L_C3D5;
+    case 0xC3D7: goto L_C3D7;
+    case 0xC3D9: goto L_C3D9;
+    case 0xC3DB: goto L_C3DB;
+    case 0xC3DC: goto L_C3DC;
+    case 0xC3DE: goto L_C3DE;
+    case 0xC3E0: goto L_C3E0;
+    case 0xC3E2: goto L_C3E2;
+    case 0xC3E4: goto L_C3E4;
+    case 0xC3E6: goto L_C3E6;
+    case 0xC3E8: goto L_C3E8;
+    case 0xC3EA: goto L_C3EA;
+    case 0xC3EC: goto L_C3EC;
+    case 0xC3ED: goto L_C3ED;
+    case 0xC3EF: goto L_C3EF;
+    case 0xC3F1: goto L_C3F1;
+    case 0xC3F3: goto L_C3F3;
+    case 0xC3F5: goto L_C3F5;
+    case 0xC3F7: goto L_C3F7;
+    case 0xC3F8: goto L_C3F8;
+    case 0xC3FA: goto L_C3FA;
+    case 0xC3FB: goto L_C3FB;
+    case 0xC3FC: goto L_C3FC;
+    case 0xC3FE: goto L_C3FE;
+    case 0xC400: goto L_C400;
+    case 0xC402: goto L_C402;
+    case 0xC403: goto L_C403;
+    case 0xC405: goto L_C405;
+    case 0xC407: goto L_C407;
+    case 0xC408: goto L_C408;
+    case 0xC40A: goto L_C40A;
+    case 0xC40C: goto L_C40C;
+    case 0xC40E: goto L_C40E;
+    case 0xC410: goto L_C410;
+    case 0xC412: goto L_C412;
+    case 0xC413: goto L_C413;
+    case 0xC415: goto L_C415;
+    case 0xC416: goto L_C416;
+    case 0xC417: goto L_C417;
+    case 0xC419: goto L_C419;
+    case 0xC41A: goto L_C41A;
+    case 0xC41C: goto L_C41C;
+    case 0xC41F: goto L_C41F;
+    case 0xC421: goto L_C421;
+    case 0xC422: goto L_C422;
+    case 0xC424: goto L_C424;
+    case 0xC425: goto L_C425;
+    case 0xC427: goto L_C427;
+    case 0xC428: goto L_C428;
+    case 0xC429: goto L_C429;
+    case 0xC42A: goto L_C42A;
+    case 0xC42C: goto L_C42C;
+    case 0xC42E: goto L_C42E;
+    case 0xC430: goto L_C430;
+    case 0xC432: goto L_C432;
+    case 0xC434: goto L_C434;
+    case 0xC435: goto L_C435;
+    case 0xC437: goto L_C437;
+    case 0xC43A: goto L_C43A;
+    case 0xC43B: goto L_C43B;
+    case 0xC43C: goto L_C43C;
+    case 0xC43D: goto L_C43D;
+    case 0xC440: goto L_C440;
+    case 0xC442: goto L_C442;
+    case 0xC445: goto L_C445;
+    case 0xC447: goto L_C447;
+    case 0xC44A: goto L_C44A;
+    case 0xC44C: goto L_C44C;
+    case 0xC44E: goto L_C44E;
+    case 0xC451: goto L_C451;
+    case 0xC454: goto L_C454;
+    case 0xC456: goto L_C456;
+    case 0xC458: goto L_C458;
+    case 0xC459: goto L_C459;
+    case 0xC45B: goto L_C45B;
+    case 0xC45E: goto L_C45E;
+    case 0xC45F: goto L_C45F;
+    case 0xC460: goto L_C460;
+    case 0xC462: goto L_C462;
+    case 0xC465: goto L_C465;
+    case 0xC467: goto L_C467;
+    case 0xC469: goto L_C469;
+    case 0xC46C: goto L_C46C;
+    case 0xC46E: goto L_C46E;
+    case 0xC46F: goto L_C46F;
+    case 0xC471: goto L_C471;
+    case 0xC474: goto L_C474;
+    case 0xC476: goto L_C476;
+    case 0xC478: goto L_C478;
+    case 0xC47B: goto L_C47B;
+    case 0xC47D: goto L_C47D;
+    case 0xC480: goto L_C480;
+    case 0xC483: goto L_C483;
+    case 0xC486: goto L_C486;
+    case 0xC488: goto L_C488;
+    case 0xC48A: goto L_C48A;
+    case 0xC48D: goto L_C48D;
+    case 0xC48E: goto L_C48E;
+    case 0xC490: goto L_C490;
+    case 0xC492: goto L_C492;
+    case 0xC494: goto L_C494;
+    case 0xC496: goto L_C496;
+    case 0xC499: goto L_C499;
+    case 0xC49C: goto L_C49C;
+    case 0xC49F: goto L_C49F;
+    case 0xC4A2: goto L_C4A2;
+    case 0xC4A4: goto L_C4A4;
+    case 0xC4A7: goto L_C4A7;
+    case 0xC4A9: goto L_C4A9;
+    case 0xC4AB: goto L_C4AB;
+    case 0xC4AD: goto L_C4AD;
+    case 0xC4AF: goto L_C4AF;
+    case 0xC4B1: goto L_C4B1;
+    case 0xC4B3: goto L_C4B3;
+    case 0xC4B5: goto L_C4B5;
+    case 0xC4B7: goto L_C4B7;
+    case 0xC4B9: goto L_C4B9;
+    case 0xC4BA: goto L_C4BA;
+    case 0xC4BC: goto L_C4BC;
+    case 0xC4BD: goto L_C4BD;
+    case 0xC4BF: goto L_C4BF;
+    case 0xC4C1: goto L_C4C1;
+    case 0xC4C3: goto L_C4C3;
+    case 0xC4C5: goto L_C4C5;
+    case 0xC4C7: goto L_C4C7;
+    case 0xC4C9: goto L_C4C9;
+    case 0xC4CB: goto L_C4CB;
+    case 0xC4CC: goto L_C4CC;
+    case 0xC4CD: goto L_C4CD;
+    case 0xC4CF: goto L_C4CF;
+    case 0xC4D1: goto L_C4D1;
+    case 0xC4D2: goto L_C4D2;
+    case 0xC4D4: goto L_C4D4;
+    case 0xC4D5: goto L_C4D5;
+    case 0xC4D7: goto L_C4D7;
+    case 0xC4D8: goto L_C4D8;
+    case 0xC4DA: goto L_C4DA;
+    case 0xC4DC: goto L_C4DC;
+    case 0xC4DE: goto L_C4DE;
+    case 0xC4DF: goto L_C4DF;
+    case 0xC4E1: goto L_C4E1;
+    case 0xC4E3: goto L_C4E3;
+    case 0xC4E4: goto L_C4E4;
+    case 0xC4E6: goto L_C4E6;
+    case 0xC4E8: goto L_C4E8;
+    case 0xC4EA: goto L_C4EA;
+    case 0xC4EB: goto L_C4EB;
+    case 0xC4ED: goto L_C4ED;
+    case 0xC4F0: goto L_C4F0;
+    case 0xC4F3: goto L_C4F3;
+    case 0xC4F6: goto L_C4F6;
+    case 0xC4F8: goto L_C4F8;
+    case 0xC4F9: goto L_C4F9;
+    case 0xC4FB: goto L_C4FB;
+    case 0xC4FD: goto L_C4FD;
+    case 0xC4FF: goto L_C4FF;
+    case 0xC501: goto L_C501;
+    case 0xC503: goto L_C503;
+    case 0xC505: goto L_C505;
+    case 0xC507: goto L_C507;
+    case 0xC508: goto L_C508;
+    case 0xC50A: goto L_C50A;
+    case 0xC50D: goto L_C50D;
+    case 0xC50F: goto L_C50F;
+    case 0xC511: goto L_C511;
+    case 0xC514: goto L_C514;
+    case 0xC517: goto L_C517;
+    case 0xC519: goto L_C519;
+    case 0xC51B: goto L_C51B;
+    case 0xC51D: goto L_C51D;
+    case 0xC51F: goto L_C51F;
+    case 0xC521: goto L_C521;
+    case 0xC522: goto L_C522;
+    case 0xC525: goto L_C525;
+    case 0xC527: goto L_C527;
+    case 0xC528: goto L_C528;
+    case 0xC52A: goto L_C52A;
+    case 0xC52D: goto L_C52D;
+    case 0xC530: goto L_C530;
+    case 0xC533: goto L_C533;
+    case 0xC535: goto L_C535;
+    case 0xC537: goto L_C537;
+    case 0xC539: goto L_C539;
+    case 0xC53B: goto L_C53B;
+    case 0xC53C: goto L_C53C;
+    case 0xC53E: goto L_C53E;
+    case 0xC540: goto L_C540;
+    case 0xC542: goto L_C542;
+    case 0xC544: goto L_C544;
+    case 0xC545: goto L_C545;
+    case 0xC547: goto L_C547;
+    case 0xC549: goto L_C549;
+    case 0xC54A: goto L_C54A;
+    case 0xC54B: goto L_C54B;
+    case 0xC54D: goto L_C54D;
+    case 0xC54E: goto L_C54E;
+    case 0xC550: goto L_C550;
+    case 0xC552: goto L_C552;
+    case 0xC554: goto L_C554;
+    case 0xC556: goto L_C556;
+    case 0xC557: goto L_C557;
+    case 0xC559: goto L_C559;
+    case 0xC55B: goto L_C55B;
+    case 0xC55D: goto L_C55D;
+    case 0xC55F: goto L_C55F;
+    case 0xC560: goto L_C560;
+    case 0xC562: goto L_C562;
+    case 0xC565: goto L_C565;
+    case 0xC567: goto L_C567;
+    case 0xC569: goto L_C569;
+    case 0xC56C: goto L_C56C;
+    case 0xC56D: goto L_C56D;
+    case 0xC56F: goto L_C56F;
+    case 0xC571: goto L_C571;
+    case 0xC573: goto L_C573;
+    case 0xC576: goto L_C576;
+    case 0xC579: goto L_C579;
+    case 0xC57C: goto L_C57C;
+    case 0xC57E: goto L_C57E;
+    case 0xC580: goto L_C580;
+    case 0xC582: goto L_C582;
+    case 0xC585: goto L_C585;
+    case 0xC587: goto L_C587;
+    case 0xC589: goto L_C589;
+    case 0xC58B: goto L_C58B;
+    case 0xC58C: goto L_C58C;
+    case 0xC58E: goto L_C58E;
+    case 0xC590: goto L_C590;
+    case 0xC592: goto L_C592;
+    case 0xC594: goto L_C594;
+    case 0xC596: goto L_C596;
+    case 0xC598: goto L_C598;
+    case 0xC59A: goto L_C59A;
+    case 0xC59C: goto L_C59C;
+    case 0xC59E: goto L_C59E;
+    case 0xC5A0: goto L_C5A0;
+    case 0xC5A2: goto L_C5A2;
+    case 0xC5A4: goto L_C5A4;
+    case 0xC5A6: goto L_C5A6;
+    case 0xC5A8: goto L_C5A8;
+    case 0xC5AA: goto L_C5AA;
+    case 0xC5AC: goto L_C5AC;
+    case 0xC5AE: goto L_C5AE;
+    case 0xC5B0: goto L_C5B0;
+    case 0xC5B2: goto L_C5B2;
+    case 0xC5B3: goto L_C5B3;
+    case 0xC5B5: goto L_C5B5;
+    case 0xC5B6: goto L_C5B6;
+    case 0xC5B7: goto L_C5B7;
+    case 0xC5B8: goto L_C5B8;
+    case 0xC5BB: goto L_C5BB;
+    case 0xC5BC: goto L_C5BC;
+    case 0xC5BF: goto L_C5BF;
+    case 0xC5C1: goto L_C5C1;
+    case 0xC5C3: goto L_C5C3;
+    case 0xC5C5: goto L_C5C5;
+    case 0xC5C7: goto L_C5C7;
+    case 0xC5C9: goto L_C5C9;
+    case 0xC5CA: goto L_C5CA;
+    case 0xC5CB: goto L_C5CB;
+    case 0xC5CE: goto L_C5CE;
+    case 0xC5D1: goto L_C5D1;
+    case 0xC5D3: goto L_C5D3;
+    case 0xC5D4: goto L_C5D4;
+    case 0xC5D6: goto L_C5D6;
+    case 0xC5D8: goto L_C5D8;
+    case 0xC5DA: goto L_C5DA;
+    case 0xC5DC: goto L_C5DC;
+    case 0xC5DE: goto L_C5DE;
+    case 0xC5DF: goto L_C5DF;
+    case 0xC5E1: goto L_C5E1;
+    case 0xC5E3: goto L_C5E3;
+    case 0xC5E5: goto L_C5E5;
+    case 0xC5E8: goto L_C5E8;
+    case 0xC5EA: goto L_C5EA;
+    case 0xC5EC: goto L_C5EC;
+    case 0xC5EE: goto L_C5EE;
+    case 0xC5EF: goto L_C5EF;
+    case 0xC5F2: goto L_C5F2;
+    case 0xC5F3: goto L_C5F3;
+    case 0xC5F5: goto L_C5F5;
+    case 0xC5F7: goto L_C5F7;
+    case 0xC5F9: goto L_C5F9;
+    case 0xC5FA: goto L_C5FA;
+    case 0xC5FD: goto L_C5FD;
+    case 0xC5FF: goto L_C5FF;
+    case 0xC602: goto L_C602;
+    case 0xC604: goto L_C604;
+    case 0xC607: goto L_C607;
+    case 0xC609: goto L_C609;
+    case 0xC60C: goto L_C60C;
+    case 0xC60E: goto L_C60E;
+    case 0xC610: goto L_C610;
+    case 0xC612: goto L_C612;
+    case 0xC613: goto L_C613;
+    case 0xC615: goto L_C615;
+    case 0xC617: goto L_C617;
+    case 0xC619: goto L_C619;
+    case 0xC61B: goto L_C61B;
+    case 0xC61D: goto L_C61D;
+    case 0xC61F: goto L_C61F;
+    case 0xC621: goto L_C621;
+    case 0xC622: goto L_C622;
+    case 0xC623: goto L_C623;
+    case 0xC625: goto L_C625;
+    case 0xC627: goto L_C627;
+    case 0xC629: goto L_C629;
+    case 0xC62B: goto L_C62B;
+    case 0xC62C: goto L_C62C;
+    case 0xC62E: goto L_C62E;
+    case 0xC630: goto L_C630;
+    case 0xC631: goto L_C631;
+    case 0xC633: goto L_C633;
+    case 0xC635: goto L_C635;
+    case 0xC637: goto L_C637;
+    case 0xC638: goto L_C638;
+    case 0xC63A: goto L_C63A;
+    case 0xC63B: goto L_C63B;
+    case 0xC63C: goto L_C63C;
+    case 0xC63E: goto L_C63E;
+    case 0xC640: goto L_C640;
+    case 0xC641: goto L_C641;
+    case 0xC642: goto L_C642;
+    case 0xC644: goto L_C644;
+    case 0xC646: goto L_C646;
+    case 0xC647: goto L_C647;
+    case 0xC649: goto L_C649;
+    case 0xC64A: goto L_C64A;
+    case 0xC64C: goto L_C64C;
+    case 0xC64E: goto L_C64E;
+    case 0xC64F: goto L_C64F;
+    case 0xC651: goto L_C651;
+    case 0xC653: goto L_C653;
+    case 0xC655: goto L_C655;
+    case 0xC657: goto L_C657;
+    case 0xC659: goto L_C659;
+    case 0xC65C: goto L_C65C;
+    case 0xC65E: goto L_C65E;
+    case 0xC660: goto L_C660;
+    case 0xC663: goto L_C663;
+    case 0xC665: goto L_C665;
+    case 0xC667: goto L_C667;
+    case 0xC669: goto L_C669;
+    case 0xC66B: goto L_C66B;
+    case 0xC66D: goto L_C66D;
+    case 0xC66F: goto L_C66F;
+    case 0xC671: goto L_C671;
+    case 0xC673: goto L_C673;
+    case 0xC675: goto L_C675;
+    case 0xC677: goto L_C677;
+    case 0xC67A: goto L_C67A;
+    case 0xC67C: goto L_C67C;
+    case 0xC67E: goto L_C67E;
+    case 0xC67F: goto L_C67F;
+    case 0xC680: goto L_C680;
+    case 0xC681: goto L_C681;
+    case 0xC683: goto L_C683;
+    case 0xC684: goto L_C684;
+    case 0xC685: goto L_C685;
+    case 0xC686: goto L_C686;
+    case 0xC687: goto L_C687;
+    case 0xC689: goto L_C689;
+    case 0xC68B: goto L_C68B;
+    case 0xC68D: goto L_C68D;
+    case 0xC68E: goto L_C68E;
+    case 0xC68F: goto L_C68F;
+    case 0xC691: goto L_C691;
+    case 0xC693: goto L_C693;
+    case 0xC695: goto L_C695;
+    case 0xC697: goto L_C697;
+    case 0xC699: goto L_C699;
+    case 0xC69B: goto L_C69B;
+    case 0xC69C: goto L_C69C;
+    case 0xC69E: goto L_C69E;
+    case 0xC6A0: goto L_C6A0;
+    case 0xC6A2: goto L_C6A2;
+    case 0xC6A4: goto L_C6A4;
+    case 0xC6A7: goto L_C6A7;
+    case 0xC6AA: goto L_C6AA;
+    case 0xC6AD: goto L_C6AD;
+    case 0xC6AF: goto L_C6AF;
+    case 0xC6B1: goto L_C6B1;
+    case 0xC6B3: goto L_C6B3;
+    case 0xC6B6: goto L_C6B6;
+    case 0xC6B9: goto L_C6B9;
+    case 0xC6BB: goto L_C6BB;
+    case 0xC6BC: goto L_C6BC;
+    case 0xC6BD: goto L_C6BD;
+    case 0xC6BF: goto L_C6BF;
+    case 0xC6C1: goto L_C6C1;
+    case 0xC6C3: goto L_C6C3;
+    case 0xC6C5: goto L_C6C5;
+    case 0xC6C7: goto L_C6C7;
+    case 0xC6C9: goto L_C6C9;
+    case 0xC6CB: goto L_C6CB;
+    case 0xC6CD: goto L_C6CD;
+    case 0xC6CF: goto L_C6CF;
+    case 0xC6D1: goto L_C6D1;
+    case 0xC6D4: goto L_C6D4;
+    case 0xC6D7: goto L_C6D7;
+    case 0xC6D8: goto L_C6D8;
+    case 0xC6DA: goto L_C6DA;
+    case 0xC6DB: goto L_C6DB;
+    case 0xC6DC: goto L_C6DC;
+    case 0xC6DE: goto L_C6DE;
+    case 0xC6E0: goto L_C6E0;
+    case 0xC6E2: goto L_C6E2;
+    case 0xC6E4: goto L_C6E4;
+    case 0xC6E6: goto L_C6E6;
+    case 0xC6E8: goto L_C6E8;
+    case 0xC6EA: goto L_C6EA;
+    case 0xC6ED: goto L_C6ED;
+    case 0xC6EF: goto L_C6EF;
+    case 0xC6F1: goto L_C6F1;
+    case 0xC6F3: goto L_C6F3;
+    case 0xC6F6: goto L_C6F6;
+    case 0xC6F8: goto L_C6F8;
+    case 0xC6FA: goto L_C6FA;
+    case 0xC6FC: goto L_C6FC;
+    case 0xC6FE: goto L_C6FE;
+    case 0xC700: goto L_C700;
+    case 0xC701: goto L_C701;
+    case 0xC703: goto L_C703;
+    case 0xC705: goto L_C705;
+    case 0xC707: goto L_C707;
+    case 0xC708: goto L_C708;
+    case 0xC70A: goto L_C70A;
+    case 0xC70B: goto L_C70B;
+    case 0xC70C: goto L_C70C;
+    case 0xC70E: goto L_C70E;
+    case 0xC710: goto L_C710;
+    case 0xC712: goto L_C712;
+    case 0xC714: goto L_C714;
+    case 0xC717: goto L_C717;
+    case 0xC71A: goto L_C71A;
+    case 0xC71C: goto L_C71C;
+    case 0xC71E: goto L_C71E;
+    case 0xC720: goto L_C720;
+    case 0xC722: goto L_C722;
+    case 0xC724: goto L_C724;
+    case 0xC725: goto L_C725;
+    case 0xC727: goto L_C727;
+    case 0xC728: goto L_C728;
+    case 0xC72A: goto L_C72A;
+    case 0xC72C: goto L_C72C;
+    case 0xC72D: goto L_C72D;
+    case 0xC72F: goto L_C72F;
+    case 0xC730: goto L_C730;
+    case 0xC733: goto L_C733;
+    case 0xC735: goto L_C735;
+    case 0xC737: goto L_C737;
+    case 0xC738: goto L_C738;
+    case 0xC73B: goto L_C73B;
+    case 0xC73D: goto L_C73D;
+    case 0xC740: goto L_C740;
+    case 0xC742: goto L_C742;
+    case 0xC744: goto L_C744;
+    case 0xC746: goto L_C746;
+    case 0xC749: goto L_C749;
+    case 0xC74C: goto L_C74C;
+    case 0xC74E: goto L_C74E;
+    case 0xC74F: goto L_C74F;
+    case 0xC751: goto L_C751;
+    case 0xC752: goto L_C752;
+    case 0xC753: goto L_C753;
+    case 0xC754: goto L_C754;
+    case 0xC755: goto L_C755;
+    case 0xC757: goto L_C757;
+    case 0xC75A: goto L_C75A;
+    case 0xC75D: goto L_C75D;
+    case 0xC75E: goto L_C75E;
+    case 0xC75F: goto L_C75F;
+    case 0xC761: goto L_C761;
+    case 0xC762: goto L_C762;
+    case 0xC764: goto L_C764;
+    case 0xC766: goto L_C766;
+    case 0xC767: goto L_C767;
+    case 0xC769: goto L_C769;
+    case 0xC76A: goto L_C76A;
+    case 0xC76C: goto L_C76C;
+    case 0xC76D: goto L_C76D;
+    case 0xC76F: goto L_C76F;
+    case 0xC772: goto L_C772;
+    case 0xC775: goto L_C775;
+    case 0xC778: goto L_C778;
+    case 0xC77A: goto L_C77A;
+    case 0xC77C: goto L_C77C;
+    case 0xC77E: goto L_C77E;
+    case 0xC780: goto L_C780;
+    case 0xC782: goto L_C782;
+    case 0xC784: goto L_C784;
+    case 0xC786: goto L_C786;
+    case 0xC788: goto L_C788;
+    case 0xC7AE: goto L_C7AE;
+    case 0xC7B1: goto L_C7B1;
+    case 0xC7B3: goto L_C7B3;
+    case 0xC7B5: goto L_C7B5;
+    case 0xC7B7: goto L_C7B7;
+    case 0xC7B8: goto L_C7B8;
+    case 0xC7BA: goto L_C7BA;
+    case 0xC7BC: goto L_C7BC;
+    case 0xC7BE: goto L_C7BE;
+    case 0xC7C0: goto L_C7C0;
+    case 0xC7C2: goto L_C7C2;
+    case 0xC7C4: goto L_C7C4;
+    case 0xC7C6: goto L_C7C6;
+    case 0xC7C8: goto L_C7C8;
+    case 0xC7C9: goto L_C7C9;
+    case 0xC7CB: goto L_C7CB;
+    case 0xC7CE: goto L_C7CE;
+    case 0xC7CF: goto L_C7CF;
+    case 0xC7D1: goto L_C7D1;
+    case 0xC7D3: goto L_C7D3;
+    case 0xC7D4: goto L_C7D4;
+    case 0xC7D6: goto L_C7D6;
+    case 0xC7D8: goto L_C7D8;
+    case 0xC7D9: goto L_C7D9;
+    case 0xC7DB: goto L_C7DB;
+    case 0xC7DD: goto L_C7DD;
+    case 0xC7DF: goto L_C7DF;
+    case 0xC7E1: goto L_C7E1;
+    case 0xC7E4: goto L_C7E4;
+    case 0xC7E7: goto L_C7E7;
+    case 0xC7EA: goto L_C7EA;
+    case 0xC7ED: goto L_C7ED;
+    case 0xC7EF: goto L_C7EF;
+    case 0xC7F1: goto L_C7F1;
+    case 0xC7F3: goto L_C7F3;
+    case 0xC7F5: goto L_C7F5;
+    case 0xC7F7: goto L_C7F7;
+    case 0xC7F8: goto L_C7F8;
+    case 0xC7F9: goto L_C7F9;
+    case 0xC7FC: goto L_C7FC;
+    case 0xC7FD: goto L_C7FD;
+    case 0xC800: goto L_C800;
+    case 0xC801: goto L_C801;
+    case 0xC804: goto L_C804;
+    case 0xC807: goto L_C807;
+    case 0xC809: goto L_C809;
+    case 0xC80B: goto L_C80B;
+    case 0xC80E: goto L_C80E;
+    case 0xC810: goto L_C810;
+    case 0xC812: goto L_C812;
+    case 0xC815: goto L_C815;
+    case 0xC817: goto L_C817;
+    case 0xC81A: goto L_C81A;
+    case 0xC81D: goto L_C81D;
+    case 0xC81E: goto L_C81E;
+    case 0xC820: goto L_C820;
+    case 0xC822: goto L_C822;
+    case 0xC824: goto L_C824;
+    case 0xC826: goto L_C826;
+    case 0xC827: goto L_C827;
+    case 0xC829: goto L_C829;
+    case 0xC82B: goto L_C82B;
+    case 0xC82C: goto L_C82C;
+    case 0xC82F: goto L_C82F;
+    case 0xC831: goto L_C831;
+    case 0xC832: goto L_C832;
+    case 0xC834: goto L_C834;
+    case 0xC836: goto L_C836;
+    case 0xC838: goto L_C838;
+    case 0xC83A: goto L_C83A;
+    case 0xC83B: goto L_C83B;
+    case 0xC83D: goto L_C83D;
+    case 0xC83F: goto L_C83F;
+    case 0xC841: goto L_C841;
+    case 0xC843: goto L_C843;
+    case 0xC845: goto L_C845;
+    case 0xC847: goto L_C847;
+    case 0xC849: goto L_C849;
+    case 0xC84A: goto L_C84A;
+    case 0xC84B: goto L_C84B;
+    case 0xC84D: goto L_C84D;
+    case 0xC84F: goto L_C84F;
+    case 0xC851: goto L_C851;
+    case 0xC854: goto L_C854;
+    case 0xC857: goto L_C857;
+    case 0xC859: goto L_C859;
+    case 0xC85B: goto L_C85B;
+    case 0xC85D: goto L_C85D;
+    case 0xC85F: goto L_C85F;
+    case 0xC862: goto L_C862;
+    case 0xC864: goto L_C864;
+    case 0xC866: goto L_C866;
+    case 0xC868: goto L_C868;
+    case 0xC86A: goto L_C86A;
+    case 0xC86C: goto L_C86C;
+    case 0xC86E: goto L_C86E;
+    case 0xC870: goto L_C870;
+    case 0xC871: goto L_C871;
+    case 0xC872: goto L_C872;
+    case 0xC874: goto L_C874;
+    case 0xC877: goto L_C877;
+    case 0xC878: goto L_C878;
+    case 0xC87A: goto L_C87A;
+    case 0xC87D: goto L_C87D;
+    case 0xC880: goto L_C880;
+    case 0xC883: goto L_C883;
+    case 0xC885: goto L_C885;
+    case 0xC888: goto L_C888;
+    case 0xC88A: goto L_C88A;
+    case 0xC88B: goto L_C88B;
+    case 0xC88D: goto L_C88D;
+    case 0xC88E: goto L_C88E;
+    case 0xC890: goto L_C890;
+    case 0xC891: goto L_C891;
+    case 0xC893: goto L_C893;
+    case 0xC894: goto L_C894;
+    case 0xC896: goto L_C896;
+    case 0xC897: goto L_C897;
+    case 0xC89A: goto L_C89A;
+    case 0xC89D: goto L_C89D;
+    case 0xC8A0: goto L_C8A0;
+    case 0xC8A3: goto L_C8A3;
+    case 0xC8A6: goto L_C8A6;
+    case 0xC8A7: goto L_C8A7;
+    case 0xC8A9: goto L_C8A9;
+    case 0xC8AB: goto L_C8AB;
+    case 0xC8AD: goto L_C8AD;
+    case 0xC8AF: goto L_C8AF;
+    case 0xC8B1: goto L_C8B1;
+    case 0xC8B2: goto L_C8B2;
+    case 0xC8B3: goto L_C8B3;
+    case 0xC8B5: goto L_C8B5;
+    case 0xC8B7: goto L_C8B7;
+    case 0xC8B9: goto L_C8B9;
+    case 0xC8BA: goto L_C8BA;
+    case 0xC8BC: goto L_C8BC;
+    case 0xC8BE: goto L_C8BE;
+    case 0xC8C0: goto L_C8C0;
+    case 0xC8C3: goto L_C8C3;
+    case 0xC8C5: goto L_C8C5;
+    case 0xC8C7: goto L_C8C7;
+    case 0xC8C9: goto L_C8C9;
+    case 0xC8CB: goto L_C8CB;
+    case 0xC8CD: goto L_C8CD;
+    case 0xC8CF: goto L_C8CF;
+    case 0xC8D1: goto L_C8D1;
+    case 0xC8D2: goto L_C8D2;
+    case 0xC8D4: goto L_C8D4;
+    case 0xC8D6: goto L_C8D6;
+    case 0xC8D8: goto L_C8D8;
+    case 0xC8DB: goto L_C8DB;
+    case 0xC8DC: goto L_C8DC;
+    case 0xC8DE: goto L_C8DE;
+    case 0xC8E0: goto L_C8E0;
+    case 0xC8E2: goto L_C8E2;
+    case 0xC8E3: goto L_C8E3;
+    case 0xC8E5: goto L_C8E5;
+    case 0xC8E8: goto L_C8E8;
+    case 0xC8EB: goto L_C8EB;
+    case 0xC8EC: goto L_C8EC;
+    case 0xC8ED: goto L_C8ED;
+    case 0xC8EF: goto L_C8EF;
+    case 0xC8F0: goto L_C8F0;
+    case 0xC8F2: goto L_C8F2;
+    case 0xC8F3: goto L_C8F3;
+    case 0xC8F5: goto L_C8F5;
+    case 0xC8F6: goto L_C8F6;
+    case 0xC8F8: goto L_C8F8;
+    case 0xC8FB: goto L_C8FB;
+    case 0xC8FC: goto L_C8FC;
+    case 0xC8FD: goto L_C8FD;
+    case 0xC8FF: goto L_C8FF;
+    case 0xC901: goto L_C901;
+    case 0xC903: goto L_C903;
+    case 0xC905: goto L_C905;
+    case 0xC906: goto L_C906;
+    case 0xC908: goto L_C908;
+    case 0xC909: goto L_C909;
+    case 0xC90B: goto L_C90B;
+    case 0xC90D: goto L_C90D;
+    case 0xC90F: goto L_C90F;
+    case 0xC911: goto L_C911;
+    case 0xC913: goto L_C913;
+    case 0xC915: goto L_C915;
+    case 0xC917: goto L_C917;
+    case 0xC919: goto L_C919;
+    case 0xC91B: goto L_C91B;
+    case 0xC91D: goto L_C91D;
+    case 0xC91F: goto L_C91F;
+    case 0xC921: goto L_C921;
+    case 0xC922: goto L_C922;
+    case 0xC924: goto L_C924;
+    case 0xC926: goto L_C926;
+    case 0xC928: goto L_C928;
+    case 0xC92B: goto L_C92B;
+    case 0xC92E: goto L_C92E;
+    case 0xC930: goto L_C930;
+    case 0xC932: goto L_C932;
+    case 0xC934: goto L_C934;
+    case 0xC937: goto L_C937;
+    case 0xC939: goto L_C939;
+    case 0xC93B: goto L_C93B;
+    case 0xC93E: goto L_C93E;
+    case 0xC940: goto L_C940;
+    case 0xC943: goto L_C943;
+    case 0xC945: goto L_C945;
+    case 0xC948: goto L_C948;
+    case 0xC94B: goto L_C94B;
+    case 0xC94E: goto L_C94E;
+    case 0xC94F: goto L_C94F;
+    case 0xC951: goto L_C951;
+    case 0xC953: goto L_C953;
+    case 0xC955: goto L_C955;
+    case 0xC957: goto L_C957;
+    case 0xC959: goto L_C959;
+    case 0xC95B: goto L_C95B;
+    case 0xC95C: goto L_C95C;
+    case 0xC95F: goto L_C95F;
+    case 0xC962: goto L_C962;
+    case 0xC965: goto L_C965;
+    case 0xC967: goto L_C967;
+    case 0xC969: goto L_C969;
+    case 0xC96A: goto L_C96A;
+    case 0xC96B: goto L_C96B;
+    case 0xC96D: goto L_C96D;
+    case 0xC96F: goto L_C96F;
+    case 0xC971: goto L_C971;
+    case 0xC973: goto L_C973;
+    case 0xC975: goto L_C975;
+    case 0xC977: goto L_C977;
+    case 0xC979: goto L_C979;
+    case 0xC97B: goto L_C97B;
+    case 0xC97D: goto L_C97D;
+    case 0xC97F: goto L_C97F;
+    case 0xC981: goto L_C981;
+    case 0xC982: goto L_C982;
+    case 0xC984: goto L_C984;
+    case 0xC985: goto L_C985;
+    case 0xC987: goto L_C987;
+    case 0xC989: goto L_C989;
+    case 0xC98B: goto L_C98B;
+    case 0xC98D: goto L_C98D;
+    case 0xC98F: goto L_C98F;
+    case 0xC991: goto L_C991;
+    case 0xC993: goto L_C993;
+    case 0xC995: goto L_C995;
+    case 0xC997: goto L_C997;
+    case 0xC999: goto L_C999;
+    case 0xC99B: goto L_C99B;
+    case 0xC99D: goto L_C99D;
+    case 0xC99F: goto L_C99F;
+    case 0xC9A2: goto L_C9A2;
+    case 0xC9A5: goto L_C9A5;
+    case 0xC9A8: goto L_C9A8;
+    case 0xC9AA: goto L_C9AA;
+    case 0xC9AC: goto L_C9AC;
+    case 0xC9AE: goto L_C9AE;
+    case 0xC9B1: goto L_C9B1;
+    case 0xC9B3: goto L_C9B3;
+    case 0xC9B4: goto L_C9B4;
+    case 0xC9B6: goto L_C9B6;
+    case 0xC9B7: goto L_C9B7;
+    case 0xC9BA: goto L_C9BA;
+    case 0xC9BB: goto L_C9BB;
+    case 0xC9BC: goto L_C9BC;
+    case 0xC9BF: goto L_C9BF;
+    case 0xC9C1: goto L_C9C1;
+    case 0xC9C2: goto L_C9C2;
+    case 0xC9C4: goto L_C9C4;
+    case 0xC9C7: goto L_C9C7;
+    case 0xC9CA: goto L_C9CA;
+    case 0xC9CC: goto L_C9CC;
+    case 0xC9CE: goto L_C9CE;
+    case 0xC9D0: goto L_C9D0;
+    case 0xC9D1: goto L_C9D1;
+    case 0xC9D3: goto L_C9D3;
+    case 0xC9D5: goto L_C9D5;
+    case 0xC9D6: goto L_C9D6;
+    case 0xC9D9: goto L_C9D9;
+    case 0xC9DA: goto L_C9DA;
+    case 0xC9DC: goto L_C9DC;
+    case 0xC9DE: goto L_C9DE;
+    case 0xC9E0: goto L_C9E0;
+    case 0xC9E3: goto L_C9E3;
+    case 0xC9E5: goto L_C9E5;
+    case 0xC9E7: goto L_C9E7;
+    case 0xC9E9: goto L_C9E9;
+    case 0xC9EB: goto L_C9EB;
+    case 0xC9ED: goto L_C9ED;
+    case 0xC9EF: goto L_C9EF;
+    case 0xC9F2: goto L_C9F2;
+    case 0xC9F5: goto L_C9F5;
+    case 0xC9F7: goto L_C9F7;
+    case 0xC9F9: goto L_C9F9;
+    case 0xC9FC: goto L_C9FC;
+    case 0xC9FF: goto L_C9FF;
+    case 0xCA00: goto L_CA00;
+    case 0xCA02: goto L_CA02;
+    case 0xCA03: goto L_CA03;
+    case 0xCA04: goto L_CA04;
+    case 0xCA07: goto L_CA07;
+    case 0xCA09: goto L_CA09;
+    case 0xCA0A: goto L_CA0A;
+    case 0xCA0C: goto L_CA0C;
+    case 0xCA0E: goto L_CA0E;
+    case 0xCA11: goto L_CA11;
+    case 0xCA14: goto L_CA14;
+    case 0xCA16: goto L_CA16;
+    case 0xCA18: goto L_CA18;
+    case 0xCA1A: goto L_CA1A;
+    case 0xCA1D: goto L_CA1D;
+    case 0xCA1F: goto L_CA1F;
+    case 0xCA22: goto L_CA22;
+    case 0xCA24: goto L_CA24;
+    case 0xCA27: goto L_CA27;
+    case 0xCA29: goto L_CA29;
+    case 0xCA2C: goto L_CA2C;
+    case 0xCA2E: goto L_CA2E;
+    case 0xCA30: goto L_CA30;
+    case 0xCA32: goto L_CA32;
+    case 0xCA34: goto L_CA34;
+    case 0xCA36: goto L_CA36;
+    case 0xCA37: goto L_CA37;
+    case 0xCA39: goto L_CA39;
+    case 0xCA3B: goto L_CA3B;
+    case 0xCA3D: goto L_CA3D;
+    case 0xCA3F: goto L_CA3F;
+    case 0xCA41: goto L_CA41;
+    case 0xCA43: goto L_CA43;
+    case 0xCA45: goto L_CA45;
+    case 0xCA47: goto L_CA47;
+    case 0xCA49: goto L_CA49;
+    case 0xCA4B: goto L_CA4B;
+    case 0xCA4D: goto L_CA4D;
+    case 0xCA4F: goto L_CA4F;
+    case 0xCA52: goto L_CA52;
+    case 0xCA54: goto L_CA54;
+    case 0xCA56: goto L_CA56;
+    case 0xCA59: goto L_CA59;
+    case 0xCA5B: goto L_CA5B;
+    case 0xCA5D: goto L_CA5D;
+    case 0xCA5F: goto L_CA5F;
+    case 0xCA61: goto L_CA61;
+    case 0xCA64: goto L_CA64;
+    case 0xCA66: goto L_CA66;
+    case 0xCA68: goto L_CA68;
+    case 0xCA6A: goto L_CA6A;
+    case 0xCA6C: goto L_CA6C;
+    case 0xCA6F: goto L_CA6F;
+    case 0xCA71: goto L_CA71;
+    case 0xCA73: goto L_CA73;
+    case 0xCA75: goto L_CA75;
+    case 0xCA76: goto L_CA76;
+    case 0xCA78: goto L_CA78;
+    case 0xCA7A: goto L_CA7A;
+    case 0xCA7B: goto L_CA7B;
+    case 0xCA7D: goto L_CA7D;
+    case 0xCA7F: goto L_CA7F;
+    case 0xCA80: goto L_CA80;
+    case 0xCA83: goto L_CA83;
+    case 0xCA86: goto L_CA86;
+    case 0xCA89: goto L_CA89;
+    case 0xCA8B: goto L_CA8B;
+    case 0xCA8D: goto L_CA8D;
+    case 0xCA90: goto L_CA90;
+    case 0xCA91: goto L_CA91;
+    case 0xCA93: goto L_CA93;
+    case 0xCA96: goto L_CA96;
+    case 0xCA97: goto L_CA97;
+    case 0xCA9A: goto L_CA9A;
+    case 0xCA9D: goto L_CA9D;
+    case 0xCAA0: goto L_CAA0;
+    case 0xCAA2: goto L_CAA2;
+    case 0xCAA4: goto L_CAA4;
+    case 0xCAA6: goto L_CAA6;
+    case 0xCAA8: goto L_CAA8;
+    case 0xCAAA: goto L_CAAA;
+    case 0xCAAB: goto L_CAAB;
+    case 0xCAAD: goto L_CAAD;
+    case 0xCAAF: goto L_CAAF;
+    case 0xCAB1: goto L_CAB1;
+    case 0xCAB3: goto L_CAB3;
+    case 0xCAB5: goto L_CAB5;
+    case 0xCAB8: goto L_CAB8;
+    case 0xCABA: goto L_CABA;
+    case 0xCABC: goto L_CABC;
+    case 0xCABF: goto L_CABF;
+    case 0xCAC2: goto L_CAC2;
+    case 0xCAC5: goto L_CAC5;
+    case 0xCAC8: goto L_CAC8;
+    case 0xCACA: goto L_CACA;
+    case 0xCACC: goto L_CACC;
+    case 0xCACF: goto L_CACF;
+    case 0xCAD1: goto L_CAD1;
+    case 0xCAD3: goto L_CAD3;
+    case 0xCAD5: goto L_CAD5;
+    case 0xCAD7: goto L_CAD7;
+    case 0xCAD9: goto L_CAD9;
+    case 0xCADC: goto L_CADC;
+    case 0xCADE: goto L_CADE;
+    case 0xCAE0: goto L_CAE0;
+    case 0xCAE2: goto L_CAE2;
+    case 0xCAE5: goto L_CAE5;
+    case 0xCAE7: goto L_CAE7;
+    case 0xCAE8: goto L_CAE8;
+    case 0xCAE9: goto L_CAE9;
+    case 0xCAEC: goto L_CAEC;
+    case 0xCAED: goto L_CAED;
+    case 0xCAEE: goto L_CAEE;
+    case 0xCAF0: goto L_CAF0;
+    case 0xCAF2: goto L_CAF2;
+    case 0xCAF4: goto L_CAF4;
+    case 0xCAF6: goto L_CAF6;
+    case 0xCAF8: goto L_CAF8;
+    case 0xCAF9: goto L_CAF9;
+    case 0xCAFA: goto L_CAFA;
+    case 0xCAFD: goto L_CAFD;
+    case 0xCAFF: goto L_CAFF;
+    case 0xCB02: goto L_CB02;
+    case 0xCB04: goto L_CB04;
+    case 0xCB06: goto L_CB06;
+    case 0xCB07: goto L_CB07;
+    case 0xCB09: goto L_CB09;
+    case 0xCB0A: goto L_CB0A;
+    case 0xCB0C: goto L_CB0C;
+    case 0xCB0E: goto L_CB0E;
+    case 0xCB0F: goto L_CB0F;
+    case 0xCB10: goto L_CB10;
+    case 0xCB11: goto L_CB11;
+    case 0xCB13: goto L_CB13;
+    case 0xCB16: goto L_CB16;
+    case 0xCB19: goto L_CB19;
+    case 0xCB1C: goto L_CB1C;
+    case 0xCB1E: goto L_CB1E;
+    case 0xCB21: goto L_CB21;
+    case 0xCB24: goto L_CB24;
+    case 0xCB25: goto L_CB25;
+    case 0xCB27: goto L_CB27;
+    case 0xCB28: goto L_CB28;
+    case 0xCB29: goto L_CB29;
+    case 0xCB2B: goto L_CB2B;
+    case 0xCB2D: goto L_CB2D;
+    case 0xCB30: goto L_CB30;
+    case 0xCB31: goto L_CB31;
+    case 0xCB33: goto L_CB33;
+    case 0xCB35: goto L_CB35;
+    case 0xCB38: goto L_CB38;
+    case 0xCB3B: goto L_CB3B;
+    case 0xCB3D: goto L_CB3D;
+    case 0xCB3F: goto L_CB3F;
+    case 0xCB41: goto L_CB41;
+    case 0xCB42: goto L_CB42;
+    case 0xCB44: goto L_CB44;
+    case 0xCB45: goto L_CB45;
+    case 0xCB47: goto L_CB47;
+    case 0xCB4A: goto L_CB4A;
+    case 0xCB4C: goto L_CB4C;
+    case 0xCB4D: goto L_CB4D;
+    case 0xCB4F: goto L_CB4F;
+    case 0xCB51: goto L_CB51;
+    case 0xCB53: goto L_CB53;
+    case 0xCB55: goto L_CB55;
+    case 0xCB57: goto L_CB57;
+    case 0xCB59: goto L_CB59;
+    case 0xCB5B: goto L_CB5B;
+    case 0xCB5D: goto L_CB5D;
+    case 0xCB5F: goto L_CB5F;
+    case 0xCB62: goto L_CB62;
+    case 0xCB64: goto L_CB64;
+    case 0xCB66: goto L_CB66;
+    case 0xCB68: goto L_CB68;
+    case 0xCB6B: goto L_CB6B;
+    case 0xCB6D: goto L_CB6D;
+    case 0xCB6F: goto L_CB6F;
+    case 0xCB72: goto L_CB72;
+    case 0xCB74: goto L_CB74;
+    case 0xCB76: goto L_CB76;
+    case 0xCB78: goto L_CB78;
+    case 0xCB7A: goto L_CB7A;
+    case 0xCB7B: goto L_CB7B;
+    case 0xCB7E: goto L_CB7E;
+    case 0xCB80: goto L_CB80;
+    case 0xCB82: goto L_CB82;
+    case 0xCB85: goto L_CB85;
+    case 0xCB88: goto L_CB88;
+    case 0xCB8A: goto L_CB8A;
+    case 0xCB8D: goto L_CB8D;
+    case 0xCB8F: goto L_CB8F;
+    case 0xCB92: goto L_CB92;
+    case 0xCB94: goto L_CB94;
+    case 0xCB96: goto L_CB96;
+    case 0xCB98: goto L_CB98;
+    case 0xCB9B: goto L_CB9B;
+    case 0xCB9D: goto L_CB9D;
+    case 0xCBA0: goto L_CBA0;
+    case 0xCBA2: goto L_CBA2;
+    case 0xCBA4: goto L_CBA4;
+    case 0xCBA5: goto L_CBA5;
+    case 0xCBA8: goto L_CBA8;
+    case 0xCBAA: goto L_CBAA;
+    case 0xCBAD: goto L_CBAD;
+    case 0xCBAF: goto L_CBAF;
+    case 0xCBB2: goto L_CBB2;
+    case 0xCBB5: goto L_CBB5;
+    case 0xCBB7: goto L_CBB7;
+    case 0xCBBA: goto L_CBBA;
+    case 0xCBBC: goto L_CBBC;
+    case 0xCBBE: goto L_CBBE;
+    case 0xCBBF: goto L_CBBF;
+    case 0xCBC1: goto L_CBC1;
+    case 0xCBC3: goto L_CBC3;
+    case 0xCBC6: goto L_CBC6;
+    case 0xCBC8: goto L_CBC8;
+    case 0xCBCB: goto L_CBCB;
+    case 0xCBCE: goto L_CBCE;
+    case 0xCBD1: goto L_CBD1;
+    case 0xCBD3: goto L_CBD3;
+    case 0xCBD6: goto L_CBD6;
+    case 0xCBD9: goto L_CBD9;
+    case 0xCBDB: goto L_CBDB;
+    case 0xCBDD: goto L_CBDD;
+    case 0xCBE0: goto L_CBE0;
+    case 0xCBE2: goto L_CBE2;
+    case 0xCBE4: goto L_CBE4;
+    case 0xCBE7: goto L_CBE7;
+    case 0xCBEA: goto L_CBEA;
+    case 0xCBED: goto L_CBED;
+    case 0xCBEF: goto L_CBEF;
+    case 0xCBF1: goto L_CBF1;
+    case 0xCBF3: goto L_CBF3;
+    case 0xCBF6: goto L_CBF6;
+    case 0xCBF9: goto L_CBF9;
+    case 0xCBFB: goto L_CBFB;
+    case 0xCBFD: goto L_CBFD;
+    case 0xCC00: goto L_CC00;
+    case 0xCC03: goto L_CC03;
+    case 0xCC06: goto L_CC06;
+    case 0xCC08: goto L_CC08;
+    case 0xCC0A: goto L_CC0A;
+    case 0xCC0C: goto L_CC0C;
+    case 0xCC0D: goto L_CC0D;
+    case 0xCC0F: goto L_CC0F;
+    case 0xCC11: goto L_CC11;
+    case 0xCC13: goto L_CC13;
+    case 0xCC15: goto L_CC15;
+    case 0xCC18: goto L_CC18;
+    case 0xCC1A: goto L_CC1A;
+    case 0xCC1C: goto L_CC1C;
+    case 0xCC1E: goto L_CC1E;
+    case 0xCC20: goto L_CC20;
+    case 0xCC22: goto L_CC22;
+    case 0xCC24: goto L_CC24;
+    case 0xCC26: goto L_CC26;
+    case 0xCC28: goto L_CC28;
+    case 0xCC2A: goto L_CC2A;
+    case 0xCC2C: goto L_CC2C;
+    case 0xCC2F: goto L_CC2F;
+    case 0xCC31: goto L_CC31;
+    case 0xCC33: goto L_CC33;
+    case 0xCC35: goto L_CC35;
+    case 0xCC38: goto L_CC38;
+    case 0xCC3B: goto L_CC3B;
+    case 0xCC3D: goto L_CC3D;
+    case 0xCC3F: goto L_CC3F;
+    case 0xCC41: goto L_CC41;
+    case 0xCC43: goto L_CC43;
+    case 0xCC45: goto L_CC45;
+    case 0xCC47: goto L_CC47;
+    case 0xCC4A: goto L_CC4A;
+    case 0xCC4D: goto L_CC4D;
+    case 0xCC4F: goto L_CC4F;
+    case 0xCC51: goto L_CC51;
+    case 0xCC54: goto L_CC54;
+    case 0xCC56: goto L_CC56;
+    case 0xCC58: goto L_CC58;
+    case 0xCC5A: goto L_CC5A;
+    case 0xCC5C: goto L_CC5C;
+    case 0xCC5D: goto L_CC5D;
+    case 0xCC5F: goto L_CC5F;
+    case 0xCC61: goto L_CC61;
+    case 0xCC63: goto L_CC63;
+    case 0xCC65: goto L_CC65;
+    case 0xCC67: goto L_CC67;
+    case 0xCC69: goto L_CC69;
+    case 0xCC6B: goto L_CC6B;
+    case 0xCC6D: goto L_CC6D;
+    case 0xCC6F: goto L_CC6F;
+    case 0xCC71: goto L_CC71;
+    case 0xCC72: goto L_CC72;
+    case 0xCC74: goto L_CC74;
+    case 0xCC76: goto L_CC76;
+    case 0xCC78: goto L_CC78;
+    case 0xCC7A: goto L_CC7A;
+    case 0xCC7C: goto L_CC7C;
+    case 0xCC7D: goto L_CC7D;
+    case 0xCC80: goto L_CC80;
+    case 0xCC83: goto L_CC83;
+    case 0xCC86: goto L_CC86;
+    case 0xCC89: goto L_CC89;
+    case 0xCC8C: goto L_CC8C;
+    case 0xCC8E: goto L_CC8E;
+    case 0xCC91: goto L_CC91;
+    case 0xCC94: goto L_CC94;
+    case 0xCC96: goto L_CC96;
+    case 0xCC98: goto L_CC98;
+    case 0xCC9A: goto L_CC9A;
+    case 0xCC9D: goto L_CC9D;
+    case 0xCC9F: goto L_CC9F;
+    case 0xCCA1: goto L_CCA1;
+    case 0xCCA3: goto L_CCA3;
+    case 0xCCA5: goto L_CCA5;
+    case 0xCCA7: goto L_CCA7;
+    case 0xCCA9: goto L_CCA9;
+    case 0xCCAB: goto L_CCAB;
+    case 0xCCAD: goto L_CCAD;
+    case 0xCCB0: goto L_CCB0;
+    case 0xCCB2: goto L_CCB2;
+    case 0xCCB5: goto L_CCB5;
+    case 0xCCB8: goto L_CCB8;
+    case 0xCCBB: goto L_CCBB;
+    case 0xCCBC: goto L_CCBC;
+    case 0xCCBD: goto L_CCBD;
+    case 0xCCBF: goto L_CCBF;
+    case 0xCCC1: goto L_CCC1;
+    case 0xCCC2: goto L_CCC2;
+    case 0xCCC4: goto L_CCC4;
+    case 0xCCC6: goto L_CCC6;
+    case 0xCCC7: goto L_CCC7;
+    case 0xCCC9: goto L_CCC9;
+    case 0xCCCB: goto L_CCCB;
+    case 0xCCCC: goto L_CCCC;
+    case 0xCCCE: goto L_CCCE;
+    case 0xCCCF: goto L_CCCF;
+    case 0xCCD1: goto L_CCD1;
+    case 0xCCD4: goto L_CCD4;
+    case 0xCCD7: goto L_CCD7;
+    case 0xCCD8: goto L_CCD8;
+    case 0xCCDA: goto L_CCDA;
+    case 0xCCDC: goto L_CCDC;
+    case 0xCCDF: goto L_CCDF;
+    case 0xCCE1: goto L_CCE1;
+    case 0xCCE3: goto L_CCE3;
+    case 0xCCE5: goto L_CCE5;
+    case 0xCCE7: goto L_CCE7;
+    case 0xCCEA: goto L_CCEA;
+    case 0xCCEC: goto L_CCEC;
+    case 0xCCEE: goto L_CCEE;
+    case 0xCCF0: goto L_CCF0;
+    case 0xCCF2: goto L_CCF2;
+    case 0xCCF4: goto L_CCF4;
+    case 0xCCF6: goto L_CCF6;
+    case 0xCCF8: goto L_CCF8;
+    case 0xCCFB: goto L_CCFB;
+    case 0xCD1E: goto L_CD1E;
+    case 0xCD20: goto L_CD20;
+    case 0xCD22: goto L_CD22;
+    case 0xCD24: goto L_CD24;
+    case 0xCD27: goto L_CD27;
+    case 0xCD29: goto L_CD29;
+    case 0xCD2B: goto L_CD2B;
+    case 0xCD2E: goto L_CD2E;
+    case 0xCD30: goto L_CD30;
+    case 0xCD32: goto L_CD32;
+    case 0xCD35: goto L_CD35;
+    case 0xCD36: goto L_CD36;
+    case 0xCD37: goto L_CD37;
+    case 0xCD38: goto L_CD38;
+    case 0xCD3A: goto L_CD3A;
+    case 0xCD3B: goto L_CD3B;
+    case 0xCD3D: goto L_CD3D;
+    case 0xCD3F: goto L_CD3F;
+    case 0xCD40: goto L_CD40;
+    case 0xCD42: goto L_CD42;
+    case 0xCD45: goto L_CD45;
+    case 0xCD46: goto L_CD46;
+    case 0xCD49: goto L_CD49;
+    case 0xCD4B: goto L_CD4B;
+    case 0xCD4D: goto L_CD4D;
+    case 0xCD4F: goto L_CD4F;
+    case 0xCD52: goto L_CD52;
+    case 0xCD55: goto L_CD55;
+    case 0xCD57: goto L_CD57;
+    case 0xCD5A: goto L_CD5A;
+    case 0xCD5B: goto L_CD5B;
+    case 0xCD5C: goto L_CD5C;
+    case 0xCD5F: goto L_CD5F;
+    case 0xCD61: goto L_CD61;
+    case 0xCD64: goto L_CD64;
+    case 0xCD66: goto L_CD66;
+    case 0xCD69: goto L_CD69;
+    case 0xCD6B: goto L_CD6B;
+    case 0xCD6E: goto L_CD6E;
+    case 0xCD70: goto L_CD70;
+    case 0xCD73: goto L_CD73;
+    case 0xCD75: goto L_CD75;
+    case 0xCD78: goto L_CD78;
+    case 0xCD79: goto L_CD79;
+    case 0xCD7B: goto L_CD7B;
+    case 0xCD7C: goto L_CD7C;
+    case 0xCD7D: goto L_CD7D;
+    case 0xCD80: goto L_CD80;
+    case 0xCD82: goto L_CD82;
+    case 0xCD84: goto L_CD84;
+    case 0xCD87: goto L_CD87;
+    case 0xCD8A: goto L_CD8A;
+    case 0xCD8D: goto L_CD8D;
+    case 0xCD8E: goto L_CD8E;
+    case 0xCD8F: goto L_CD8F;
+    case 0xCD90: goto L_CD90;
+    case 0xCD92: goto L_CD92;
+    case 0xCD94: goto L_CD94;
+    case 0xCD96: goto L_CD96;
+    case 0xCD97: goto L_CD97;
+    case 0xCD99: goto L_CD99;
+    case 0xCD9B: goto L_CD9B;
+    case 0xCD9E: goto L_CD9E;
+    case 0xCDA0: goto L_CDA0;
+    case 0xCDA2: goto L_CDA2;
+    case 0xCDA4: goto L_CDA4;
+    case 0xCDA6: goto L_CDA6;
+    case 0xCDA8: goto L_CDA8;
+    case 0xCDA9: goto L_CDA9;
+    case 0xCDAA: goto L_CDAA;
+    case 0xCDAB: goto L_CDAB;
+    case 0xCDAC: goto L_CDAC;
+    case 0xCDAE: goto L_CDAE;
+    case 0xCDB1: goto L_CDB1;
+    case 0xCDB4: goto L_CDB4;
+    case 0xCDB6: goto L_CDB6;
+    case 0xCDB8: goto L_CDB8;
+    case 0xCDBB: goto L_CDBB;
+    case 0xCDBC: goto L_CDBC;
+    case 0xCDBE: goto L_CDBE;
+    case 0xCDC0: goto L_CDC0;
+    case 0xCDC2: goto L_CDC2;
+    case 0xCDC4: goto L_CDC4;
+    case 0xCDC6: goto L_CDC6;
+    case 0xCDC7: goto L_CDC7;
+    case 0xCDC9: goto L_CDC9;
+    case 0xCDCB: goto L_CDCB;
+    case 0xCDCD: goto L_CDCD;
+    case 0xCDCF: goto L_CDCF;
+    case 0xCDD1: goto L_CDD1;
+    case 0xCDD4: goto L_CDD4;
+    case 0xCDD7: goto L_CDD7;
+    case 0xCDD9: goto L_CDD9;
+    case 0xCDDB: goto L_CDDB;
+    case 0xCDDD: goto L_CDDD;
+    case 0xCDDF: goto L_CDDF;
+    case 0xCDE1: goto L_CDE1;
+    case 0xCDE3: goto L_CDE3;
+    case 0xCDE5: goto L_CDE5;
+    case 0xCDE8: goto L_CDE8;
+    case 0xCDEA: goto L_CDEA;
+    case 0xCDEC: goto L_CDEC;
+    case 0xCDED: goto L_CDED;
+    case 0xCDEF: goto L_CDEF;
+    case 0xCDF0: goto L_CDF0;
+    case 0xCDF1: goto L_CDF1;
+    case 0xCDF4: goto L_CDF4;
+    case 0xCDF6: goto L_CDF6;
+    case 0xCDF9: goto L_CDF9;
+    case 0xCDFA: goto L_CDFA;
+    case 0xCDFD: goto L_CDFD;
+    case 0xCDFE: goto L_CDFE;
+    case 0xCE00: goto L_CE00;
+    case 0xCE02: goto L_CE02;
+    case 0xCE03: goto L_CE03;
+    case 0xCE05: goto L_CE05;
+    case 0xCE07: goto L_CE07;
+    case 0xCE09: goto L_CE09;
+    case 0xCE0A: goto L_CE0A;
+    case 0xCE0B: goto L_CE0B;
+    case 0xCE0D: goto L_CE0D;
+    case 0xCE0F: goto L_CE0F;
+    case 0xCE11: goto L_CE11;
+    case 0xCE13: goto L_CE13;
+    case 0xCE15: goto L_CE15;
+    case 0xCE17: goto L_CE17;
+    case 0xCE19: goto L_CE19;
+    case 0xCE1C: goto L_CE1C;
+    case 0xCE1E: goto L_CE1E;
+    case 0xCE20: goto L_CE20;
+    case 0xCE23: goto L_CE23;
+    case 0xCE24: goto L_CE24;
+    case 0xCE27: goto L_CE27;
+    case 0xCE28: goto L_CE28;
+    case 0xCE2B: goto L_CE2B;
+    case 0xCE2D: goto L_CE2D;
+    case 0xCE30: goto L_CE30;
+    case 0xCE33: goto L_CE33;
+    case 0xCE35: goto L_CE35;
+    case 0xCE38: goto L_CE38;
+    case 0xCE39: goto L_CE39;
+    case 0xCE3A: goto L_CE3A;
+    case 0xCE3C: goto L_CE3C;
+    case 0xCE3E: goto L_CE3E;
+    case 0xCE3F: goto L_CE3F;
+    case 0xCE41: goto L_CE41;
+    case 0xCE42: goto L_CE42;
+    case 0xCE43: goto L_CE43;
+    case 0xCE46: goto L_CE46;
+    case 0xCE48: goto L_CE48;
+    case 0xCE49: goto L_CE49;
+    case 0xCE4B: goto L_CE4B;
+    case 0xCE4C: goto L_CE4C;
+    case 0xCE4E: goto L_CE4E;
+    case 0xCE4F: goto L_CE4F;
+    case 0xCE51: goto L_CE51;
+    case 0xCE52: goto L_CE52;
+    case 0xCE54: goto L_CE54;
+    case 0xCE55: goto L_CE55;
+    case 0xCE58: goto L_CE58;
+    case 0xCE5A: goto L_CE5A;
+    case 0xCE5B: goto L_CE5B;
+    case 0xCE5D: goto L_CE5D;
+    case 0xCE5F: goto L_CE5F;
+    case 0xCE61: goto L_CE61;
+    case 0xCE64: goto L_CE64;
+    case 0xCE66: goto L_CE66;
+    case 0xCE67: goto L_CE67;
+    case 0xCE68: goto L_CE68;
+    case 0xCE6A: goto L_CE6A;
+    case 0xCE6B: goto L_CE6B;
+    case 0xCE6D: goto L_CE6D;
+    case 0xCE6E: goto L_CE6E;
+    case 0xCE70: goto L_CE70;
+    case 0xCE71: goto L_CE71;
+    case 0xCE73: goto L_CE73;
+    case 0xCE74: goto L_CE74;
+    case 0xCE76: goto L_CE76;
+    case 0xCE77: goto L_CE77;
+    case 0xCE79: goto L_CE79;
+    case 0xCE7A: goto L_CE7A;
+    case 0xCE7C: goto L_CE7C;
+    case 0xCE7E: goto L_CE7E;
+    case 0xCE80: goto L_CE80;
+    case 0xCE82: goto L_CE82;
+    case 0xCE83: goto L_CE83;
+    case 0xCE86: goto L_CE86;
+    case 0xCE88: goto L_CE88;
+    case 0xCE8A: goto L_CE8A;
+    case 0xCE8D: goto L_CE8D;
+    case 0xCE8F: goto L_CE8F;
+    case 0xCE92: goto L_CE92;
+    case 0xCE95: goto L_CE95;
+    case 0xCE97: goto L_CE97;
+    case 0xCE9A: goto L_CE9A;
+    case 0xCE9C: goto L_CE9C;
+    case 0xCE9E: goto L_CE9E;
+    case 0xCEA0: goto L_CEA0;
+    case 0xCEA2: goto L_CEA2;
+    case 0xCEA5: goto L_CEA5;
+    case 0xCEAD: goto L_CEAD;
+    case 0xCEAF: goto L_CEAF;
+    case 0xCEB1: goto L_CEB1;
+    case 0xCEB3: goto L_CEB3;
+    case 0xCEB5: goto L_CEB5;
+    case 0xCEB7: goto L_CEB7;
+    case 0xCEB9: goto L_CEB9;
+    case 0xCEBB: goto L_CEBB;
+    case 0xCEBD: goto L_CEBD;
+    case 0xCEBF: goto L_CEBF;
+    case 0xCEC1: goto L_CEC1;
+    case 0xCEC3: goto L_CEC3;
+    case 0xCEC5: goto L_CEC5;
+    case 0xCEC6: goto L_CEC6;
+    case 0xCEC9: goto L_CEC9;
+    case 0xCECC: goto L_CECC;
+    case 0xCECE: goto L_CECE;
+    case 0xCED0: goto L_CED0;
+    case 0xCED2: goto L_CED2;
+    case 0xCED4: goto L_CED4;
+    case 0xCED7: goto L_CED7;
+    case 0xCED9: goto L_CED9;
+    case 0xCEDB: goto L_CEDB;
+    case 0xCEDC: goto L_CEDC;
+    case 0xCEDE: goto L_CEDE;
+    case 0xCEE0: goto L_CEE0;
+    case 0xCEE3: goto L_CEE3;
+    case 0xCEE5: goto L_CEE5;
+    case 0xCEE7: goto L_CEE7;
+    case 0xCEEA: goto L_CEEA;
+    case 0xCEEC: goto L_CEEC;
+    case 0xCEEE: goto L_CEEE;
+    case 0xCEF1: goto L_CEF1;
+    case 0xCEF4: goto L_CEF4;
+    case 0xCEF7: goto L_CEF7;
+    case 0xCEF9: goto L_CEF9;
+    case 0xCEFA: goto L_CEFA;
+    case 0xCEFC: goto L_CEFC;
+    case 0xCEFD: goto L_CEFD;
+    case 0xCEFF: goto L_CEFF;
+    case 0xCF01: goto L_CF01;
+    case 0xCF03: goto L_CF03;
+    case 0xCF05: goto L_CF05;
+    case 0xCF08: goto L_CF08;
+    case 0xCF0A: goto L_CF0A;
+    case 0xCF0D: goto L_CF0D;
+    case 0xCF0F: goto L_CF0F;
+    case 0xCF10: goto L_CF10;
+    case 0xCF11: goto L_CF11;
+    case 0xCF14: goto L_CF14;
+    case 0xCF15: goto L_CF15;
+    case 0xCF17: goto L_CF17;
+    case 0xCF19: goto L_CF19;
+    case 0xCF1B: goto L_CF1B;
+    case 0xCF1D: goto L_CF1D;
+    case 0xCF1F: goto L_CF1F;
+    case 0xCF21: goto L_CF21;
+    case 0xCF23: goto L_CF23;
+    case 0xCF25: goto L_CF25;
+    case 0xCF27: goto L_CF27;
+    case 0xCF28: goto L_CF28;
+    case 0xCF2B: goto L_CF2B;
+    case 0xCF2D: goto L_CF2D;
+    case 0xCF2F: goto L_CF2F;
+    case 0xCF31: goto L_CF31;
+    case 0xCF33: goto L_CF33;
+    case 0xCF35: goto L_CF35;
+    case 0xCF37: goto L_CF37;
+    case 0xCF39: goto L_CF39;
+    case 0xCF3B: goto L_CF3B;
+    case 0xCF3E: goto L_CF3E;
+    case 0xCF40: goto L_CF40;
+    case 0xCF42: goto L_CF42;
+    case 0xCF44: goto L_CF44;
+    case 0xCF46: goto L_CF46;
+    case 0xCF48: goto L_CF48;
+    case 0xCF4B: goto L_CF4B;
+    case 0xCF4D: goto L_CF4D;
+    case 0xCF4E: goto L_CF4E;
+    case 0xCF50: goto L_CF50;
+    case 0xCF52: goto L_CF52;
+    case 0xCF54: goto L_CF54;
+    case 0xCF56: goto L_CF56;
+    case 0xCF59: goto L_CF59;
+    case 0xCF5C: goto L_CF5C;
+    case 0xCF5D: goto L_CF5D;
+    case 0xCF5F: goto L_CF5F;
+    case 0xCF61: goto L_CF61;
+    case 0xCF63: goto L_CF63;
+    case 0xCF65: goto L_CF65;
+    case 0xCF66: goto L_CF66;
+    case 0xCF67: goto L_CF67;
+    case 0xCF69: goto L_CF69;
+    case 0xCF6A: goto L_CF6A;
+    case 0xCF6B: goto L_CF6B;
+    case 0xCF6E: goto L_CF6E;
+    case 0xCF71: goto L_CF71;
+    case 0xCF73: goto L_CF73;
+    case 0xCF75: goto L_CF75;
+    case 0xCF77: goto L_CF77;
+    case 0xCF79: goto L_CF79;
+    case 0xCF7B: goto L_CF7B;
+    case 0xCF7E: goto L_CF7E;
+    case 0xCF7F: goto L_CF7F;
+    case 0xCF81: goto L_CF81;
+    case 0xCF84: goto L_CF84;
+    case 0xCF87: goto L_CF87;
+    case 0xCF89: goto L_CF89;
+    case 0xCF8B: goto L_CF8B;
+    case 0xCF8D: goto L_CF8D;
+    case 0xCF8F: goto L_CF8F;
+    case 0xCF91: goto L_CF91;
+    case 0xCF92: goto L_CF92;
+    case 0xCF94: goto L_CF94;
+    case 0xCF96: goto L_CF96;
+    case 0xCF98: goto L_CF98;
+    case 0xCF9A: goto L_CF9A;
+    case 0xCF9D: goto L_CF9D;
+    case 0xCFA0: goto L_CFA0;
+    case 0xCFA2: goto L_CFA2;
+    case 0xCFA4: goto L_CFA4;
+    case 0xCFA7: goto L_CFA7;
+    case 0xCFA8: goto L_CFA8;
+    case 0xCFA9: goto L_CFA9;
+    case 0xCFAA: goto L_CFAA;
+    case 0xCFAD: goto L_CFAD;
+    case 0xCFAF: goto L_CFAF;
+    case 0xCFB1: goto L_CFB1;
+    case 0xCFB4: goto L_CFB4;
+    case 0xCFB7: goto L_CFB7;
+    case 0xCFBA: goto L_CFBA;
+    case 0xCFBD: goto L_CFBD;
+    case 0xCFBE: goto L_CFBE;
+    case 0xCFBF: goto L_CFBF;
+    case 0xCFC1: goto L_CFC1;
+    case 0xCFC2: goto L_CFC2;
+    case 0xCFC4: goto L_CFC4;
+    case 0xCFC5: goto L_CFC5;
+    case 0xCFC6: goto L_CFC6;
+    case 0xCFC7: goto L_CFC7;
+    case 0xCFCA: goto L_CFCA;
+    case 0xCFCB: goto L_CFCB;
+    case 0xCFCC: goto L_CFCC;
+    case 0xCFCD: goto L_CFCD;
+    case 0xCFCE: goto L_CFCE;
+    case 0xCFD1: goto L_CFD1;
+    case 0xCFD4: goto L_CFD4;
+    case 0xCFD5: goto L_CFD5;
+    case 0xCFD6: goto L_CFD6;
+    case 0xCFD9: goto L_CFD9;
+    case 0xCFDB: goto L_CFDB;
+    case 0xCFDE: goto L_CFDE;
+    case 0xCFE0: goto L_CFE0;
+    case 0xCFE3: goto L_CFE3;
+    case 0xCFE6: goto L_CFE6;
+    case 0xCFE8: goto L_CFE8;
+    case 0xCFE9: goto L_CFE9;
+    case 0xCFEB: goto L_CFEB;
+    case 0xCFED: goto L_CFED;
+    case 0xCFF0: goto L_CFF0;
+    case 0xCFF2: goto L_CFF2;
+    case 0xCFF4: goto L_CFF4;
+    case 0xCFF6: goto L_CFF6;
+    case 0xCFF8: goto L_CFF8;
+    case 0xCFFA: goto L_CFFA;
+    case 0xCFFC: goto L_CFFC;
+    case 0xCFFF: goto L_CFFF;
+    case 0xD002: goto L_D002;
+    case 0xD004: goto L_D004;
+    case 0xD006: goto L_D006;
+    case 0xD008: goto L_D008;
+    case 0xD00A: goto L_D00A;
+    case 0xD00B: goto L_D00B;
+    case 0xD00D: goto L_D00D;
+    case 0xD00F: goto L_D00F;
+    case 0xD011: goto L_D011;
+    case 0xD013: goto L_D013;
+    case 0xD016: goto L_D016;
+    case 0xD019: goto L_D019;
+    case 0xD01B: goto L_D01B;
+    case 0xD01D: goto L_D01D;
+    case 0xD01F: goto L_D01F;
+    case 0xD021: goto L_D021;
+    case 0xD023: goto L_D023;
+    case 0xD025: goto L_D025;
+    case 0xD027: goto L_D027;
+    case 0xD02A: goto L_D02A;
+    case 0xD02B: goto L_D02B;
+    case 0xD02E: goto L_D02E;
+    case 0xD030: goto L_D030;
+    case 0xD032: goto L_D032;
+    case 0xD034: goto L_D034;
+    case 0xD037: goto L_D037;
+    case 0xD039: goto L_D039;
+    case 0xD03B: goto L_D03B;
+    case 0xD03D: goto L_D03D;
+    case 0xD03F: goto L_D03F;
+    case 0xD041: goto L_D041;
+    case 0xD044: goto L_D044;
+    case 0xD046: goto L_D046;
+    case 0xD048: goto L_D048;
+    case 0xD049: goto L_D049;
+    case 0xD04A: goto L_D04A;
+    case 0xD04C: goto L_D04C;
+    case 0xD04E: goto L_D04E;
+    case 0xD050: goto L_D050;
+    case 0xD052: goto L_D052;
+    case 0xD054: goto L_D054;
+    case 0xD056: goto L_D056;
+    case 0xD058: goto L_D058;
+    case 0xD05A: goto L_D05A;
+    case 0xD05B: goto L_D05B;
+    case 0xD05C: goto L_D05C;
+    case 0xD05D: goto L_D05D;
+    case 0xD05F: goto L_D05F;
+    case 0xD061: goto L_D061;
+    case 0xD063: goto L_D063;
+    case 0xD064: goto L_D064;
+    case 0xD066: goto L_D066;
+    case 0xD068: goto L_D068;
+    case 0xD06A: goto L_D06A;
+    case 0xD06C: goto L_D06C;
+    case 0xD06E: goto L_D06E;
+    case 0xD070: goto L_D070;
+    case 0xD072: goto L_D072;
+    case 0xD073: goto L_D073;
+    case 0xD074: goto L_D074;
+    case 0xD075: goto L_D075;
+    case 0xD077: goto L_D077;
+    case 0xD079: goto L_D079;
+    case 0xD07B: goto L_D07B;
+    case 0xD07E: goto L_D07E;
+    case 0xD081: goto L_D081;
+    case 0xD082: goto L_D082;
+    case 0xD085: goto L_D085;
+    case 0xD088: goto L_D088;
+    case 0xD08A: goto L_D08A;
+    case 0xD08B: goto L_D08B;
+    case 0xD08D: goto L_D08D;
+    case 0xD090: goto L_D090;
+    case 0xD092: goto L_D092;
+    case 0xD094: goto L_D094;
+    case 0xD097: goto L_D097;
+    case 0xD09A: goto L_D09A;
+    case 0xD09C: goto L_D09C;
+    case 0xD09F: goto L_D09F;
+    case 0xD0A1: goto L_D0A1;
+    case 0xD0A3: goto L_D0A3;
+    case 0xD0A5: goto L_D0A5;
+    case 0xD0A8: goto L_D0A8;
+    case 0xD0AA: goto L_D0AA;
+    case 0xD0AD: goto L_D0AD;
+    case 0xD0AF: goto L_D0AF;
+    case 0xD0B0: goto L_D0B0;
+    case 0xD0B3: goto L_D0B3;
+    case 0xD0B5: goto L_D0B5;
+    case 0xD0B8: goto L_D0B8;
+    case 0xD0BA: goto L_D0BA;
+    case 0xD0BC: goto L_D0BC;
+    case 0xD0BE: goto L_D0BE;
+    case 0xD0C0: goto L_D0C0;
+    case 0xD0C2: goto L_D0C2;
+    case 0xD0C4: goto L_D0C4;
+    case 0xD0C6: goto L_D0C6;
+    case 0xD0C8: goto L_D0C8;
+    case 0xD0CA: goto L_D0CA;
+    case 0xD0CC: goto L_D0CC;
+    case 0xD0CE: goto L_D0CE;
+    case 0xD0D0: goto L_D0D0;
+    case 0xD0D2: goto L_D0D2;
+    case 0xD0D4: goto L_D0D4;
+    case 0xD0D5: goto L_D0D5;
+    case 0xD0D7: goto L_D0D7;
+    case 0xD0D8: goto L_D0D8;
+    case 0xD0DB: goto L_D0DB;
+    case 0xD0DD: goto L_D0DD;
+    case 0xD0DE: goto L_D0DE;
+    case 0xD0E0: goto L_D0E0;
+    case 0xD0E2: goto L_D0E2;
+    case 0xD0E4: goto L_D0E4;
+    case 0xD0E7: goto L_D0E7;
+    case 0xD0E9: goto L_D0E9;
+    case 0xD0EB: goto L_D0EB;
+    case 0xD0ED: goto L_D0ED;
+    case 0xD0EF: goto L_D0EF;
+    case 0xD0F1: goto L_D0F1;
+    case 0xD0F3: goto L_D0F3;
+    case 0xD0F5: goto L_D0F5;
+    case 0xD0F7: goto L_D0F7;
+    case 0xD0F9: goto L_D0F9;
+    case 0xD0FB: goto L_D0FB;
+    case 0xD0FD: goto L_D0FD;
+    case 0xD0FF: goto L_D0FF;
+    case 0xD101: goto L_D101;
+    case 0xD103: goto L_D103;
+    case 0xD104: goto L_D104;
+    case 0xD106: goto L_D106;
+    case 0xD108: goto L_D108;
+    case 0xD109: goto L_D109;
+    case 0xD10A: goto L_D10A;
+    case 0xD10C: goto L_D10C;
+    case 0xD10E: goto L_D10E;
+    case 0xD110: goto L_D110;
+    case 0xD111: goto L_D111;
+    case 0xD113: goto L_D113;
+    case 0xD115: goto L_D115;
+    case 0xD117: goto L_D117;
+    case 0xD119: goto L_D119;
+    case 0xD11A: goto L_D11A;
+    case 0xD11C: goto L_D11C;
+    case 0xD11D: goto L_D11D;
+    case 0xD11E: goto L_D11E;
+    case 0xD11F: goto L_D11F;
+    case 0xD121: goto L_D121;
+    case 0xD123: goto L_D123;
+    case 0xD125: goto L_D125;
+    case 0xD127: goto L_D127;
+    case 0xD128: goto L_D128;
+    case 0xD12A: goto L_D12A;
+    case 0xD12C: goto L_D12C;
+    case 0xD12E: goto L_D12E;
+    case 0xD130: goto L_D130;
+    case 0xD132: goto L_D132;
+    case 0xD134: goto L_D134;
+    case 0xD136: goto L_D136;
+    case 0xD138: goto L_D138;
+    case 0xD13B: goto L_D13B;
+    case 0xD13D: goto L_D13D;
+    case 0xD13F: goto L_D13F;
+    case 0xD141: goto L_D141;
+    case 0xD143: goto L_D143;
+    case 0xD145: goto L_D145;
+    case 0xD147: goto L_D147;
+    case 0xD149: goto L_D149;
+    case 0xD14B: goto L_D14B;
+    case 0xD14D: goto L_D14D;
+    case 0xD14F: goto L_D14F;
+    case 0xD151: goto L_D151;
+    case 0xD153: goto L_D153;
+    case 0xD154: goto L_D154;
+    case 0xD156: goto L_D156;
+    case 0xD158: goto L_D158;
+    case 0xD159: goto L_D159;
+    case 0xD15B: goto L_D15B;
+    case 0xD15D: goto L_D15D;
+    case 0xD160: goto L_D160;
+    case 0xD162: goto L_D162;
+    case 0xD164: goto L_D164;
+    case 0xD165: goto L_D165;
+    case 0xD167: goto L_D167;
+    case 0xD169: goto L_D169;
+    case 0xD16B: goto L_D16B;
+    case 0xD16D: goto L_D16D;
+    case 0xD16F: goto L_D16F;
+    case 0xD170: goto L_D170;
+    case 0xD172: goto L_D172;
+    case 0xD174: goto L_D174;
+    case 0xD176: goto L_D176;
+    case 0xD177: goto L_D177;
+    case 0xD179: goto L_D179;
+    case 0xD17A: goto L_D17A;
+    case 0xD17C: goto L_D17C;
+    case 0xD17D: goto L_D17D;
+    case 0xD17F: goto L_D17F;
+    case 0xD180: goto L_D180;
+    case 0xD182: goto L_D182;
+    case 0xD183: goto L_D183;
+    case 0xD185: goto L_D185;
+    case 0xD187: goto L_D187;
+    case 0xD188: goto L_D188;
+    case 0xD18A: goto L_D18A;
+    case 0xD18C: goto L_D18C;
+    case 0xD18E: goto L_D18E;
+    case 0xD18F: goto L_D18F;
+    case 0xD191: goto L_D191;
+    case 0xD193: goto L_D193;
+    case 0xD194: goto L_D194;
+    case 0xD196: goto L_D196;
+    case 0xD197: goto L_D197;
+    case 0xD199: goto L_D199;
+    case 0xD19B: goto L_D19B;
+    case 0xD19D: goto L_D19D;
+    case 0xD19F: goto L_D19F;
+    case 0xD1A0: goto L_D1A0;
+    case 0xD1A2: goto L_D1A2;
+    case 0xD1A4: goto L_D1A4;
+    case 0xD1B2: goto L_D1B2;
+    case 0xD1B5: goto L_D1B5;
+    case 0xD1B8: goto L_D1B8;
+    case 0xD1BB: goto L_D1BB;
+    case 0xD1BD: goto L_D1BD;
+    case 0xD1BF: goto L_D1BF;
+    case 0xD1C1: goto L_D1C1;
+    case 0xD1C3: goto L_D1C3;
+    case 0xD1C5: goto L_D1C5;
+    case 0xD1C7: goto L_D1C7;
+    case 0xD1C9: goto L_D1C9;
+    case 0xD1CC: goto L_D1CC;
+    case 0xD1CE: goto L_D1CE;
+    case 0xD1D1: goto L_D1D1;
+    case 0xD1D3: goto L_D1D3;
+    case 0xD1D5: goto L_D1D5;
+    case 0xD1D6: goto L_D1D6;
+    case 0xD1D8: goto L_D1D8;
+    case 0xD1D9: goto L_D1D9;
+    case 0xD1DB: goto L_D1DB;
+    case 0xD1DC: goto L_D1DC;
+    case 0xD1DD: goto L_D1DD;
+    case 0xD1DF: goto L_D1DF;
+    case 0xD1E0: goto L_D1E0;
+    case 0xD1E2: goto L_D1E2;
+    case 0xD1E3: goto L_D1E3;
+    case 0xD1E6: goto L_D1E6;
+    case 0xD1E7: goto L_D1E7;
+    case 0xD1E9: goto L_D1E9;
+    case 0xD1EA: goto L_D1EA;
+    case 0xD1EC: goto L_D1EC;
+    case 0xD1ED: goto L_D1ED;
+    case 0xD1EE: goto L_D1EE;
+    case 0xD1EF: goto L_D1EF;
+    case 0xD1F2: goto L_D1F2;
+    case 0xD1F3: goto L_D1F3;
+    case 0xD1F6: goto L_D1F6;
+    case 0xD1F7: goto L_D1F7;
+    case 0xD1F9: goto L_D1F9;
+    case 0xD1FC: goto L_D1FC;
+    case 0xD1FE: goto L_D1FE;
+    case 0xD201: goto L_D201;
+    case 0xD202: goto L_D202;
+    case 0xD205: goto L_D205;
+    case 0xD207: goto L_D207;
+    case 0xD209: goto L_D209;
+    case 0xD20B: goto L_D20B;
+    case 0xD20E: goto L_D20E;
+    case 0xD20F: goto L_D20F;
+    case 0xD211: goto L_D211;
+    case 0xD212: goto L_D212;
+    case 0xD214: goto L_D214;
+    case 0xD216: goto L_D216;
+    case 0xD218: goto L_D218;
+    case 0xD21A: goto L_D21A;
+    case 0xD21C: goto L_D21C;
+    case 0xD21E: goto L_D21E;
+    case 0xD220: goto L_D220;
+    case 0xD222: goto L_D222;
+    case 0xD224: goto L_D224;
+    case 0xD226: goto L_D226;
+    case 0xD228: goto L_D228;
+    case 0xD22A: goto L_D22A;
+    case 0xD22C: goto L_D22C;
+    case 0xD22D: goto L_D22D;
+    case 0xD22F: goto L_D22F;
+    case 0xD231: goto L_D231;
+    case 0xD233: goto L_D233;
+    case 0xD235: goto L_D235;
+    case 0xD237: goto L_D237;
+    case 0xD238: goto L_D238;
+    case 0xD23A: goto L_D23A;
+    case 0xD23B: goto L_D23B;
+    case 0xD23D: goto L_D23D;
+    case 0xD23E: goto L_D23E;
+    case 0xD23F: goto L_D23F;
+    case 0xD241: goto L_D241;
+    case 0xD243: goto L_D243;
+    case 0xD245: goto L_D245;
+    case 0xD247: goto L_D247;
+    case 0xD248: goto L_D248;
+    case 0xD24A: goto L_D24A;
+    case 0xD24D: goto L_D24D;
+    case 0xD24F: goto L_D24F;
+    case 0xD251: goto L_D251;
+    case 0xD253: goto L_D253;
+    case 0xD256: goto L_D256;
+    case 0xD258: goto L_D258;
+    case 0xD25A: goto L_D25A;
+    case 0xD25C: goto L_D25C;
+    case 0xD25E: goto L_D25E;
+    case 0xD261: goto L_D261;
+    case 0xD264: goto L_D264;
+    case 0xD267: goto L_D267;
+    case 0xD269: goto L_D269;
+    case 0xD26B: goto L_D26B;
+    case 0xD26D: goto L_D26D;
+    case 0xD26F: goto L_D26F;
+    case 0xD271: goto L_D271;
+    case 0xD273: goto L_D273;
+    case 0xD274: goto L_D274;
+    case 0xD275: goto L_D275;
+    case 0xD277: goto L_D277;
+    case 0xD279: goto L_D279;
+    case 0xD27B: goto L_D27B;
+    case 0xD27C: goto L_D27C;
+    case 0xD27D: goto L_D27D;
+    case 0xD27F: goto L_D27F;
+    case 0xD281: goto L_D281;
+    case 0xD282: goto L_D282;
+    case 0xD283: goto L_D283;
+    case 0xD284: goto L_D284;
+    case 0xD286: goto L_D286;
+    case 0xD288: goto L_D288;
+    case 0xD28A: goto L_D28A;
+    case 0xD28C: goto L_D28C;
+    case 0xD28E: goto L_D28E;
+    case 0xD28F: goto L_D28F;
+    case 0xD290: goto L_D290;
+    case 0xD292: goto L_D292;
+    case 0xD293: goto L_D293;
+    case 0xD294: goto L_D294;
+    case 0xD296: goto L_D296;
+    case 0xD297: goto L_D297;
+    case 0xD299: goto L_D299;
+    case 0xD29A: goto L_D29A;
+    case 0xD29B: goto L_D29B;
+    case 0xD29D: goto L_D29D;
+    case 0xD2A0: goto L_D2A0;
+    case 0xD2A2: goto L_D2A2;
+    case 0xD2A4: goto L_D2A4;
+    case 0xD2A6: goto L_D2A6;
+    case 0xD2A8: goto L_D2A8;
+    case 0xD2AA: goto L_D2AA;
+    case 0xD2AC: goto L_D2AC;
+    case 0xD2AE: goto L_D2AE;
+    case 0xD2B0: goto L_D2B0;
+    case 0xD2B1: goto L_D2B1;
+    case 0xD2B2: goto L_D2B2;
+    case 0xD2B4: goto L_D2B4;
+    case 0xD2B6: goto L_D2B6;
+    case 0xD2B7: goto L_D2B7;
+    case 0xD2B9: goto L_D2B9;
+    case 0xD2BC: goto L_D2BC;
+    case 0xD2BE: goto L_D2BE;
+    case 0xD2C0: goto L_D2C0;
+    case 0xD2C2: goto L_D2C2;
+    case 0xD2C4: goto L_D2C4;
+    case 0xD2C6: goto L_D2C6;
+    case 0xD2C8: goto L_D2C8;
+    case 0xD2C9: goto L_D2C9;
+    case 0xD2CB: goto L_D2CB;
+    case 0xD2CD: goto L_D2CD;
+    case 0xD2CF: goto L_D2CF;
+    case 0xD2D1: goto L_D2D1;
+    case 0xD2D3: goto L_D2D3;
+    case 0xD2D5: goto L_D2D5;
+    case 0xD2D6: goto L_D2D6;
+    case 0xD2D8: goto L_D2D8;
+    case 0xD2DA: goto L_D2DA;
+    case 0xD2DC: goto L_D2DC;
+    case 0xD2DE: goto L_D2DE;
+    case 0xD2E0: goto L_D2E0;
+    case 0xD2E1: goto L_D2E1;
+    case 0xD2E3: goto L_D2E3;
+    case 0xD2E5: goto L_D2E5;
+    case 0xD2E7: goto L_D2E7;
+    case 0xD2E9: goto L_D2E9;
+    case 0xD2EA: goto L_D2EA;
+    case 0xD2EC: goto L_D2EC;
+    case 0xD2EE: goto L_D2EE;
+    case 0xD2F0: goto L_D2F0;
+    case 0xD2F2: goto L_D2F2;
+    case 0xD2F4: goto L_D2F4;
+    case 0xD2F5: goto L_D2F5;
+    case 0xD2F6: goto L_D2F6;
+    case 0xD2F7: goto L_D2F7;
+    case 0xD2F9: goto L_D2F9;
+    case 0xD2FA: goto L_D2FA;
+    case 0xD2FC: goto L_D2FC;
+    case 0xD2FE: goto L_D2FE;
+    case 0xD300: goto L_D300;
+    case 0xD302: goto L_D302;
+    case 0xD303: goto L_D303;
+    case 0xD304: goto L_D304;
+    case 0xD306: goto L_D306;
+    case 0xD308: goto L_D308;
+    case 0xD30B: goto L_D30B;
+    case 0xD30E: goto L_D30E;
+    case 0xD30F: goto L_D30F;
+    case 0xD311: goto L_D311;
+    case 0xD313: goto L_D313;
+    case 0xD314: goto L_D314;
+    case 0xD316: goto L_D316;
+    case 0xD319: goto L_D319;
+    case 0xD31A: goto L_D31A;
+    case 0xD31C: goto L_D31C;
+    case 0xD31D: goto L_D31D;
+    case 0xD31E: goto L_D31E;
+    case 0xD320: goto L_D320;
+    case 0xD322: goto L_D322;
+    case 0xD324: goto L_D324;
+    case 0xD326: goto L_D326;
+    case 0xD328: goto L_D328;
+    case 0xD32A: goto L_D32A;
+    case 0xD32C: goto L_D32C;
+    case 0xD32E: goto L_D32E;
+    case 0xD330: goto L_D330;
+    case 0xD331: goto L_D331;
+    case 0xD333: goto L_D333;
+    case 0xD335: goto L_D335;
+    case 0xD336: goto L_D336;
+    case 0xD337: goto L_D337;
+    case 0xD339: goto L_D339;
+    case 0xD33B: goto L_D33B;
+    case 0xD33E: goto L_D33E;
+    case 0xD33F: goto L_D33F;
+    case 0xD341: goto L_D341;
+    case 0xD343: goto L_D343;
+    case 0xD344: goto L_D344;
+    case 0xD346: goto L_D346;
+    case 0xD348: goto L_D348;
+    case 0xD349: goto L_D349;
+    case 0xD34B: goto L_D34B;
+    case 0xD34C: goto L_D34C;
+    case 0xD34E: goto L_D34E;
+    case 0xD350: goto L_D350;
+    case 0xD352: goto L_D352;
+    case 0xD353: goto L_D353;
+    case 0xD355: goto L_D355;
+    case 0xD357: goto L_D357;
+    case 0xD359: goto L_D359;
+    case 0xD35B: goto L_D35B;
+    case 0xD35D: goto L_D35D;
+    case 0xD35F: goto L_D35F;
+    case 0xD360: goto L_D360;
+    case 0xD361: goto L_D361;
+    case 0xD362: goto L_D362;
+    case 0xD363: goto L_D363;
+    case 0xD364: goto L_D364;
+    case 0xD365: goto L_D365;
+    case 0xD367: goto L_D367;
+    case 0xD369: goto L_D369;
+    case 0xD36B: goto L_D36B;
+    case 0xD36D: goto L_D36D;
+    case 0xD36E: goto L_D36E;
+    case 0xD36F: goto L_D36F;
+    case 0xD371: goto L_D371;
+    case 0xD372: goto L_D372;
+    case 0xD373: goto L_D373;
+    case 0xD375: goto L_D375;
+    case 0xD376: goto L_D376;
+    case 0xD378: goto L_D378;
+    case 0xD37A: goto L_D37A;
+    case 0xD37C: goto L_D37C;
+    case 0xD37D: goto L_D37D;
+    case 0xD37F: goto L_D37F;
+    case 0xD381: goto L_D381;
+    case 0xD384: goto L_D384;
+    case 0xD387: goto L_D387;
+    case 0xD388: goto L_D388;
+    case 0xD38A: goto L_D38A;
+    case 0xD38C: goto L_D38C;
+    case 0xD38D: goto L_D38D;
+    case 0xD38F: goto L_D38F;
+    case 0xD391: goto L_D391;
+    case 0xD393: goto L_D393;
+    case 0xD395: goto L_D395;
+    case 0xD397: goto L_D397;
+    case 0xD399: goto L_D399;
+    case 0xD39B: goto L_D39B;
+    case 0xD39E: goto L_D39E;
+    case 0xD39F: goto L_D39F;
+    case 0xD3A2: goto L_D3A2;
+    case 0xD3A4: goto L_D3A4;
+    case 0xD3A6: goto L_D3A6;
+    case 0xD3A8: goto L_D3A8;
+    case 0xD3A9: goto L_D3A9;
+    case 0xD3AB: goto L_D3AB;
+    case 0xD3AD: goto L_D3AD;
+    case 0xD3AE: goto L_D3AE;
+    case 0xD3B0: goto L_D3B0;
+    case 0xD3B3: goto L_D3B3;
+    case 0xD3B6: goto L_D3B6;
+    case 0xD3B9: goto L_D3B9;
+    case 0xD3BC: goto L_D3BC;
+    case 0xD3BE: goto L_D3BE;
+    case 0xD3C0: goto L_D3C0;
+    case 0xD3C3: goto L_D3C3;
+    case 0xD3C6: goto L_D3C6;
+    case 0xD3C9: goto L_D3C9;
+    case 0xD3CB: goto L_D3CB;
+    case 0xD3CE: goto L_D3CE;
+    case 0xD3CF: goto L_D3CF;
+    case 0xD3D1: goto L_D3D1;
+    case 0xD3D2: goto L_D3D2;
+    case 0xD3D4: goto L_D3D4;
+    case 0xD3D5: goto L_D3D5;
+    case 0xD3D7: goto L_D3D7;
+    case 0xD3D8: goto L_D3D8;
+    case 0xD3DA: goto L_D3DA;
+    case 0xD3DB: goto L_D3DB;
+    case 0xD3DE: goto L_D3DE;
+    case 0xD3E1: goto L_D3E1;
+    case 0xD3E3: goto L_D3E3;
+    case 0xD3E6: goto L_D3E6;
+    case 0xD3E8: goto L_D3E8;
+    case 0xD3EA: goto L_D3EA;
+    case 0xD3ED: goto L_D3ED;
+    case 0xD3EF: goto L_D3EF;
+    case 0xD3F1: goto L_D3F1;
+    case 0xD3F4: goto L_D3F4;
+    case 0xD3F7: goto L_D3F7;
+    case 0xD3F9: goto L_D3F9;
+    case 0xD3FA: goto L_D3FA;
+    case 0xD3FC: goto L_D3FC;
+    case 0xD3FD: goto L_D3FD;
+    case 0xD400: goto L_D400;
+    case 0xD403: goto L_D403;
+    case 0xD404: goto L_D404;
+    case 0xD406: goto L_D406;
+    case 0xD407: goto L_D407;
+    case 0xD409: goto L_D409;
+    case 0xD40B: goto L_D40B;
+    case 0xD40D: goto L_D40D;
+    case 0xD40F: goto L_D40F;
+    case 0xD410: goto L_D410;
+    case 0xD411: goto L_D411;
+    case 0xD413: goto L_D413;
+    case 0xD415: goto L_D415;
+    case 0xD417: goto L_D417;
+    case 0xD418: goto L_D418;
+    case 0xD41A: goto L_D41A;
+    case 0xD41B: goto L_D41B;
+    case 0xD41C: goto L_D41C;
+    case 0xD41E: goto L_D41E;
+    case 0xD420: goto L_D420;
+    case 0xD423: goto L_D423;
+    case 0xD425: goto L_D425;
+    case 0xD426: goto L_D426;
+    case 0xD428: goto L_D428;
+    case 0xD429: goto L_D429;
+    case 0xD42B: goto L_D42B;
+    case 0xD42D: goto L_D42D;
+    case 0xD42E: goto L_D42E;
+    case 0xD430: goto L_D430;
+    case 0xD432: goto L_D432;
+    case 0xD434: goto L_D434;
+    case 0xD435: goto L_D435;
+    case 0xD437: goto L_D437;
+    case 0xD438: goto L_D438;
+    case 0xD43B: goto L_D43B;
+    case 0xD43C: goto L_D43C;
+    case 0xD43E: goto L_D43E;
+    case 0xD43F: goto L_D43F;
+    case 0xD441: goto L_D441;
+    case 0xD444: goto L_D444;
+    case 0xD446: goto L_D446;
+    case 0xD449: goto L_D449;
+    case 0xD44A: goto L_D44A;
+    case 0xD44C: goto L_D44C;
+    case 0xD44D: goto L_D44D;
+    case 0xD44F: goto L_D44F;
+    case 0xD451: goto L_D451;
+    case 0xD452: goto L_D452;
+    case 0xD454: goto L_D454;
+    case 0xD455: goto L_D455;
+    case 0xD456: goto L_D456;
+    case 0xD458: goto L_D458;
+    case 0xD459: goto L_D459;
+    case 0xD45A: goto L_D45A;
+    case 0xD45C: goto L_D45C;
+    case 0xD45D: goto L_D45D;
+    case 0xD45E: goto L_D45E;
+    case 0xD460: goto L_D460;
+    case 0xD461: goto L_D461;
+    case 0xD462: goto L_D462;
+    case 0xD464: goto L_D464;
+    case 0xD465: goto L_D465;
+    case 0xD468: goto L_D468;
+    case 0xD46A: goto L_D46A;
+    case 0xD46D: goto L_D46D;
+    case 0xD46E: goto L_D46E;
+    case 0xD46F: goto L_D46F;
+    case 0xD471: goto L_D471;
+    case 0xD473: goto L_D473;
+    case 0xD475: goto L_D475;
+    case 0xD477: goto L_D477;
+    case 0xD479: goto L_D479;
+    case 0xD47B: goto L_D47B;
+    case 0xD47D: goto L_D47D;
+    case 0xD480: goto L_D480;
+    case 0xD482: goto L_D482;
+    case 0xD484: goto L_D484;
+    case 0xD486: goto L_D486;
+    case 0xD487: goto L_D487;
+    case 0xD489: goto L_D489;
+    case 0xD48B: goto L_D48B;
+    case 0xD48D: goto L_D48D;
+    case 0xD48F: goto L_D48F;
+    case 0xD491: goto L_D491;
+    case 0xD493: goto L_D493;
+    case 0xD495: goto L_D495;
+    case 0xD497: goto L_D497;
+    case 0xD498: goto L_D498;
+    case 0xD49A: goto L_D49A;
+    case 0xD49C: goto L_D49C;
+    case 0xD49E: goto L_D49E;
+    case 0xD4A0: goto L_D4A0;
+    case 0xD4A2: goto L_D4A2;
+    case 0xD4A4: goto L_D4A4;
+    case 0xD4A6: goto L_D4A6;
+    case 0xD4A8: goto L_D4A8;
+    case 0xD4A9: goto L_D4A9;
+    case 0xD4AB: goto L_D4AB;
+    case 0xD4AC: goto L_D4AC;
+    case 0xD4AE: goto L_D4AE;
+    case 0xD4B0: goto L_D4B0;
+    case 0xD4B2: goto L_D4B2;
+    case 0xD4B4: goto L_D4B4;
+    case 0xD4B5: goto L_D4B5;
+    case 0xD4B7: goto L_D4B7;
+    case 0xD4B9: goto L_D4B9;
+    case 0xD4BB: goto L_D4BB;
+    case 0xD4BD: goto L_D4BD;
+    case 0xD4BF: goto L_D4BF;
+    case 0xD4C0: goto L_D4C0;
+    case 0xD4C3: goto L_D4C3;
+    case 0xD4C5: goto L_D4C5;
+    case 0xD4C7: goto L_D4C7;
+    case 0xD4CA: goto L_D4CA;
+    case 0xD4CC: goto L_D4CC;
+    case 0xD4CE: goto L_D4CE;
+    case 0xD4D0: goto L_D4D0;
+    case 0xD4D2: goto L_D4D2;
+    case 0xD4D5: goto L_D4D5;
+    case 0xD4D7: goto L_D4D7;
+    case 0xD4D9: goto L_D4D9;
+    case 0xD4DB: goto L_D4DB;
+    case 0xD4DD: goto L_D4DD;
+    case 0xD4DF: goto L_D4DF;
+    case 0xD4E1: goto L_D4E1;
+    case 0xD4E3: goto L_D4E3;
+    case 0xD4E5: goto L_D4E5;
+    case 0xD4E7: goto L_D4E7;
+    case 0xD4E9: goto L_D4E9;
+    case 0xD4EA: goto L_D4EA;
+    case 0xD4EC: goto L_D4EC;
+    case 0xD4EE: goto L_D4EE;
+    case 0xD4EF: goto L_D4EF;
+    case 0xD4F0: goto L_D4F0;
+    case 0xD4F1: goto L_D4F1;
+    case 0xD4F3: goto L_D4F3;
+    case 0xD4F4: goto L_D4F4;
+    case 0xD4F6: goto L_D4F6;
+    case 0xD4F7: goto L_D4F7;
+    case 0xD4F9: goto L_D4F9;
+    case 0xD4FA: goto L_D4FA;
+    case 0xD4FC: goto L_D4FC;
+    case 0xD4FE: goto L_D4FE;
+    case 0xD500: goto L_D500;
+    case 0xD501: goto L_D501;
+    case 0xD503: goto L_D503;
+    case 0xD505: goto L_D505;
+    case 0xD507: goto L_D507;
+    case 0xD509: goto L_D509;
+    case 0xD50B: goto L_D50B;
+    case 0xD50D: goto L_D50D;
+    case 0xD50F: goto L_D50F;
+    case 0xD511: goto L_D511;
+    case 0xD513: goto L_D513;
+    case 0xD514: goto L_D514;
+    case 0xD515: goto L_D515;
+    case 0xD516: goto L_D516;
+    case 0xD518: goto L_D518;
+    case 0xD51A: goto L_D51A;
+    case 0xD51C: goto L_D51C;
+    case 0xD51F: goto L_D51F;
+    case 0xD521: goto L_D521;
+    case 0xD523: goto L_D523;
+    case 0xD524: goto L_D524;
+    case 0xD526: goto L_D526;
+    case 0xD528: goto L_D528;
+    case 0xD52A: goto L_D52A;
+    case 0xD52C: goto L_D52C;
+    case 0xD52E: goto L_D52E;
+    case 0xD530: goto L_D530;
+    case 0xD532: goto L_D532;
+    case 0xD534: goto L_D534;
+    case 0xD536: goto L_D536;
+    case 0xD538: goto L_D538;
+    case 0xD53A: goto L_D53A;
+    case 0xD53C: goto L_D53C;
+    case 0xD53E: goto L_D53E;
+    case 0xD540: goto L_D540;
+    case 0xD542: goto L_D542;
+    case 0xD544: goto L_D544;
+    case 0xD546: goto L_D546;
+    case 0xD548: goto L_D548;
+    case 0xD54B: goto L_D54B;
+    case 0xD54D: goto L_D54D;
+    case 0xD54F: goto L_D54F;
+    case 0xD551: goto L_D551;
+    case 0xD553: goto L_D553;
+    case 0xD555: goto L_D555;
+    case 0xD557: goto L_D557;
+    case 0xD559: goto L_D559;
+    case 0xD55B: goto L_D55B;
+    case 0xD55D: goto L_D55D;
+    case 0xD55F: goto L_D55F;
+    case 0xD561: goto L_D561;
+    case 0xD564: goto L_D564;
+    case 0xD566: goto L_D566;
+    case 0xD568: goto L_D568;
+    case 0xD56A: goto L_D56A;
+    case 0xD56C: goto L_D56C;
+    case 0xD56E: goto L_D56E;
+    case 0xD570: goto L_D570;
+    case 0xD572: goto L_D572;
+    case 0xD574: goto L_D574;
+    case 0xD576: goto L_D576;
+    case 0xD578: goto L_D578;
+    case 0xD57A: goto L_D57A;
+    case 0xD57D: goto L_D57D;
+    case 0xD57F: goto L_D57F;
+    case 0xD581: goto L_D581;
+    case 0xD583: goto L_D583;
+    case 0xD585: goto L_D585;
+    case 0xD586: goto L_D586;
+    case 0xD587: goto L_D587;
+    case 0xD589: goto L_D589;
+    case 0xD58A: goto L_D58A;
+    case 0xD58B: goto L_D58B;
+    case 0xD58D: goto L_D58D;
+    case 0xD58F: goto L_D58F;
+    case 0xD591: goto L_D591;
+    case 0xD592: goto L_D592;
+    case 0xD594: goto L_D594;
+    case 0xD596: goto L_D596;
+    case 0xD598: goto L_D598;
+    case 0xD599: goto L_D599;
+    case 0xD59B: goto L_D59B;
+    case 0xD59C: goto L_D59C;
+    case 0xD59E: goto L_D59E;
+    case 0xD59F: goto L_D59F;
+    case 0xD5A1: goto L_D5A1;
+    case 0xD5A3: goto L_D5A3;
+    case 0xD5A4: goto L_D5A4;
+    case 0xD5A6: goto L_D5A6;
+    case 0xD5A8: goto L_D5A8;
+    case 0xD5AA: goto L_D5AA;
+    case 0xD5AC: goto L_D5AC;
+    case 0xD5AE: goto L_D5AE;
+    case 0xD5B0: goto L_D5B0;
+    case 0xD5B2: goto L_D5B2;
+    case 0xD5B4: goto L_D5B4;
+    case 0xD5B6: goto L_D5B6;
+    case 0xD5B8: goto L_D5B8;
+    case 0xD5BB: goto L_D5BB;
+    case 0xD5BD: goto L_D5BD;
+    case 0xD5BF: goto L_D5BF;
+    case 0xD5C1: goto L_D5C1;
+    case 0xD5C2: goto L_D5C2;
+    case 0xD5C4: goto L_D5C4;
+    case 0xD5C6: goto L_D5C6;
+    case 0xD5C7: goto L_D5C7;
+    case 0xD5C9: goto L_D5C9;
+    case 0xD5CB: goto L_D5CB;
+    case 0xD5CC: goto L_D5CC;
+    case 0xD5CE: goto L_D5CE;
+    case 0xD5CF: goto L_D5CF;
+    case 0xD5D0: goto L_D5D0;
+    case 0xD5D2: goto L_D5D2;
+    case 0xD5D4: goto L_D5D4;
+    case 0xD5D6: goto L_D5D6;
+    case 0xD5D8: goto L_D5D8;
+    case 0xD5DA: goto L_D5DA;
+    case 0xD5DC: goto L_D5DC;
+    case 0xD5DE: goto L_D5DE;
+    case 0xD5E0: goto L_D5E0;
+    case 0xD5E2: goto L_D5E2;
+    case 0xD5E4: goto L_D5E4;
+    case 0xD5E6: goto L_D5E6;
+    case 0xD5E8: goto L_D5E8;
+    case 0xD5EA: goto L_D5EA;
+    case 0xD5EC: goto L_D5EC;
+    case 0xD5EE: goto L_D5EE;
+    case 0xD5F0: goto L_D5F0;
+    case 0xD5F2: goto L_D5F2;
+    case 0xD5F4: goto L_D5F4;
+    case 0xD5F6: goto L_D5F6;
+    case 0xD5F8: goto L_D5F8;
+    case 0xD5F9: goto L_D5F9;
+    case 0xD5FB: goto L_D5FB;
+    case 0xD5FD: goto L_D5FD;
+    case 0xD5FF: goto L_D5FF;
+    case 0xD601: goto L_D601;
+    case 0xD603: goto L_D603;
+    case 0xD605: goto L_D605;
+    case 0xD606: goto L_D606;
+    case 0xD608: goto L_D608;
+    case 0xD60A: goto L_D60A;
+    case 0xD60C: goto L_D60C;
+    case 0xD60E: goto L_D60E;
+    case 0xD610: goto L_D610;
+    case 0xD611: goto L_D611;
+    case 0xD612: goto L_D612;
+    case 0xD614: goto L_D614;
+    case 0xD616: goto L_D616;
+    case 0xD618: goto L_D618;
+    case 0xD61A: goto L_D61A;
+    case 0xD61C: goto L_D61C;
+    case 0xD61E: goto L_D61E;
+    case 0xD620: goto L_D620;
+    case 0xD622: goto L_D622;
+    case 0xD624: goto L_D624;
+    case 0xD626: goto L_D626;
+    case 0xD628: goto L_D628;
+    case 0xD62B: goto L_D62B;
+    case 0xD62D: goto L_D62D;
+    case 0xD62E: goto L_D62E;
+    case 0xD630: goto L_D630;
+    case 0xD632: goto L_D632;
+    case 0xD633: goto L_D633;
+    case 0xD635: goto L_D635;
+    case 0xD637: goto L_D637;
+    case 0xD638: goto L_D638;
+    case 0xD63A: goto L_D63A;
+    case 0xD63D: goto L_D63D;
+    case 0xD63F: goto L_D63F;
+    case 0xD640: goto L_D640;
+    case 0xD642: goto L_D642;
+    case 0xD643: goto L_D643;
+    case 0xD646: goto L_D646;
+    case 0xD649: goto L_D649;
+    case 0xD64A: goto L_D64A;
+    case 0xD64C: goto L_D64C;
+    case 0xD64D: goto L_D64D;
+    case 0xD64F: goto L_D64F;
+    case 0xD651: goto L_D651;
+    case 0xD653: goto L_D653;
+    case 0xD654: goto L_D654;
+    case 0xD656: goto L_D656;
+    case 0xD658: goto L_D658;
+    case 0xD65A: goto L_D65A;
+    case 0xD65D: goto L_D65D;
+    case 0xD660: goto L_D660;
+    case 0xD663: goto L_D663;
+    case 0xD665: goto L_D665;
+    case 0xD667: goto L_D667;
+    case 0xD66A: goto L_D66A;
+    case 0xD66D: goto L_D66D;
+    case 0xD66F: goto L_D66F;
+    case 0xD671: goto L_D671;
+    case 0xD674: goto L_D674;
+    case 0xD677: goto L_D677;
+    case 0xD67A: goto L_D67A;
+    case 0xD67C: goto L_D67C;
+    case 0xD67E: goto L_D67E;
+    case 0xD67F: goto L_D67F;
+    case 0xD680: goto L_D680;
+    case 0xD682: goto L_D682;
+    case 0xD683: goto L_D683;
+    case 0xD684: goto L_D684;
+    case 0xD686: goto L_D686;
+    case 0xD687: goto L_D687;
+    case 0xD688: goto L_D688;
+    case 0xD68A: goto L_D68A;
+    case 0xD68C: goto L_D68C;
+    case 0xD68D: goto L_D68D;
+    case 0xD68F: goto L_D68F;
+    case 0xD690: goto L_D690;
+    case 0xD691: goto L_D691;
+    case 0xD693: goto L_D693;
+    case 0xD695: goto L_D695;
+    case 0xD696: goto L_D696;
+    case 0xD698: goto L_D698;
+    case 0xD699: goto L_D699;
+    case 0xD69A: goto L_D69A;
+    case 0xD69C: goto L_D69C;
+    case 0xD69E: goto L_D69E;
+    case 0xD6A0: goto L_D6A0;
+    case 0xD6A2: goto L_D6A2;
+    case 0xD6A3: goto L_D6A3;
+    case 0xD6A6: goto L_D6A6;
+    case 0xD6A8: goto L_D6A8;
+    case 0xD6AA: goto L_D6AA;
+    case 0xD6AC: goto L_D6AC;
+    case 0xD6AE: goto L_D6AE;
+    case 0xD6B1: goto L_D6B1;
+    case 0xD6B2: goto L_D6B2;
+    case 0xD6B4: goto L_D6B4;
+    case 0xD6B6: goto L_D6B6;
+    case 0xD6B7: goto L_D6B7;
+    case 0xD6B8: goto L_D6B8;
+    case 0xD6BA: goto L_D6BA;
+    case 0xD6BB: goto L_D6BB;
+    case 0xD6BC: goto L_D6BC;
+    case 0xD6BE: goto L_D6BE;
+    case 0xD6BF: goto L_D6BF;
+    case 0xD6C0: goto L_D6C0;
+    case 0xD6C1: goto L_D6C1;
+    case 0xD6C3: goto L_D6C3;
+    case 0xD6C5: goto L_D6C5;
+    case 0xD6C7: goto L_D6C7;
+    case 0xD6C9: goto L_D6C9;
+    case 0xD6CB: goto L_D6CB;
+    case 0xD6CC: goto L_D6CC;
+    case 0xD6CD: goto L_D6CD;
+    case 0xD6CF: goto L_D6CF;
+    case 0xD6D1: goto L_D6D1;
+    case 0xD6D3: goto L_D6D3;
+    case 0xD6D5: goto L_D6D5;
+    case 0xD6D6: goto L_D6D6;
+    case 0xD6D8: goto L_D6D8;
+    case 0xD6DA: goto L_D6DA;
+    case 0xD6DB: goto L_D6DB;
+    case 0xD6DD: goto L_D6DD;
+    case 0xD6DF: goto L_D6DF;
+    case 0xD6E1: goto L_D6E1;
+    case 0xD6E3: goto L_D6E3;
+    case 0xD6E5: goto L_D6E5;
+    case 0xD6E7: goto L_D6E7;
+    case 0xD6E9: goto L_D6E9;
+    case 0xD6EB: goto L_D6EB;
+    case 0xD6EC: goto L_D6EC;
+    case 0xD6EF: goto L_D6EF;
+    case 0xD6F0: goto L_D6F0;
+    case 0xD6F1: goto L_D6F1;
+    case 0xD6F3: goto L_D6F3;
+    case 0xD6F6: goto L_D6F6;
+    case 0xD6F7: goto L_D6F7;
+    case 0xD6F9: goto L_D6F9;
+    case 0xD6FB: goto L_D6FB;
+    case 0xD6FC: goto L_D6FC;
+    case 0xD6FD: goto L_D6FD;
+    case 0xD700: goto L_D700;
+    case 0xD703: goto L_D703;
+    case 0xD705: goto L_D705;
+    case 0xD706: goto L_D706;
+    case 0xD708: goto L_D708;
+    case 0xD70A: goto L_D70A;
+    case 0xD70B: goto L_D70B;
+    case 0xD70C: goto L_D70C;
+    case 0xD70D: goto L_D70D;
+    case 0xD70E: goto L_D70E;
+    case 0xD70F: goto L_D70F;
+    case 0xD712: goto L_D712;
+    case 0xD714: goto L_D714;
+    case 0xD716: goto L_D716;
+    case 0xD719: goto L_D719;
+    case 0xD71A: goto L_D71A;
+    case 0xD71B: goto L_D71B;
+    case 0xD71C: goto L_D71C;
+    case 0xD71D: goto L_D71D;
+    case 0xD71F: goto L_D71F;
+    case 0xD721: goto L_D721;
+    case 0xD723: goto L_D723;
+    case 0xD725: goto L_D725;
+    case 0xD726: goto L_D726;
+    case 0xD729: goto L_D729;
+    case 0xD72C: goto L_D72C;
+    case 0xD72F: goto L_D72F;
+    case 0xD730: goto L_D730;
+    case 0xD732: goto L_D732;
+    case 0xD734: goto L_D734;
+    case 0xD737: goto L_D737;
+    case 0xD739: goto L_D739;
+    case 0xD73B: goto L_D73B;
+    case 0xD73E: goto L_D73E;
+    case 0xD740: goto L_D740;
+    case 0xD742: goto L_D742;
+    case 0xD745: goto L_D745;
+    case 0xD748: goto L_D748;
+    case 0xD74B: goto L_D74B;
+    case 0xD74D: goto L_D74D;
+    case 0xD74E: goto L_D74E;
+    case 0xD74F: goto L_D74F;
+    case 0xD750: goto L_D750;
+    case 0xD751: goto L_D751;
+    case 0xD753: goto L_D753;
+    case 0xD755: goto L_D755;
+    case 0xD757: goto L_D757;
+    case 0xD759: goto L_D759;
+    case 0xD75B: goto L_D75B;
+    case 0xD75D: goto L_D75D;
+    case 0xD75F: goto L_D75F;
+    case 0xD761: goto L_D761;
+    case 0xD764: goto L_D764;
+    case 0xD765: goto L_D765;
+    case 0xD766: goto L_D766;
+    case 0xD767: goto L_D767;
+    case 0xD769: goto L_D769;
+    case 0xD76A: goto L_D76A;
+    case 0xD76B: goto L_D76B;
+    case 0xD76C: goto L_D76C;
+    case 0xD76D: goto L_D76D;
+    case 0xD76E: goto L_D76E;
+    case 0xD770: goto L_D770;
+    case 0xD771: goto L_D771;
+    case 0xD773: goto L_D773;
+    case 0xD775: goto L_D775;
+    case 0xD776: goto L_D776;
+    case 0xD777: goto L_D777;
+    case 0xD778: goto L_D778;
+    case 0xD77A: goto L_D77A;
+    case 0xD77B: goto L_D77B;
+    case 0xD77C: goto L_D77C;
+    case 0xD77F: goto L_D77F;
+    case 0xD782: goto L_D782;
+    case 0xD785: goto L_D785;
+    case 0xD787: goto L_D787;
+    case 0xD789: goto L_D789;
+    case 0xD78A: goto L_D78A;
+    case 0xD78B: goto L_D78B;
+    case 0xD78E: goto L_D78E;
+    case 0xD790: goto L_D790;
+    case 0xD792: goto L_D792;
+    case 0xD794: goto L_D794;
+    case 0xD795: goto L_D795;
+    case 0xD798: goto L_D798;
+    case 0xD79B: goto L_D79B;
+    case 0xD79E: goto L_D79E;
+    case 0xD7A1: goto L_D7A1;
+    case 0xD7A4: goto L_D7A4;
+    case 0xD7A6: goto L_D7A6;
+    case 0xD7A8: goto L_D7A8;
+    case 0xD7AA: goto L_D7AA;
+    case 0xD7AD: goto L_D7AD;
+    case 0xD7B0: goto L_D7B0;
+    case 0xD7B2: goto L_D7B2;
+    case 0xD7B5: goto L_D7B5;
+    case 0xD7B7: goto L_D7B7;
+    case 0xD7B9: goto L_D7B9;
+    case 0xD7BB: goto L_D7BB;
+    case 0xD7BD: goto L_D7BD;
+    case 0xD7BF: goto L_D7BF;
+    case 0xD7C1: goto L_D7C1;
+    case 0xD7C2: goto L_D7C2;
+    case 0xD7C4: goto L_D7C4;
+    case 0xD7C6: goto L_D7C6;
+    case 0xD7C8: goto L_D7C8;
+    case 0xD7CA: goto L_D7CA;
+    case 0xD7CC: goto L_D7CC;
+    case 0xD7CD: goto L_D7CD;
+    case 0xD7CF: goto L_D7CF;
+    case 0xD7D1: goto L_D7D1;
+    case 0xD7D3: goto L_D7D3;
+    case 0xD7D4: goto L_D7D4;
+    case 0xD7D5: goto L_D7D5;
+    case 0xD7D7: goto L_D7D7;
+    case 0xD7DA: goto L_D7DA;
+    case 0xD7DD: goto L_D7DD;
+    case 0xD7DE: goto L_D7DE;
+    case 0xD7E0: goto L_D7E0;
+    case 0xD7E2: goto L_D7E2;
+    case 0xD7E4: goto L_D7E4;
+    case 0xD7E6: goto L_D7E6;
+    case 0xD7E8: goto L_D7E8;
+    case 0xD7EA: goto L_D7EA;
+    case 0xD7EB: goto L_D7EB;
+    case 0xD7EE: goto L_D7EE;
+    case 0xD7F1: goto L_D7F1;
+    case 0xD7F4: goto L_D7F4;
+    case 0xD7F7: goto L_D7F7;
+    case 0xD7F9: goto L_D7F9;
+    case 0xD7FB: goto L_D7FB;
+    case 0xD7FD: goto L_D7FD;
+    case 0xD7FF: goto L_D7FF;
+    case 0xD801: goto L_D801;
+    case 0xD804: goto L_D804;
+    case 0xD806: goto L_D806;
+    case 0xD808: goto L_D808;
+    case 0xD80A: goto L_D80A;
+    case 0xD80C: goto L_D80C;
+    case 0xD80D: goto L_D80D;
+    case 0xD80F: goto L_D80F;
+    case 0xD810: goto L_D810;
+    case 0xD812: goto L_D812;
+    case 0xD813: goto L_D813;
+    case 0xD816: goto L_D816;
+    case 0xD818: goto L_D818;
+    case 0xD81A: goto L_D81A;
+    case 0xD81B: goto L_D81B;
+    case 0xD81C: goto L_D81C;
+    case 0xD81E: goto L_D81E;
+    case 0xD81F: goto L_D81F;
+    case 0xD821: goto L_D821;
+    case 0xD824: goto L_D824;
+    case 0xD827: goto L_D827;
+    case 0xD828: goto L_D828;
+    case 0xD82A: goto L_D82A;
+    case 0xD82C: goto L_D82C;
+    case 0xD82D: goto L_D82D;
+    case 0xD830: goto L_D830;
+    case 0xD832: goto L_D832;
+    case 0xD834: goto L_D834;
+    case 0xD837: goto L_D837;
+    case 0xD839: goto L_D839;
+    case 0xD83C: goto L_D83C;
+    case 0xD83E: goto L_D83E;
+    case 0xD840: goto L_D840;
+    case 0xD842: goto L_D842;
+    case 0xD844: goto L_D844;
+    case 0xD846: goto L_D846;
+    case 0xD848: goto L_D848;
+    case 0xD849: goto L_D849;
+    case 0xD84B: goto L_D84B;
+    case 0xD84D: goto L_D84D;
+    case 0xD850: goto L_D850;
+    case 0xD853: goto L_D853;
+    case 0xD855: goto L_D855;
+    case 0xD857: goto L_D857;
+    case 0xD859: goto L_D859;
+    case 0xD85B: goto L_D85B;
+    case 0xD85D: goto L_D85D;
+    case 0xD85F: goto L_D85F;
+    case 0xD862: goto L_D862;
+    case 0xD865: goto L_D865;
+    case 0xD867: goto L_D867;
+    case 0xD86A: goto L_D86A;
+    case 0xD86C: goto L_D86C;
+    case 0xD86F: goto L_D86F;
+    case 0xD871: goto L_D871;
+    case 0xD873: goto L_D873;
+    case 0xD875: goto L_D875;
+    case 0xD877: goto L_D877;
+    case 0xD878: goto L_D878;
+    case 0xD87A: goto L_D87A;
+    case 0xD87B: goto L_D87B;
+    case 0xD87D: goto L_D87D;
+    case 0xD87F: goto L_D87F;
+    case 0xD881: goto L_D881;
+    case 0xD883: goto L_D883;
+    case 0xD885: goto L_D885;
+    case 0xD887: goto L_D887;
+    case 0xD889: goto L_D889;
+    case 0xD88B: goto L_D88B;
+    case 0xD88D: goto L_D88D;
+    case 0xD88F: goto L_D88F;
+    case 0xD891: goto L_D891;
+    case 0xD893: goto L_D893;
+    case 0xD895: goto L_D895;
+    case 0xD897: goto L_D897;
+    case 0xD899: goto L_D899;
+    case 0xD89B: goto L_D89B;
+    case 0xD89C: goto L_D89C;
+    case 0xD89E: goto L_D89E;
+    case 0xD8A0: goto L_D8A0;
+    case 0xD8A3: goto L_D8A3;
+    case 0xD8A5: goto L_D8A5;
+    case 0xD8A7: goto L_D8A7;
+    case 0xD8A9: goto L_D8A9;
+    case 0xD8AB: goto L_D8AB;
+    case 0xD8AD: goto L_D8AD;
+    case 0xD8AF: goto L_D8AF;
+    case 0xD8B0: goto L_D8B0;
+    case 0xD8B2: goto L_D8B2;
+    case 0xD8B4: goto L_D8B4;
+    case 0xD8B6: goto L_D8B6;
+    case 0xD8B9: goto L_D8B9;
+    case 0xD8BB: goto L_D8BB;
+    case 0xD8BD: goto L_D8BD;
+    case 0xD8C0: goto L_D8C0;
+    case 0xD8C2: goto L_D8C2;
+    case 0xD8C4: goto L_D8C4;
+    case 0xD8C7: goto L_D8C7;
+    case 0xD8C9: goto L_D8C9;
+    case 0xD8CB: goto L_D8CB;
+    case 0xD8CE: goto L_D8CE;
+    case 0xD8D0: goto L_D8D0;
+    case 0xD8D2: goto L_D8D2;
+    case 0xD8D4: goto L_D8D4;
+    case 0xD8D7: goto L_D8D7;
+    case 0xD8D9: goto L_D8D9;
+    case 0xD8DA: goto L_D8DA;
+    case 0xD8DB: goto L_D8DB;
+    case 0xD8DD: goto L_D8DD;
+    case 0xD8DF: goto L_D8DF;
+    case 0xD8E1: goto L_D8E1;
+    case 0xD8E3: goto L_D8E3;
+    case 0xD8E5: goto L_D8E5;
+    case 0xD8E7: goto L_D8E7;
+    case 0xD8E9: goto L_D8E9;
+    case 0xD8EB: goto L_D8EB;
+    case 0xD8ED: goto L_D8ED;
+    case 0xD8EF: goto L_D8EF;
+    case 0xD8F1: goto L_D8F1;
+    case 0xD8F3: goto L_D8F3;
+    case 0xD8F5: goto L_D8F5;
+    case 0xD8F7: goto L_D8F7;
+    case 0xD8F9: goto L_D8F9;
+    case 0xD8FB: goto L_D8FB;
+    case 0xD8FD: goto L_D8FD;
+    case 0xD8FE: goto L_D8FE;
+    case 0xD900: goto L_D900;
+    case 0xD902: goto L_D902;
+    case 0xD904: goto L_D904;
+    case 0xD906: goto L_D906;
+    case 0xD908: goto L_D908;
+    case 0xD90A: goto L_D90A;
+    case 0xD90C: goto L_D90C;
+    case 0xD90E: goto L_D90E;
+    case 0xD910: goto L_D910;
+    case 0xD912: goto L_D912;
+    case 0xD914: goto L_D914;
+    case 0xD916: goto L_D916;
+    case 0xD918: goto L_D918;
+    case 0xD91A: goto L_D91A;
+    case 0xD91D: goto L_D91D;
+    case 0xD91F: goto L_D91F;
+    case 0xD921: goto L_D921;
+    case 0xD923: goto L_D923;
+    case 0xD925: goto L_D925;
+    case 0xD927: goto L_D927;
+    case 0xD929: goto L_D929;
+    case 0xD92B: goto L_D92B;
+    case 0xD92C: goto L_D92C;
+    case 0xD92E: goto L_D92E;
+    case 0xD930: goto L_D930;
+    case 0xD932: goto L_D932;
+    case 0xD934: goto L_D934;
+    case 0xD936: goto L_D936;
+    case 0xD938: goto L_D938;
+    case 0xD93A: goto L_D93A;
+    case 0xD93C: goto L_D93C;
+    case 0xD93E: goto L_D93E;
+    case 0xD940: goto L_D940;
+    case 0xD942: goto L_D942;
+    case 0xD944: goto L_D944;
+    case 0xD946: goto L_D946;
+    case 0xD947: goto L_D947;
+    case 0xD949: goto L_D949;
+    case 0xD94B: goto L_D94B;
+    case 0xD94D: goto L_D94D;
+    case 0xD94F: goto L_D94F;
+    case 0xD951: goto L_D951;
+    case 0xD953: goto L_D953;
+    case 0xD955: goto L_D955;
+    case 0xD957: goto L_D957;
+    case 0xD959: goto L_D959;
+    case 0xD95B: goto L_D95B;
+    case 0xD95D: goto L_D95D;
+    case 0xD95F: goto L_D95F;
+    case 0xD961: goto L_D961;
+    case 0xD963: goto L_D963;
+    case 0xD965: goto L_D965;
+    case 0xD967: goto L_D967;
+    case 0xD969: goto L_D969;
+    case 0xD96B: goto L_D96B;
+    case 0xD96D: goto L_D96D;
+    case 0xD96F: goto L_D96F;
+    case 0xD971: goto L_D971;
+    case 0xD973: goto L_D973;
+    case 0xD975: goto L_D975;
+    case 0xD977: goto L_D977;
+    case 0xD979: goto L_D979;
+    case 0xD97B: goto L_D97B;
+    case 0xD97D: goto L_D97D;
+    case 0xD97E: goto L_D97E;
+    case 0xD980: goto L_D980;
+    case 0xD983: goto L_D983;
+    case 0xD985: goto L_D985;
+    case 0xD987: goto L_D987;
+    case 0xD989: goto L_D989;
+    case 0xD98B: goto L_D98B;
+    case 0xD98D: goto L_D98D;
+    case 0xD98F: goto L_D98F;
+    case 0xD991: goto L_D991;
+    case 0xD993: goto L_D993;
+    case 0xD995: goto L_D995;
+    case 0xD997: goto L_D997;
+    case 0xD999: goto L_D999;
+    case 0xD99B: goto L_D99B;
+    case 0xD99D: goto L_D99D;
+    case 0xD99F: goto L_D99F;
+    case 0xD9A1: goto L_D9A1;
+    case 0xD9A2: goto L_D9A2;
+    case 0xD9A4: goto L_D9A4;
+    case 0xD9A6: goto L_D9A6;
+    case 0xD9A8: goto L_D9A8;
+    case 0xD9AA: goto L_D9AA;
+    case 0xD9AC: goto L_D9AC;
+    case 0xD9AE: goto L_D9AE;
+    case 0xD9B0: goto L_D9B0;
+    case 0xD9B2: goto L_D9B2;
+    case 0xD9B4: goto L_D9B4;
+    case 0xD9B6: goto L_D9B6;
+    case 0xD9B7: goto L_D9B7;
+    case 0xD9B8: goto L_D9B8;
+    case 0xD9BA: goto L_D9BA;
+    case 0xD9BB: goto L_D9BB;
+    case 0xD9EA: goto L_D9EA;
+    case 0xD9ED: goto L_D9ED;
+    case 0xD9EF: goto L_D9EF;
+    case 0xD9F1: goto L_D9F1;
+    case 0xD9F4: goto L_D9F4;
+    case 0xD9F6: goto L_D9F6;
+    case 0xD9F8: goto L_D9F8;
+    case 0xD9F9: goto L_D9F9;
+    case 0xD9FB: goto L_D9FB;
+    case 0xD9FD: goto L_D9FD;
+    case 0xD9FF: goto L_D9FF;
+    case 0xDA01: goto L_DA01;
+    case 0xDA04: goto L_DA04;
+    case 0xDA06: goto L_DA06;
+    case 0xDA08: goto L_DA08;
+    case 0xDA0B: goto L_DA0B;
+    case 0xDA0D: goto L_DA0D;
+    case 0xDA0F: goto L_DA0F;
+    case 0xDA12: goto L_DA12;
+    case 0xDA14: goto L_DA14;
+    case 0xDA16: goto L_DA16;
+    case 0xDA19: goto L_DA19;
+    case 0xDA1B: goto L_DA1B;
+    case 0xDA1D: goto L_DA1D;
+    case 0xDA20: goto L_DA20;
+    case 0xDA21: goto L_DA21;
+    case 0xDA24: goto L_DA24;
+    case 0xDA26: goto L_DA26;
+    case 0xDA28: goto L_DA28;
+    case 0xDA2B: goto L_DA2B;
+    case 0xDA2D: goto L_DA2D;
+    case 0xDA30: goto L_DA30;
+    case 0xDA33: goto L_DA33;
+    case 0xDA35: goto L_DA35;
+    case 0xDA37: goto L_DA37;
+    case 0xDA39: goto L_DA39;
+    case 0xDA3B: goto L_DA3B;
+    case 0xDA3D: goto L_DA3D;
+    case 0xDA3F: goto L_DA3F;
+    case 0xDA42: goto L_DA42;
+    case 0xDA44: goto L_DA44;
+    case 0xDA47: goto L_DA47;
+    case 0xDA49: goto L_DA49;
+    case 0xDA4C: goto L_DA4C;
+    case 0xDA4E: goto L_DA4E;
+    case 0xDA51: goto L_DA51;
+    case 0xDA53: goto L_DA53;
+    case 0xDA56: goto L_DA56;
+    case 0xDA59: goto L_DA59;
+    case 0xDA5B: goto L_DA5B;
+    case 0xDA5E: goto L_DA5E;
+    case 0xDA5F: goto L_DA5F;
+    case 0xDA61: goto L_DA61;
+    case 0xDA62: goto L_DA62;
+    case 0xDA64: goto L_DA64;
+    case 0xDA65: goto L_DA65;
+    case 0xDA67: goto L_DA67;
+    case 0xDA69: goto L_DA69;
+    case 0xDA6B: goto L_DA6B;
+    case 0xDA6D: goto L_DA6D;
+    case 0xDA6F: goto L_DA6F;
+    case 0xDA71: goto L_DA71;
+    case 0xDA73: goto L_DA73;
+    case 0xDA75: goto L_DA75;
+    case 0xDA77: goto L_DA77;
+    case 0xDA79: goto L_DA79;
+    case 0xDA7B: goto L_DA7B;
+    case 0xDA7D: goto L_DA7D;
+    case 0xDA7F: goto L_DA7F;
+    case 0xDA81: goto L_DA81;
+    case 0xDA83: goto L_DA83;
+    case 0xDA85: goto L_DA85;
+    case 0xDA87: goto L_DA87;
+    case 0xDA88: goto L_DA88;
+    case 0xDA89: goto L_DA89;
+    case 0xDA8B: goto L_DA8B;
+    case 0xDA8C: goto L_DA8C;
+    case 0xDA8E: goto L_DA8E;
+    case 0xDA90: goto L_DA90;
+    case 0xDA92: goto L_DA92;
+    case 0xDA94: goto L_DA94;
+    case 0xDA96: goto L_DA96;
+    case 0xDA97: goto L_DA97;
+    case 0xDA99: goto L_DA99;
+    case 0xDA9B: goto L_DA9B;
+    case 0xDA9C: goto L_DA9C;
+    case 0xDA9E: goto L_DA9E;
+    case 0xDAA0: goto L_DAA0;
+    case 0xDAA1: goto L_DAA1;
+    case 0xDAA3: goto L_DAA3;
+    case 0xDAA5: goto L_DAA5;
+    case 0xDAA7: goto L_DAA7;
+    case 0xDAA9: goto L_DAA9;
+    case 0xDAAB: goto L_DAAB;
+    case 0xDAAD: goto L_DAAD;
+    case 0xDAAF: goto L_DAAF;
+    case 0xDAB0: goto L_DAB0;
+    case 0xDAB2: goto L_DAB2;
+    case 0xDAB4: goto L_DAB4;
+    case 0xDAB6: goto L_DAB6;
+    case 0xDAB7: goto L_DAB7;
+    case 0xDAB9: goto L_DAB9;
+    case 0xDABB: goto L_DABB;
+    case 0xDABC: goto L_DABC;
+    case 0xDABE: goto L_DABE;
+    case 0xDAC0: goto L_DAC0;
+    case 0xDAC2: goto L_DAC2;
+    case 0xDAC3: goto L_DAC3;
+    case 0xDAC4: goto L_DAC4;
+    case 0xDAC6: goto L_DAC6;
+    case 0xDAC8: goto L_DAC8;
+    case 0xDACA: goto L_DACA;
+    case 0xDACC: goto L_DACC;
+    case 0xDACF: goto L_DACF;
+    case 0xDAD1: goto L_DAD1;
+    case 0xDAD3: goto L_DAD3;
+    case 0xDAD4: goto L_DAD4;
+    case 0xDAD6: goto L_DAD6;
+    case 0xDAD8: goto L_DAD8;
+    case 0xDADA: goto L_DADA;
+    case 0xDADB: goto L_DADB;
+    case 0xDADC: goto L_DADC;
+    case 0xDADF: goto L_DADF;
+    case 0xDAE2: goto L_DAE2;
+    case 0xDAE5: goto L_DAE5;
+    case 0xDAE6: goto L_DAE6;
+    case 0xDAE8: goto L_DAE8;
+    case 0xDAE9: goto L_DAE9;
+    case 0xDAEB: goto L_DAEB;
+    case 0xDAED: goto L_DAED;
+    case 0xDAEF: goto L_DAEF;
+    case 0xDAF1: goto L_DAF1;
+    case 0xDAF4: goto L_DAF4;
+    case 0xDAF6: goto L_DAF6;
+    case 0xDAF8: goto L_DAF8;
+    case 0xDAFE: goto L_DAFE;
+    case 0xDB01: goto L_DB01;
+    case 0xDB03: goto L_DB03;
+    case 0xDB05: goto L_DB05;
+    case 0xDB07: goto L_DB07;
+    case 0xDB09: goto L_DB09;
+    case 0xDB0C: goto L_DB0C;
+    case 0xDB0F: goto L_DB0F;
+    case 0xDB12: goto L_DB12;
+    case 0xDB14: goto L_DB14;
+    case 0xDB17: goto L_DB17;
+    case 0xDB19: goto L_DB19;
+    case 0xDB1A: goto L_DB1A;
+    case 0xDB1C: goto L_DB1C;
+    case 0xDB1E: goto L_DB1E;
+    case 0xDB21: goto L_DB21;
+    case 0xDB23: goto L_DB23;
+    case 0xDB25: goto L_DB25;
+    case 0xDB27: goto L_DB27;
+    case 0xDB29: goto L_DB29;
+    case 0xDB2B: goto L_DB2B;
+    case 0xDB2D: goto L_DB2D;
+    case 0xDB2F: goto L_DB2F;
+    case 0xDB31: goto L_DB31;
+    case 0xDB33: goto L_DB33;
+    case 0xDB35: goto L_DB35;
+    case 0xDB37: goto L_DB37;
+    case 0xDB39: goto L_DB39;
+    case 0xDB3B: goto L_DB3B;
+    case 0xDB3D: goto L_DB3D;
+    case 0xDB3F: goto L_DB3F;
+    case 0xDB40: goto L_DB40;
+    case 0xDB41: goto L_DB41;
+    case 0xDB43: goto L_DB43;
+    case 0xDB44: goto L_DB44;
+    case 0xDB46: goto L_DB46;
+    case 0xDB48: goto L_DB48;
+    case 0xDB4A: goto L_DB4A;
+    case 0xDB4C: goto L_DB4C;
+    case 0xDB4D: goto L_DB4D;
+    case 0xDB4F: goto L_DB4F;
+    case 0xDB51: goto L_DB51;
+    case 0xDB53: goto L_DB53;
+    case 0xDB55: goto L_DB55;
+    case 0xDB57: goto L_DB57;
+    case 0xDB59: goto L_DB59;
+    case 0xDB5B: goto L_DB5B;
+    case 0xDB5D: goto L_DB5D;
+    case 0xDB5E: goto L_DB5E;
+    case 0xDB60: goto L_DB60;
+    case 0xDB62: goto L_DB62;
+    case 0xDB64: goto L_DB64;
+    case 0xDB66: goto L_DB66;
+    case 0xDB68: goto L_DB68;
+    case 0xDB6A: goto L_DB6A;
+    case 0xDB6C: goto L_DB6C;
+    case 0xDB6E: goto L_DB6E;
+    case 0xDB70: goto L_DB70;
+    case 0xDB72: goto L_DB72;
+    case 0xDB74: goto L_DB74;
+    case 0xDB76: goto L_DB76;
+    case 0xDB77: goto L_DB77;
+    case 0xDB7A: goto L_DB7A;
+    case 0xDB7C: goto L_DB7C;
+    case 0xDB7E: goto L_DB7E;
+    case 0xDB7F: goto L_DB7F;
+    case 0xDB80: goto L_DB80;
+    case 0xDB81: goto L_DB81;
+    case 0xDB82: goto L_DB82;
+    case 0xDB83: goto L_DB83;
+    case 0xDB84: goto L_DB84;
+    case 0xDB86: goto L_DB86;
+    case 0xDB87: goto L_DB87;
+    case 0xDB8A: goto L_DB8A;
+    case 0xDB8C: goto L_DB8C;
+    case 0xDB8F: goto L_DB8F;
+    case 0xDB91: goto L_DB91;
+    case 0xDB93: goto L_DB93;
+    case 0xDB95: goto L_DB95;
+    case 0xDB97: goto L_DB97;
+    case 0xDB99: goto L_DB99;
+    case 0xDB9B: goto L_DB9B;
+    case 0xDB9D: goto L_DB9D;
+    case 0xDB9F: goto L_DB9F;
+    case 0xDBA2: goto L_DBA2;
+    case 0xDBA4: goto L_DBA4;
+    case 0xDBA6: goto L_DBA6;
+    case 0xDBA8: goto L_DBA8;
+    case 0xDBAA: goto L_DBAA;
+    case 0xDBAC: goto L_DBAC;
+    case 0xDBAD: goto L_DBAD;
+    case 0xDBAF: goto L_DBAF;
+    case 0xDBB1: goto L_DBB1;
+    case 0xDBB2: goto L_DBB2;
+    case 0xDBB4: goto L_DBB4;
+    case 0xDBB6: goto L_DBB6;
+    case 0xDBB7: goto L_DBB7;
+    case 0xDBB9: goto L_DBB9;
+    case 0xDBBB: goto L_DBBB;
+    case 0xDBBD: goto L_DBBD;
+    case 0xDBBF: goto L_DBBF;
+    case 0xDBC0: goto L_DBC0;
+    case 0xDBC2: goto L_DBC2;
+    case 0xDBC4: goto L_DBC4;
+    case 0xDBC6: goto L_DBC6;
+    case 0xDBC7: goto L_DBC7;
+    case 0xDBC9: goto L_DBC9;
+    case 0xDBCA: goto L_DBCA;
+    case 0xDBCC: goto L_DBCC;
+    case 0xDBCE: goto L_DBCE;
+    case 0xDBD0: goto L_DBD0;
+    case 0xDBD2: goto L_DBD2;
+    case 0xDBD4: goto L_DBD4;
+    case 0xDBD7: goto L_DBD7;
+    case 0xDBD9: goto L_DBD9;
+    case 0xDBDB: goto L_DBDB;
+    case 0xDBDD: goto L_DBDD;
+    case 0xDBDF: goto L_DBDF;
+    case 0xDBE1: goto L_DBE1;
+    case 0xDBE2: goto L_DBE2;
+    case 0xDBE4: goto L_DBE4;
+    case 0xDBE6: goto L_DBE6;
+    case 0xDBE7: goto L_DBE7;
+    case 0xDBE9: goto L_DBE9;
+    case 0xDBEB: goto L_DBEB;
+    case 0xDBEC: goto L_DBEC;
+    case 0xDBEE: goto L_DBEE;
+    case 0xDBF0: goto L_DBF0;
+    case 0xDBF2: goto L_DBF2;
+    case 0xDBF4: goto L_DBF4;
+    case 0xDBF5: goto L_DBF5;
+    case 0xDBF7: goto L_DBF7;
+    case 0xDBF9: goto L_DBF9;
+    case 0xDBFB: goto L_DBFB;
+    case 0xDBFC: goto L_DBFC;
+    case 0xDBFE: goto L_DBFE;
+    case 0xDC00: goto L_DC00;
+    case 0xDC02: goto L_DC02;
+    case 0xDC04: goto L_DC04;
+    case 0xDC06: goto L_DC06;
+    case 0xDC07: goto L_DC07;
+    case 0xDC09: goto L_DC09;
+    case 0xDC0B: goto L_DC0B;
+    case 0xDC0C: goto L_DC0C;
+    case 0xDC0F: goto L_DC0F;
+    case 0xDC11: goto L_DC11;
+    case 0xDC13: goto L_DC13;
+    case 0xDC15: goto L_DC15;
+    case 0xDC16: goto L_DC16;
+    case 0xDC18: goto L_DC18;
+    case 0xDC1A: goto L_DC1A;
+    case 0xDC1B: goto L_DC1B;
+    case 0xDC1D: goto L_DC1D;
+    case 0xDC1F: goto L_DC1F;
+    case 0xDC21: goto L_DC21;
+    case 0xDC23: goto L_DC23;
+    case 0xDC26: goto L_DC26;
+    case 0xDC28: goto L_DC28;
+    case 0xDC2B: goto L_DC2B;
+    case 0xDC2D: goto L_DC2D;
+    case 0xDC2F: goto L_DC2F;
+    case 0xDC31: goto L_DC31;
+    case 0xDC32: goto L_DC32;
+    case 0xDC34: goto L_DC34;
+    case 0xDC36: goto L_DC36;
+    case 0xDC38: goto L_DC38;
+    case 0xDC39: goto L_DC39;
+    case 0xDC3C: goto L_DC3C;
+    case 0xDC3E: goto L_DC3E;
+    case 0xDC40: goto L_DC40;
+    case 0xDC42: goto L_DC42;
+    case 0xDC44: goto L_DC44;
+    case 0xDC46: goto L_DC46;
+    case 0xDC48: goto L_DC48;
+    case 0xDC49: goto L_DC49;
+    case 0xDC4B: goto L_DC4B;
+    case 0xDC4D: goto L_DC4D;
+    case 0xDC4F: goto L_DC4F;
+    case 0xDC51: goto L_DC51;
+    case 0xDC53: goto L_DC53;
+    case 0xDC55: goto L_DC55;
+    case 0xDC58: goto L_DC58;
+    case 0xDC5A: goto L_DC5A;
+    case 0xDC5B: goto L_DC5B;
+    case 0xDC5D: goto L_DC5D;
+    case 0xDC5F: goto L_DC5F;
+    case 0xDC61: goto L_DC61;
+    case 0xDC63: goto L_DC63;
+    case 0xDC64: goto L_DC64;
+    case 0xDC65: goto L_DC65;
+    case 0xDC67: goto L_DC67;
+    case 0xDC69: goto L_DC69;
+    case 0xDC6B: goto L_DC6B;
+    case 0xDC6D: goto L_DC6D;
+    case 0xDC6F: goto L_DC6F;
+    case 0xDC71: goto L_DC71;
+    case 0xDC73: goto L_DC73;
+    case 0xDC75: goto L_DC75;
+    case 0xDC77: goto L_DC77;
+    case 0xDC79: goto L_DC79;
+    case 0xDC7A: goto L_DC7A;
+    case 0xDC7C: goto L_DC7C;
+    case 0xDC7E: goto L_DC7E;
+    case 0xDC80: goto L_DC80;
+    case 0xDC81: goto L_DC81;
+    case 0xDC83: goto L_DC83;
+    case 0xDC85: goto L_DC85;
+    case 0xDC87: goto L_DC87;
+    case 0xDC88: goto L_DC88;
+    case 0xDC8A: goto L_DC8A;
+    case 0xDC8C: goto L_DC8C;
+    case 0xDC8E: goto L_DC8E;
+    case 0xDC90: goto L_DC90;
+    case 0xDC92: goto L_DC92;
+    case 0xDC94: goto L_DC94;
+    case 0xDC96: goto L_DC96;
+    case 0xDC98: goto L_DC98;
+    case 0xDC9B: goto L_DC9B;
+    case 0xDC9D: goto L_DC9D;
+    case 0xDC9F: goto L_DC9F;
+    case 0xDCA0: goto L_DCA0;
+    case 0xDCA2: goto L_DCA2;
+    case 0xDCA4: goto L_DCA4;
+    case 0xDCA6: goto L_DCA6;
+    case 0xDCA7: goto L_DCA7;
+    case 0xDCA9: goto L_DCA9;
+    case 0xDCAB: goto L_DCAB;
+    case 0xDCAE: goto L_DCAE;
+    case 0xDCAF: goto L_DCAF;
+    case 0xDCB1: goto L_DCB1;
+    case 0xDCB3: goto L_DCB3;
+    case 0xDCB5: goto L_DCB5;
+    case 0xDCB8: goto L_DCB8;
+    case 0xDCBA: goto L_DCBA;
+    case 0xDCBB: goto L_DCBB;
+    case 0xDCBC: goto L_DCBC;
+    case 0xDCBE: goto L_DCBE;
+    case 0xDCC0: goto L_DCC0;
+    case 0xDCC2: goto L_DCC2;
+    case 0xDCC4: goto L_DCC4;
+    case 0xDCC6: goto L_DCC6;
+    case 0xDCC9: goto L_DCC9;
+    case 0xDCCB: goto L_DCCB;
+    case 0xDCCC: goto L_DCCC;
+    case 0xDCCE: goto L_DCCE;
+    case 0xDCD0: goto L_DCD0;
+    case 0xDCD2: goto L_DCD2;
+    case 0xDCD5: goto L_DCD5;
+    case 0xDCD7: goto L_DCD7;
+    case 0xDCD9: goto L_DCD9;
+    case 0xDCDB: goto L_DCDB;
+    case 0xDCDD: goto L_DCDD;
+    case 0xDCDE: goto L_DCDE;
+    case 0xDCE0: goto L_DCE0;
+    case 0xDCE2: goto L_DCE2;
+    case 0xDCE4: goto L_DCE4;
+    case 0xDCE6: goto L_DCE6;
+    case 0xDCE9: goto L_DCE9;
+    case 0xDCEB: goto L_DCEB;
+    case 0xDCED: goto L_DCED;
+    case 0xDCEF: goto L_DCEF;
+    case 0xDCF1: goto L_DCF1;
+    case 0xDCF2: goto L_DCF2;
+    case 0xDCF3: goto L_DCF3;
+    case 0xDCF5: goto L_DCF5;
+    case 0xDCF7: goto L_DCF7;
+    case 0xDCF9: goto L_DCF9;
+    case 0xDCFA: goto L_DCFA;
+    case 0xDCFC: goto L_DCFC;
+    case 0xDCFE: goto L_DCFE;
+    case 0xDD00: goto L_DD00;
+    case 0xDD02: goto L_DD02;
+    case 0xDD04: goto L_DD04;
+    case 0xDD06: goto L_DD06;
+    case 0xDD08: goto L_DD08;
+    case 0xDD0A: goto L_DD0A;
+    case 0xDD0D: goto L_DD0D;
+    case 0xDD0F: goto L_DD0F;
+    case 0xDD11: goto L_DD11;
+    case 0xDD13: goto L_DD13;
+    case 0xDD15: goto L_DD15;
+    case 0xDD17: goto L_DD17;
+    case 0xDD1A: goto L_DD1A;
+    case 0xDD1C: goto L_DD1C;
+    case 0xDD1E: goto L_DD1E;
+    case 0xDD20: goto L_DD20;
+    case 0xDD22: goto L_DD22;
+    case 0xDD24: goto L_DD24;
+    case 0xDD26: goto L_DD26;
+    case 0xDD28: goto L_DD28;
+    case 0xDD2A: goto L_DD2A;
+    case 0xDD2C: goto L_DD2C;
+    case 0xDD2E: goto L_DD2E;
+    case 0xDD30: goto L_DD30;
+    case 0xDD33: goto L_DD33;
+    case 0xDD35: goto L_DD35;
+    case 0xDD37: goto L_DD37;
+    case 0xDD39: goto L_DD39;
+    case 0xDD3B: goto L_DD3B;
+    case 0xDD3C: goto L_DD3C;
+    case 0xDD3E: goto L_DD3E;
+    case 0xDD41: goto L_DD41;
+    case 0xDD43: goto L_DD43;
+    case 0xDD45: goto L_DD45;
+    case 0xDD47: goto L_DD47;
+    case 0xDD49: goto L_DD49;
+    case 0xDD4A: goto L_DD4A;
+    case 0xDD4C: goto L_DD4C;
+    case 0xDD4E: goto L_DD4E;
+    case 0xDD50: goto L_DD50;
+    case 0xDD52: goto L_DD52;
+    case 0xDD55: goto L_DD55;
+    case 0xDD57: goto L_DD57;
+    case 0xDD59: goto L_DD59;
+    case 0xDD5B: goto L_DD5B;
+    case 0xDD5E: goto L_DD5E;
+    case 0xDD60: goto L_DD60;
+    case 0xDD62: goto L_DD62;
+    case 0xDD64: goto L_DD64;
+    case 0xDD66: goto L_DD66;
+    case 0xDD67: goto L_DD67;
+    case 0xDD6A: goto L_DD6A;
+    case 0xDD6B: goto L_DD6B;
+    case 0xDD6D: goto L_DD6D;
+    case 0xDD6F: goto L_DD6F;
+    case 0xDD71: goto L_DD71;
+    case 0xDD74: goto L_DD74;
+    case 0xDD75: goto L_DD75;
+    case 0xDD76: goto L_DD76;
+    case 0xDD78: goto L_DD78;
+    case 0xDD7B: goto L_DD7B;
+    case 0xDD7E: goto L_DD7E;
+    case 0xDD7F: goto L_DD7F;
+    case 0xDD82: goto L_DD82;
+    case 0xDD83: goto L_DD83;
+    case 0xDD86: goto L_DD86;
+    case 0xDD88: goto L_DD88;
+    case 0xDD8A: goto L_DD8A;
+    case 0xDD8C: goto L_DD8C;
+    case 0xDD8E: goto L_DD8E;
+    case 0xDD91: goto L_DD91;
+    case 0xDD93: goto L_DD93;
+    case 0xDD95: goto L_DD95;
+    case 0xDD97: goto L_DD97;
+    case 0xDD99: goto L_DD99;
+    case 0xDD9B: goto L_DD9B;
+    case 0xDD9D: goto L_DD9D;
+    case 0xDDA0: goto L_DDA0;
+    case 0xDDA1: goto L_DDA1;
+    case 0xDDA2: goto L_DDA2;
+    case 0xDDA3: goto L_DDA3;
+    case 0xDDA5: goto L_DDA5;
+    case 0xDDA6: goto L_DDA6;
+    case 0xDDA7: goto L_DDA7;
+    case 0xDDA9: goto L_DDA9;
+    case 0xDDAB: goto L_DDAB;
+    case 0xDDAC: goto L_DDAC;
+    case 0xDDAE: goto L_DDAE;
+    case 0xDDB0: goto L_DDB0;
+    case 0xDDC2: goto L_DDC2;
+    case 0xDDC4: goto L_DDC4;
+    case 0xDDC6: goto L_DDC6;
+    case 0xDDC9: goto L_DDC9;
+    case 0xDDCB: goto L_DDCB;
+    case 0xDDCD: goto L_DDCD;
+    case 0xDDCF: goto L_DDCF;
+    case 0xDDD1: goto L_DDD1;
+    case 0xDDD3: goto L_DDD3;
+    case 0xDDD4: goto L_DDD4;
+    case 0xDDD7: goto L_DDD7;
+    case 0xDDDA: goto L_DDDA;
+    case 0xDDDD: goto L_DDDD;
+    case 0xDDDF: goto L_DDDF;
+    case 0xDDE1: goto L_DDE1;
+    case 0xDDE3: goto L_DDE3;
+    case 0xDDE5: goto L_DDE5;
+    case 0xDDE7: goto L_DDE7;
+    case 0xDDEA: goto L_DDEA;
+    case 0xDDEC: goto L_DDEC;
+    case 0xDDEE: goto L_DDEE;
+    case 0xDDEF: goto L_DDEF;
+    case 0xDDF1: goto L_DDF1;
+    case 0xDDF3: goto L_DDF3;
+    case 0xDDF5: goto L_DDF5;
+    case 0xDDF8: goto L_DDF8;
+    case 0xDDFA: goto L_DDFA;
+    case 0xDDFC: goto L_DDFC;
+    case 0xDDFE: goto L_DDFE;
+    case 0xDE00: goto L_DE00;
+    case 0xDE02: goto L_DE02;
+    case 0xDE04: goto L_DE04;
+    case 0xDE07: goto L_DE07;
+    case 0xDE09: goto L_DE09;
+    case 0xDE0B: goto L_DE0B;
+    case 0xDE0D: goto L_DE0D;
+    case 0xDE0F: goto L_DE0F;
+    case 0xDE12: goto L_DE12;
+    case 0xDE14: goto L_DE14;
+    case 0xDE16: goto L_DE16;
+    case 0xDE18: goto L_DE18;
+    case 0xDE1A: goto L_DE1A;
+    case 0xDE1D: goto L_DE1D;
+    case 0xDE1F: goto L_DE1F;
+    case 0xDE21: goto L_DE21;
+    case 0xDE24: goto L_DE24;
+    case 0xDE26: goto L_DE26;
+    case 0xDE28: goto L_DE28;
+    case 0xDE2B: goto L_DE2B;
+    case 0xDE2D: goto L_DE2D;
+    case 0xDE2F: goto L_DE2F;
+    case 0xDE32: goto L_DE32;
+    case 0xDE35: goto L_DE35;
+    case 0xDE37: goto L_DE37;
+    case 0xDE39: goto L_DE39;
+    case 0xDE3A: goto L_DE3A;
+    case 0xDE3C: goto L_DE3C;
+    case 0xDE3E: goto L_DE3E;
+    case 0xDE40: goto L_DE40;
+    case 0xDE42: goto L_DE42;
+    case 0xDE44: goto L_DE44;
+    case 0xDE45: goto L_DE45;
+    case 0xDE47: goto L_DE47;
+    case 0xDE48: goto L_DE48;
+    case 0xDE4A: goto L_DE4A;
+    case 0xDE4C: goto L_DE4C;
+    case 0xDE4E: goto L_DE4E;
+    case 0xDE4F: goto L_DE4F;
+    case 0xDE51: goto L_DE51;
+    case 0xDE53: goto L_DE53;
+    case 0xDE55: goto L_DE55;
+    case 0xDE57: goto L_DE57;
+    case 0xDE58: goto L_DE58;
+    case 0xDE5B: goto L_DE5B;
+    case 0xDE5C: goto L_DE5C;
+    case 0xDE5E: goto L_DE5E;
+    case 0xDE60: goto L_DE60;
+    case 0xDE61: goto L_DE61;
+    case 0xDE64: goto L_DE64;
+    case 0xDE66: goto L_DE66;
+    case 0xDE68: goto L_DE68;
+    case 0xDE6A: goto L_DE6A;
+    case 0xDE6C: goto L_DE6C;
+    case 0xDE6D: goto L_DE6D;
+    case 0xDE70: goto L_DE70;
+    case 0xDE72: goto L_DE72;
+    case 0xDE74: goto L_DE74;
+    case 0xDE77: goto L_DE77;
+    case 0xDE79: goto L_DE79;
+    case 0xDE7B: goto L_DE7B;
+    case 0xDE7E: goto L_DE7E;
+    case 0xDE80: goto L_DE80;
+    case 0xDE82: goto L_DE82;
+    case 0xDE85: goto L_DE85;
+    case 0xDE87: goto L_DE87;
+    case 0xDE88: goto L_DE88;
+    case 0xDE8A: goto L_DE8A;
+    case 0xDE8C: goto L_DE8C;
+    case 0xDE8E: goto L_DE8E;
+    case 0xDE90: goto L_DE90;
+    case 0xDE91: goto L_DE91;
+    case 0xDE93: goto L_DE93;
+    case 0xDE95: goto L_DE95;
+    case 0xDE97: goto L_DE97;
+    case 0xDE99: goto L_DE99;
+    case 0xDE9A: goto L_DE9A;
+    case 0xDE9B: goto L_DE9B;
+    case 0xDE9C: goto L_DE9C;
+    case 0xDE9D: goto L_DE9D;
+    case 0xDE9F: goto L_DE9F;
+    case 0xDEA1: goto L_DEA1;
+    case 0xDEA2: goto L_DEA2;
+    case 0xDEA3: goto L_DEA3;
+    case 0xDEA5: goto L_DEA5;
+    case 0xDEA8: goto L_DEA8;
+    case 0xDEAA: goto L_DEAA;
+    case 0xDEAC: goto L_DEAC;
+    case 0xDEAE: goto L_DEAE;
+    case 0xDEAF: goto L_DEAF;
+    case 0xDEB2: goto L_DEB2;
+    case 0xDEB4: goto L_DEB4;
+    case 0xDEB6: goto L_DEB6;
+    case 0xDEB7: goto L_DEB7;
+    case 0xDEB9: goto L_DEB9;
+    case 0xDEBB: goto L_DEBB;
+    case 0xDEBC: goto L_DEBC;
+    case 0xDEBE: goto L_DEBE;
+    case 0xDEC0: goto L_DEC0;
+    case 0xDEC2: goto L_DEC2;
+    case 0xDEC4: goto L_DEC4;
+    case 0xDEC6: goto L_DEC6;
+    case 0xDEC9: goto L_DEC9;
+    case 0xDECA: goto L_DECA;
+    case 0xDECC: goto L_DECC;
+    case 0xDECE: goto L_DECE;
+    case 0xDED0: goto L_DED0;
+    case 0xDED2: goto L_DED2;
+    case 0xDED3: goto L_DED3;
+    case 0xDED5: goto L_DED5;
+    case 0xDED7: goto L_DED7;
+    case 0xDED9: goto L_DED9;
+    case 0xDEDB: goto L_DEDB;
+    case 0xDEDD: goto L_DEDD;
+    case 0xDEDE: goto L_DEDE;
+    case 0xDEE0: goto L_DEE0;
+    case 0xDEE1: goto L_DEE1;
+    case 0xDEE3: goto L_DEE3;
+    case 0xDEE6: goto L_DEE6;
+    case 0xDEE8: goto L_DEE8;
+    case 0xDEEB: goto L_DEEB;
+    case 0xDEEC: goto L_DEEC;
+    case 0xDEEE: goto L_DEEE;
+    case 0xDEEF: goto L_DEEF;
+    case 0xDEF0: goto L_DEF0;
+    case 0xDEF2: goto L_DEF2;
+    case 0xDEF4: goto L_DEF4;
+    case 0xDEF6: goto L_DEF6;
+    case 0xDEF9: goto L_DEF9;
+    case 0xDEFA: goto L_DEFA;
+    case 0xDEFD: goto L_DEFD;
+    case 0xDEFF: goto L_DEFF;
+    case 0xDF02: goto L_DF02;
+    case 0xDF04: goto L_DF04;
+    case 0xDF07: goto L_DF07;
+    case 0xDF09: goto L_DF09;
+    case 0xDF0C: goto L_DF0C;
+    case 0xDF0E: goto L_DF0E;
+    case 0xDF10: goto L_DF10;
+    case 0xDF71: goto L_DF71;
+    case 0xDF74: goto L_DF74;
+    case 0xDF76: goto L_DF76;
+    case 0xDF78: goto L_DF78;
+    case 0xDF7B: goto L_DF7B;
+    case 0xDF7D: goto L_DF7D;
+    case 0xDF7F: goto L_DF7F;
+    case 0xDF81: goto L_DF81;
+    case 0xDF84: goto L_DF84;
+    case 0xDF86: goto L_DF86;
+    case 0xDF88: goto L_DF88;
+    case 0xDF8B: goto L_DF8B;
+    case 0xDF8D: goto L_DF8D;
+    case 0xDF8F: goto L_DF8F;
+    case 0xDF92: goto L_DF92;
+    case 0xDF94: goto L_DF94;
+    case 0xDF96: goto L_DF96;
+    case 0xDF99: goto L_DF99;
+    case 0xDF9B: goto L_DF9B;
+    case 0xDF9C: goto L_DF9C;
+    case 0xDF9E: goto L_DF9E;
+    case 0xDFA1: goto L_DFA1;
+    case 0xDFA2: goto L_DFA2;
+    case 0xDFA3: goto L_DFA3;
+    case 0xDFA6: goto L_DFA6;
+    case 0xDFA8: goto L_DFA8;
+    case 0xDFAA: goto L_DFAA;
+    case 0xDFAD: goto L_DFAD;
+    case 0xDFB0: goto L_DFB0;
+    case 0xDFB1: goto L_DFB1;
+    case 0xDFB2: goto L_DFB2;
+    case 0xDFB4: goto L_DFB4;
+    case 0xDFB6: goto L_DFB6;
+    case 0xDFB8: goto L_DFB8;
+    case 0xDFBA: goto L_DFBA;
+    case 0xDFBC: goto L_DFBC;
+    case 0xDFBE: goto L_DFBE;
+    case 0xDFED: goto L_DFED;
+    case 0xDFEF: goto L_DFEF;
+    case 0xDFF1: goto L_DFF1;
+    case 0xDFF4: goto L_DFF4;
+    case 0xDFF6: goto L_DFF6;
+    case 0xDFF8: goto L_DFF8;
+    case 0xDFFA: goto L_DFFA;
+    case 0xDFFD: goto L_DFFD;
+    case 0xDFFF: goto L_DFFF;
+    case 0xE002: goto L_E002;
+    case 0xE004: goto L_E004;
+    case 0xE006: goto L_E006;
+    case 0xE008: goto L_E008;
+    case 0xE00B: goto L_E00B;
+    case 0xE00E: goto L_E00E;
+    case 0xE010: goto L_E010;
+    case 0xE011: goto L_E011;
+    case 0xE013: goto L_E013;
+    case 0xE015: goto L_E015;
+    case 0xE016: goto L_E016;
+    case 0xE018: goto L_E018;
+    case 0xE019: goto L_E019;
+    case 0xE01B: goto L_E01B;
+    case 0xE01D: goto L_E01D;
+    case 0xE01F: goto L_E01F;
+    case 0xE021: goto L_E021;
+    case 0xE023: goto L_E023;
+    case 0xE024: goto L_E024;
+    case 0xE026: goto L_E026;
+    case 0xE028: goto L_E028;
+    case 0xE02A: goto L_E02A;
+    case 0xE02D: goto L_E02D;
+    case 0xE030: goto L_E030;
+    case 0xE032: goto L_E032;
+    case 0xE034: goto L_E034;
+    case 0xE037: goto L_E037;
+    case 0xE039: goto L_E039;
+    case 0xE03B: goto L_E03B;
+    case 0xE03C: goto L_E03C;
+    case 0xE03F: goto L_E03F;
+    case 0xE040: goto L_E040;
+    case 0xE042: goto L_E042;
+    case 0xE044: goto L_E044;
+    case 0xE047: goto L_E047;
+    case 0xE049: goto L_E049;
+    case 0xE04C: goto L_E04C;
+    case 0xE04F: goto L_E04F;
+    case 0xE051: goto L_E051;
+    case 0xE053: goto L_E053;
+    case 0xE056: goto L_E056;
+    case 0xE058: goto L_E058;
+    case 0xE05A: goto L_E05A;
+    case 0xE05D: goto L_E05D;
+    case 0xE05F: goto L_E05F;
+    case 0xE061: goto L_E061;
+    case 0xE063: goto L_E063;
+    case 0xE064: goto L_E064;
+    case 0xE065: goto L_E065;
+    case 0xE067: goto L_E067;
+    case 0xE069: goto L_E069;
+    case 0xE06B: goto L_E06B;
+    case 0xE06D: goto L_E06D;
+    case 0xE070: goto L_E070;
+    case 0xE072: goto L_E072;
+    case 0xE074: goto L_E074;
+    case 0xE075: goto L_E075;
+    case 0xE077: goto L_E077;
+    case 0xE079: goto L_E079;
+    case 0xE07A: goto L_E07A;
+    case 0xE07C: goto L_E07C;
+    case 0xE07E: goto L_E07E;
+    case 0xE081: goto L_E081;
+    case 0xE083: goto L_E083;
+    case 0xE085: goto L_E085;
+    case 0xE087: goto L_E087;
+    case 0xE089: goto L_E089;
+    case 0xE094: goto L_E094;
+    case 0xE097: goto L_E097;
+    case 0xE099: goto L_E099;
+    case 0xE09B: goto L_E09B;
+    case 0xE09E: goto L_E09E;
+    case 0xE0A0: goto L_E0A0;
+    case 0xE0A2: goto L_E0A2;
+    case 0xE0A4: goto L_E0A4;
+    case 0xE0A6: goto L_E0A6;
+    case 0xE0A8: goto L_E0A8;
+    case 0xE0A9: goto L_E0A9;
+    case 0xE0AB: goto L_E0AB;
+    case 0xE0AD: goto L_E0AD;
+    case 0xE0AF: goto L_E0AF;
+    case 0xE0B1: goto L_E0B1;
+    case 0xE0B3: goto L_E0B3;
+    case 0xE0B4: goto L_E0B4;
+    case 0xE0B6: goto L_E0B6;
+    case 0xE0B8: goto L_E0B8;
+    case 0xE0BB: goto L_E0BB;
+    case 0xE0BD: goto L_E0BD;
+    case 0xE0BF: goto L_E0BF;
+    case 0xE0C2: goto L_E0C2;
+    case 0xE0C4: goto L_E0C4;
+    case 0xE0C6: goto L_E0C6;
+    case 0xE0C9: goto L_E0C9;
+    case 0xE0CB: goto L_E0CB;
+    case 0xE0CD: goto L_E0CD;
+    case 0xE0D0: goto L_E0D0;
+    case 0xE0D2: goto L_E0D2;
+    case 0xE0D4: goto L_E0D4;
+    case 0xE0D6: goto L_E0D6;
+    case 0xE0D8: goto L_E0D8;
+    case 0xE0DA: goto L_E0DA;
+    case 0xE0DC: goto L_E0DC;
+    case 0xE0DE: goto L_E0DE;
+    case 0xE0E0: goto L_E0E0;
+    case 0xE0E2: goto L_E0E2;
+    case 0xE0E4: goto L_E0E4;
+    case 0xE0E6: goto L_E0E6;
+    case 0xE0E8: goto L_E0E8;
+    case 0xE0EA: goto L_E0EA;
+    case 0xE0EC: goto L_E0EC;
+    case 0xE0EF: goto L_E0EF;
+    case 0xE0F1: goto L_E0F1;
+    case 0xE0F3: goto L_E0F3;
+    case 0xE0F6: goto L_E0F6;
+    case 0xE0F8: goto L_E0F8;
+    case 0xE0FA: goto L_E0FA;
+    case 0xE0FC: goto L_E0FC;
+    case 0xE0FE: goto L_E0FE;
+    case 0xE101: goto L_E101;
+    case 0xE102: goto L_E102;
+    case 0xE104: goto L_E104;
+    case 0xE106: goto L_E106;
+    case 0xE109: goto L_E109;
+    case 0xE10C: goto L_E10C;
+    case 0xE10E: goto L_E10E;
+    case 0xE10F: goto L_E10F;
+    case 0xE112: goto L_E112;
+    case 0xE114: goto L_E114;
+    case 0xE115: goto L_E115;
+    case 0xE118: goto L_E118;
+    case 0xE11A: goto L_E11A;
+    case 0xE11B: goto L_E11B;
+    case 0xE11E: goto L_E11E;
+    case 0xE120: goto L_E120;
+    case 0xE121: goto L_E121;
+    case 0xE124: goto L_E124;
+    case 0xE126: goto L_E126;
+    case 0xE127: goto L_E127;
+    case 0xE12A: goto L_E12A;
+    case 0xE12D: goto L_E12D;
+    case 0xE12F: goto L_E12F;
+    case 0xE130: goto L_E130;
+    case 0xE132: goto L_E132;
+    case 0xE133: goto L_E133;
+    case 0xE136: goto L_E136;
+    case 0xE137: goto L_E137;
+    case 0xE13A: goto L_E13A;
+    case 0xE13D: goto L_E13D;
+    case 0xE140: goto L_E140;
+    case 0xE141: goto L_E141;
+    case 0xE153: goto L_E153;
+    case 0xE156: goto L_E156;
+    case 0xE158: goto L_E158;
+    case 0xE15A: goto L_E15A;
+    case 0xE15C: goto L_E15C;
+    case 0xE15F: goto L_E15F;
+    case 0xE161: goto L_E161;
+    case 0xE162: goto L_E162;
+    case 0xE164: goto L_E164;
+    case 0xE165: goto L_E165;
+    case 0xE167: goto L_E167;
+    case 0xE169: goto L_E169;
+    case 0xE16C: goto L_E16C;
+    case 0xE16E: goto L_E16E;
+    case 0xE170: goto L_E170;
+    case 0xE172: goto L_E172;
+    case 0xE175: goto L_E175;
+    case 0xE177: goto L_E177;
+    case 0xE179: goto L_E179;
+    case 0xE17B: goto L_E17B;
+    case 0xE17D: goto L_E17D;
+    case 0xE180: goto L_E180;
+    case 0xE182: goto L_E182;
+    case 0xE184: goto L_E184;
+    case 0xE187: goto L_E187;
+    case 0xE189: goto L_E189;
+    case 0xE18B: goto L_E18B;
+    case 0xE18D: goto L_E18D;
+    case 0xE18F: goto L_E18F;
+    case 0xE191: goto L_E191;
+    case 0xE194: goto L_E194;
+    case 0xE195: goto L_E195;
+    case 0xE198: goto L_E198;
+    case 0xE19A: goto L_E19A;
+    case 0xE19C: goto L_E19C;
+    case 0xE19E: goto L_E19E;
+    case 0xE1A1: goto L_E1A1;
+    case 0xE1A3: goto L_E1A3;
+    case 0xE1A5: goto L_E1A5;
+    case 0xE1A7: goto L_E1A7;
+    case 0xE1A9: goto L_E1A9;
+    case 0xE1AB: goto L_E1AB;
+    case 0xE1AD: goto L_E1AD;
+    case 0xE1AF: goto L_E1AF;
+    case 0xE1B2: goto L_E1B2;
+    case 0xE1B5: goto L_E1B5;
+    case 0xE1B8: goto L_E1B8;
+    case 0xE1BB: goto L_E1BB;
+    case 0xE1BE: goto L_E1BE;
+    case 0xE1C1: goto L_E1C1;
+    case 0xE1C3: goto L_E1C3;
+    case 0xE1C4: goto L_E1C4;
+    case 0xE1C7: goto L_E1C7;
+    case 0xE1C9: goto L_E1C9;
+    case 0xE1CC: goto L_E1CC;
+    case 0xE1CE: goto L_E1CE;
+    case 0xE1D1: goto L_E1D1;
+    case 0xE1D3: goto L_E1D3;
+    case 0xE1D6: goto L_E1D6;
+    case 0xE1D8: goto L_E1D8;
+    case 0xE1DA: goto L_E1DA;
+    case 0xE1DD: goto L_E1DD;
+    case 0xE1E0: goto L_E1E0;
+    case 0xE1E3: goto L_E1E3;
+    case 0xE1E6: goto L_E1E6;
+    case 0xE1E9: goto L_E1E9;
+    case 0xE1EB: goto L_E1EB;
+    case 0xE1ED: goto L_E1ED;
+    case 0xE1F0: goto L_E1F0;
+    case 0xE1F3: goto L_E1F3;
+    case 0xE1F6: goto L_E1F6;
+    case 0xE1F7: goto L_E1F7;
+    case 0xE1F8: goto L_E1F8;
+    case 0xE1FA: goto L_E1FA;
+    case 0xE1FD: goto L_E1FD;
+    case 0xE200: goto L_E200;
+    case 0xE203: goto L_E203;
+    case 0xE206: goto L_E206;
+    case 0xE208: goto L_E208;
+    case 0xE209: goto L_E209;
+    case 0xE20A: goto L_E20A;
+    case 0xE20B: goto L_E20B;
+    case 0xE20E: goto L_E20E;
+    case 0xE211: goto L_E211;
+    case 0xE213: goto L_E213;
+    case 0xE216: goto L_E216;
+    case 0xE218: goto L_E218;
+    case 0xE21B: goto L_E21B;
+    case 0xE21E: goto L_E21E;
+    case 0xE221: goto L_E221;
+    case 0xE223: goto L_E223;
+    case 0xE224: goto L_E224;
+    case 0xE226: goto L_E226;
+    case 0xE228: goto L_E228;
+    case 0xE22B: goto L_E22B;
+    case 0xE22E: goto L_E22E;
+    case 0xE231: goto L_E231;
+    case 0xE233: goto L_E233;
+    case 0xE235: goto L_E235;
+    case 0xE237: goto L_E237;
+    case 0xE239: goto L_E239;
+    case 0xE23B: goto L_E23B;
+    case 0xE23C: goto L_E23C;
+    case 0xE23F: goto L_E23F;
+    case 0xE242: goto L_E242;
+    case 0xE245: goto L_E245;
+    case 0xE246: goto L_E246;
+    case 0xE247: goto L_E247;
+    case 0xE249: goto L_E249;
+    case 0xE24B: goto L_E24B;
+    case 0xE24E: goto L_E24E;
+    case 0xE251: goto L_E251;
+    case 0xE254: goto L_E254;
+    case 0xE257: goto L_E257;
+    case 0xE25A: goto L_E25A;
+    case 0xE25C: goto L_E25C;
+    case 0xE25E: goto L_E25E;
+    case 0xE261: goto L_E261;
+    case 0xE263: goto L_E263;
+    case 0xE265: goto L_E265;
+    case 0xE268: goto L_E268;
+    case 0xE26B: goto L_E26B;
+    case 0xE26D: goto L_E26D;
+    case 0xE26F: goto L_E26F;
+    case 0xE271: goto L_E271;
+    case 0xE274: goto L_E274;
+    case 0xE277: goto L_E277;
+    case 0xE27A: goto L_E27A;
+    case 0xE27C: goto L_E27C;
+    case 0xE27E: goto L_E27E;
+    case 0xE281: goto L_E281;
+    case 0xE283: goto L_E283;
+    case 0xE285: goto L_E285;
+    case 0xE288: goto L_E288;
+    case 0xE28A: goto L_E28A;
+    case 0xE28B: goto L_E28B;
+    case 0xE28D: goto L_E28D;
+    case 0xE290: goto L_E290;
+    case 0xE292: goto L_E292;
+    case 0xE294: goto L_E294;
+    case 0xE296: goto L_E296;
+    case 0xE298: goto L_E298;
+    case 0xE29A: goto L_E29A;
+    case 0xE29D: goto L_E29D;
+    case 0xE29F: goto L_E29F;
+    case 0xE2A1: goto L_E2A1;
+    case 0xE2A4: goto L_E2A4;
+    case 0xE2A5: goto L_E2A5;
+    case 0xE2A7: goto L_E2A7;
+    case 0xE2AA: goto L_E2AA;
+    case 0xE2AC: goto L_E2AC;
+    case 0xE2AE: goto L_E2AE;
+    case 0xE2B1: goto L_E2B1;
+    case 0xE2B4: goto L_E2B4;
+    case 0xE2B6: goto L_E2B6;
+    case 0xE2B8: goto L_E2B8;
+    case 0xE2BB: goto L_E2BB;
+    case 0xE2BD: goto L_E2BD;
+    case 0xE2BF: goto L_E2BF;
+    case 0xE2C2: goto L_E2C2;
+    case 0xE2C4: goto L_E2C4;
+    case 0xE2C6: goto L_E2C6;
+    case 0xE2C9: goto L_E2C9;
+    case 0xE2CB: goto L_E2CB;
+    case 0xE2CD: goto L_E2CD;
+    case 0xE2CF: goto L_E2CF;
+    case 0xE2D2: goto L_E2D2;
+    case 0xE2D4: goto L_E2D4;
+    case 0xE2D6: goto L_E2D6;
+    case 0xE2D9: goto L_E2D9;
+    case 0xE2DA: goto L_E2DA;
+    case 0xE30B: goto L_E30B;
+    case 0xE30D: goto L_E30D;
+    case 0xE30E: goto L_E30E;
+    case 0xE310: goto L_E310;
+    case 0xE313: goto L_E313;
+    case 0xE315: goto L_E315;
+    case 0xE316: goto L_E316;
+    case 0xE318: goto L_E318;
+    case 0xE31A: goto L_E31A;
+    case 0xE31C: goto L_E31C;
+    case 0xE31E: goto L_E31E;
+    case 0xE321: goto L_E321;
+    case 0xE323: goto L_E323;
+    case 0xE325: goto L_E325;
+    case 0xE328: goto L_E328;
+    case 0xE329: goto L_E329;
+    case 0xE32B: goto L_E32B;
+    case 0xE32D: goto L_E32D;
+    case 0xE32F: goto L_E32F;
+    case 0xE331: goto L_E331;
+    case 0xE334: goto L_E334;
+    case 0xE335: goto L_E335;
+    case 0xE337: goto L_E337;
+    case 0xE33A: goto L_E33A;
+    case 0xE378: goto L_E378;
+    case 0xE37B: goto L_E37B;
+    case 0xE37E: goto L_E37E;
+    case 0xE381: goto L_E381;
+    case 0xE383: goto L_E383;
+    case 0xE384: goto L_E384;
+    case 0xE3A4: goto L_E3A4;
+    case 0xE3A6: goto L_E3A6;
+    case 0xE3A8: goto L_E3A8;
+    case 0xE3AA: goto L_E3AA;
+    case 0xE3AC: goto L_E3AC;
+    case 0xE3AE: goto L_E3AE;
+    case 0xE3B0: goto L_E3B0;
+    case 0xE3B2: goto L_E3B2;
+    case 0xE3B4: goto L_E3B4;
+    case 0xE3B6: goto L_E3B6;
+    case 0xE3B8: goto L_E3B8;
+    case 0xE3BA: goto L_E3BA;
+    case 0xE3BC: goto L_E3BC;
+    case 0xE3BE: goto L_E3BE;
+    case 0xE3C0: goto L_E3C0;
+    case 0xE3C2: goto L_E3C2;
+    case 0xE3C4: goto L_E3C4;
+    case 0xE3C7: goto L_E3C7;
+    case 0xE3C9: goto L_E3C9;
+    case 0xE3CA: goto L_E3CA;
+    case 0xE3CC: goto L_E3CC;
+    case 0xE3CE: goto L_E3CE;
+    case 0xE3D0: goto L_E3D0;
+    case 0xE3D2: goto L_E3D2;
+    case 0xE3D4: goto L_E3D4;
+    case 0xE3D6: goto L_E3D6;
+    case 0xE3D8: goto L_E3D8;
+    case 0xE3DA: goto L_E3DA;
+    case 0xE3DD: goto L_E3DD;
+    case 0xE3E0: goto L_E3E0;
+    case 0xE3E2: goto L_E3E2;
+    case 0xE3E4: goto L_E3E4;
+    case 0xE3E5: goto L_E3E5;
+    case 0xE3E8: goto L_E3E8;
+    case 0xE3EA: goto L_E3EA;
+    case 0xE3EC: goto L_E3EC;
+    case 0xE3ED: goto L_E3ED;
+    case 0xE3F0: goto L_E3F0;
+    case 0xE3F2: goto L_E3F2;
+    case 0xE3F4: goto L_E3F4;
+    case 0xE3F6: goto L_E3F6;
+    case 0xE3F8: goto L_E3F8;
+    case 0xE3FA: goto L_E3FA;
+    case 0xE3FB: goto L_E3FB;
+    case 0xE3FD: goto L_E3FD;
+    case 0xE3FF: goto L_E3FF;
+    case 0xE401: goto L_E401;
+    case 0xE403: goto L_E403;
+    case 0xE404: goto L_E404;
+    case 0xE406: goto L_E406;
+    case 0xE408: goto L_E408;
+    case 0xE40B: goto L_E40B;
+    case 0xE40D: goto L_E40D;
+    case 0xE40F: goto L_E40F;
+    case 0xE412: goto L_E412;
+    case 0xE414: goto L_E414;
+    case 0xE415: goto L_E415;
+    case 0xE417: goto L_E417;
+    case 0xE418: goto L_E418;
+    case 0xE41A: goto L_E41A;
+    case 0xE41C: goto L_E41C;
+    case 0xE41F: goto L_E41F;
+    case 0xE421: goto L_E421;
+    case 0xE423: goto L_E423;
+    case 0xE426: goto L_E426;
+    case 0xE45B: goto L_E45B;
+    case 0xE45D: goto L_E45D;
+    case 0xE460: goto L_E460;
+    case 0xE463: goto L_E463;
+    case 0xE464: goto L_E464;
+    case 0xE466: goto L_E466;
+    case 0xE467: goto L_E467;
+    case 0xE46A: goto L_E46A;
+    case 0xE46C: goto L_E46C;
+    case 0xE46E: goto L_E46E;
+    case 0xE471: goto L_E471;
+    case 0xE472: goto L_E472;
+    case 0xE476: goto L_E476;
+    case 0xE479: goto L_E479;
+    case 0xE4A0: goto L_E4A0;
+    case 0xE4A3: goto L_E4A3;
+    case 0xE4A5: goto L_E4A5;
+    case 0xE4A8: goto L_E4A8;
+    case 0xE4A9: goto L_E4A9;
+    case 0xE4AC: goto L_E4AC;
+    case 0xE4AE: goto L_E4AE;
+    case 0xE4B1: goto L_E4B1;
+    case 0xE4B2: goto L_E4B2;
+    case 0xE4B5: goto L_E4B5;
+    case 0xE4B8: goto L_E4B8;
+    case 0xE4BA: goto L_E4BA;
+    case 0xE4BB: goto L_E4BB;
+    case 0xE4BC: goto L_E4BC;
+    case 0xE4BE: goto L_E4BE;
+    case 0xE4C1: goto L_E4C1;
+    case 0xE4C2: goto L_E4C2;
+    case 0xE4C4: goto L_E4C4;
+    case 0xE4C6: goto L_E4C6;
+    case 0xE4C8: goto L_E4C8;
+    case 0xE4CA: goto L_E4CA;
+    case 0xE4CC: goto L_E4CC;
+    case 0xE4CF: goto L_E4CF;
+    case 0xE4D2: goto L_E4D2;
+    case 0xE4D4: goto L_E4D4;
+    case 0xE4D5: goto L_E4D5;
+    case 0xE4D7: goto L_E4D7;
+    case 0xE500: goto L_E500;
+    case 0xE502: goto L_E502;
+    case 0xE504: goto L_E504;
+    case 0xE505: goto L_E505;
+    case 0xE507: goto L_E507;
+    case 0xE509: goto L_E509;
+    case 0xE50A: goto L_E50A;
+    case 0xE50C: goto L_E50C;
+    case 0xE50E: goto L_E50E;
+    case 0xE510: goto L_E510;
+    case 0xE513: goto L_E513;
+    case 0xE515: goto L_E515;
+    case 0xE517: goto L_E517;
+    case 0xE518: goto L_E518;
+    case 0xE51B: goto L_E51B;
+    case 0xE51E: goto L_E51E;
+    case 0xE520: goto L_E520;
+    case 0xE521: goto L_E521;
+    case 0xE522: goto L_E522;
+    case 0xE524: goto L_E524;
+    case 0xE527: goto L_E527;
+    case 0xE52A: goto L_E52A;
+    case 0xE52C: goto L_E52C;
+    case 0xE52E: goto L_E52E;
+    case 0xE530: goto L_E530;
+    case 0xE533: goto L_E533;
+    case 0xE536: goto L_E536;
+    case 0xE538: goto L_E538;
+    case 0xE53B: goto L_E53B;
+    case 0xE53D: goto L_E53D;
+    case 0xE53F: goto L_E53F;
+    case 0xE542: goto L_E542;
+    case 0xE544: goto L_E544;
+    case 0xE547: goto L_E547;
+    case 0xE549: goto L_E549;
+    case 0xE54C: goto L_E54C;
+    case 0xE54F: goto L_E54F;
+    case 0xE551: goto L_E551;
+    case 0xE554: goto L_E554;
+    case 0xE556: goto L_E556;
+    case 0xE559: goto L_E559;
+    case 0xE55B: goto L_E55B;
+    case 0xE55D: goto L_E55D;
+    case 0xE55F: goto L_E55F;
+    case 0xE562: goto L_E562;
+    case 0xE564: goto L_E564;
+    case 0xE565: goto L_E565;
+    case 0xE567: goto L_E567;
+    case 0xE568: goto L_E568;
+    case 0xE56A: goto L_E56A;
+    case 0xE56B: goto L_E56B;
+    case 0xE56D: goto L_E56D;
+    case 0xE56F: goto L_E56F;
+    case 0xE570: goto L_E570;
+    case 0xE571: goto L_E571;
+    case 0xE573: goto L_E573;
+    case 0xE575: goto L_E575;
+    case 0xE577: goto L_E577;
+    case 0xE579: goto L_E579;
+    case 0xE57B: goto L_E57B;
+    case 0xE57E: goto L_E57E;
+    case 0xE57F: goto L_E57F;
+    case 0xE581: goto L_E581;
+    case 0xE583: goto L_E583;
+    case 0xE585: goto L_E585;
+    case 0xE587: goto L_E587;
+    case 0xE589: goto L_E589;
+    case 0xE58B: goto L_E58B;
+    case 0xE58D: goto L_E58D;
+    case 0xE58F: goto L_E58F;
+    case 0xE590: goto L_E590;
+    case 0xE592: goto L_E592;
+    case 0xE594: goto L_E594;
+    case 0xE595: goto L_E595;
+    case 0xE597: goto L_E597;
+    case 0xE599: goto L_E599;
+    case 0xE59B: goto L_E59B;
+    case 0xE59E: goto L_E59E;
+    case 0xE5A0: goto L_E5A0;
+    case 0xE5A3: goto L_E5A3;
+    case 0xE5A5: goto L_E5A5;
+    case 0xE5A7: goto L_E5A7;
+    case 0xE5A8: goto L_E5A8;
+    case 0xE5AA: goto L_E5AA;
+    case 0xE5AC: goto L_E5AC;
+    case 0xE5AD: goto L_E5AD;
+    case 0xE5AF: goto L_E5AF;
+    case 0xE5B0: goto L_E5B0;
+    case 0xE5B2: goto L_E5B2;
+    case 0xE5B4: goto L_E5B4;
+    case 0xE5BB: goto L_E5BB;
+    case 0xE5BD: goto L_E5BD;
+    case 0xE5BF: goto L_E5BF;
+    case 0xE5C1: goto L_E5C1;
+    case 0xE5C3: goto L_E5C3;
+    case 0xE5C5: goto L_E5C5;
+    case 0xE5C8: goto L_E5C8;
+    case 0xE5CB: goto L_E5CB;
+    case 0xE5CC: goto L_E5CC;
+    case 0xE5CE: goto L_E5CE;
+    case 0xE5CF: goto L_E5CF;
+    case 0xE5D2: goto L_E5D2;
+    case 0xE5D4: goto L_E5D4;
+    case 0xE5D7: goto L_E5D7;
+    case 0xE5DA: goto L_E5DA;
+    case 0xE5DB: goto L_E5DB;
+    case 0xE5DD: goto L_E5DD;
+    case 0xE5DF: goto L_E5DF;
+    case 0xE5E1: goto L_E5E1;
+    case 0xE5E2: goto L_E5E2;
+    case 0xE5E3: goto L_E5E3;
+    case 0xE5E4: goto L_E5E4;
+    case 0xE5E5: goto L_E5E5;
+    case 0xE5E8: goto L_E5E8;
+    case 0xE5EA: goto L_E5EA;
+    case 0xE5EC: goto L_E5EC;
+    case 0xE5EF: goto L_E5EF;
+    case 0xE5F1: goto L_E5F1;
+    case 0xE5F2: goto L_E5F2;
+    case 0xE5F4: goto L_E5F4;
+    case 0xE5F6: goto L_E5F6;
+    case 0xE5F8: goto L_E5F8;
+    case 0xE5FB: goto L_E5FB;
+    case 0xE5FD: goto L_E5FD;
+    case 0xE5FF: goto L_E5FF;
+    case 0xE602: goto L_E602;
+    case 0xE605: goto L_E605;
+    case 0xE607: goto L_E607;
+    case 0xE609: goto L_E609;
+    case 0xE60B: goto L_E60B;
+    case 0xE60C: goto L_E60C;
+    case 0xE60E: goto L_E60E;
+    case 0xE611: goto L_E611;
+    case 0xE614: goto L_E614;
+    case 0xE615: goto L_E615;
+    case 0xE617: goto L_E617;
+    case 0xE619: goto L_E619;
+    case 0xE61B: goto L_E61B;
+    case 0xE61D: goto L_E61D;
+    case 0xE61F: goto L_E61F;
+    case 0xE621: goto L_E621;
+    case 0xE623: goto L_E623;
+    case 0xE625: goto L_E625;
+    case 0xE627: goto L_E627;
+    case 0xE628: goto L_E628;
+    case 0xE62A: goto L_E62A;
+    case 0xE62B: goto L_E62B;
+    case 0xE62D: goto L_E62D;
+    case 0xE62F: goto L_E62F;
+    case 0xE632: goto L_E632;
+    case 0xE634: goto L_E634;
+    case 0xE636: goto L_E636;
+    case 0xE638: goto L_E638;
+    case 0xE63A: goto L_E63A;
+    case 0xE63C: goto L_E63C;
+    case 0xE63F: goto L_E63F;
+    case 0xE641: goto L_E641;
+    case 0xE643: goto L_E643;
+    case 0xE645: goto L_E645;
+    case 0xE647: goto L_E647;
+    case 0xE649: goto L_E649;
+    case 0xE64B: goto L_E64B;
+    case 0xE64D: goto L_E64D;
+    case 0xE64F: goto L_E64F;
+    case 0xE650: goto L_E650;
+    case 0xE651: goto L_E651;
+    case 0xE652: goto L_E652;
+    case 0xE653: goto L_E653;
+    case 0xE655: goto L_E655;
+    case 0xE657: goto L_E657;
+    case 0xE659: goto L_E659;
+    case 0xE65B: goto L_E65B;
+    case 0xE65C: goto L_E65C;
+    case 0xE65D: goto L_E65D;
+    case 0xE65E: goto L_E65E;
+    case 0xE65F: goto L_E65F;
+    case 0xE660: goto L_E660;
+    case 0xE661: goto L_E661;
+    case 0xE662: goto L_E662;
+    case 0xE663: goto L_E663;
+    case 0xE664: goto L_E664;
+    case 0xE665: goto L_E665;
+    case 0xE666: goto L_E666;
+    case 0xE667: goto L_E667;
+    case 0xE668: goto L_E668;
+    case 0xE669: goto L_E669;
+    case 0xE66A: goto L_E66A;
+    case 0xE66B: goto L_E66B;
+    case 0xE66C: goto L_E66C;
+    case 0xE66D: goto L_E66D;
+    case 0xE66E: goto L_E66E;
+    case 0xE66F: goto L_E66F;
+    case 0xE670: goto L_E670;
+    case 0xE671: goto L_E671;
+    case 0xE672: goto L_E672;
+    case 0xE674: goto L_E674;
+    case 0xE676: goto L_E676;
+    case 0xE678: goto L_E678;
+    case 0xE67A: goto L_E67A;
+    case 0xE67C: goto L_E67C;
+    case 0xE67E: goto L_E67E;
+    case 0xE680: goto L_E680;
+    case 0xE682: goto L_E682;
+    case 0xE684: goto L_E684;
+    case 0xE686: goto L_E686;
+    case 0xE688: goto L_E688;
+    case 0xE68A: goto L_E68A;
+    case 0xE68D: goto L_E68D;
+    case 0xE68F: goto L_E68F;
+    case 0xE691: goto L_E691;
+    case 0xE693: goto L_E693;
+    case 0xE695: goto L_E695;
+    case 0xE697: goto L_E697;
+    case 0xE699: goto L_E699;
+    case 0xE69B: goto L_E69B;
+    case 0xE69D: goto L_E69D;
+    case 0xE69F: goto L_E69F;
+    case 0xE6A1: goto L_E6A1;
+    case 0xE6A3: goto L_E6A3;
+    case 0xE6A6: goto L_E6A6;
+    case 0xE6A8: goto L_E6A8;
+    case 0xE6AA: goto L_E6AA;
+    case 0xE6AB: goto L_E6AB;
+    case 0xE6AC: goto L_E6AC;
+    case 0xE6AD: goto L_E6AD;
+    case 0xE6AE: goto L_E6AE;
+    case 0xE6B0: goto L_E6B0;
+    case 0xE6B2: goto L_E6B2;
+    case 0xE6B4: goto L_E6B4;
+    case 0xE6B6: goto L_E6B6;
+    case 0xE6B7: goto L_E6B7;
+    case 0xE6B8: goto L_E6B8;
+    case 0xE6BA: goto L_E6BA;
+    case 0xE6BC: goto L_E6BC;
+    case 0xE6BE: goto L_E6BE;
+    case 0xE6C0: goto L_E6C0;
+    case 0xE6C2: goto L_E6C2;
+    case 0xE6C4: goto L_E6C4;
+    case 0xE6C5: goto L_E6C5;
+    case 0xE6C7: goto L_E6C7;
+    case 0xE6C9: goto L_E6C9;
+    case 0xE6CB: goto L_E6CB;
+    case 0xE6CD: goto L_E6CD;
+    case 0xE6CF: goto L_E6CF;
+    case 0xE6D1: goto L_E6D1;
+    case 0xE6D3: goto L_E6D3;
+    case 0xE6D6: goto L_E6D6;
+    case 0xE6D9: goto L_E6D9;
+    case 0xE6DC: goto L_E6DC;
+    case 0xE6DD: goto L_E6DD;
+    case 0xE6DE: goto L_E6DE;
+    case 0xE6E0: goto L_E6E0;
+    case 0xE6E2: goto L_E6E2;
+    case 0xE6E4: goto L_E6E4;
+    case 0xE6E5: goto L_E6E5;
+    case 0xE6E6: goto L_E6E6;
+    case 0xE6E7: goto L_E6E7;
+    case 0xE6E8: goto L_E6E8;
+    case 0xE6E9: goto L_E6E9;
+    case 0xE6EA: goto L_E6EA;
+    case 0xE6ED: goto L_E6ED;
+    case 0xE6EF: goto L_E6EF;
+    case 0xE6F1: goto L_E6F1;
+    case 0xE6F3: goto L_E6F3;
+    case 0xE6F5: goto L_E6F5;
+    case 0xE6F7: goto L_E6F7;
+    case 0xE6F9: goto L_E6F9;
+    case 0xE6FC: goto L_E6FC;
+    case 0xE6FE: goto L_E6FE;
+    case 0xE701: goto L_E701;
+    case 0xE703: goto L_E703;
+    case 0xE705: goto L_E705;
+    case 0xE707: goto L_E707;
+    case 0xE70A: goto L_E70A;
+    case 0xE70C: goto L_E70C;
+    case 0xE70E: goto L_E70E;
+    case 0xE710: goto L_E710;
+    case 0xE712: goto L_E712;
+    case 0xE715: goto L_E715;
+    case 0xE717: goto L_E717;
+    case 0xE719: goto L_E719;
+    case 0xE71B: goto L_E71B;
+    case 0xE71D: goto L_E71D;
+    case 0xE71E: goto L_E71E;
+    case 0xE720: goto L_E720;
+    case 0xE723: goto L_E723;
+    case 0xE725: goto L_E725;
+    case 0xE728: goto L_E728;
+    case 0xE72A: goto L_E72A;
+    case 0xE72C: goto L_E72C;
+    case 0xE72D: goto L_E72D;
+    case 0xE72F: goto L_E72F;
+    case 0xE731: goto L_E731;
+    case 0xE733: goto L_E733;
+    case 0xE734: goto L_E734;
+    case 0xE735: goto L_E735;
+    case 0xE737: goto L_E737;
+    case 0xE738: goto L_E738;
+    case 0xE73A: goto L_E73A;
+    case 0xE73D: goto L_E73D;
+    case 0xE73F: goto L_E73F;
+    case 0xE741: goto L_E741;
+    case 0xE742: goto L_E742;
+    case 0xE743: goto L_E743;
+    case 0xE745: goto L_E745;
+    case 0xE746: goto L_E746;
+    case 0xE747: goto L_E747;
+    case 0xE748: goto L_E748;
+    case 0xE749: goto L_E749;
+    case 0xE74B: goto L_E74B;
+    case 0xE74D: goto L_E74D;
+    case 0xE74F: goto L_E74F;
+    case 0xE751: goto L_E751;
+    case 0xE753: goto L_E753;
+    case 0xE756: goto L_E756;
+    case 0xE758: goto L_E758;
+    case 0xE75A: goto L_E75A;
+    case 0xE75D: goto L_E75D;
+    case 0xE75F: goto L_E75F;
+    case 0xE761: goto L_E761;
+    case 0xE763: goto L_E763;
+    case 0xE765: goto L_E765;
+    case 0xE767: goto L_E767;
+    case 0xE769: goto L_E769;
+    case 0xE76B: goto L_E76B;
+    case 0xE76E: goto L_E76E;
+    case 0xE771: goto L_E771;
+    case 0xE773: goto L_E773;
+    case 0xE775: goto L_E775;
+    case 0xE778: goto L_E778;
+    case 0xE77A: goto L_E77A;
+    case 0xE77C: goto L_E77C;
+    case 0xE77D: goto L_E77D;
+    case 0xE77F: goto L_E77F;
+    case 0xE782: goto L_E782;
+    case 0xE785: goto L_E785;
+    case 0xE788: goto L_E788;
+    case 0xE789: goto L_E789;
+    case 0xE78B: goto L_E78B;
+    case 0xE78E: goto L_E78E;
+    case 0xE78F: goto L_E78F;
+    case 0xE791: goto L_E791;
+    case 0xE792: goto L_E792;
+    case 0xE794: goto L_E794;
+    case 0xE795: goto L_E795;
+    case 0xE797: goto L_E797;
+    case 0xE798: goto L_E798;
+    case 0xE79A: goto L_E79A;
+    case 0xE79B: goto L_E79B;
+    case 0xE79D: goto L_E79D;
+    case 0xE79F: goto L_E79F;
+    case 0xE7A1: goto L_E7A1;
+    case 0xE7A3: goto L_E7A3;
+    case 0xE7A6: goto L_E7A6;
+    case 0xE7A8: goto L_E7A8;
+    case 0xE7AA: goto L_E7AA;
+    case 0xE7AC: goto L_E7AC;
+    case 0xE7AE: goto L_E7AE;
+    case 0xE7B1: goto L_E7B1;
+    case 0xE7B3: goto L_E7B3;
+    case 0xE7B5: goto L_E7B5;
+    case 0xE7B7: goto L_E7B7;
+    case 0xE7B9: goto L_E7B9;
+    case 0xE7BB: goto L_E7BB;
+    case 0xE7BE: goto L_E7BE;
+    case 0xE7C0: goto L_E7C0;
+    case 0xE7C2: goto L_E7C2;
+    case 0xE7C3: goto L_E7C3;
+    case 0xE7C6: goto L_E7C6;
+    case 0xE7C8: goto L_E7C8;
+    case 0xE7C9: goto L_E7C9;
+    case 0xE7CB: goto L_E7CB;
+    case 0xE7CD: goto L_E7CD;
+    case 0xE7CF: goto L_E7CF;
+    case 0xE7D2: goto L_E7D2;
+    case 0xE7D4: goto L_E7D4;
+    case 0xE7D6: goto L_E7D6;
+    case 0xE7D9: goto L_E7D9;
+    case 0xE7DB: goto L_E7DB;
+    case 0xE7DD: goto L_E7DD;
+    case 0xE7DE: goto L_E7DE;
+    case 0xE7DF: goto L_E7DF;
+    case 0xE7E1: goto L_E7E1;
+    case 0xE7E2: goto L_E7E2;
+    case 0xE7E4: goto L_E7E4;
+    case 0xE7E6: goto L_E7E6;
+    case 0xE7E8: goto L_E7E8;
+    case 0xE7EA: goto L_E7EA;
+    case 0xE7EC: goto L_E7EC;
+    case 0xE7EE: goto L_E7EE;
+    case 0xE7F0: goto L_E7F0;
+    case 0xE7F2: goto L_E7F2;
+    case 0xE7F4: goto L_E7F4;
+    case 0xE7F7: goto L_E7F7;
+    case 0xE7FA: goto L_E7FA;
+    case 0xE7FD: goto L_E7FD;
+    case 0xE800: goto L_E800;
+    case 0xE801: goto L_E801;
+    case 0xE802: goto L_E802;
+    case 0xE803: goto L_E803;
+    case 0xE804: goto L_E804;
+    case 0xE805: goto L_E805;
+    case 0xE806: goto L_E806;
+    case 0xE807: goto L_E807;
+    case 0xE808: goto L_E808;
+    case 0xE809: goto L_E809;
+    case 0xE80A: goto L_E80A;
+    case 0xE80B: goto L_E80B;
+    case 0xE80C: goto L_E80C;
+    case 0xE80D: goto L_E80D;
+    case 0xE80E: goto L_E80E;
+    case 0xE80F: goto L_E80F;
+    case 0xE810: goto L_E810;
+    case 0xE811: goto L_E811;
+    case 0xE812: goto L_E812;
+    case 0xE813: goto L_E813;
+    case 0xE814: goto L_E814;
+    case 0xE815: goto L_E815;
+    case 0xE817: goto L_E817;
+    case 0xE819: goto L_E819;
+    case 0xE81B: goto L_E81B;
+    case 0xE81D: goto L_E81D;
+    case 0xE81E: goto L_E81E;
+    case 0xE81F: goto L_E81F;
+    case 0xE820: goto L_E820;
+    case 0xE821: goto L_E821;
+    case 0xE822: goto L_E822;
+    case 0xE823: goto L_E823;
+    case 0xE825: goto L_E825;
+    case 0xE827: goto L_E827;
+    case 0xE82A: goto L_E82A;
+    case 0xE82C: goto L_E82C;
+    case 0xE82E: goto L_E82E;
+    case 0xE831: goto L_E831;
+    case 0xE833: goto L_E833;
+    case 0xE835: goto L_E835;
+    case 0xE837: goto L_E837;
+    case 0xE839: goto L_E839;
+    case 0xE83B: goto L_E83B;
+    case 0xE83D: goto L_E83D;
+    case 0xE83F: goto L_E83F;
+    case 0xE841: goto L_E841;
+    case 0xE843: goto L_E843;
+    case 0xE845: goto L_E845;
+    case 0xE847: goto L_E847;
+    case 0xE849: goto L_E849;
+    case 0xE84C: goto L_E84C;
+    case 0xE84E: goto L_E84E;
+    case 0xE851: goto L_E851;
+    case 0xE852: goto L_E852;
+    case 0xE854: goto L_E854;
+    case 0xE855: goto L_E855;
+    case 0xE857: goto L_E857;
+    case 0xE858: goto L_E858;
+    case 0xE85A: goto L_E85A;
+    case 0xE85B: goto L_E85B;
+    case 0xE85D: goto L_E85D;
+    case 0xE85E: goto L_E85E;
+    case 0xE860: goto L_E860;
+    case 0xE862: goto L_E862;
+    case 0xE864: goto L_E864;
+    case 0xE866: goto L_E866;
+    case 0xE869: goto L_E869;
+    case 0xE86B: goto L_E86B;
+    case 0xE86D: goto L_E86D;
+    case 0xE870: goto L_E870;
+    case 0xE872: goto L_E872;
+    case 0xE874: goto L_E874;
+    case 0xE876: goto L_E876;
+    case 0xE879: goto L_E879;
+    case 0xE87B: goto L_E87B;
+    case 0xE87D: goto L_E87D;
+    case 0xE87F: goto L_E87F;
+    case 0xE881: goto L_E881;
+    case 0xE883: goto L_E883;
+    case 0xE885: goto L_E885;
+    case 0xE886: goto L_E886;
+    case 0xE888: goto L_E888;
+    case 0xE88A: goto L_E88A;
+    case 0xE88C: goto L_E88C;
+    case 0xE88E: goto L_E88E;
+    case 0xE891: goto L_E891;
+    case 0xE893: goto L_E893;
+    case 0xE895: goto L_E895;
+    case 0xE897: goto L_E897;
+    case 0xE899: goto L_E899;
+    case 0xE89B: goto L_E89B;
+    case 0xE89D: goto L_E89D;
+    case 0xE89F: goto L_E89F;
+    case 0xE8A0: goto L_E8A0;
+    case 0xE8A2: goto L_E8A2;
+    case 0xE8A5: goto L_E8A5;
+    case 0xE8A6: goto L_E8A6;
+    case 0xE8A8: goto L_E8A8;
+    case 0xE8AB: goto L_E8AB;
+    case 0xE8AE: goto L_E8AE;
+    case 0xE8B1: goto L_E8B1;
+    case 0xE8B3: goto L_E8B3;
+    case 0xE8B5: goto L_E8B5;
+    case 0xE8B8: goto L_E8B8;
+    case 0xE8BB: goto L_E8BB;
+    case 0xE8BD: goto L_E8BD;
+    case 0xE8C0: goto L_E8C0;
+    case 0xE8C3: goto L_E8C3;
+    case 0xE8C5: goto L_E8C5;
+    case 0xE8C7: goto L_E8C7;
+    case 0xE8C8: goto L_E8C8;
+    case 0xE8CA: goto L_E8CA;
+    case 0xE8CC: goto L_E8CC;
+    case 0xE8CF: goto L_E8CF;
+    case 0xE8D1: goto L_E8D1;
+    case 0xE8D3: goto L_E8D3;
+    case 0xE8D5: goto L_E8D5;
+    case 0xE8D8: goto L_E8D8;
+    case 0xE8DA: goto L_E8DA;
+    case 0xE8DC: goto L_E8DC;
+    case 0xE8DE: goto L_E8DE;
+    case 0xE8E0: goto L_E8E0;
+    case 0xE8E2: goto L_E8E2;
+    case 0xE8E5: goto L_E8E5;
+    case 0xE8E8: goto L_E8E8;
+    case 0xE8EA: goto L_E8EA;
+    case 0xE8EC: goto L_E8EC;
+    case 0xE8EE: goto L_E8EE;
+    case 0xE8F0: goto L_E8F0;
+    case 0xE8F1: goto L_E8F1;
+    case 0xE8F3: goto L_E8F3;
+    case 0xE8F4: goto L_E8F4;
+    case 0xE8F6: goto L_E8F6;
+    case 0xE8F7: goto L_E8F7;
+    case 0xE8F9: goto L_E8F9;
+    case 0xE8FA: goto L_E8FA;
+    case 0xE8FC: goto L_E8FC;
+    case 0xE8FE: goto L_E8FE;
+    case 0xE900: goto L_E900;
+    case 0xE902: goto L_E902;
+    case 0xE903: goto L_E903;
+    case 0xE905: goto L_E905;
+    case 0xE906: goto L_E906;
+    case 0xE908: goto L_E908;
+    case 0xE909: goto L_E909;
+    case 0xE90B: goto L_E90B;
+    case 0xE90D: goto L_E90D;
+    case 0xE90F: goto L_E90F;
+    case 0xE911: goto L_E911;
+    case 0xE912: goto L_E912;
+    case 0xE914: goto L_E914;
+    case 0xE917: goto L_E917;
+    case 0xE919: goto L_E919;
+    case 0xE91A: goto L_E91A;
+    case 0xE91C: goto L_E91C;
+    case 0xE91D: goto L_E91D;
+    case 0xE920: goto L_E920;
+    case 0xE975: goto L_E975;
+    case 0xE977: goto L_E977;
+    case 0xE978: goto L_E978;
+    case 0xE97A: goto L_E97A;
+    case 0xE97B: goto L_E97B;
+    case 0xE97D: goto L_E97D;
+    case 0xE97E: goto L_E97E;
+    case 0xE980: goto L_E980;
+    case 0xE981: goto L_E981;
+    case 0xE983: goto L_E983;
+    case 0xE985: goto L_E985;
+    case 0xE987: goto L_E987;
+    case 0xE989: goto L_E989;
+    case 0xE98A: goto L_E98A;
+    case 0xE98D: goto L_E98D;
+    case 0xE98F: goto L_E98F;
+    case 0xE991: goto L_E991;
+    case 0xE994: goto L_E994;
+    case 0xE996: goto L_E996;
+    case 0xE998: goto L_E998;
+    case 0xE99B: goto L_E99B;
+    case 0xE99D: goto L_E99D;
+    case 0xE9A0: goto L_E9A0;
+    case 0xE9A2: goto L_E9A2;
+    case 0xE9A4: goto L_E9A4;
+    case 0xE9A6: goto L_E9A6;
+    case 0xE9A8: goto L_E9A8;
+    case 0xE9AA: goto L_E9AA;
+    case 0xE9AC: goto L_E9AC;
+    case 0xE9AE: goto L_E9AE;
+    case 0xE9AF: goto L_E9AF;
+    case 0xE9B1: goto L_E9B1;
+    case 0xE9B3: goto L_E9B3;
+    case 0xE9B5: goto L_E9B5;
+    case 0xE9B7: goto L_E9B7;
+    case 0xE9B9: goto L_E9B9;
+    case 0xE9BB: goto L_E9BB;
+    case 0xE9BD: goto L_E9BD;
+    case 0xE9BF: goto L_E9BF;
+    case 0xE9C1: goto L_E9C1;
+    case 0xE9C3: goto L_E9C3;
+    case 0xE9C6: goto L_E9C6;
+    case 0xE9C9: goto L_E9C9;
+    case 0xE9CB: goto L_E9CB;
+    case 0xE9CC: goto L_E9CC;
+    case 0xE9CE: goto L_E9CE;
+    case 0xE9D1: goto L_E9D1;
+    case 0xE9D2: goto L_E9D2;
+    case 0xE9D4: goto L_E9D4;
+    case 0xE9D6: goto L_E9D6;
+    case 0xE9D7: goto L_E9D7;
+    case 0xE9D8: goto L_E9D8;
+    case 0xE9DA: goto L_E9DA;
+    case 0xE9DB: goto L_E9DB;
+    case 0xE9DD: goto L_E9DD;
+    case 0xE9DF: goto L_E9DF;
+    case 0xE9E1: goto L_E9E1;
+    case 0xE9E2: goto L_E9E2;
+    case 0xE9E4: goto L_E9E4;
+    case 0xE9E5: goto L_E9E5;
+    case 0xE9E7: goto L_E9E7;
+    case 0xE9E8: goto L_E9E8;
+    case 0xE9EA: goto L_E9EA;
+    case 0xE9EB: goto L_E9EB;
+    case 0xE9ED: goto L_E9ED;
+    case 0xE9EE: goto L_E9EE;
+    case 0xE9F0: goto L_E9F0;
+    case 0xE9F1: goto L_E9F1;
+    case 0xE9F3: goto L_E9F3;
+    case 0xE9F5: goto L_E9F5;
+    case 0xE9F7: goto L_E9F7;
+    case 0xE9F9: goto L_E9F9;
+    case 0xE9FB: goto L_E9FB;
+    case 0xE9FD: goto L_E9FD;
+    case 0xEA00: goto L_EA00;
+    case 0xEA02: goto L_EA02;
+    case 0xEA03: goto L_EA03;
+    case 0xEA05: goto L_EA05;
+    case 0xEA08: goto L_EA08;
+    case 0xEA0A: goto L_EA0A;
+    case 0xEA0B: goto L_EA0B;
+    case 0xEA0D: goto L_EA0D;
+    case 0xEA0E: goto L_EA0E;
+    case 0xEA10: goto L_EA10;
+    case 0xEA11: goto L_EA11;
+    case 0xEA13: goto L_EA13;
+    case 0xEA14: goto L_EA14;
+    case 0xEA16: goto L_EA16;
+    case 0xEA17: goto L_EA17;
+    case 0xEA1A: goto L_EA1A;
+    case 0xEA1C: goto L_EA1C;
+    case 0xEA1E: goto L_EA1E;
+    case 0xEA20: goto L_EA20;
+    case 0xEA23: goto L_EA23;
+    case 0xEA25: goto L_EA25;
+    case 0xEA27: goto L_EA27;
+    case 0xEA2A: goto L_EA2A;
+    case 0xEA2C: goto L_EA2C;
+    case 0xEA2F: goto L_EA2F;
+    case 0xEA31: goto L_EA31;
+    case 0xEA33: goto L_EA33;
+    case 0xEA35: goto L_EA35;
+    case 0xEA37: goto L_EA37;
+    case 0xEA39: goto L_EA39;
+    case 0xEA3B: goto L_EA3B;
+    case 0xEA3D: goto L_EA3D;
+    case 0xEA3F: goto L_EA3F;
+    case 0xEA41: goto L_EA41;
+    case 0xEA42: goto L_EA42;
+    case 0xEA44: goto L_EA44;
+    case 0xEA46: goto L_EA46;
+    case 0xEA49: goto L_EA49;
+    case 0xEA4A: goto L_EA4A;
+    case 0xEA4C: goto L_EA4C;
+    case 0xEA4D: goto L_EA4D;
+    case 0xEA4F: goto L_EA4F;
+    case 0xEA50: goto L_EA50;
+    case 0xEA52: goto L_EA52;
+    case 0xEA53: goto L_EA53;
+    case 0xEA55: goto L_EA55;
+    case 0xEA56: goto L_EA56;
+    case 0xEA58: goto L_EA58;
+    case 0xEA5B: goto L_EA5B;
+    case 0xEA5D: goto L_EA5D;
+    case 0xEA60: goto L_EA60;
+    case 0xEA62: goto L_EA62;
+    case 0xEA64: goto L_EA64;
+    case 0xEA66: goto L_EA66;
+    case 0xEA68: goto L_EA68;
+    case 0xEA6A: goto L_EA6A;
+    case 0xEA6B: goto L_EA6B;
+    case 0xEA6D: goto L_EA6D;
+    case 0xEA6E: goto L_EA6E;
+    case 0xEA71: goto L_EA71;
+    case 0xEA73: goto L_EA73;
+    case 0xEA75: goto L_EA75;
+    case 0xEA77: goto L_EA77;
+    case 0xEA79: goto L_EA79;
+    case 0xEA7B: goto L_EA7B;
+    case 0xEA7D: goto L_EA7D;
+    case 0xEA7E: goto L_EA7E;
+    case 0xEA81: goto L_EA81;
+    case 0xEA83: goto L_EA83;
+    case 0xEA85: goto L_EA85;
+    case 0xEA87: goto L_EA87;
+    case 0xEA8A: goto L_EA8A;
+    case 0xEA8C: goto L_EA8C;
+    case 0xEA8D: goto L_EA8D;
+    case 0xEA8F: goto L_EA8F;
+    case 0xEA92: goto L_EA92;
+    case 0xEA95: goto L_EA95;
+    case 0xEA97: goto L_EA97;
+    case 0xEA99: goto L_EA99;
+    case 0xEA9B: goto L_EA9B;
+    case 0xEA9D: goto L_EA9D;
+    case 0xEA9E: goto L_EA9E;
+    case 0xEAA0: goto L_EAA0;
+    case 0xEAA1: goto L_EAA1;
+    case 0xEAA2: goto L_EAA2;
+    case 0xEAA4: goto L_EAA4;
+    case 0xEAA6: goto L_EAA6;
+    case 0xEAA9: goto L_EAA9;
+    case 0xEAAA: goto L_EAAA;
+    case 0xEAAC: goto L_EAAC;
+    case 0xEAAE: goto L_EAAE;
+    case 0xEAAF: goto L_EAAF;
+    case 0xEAB1: goto L_EAB1;
+    case 0xEAB2: goto L_EAB2;
+    case 0xEAB4: goto L_EAB4;
+    case 0xEAB6: goto L_EAB6;
+    case 0xEAB8: goto L_EAB8;
+    case 0xEABA: goto L_EABA;
+    case 0xEABC: goto L_EABC;
+    case 0xEABE: goto L_EABE;
+    case 0xEABF: goto L_EABF;
+    case 0xEAC2: goto L_EAC2;
+    case 0xEAC4: goto L_EAC4;
+    case 0xEAC6: goto L_EAC6;
+    case 0xEAC8: goto L_EAC8;
+    case 0xEACA: goto L_EACA;
+    case 0xEACC: goto L_EACC;
+    case 0xEACE: goto L_EACE;
+    case 0xEAD0: goto L_EAD0;
+    case 0xEAD2: goto L_EAD2;
+    case 0xEAD5: goto L_EAD5;
+    case 0xEAD7: goto L_EAD7;
+    case 0xEAD9: goto L_EAD9;
+    case 0xEADB: goto L_EADB;
+    case 0xEADD: goto L_EADD;
+    case 0xEAE0: goto L_EAE0;
+    case 0xEAE2: goto L_EAE2;
+    case 0xEAE5: goto L_EAE5;
+    case 0xEAE8: goto L_EAE8;
+    case 0xEAEA: goto L_EAEA;
+    case 0xEAEC: goto L_EAEC;
+    case 0xEAEF: goto L_EAEF;
+    case 0xEAF2: goto L_EAF2;
+    case 0xEAF4: goto L_EAF4;
+    case 0xEAF6: goto L_EAF6;
+    case 0xEAF8: goto L_EAF8;
+    case 0xEAFA: goto L_EAFA;
+    case 0xEAFD: goto L_EAFD;
+    case 0xEAFF: goto L_EAFF;
+    case 0xEB01: goto L_EB01;
+    case 0xEB03: goto L_EB03;
+    case 0xEB05: goto L_EB05;
+    case 0xEB08: goto L_EB08;
+    case 0xEB0A: goto L_EB0A;
+    case 0xEB0D: goto L_EB0D;
+    case 0xEB0F: goto L_EB0F;
+    case 0xEB12: goto L_EB12;
+    case 0xEB15: goto L_EB15;
+    case 0xEB18: goto L_EB18;
+    case 0xEB19: goto L_EB19;
+    case 0xEB1A: goto L_EB1A;
+    case 0xEB1B: goto L_EB1B;
+    case 0xEB1C: goto L_EB1C;
+    case 0xEB1D: goto L_EB1D;
+    case 0xEB1E: goto L_EB1E;
+    case 0xEB20: goto L_EB20;
+    case 0xEB23: goto L_EB23;
+    case 0xEB25: goto L_EB25;
+    case 0xEB27: goto L_EB27;
+    case 0xEB2A: goto L_EB2A;
+    case 0xEB2D: goto L_EB2D;
+    case 0xEB2F: goto L_EB2F;
+    case 0xEB31: goto L_EB31;
+    case 0xEB33: goto L_EB33;
+    case 0xEB36: goto L_EB36;
+    case 0xEB38: goto L_EB38;
+    case 0xEB3A: goto L_EB3A;
+    case 0xEB3C: goto L_EB3C;
+    case 0xEB3E: goto L_EB3E;
+    case 0xEB40: goto L_EB40;
+    case 0xEB42: goto L_EB42;
+    case 0xEB45: goto L_EB45;
+    case 0xEB48: goto L_EB48;
+    case 0xEB4A: goto L_EB4A;
+    case 0xEB4B: goto L_EB4B;
+    case 0xEB4D: goto L_EB4D;
+    case 0xEB4E: goto L_EB4E;
+    case 0xEB50: goto L_EB50;
+    case 0xEB52: goto L_EB52;
+    case 0xEB54: goto L_EB54;
+    case 0xEB56: goto L_EB56;
+    case 0xEB58: goto L_EB58;
+    case 0xEB5B: goto L_EB5B;
+    case 0xEB5E: goto L_EB5E;
+    case 0xEB60: goto L_EB60;
+    case 0xEB62: goto L_EB62;
+    case 0xEB63: goto L_EB63;
+    case 0xEB64: goto L_EB64;
+    case 0xEB66: goto L_EB66;
+    case 0xEB68: goto L_EB68;
+    case 0xEB69: goto L_EB69;
+    case 0xEB6B: goto L_EB6B;
+    case 0xEB6C: goto L_EB6C;
+    case 0xEB6F: goto L_EB6F;
+    case 0xEB71: goto L_EB71;
+    case 0xEB8F: goto L_EB8F;
+    case 0xEB91: goto L_EB91;
+    case 0xEB93: goto L_EB93;
+    case 0xEB95: goto L_EB95;
+    case 0xEB97: goto L_EB97;
+    case 0xEB99: goto L_EB99;
+    case 0xEB9B: goto L_EB9B;
+    case 0xEB9D: goto L_EB9D;
+    case 0xEB9F: goto L_EB9F;
+    case 0xEBA1: goto L_EBA1;
+    case 0xEBA4: goto L_EBA4;
+    case 0xEBA6: goto L_EBA6;
+    case 0xEBA9: goto L_EBA9;
+    case 0xEBAB: goto L_EBAB;
+    case 0xEBAE: goto L_EBAE;
+    case 0xEBB0: goto L_EBB0;
+    case 0xEBB2: goto L_EBB2;
+    case 0xEBB5: goto L_EBB5;
+    case 0xEBB7: goto L_EBB7;
+    case 0xEBB8: goto L_EBB8;
+    case 0xEBBA: goto L_EBBA;
+    case 0xEBBC: goto L_EBBC;
+    case 0xEBBE: goto L_EBBE;
+    case 0xEBC1: goto L_EBC1;
+    case 0xEBC4: goto L_EBC4;
+    case 0xEBC6: goto L_EBC6;
+    case 0xEBC8: goto L_EBC8;
+    case 0xEBC9: goto L_EBC9;
+    case 0xEBCB: goto L_EBCB;
+    case 0xEBCE: goto L_EBCE;
+    case 0xEBD0: goto L_EBD0;
+    case 0xEBD3: goto L_EBD3;
+    case 0xEBD4: goto L_EBD4;
+    case 0xEBD6: goto L_EBD6;
+    case 0xEBD8: goto L_EBD8;
+    case 0xEBDB: goto L_EBDB;
+    case 0xED21: goto L_ED21;
+    case 0xED23: goto L_ED23;
+    case 0xED25: goto L_ED25;
+    case 0xED27: goto L_ED27;
+    case 0xED2A: goto L_ED2A;
+    case 0xED2D: goto L_ED2D;
+    case 0xED30: goto L_ED30;
+    case 0xED32: goto L_ED32;
+    case 0xED34: goto L_ED34;
+    case 0xED36: goto L_ED36;
+    case 0xED39: goto L_ED39;
+    case 0xED3C: goto L_ED3C;
+    case 0xED3F: goto L_ED3F;
+    case 0xED41: goto L_ED41;
+    case 0xED43: goto L_ED43;
+    case 0xED45: goto L_ED45;
+    case 0xED48: goto L_ED48;
+    case 0xED4B: goto L_ED4B;
+    case 0xED4D: goto L_ED4D;
+    case 0xED4F: goto L_ED4F;
+    case 0xED51: goto L_ED51;
+    case 0xED53: goto L_ED53;
+    case 0xED56: goto L_ED56;
+    case 0xED59: goto L_ED59;
+    case 0xED5B: goto L_ED5B;
+    case 0xED5C: goto L_ED5C;
+    case 0xED5E: goto L_ED5E;
+    case 0xED60: goto L_ED60;
+    case 0xED62: goto L_ED62;
+    case 0xED63: goto L_ED63;
+    case 0xED65: goto L_ED65;
+    case 0xED66: goto L_ED66;
+    case 0xEE14: goto L_EE14;
+    case 0xEE16: goto L_EE16;
+    case 0xEE17: goto L_EE17;
+    case 0xEE19: goto L_EE19;
+    case 0xEE1C: goto L_EE1C;
+    case 0xEE1D: goto L_EE1D;
+    case 0xEE1F: goto L_EE1F;
+    case 0xEE21: goto L_EE21;
+    case 0xEE22: goto L_EE22;
+    case 0xEE24: goto L_EE24;
+    case 0xEE27: goto L_EE27;
+    case 0xEE29: goto L_EE29;
+    case 0xEE2B: goto L_EE2B;
+    case 0xEE2C: goto L_EE2C;
+    case 0xEE2E: goto L_EE2E;
+    case 0xEE31: goto L_EE31;
+    case 0xEE33: goto L_EE33;
+    case 0xEE35: goto L_EE35;
+    case 0xEE38: goto L_EE38;
+    case 0xEE3B: goto L_EE3B;
+    case 0xEE3D: goto L_EE3D;
+    case 0xEE40: goto L_EE40;
+    case 0xEE43: goto L_EE43;
+    case 0xEE46: goto L_EE46;
+    case 0xEE49: goto L_EE49;
+    case 0xEE4A: goto L_EE4A;
+    case 0xEE4D: goto L_EE4D;
+    case 0xEE50: goto L_EE50;
+    case 0xEE51: goto L_EE51;
+    case 0xEE53: goto L_EE53;
+    case 0xEE56: goto L_EE56;
+    case 0xEE58: goto L_EE58;
+    case 0xEE5A: goto L_EE5A;
+    case 0xEE5D: goto L_EE5D;
+    case 0xEE5E: goto L_EE5E;
+    case 0xEE60: goto L_EE60;
+    case 0xEE63: goto L_EE63;
+    case 0xEE64: goto L_EE64;
+    case 0xEE66: goto L_EE66;
+    case 0xEE69: goto L_EE69;
+    case 0xEE6A: goto L_EE6A;
+    case 0xEE6C: goto L_EE6C;
+    case 0xEE6F: goto L_EE6F;
+    case 0xEE71: goto L_EE71;
+    case 0xEE73: goto L_EE73;
+    case 0xEE76: goto L_EE76;
+    case 0xEE79: goto L_EE79;
+    case 0xEE7B: goto L_EE7B;
+    case 0xEE7C: goto L_EE7C;
+    case 0xEE7D: goto L_EE7D;
+    case 0xEE7F: goto L_EE7F;
+    case 0xEE81: goto L_EE81;
+    case 0xEE83: goto L_EE83;
+    case 0xEE86: goto L_EE86;
+    case 0xEE88: goto L_EE88;
+    case 0xEE8B: goto L_EE8B;
+    case 0xEE8E: goto L_EE8E;
+    case 0xEE8F: goto L_EE8F;
+    case 0xEE90: goto L_EE90;
+    case 0xEE91: goto L_EE91;
+    case 0xEE92: goto L_EE92;
+    case 0xEE95: goto L_EE95;
+    case 0xEE97: goto L_EE97;
+    case 0xEE99: goto L_EE99;
+    case 0xEE9C: goto L_EE9C;
+    case 0xEE9E: goto L_EE9E;
+    case 0xEEA0: goto L_EEA0;
+    case 0xEEA2: goto L_EEA2;
+    case 0xEEA5: goto L_EEA5;
+    case 0xEEA8: goto L_EEA8;
+    case 0xEEAA: goto L_EEAA;
+    case 0xEEAC: goto L_EEAC;
+    case 0xEEAF: goto L_EEAF;
+    case 0xEEB0: goto L_EEB0;
+    case 0xEEB2: goto L_EEB2;
+    case 0xEEB3: goto L_EEB3;
+    case 0xEEB4: goto L_EEB4;
+    case 0xEEB6: goto L_EEB6;
+    case 0xEEB7: goto L_EEB7;
+    case 0xEEB9: goto L_EEB9;
+    case 0xEEBC: goto L_EEBC;
+    case 0xEEBD: goto L_EEBD;
+    case 0xEEBE: goto L_EEBE;
+    case 0xEEC0: goto L_EEC0;
+    case 0xEEC2: goto L_EEC2;
+    case 0xEEC5: goto L_EEC5;
+    case 0xEEC8: goto L_EEC8;
+    case 0xEECA: goto L_EECA;
+    case 0xEECD: goto L_EECD;
+    case 0xEECE: goto L_EECE;
+    case 0xEED0: goto L_EED0;
+    case 0xEED3: goto L_EED3;
+    case 0xEED4: goto L_EED4;
+    case 0xEED7: goto L_EED7;
+    case 0xEEDA: goto L_EEDA;
+    case 0xEEDD: goto L_EEDD;
+    case 0xEEE0: goto L_EEE0;
+    case 0xEEE2: goto L_EEE2;
+    case 0xEEE3: goto L_EEE3;
+    case 0xEEE4: goto L_EEE4;
+    case 0xEEE6: goto L_EEE6;
+    case 0xEEE8: goto L_EEE8;
+    case 0xEEE9: goto L_EEE9;
+    case 0xEEEB: goto L_EEEB;
+    case 0xEEED: goto L_EEED;
+    case 0xEEEE: goto L_EEEE;
+    case 0xEEF1: goto L_EEF1;
+    case 0xEEF2: goto L_EEF2;
+    case 0xEEF4: goto L_EEF4;
+    case 0xEEF5: goto L_EEF5;
+    case 0xEEF6: goto L_EEF6;
+    case 0xEEF9: goto L_EEF9;
+    case 0xEEFC: goto L_EEFC;
+    case 0xEEFE: goto L_EEFE;
+    case 0xEF01: goto L_EF01;
+    case 0xEF03: goto L_EF03;
+    case 0xEF04: goto L_EF04;
+    case 0xEF06: goto L_EF06;
+    case 0xEF09: goto L_EF09;
+    case 0xEF0C: goto L_EF0C;
+    case 0xEF0D: goto L_EF0D;
+    case 0xEF0F: goto L_EF0F;
+    case 0xEF10: goto L_EF10;
+    case 0xEF12: goto L_EF12;
+    case 0xEF13: goto L_EF13;
+    case 0xEF16: goto L_EF16;
+    case 0xEF19: goto L_EF19;
+    case 0xEF1A: goto L_EF1A;
+    case 0xEF1C: goto L_EF1C;
+    case 0xEF1E: goto L_EF1E;
+    case 0xEF21: goto L_EF21;
+    case 0xEF24: goto L_EF24;
+    case 0xEF26: goto L_EF26;
+    case 0xEF29: goto L_EF29;
+    case 0xEF2B: goto L_EF2B;
+    case 0xEF2E: goto L_EF2E;
+    case 0xEF31: goto L_EF31;
+    case 0xEF33: goto L_EF33;
+    case 0xEF35: goto L_EF35;
+    case 0xEF38: goto L_EF38;
+    case 0xEF3A: goto L_EF3A;
+    case 0xEF3C: goto L_EF3C;
+    case 0xEF3E: goto L_EF3E;
+    case 0xEF40: goto L_EF40;
+    case 0xEF42: goto L_EF42;
+    case 0xEF45: goto L_EF45;
+    case 0xEF48: goto L_EF48;
+    case 0xEF4B: goto L_EF4B;
+    case 0xEF4D: goto L_EF4D;
+    case 0xEF50: goto L_EF50;
+    case 0xEF52: goto L_EF52;
+    case 0xEF54: goto L_EF54;
+    case 0xEF56: goto L_EF56;
+    case 0xEF58: goto L_EF58;
+    case 0xEF5B: goto L_EF5B;
+    case 0xEF5E: goto L_EF5E;
+    case 0xEF60: goto L_EF60;
+    case 0xEF61: goto L_EF61;
+    case 0xEF63: goto L_EF63;
+    case 0xEF64: goto L_EF64;
+    case 0xEF66: goto L_EF66;
+    case 0xEF69: goto L_EF69;
+    case 0xEF6C: goto L_EF6C;
+    case 0xEF6E: goto L_EF6E;
+    case 0xEF6F: goto L_EF6F;
+    case 0xEF71: goto L_EF71;
+    case 0xEF73: goto L_EF73;
+    case 0xEF75: goto L_EF75;
+    case 0xEF78: goto L_EF78;
+    case 0xEF7A: goto L_EF7A;
+    case 0xEF7C: goto L_EF7C;
+    case 0xEF7F: goto L_EF7F;
+    case 0xEF81: goto L_EF81;
+    case 0xEF82: goto L_EF82;
+    case 0xEF83: goto L_EF83;
+    case 0xEF84: goto L_EF84;
+    case 0xEF87: goto L_EF87;
+    case 0xEF89: goto L_EF89;
+    case 0xEF8C: goto L_EF8C;
+    case 0xEF8D: goto L_EF8D;
+    case 0xEF90: goto L_EF90;
+    case 0xEF92: goto L_EF92;
+    case 0xEF95: goto L_EF95;
+    case 0xEF96: goto L_EF96;
+    case 0xEF98: goto L_EF98;
+    case 0xEF9B: goto L_EF9B;
+    case 0xEF9E: goto L_EF9E;
+    case 0xEFA0: goto L_EFA0;
+    case 0xEFA2: goto L_EFA2;
+    case 0xEFA3: goto L_EFA3;
+    case 0xEFA5: goto L_EFA5;
+    case 0xEFA7: goto L_EFA7;
+    case 0xEFA9: goto L_EFA9;
+    case 0xEFAB: goto L_EFAB;
+    case 0xEFAD: goto L_EFAD;
+    case 0xEFAF: goto L_EFAF;
+    case 0xEFB0: goto L_EFB0;
+    case 0xEFB1: goto L_EFB1;
+    case 0xEFB3: goto L_EFB3;
+    case 0xEFB5: goto L_EFB5;
+    case 0xEFB7: goto L_EFB7;
+    case 0xEFB9: goto L_EFB9;
+    case 0xEFBA: goto L_EFBA;
+    case 0xEFBC: goto L_EFBC;
+    case 0xEFBE: goto L_EFBE;
+    case 0xEFBF: goto L_EFBF;
+    case 0xEFC1: goto L_EFC1;
+    case 0xEFC4: goto L_EFC4;
+    case 0xEFC6: goto L_EFC6;
+    case 0xEFC8: goto L_EFC8;
+    case 0xEFCA: goto L_EFCA;
+    case 0xEFCC: goto L_EFCC;
+    case 0xEFCE: goto L_EFCE;
+    case 0xEFCF: goto L_EFCF;
+    case 0xEFD1: goto L_EFD1;
+    case 0xEFD4: goto L_EFD4;
+    case 0xEFD6: goto L_EFD6;
+    case 0xEFD8: goto L_EFD8;
+    case 0xEFDA: goto L_EFDA;
+    case 0xEFDC: goto L_EFDC;
+    case 0xEFDE: goto L_EFDE;
+    case 0xEFE0: goto L_EFE0;
+    case 0xEFE2: goto L_EFE2;
+    case 0xEFE4: goto L_EFE4;
+    case 0xEFE6: goto L_EFE6;
+    case 0xEFE8: goto L_EFE8;
+    case 0xEFEA: goto L_EFEA;
+    case 0xEFEC: goto L_EFEC;
+    case 0xEFEE: goto L_EFEE;
+    case 0xEFF1: goto L_EFF1;
+    case 0xEFF2: goto L_EFF2;
+    case 0xEFF4: goto L_EFF4;
+    case 0xEFF7: goto L_EFF7;
+    case 0xEFF9: goto L_EFF9;
+    case 0xEFFB: goto L_EFFB;
+    case 0xEFFD: goto L_EFFD;
+    case 0xEFFF: goto L_EFFF;
+    case 0xF001: goto L_F001;
+    case 0xF004: goto L_F004;
+    case 0xF006: goto L_F006;
+    case 0xF009: goto L_F009;
+    case 0xF00C: goto L_F00C;
+    case 0xF00E: goto L_F00E;
+    case 0xF010: goto L_F010;
+    case 0xF012: goto L_F012;
+    case 0xF015: goto L_F015;
+    case 0xF016: goto L_F016;
+    case 0xF018: goto L_F018;
+    case 0xF019: goto L_F019;
+    case 0xF01B: goto L_F01B;
+    case 0xF01E: goto L_F01E;
+    case 0xF021: goto L_F021;
+    case 0xF023: goto L_F023;
+    case 0xF026: goto L_F026;
+    case 0xF027: goto L_F027;
+    case 0xF029: goto L_F029;
+    case 0xF02B: goto L_F02B;
+    case 0xF02E: goto L_F02E;
+    case 0xF030: goto L_F030;
+    case 0xF031: goto L_F031;
+    case 0xF033: goto L_F033;
+    case 0xF034: goto L_F034;
+    case 0xF035: goto L_F035;
+    case 0xF036: goto L_F036;
+    case 0xF038: goto L_F038;
+    case 0xF03A: goto L_F03A;
+    case 0xF03C: goto L_F03C;
+    case 0xF03E: goto L_F03E;
+    case 0xF040: goto L_F040;
+    case 0xF042: goto L_F042;
+    case 0xF044: goto L_F044;
+    case 0xF046: goto L_F046;
+    case 0xF048: goto L_F048;
+    case 0xF04A: goto L_F04A;
+    case 0xF04B: goto L_F04B;
+    case 0xF04D: goto L_F04D;
+    case 0xF04F: goto L_F04F;
+    case 0xF051: goto L_F051;
+    case 0xF054: goto L_F054;
+    case 0xF055: goto L_F055;
+    case 0xF057: goto L_F057;
+    case 0xF059: goto L_F059;
+    case 0xF05B: goto L_F05B;
+    case 0xF05D: goto L_F05D;
+    case 0xF060: goto L_F060;
+    case 0xF062: goto L_F062;
+    case 0xF064: goto L_F064;
+    case 0xF067: goto L_F067;
+    case 0xF068: goto L_F068;
+    case 0xF06A: goto L_F06A;
+    case 0xF06C: goto L_F06C;
+    case 0xF06E: goto L_F06E;
+    case 0xF06F: goto L_F06F;
+    case 0xF072: goto L_F072;
+    case 0xF073: goto L_F073;
+    case 0xF076: goto L_F076;
+    case 0xF078: goto L_F078;
+    case 0xF07B: goto L_F07B;
+    case 0xF07C: goto L_F07C;
+    case 0xF07E: goto L_F07E;
+    case 0xF081: goto L_F081;
+    case 0xF083: goto L_F083;
+    case 0xF085: goto L_F085;
+    case 0xF086: goto L_F086;
+    case 0xF087: goto L_F087;
+    case 0xF089: goto L_F089;
+    case 0xF08B: goto L_F08B;
+    case 0xF08D: goto L_F08D;
+    case 0xF090: goto L_F090;
+    case 0xF092: goto L_F092;
+    case 0xF094: goto L_F094;
+    case 0xF096: goto L_F096;
+    case 0xF098: goto L_F098;
+    case 0xF09A: goto L_F09A;
+    case 0xF09C: goto L_F09C;
+    case 0xF09D: goto L_F09D;
+    case 0xF09F: goto L_F09F;
+    case 0xF0A1: goto L_F0A1;
+    case 0xF0A2: goto L_F0A2;
+    case 0xF0A4: goto L_F0A4;
+    case 0xF0A5: goto L_F0A5;
+    case 0xF0A7: goto L_F0A7;
+    case 0xF0A8: goto L_F0A8;
+    case 0xF0AA: goto L_F0AA;
+    case 0xF0AD: goto L_F0AD;
+    case 0xF0B0: goto L_F0B0;
+    case 0xF0B3: goto L_F0B3;
+    case 0xF0B5: goto L_F0B5;
+    case 0xF0B7: goto L_F0B7;
+    case 0xF0B9: goto L_F0B9;
+    case 0xF0BC: goto L_F0BC;
+    case 0xF0BE: goto L_F0BE;
+    case 0xF0C1: goto L_F0C1;
+    case 0xF0C2: goto L_F0C2;
+    case 0xF0C4: goto L_F0C4;
+    case 0xF0C6: goto L_F0C6;
+    case 0xF0C9: goto L_F0C9;
+    case 0xF0CB: goto L_F0CB;
+    case 0xF0CD: goto L_F0CD;
+    case 0xF0D0: goto L_F0D0;
+    case 0xF0D2: goto L_F0D2;
+    case 0xF0D4: goto L_F0D4;
+    case 0xF0D7: goto L_F0D7;
+    case 0xF0D9: goto L_F0D9;
+    case 0xF0DC: goto L_F0DC;
+    case 0xF0DE: goto L_F0DE;
+    case 0xF0E1: goto L_F0E1;
+    case 0xF0E4: goto L_F0E4;
+    case 0xF0E6: goto L_F0E6;
+    case 0xF0E8: goto L_F0E8;
+    case 0xF0EB: goto L_F0EB;
+    case 0xF0EC: goto L_F0EC;
+    case 0xF0ED: goto L_F0ED;
+    case 0xF0F0: goto L_F0F0;
+    case 0xF0F1: goto L_F0F1;
+    case 0xF0F4: goto L_F0F4;
+    case 0xF0F6: goto L_F0F6;
+    case 0xF0F9: goto L_F0F9;
+    case 0xF0FA: goto L_F0FA;
+    case 0xF0FC: goto L_F0FC;
+    case 0xF0FF: goto L_F0FF;
+    case 0xF101: goto L_F101;
+    case 0xF102: goto L_F102;
+    case 0xF105: goto L_F105;
+    case 0xF108: goto L_F108;
+    case 0xF10B: goto L_F10B;
+    case 0xF10E: goto L_F10E;
+    case 0xF110: goto L_F110;
+    case 0xF113: goto L_F113;
+    case 0xF116: goto L_F116;
+    case 0xF118: goto L_F118;
+    case 0xF11B: goto L_F11B;
+    case 0xF11C: goto L_F11C;
+    case 0xF11E: goto L_F11E;
+    case 0xF120: goto L_F120;
+    case 0xF122: goto L_F122;
+    case 0xF124: goto L_F124;
+    case 0xF127: goto L_F127;
+    case 0xF129: goto L_F129;
+    case 0xF12B: goto L_F12B;
+    case 0xF12E: goto L_F12E;
+    case 0xF130: goto L_F130;
+    case 0xF133: goto L_F133;
+    case 0xF135: goto L_F135;
+    case 0xF138: goto L_F138;
+    case 0xF13B: goto L_F13B;
+    case 0xF13D: goto L_F13D;
+    case 0xF13F: goto L_F13F;
+    case 0xF141: goto L_F141;
+    case 0xF144: goto L_F144;
+    case 0xF145: goto L_F145;
+    case 0xF146: goto L_F146;
+    case 0xF149: goto L_F149;
+    case 0xF14B: goto L_F14B;
+    case 0xF14D: goto L_F14D;
+    case 0xF14E: goto L_F14E;
+    case 0xF14F: goto L_F14F;
+    case 0xF152: goto L_F152;
+    case 0xF155: goto L_F155;
+    case 0xF157: goto L_F157;
+    case 0xF159: goto L_F159;
+    case 0xF15C: goto L_F15C;
+    case 0xF15D: goto L_F15D;
+    case 0xF15F: goto L_F15F;
+    case 0xF160: goto L_F160;
+    case 0xF161: goto L_F161;
+    case 0xF164: goto L_F164;
+    case 0xF166: goto L_F166;
+    case 0xF169: goto L_F169;
+    case 0xF16B: goto L_F16B;
+    case 0xF16D: goto L_F16D;
+    case 0xF16F: goto L_F16F;
+    case 0xF172: goto L_F172;
+    case 0xF173: goto L_F173;
+    case 0xF1E2: goto L_F1E2;
+    case 0xF1E4: goto L_F1E4;
+    case 0xF1E6: goto L_F1E6;
+    case 0xF1E9: goto L_F1E9;
+    case 0xF1EA: goto L_F1EA;
+    case 0xF1EC: goto L_F1EC;
+    case 0xF1EF: goto L_F1EF;
+    case 0xF1F0: goto L_F1F0;
+    case 0xF1F1: goto L_F1F1;
+    case 0xF1F3: goto L_F1F3;
+    case 0xF1F4: goto L_F1F4;
+    case 0xF1F5: goto L_F1F5;
+    case 0xF1F7: goto L_F1F7;
+    case 0xF1F9: goto L_F1F9;
+    case 0xF1FB: goto L_F1FB;
+    case 0xF1FD: goto L_F1FD;
+    case 0xF1FE: goto L_F1FE;
+    case 0xF201: goto L_F201;
+    case 0xF203: goto L_F203;
+    case 0xF205: goto L_F205;
+    case 0xF207: goto L_F207;
+    case 0xF20A: goto L_F20A;
+    case 0xF20C: goto L_F20C;
+    case 0xF20D: goto L_F20D;
+    case 0xF20E: goto L_F20E;
+    case 0xF210: goto L_F210;
+    case 0xF212: goto L_F212;
+    case 0xF214: goto L_F214;
+    case 0xF216: goto L_F216;
+    case 0xF218: goto L_F218;
+    case 0xF21A: goto L_F21A;
+    case 0xF21D: goto L_F21D;
+    case 0xF21F: goto L_F21F;
+    case 0xF221: goto L_F221;
+    case 0xF223: goto L_F223;
+    case 0xF225: goto L_F225;
+    case 0xF227: goto L_F227;
+    case 0xF22A: goto L_F22A;
+    case 0xF22C: goto L_F22C;
+    case 0xF22E: goto L_F22E;
+    case 0xF230: goto L_F230;
+    case 0xF232: goto L_F232;
+    case 0xF235: goto L_F235;
+    case 0xF237: goto L_F237;
+    case 0xF238: goto L_F238;
+    case 0xF23B: goto L_F23B;
+    case 0xF23D: goto L_F23D;
+    case 0xF23F: goto L_F23F;
+    case 0xF241: goto L_F241;
+    case 0xF244: goto L_F244;
+    case 0xF246: goto L_F246;
+    case 0xF248: goto L_F248;
+    case 0xF249: goto L_F249;
+    case 0xF24A: goto L_F24A;
+    case 0xF24B: goto L_F24B;
+    case 0xF24C: goto L_F24C;
+    case 0xF24D: goto L_F24D;
+    case 0xF24F: goto L_F24F;
+    case 0xF250: goto L_F250;
+    case 0xF253: goto L_F253;
+    case 0xF255: goto L_F255;
+    case 0xF258: goto L_F258;
+    case 0xF25A: goto L_F25A;
+    case 0xF25C: goto L_F25C;
+    case 0xF25E: goto L_F25E;
+    case 0xF260: goto L_F260;
+    case 0xF262: goto L_F262;
+    case 0xF263: goto L_F263;
+    case 0xF264: goto L_F264;
+    case 0xF266: goto L_F266;
+    case 0xF268: goto L_F268;
+    case 0xF26A: goto L_F26A;
+    case 0xF26B: goto L_F26B;
+    case 0xF26C: goto L_F26C;
+    case 0xF26F: goto L_F26F;
+    case 0xF272: goto L_F272;
+    case 0xF274: goto L_F274;
+    case 0xF276: goto L_F276;
+    case 0xF278: goto L_F278;
+    case 0xF279: goto L_F279;
+    case 0xF27A: goto L_F27A;
+    case 0xF27B: goto L_F27B;
+    case 0xF27D: goto L_F27D;
+    case 0xF27F: goto L_F27F;
+    case 0xF281: goto L_F281;
+    case 0xF282: goto L_F282;
+    case 0xF285: goto L_F285;
+    case 0xF287: goto L_F287;
+    case 0xF288: goto L_F288;
+    case 0xF28B: goto L_F28B;
+    case 0xF28D: goto L_F28D;
+    case 0xF28F: goto L_F28F;
+    case 0xF290: goto L_F290;
+    case 0xF292: goto L_F292;
+    case 0xF293: goto L_F293;
+    case 0xF294: goto L_F294;
+    case 0xF295: goto L_F295;
+    case 0xF296: goto L_F296;
+    case 0xF297: goto L_F297;
+    case 0xF29A: goto L_F29A;
+    case 0xF29C: goto L_F29C;
+    case 0xF29F: goto L_F29F;
+    case 0xF2A1: goto L_F2A1;
+    case 0xF2A3: goto L_F2A3;
+    case 0xF2A5: goto L_F2A5;
+    case 0xF2A7: goto L_F2A7;
+    case 0xF2A8: goto L_F2A8;
+    case 0xF2AA: goto L_F2AA;
+    case 0xF2AC: goto L_F2AC;
+    case 0xF2AE: goto L_F2AE;
+    case 0xF2AF: goto L_F2AF;
+    case 0xF2B0: goto L_F2B0;
+    case 0xF2B1: goto L_F2B1;
+    case 0xF2B2: goto L_F2B2;
+    case 0xF2B3: goto L_F2B3;
+    case 0xF2B4: goto L_F2B4;
+    case 0xF2B6: goto L_F2B6;
+    case 0xF2B8: goto L_F2B8;
+    case 0xF2B9: goto L_F2B9;
+    case 0xF2BA: goto L_F2BA;
+    case 0xF2BC: goto L_F2BC;
+    case 0xF2BE: goto L_F2BE;
+    case 0xF2C1: goto L_F2C1;
+    case 0xF2C3: goto L_F2C3;
+    case 0xF2C5: goto L_F2C5;
+    case 0xF2C6: goto L_F2C6;
+    case 0xF2C7: goto L_F2C7;
+    case 0xF2CA: goto L_F2CA;
+    case 0xF2CC: goto L_F2CC;
+    case 0xF2CF: goto L_F2CF;
+    case 0xF2D2: goto L_F2D2;
+    case 0xF2D4: goto L_F2D4;
+    case 0xF2D6: goto L_F2D6;
+    case 0xF2D8: goto L_F2D8;
+    case 0xF2DA: goto L_F2DA;
+    case 0xF2DC: goto L_F2DC;
+    case 0xF2DE: goto L_F2DE;
+    case 0xF2E0: goto L_F2E0;
+    case 0xF2E3: goto L_F2E3;
+    case 0xF2E5: goto L_F2E5;
+    case 0xF2E7: goto L_F2E7;
+    case 0xF2E9: goto L_F2E9;
+    case 0xF2EC: goto L_F2EC;
+    case 0xF2EE: goto L_F2EE;
+    case 0xF2EF: goto L_F2EF;
+    case 0xF2F0: goto L_F2F0;
+    case 0xF2F1: goto L_F2F1;
+    case 0xF2F4: goto L_F2F4;
+    case 0xF2F6: goto L_F2F6;
+    case 0xF2F8: goto L_F2F8;
+    case 0xF2FB: goto L_F2FB;
+    case 0xF2FE: goto L_F2FE;
+    case 0xF301: goto L_F301;
+    case 0xF302: goto L_F302;
+    case 0xF304: goto L_F304;
+    case 0xF306: goto L_F306;
+    case 0xF309: goto L_F309;
+    case 0xF30C: goto L_F30C;
+    case 0xF30E: goto L_F30E;
+    case 0xF311: goto L_F311;
+    case 0xF314: goto L_F314;
+    case 0xF316: goto L_F316;
+    case 0xF318: goto L_F318;
+    case 0xF31B: goto L_F31B;
+    case 0xF31D: goto L_F31D;
+    case 0xF31F: goto L_F31F;
+    case 0xF321: goto L_F321;
+    case 0xF323: goto L_F323;
+    case 0xF325: goto L_F325;
+    case 0xF328: goto L_F328;
+    case 0xF32A: goto L_F32A;
+    case 0xF32C: goto L_F32C;
+    case 0xF32E: goto L_F32E;
+    case 0xF330: goto L_F330;
+    case 0xF331: goto L_F331;
+    case 0xF332: goto L_F332;
+    case 0xF333: goto L_F333;
+    case 0xF336: goto L_F336;
+    case 0xF338: goto L_F338;
+    case 0xF33A: goto L_F33A;
+    case 0xF33D: goto L_F33D;
+    case 0xF33F: goto L_F33F;
+    case 0xF342: goto L_F342;
+    case 0xF343: goto L_F343;
+    case 0xF345: goto L_F345;
+    case 0xF347: goto L_F347;
+    case 0xF34A: goto L_F34A;
+    case 0xF34D: goto L_F34D;
+    case 0xF34F: goto L_F34F;
+    case 0xF350: goto L_F350;
+    case 0xF351: goto L_F351;
+    case 0xF354: goto L_F354;
+    case 0xF355: goto L_F355;
+    case 0xF356: goto L_F356;
+    case 0xF358: goto L_F358;
+    case 0xF35A: goto L_F35A;
+    case 0xF35C: goto L_F35C;
+    case 0xF35E: goto L_F35E;
+    case 0xF360: goto L_F360;
+    case 0xF362: goto L_F362;
+    case 0xF364: goto L_F364;
+    case 0xF365: goto L_F365;
+    case 0xF368: goto L_F368;
+    case 0xF36A: goto L_F36A;
+    case 0xF36D: goto L_F36D;
+    case 0xF36F: goto L_F36F;
+    case 0xF372: goto L_F372;
+    case 0xF374: goto L_F374;
+    case 0xF377: goto L_F377;
+    case 0xF37A: goto L_F37A;
+    case 0xF37C: goto L_F37C;
+    case 0xF37E: goto L_F37E;
+    case 0xF37F: goto L_F37F;
+    case 0xF381: goto L_F381;
+    case 0xF383: goto L_F383;
+    case 0xF384: goto L_F384;
+    case 0xF386: goto L_F386;
+    case 0xF388: goto L_F388;
+    case 0xF38A: goto L_F38A;
+    case 0xF38D: goto L_F38D;
+    case 0xF38F: goto L_F38F;
+    case 0xF391: goto L_F391;
+    case 0xF393: goto L_F393;
+    case 0xF396: goto L_F396;
+    case 0xF398: goto L_F398;
+    case 0xF39B: goto L_F39B;
+    case 0xF39E: goto L_F39E;
+    case 0xF3A0: goto L_F3A0;
+    case 0xF3A2: goto L_F3A2;
+    case 0xF3A4: goto L_F3A4;
+    case 0xF3A6: goto L_F3A6;
+    case 0xF3A8: goto L_F3A8;
+    case 0xF3AB: goto L_F3AB;
+    case 0xF3AE: goto L_F3AE;
+    case 0xF3B1: goto L_F3B1;
+    case 0xF3B2: goto L_F3B2;
+    case 0xF3B3: goto L_F3B3;
+    case 0xF3B5: goto L_F3B5;
+    case 0xF3B7: goto L_F3B7;
+    case 0xF3B9: goto L_F3B9;
+    case 0xF3BB: goto L_F3BB;
+    case 0xF3BE: goto L_F3BE;
+    case 0xF3C1: goto L_F3C1;
+    case 0xF3C4: goto L_F3C4;
+    case 0xF3C7: goto L_F3C7;
+    case 0xF3CA: goto L_F3CA;
+    case 0xF3CD: goto L_F3CD;
+    case 0xF3CE: goto L_F3CE;
+    case 0xF3CF: goto L_F3CF;
+    case 0xF3D1: goto L_F3D1;
+    case 0xF3D3: goto L_F3D3;
+    case 0xF3D4: goto L_F3D4;
+    case 0xF3D6: goto L_F3D6;
+    case 0xF3D7: goto L_F3D7;
+    case 0xF3D9: goto L_F3D9;
+    case 0xF3DC: goto L_F3DC;
+    case 0xF3DE: goto L_F3DE;
+    case 0xF3DF: goto L_F3DF;
+    case 0xF3E2: goto L_F3E2;
+    case 0xF3E4: goto L_F3E4;
+    case 0xF3E7: goto L_F3E7;
+    case 0xF3E9: goto L_F3E9;
+    case 0xF3EC: goto L_F3EC;
+    case 0xF3EE: goto L_F3EE;
+    case 0xF3EF: goto L_F3EF;
+    case 0xF3F1: goto L_F3F1;
+    case 0xF3F3: goto L_F3F3;
+    case 0xF3F5: goto L_F3F5;
+    case 0xF3F7: goto L_F3F7;
+    case 0xF3F9: goto L_F3F9;
+    case 0xF3FC: goto L_F3FC;
+    case 0xF3FE: goto L_F3FE;
+    case 0xF400: goto L_F400;
+    case 0xF403: goto L_F403;
+    case 0xF405: goto L_F405;
+    case 0xF407: goto L_F407;
+    case 0xF409: goto L_F409;
+    case 0xF40A: goto L_F40A;
+    case 0xF40C: goto L_F40C;
+    case 0xF40E: goto L_F40E;
+    case 0xF411: goto L_F411;
+    case 0xF414: goto L_F414;
+    case 0xF416: goto L_F416;
+    case 0xF419: goto L_F419;
+    case 0xF41B: goto L_F41B;
+    case 0xF41D: goto L_F41D;
+    case 0xF41F: goto L_F41F;
+    case 0xF422: goto L_F422;
+    case 0xF424: goto L_F424;
+    case 0xF426: goto L_F426;
+    case 0xF429: goto L_F429;
+    case 0xF42B: goto L_F42B;
+    case 0xF42D: goto L_F42D;
+    case 0xF42F: goto L_F42F;
+    case 0xF432: goto L_F432;
+    case 0xF434: goto L_F434;
+    case 0xF437: goto L_F437;
+    case 0xF439: goto L_F439;
+    case 0xF43B: goto L_F43B;
+    case 0xF43D: goto L_F43D;
+    case 0xF43F: goto L_F43F;
+    case 0xF442: goto L_F442;
+    case 0xF444: goto L_F444;
+    case 0xF446: goto L_F446;
+    case 0xF448: goto L_F448;
+    case 0xF44B: goto L_F44B;
+    case 0xF44E: goto L_F44E;
+    case 0xF450: goto L_F450;
+    case 0xF453: goto L_F453;
+    case 0xF455: goto L_F455;
+    case 0xF457: goto L_F457;
+    case 0xF459: goto L_F459;
+    case 0xF45C: goto L_F45C;
+    case 0xF45E: goto L_F45E;
+    case 0xF461: goto L_F461;
+    case 0xF463: goto L_F463;
+    case 0xF465: goto L_F465;
+    case 0xF468: goto L_F468;
+    case 0xF46A: goto L_F46A;
+    case 0xF46C: goto L_F46C;
+    case 0xF46F: goto L_F46F;
+    case 0xF472: goto L_F472;
+    case 0xF474: goto L_F474;
+    case 0xF476: goto L_F476;
+    case 0xF478: goto L_F478;
+    case 0xF47B: goto L_F47B;
+    case 0xF47D: goto L_F47D;
+    case 0xF47F: goto L_F47F;
+    case 0xF482: goto L_F482;
+    case 0xF484: goto L_F484;
+    case 0xF486: goto L_F486;
+    case 0xF488: goto L_F488;
+    case 0xF48A: goto L_F48A;
+    case 0xF48C: goto L_F48C;
+    case 0xF48E: goto L_F48E;
+    case 0xF490: goto L_F490;
+    case 0xF491: goto L_F491;
+    case 0xF493: goto L_F493;
+    case 0xF494: goto L_F494;
+    case 0xF495: goto L_F495;
+    case 0xF497: goto L_F497;
+    case 0xF499: goto L_F499;
+    case 0xF49B: goto L_F49B;
+    case 0xF49D: goto L_F49D;
+    case 0xF49F: goto L_F49F;
+    case 0xF4A2: goto L_F4A2;
+    case 0xF4A4: goto L_F4A4;
+    case 0xF4A6: goto L_F4A6;
+    case 0xF4A9: goto L_F4A9;
+    case 0xF4AB: goto L_F4AB;
+    case 0xF4AD: goto L_F4AD;
+    case 0xF4AE: goto L_F4AE;
+    case 0xF4AF: goto L_F4AF;
+    case 0xF4B2: goto L_F4B2;
+    case 0xF4B4: goto L_F4B4;
+    case 0xF4B6: goto L_F4B6;
+    case 0xF4B8: goto L_F4B8;
+    case 0xF4BA: goto L_F4BA;
+    case 0xF4BD: goto L_F4BD;
+    case 0xF4BE: goto L_F4BE;
+    case 0xF4C0: goto L_F4C0;
+    case 0xF4C2: goto L_F4C2;
+    case 0xF4C5: goto L_F4C5;
+    case 0xF4C6: goto L_F4C6;
+    case 0xF4C7: goto L_F4C7;
+    case 0xF4C9: goto L_F4C9;
+    case 0xF4CC: goto L_F4CC;
+    case 0xF4CF: goto L_F4CF;
+    case 0xF4D1: goto L_F4D1;
+    case 0xF4D4: goto L_F4D4;
+    case 0xF4D6: goto L_F4D6;
+    case 0xF4D9: goto L_F4D9;
+    case 0xF4DB: goto L_F4DB;
+    case 0xF4DD: goto L_F4DD;
+    case 0xF4DF: goto L_F4DF;
+    case 0xF4E2: goto L_F4E2;
+    case 0xF4E3: goto L_F4E3;
+    case 0xF4E5: goto L_F4E5;
+    case 0xF4E7: goto L_F4E7;
+    case 0xF4EA: goto L_F4EA;
+    case 0xF4ED: goto L_F4ED;
+    case 0xF4F0: goto L_F4F0;
+    case 0xF4F2: goto L_F4F2;
+    case 0xF4F4: goto L_F4F4;
+    case 0xF4F5: goto L_F4F5;
+    case 0xF4F6: goto L_F4F6;
+    case 0xF4F9: goto L_F4F9;
+    case 0xF4FA: goto L_F4FA;
+    case 0xF4FB: goto L_F4FB;
+    case 0xF4FE: goto L_F4FE;
+    case 0xF4FF: goto L_F4FF;
+    case 0xF500: goto L_F500;
+    case 0xF501: goto L_F501;
+    case 0xF503: goto L_F503;
+    case 0xF506: goto L_F506;
+    case 0xF507: goto L_F507;
+    case 0xF509: goto L_F509;
+    case 0xF50C: goto L_F50C;
+    case 0xF50F: goto L_F50F;
+    case 0xF510: goto L_F510;
+    case 0xF512: goto L_F512;
+    case 0xF515: goto L_F515;
+    case 0xF516: goto L_F516;
+    case 0xF518: goto L_F518;
+    case 0xF51B: goto L_F51B;
+    case 0xF51E: goto L_F51E;
+    case 0xF521: goto L_F521;
+    case 0xF524: goto L_F524;
+    case 0xF527: goto L_F527;
+    case 0xF52A: goto L_F52A;
+    case 0xF52C: goto L_F52C;
+    case 0xF52E: goto L_F52E;
+    case 0xF52F: goto L_F52F;
+    case 0xF531: goto L_F531;
+    case 0xF533: goto L_F533;
+    case 0xF535: goto L_F535;
+    case 0xF537: goto L_F537;
+    case 0xF538: goto L_F538;
+    case 0xF53A: goto L_F53A;
+    case 0xF53C: goto L_F53C;
+    case 0xF53D: goto L_F53D;
+    case 0xF53F: goto L_F53F;
+    case 0xF542: goto L_F542;
+    case 0xF544: goto L_F544;
+    case 0xF546: goto L_F546;
+    case 0xF549: goto L_F549;
+    case 0xF54B: goto L_F54B;
+    case 0xF54D: goto L_F54D;
+    case 0xF54F: goto L_F54F;
+    case 0xF551: goto L_F551;
+    case 0xF553: goto L_F553;
+    case 0xF556: goto L_F556;
+    case 0xF558: goto L_F558;
+    case 0xF55A: goto L_F55A;
+    case 0xF55C: goto L_F55C;
+    case 0xF55E: goto L_F55E;
+    case 0xF560: goto L_F560;
+    case 0xF563: goto L_F563;
+    case 0xF566: goto L_F566;
+    case 0xF568: goto L_F568;
+    case 0xF56A: goto L_F56A;
+    case 0xF56D: goto L_F56D;
+    case 0xF56F: goto L_F56F;
+    case 0xF572: goto L_F572;
+    case 0xF574: goto L_F574;
+    case 0xF577: goto L_F577;
+    case 0xF57A: goto L_F57A;
+    case 0xF57C: goto L_F57C;
+    case 0xF57E: goto L_F57E;
+    case 0xF57F: goto L_F57F;
+    case 0xF580: goto L_F580;
+    case 0xF582: goto L_F582;
+    case 0xF585: goto L_F585;
+    case 0xF587: goto L_F587;
+    case 0xF58A: goto L_F58A;
+    case 0xF58C: goto L_F58C;
+    case 0xF58E: goto L_F58E;
+    case 0xF590: goto L_F590;
+    case 0xF593: goto L_F593;
+    case 0xF595: goto L_F595;
+    case 0xF598: goto L_F598;
+    case 0xF59B: goto L_F59B;
+    case 0xF59C: goto L_F59C;
+    case 0xF59E: goto L_F59E;
+    case 0xF59F: goto L_F59F;
+    case 0xF5A0: goto L_F5A0;
+    case 0xF5A2: goto L_F5A2;
+    case 0xF5A3: goto L_F5A3;
+    case 0xF5A5: goto L_F5A5;
+    case 0xF5A7: goto L_F5A7;
+    case 0xF5A9: goto L_F5A9;
+    case 0xF5AB: goto L_F5AB;
+    case 0xF5AD: goto L_F5AD;
+    case 0xF5AF: goto L_F5AF;
+    case 0xF5B2: goto L_F5B2;
+    case 0xF5B3: goto L_F5B3;
+    case 0xF5B5: goto L_F5B5;
+    case 0xF5B7: goto L_F5B7;
+    case 0xF5B9: goto L_F5B9;
+    case 0xF5BB: goto L_F5BB;
+    case 0xF5BD: goto L_F5BD;
+    case 0xF5BF: goto L_F5BF;
+    case 0xF5C2: goto L_F5C2;
+    case 0xF5C5: goto L_F5C5;
+    case 0xF5C7: goto L_F5C7;
+    case 0xF5CA: goto L_F5CA;
+    case 0xF5CC: goto L_F5CC;
+    case 0xF5CE: goto L_F5CE;
+    case 0xF5D1: goto L_F5D1;
+    case 0xF5D4: goto L_F5D4;
+    case 0xF5D6: goto L_F5D6;
+    case 0xF5D9: goto L_F5D9;
+    case 0xF5DC: goto L_F5DC;
+    case 0xF5DE: goto L_F5DE;
+    case 0xF5E1: goto L_F5E1;
+    case 0xF5E3: goto L_F5E3;
+    case 0xF5E5: goto L_F5E5;
+    case 0xF5E8: goto L_F5E8;
+    case 0xF5EA: goto L_F5EA;
+    case 0xF5EC: goto L_F5EC;
+    case 0xF5EE: goto L_F5EE;
+    case 0xF5F1: goto L_F5F1;
+    case 0xF5F3: goto L_F5F3;
+    case 0xF5F5: goto L_F5F5;
+    case 0xF5F7: goto L_F5F7;
+    case 0xF5F9: goto L_F5F9;
+    case 0xF5FA: goto L_F5FA;
+    case 0xF5FC: goto L_F5FC;
+    case 0xF5FE: goto L_F5FE;
+    case 0xF600: goto L_F600;
+    case 0xF602: goto L_F602;
+    case 0xF604: goto L_F604;
+    case 0xF606: goto L_F606;
+    case 0xF608: goto L_F608;
+    case 0xF60A: goto L_F60A;
+    case 0xF60B: goto L_F60B;
+    case 0xF60D: goto L_F60D;
+    case 0xF60F: goto L_F60F;
+    case 0xF611: goto L_F611;
+    case 0xF613: goto L_F613;
+    case 0xF615: goto L_F615;
+    case 0xF617: goto L_F617;
+    case 0xF619: goto L_F619;
+    case 0xF61B: goto L_F61B;
+    case 0xF61D: goto L_F61D;
+    case 0xF61E: goto L_F61E;
+    case 0xF620: goto L_F620;
+    case 0xF622: goto L_F622;
+    case 0xF624: goto L_F624;
+    case 0xF626: goto L_F626;
+    case 0xF627: goto L_F627;
+    case 0xF628: goto L_F628;
+    case 0xF629: goto L_F629;
+    case 0xF62B: goto L_F62B;
+    case 0xF62D: goto L_F62D;
+    case 0xF62E: goto L_F62E;
+    case 0xF630: goto L_F630;
+    case 0xF632: goto L_F632;
+    case 0xF634: goto L_F634;
+    case 0xF636: goto L_F636;
+    case 0xF638: goto L_F638;
+    case 0xF63A: goto L_F63A;
+    case 0xF63D: goto L_F63D;
+    case 0xF640: goto L_F640;
+    case 0xF641: goto L_F641;
+    case 0xF642: goto L_F642;
+    case 0xF644: goto L_F644;
+    case 0xF646: goto L_F646;
+    case 0xF647: goto L_F647;
+    case 0xF649: goto L_F649;
+    case 0xF64B: goto L_F64B;
+    case 0xF64D: goto L_F64D;
+    case 0xF650: goto L_F650;
+    case 0xF652: goto L_F652;
+    case 0xF654: goto L_F654;
+    case 0xF656: goto L_F656;
+    case 0xF659: goto L_F659;
+    case 0xF65B: goto L_F65B;
+    case 0xF65D: goto L_F65D;
+    case 0xF65F: goto L_F65F;
+    case 0xF661: goto L_F661;
+    case 0xF664: goto L_F664;
+    case 0xF665: goto L_F665;
+    case 0xF667: goto L_F667;
+    case 0xF669: goto L_F669;
+    case 0xF66A: goto L_F66A;
+    case 0xF66C: goto L_F66C;
+    case 0xF66E: goto L_F66E;
+    case 0xF670: goto L_F670;
+    case 0xF672: goto L_F672;
+    case 0xF675: goto L_F675;
+    case 0xF677: goto L_F677;
+    case 0xF679: goto L_F679;
+    case 0xF67A: goto L_F67A;
+    case 0xF67C: goto L_F67C;
+    case 0xF67E: goto L_F67E;
+    case 0xF680: goto L_F680;
+    case 0xF682: goto L_F682;
+    case 0xF685: goto L_F685;
+    case 0xF687: goto L_F687;
+    case 0xF689: goto L_F689;
+    case 0xF68C: goto L_F68C;
+    case 0xF68E: goto L_F68E;
+    case 0xF690: goto L_F690;
+    case 0xF692: goto L_F692;
+    case 0xF694: goto L_F694;
+    case 0xF696: goto L_F696;
+    case 0xF698: goto L_F698;
+    case 0xF69A: goto L_F69A;
+    case 0xF69D: goto L_F69D;
+    case 0xF6A0: goto L_F6A0;
+    case 0xF6A3: goto L_F6A3;
+    case 0xF6A5: goto L_F6A5;
+    case 0xF6A8: goto L_F6A8;
+    case 0xF6AA: goto L_F6AA;
+    case 0xF6AD: goto L_F6AD;
+    case 0xF6AF: goto L_F6AF;
+    case 0xF6B2: goto L_F6B2;
+    case 0xF6B4: goto L_F6B4;
+    case 0xF6B7: goto L_F6B7;
+    case 0xF6B9: goto L_F6B9;
+    case 0xF6BC: goto L_F6BC;
+    case 0xF6BF: goto L_F6BF;
+    case 0xF6C1: goto L_F6C1;
+    case 0xF6C3: goto L_F6C3;
+    case 0xF6C6: goto L_F6C6;
+    case 0xF6C9: goto L_F6C9;
+    case 0xF6CB: goto L_F6CB;
+    case 0xF6CE: goto L_F6CE;
+    case 0xF6D0: goto L_F6D0;
+    case 0xF6D1: goto L_F6D1;
+    case 0xF6D2: goto L_F6D2;
+    case 0xF6D5: goto L_F6D5;
+    case 0xF6D7: goto L_F6D7;
+    case 0xF6DA: goto L_F6DA;
+    case 0xF6DC: goto L_F6DC;
+    case 0xF6DE: goto L_F6DE;
+    case 0xF6E0: goto L_F6E0;
+    case 0xF6E3: goto L_F6E3;
+    case 0xF6E5: goto L_F6E5;
+    case 0xF6E7: goto L_F6E7;
+    case 0xF6E9: goto L_F6E9;
+    case 0xF6EC: goto L_F6EC;
+    case 0xF6EF: goto L_F6EF;
+    case 0xF6F0: goto L_F6F0;
+    case 0xF6F1: goto L_F6F1;
+    case 0xF6F3: goto L_F6F3;
+    case 0xF6F5: goto L_F6F5;
+    case 0xF6F8: goto L_F6F8;
+    case 0xF6FB: goto L_F6FB;
+    case 0xF6FD: goto L_F6FD;
+    case 0xF700: goto L_F700;
+    case 0xF702: goto L_F702;
+    case 0xF705: goto L_F705;
+    case 0xF707: goto L_F707;
+    case 0xF709: goto L_F709;
+    case 0xF70B: goto L_F70B;
+    case 0xF70D: goto L_F70D;
+    case 0xF70F: goto L_F70F;
+    case 0xF710: goto L_F710;
+    case 0xF713: goto L_F713;
+    case 0xF715: goto L_F715;
+    case 0xF718: goto L_F718;
+    case 0xF71A: goto L_F71A;
+    case 0xF71C: goto L_F71C;
+    case 0xF71E: goto L_F71E;
+    case 0xF720: goto L_F720;
+    case 0xF722: goto L_F722;
+    case 0xF725: goto L_F725;
+    case 0xF726: goto L_F726;
+    case 0xF727: goto L_F727;
+    case 0xF728: goto L_F728;
+    case 0xF72A: goto L_F72A;
+    case 0xF72C: goto L_F72C;
+    case 0xF72E: goto L_F72E;
+    case 0xF731: goto L_F731;
+    case 0xF734: goto L_F734;
+    case 0xF736: goto L_F736;
+    case 0xF738: goto L_F738;
+    case 0xF73A: goto L_F73A;
+    case 0xF73C: goto L_F73C;
+    case 0xF73E: goto L_F73E;
+    case 0xF740: goto L_F740;
+    case 0xF741: goto L_F741;
+    case 0xF743: goto L_F743;
+    case 0xF745: goto L_F745;
+    case 0xF747: goto L_F747;
+    case 0xF749: goto L_F749;
+    case 0xF74B: goto L_F74B;
+    case 0xF74D: goto L_F74D;
+    case 0xF74F: goto L_F74F;
+    case 0xF751: goto L_F751;
+    case 0xF753: goto L_F753;
+    case 0xF755: goto L_F755;
+    case 0xF758: goto L_F758;
+    case 0xF75B: goto L_F75B;
+    case 0xF75D: goto L_F75D;
+    case 0xF75F: goto L_F75F;
+    case 0xF760: goto L_F760;
+    case 0xF761: goto L_F761;
+    case 0xF763: goto L_F763;
+    case 0xF765: goto L_F765;
+    case 0xF767: goto L_F767;
+    case 0xF768: goto L_F768;
+    case 0xF76A: goto L_F76A;
+    case 0xF76C: goto L_F76C;
+    case 0xF76E: goto L_F76E;
+    case 0xF76F: goto L_F76F;
+    case 0xF770: goto L_F770;
+    case 0xF772: goto L_F772;
+    case 0xF774: goto L_F774;
+    case 0xF776: goto L_F776;
+    case 0xF777: goto L_F777;
+    case 0xF77A: goto L_F77A;
+    case 0xF77C: goto L_F77C;
+    case 0xF77D: goto L_F77D;
+    case 0xF77E: goto L_F77E;
+    case 0xF780: goto L_F780;
+    case 0xF781: goto L_F781;
+    case 0xF783: goto L_F783;
+    case 0xF784: goto L_F784;
+    case 0xF786: goto L_F786;
+    case 0xF787: goto L_F787;
+    case 0xF789: goto L_F789;
+    case 0xF78A: goto L_F78A;
+    case 0xF78C: goto L_F78C;
+    case 0xF78D: goto L_F78D;
+    case 0xF78F: goto L_F78F;
+    case 0xF790: goto L_F790;
+    case 0xF792: goto L_F792;
+    case 0xF793: goto L_F793;
+    case 0xF795: goto L_F795;
+    case 0xF796: goto L_F796;
+    case 0xF798: goto L_F798;
+    case 0xF799: goto L_F799;
+    case 0xF79C: goto L_F79C;
+    case 0xF79E: goto L_F79E;
+    case 0xF7A0: goto L_F7A0;
+    case 0xF7A2: goto L_F7A2;
+    case 0xF7A5: goto L_F7A5;
+    case 0xF7A6: goto L_F7A6;
+    case 0xF7A7: goto L_F7A7;
+    case 0xF7A9: goto L_F7A9;
+    case 0xF7AC: goto L_F7AC;
+    case 0xF7AD: goto L_F7AD;
+    case 0xF7AE: goto L_F7AE;
+    case 0xF7AF: goto L_F7AF;
+    case 0xF7B1: goto L_F7B1;
+    case 0xF7B2: goto L_F7B2;
+    case 0xF7B5: goto L_F7B5;
+    case 0xF7B6: goto L_F7B6;
+    case 0xF7B8: goto L_F7B8;
+    case 0xF7BA: goto L_F7BA;
+    case 0xF7BC: goto L_F7BC;
+    case 0xF7BE: goto L_F7BE;
+    case 0xF7C0: goto L_F7C0;
+    case 0xF7C2: goto L_F7C2;
+    case 0xF7C4: goto L_F7C4;
+    case 0xF7C6: goto L_F7C6;
+    case 0xF7C8: goto L_F7C8;
+    case 0xF7CA: goto L_F7CA;
+    case 0xF7CC: goto L_F7CC;
+    case 0xF7CE: goto L_F7CE;
+    case 0xF7CF: goto L_F7CF;
+    case 0xF7D1: goto L_F7D1;
+    case 0xF7D3: goto L_F7D3;
+    case 0xF7D5: goto L_F7D5;
+    case 0xF7D8: goto L_F7D8;
+    case 0xF7DA: goto L_F7DA;
+    case 0xF7DC: goto L_F7DC;
+    case 0xF7DF: goto L_F7DF;
+    case 0xF7E0: goto L_F7E0;
+    case 0xF7E2: goto L_F7E2;
+    case 0xF7E4: goto L_F7E4;
+    case 0xF7E5: goto L_F7E5;
+    case 0xF7E6: goto L_F7E6;
+    case 0xF7E7: goto L_F7E7;
+    case 0xF7E9: goto L_F7E9;
+    case 0xF7EC: goto L_F7EC;
+    case 0xF7EE: goto L_F7EE;
+    case 0xF7F0: goto L_F7F0;
+    case 0xF7F1: goto L_F7F1;
+    case 0xF7F3: goto L_F7F3;
+    case 0xF7F4: goto L_F7F4;
+    case 0xF7F6: goto L_F7F6;
+    case 0xF7F7: goto L_F7F7;
+    case 0xF7F9: goto L_F7F9;
+    case 0xF7FA: goto L_F7FA;
+    case 0xF7FC: goto L_F7FC;
+    case 0xF7FE: goto L_F7FE;
+    case 0xF800: goto L_F800;
+    case 0xF801: goto L_F801;
+    case 0xF803: goto L_F803;
+    case 0xF805: goto L_F805;
+    case 0xF807: goto L_F807;
+    case 0xF808: goto L_F808;
+    case 0xF80A: goto L_F80A;
+    case 0xF80C: goto L_F80C;
+    case 0xF80D: goto L_F80D;
+    case 0xF80F: goto L_F80F;
+    case 0xF811: goto L_F811;
+    case 0xF812: goto L_F812;
+    case 0xF814: goto L_F814;
+    case 0xF816: goto L_F816;
+    case 0xF817: goto L_F817;
+    case 0xF819: goto L_F819;
+    case 0xF81B: goto L_F81B;
+    case 0xF81C: goto L_F81C;
+    case 0xF81E: goto L_F81E;
+    case 0xF820: goto L_F820;
+    case 0xF822: goto L_F822;
+    case 0xF824: goto L_F824;
+    case 0xF826: goto L_F826;
+    case 0xF828: goto L_F828;
+    case 0xF82A: goto L_F82A;
+    case 0xF82C: goto L_F82C;
+    case 0xF82E: goto L_F82E;
+    case 0xF830: goto L_F830;
+    case 0xF832: goto L_F832;
+    case 0xF834: goto L_F834;
+    case 0xF837: goto L_F837;
+    case 0xF839: goto L_F839;
+    case 0xF83B: goto L_F83B;
+    case 0xF83E: goto L_F83E;
+    case 0xF83F: goto L_F83F;
+    case 0xF840: goto L_F840;
+    case 0xF842: goto L_F842;
+    case 0xF843: goto L_F843;
+    case 0xF845: goto L_F845;
+    case 0xF846: goto L_F846;
+    case 0xF848: goto L_F848;
+    case 0xF849: goto L_F849;
+    case 0xF84B: goto L_F84B;
+    case 0xF84C: goto L_F84C;
+    case 0xF84D: goto L_F84D;
+    case 0xF84F: goto L_F84F;
+    case 0xF851: goto L_F851;
+    case 0xF853: goto L_F853;
+    case 0xF854: goto L_F854;
+    case 0xF857: goto L_F857;
+    case 0xF858: goto L_F858;
+    case 0xF85A: goto L_F85A;
+    case 0xF85B: goto L_F85B;
+    case 0xF85D: goto L_F85D;
+    case 0xF85F: goto L_F85F;
+    case 0xF860: goto L_F860;
+    case 0xF862: goto L_F862;
+    case 0xF864: goto L_F864;
+    case 0xF866: goto L_F866;
+    case 0xF867: goto L_F867;
+    case 0xF86A: goto L_F86A;
+    case 0xF86C: goto L_F86C;
+    case 0xF86E: goto L_F86E;
+    case 0xF870: goto L_F870;
+    case 0xF872: goto L_F872;
+    case 0xF874: goto L_F874;
+    case 0xF876: goto L_F876;
+    case 0xF878: goto L_F878;
+    case 0xF87A: goto L_F87A;
+    case 0xF87C: goto L_F87C;
+    case 0xF87E: goto L_F87E;
+    case 0xF880: goto L_F880;
+    case 0xF882: goto L_F882;
+    case 0xF884: goto L_F884;
+    case 0xF886: goto L_F886;
+    case 0xF888: goto L_F888;
+    case 0xF889: goto L_F889;
+    case 0xF88A: goto L_F88A;
+    case 0xF88D: goto L_F88D;
+    case 0xF88F: goto L_F88F;
+    case 0xF891: goto L_F891;
+    case 0xF893: goto L_F893;
+    case 0xF894: goto L_F894;
+    case 0xF897: goto L_F897;
+    case 0xF899: goto L_F899;
+    case 0xF89B: goto L_F89B;
+    case 0xF89E: goto L_F89E;
+    case 0xF8A1: goto L_F8A1;
+    case 0xF8A4: goto L_F8A4;
+    case 0xF8A6: goto L_F8A6;
+    case 0xF8A8: goto L_F8A8;
+    case 0xF8AB: goto L_F8AB;
+    case 0xF8AD: goto L_F8AD;
+    case 0xF8B0: goto L_F8B0;
+    case 0xF8B2: goto L_F8B2;
+    case 0xF8B5: goto L_F8B5;
+    case 0xF8B6: goto L_F8B6;
+    case 0xF8B7: goto L_F8B7;
+    case 0xF8BA: goto L_F8BA;
+    case 0xF8BC: goto L_F8BC;
+    case 0xF8BE: goto L_F8BE;
+    case 0xF8C0: goto L_F8C0;
+    case 0xF8C2: goto L_F8C2;
+    case 0xF8C4: goto L_F8C4;
+    case 0xF8C6: goto L_F8C6;
+    case 0xF8C9: goto L_F8C9;
+    case 0xF8CC: goto L_F8CC;
+    case 0xF8CE: goto L_F8CE;
+    case 0xF8CF: goto L_F8CF;
+    case 0xF8D1: goto L_F8D1;
+    case 0xF8D3: goto L_F8D3;
+    case 0xF8D5: goto L_F8D5;
+    case 0xF8D7: goto L_F8D7;
+    case 0xF8D9: goto L_F8D9;
+    case 0xF8DB: goto L_F8DB;
+    case 0xF8DD: goto L_F8DD;
+    case 0xF8DF: goto L_F8DF;
+    case 0xF8E1: goto L_F8E1;
+    case 0xF8E3: goto L_F8E3;
+    case 0xF8E6: goto L_F8E6;
+    case 0xF8E8: goto L_F8E8;
+    case 0xF8EA: goto L_F8EA;
+    case 0xF8ED: goto L_F8ED;
+    case 0xF8EF: goto L_F8EF;
+    case 0xF8F0: goto L_F8F0;
+    case 0xF8F2: goto L_F8F2;
+    case 0xF8F4: goto L_F8F4;
+    case 0xF8F6: goto L_F8F6;
+    case 0xF8F9: goto L_F8F9;
+    case 0xF8FC: goto L_F8FC;
+    case 0xF8FF: goto L_F8FF;
+    case 0xF902: goto L_F902;
+    case 0xF905: goto L_F905;
+    case 0xF908: goto L_F908;
+    case 0xF90B: goto L_F90B;
+    case 0xF90E: goto L_F90E;
+    case 0xF910: goto L_F910;
+    case 0xF912: goto L_F912;
+    case 0xF915: goto L_F915;
+    case 0xF918: goto L_F918;
+    case 0xF91A: goto L_F91A;
+    case 0xF91C: goto L_F91C;
+    case 0xF91F: goto L_F91F;
+    case 0xF921: goto L_F921;
+    case 0xF923: goto L_F923;
+    case 0xF925: goto L_F925;
+    case 0xF926: goto L_F926;
+    case 0xF928: goto L_F928;
+    case 0xF929: goto L_F929;
+    case 0xF92B: goto L_F92B;
+    case 0xF92E: goto L_F92E;
+    case 0xF92F: goto L_F92F;
+    case 0xF932: goto L_F932;
+    case 0xF935: goto L_F935;
+    case 0xF936: goto L_F936;
+    case 0xF938: goto L_F938;
+    case 0xF93B: goto L_F93B;
+    case 0xF93E: goto L_F93E;
+    case 0xF940: goto L_F940;
+    case 0xF942: goto L_F942;
+    case 0xF945: goto L_F945;
+    case 0xF948: goto L_F948;
+    case 0xF94B: goto L_F94B;
+    case 0xF94E: goto L_F94E;
+    case 0xF94F: goto L_F94F;
+    case 0xF951: goto L_F951;
+    case 0xF954: goto L_F954;
+    case 0xF955: goto L_F955;
+    case 0xF956: goto L_F956;
+    case 0xF957: goto L_F957;
+    case 0xF959: goto L_F959;
+    case 0xF95C: goto L_F95C;
+    case 0xFBD2: goto L_FBD2;
+    case 0xFBD4: goto L_FBD4;
+    case 0xFBD6: goto L_FBD6;
+    case 0xFBD8: goto L_FBD8;
+    case 0xFBDA: goto L_FBDA;
+    case 0xFBDB: goto L_FBDB;
+    case 0xFBDD: goto L_FBDD;
+    case 0xFBDF: goto L_FBDF;
+    case 0xFBE1: goto L_FBE1;
+    case 0xFBE3: goto L_FBE3;
+    case 0xFBE5: goto L_FBE5;
+    case 0xFBE7: goto L_FBE7;
+    case 0xFBE9: goto L_FBE9;
+    case 0xFCCF: goto L_FCCF;
+    case 0xFCD0: goto L_FCD0;
+    case 0xFCD1: goto L_FCD1;
+    case 0xFCD4: goto L_FCD4;
+    case 0xFCD6: goto L_FCD6;
+    case 0xFCD9: goto L_FCD9;
+    case 0xFCDB: goto L_FCDB;
+    case 0xFCDE: goto L_FCDE;
+    case 0xFCE0: goto L_FCE0;
+    case 0xFCE3: goto L_FCE3;
+    case 0xFCE6: goto L_FCE6;
+    case 0xFCE9: goto L_FCE9;
+    case 0xFCEB: goto L_FCEB;
+    case 0xFCEE: goto L_FCEE;
+    case 0xFCF1: goto L_FCF1;
+    case 0xFCF4: goto L_FCF4;
+    case 0xFCF5: goto L_FCF5;
+    case 0xFCFB: goto L_FCFB;
+    case 0xFCFE: goto L_FCFE;
+    case 0xFD01: goto L_FD01;
+    case 0xFD04: goto L_FD04;
+    case 0xFD07: goto L_FD07;
+    case 0xFD08: goto L_FD08;
+    case 0xFD0B: goto L_FD0B;
+    case 0xFD0D: goto L_FD0D;
+    case 0xFD10: goto L_FD10;
+    case 0xFD11: goto L_FD11;
+    case 0xFD12: goto L_FD12;
+    case 0xFD14: goto L_FD14;
+    case 0xFD16: goto L_FD16;
+    case 0xFD18: goto L_FD18;
+    case 0xFD1A: goto L_FD1A;
+    case 0xFD1B: goto L_FD1B;
+    case 0xFD1D: goto L_FD1D;
+    case 0xFD1F: goto L_FD1F;
+    case 0xFD21: goto L_FD21;
+    case 0xFD22: goto L_FD22;
+    case 0xFD24: goto L_FD24;
+    case 0xFD25: goto L_FD25;
+    case 0xFD26: goto L_FD26;
+    case 0xFD27: goto L_FD27;
+    case 0xFD2A: goto L_FD2A;
+    case 0xFD2C: goto L_FD2C;
+    case 0xFD2F: goto L_FD2F;
+    case 0xFD32: goto L_FD32;
+    case 0xFD35: goto L_FD35;
+    case 0xFD38: goto L_FD38;
+    case 0xFD3B: goto L_FD3B;
+    case 0xFD3C: goto L_FD3C;
+    case 0xFD3F: goto L_FD3F;
+    case 0xFD41: goto L_FD41;
+    case 0xFD44: goto L_FD44;
+    case 0xFD47: goto L_FD47;
+    case 0xFD49: goto L_FD49;
+    case 0xFD4A: goto L_FD4A;
+    case 0xFD4C: goto L_FD4C;
+    case 0xFD52: goto L_FD52;
+    case 0xFD54: goto L_FD54;
+    case 0xFD56: goto L_FD56;
+    case 0xFD57: goto L_FD57;
+    case 0xFD59: goto L_FD59;
+    case 0xFD5B: goto L_FD5B;
+    case 0xFD5D: goto L_FD5D;
+    case 0xFD60: goto L_FD60;
+    case 0xFD62: goto L_FD62;
+    case 0xFD64: goto L_FD64;
+    case 0xFD66: goto L_FD66;
+    case 0xFD69: goto L_FD69;
+    case 0xFD6A: goto L_FD6A;
+    case 0xFD6C: goto L_FD6C;
+    case 0xFD8D: goto L_FD8D;
+    case 0xFD8F: goto L_FD8F;
+    case 0xFD90: goto L_FD90;
+    case 0xFD92: goto L_FD92;
+    case 0xFD95: goto L_FD95;
+    case 0xFD98: goto L_FD98;
+    case 0xFD99: goto L_FD99;
+    case 0xFD9B: goto L_FD9B;
+    case 0xFD9D: goto L_FD9D;
+    case 0xFD9F: goto L_FD9F;
+    case 0xFDA1: goto L_FDA1;
+    case 0xFDA3: goto L_FDA3;
+    case 0xFDA5: goto L_FDA5;
+    case 0xFDA7: goto L_FDA7;
+    case 0xFDAA: goto L_FDAA;
+    case 0xFDAB: goto L_FDAB;
+    case 0xFDAD: goto L_FDAD;
+    case 0xFDAF: goto L_FDAF;
+    case 0xFDB1: goto L_FDB1;
+    case 0xFDB3: goto L_FDB3;
+    case 0xFDB5: goto L_FDB5;
+    case 0xFDB8: goto L_FDB8;
+    case 0xFDBA: goto L_FDBA;
+    case 0xFDBC: goto L_FDBC;
+    case 0xFDBE: goto L_FDBE;
+    case 0xFDC0: goto L_FDC0;
+    case 0xFDC2: goto L_FDC2;
+    case 0xFDC4: goto L_FDC4;
+    case 0xFDC6: goto L_FDC6;
+    case 0xFDC8: goto L_FDC8;
+    case 0xFDCA: goto L_FDCA;
+    case 0xFDCC: goto L_FDCC;
+    case 0xFDCF: goto L_FDCF;
+    case 0xFDD2: goto L_FDD2;
+    case 0xFDD4: goto L_FDD4;
+    case 0xFDD7: goto L_FDD7;
+    case 0xFDD9: goto L_FDD9;
+    case 0xFDDC: goto L_FDDC;
+    case 0xFDDE: goto L_FDDE;
+    case 0xFDE0: goto L_FDE0;
+    case 0xFDE2: goto L_FDE2;
+    case 0xFDE5: goto L_FDE5;
+    case 0xFDE7: goto L_FDE7;
+    case 0xFDE9: goto L_FDE9;
+    case 0xFDEB: goto L_FDEB;
+    case 0xFDEE: goto L_FDEE;
+    case 0xFDF9: goto L_FDF9;
+    case 0xFDFB: goto L_FDFB;
+    case 0xFDFE: goto L_FDFE;
+    case 0xFE01: goto L_FE01;
+    case 0xFE03: goto L_FE03;
+    case 0xFE06: goto L_FE06;
+    case 0xFE08: goto L_FE08;
+    case 0xFE0B: goto L_FE0B;
+    case 0xFE0D: goto L_FE0D;
+    case 0xFE10: goto L_FE10;
+    case 0xFE12: goto L_FE12;
+    case 0xFE15: goto L_FE15;
+    case 0xFE17: goto L_FE17;
+    case 0xFE1A: goto L_FE1A;
+    case 0xFE1C: goto L_FE1C;
+    case 0xFE1F: goto L_FE1F;
+    case 0xFE21: goto L_FE21;
+    case 0xFE24: goto L_FE24;
+    case 0xFE26: goto L_FE26;
+    case 0xFE29: goto L_FE29;
+    case 0xFE2B: goto L_FE2B;
+    case 0xFE2E: goto L_FE2E;
+    case 0xFE31: goto L_FE31;
+    case 0xFE33: goto L_FE33;
+    case 0xFE36: goto L_FE36;
+    case 0xFE39: goto L_FE39;
+    case 0xFE3B: goto L_FE3B;
+    case 0xFE3E: goto L_FE3E;
+    case 0xFE40: goto L_FE40;
+    case 0xFE43: goto L_FE43;
+    case 0xFE45: goto L_FE45;
+    case 0xFE48: goto L_FE48;
+    case 0xFE49: goto L_FE49;
+    case 0xFE4B: goto L_FE4B;
+    case 0xFE4D: goto L_FE4D;
+    case 0xFE4F: goto L_FE4F;
+    case 0xFE50: goto L_FE50;
+    case 0xFE52: goto L_FE52;
+    case 0xFE54: goto L_FE54;
+    case 0xFE56: goto L_FE56;
+    case 0xFE57: goto L_FE57;
+    case 0xFE59: goto L_FE59;
+    case 0xFE5B: goto L_FE5B;
+    case 0xFE5D: goto L_FE5D;
+    case 0xFE60: goto L_FE60;
+    case 0xFE62: goto L_FE62;
+    case 0xFE65: goto L_FE65;
+    case 0xFE66: goto L_FE66;
+    case 0xFE68: goto L_FE68;
+    case 0xFE6A: goto L_FE6A;
+    case 0xFE6C: goto L_FE6C;
+    case 0xFE6E: goto L_FE6E;
+    case 0xFE6F: goto L_FE6F;
+    case 0xFE72: goto L_FE72;
+    case 0xFE73: goto L_FE73;
+    case 0xFE75: goto L_FE75;
+    case 0xFE78: goto L_FE78;
+    case 0xFE7B: goto L_FE7B;
+    case 0xFE7E: goto L_FE7E;
+    case 0xFE81: goto L_FE81;
+    case 0xFE82: goto L_FE82;
+    case 0xFE84: goto L_FE84;
+    case 0xFE87: goto L_FE87;
+    case 0xFE8A: goto L_FE8A;
+    case 0xFE8D: goto L_FE8D;
+    case 0xFE90: goto L_FE90;
+    case 0xFE91: goto L_FE91;
+    case 0xFE93: goto L_FE93;
+    case 0xFE94: goto L_FE94;
+    case 0xFE96: goto L_FE96;
+    case 0xFE98: goto L_FE98;
+    case 0xFE9A: goto L_FE9A;
+    case 0xFE9C: goto L_FE9C;
+    case 0xFE9D: goto L_FE9D;
+    case 0xFE9F: goto L_FE9F;
+    case 0xFEA1: goto L_FEA1;
+    case 0xFEA3: goto L_FEA3;
+    case 0xFEA4: goto L_FEA4;
+    case 0xFEA5: goto L_FEA5;
+    case 0xFEA6: goto L_FEA6;
+    case 0xFEA8: goto L_FEA8;
+    case 0xFEA9: goto L_FEA9;
+    case 0xFEAA: goto L_FEAA;
+    case 0xFEAD: goto L_FEAD;
+    case 0xFEAE: goto L_FEAE;
+    case 0xFEAF: goto L_FEAF;
+    case 0xFEB0: goto L_FEB0;
+    case 0xFEB1: goto L_FEB1;
+    case 0xFEB2: goto L_FEB2;
+    case 0xFEB5: goto L_FEB5;
+    case 0xFEB7: goto L_FEB7;
+    case 0xFEBA: goto L_FEBA;
+    case 0xFEBB: goto L_FEBB;
+    case 0xFEBD: goto L_FEBD;
+    case 0xFEBF: goto L_FEBF;
+    case 0xFEC2: goto L_FEC2;
+    case 0xFEC4: goto L_FEC4;
+    case 0xFEC7: goto L_FEC7;
+    case 0xFECA: goto L_FECA;
+    case 0xFECD: goto L_FECD;
+    case 0xFED0: goto L_FED0;
+    case 0xFED2: goto L_FED2;
+    case 0xFED5: goto L_FED5;
+    case 0xFED8: goto L_FED8;
+    case 0xFEDB: goto L_FEDB;
+    case 0xFEDE: goto L_FEDE;
+    case 0xFEE1: goto L_FEE1;
+    case 0xFEE3: goto L_FEE3;
+    case 0xFEE4: goto L_FEE4;
+    case 0xFEE6: goto L_FEE6;
+    case 0xFEE9: goto L_FEE9;
+    case 0xFEEA: goto L_FEEA;
+    case 0xFEEC: goto L_FEEC;
+    case 0xFEEE: goto L_FEEE;
+    case 0xFEF0: goto L_FEF0;
+    case 0xFEF2: goto L_FEF2;
+    case 0xFEF5: goto L_FEF5;
+    case 0xFEF8: goto L_FEF8;
+    case 0xFEF9: goto L_FEF9;
+    case 0xFEFC: goto L_FEFC;
+    case 0xFEFF: goto L_FEFF;
+    case 0xFF02: goto L_FF02;
+    case 0xFF03: goto L_FF03;
+    case 0xFF05: goto L_FF05;
+    case 0xFF07: goto L_FF07;
+    case 0xFF0A: goto L_FF0A;
+    case 0xFF0C: goto L_FF0C;
+    case 0xFF0E: goto L_FF0E;
+    case 0xFF11: goto L_FF11;
+    case 0xFF13: goto L_FF13;
+    case 0xFF16: goto L_FF16;
+    case 0xFF19: goto L_FF19;
+    case 0xFF1C: goto L_FF1C;
+    case 0xFF1F: goto L_FF1F;
+    case 0xFF22: goto L_FF22;
+    case 0xFF23: goto L_FF23;
+    case 0xFF26: goto L_FF26;
+    case 0xFF29: goto L_FF29;
+    case 0xFF2C: goto L_FF2C;
+    case 0xFF2D: goto L_FF2D;
+    case 0xFF2F: goto L_FF2F;
+    case 0xFF31: goto L_FF31;
+    case 0xFF34: goto L_FF34;
+    case 0xFF36: goto L_FF36;
+    case 0xFF38: goto L_FF38;
+    case 0xFF39: goto L_FF39;
+    case 0xFF3A: goto L_FF3A;
+    case 0xFF3D: goto L_FF3D;
+    case 0xFF40: goto L_FF40;
+    case 0xFF43: goto L_FF43;
+    case 0xFF46: goto L_FF46;
+    case 0xFF49: goto L_FF49;
+    case 0xFF4A: goto L_FF4A;
+    case 0xFF4C: goto L_FF4C;
+    case 0xFF4E: goto L_FF4E;
+    case 0xFF51: goto L_FF51;
+    case 0xFF54: goto L_FF54;
+    case 0xFF56: goto L_FF56;
+    case 0xFF57: goto L_FF57;
+    case 0xFF58: goto L_FF58;
+    case 0xFF59: goto L_FF59;
+    case 0xFF5A: goto L_FF5A;
+    case 0xFF5B: goto L_FF5B;
+    case 0xFF72: goto L_FF72;
+    case 0xFF73: goto L_FF73;
+    case 0xFF74: goto L_FF74;
+    case 0xFF75: goto L_FF75;
+    case 0xFF76: goto L_FF76;
+    case 0xFF77: goto L_FF77;
+    case 0xFF78: goto L_FF78;
+    case 0xFF7B: goto L_FF7B;
+    case 0xFF7D: goto L_FF7D;
+    case 0xFF7F: goto L_FF7F;
+    case 0xFF82: goto L_FF82;
+    case 0xFF8A: goto L_FF8A;
+    case 0xFF8D: goto L_FF8D;
+    case 0xFF90: goto L_FF90;
+    case 0xFF93: goto L_FF93;
+    case 0xFF96: goto L_FF96;
+    case 0xFF99: goto L_FF99;
+    case 0xFF9C: goto L_FF9C;
+    case 0xFF9F: goto L_FF9F;
+    case 0xFFA2: goto L_FFA2;
+    case 0xFFA5: goto L_FFA5;
+    case 0xFFA8: goto L_FFA8;
+    case 0xFFAB: goto L_FFAB;
+    case 0xFFAE: goto L_FFAE;
+    case 0xFFB1: goto L_FFB1;
+    case 0xFFB4: goto L_FFB4;
+    case 0xFFB7: goto L_FFB7;
+    case 0xFFBA: goto L_FFBA;
+    case 0xFFBD: goto L_FFBD;
+    case 0xFFC0: goto L_FFC0;
+    case 0xFFC3: goto L_FFC3;
+    case 0xFFC6: goto L_FFC6;
+    case 0xFFC9: goto L_FFC9;
+    case 0xFFCC: goto L_FFCC;
+    case 0xFFCF: goto L_FFCF;
+    case 0xFFD2: goto L_FFD2;
+    case 0xFFD5: goto L_FFD5;
+    case 0xFFD8: goto L_FFD8;
+    case 0xFFDB: goto L_FFDB;
+    case 0xFFDE: goto L_FFDE;
+    case 0xFFE1: goto L_FFE1;
+    case 0xFFE4: goto L_FFE4;
+    case 0xFFE7: goto L_FFE7;
+    case 0xFFEA: goto L_FFEA;
+    case 0xFFED: goto L_FFED;
+    case 0xFFF0: goto L_FFF0;
+    case 0xFFF3: goto L_FFF3;
+    default: goto out;
+    }
+
+out:
+    c->pc = pc;
+    c->sp = sp;
+    c->a = a;
+    c->x = x;
+    c->y = y;
+    c->status = GETSTATUS;
+    c->clockticks = clk;
+    c->instructions += count;
+}
@@ -0,0 +1,13 @@
+#ifndef _ROMS_NATIVE_H_
+#define _ROMS_NATIVE_H_
+
+#include <stdint.h>
+
+#include "cpu/fake6502.h"
+
+// The VIC-20 BASIC and KERNAL ROMs translated to C by rom2c ('make fakeaot'),
+// for native6502(vic20_native, vic20_nativemap)
+extern void vic20_native(cpu6502_t *c, uint32_t goal);
+extern const uint8_t vic20_nativemap[0x2000];
+
+#endif
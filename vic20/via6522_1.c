@@ -409,8 +409,10 @@ bool via1_tick(int cycles)
    via1__timer1Counter -= cycles;
    if (via1__timer1Counter <= 0) {
      if (via1__ACR & VIA_ACR_T1_FREERUN) {
-       // free run, reload from latch
-       via1__timer1Counter += (via1__timer1Latch - 1) + 3;  // +2 delay before next start
+       // free run, reload from latch, as often as it ran out
+       do
+         via1__timer1Counter += (via1__timer1Latch - 1) + 3;  // +2 delay before next start
+       while (via1__timer1Counter <= 0);
        via1__IFR |= VIA_IER_T1;  // set interrupt flag
      } else if (!via1__timer1Triggered) {
        // one shot
@@ -452,6 +454,21 @@ bool via1_tick(int cycles)
    return via1__IER & via1__IFR & 0x7f;
 }
 
+
+ // cycles until an enabled timer runs out, the soonest tick() can
+ // raise the IRQ by itself. A one-shot T1 or T2 that already fired
+ // doesn't count, it won't raise it again until it's written
+int via1_cyclesToEvent()
+ {
+   int n = 0x10000;
+
+   if ((via1__IER & VIA_IER_T1) && ((via1__ACR & VIA_ACR_T1_FREERUN) || !via1__timer1Triggered) && via1__timer1Counter < n)
+     n = via1__timer1Counter;
+   if ((via1__IER & VIA_IER_T2) && (via1__ACR & VIA_ACR_T2_COUNTPULSES) == 0 && !via1__timer2Triggered && via1__timer2Counter < n)
+     n = via1__timer2Counter;
+   return n > 0 ? n : 1;
+}
+
  
 uint8_t via1_PA() 
 { 
@@ -68,6 +68,7 @@ void via1_reset();
 void via1_writeReg(int reg, int value);
 int via1_readReg(int reg);
 bool via1_tick(int cycles);
+int via1_cyclesToEvent();
  
 // set/get "external" state of PA
 uint8_t via1_PA();
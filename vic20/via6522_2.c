@@ -407,8 +407,10 @@ bool via2_tick(int cycles)
    via2__timer1Counter -= cycles;
    if (via2__timer1Counter <= 0) {
      if (via2__ACR & VIA_ACR_T1_FREERUN) {
-       // free run, reload from latch
-       via2__timer1Counter += (via2__timer1Latch - 1) + 3;  // +2 delay before next start
+       // free run, reload from latch, as often as it ran out
+       do
+         via2__timer1Counter += (via2__timer1Latch - 1) + 3;  // +2 delay before next start
+       while (via2__timer1Counter <= 0);
        via2__IFR |= VIA_IER_T1;  // set interrupt flag
      } else if (!via2__timer1Triggered) {
        // one shot
@@ -450,6 +452,21 @@ bool via2_tick(int cycles)
    return via2__IER & via2__IFR & 0x7f;
 }
 
+
+ // cycles until an enabled timer runs out, the soonest tick() can
+ // raise the IRQ by itself. A one-shot T1 or T2 that already fired
+ // doesn't count, it won't raise it again until it's written
+int via2_cyclesToEvent()
+ {
+   int n = 0x10000;
+
+   if ((via2__IER & VIA_IER_T1) && ((via2__ACR & VIA_ACR_T1_FREERUN) || !via2__timer1Triggered) && via2__timer1Counter < n)
+     n = via2__timer1Counter;
+   if ((via2__IER & VIA_IER_T2) && (via2__ACR & VIA_ACR_T2_COUNTPULSES) == 0 && !via2__timer2Triggered && via2__timer2Counter < n)
+     n = via2__timer2Counter;
+   return n > 0 ? n : 1;
+}
+
 uint8_t via2_PA()
 {
   return via2__PA; 
@@ -69,6 +69,7 @@ void via2_reset();
 void via2_writeReg(int reg, int value);
 int via2_readReg(int reg);
 bool via2_tick(int cycles);
+int via2_cyclesToEvent();
  
 // set/get "external" state of PA
 uint8_t via2_PA();